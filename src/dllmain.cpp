@@ -11,6 +11,15 @@
 #include "ermerchant_messages.hpp"
 #include "ermerchant_shops.hpp"
 #include "ermerchant_talkscript.hpp"
+#include "from/param_snapshot.hpp"
+#include "from/paramdef/EQUIP_PARAM_ACCESSORY_ST.hpp"
+#include "from/paramdef/EQUIP_PARAM_GEM_ST.hpp"
+#include "from/paramdef/EQUIP_PARAM_GOODS_ST.hpp"
+#include "from/paramdef/EQUIP_PARAM_PROTECTOR_ST.hpp"
+#include "from/paramdef/EQUIP_PARAM_WEAPON_ST.hpp"
+#include "from/paramdef/ITEMLOT_PARAM_ST.hpp"
+#include "from/paramdef/REINFORCE_PARAM_WEAPON_ST.hpp"
+#include "from/paramdef/SHOP_LINEUP_PARAM.hpp"
 #include "from/params.hpp"
 #include "modutils.hpp"
 
@@ -21,7 +30,7 @@ static void setup_logger(std::filesystem::path log_file)
     auto logger = std::make_shared<spdlog::logger>("merchant");
     logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%n] %^[%l]%$ %v");
     logger->sinks().push_back(
-        std::make_shared<spdlog::sinks::daily_file_sink_st>(log_file.string(), 0, 0, false, 5));
+        std::make_shared<spdlog::sinks::daily_file_sink_mt>(log_file.string(), 0, 0, false, 5));
     logger->flush_on(spdlog::level::info);
 
 #if _DEBUG
@@ -30,18 +39,40 @@ static void setup_logger(std::filesystem::path log_file)
     freopen_s(&stream, "CONOUT$", "w", stdout);
     freopen_s(&stream, "CONOUT$", "w", stderr);
     freopen_s(&stream, "CONIN$", "r", stdin);
-    logger->sinks().push_back(std::make_shared<spdlog::sinks::stdout_color_sink_st>());
+    logger->sinks().push_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
     logger->set_level(spdlog::level::trace);
 #endif
 
     spdlog::set_default_logger(logger);
 }
 
-static void setup_mod()
+/**
+ * Save every param read by the shop setup, so it can be inspected without the game
+ */
+static void save_param_snapshot(const std::filesystem::path &snapshot_file)
+{
+    from::params::ParamSnapshotWriter snapshot;
+    snapshot.add<from::paramdef::EQUIP_PARAM_ACCESSORY_ST>();
+    snapshot.add<from::paramdef::EQUIP_PARAM_GEM_ST>();
+    snapshot.add<from::paramdef::EQUIP_PARAM_GOODS_ST>();
+    snapshot.add<from::paramdef::EQUIP_PARAM_PROTECTOR_ST>();
+    snapshot.add<from::paramdef::EQUIP_PARAM_WEAPON_ST>();
+    snapshot.add<from::paramdef::ITEMLOT_PARAM_ST>();
+    snapshot.add<from::paramdef::REINFORCE_PARAM_WEAPON_ST>();
+    snapshot.add<from::paramdef::SHOP_LINEUP_PARAM>();
+    snapshot.save(snapshot_file);
+}
+
+static void setup_mod(const std::filesystem::path &folder)
 {
     modutils::initialize();
     from::params::initialize();
 
+    if (ermerchant::config::save_param_snapshot)
+    {
+        save_param_snapshot(folder / "ermerchant_params.snapshot");
+    }
+
     spdlog::info("Sleeping an extra 10s to work potential compatibility issues...");
     std::this_thread::sleep_for(std::chrono::seconds(10));
 
@@ -49,13 +80,32 @@ static void setup_mod()
     ermerchant::setup_messages();
 
     spdlog::info("Hooking shops...");
-    ermerchant::setup_shops();
+    ermerchant::setup_shops(folder / "ermerchant_shops.cache");
 
     spdlog::info("Hooking talkscripts...");
     ermerchant::setup_talkscript();
 
     modutils::enable_hooks();
     spdlog::info("Initialized mod");
+
+    // The hooks build any shop that's opened before this gets to it, so the rest are built on a
+    // detached thread instead of holding up the mod thread, which is joined when the game exits
+    spdlog::info("Building shops...");
+    std::thread([]() {
+        try
+        {
+            ermerchant::prewarm_shops();
+
+            for (auto &param_name : from::params::get_unsorted_param_names())
+            {
+                spdlog::info("Param {} needed a sorted index", modutils::utf8{param_name});
+            }
+        }
+        catch (std::exception const &e)
+        {
+            spdlog::error("Error building shops: {}", e.what());
+        }
+    }).detach();
 }
 
 bool WINAPI DllMain(HINSTANCE dll_instance, unsigned int fdw_reason, void *lpv_reserved)
@@ -74,10 +124,10 @@ bool WINAPI DllMain(HINSTANCE dll_instance, unsigned int fdw_reason, void *lpv_r
 
         ermerchant::load_config(folder / "ermerchant.ini");
 
-        mod_thread = std::thread([]() {
+        mod_thread = std::thread([folder]() {
             try
             {
-                setup_mod();
+                setup_mod(folder);
             }
             catch (std::runtime_error const &e)
             {
@@ -4,6 +4,8 @@
 #include <spdlog/spdlog.h>
 
 extern bool ermerchant::config::auto_upgrade_weapons = true;
+extern bool ermerchant::config::save_param_snapshot = false;
+extern std::vector<std::pair<std::string, std::string>> ermerchant::config::goods_shop_rules = {};
 
 void ermerchant::load_config(const std::filesystem::path &ini_path)
 {
@@ -18,6 +20,18 @@ void ermerchant::load_config(const std::filesystem::path &ini_path)
         if (config.has("auto_upgrade_weapons"))
             config::auto_upgrade_weapons = config["auto_upgrade_weapons"] != "false";
 
+        if (config.has("save_param_snapshot"))
+            config::save_param_snapshot = config["save_param_snapshot"] == "true";
+
         spdlog::info("auto_upgrade_weapons = {}", config::auto_upgrade_weapons);
+        spdlog::info("save_param_snapshot = {}", config::save_param_snapshot);
+    }
+
+    if (ini.has("goods_shops"))
+    {
+        for (auto &[key, shop_name] : ini["goods_shops"])
+        {
+            config::goods_shop_rules.emplace_back(key, shop_name);
+        }
     }
 }
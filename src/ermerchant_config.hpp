@@ -1,6 +1,9 @@
 #pragma once
 
 #include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace ermerchant
 {
@@ -16,5 +19,17 @@ namespace config
  */
 extern bool auto_upgrade_weapons;
 
+/**
+ * Save the params read by the mod to a snapshot file next to the DLL, so they can be inspected
+ * or diffed outside of the game
+ */
+extern bool save_param_snapshot;
+
+/**
+ * Rules from the [goods_shops] section for sorting goods into shops, which take precedence over
+ * the built-in rules. See ermerchant_shop_rules.hpp for the format.
+ */
+extern std::vector<std::pair<std::string, std::string>> goods_shop_rules;
+
 };
 };
@@ -8,8 +8,14 @@
 
 #include <steam/isteamapps.h>
 
+#include <algorithm>
 #include <chrono>
+#include <climits>
+#include <cstddef>
 #include <map>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <spdlog/spdlog.h>
 #include <string>
 #include <thread>
@@ -19,11 +25,76 @@
 
 static const std::map<int, const std::wstring> *mod_event_text_for_talk;
 
+static std::string game_language;
+
 static from::CS::MsgRepositoryImp *msg_repository = nullptr;
 
 static const wchar_t *(*msg_repository_lookup_entry)(from::CS::MsgRepositoryImp *, unsigned int,
                                                      from::msgbnd, int);
 
+/**
+ * A message table read in place from the FMG the game loaded, so the mod's lookups don't call
+ * into the game
+ */
+struct fmg_table
+{
+    const std::byte *data;
+    std::span<const from::FmgGroup> groups;
+    std::span<const int64_t> string_offsets;
+
+    /**
+     * Returns the message in the group at the given index, if the group contains the ID
+     */
+    std::wstring_view get(size_t group_index, int msg_id) const
+    {
+        auto &group = groups[group_index];
+        if (msg_id < group.first_id || msg_id > group.last_id)
+        {
+            return {};
+        }
+
+        auto string_offset = string_offsets[group.string_index + (msg_id - group.first_id)];
+        if (string_offset == 0)
+        {
+            return {};
+        }
+
+        return reinterpret_cast<const wchar_t *>(data + string_offset);
+    }
+
+    std::wstring_view get(int msg_id) const
+    {
+        auto group = std::ranges::lower_bound(groups, msg_id, {}, &from::FmgGroup::last_id);
+        if (group == groups.end())
+        {
+            return {};
+        }
+
+        return get(group - groups.begin(), msg_id);
+    }
+};
+
+/**
+ * The item name tables looked up while building shops. None of them have messages added by the
+ * mod, so they can be read directly instead of going through the hooked LookupEntry().
+ */
+static constexpr from::msgbnd item_name_bnds[] = {
+    from::msgbnd::goods_name,         from::msgbnd::weapon_name,
+    from::msgbnd::protector_name,     from::msgbnd::accessory_name,
+    from::msgbnd::gem_name,           from::msgbnd::dlc_weapon_name,
+    from::msgbnd::dlc_protector_name, from::msgbnd::dlc_accessory_name,
+    from::msgbnd::dlc_goods_name,     from::msgbnd::dlc_gem_name,
+};
+
+/**
+ * Tables found by setup_messages(). Neither the map nor the tables are written afterwards, so the
+ * shop build threads read them without locking.
+ */
+static std::map<from::msgbnd, fmg_table> fmg_tables;
+
+// Serializes the mod's calls to LookupEntry() for tables that couldn't be read directly
+static std::mutex lookup_entry_mutex;
+
 /**
  * Hook for MsgRepositoryImp::LookupEntry()
  *
@@ -46,10 +117,125 @@ static const wchar_t *msg_repository_lookup_entry_detour(from::CS::MsgRepository
     return msg_repository_lookup_entry(msg_repository, unknown, bnd_id, msg_id);
 }
 
+/**
+ * Reads the header of a loaded FMG, returning an empty optional if it doesn't have the expected
+ * layout
+ */
+static std::optional<fmg_table> read_fmg_table(const from::FmgHeader *header)
+{
+    if (!modutils::is_readable(header, sizeof(from::FmgHeader)) || header->big_endian ||
+        header->version != 2 || header->file_size < static_cast<int32_t>(sizeof(from::FmgHeader)) ||
+        !modutils::is_readable(header, header->file_size) || header->group_count < 0 ||
+        header->string_count < 0)
+    {
+        return std::nullopt;
+    }
+
+    auto data = reinterpret_cast<const std::byte *>(header);
+    auto groups_end = sizeof(from::FmgHeader) + header->group_count * sizeof(from::FmgGroup);
+    auto string_offsets_end =
+        header->string_offsets_offset + header->string_count * sizeof(int64_t);
+    if (groups_end > static_cast<size_t>(header->file_size) ||
+        header->string_offsets_offset < static_cast<int64_t>(groups_end) ||
+        string_offsets_end > static_cast<size_t>(header->file_size))
+    {
+        return std::nullopt;
+    }
+
+    fmg_table table = {
+        .data = data,
+        .groups = {reinterpret_cast<const from::FmgGroup *>(data + sizeof(from::FmgHeader)),
+                   static_cast<size_t>(header->group_count)},
+        .string_offsets = {reinterpret_cast<const int64_t *>(data + header->string_offsets_offset),
+                           static_cast<size_t>(header->string_count)},
+    };
+
+    // The lookups binary search and merge over the groups, so they must be sorted and disjoint,
+    // and every string they point to must be inside the file
+    for (size_t i = 0; i < table.groups.size(); i++)
+    {
+        auto &group = table.groups[i];
+        auto string_count = static_cast<int64_t>(group.last_id) - group.first_id + 1;
+        if (group.first_id > group.last_id ||
+            (i > 0 && table.groups[i - 1].last_id >= group.first_id) || group.string_index < 0 ||
+            group.string_index + string_count > header->string_count)
+        {
+            return std::nullopt;
+        }
+    }
+
+    for (auto string_offset : table.string_offsets)
+    {
+        if (string_offset != 0 && (string_offset < static_cast<int64_t>(sizeof(from::FmgHeader)) ||
+                                   string_offset >= header->file_size))
+        {
+            return std::nullopt;
+        }
+    }
+
+    return table;
+}
+
+/**
+ * Finds the loaded item name tables, so get_message() and get_messages() can read them directly.
+ * Each table is checked against LookupEntry() for the first and last ID of its groups, and any
+ * table that doesn't match keeps using LookupEntry().
+ */
+static void find_fmg_tables()
+{
+    if (!modutils::is_readable(msg_repository, sizeof(from::CS::MsgRepositoryImp)) ||
+        msg_repository->version_count == 0 ||
+        !modutils::is_readable(msg_repository->fmgs, sizeof(from::FmgHeader **)) ||
+        !modutils::is_readable(msg_repository->fmgs[0],
+                               msg_repository->bnd_count * sizeof(from::FmgHeader *)))
+    {
+        spdlog::warn("Unexpected message repository layout, looking up item names through the "
+                     "game");
+        return;
+    }
+
+    for (auto bnd_id : item_name_bnds)
+    {
+        if (static_cast<unsigned int>(bnd_id) >= msg_repository->bnd_count)
+        {
+            continue;
+        }
+
+        auto table = read_fmg_table(msg_repository->fmgs[0][static_cast<unsigned int>(bnd_id)]);
+        if (!table)
+        {
+            spdlog::warn("Unexpected layout for message table {}, looking it up through the game",
+                         static_cast<unsigned int>(bnd_id));
+            continue;
+        }
+
+        auto matches_lookup_entry = [&](int msg_id) {
+            auto expected = msg_repository_lookup_entry(msg_repository, 0, bnd_id, msg_id);
+            return table->get(msg_id) ==
+                   (expected ? std::wstring_view(expected) : std::wstring_view());
+        };
+
+        auto is_valid = std::ranges::all_of(table->groups, [&](auto &group) {
+            return matches_lookup_entry(group.first_id) && matches_lookup_entry(group.last_id) &&
+                   (group.last_id == INT_MAX || matches_lookup_entry(group.last_id + 1));
+        });
+        if (!is_valid)
+        {
+            spdlog::warn("Message table {} doesn't match the game's lookups, looking it up through "
+                         "the game",
+                         static_cast<unsigned int>(bnd_id));
+            continue;
+        }
+
+        fmg_tables.emplace(bnd_id, *table);
+    }
+}
+
 void ermerchant::setup_messages()
 {
     // Pick the messages to use based on the player's selected language for the game in Steam
     auto language = SteamApps()->GetCurrentGameLanguage();
+    game_language = language;
     auto localized_messages = event_text_for_talk_by_lang.find(language);
     if (localized_messages != event_text_for_talk_by_lang.end())
     {
@@ -84,10 +270,59 @@ void ermerchant::setup_messages()
             .relative_offsets = {{1, 5}},
         },
         msg_repository_lookup_entry_detour, msg_repository_lookup_entry);
+
+    find_fmg_tables();
+}
+
+std::string_view ermerchant::get_language()
+{
+    return game_language;
 }
 
 const std::wstring_view ermerchant::get_message(from::msgbnd bnd_id, int msg_id)
 {
+    auto table = fmg_tables.find(bnd_id);
+    if (table != fmg_tables.end())
+    {
+        return table->second.get(msg_id);
+    }
+
+    std::lock_guard lock(lookup_entry_mutex);
     auto result = msg_repository_lookup_entry(msg_repository, 0, bnd_id, msg_id);
     return result ? std::wstring_view(result) : std::wstring_view();
+}
+
+void ermerchant::get_messages(from::msgbnd bnd_id, std::span<const int> msg_ids,
+                              std::span<std::wstring_view> results)
+{
+    if (msg_ids.size() != results.size())
+    {
+        spdlog::error("Message batch lookup of {} IDs given {} results", msg_ids.size(),
+                      results.size());
+        throw std::runtime_error("Message batch size mismatch");
+    }
+
+    auto table = fmg_tables.find(bnd_id);
+    if (table == fmg_tables.end() || !std::ranges::is_sorted(msg_ids))
+    {
+        for (size_t i = 0; i < msg_ids.size(); i++)
+        {
+            results[i] = get_message(bnd_id, msg_ids[i]);
+        }
+        return;
+    }
+
+    // Walk the sorted IDs and the table's groups together, so each group is visited once
+    auto &groups = table->second.groups;
+    size_t group_index = 0;
+    for (size_t i = 0; i < msg_ids.size(); i++)
+    {
+        while (group_index < groups.size() && groups[group_index].last_id < msg_ids[i])
+        {
+            group_index++;
+        }
+
+        results[i] = group_index < groups.size() ? table->second.get(group_index, msg_ids[i])
+                                                 : std::wstring_view();
+    }
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <map>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include "from/messages.hpp"
 
@@ -37,8 +39,25 @@ static constexpr int sell = 20000011;
 }
 
 void setup_messages();
+
+/**
+ * The game language selected in Steam, e.g. "english". Item names depend on it.
+ */
+std::string_view get_language();
+
+/**
+ * Looks up a message, returning an empty string if there isn't one. Item names are read directly
+ * from the game's loaded message tables without locking. Other messages, and any table that
+ * setup_messages() couldn't verify, go through the game's message repository one call at a time.
+ */
 const std::wstring_view get_message(from::msgbnd, int);
 
+/**
+ * Looks up the messages for many IDs at once. If the IDs are sorted, an item name table is read
+ * in a single pass instead of a search per ID.
+ */
+void get_messages(from::msgbnd, std::span<const int> msg_ids, std::span<std::wstring_view> results);
+
 extern const std::map<std::string, std::map<int, const std::wstring>> event_text_for_talk_by_lang;
 
 }
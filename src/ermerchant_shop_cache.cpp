@@ -0,0 +1,285 @@
+/**
+ * ermerchant_shop_cache.cpp
+ *
+ * On-disk cache of the mod shops. Building the shops scans every item param and looks up the
+ * names of most items, so the results are saved and reused on the next launch as long as the
+ * params, game language, goods shop rules and mod version are the same.
+ *
+ * The file is a cache_header, followed by the key's param fingerprints, the number of lineups in
+ * each shop, every shop's lineups back to back, the storage box exclusions and the max reinforce
+ * levels.
+ */
+#include "ermerchant_shop_cache.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+
+#include "modutils.hpp"
+
+using namespace std;
+
+namespace
+{
+
+constexpr char magic[8] = {'E', 'R', 'M', 'S', 'H', 'O', 'P', 'S'};
+
+// Bump this when the file layout changes. Changes to how the shops are built are covered by the
+// mod version in the key.
+constexpr uint32_t format_version = 2;
+
+// Upper bound on the number of shops, so a corrupt count can't cause a huge allocation
+constexpr uint32_t max_shop_count = 64;
+
+struct cache_header
+{
+    char magic[8];
+    uint32_t format_version;
+    uint32_t fingerprint_count;
+    char mod_version[32];
+    char language[32];
+    uint32_t shop_count;
+    uint32_t no_repository_item_count;
+    uint32_t max_level_count;
+    uint32_t reserved;
+    uint64_t goods_shop_rules_hash;
+};
+
+struct cache_fingerprint
+{
+    uint64_t num_rows;
+    uint64_t ids_hash;
+    uint64_t data_hash;
+};
+
+struct cache_max_level
+{
+    int16_t reinforce_type_id;
+    uint8_t level;
+    uint8_t padding;
+};
+
+template <size_t N> void copy_string(char (&field)[N], string_view value)
+{
+    memset(field, 0, N);
+    memcpy(field, value.data(), min(value.size(), N - 1));
+}
+
+template <size_t N> bool string_equals(const char (&field)[N], string_view value)
+{
+    return string_view(field, strnlen(field, N)) == value;
+}
+
+cache_fingerprint to_cache_fingerprint(const from::params::ParamFingerprint &fingerprint)
+{
+    return {fingerprint.num_rows, fingerprint.ids_hash, fingerprint.data_hash};
+}
+
+/**
+ * Reads consecutive values from the mapped file, failing instead of reading past the end
+ */
+class cache_reader
+{
+  public:
+    explicit cache_reader(span<const std::byte> data) : data(data)
+    {
+    }
+
+    template <typename T> bool read(T &value)
+    {
+        return read(span(&value, 1));
+    }
+
+    template <typename T> bool read(span<T> values)
+    {
+        if (values.size_bytes() > data.size())
+        {
+            return false;
+        }
+
+        memcpy(values.data(), data.data(), values.size_bytes());
+        data = data.subspan(values.size_bytes());
+        return true;
+    }
+
+    template <typename T> bool read(vector<T> &values, size_t count)
+    {
+        if (count > data.size() / sizeof(T))
+        {
+            return false;
+        }
+
+        values.resize(count);
+        return read(span(values));
+    }
+
+    bool at_end() const
+    {
+        return data.empty();
+    }
+
+  private:
+    span<const std::byte> data;
+};
+
+}
+
+bool ermerchant::load_shop_cache(const filesystem::path &path, const shop_cache_key &key,
+                                 shop_cache_contents &contents)
+{
+    error_code ec;
+    if (!filesystem::exists(path, ec))
+    {
+        spdlog::info("No shop cache found, building shops");
+        return false;
+    }
+
+    try
+    {
+        modutils::mapped_file file(path);
+        cache_reader reader(file.data());
+
+        auto invalid = [&]() {
+            spdlog::warn("Shop cache {} is corrupt, rebuilding shops", path.string());
+            return false;
+        };
+
+        cache_header header;
+        if (!reader.read(header) || memcmp(header.magic, magic, sizeof(magic)) != 0)
+        {
+            return invalid();
+        }
+
+        if (header.format_version != format_version ||
+            !string_equals(header.mod_version, key.mod_version) ||
+            !string_equals(header.language, key.language) ||
+            header.goods_shop_rules_hash != key.goods_shop_rules_hash ||
+            header.fingerprint_count != key.param_fingerprints.size())
+        {
+            spdlog::info("Shop cache is from a different mod version, language or goods shop "
+                         "rules, rebuilding shops");
+            return false;
+        }
+
+        vector<cache_fingerprint> fingerprints;
+        if (!reader.read(fingerprints, header.fingerprint_count))
+        {
+            return invalid();
+        }
+
+        for (size_t i = 0; i < fingerprints.size(); i++)
+        {
+            auto expected = to_cache_fingerprint(key.param_fingerprints[i]);
+            if (memcmp(&fingerprints[i], &expected, sizeof(expected)) != 0)
+            {
+                spdlog::info("Params have changed since the shop cache was saved, rebuilding "
+                             "shops");
+                return false;
+            }
+        }
+
+        vector<uint32_t> lineup_counts;
+        if (header.shop_count > max_shop_count || !reader.read(lineup_counts, header.shop_count))
+        {
+            return invalid();
+        }
+
+        shop_cache_contents result;
+        result.lineups.resize(lineup_counts.size());
+        for (size_t i = 0; i < lineup_counts.size(); i++)
+        {
+            if (!reader.read(result.lineups[i], lineup_counts[i]))
+            {
+                return invalid();
+            }
+        }
+
+        vector<cache_max_level> max_levels;
+        if (!reader.read(result.no_repository_item_ids, header.no_repository_item_count) ||
+            !reader.read(max_levels, header.max_level_count) || !reader.at_end())
+        {
+            return invalid();
+        }
+
+        result.max_level_by_reinforce_type_id.reserve(max_levels.size());
+        for (auto &max_level : max_levels)
+        {
+            result.max_level_by_reinforce_type_id.emplace_back(max_level.reinforce_type_id,
+                                                               max_level.level);
+        }
+
+        contents = std::move(result);
+    }
+    catch (runtime_error const &e)
+    {
+        spdlog::warn("Failed to read shop cache, rebuilding shops: {}", e.what());
+        return false;
+    }
+
+    spdlog::info("Loaded shops from cache {}", path.string());
+    return true;
+}
+
+void ermerchant::save_shop_cache(const filesystem::path &path, const shop_cache_key &key,
+                                 const shop_cache_contents &contents)
+{
+    cache_header header = {
+        .format_version = format_version,
+        .fingerprint_count = static_cast<uint32_t>(key.param_fingerprints.size()),
+        .shop_count = static_cast<uint32_t>(contents.lineups.size()),
+        .no_repository_item_count = static_cast<uint32_t>(contents.no_repository_item_ids.size()),
+        .max_level_count = static_cast<uint32_t>(contents.max_level_by_reinforce_type_id.size()),
+        .goods_shop_rules_hash = key.goods_shop_rules_hash,
+    };
+    memcpy(header.magic, magic, sizeof(magic));
+    copy_string(header.mod_version, key.mod_version);
+    copy_string(header.language, key.language);
+
+    // Write to a temporary file first, so a crash partway through can't leave a truncated cache
+    auto temp_path = filesystem::path(path).concat(".tmp");
+    {
+        ofstream file(temp_path, ios::binary | ios::trunc);
+        auto write = [&](const auto &values) {
+            file.write(reinterpret_cast<const char *>(values.data()), values.size_bytes());
+        };
+
+        write(span(&header, 1));
+
+        for (auto &fingerprint : key.param_fingerprints)
+        {
+            auto cached_fingerprint = to_cache_fingerprint(fingerprint);
+            write(span(&cached_fingerprint, 1));
+        }
+
+        for (auto &lineups : contents.lineups)
+        {
+            auto count = static_cast<uint32_t>(lineups.size());
+            write(span(&count, 1));
+        }
+
+        for (auto &lineups : contents.lineups)
+        {
+            write(span(lineups));
+        }
+
+        write(span(contents.no_repository_item_ids));
+
+        for (auto [reinforce_type_id, level] : contents.max_level_by_reinforce_type_id)
+        {
+            cache_max_level max_level = {.reinforce_type_id = reinforce_type_id, .level = level};
+            write(span(&max_level, 1));
+        }
+
+        if (!file)
+        {
+            throw runtime_error("Failed to write shop cache " + temp_path.string());
+        }
+    }
+
+    filesystem::rename(temp_path, path);
+
+    spdlog::info("Saved shops to cache {}", path.string());
+}
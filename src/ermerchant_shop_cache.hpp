@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "from/paramdef/SHOP_LINEUP_PARAM.hpp"
+#include "from/params.hpp"
+
+namespace ermerchant
+{
+
+/**
+ * Everything a cached set of shops depends on. A cache is only used if all of these match.
+ */
+struct shop_cache_key
+{
+    std::string_view mod_version;
+    std::string_view language;
+    std::span<const from::params::ParamFingerprint> param_fingerprints;
+    uint64_t goods_shop_rules_hash;
+};
+
+/**
+ * The results of building the mod shops from params
+ */
+struct shop_cache_contents
+{
+    std::vector<std::vector<from::paramdef::SHOP_LINEUP_PARAM>> lineups;
+    std::vector<unsigned int> no_repository_item_ids;
+    std::vector<std::pair<short, unsigned char>> max_level_by_reinforce_type_id;
+};
+
+/**
+ * Loads shops saved by save_shop_cache(), returning false if the file is missing, was saved with
+ * a different key, or is corrupt
+ */
+bool load_shop_cache(const std::filesystem::path &path, const shop_cache_key &key,
+                     shop_cache_contents &contents);
+
+void save_shop_cache(const std::filesystem::path &path, const shop_cache_key &key,
+                     const shop_cache_contents &contents);
+
+}
@@ -0,0 +1,228 @@
+#include "ermerchant_shop_rules.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <optional>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+
+using namespace std;
+
+/**
+ * Rules used to sort goods when the .ini file doesn't override them
+ */
+static constexpr pair<string_view, string_view> default_goods_shop_rules[] = {
+    // Normal items
+    {"0 * consumable", "consumables"},
+    {"0 * not_consumable", "miscellaneous_items"},
+    // Key items
+    {"1 * *", "miscellaneous_items"},
+    // Crafting materials
+    {"2 * *", "materials"},
+    // Remembrances
+    {"3 * *", "consumables"},
+    // Sorceries
+    {"5 * *", "spells"},
+    // Spirit summons
+    {"7 * *", "spirit_summons"},
+    {"8 * *", "spirit_summons"},
+    // Wondrous physick and crystal tears
+    {"9 * *", "miscellaneous_items"},
+    {"10 * *", "miscellaneous_items"},
+    // Regenerative materials
+    {"11 * *", "consumables"},
+    // Info items
+    {"12 * *", "miscellaneous_items"},
+    // Reinforcement materials
+    {"14 * *", "materials"},
+    // Great runes
+    {"15 * *", "miscellaneous_items"},
+    // Incantations and self-buff sorceries and incantations
+    {"16 * *", "spells"},
+    {"17 * *", "spells"},
+    {"18 * *", "spells"},
+    // Convergence has a unique goods type for consumable runes and remembrances
+    {"100 * *", "consumables"},
+    {"101 * *", "consumables"},
+    // Gestures, which are technically goods but are unlocked in a different way
+    {"0 250 *", "excluded"},
+    // Tutorials, which are also goods but aren't useful to buy
+    {"12 20 *", "excluded"},
+};
+
+static constexpr pair<string_view, ermerchant::goods_shop> goods_shop_names[] = {
+    {"none", ermerchant::goods_shop::none},
+    {"excluded", ermerchant::goods_shop::excluded},
+    {"spells", ermerchant::goods_shop::spells},
+    {"spirit_summons", ermerchant::goods_shop::spirit_summons},
+    {"consumables", ermerchant::goods_shop::consumables},
+    {"materials", ermerchant::goods_shop::materials},
+    {"miscellaneous_items", ermerchant::goods_shop::miscellaneous_items},
+    {"cut_goods", ermerchant::goods_shop::cut_goods},
+};
+
+/**
+ * Range of values matched by one part of a rule's key
+ */
+struct value_range
+{
+    int first;
+    int last;
+};
+
+/**
+ * Parses a number from 0 to max_value, or "*" for every value
+ */
+static optional<value_range> parse_value(string_view token, int max_value)
+{
+    if (token == "*")
+    {
+        return value_range{0, max_value};
+    }
+
+    int value = 0;
+    auto [end, ec] = from_chars(token.data(), token.data() + token.size(), value);
+    if (ec != errc{} || end != token.data() + token.size() || value < 0 || value > max_value)
+    {
+        return nullopt;
+    }
+
+    return value_range{value, value};
+}
+
+static optional<value_range> parse_consumable(string_view token)
+{
+    if (token == "*")
+    {
+        return value_range{0, 1};
+    }
+    if (token == "consumable")
+    {
+        return value_range{1, 1};
+    }
+    if (token == "not_consumable")
+    {
+        return value_range{0, 0};
+    }
+
+    return nullopt;
+}
+
+/**
+ * Splits a rule's key into exactly three whitespace-separated parts
+ */
+static optional<array<string_view, 3>> split_key(string_view key)
+{
+    array<string_view, 3> tokens;
+    size_t count = 0;
+
+    for (size_t i = 0; i < key.size();)
+    {
+        if (key[i] == ' ' || key[i] == '\t')
+        {
+            i++;
+            continue;
+        }
+
+        auto end = key.find_first_of(" \t", i);
+        if (end == string_view::npos)
+        {
+            end = key.size();
+        }
+
+        if (count == tokens.size())
+        {
+            return nullopt;
+        }
+        tokens[count++] = key.substr(i, end - i);
+        i = end;
+    }
+
+    if (count != tokens.size())
+    {
+        return nullopt;
+    }
+
+    return tokens;
+}
+
+ermerchant::goods_shop_rules::goods_shop_rules() : table(256 * 256 * 2, goods_shop::none)
+{
+}
+
+bool ermerchant::goods_shop_rules::add_rule(string_view key, string_view shop_name)
+{
+    auto shop = ranges::find(goods_shop_names, shop_name, &pair<string_view, goods_shop>::first);
+    if (shop == ranges::end(goods_shop_names))
+    {
+        return false;
+    }
+
+    auto tokens = split_key(key);
+    if (!tokens)
+    {
+        return false;
+    }
+
+    auto goods_types = parse_value((*tokens)[0], 255);
+    auto sort_group_ids = parse_value((*tokens)[1], 255);
+    auto consumable = parse_consumable((*tokens)[2]);
+    if (!goods_types || !sort_group_ids || !consumable)
+    {
+        return false;
+    }
+
+    for (int goods_type = goods_types->first; goods_type <= goods_types->last; goods_type++)
+    {
+        for (int sort_group_id = sort_group_ids->first; sort_group_id <= sort_group_ids->last;
+             sort_group_id++)
+        {
+            for (int is_consumable = consumable->first; is_consumable <= consumable->last;
+                 is_consumable++)
+            {
+                table[(goods_type << 9) | (sort_group_id << 1) | is_consumable] = shop->second;
+            }
+        }
+    }
+
+    return true;
+}
+
+uint64_t ermerchant::goods_shop_rules::hash() const
+{
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325;
+    for (auto shop : table)
+    {
+        hash = (hash ^ static_cast<uint64_t>(shop)) * 0x100000001b3;
+    }
+    return hash;
+}
+
+ermerchant::goods_shop_rules ermerchant::compile_goods_shop_rules(
+    span<const pair<string, string>> config_rules)
+{
+    goods_shop_rules rules;
+
+    for (auto [key, shop_name] : default_goods_shop_rules)
+    {
+        if (!rules.add_rule(key, shop_name))
+        {
+            throw runtime_error("Invalid default goods shop rule");
+        }
+    }
+
+    for (auto &[key, shop_name] : config_rules)
+    {
+        if (!rules.add_rule(key, shop_name))
+        {
+            spdlog::warn("Ignoring invalid goods shop rule \"{} = {}\"", key, shop_name);
+            continue;
+        }
+
+        spdlog::info("Goods shop rule {} = {}", key, shop_name);
+    }
+
+    return rules;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ermerchant
+{
+
+/**
+ * Which of the goods shops an item is sold in. Items in the DLC are sold in the DLC version of the
+ * same shop.
+ */
+enum class goods_shop : unsigned char
+{
+    // Not sold, unless the item is cut content
+    none,
+    // Never sold, even if the item is cut content
+    excluded,
+    spells,
+    spirit_summons,
+    consumables,
+    materials,
+    miscellaneous_items,
+    cut_goods,
+};
+
+/**
+ * Rules for sorting goods into shops, compiled into a flat table indexed by goodsType,
+ * sortGroupId and whether the item is consumable, so classifying a row is a single load.
+ *
+ * Each rule is written as "<goodsType> <sortGroupId> <consumable>" = "<shop>", where each part of
+ * the key is either a number, "consumable"/"not_consumable", or "*" to match anything. An item is
+ * consumable if it has isConsume set and isn't disable_offline. Later rules take precedence over
+ * earlier ones, so the defaults can be overridden by rules from the .ini file.
+ */
+class goods_shop_rules
+{
+  public:
+    goods_shop_rules();
+
+    /**
+     * Adds a rule, returning false if it isn't valid
+     */
+    bool add_rule(std::string_view key, std::string_view shop_name);
+
+    goods_shop find(unsigned char goods_type, unsigned char sort_group_id,
+                    bool is_consumable) const
+    {
+        return table[(goods_type << 9) | (sort_group_id << 1) | (is_consumable ? 1 : 0)];
+    }
+
+    /**
+     * Hash of the compiled table, for keying data derived from it
+     */
+    uint64_t hash() const;
+
+  private:
+    std::vector<goods_shop> table;
+};
+
+/**
+ * Returns the default rules, followed by the given rules from the .ini file. Invalid rules are
+ * logged and skipped.
+ */
+goods_shop_rules compile_goods_shop_rules(
+    std::span<const std::pair<std::string, std::string>> config_rules);
+
+}
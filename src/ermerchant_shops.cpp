@@ -7,8 +7,19 @@
  */
 #include "ermerchant_shops.hpp"
 
+#include <algorithm>
 #include <array>
-#include <set>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <spdlog/spdlog.h>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "from/paramdef/EQUIP_PARAM_ACCESSORY_ST.hpp"
@@ -22,11 +33,22 @@
 
 #include "ermerchant_config.hpp"
 #include "ermerchant_messages.hpp"
+#include "ermerchant_shop_cache.hpp"
+#include "ermerchant_shop_rules.hpp"
 #include "from/game_data.hpp"
+#include "from/param_columns.hpp"
+#include "from/param_filters.hpp"
 #include "from/param_lookup.hpp"
+#include "from/param_overlay.hpp"
 #include "from/params.hpp"
 #include "modutils.hpp"
 
+#ifdef PROJECT_VERSION
+static constexpr std::string_view mod_version = PROJECT_VERSION;
+#else
+static constexpr std::string_view mod_version = "dev";
+#endif
+
 static const std::wstring cut_content_prefix = L"[ERROR]";
 
 static constexpr unsigned char lot_item_category_goods = 1;
@@ -59,34 +81,11 @@ static constexpr long long protector_bare_legs_id = 10300;
 static constexpr long long goods_golden_seed_id = 10010;
 static constexpr long long goods_sacred_tear_id = 10020;
 
-static constexpr unsigned char goods_type_normal_item = 0;
-static constexpr unsigned char goods_type_key_item = 1;
-static constexpr unsigned char goods_type_crafting_material = 2;
-static constexpr unsigned char goods_type_remembrance = 3;
-static constexpr unsigned char goods_type_sorcery = 5;
-static constexpr unsigned char goods_type_spirit_summon_lesser = 7;
-static constexpr unsigned char goods_type_spirit_summon_greater = 8;
-static constexpr unsigned char goods_type_wondrous_physick = 9;
-static constexpr unsigned char goods_type_wondrous_physick_tear = 10;
-static constexpr unsigned char goods_type_regenerative_material = 11;
-static constexpr unsigned char goods_type_info_item = 12;
-static constexpr unsigned char goods_type_reinforcement_material = 14;
-static constexpr unsigned char goods_type_great_rune = 15;
-static constexpr unsigned char goods_type_incantation = 16;
-static constexpr unsigned char goods_type_self_buff_sorcery = 17;
-static constexpr unsigned char goods_type_self_buff_incantation = 18;
-// Convergence has a unique goods type for consumable runes and remembrances
-static constexpr unsigned char goods_type_convergence_rune = 100;
-static constexpr unsigned char goods_type_convergence_remembrance = 101;
-
-static constexpr unsigned char goods_sort_group_tutorial = 20;
-static constexpr unsigned char goods_sort_group_gesture = 250;
-
 /*
  * Items that are automatically given to the player in certain scenarios, and should not be
  * purchasable
  */
-static const std::set<long long> excluded_goods = {
+static constexpr auto excluded_goods = std::to_array<long long>({
     107, // Phantom Bloody Finger
     113, // Phantom Bloody Finger
     114, // Phantom Recusant Finger
@@ -98,23 +97,28 @@ static const std::set<long long> excluded_goods = {
     1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
     // Flask of Cerulean Tears (+0 through +12, empty and full)
     1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065,
-    1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075};
+    1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075});
 
 /* Additional items that don't have the unauthorized "[ERROR]" prefix, but are unobtainable */
-static const std::set<long long> cut_content_goods = {
+static constexpr auto cut_content_goods = std::to_array<long long>({
     8860,    // Erdtree Prayerbook
     8861,    // Erdtree Codex
     2008023, // Keep Wall Key
-};
+});
 
-static const std::set<long long> cut_content_protectors = {
+static constexpr auto cut_content_protectors = std::to_array<long long>({
     610000, // Ragged Hat
     610100, // Ragged Armor
     610200, // Ragged Gloves
     610300, // Ragged Loincloth
     611000, // Ragged Hat (Altered)
     611100, // Ragged Armor (Altered)
-};
+});
+
+// The ID lists above are searched with binary_search, so they must be kept in order
+static_assert(std::ranges::is_sorted(excluded_goods));
+static_assert(std::ranges::is_sorted(cut_content_goods));
+static_assert(std::ranges::is_sorted(cut_content_protectors));
 
 static constexpr unsigned int kale_alive_flag_id = 4700;
 static constexpr unsigned int kale_hostile_flag_id = 4701;
@@ -126,6 +130,10 @@ struct shop
 {
     long long id;
     std::vector<from::paramdef::SHOP_LINEUP_PARAM> lineups;
+
+    // For weapon shops with auto_upgrade_weapons on, a copy of the lineups for every max reinforce
+    // level the player can have, with each weapon upgraded to the level it's sold at
+    std::vector<std::vector<from::paramdef::SHOP_LINEUP_PARAM>> upgraded_lineups;
 };
 
 static std::array<shop, 22> mod_shops = {
@@ -154,14 +162,40 @@ static std::array<shop, 22> mod_shops = {
 };
 
 // Map of ReinforceParamWeapon IDs to the maximum possible level of weapons using that upgrade path
-static std::map<short, unsigned char> max_level_by_reinforce_type_id;
+static modutils::flat_map<short, unsigned char> max_level_by_reinforce_type_id;
 
 // Goods that shouldn't be allowed in the storage box, because acquiring a second copy can break
-// things
-static std::set<unsigned int> no_repository_item_ids;
+// things. Kept sorted for binary_search.
+static std::vector<unsigned int> no_repository_item_ids;
+
+// Built-in and .ini rules for sorting goods into shops, compiled when the shops are set up
+static ermerchant::goods_shop_rules compiled_goods_shop_rules;
+
+// Lineups of every mod shop, layered over ShopLineupParam so the shop hooks can serve them without
+// writing to the game's params
+static from::params::ParamOverlay<from::paramdef::SHOP_LINEUP_PARAM> shop_lineup_overlay;
+
+// Guards shop_lineup_overlay, the weapon shops' upgraded_lineups, retired_upgraded_lineups,
+// no_repository_item_ids and max_level_by_reinforce_type_id, which are replaced from other threads
+// as shops are built
+static std::shared_mutex shop_lineup_mutex;
+
+// Upgraded weapon lineups replaced by a rebuild, kept alive until the next mod shop is opened
+static std::vector<std::vector<std::vector<from::paramdef::SHOP_LINEUP_PARAM>>>
+    retired_upgraded_lineups;
+
+// Fingerprints of the params the lineups were built from
+static std::vector<std::pair<std::wstring_view, from::params::ParamFingerprint>>
+    shop_param_fingerprints;
 
 static bool is_shop_open = false;
 
+static constexpr unsigned char max_player_reinforce_level = 25;
+
+// The player's max reinforce level when a mod shop was last opened, which selects the upgraded
+// weapon lineups to sell
+static unsigned char selected_reinforce_level = 0;
+
 static shop *get_mod_shop(int shop_lineup_id)
 {
     for (auto &shop : mod_shops)
@@ -175,6 +209,41 @@ static shop *get_mod_shop(int shop_lineup_id)
     return nullptr;
 }
 
+/**
+ * Returns the lineup with the given ID upgraded to the selected reinforce level, or the given
+ * lineup if it isn't in a weapon shop with upgraded lineups. shop_lineup_mutex must be held.
+ */
+static from::paramdef::SHOP_LINEUP_PARAM *get_upgraded_lineup(long long id,
+                                                            from::paramdef::SHOP_LINEUP_PARAM *row)
+{
+    for (auto shop_id : {ermerchant::shops::weapons, ermerchant::shops::dlc_weapons})
+    {
+        if (id >= shop_id && id < shop_id + ermerchant::shop_capacity)
+        {
+            auto &upgraded_lineups = get_mod_shop(shop_id)->upgraded_lineups;
+            if (selected_reinforce_level < upgraded_lineups.size() &&
+                id - shop_id < (long long)upgraded_lineups[selected_reinforce_level].size())
+            {
+                return &upgraded_lineups[selected_reinforce_level][id - shop_id];
+            }
+        }
+    }
+
+    return row;
+}
+
+/**
+ * Builds the mod shop with the given ID and the other shops in its category, if they haven't been
+ * built yet
+ */
+static void build_shop(long long shop_id);
+
+/**
+ * Like build_shop(), but also rebuilds the shop's category if the params it was built from have
+ * been reloaded or edited (e.g. by another mod) since, and picks up changes to ShopLineupParam
+ */
+static void refresh_shop(long long shop_id);
+
 static from::find_shop_menu_result *(*solo_param_repository_lookup_shop_menu)(
     from::find_shop_menu_result *result, unsigned char shop_type, int begin_id, int end_id);
 
@@ -186,13 +255,19 @@ static from::find_shop_menu_result *(*solo_param_repository_lookup_shop_menu)(
 static from::find_shop_menu_result *solo_param_repository_lookup_shop_menu_detour(
     from::find_shop_menu_result *result, unsigned char shop_type, int begin_id, int end_id)
 {
-    for (auto &shop : mod_shops)
+    if (get_mod_shop(begin_id))
+    {
+        build_shop(begin_id);
+    }
+
+    // Each mod shop's menu is its first lineup
     {
-        if (begin_id == shop.id)
+        std::shared_lock lock(shop_lineup_mutex);
+        if (auto shop_menu = shop_lineup_overlay.find(begin_id))
         {
             result->shop_type = shop_type;
             result->id = begin_id;
-            result->row = &shop.lineups[0];
+            result->row = get_upgraded_lineup(begin_id, shop_menu);
             return result;
         }
     }
@@ -212,50 +287,55 @@ static void (*solo_param_repository_lookup_shop_lineup)(from::find_shop_menu_res
 static void solo_param_repository_lookup_shop_lineup_detour(from::find_shop_menu_result *result,
                                                             unsigned char shop_type, int id)
 {
-    auto shop = get_mod_shop(id);
-    if (shop && id < shop->id + shop->lineups.size())
     {
-        result->shop_type = shop_type;
-        result->id = id;
-        result->row = &shop->lineups[id - shop->id];
-        return;
+        std::shared_lock lock(shop_lineup_mutex);
+        if (auto lineup = shop_lineup_overlay.find(id))
+        {
+            result->shop_type = shop_type;
+            result->id = id;
+            result->row = get_upgraded_lineup(id, lineup);
+            return;
+        }
     }
 
     solo_param_repository_lookup_shop_lineup(result, shop_type, id);
 }
 
+/**
+ * Frees the lineups replaced by earlier rebuilds. The game can hold on to the lineups it looked up
+ * until their shop is closed, so they're only freed once the next mod shop is opened.
+ */
+static void release_retired_lineups()
+{
+    std::unique_lock lock(shop_lineup_mutex);
+    shop_lineup_overlay.release_retired_rows();
+    retired_upgraded_lineups.clear();
+}
+
 static void (*open_regular_shop)(void *, long long, long long);
 
 /**
  * Hook for OpenRegularShop()
+ *
+ * Opening a mod shop re-hashes the params its category was built from, rebuilding the category if
+ * any of their rows changed, and then picks the pre-built weapon lineups for the player's level.
  */
 static void open_regular_shop_detour(void *unk, long long begin_id, long long end_id)
 {
     auto shop = get_mod_shop(begin_id);
-
-    // Change the upgrade level when purchasing weapons to the player's current max
-    if (ermerchant::config::auto_upgrade_weapons && shop &&
-        (shop->id == ermerchant::shops::weapons || shop->id == ermerchant::shops::dlc_weapons))
+    if (shop)
     {
-        auto max_reinforce_level = (*game_data_man_addr)->player_game_data->max_reinforce_level;
-
-        auto equip_param_weapon =
-            from::params::get_param<from::paramdef::EQUIP_PARAM_WEAPON_ST>(L"EquipParamWeapon");
-
-        for (auto &lineup : shop->lineups)
-        {
-            if (lineup.equipType == equip_type_weapon)
-            {
-                auto weapon_id = lineup.equipId - lineup.equipId % 100;
-                auto weapon = equip_param_weapon[weapon_id];
-
-                auto reinforce_level =
-                    (int)std::floor((max_reinforce_level + 0.5) *
-                                    max_level_by_reinforce_type_id[weapon.reinforceTypeId] / 25);
+        release_retired_lineups();
+        refresh_shop(shop->id);
+    }
 
-                lineup.equipId = weapon_id + reinforce_level;
-            }
-        }
+    // Sell weapons upgraded to the player's current max, using the lineups built for that level
+    if (shop)
+    {
+        std::unique_lock lock(shop_lineup_mutex);
+        selected_reinforce_level =
+            std::min((*game_data_man_addr)->player_game_data->max_reinforce_level,
+                     max_player_reinforce_level);
     }
 
     open_regular_shop(unk, begin_id, end_id);
@@ -299,9 +379,13 @@ static unsigned long long (*get_max_repository_num)(unsigned int *);
  */
 static unsigned long long get_max_repository_num_detour(unsigned int *item_id)
 {
-    if (is_shop_open && no_repository_item_ids.contains(*item_id))
+    if (is_shop_open)
     {
-        return 0;
+        std::shared_lock lock(shop_lineup_mutex);
+        if (std::ranges::binary_search(no_repository_item_ids, *item_id))
+        {
+            return 0;
+        }
     }
 
     return get_max_repository_num(item_id);
@@ -329,91 +413,151 @@ static unsigned int get_event_flag_detour(void *self, unsigned int flag_id)
     }
 }
 
-void ermerchant::setup_shops()
+template <typename T>
+static void record_fingerprint(const from::params::ParamTableSequence<T> &param)
 {
-    auto &weapon_lineups = mod_shops[0].lineups;
-    auto &armor_lineups = mod_shops[1].lineups;
-    auto &spell_lineups = mod_shops[2].lineups;
-    auto &talisman_lineups = mod_shops[3].lineups;
-    auto &ammunition_lineups = mod_shops[4].lineups;
-    auto &ash_of_war_lineups = mod_shops[5].lineups;
-    auto &spirit_summon_lineups = mod_shops[6].lineups;
-    auto &consumable_lineups = mod_shops[7].lineups;
-    auto &material_lineups = mod_shops[8].lineups;
-    auto &miscellaneous_item_lineups = mod_shops[9].lineups;
-    auto &cut_good_lineups = mod_shops[10].lineups;
-    auto &cut_armor_lineups = mod_shops[11].lineups;
-    auto &dlc_weapon_lineups = mod_shops[12].lineups;
-    auto &dlc_armor_lineups = mod_shops[13].lineups;
-    auto &dlc_spell_lineups = mod_shops[14].lineups;
-    auto &dlc_talisman_lineups = mod_shops[15].lineups;
-    auto &dlc_ammunition_lineups = mod_shops[16].lineups;
-    auto &dlc_ashes_of_war_lineups = mod_shops[17].lineups;
-    auto &dlc_spirit_summon_lineups = mod_shops[18].lineups;
-    auto &dlc_consumable_lineups = mod_shops[19].lineups;
-    auto &dlc_material_lineups = mod_shops[20].lineups;
-    auto &dlc_miscellaneous_item_lineups = mod_shops[21].lineups;
+    auto fingerprint = param.fingerprint();
+    spdlog::info("Building shops from {}: {} rows, IDs {:016x}, data {:016x}",
+                 modutils::utf8{param.name()}, fingerprint.num_rows, fingerprint.ids_hash,
+                 fingerprint.data_hash);
+    shop_param_fingerprints.emplace_back(param.name(), fingerprint);
+}
 
-    // Look up event flags set when acquiring items like maps and cookbooks. Simply possessing
-    // these items doesn't actually unlock anything, an event flag must also be set.
-    std::map<int, unsigned int> goods_flags;
-    std::map<int, unsigned int> gems_flags;
+enum class item_name : unsigned char
+{
+    missing,
+    // Exactly "[ERROR]", used for placeholder entries
+    cut_content_placeholder,
+    // A real name after an "[ERROR]" prefix, used for cut items
+    cut_content,
+    normal,
+};
 
-    // Look up goods IDs that are only used for replacement text in shops. These aren't actual
-    // obtainable items.
-    std::set<long long> dummy_goods_ids;
+struct item_name_status
+{
+    item_name name;
+    bool is_dlc;
+};
 
-    for (auto param : {L"ItemLotParam_map", L"ItemLotParam_enemy"})
+/**
+ * Classifies the names of the given items, checking the base game's messages and then the DLC's.
+ * The IDs are looked up in ID order with one get_messages() call per message table, so each table
+ * is read in a single pass. Items that should_classify(i) rejects aren't looked up and are left as
+ * missing.
+ */
+template <typename Predicate>
+static std::vector<item_name_status> classify_item_names(from::msgbnd name_bnd,
+                                                         from::msgbnd dlc_name_bnd,
+                                                         std::span<const uint64_t> ids,
+                                                         Predicate should_classify)
+{
+    std::vector<item_name_status> result(ids.size(), {item_name::missing, false});
+
+    std::vector<size_t> indexes;
+    for (size_t i = 0; i < ids.size(); i++)
     {
-        for (auto [id, row] : from::params::get_param<from::paramdef::ITEMLOT_PARAM_ST>(param))
+        if (should_classify(i))
         {
-            // Record flags set when looting goods
-            if (row.lotItemCategory01 == lot_item_category_goods && row.getItemFlagId > 0)
-            {
-                goods_flags[row.lotItemId01] = row.getItemFlagId;
-            }
+            indexes.push_back(i);
         }
     }
-    for (auto [id, row] :
-         from::params::get_param<from::paramdef::SHOP_LINEUP_PARAM>(L"ShopLineupParam"))
+
+    // Params are almost always stored in ID order already
+    auto id_of = [&](size_t i) { return ids[i]; };
+    if (!std::ranges::is_sorted(indexes, {}, id_of))
     {
-        // Record flags set when purchasing goods
-        if (row.equipType == equip_type_goods)
+        std::ranges::sort(indexes, {}, id_of);
+    }
+
+    std::vector<int> msg_ids(indexes.size());
+    std::ranges::transform(indexes, msg_ids.begin(),
+                           [&](size_t i) { return static_cast<int>(ids[i]); });
+
+    std::vector<std::wstring_view> names(indexes.size());
+    ermerchant::get_messages(name_bnd, msg_ids, names);
+
+    // Items without a name in the base game are looked up in the DLC's messages
+    std::vector<size_t> dlc_positions;
+    std::vector<int> dlc_msg_ids;
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        if (names[i].empty())
         {
-            goods_flags[row.equipId] = row.eventFlag_forStock;
+            dlc_positions.push_back(i);
+            dlc_msg_ids.push_back(msg_ids[i]);
         }
-        // Record flags required for Hewg to duplicate AoWs
-        else if (row.equipType == equip_type_gem && row.costType == cost_type_lost_ashes_of_war)
+    }
+
+    std::vector<std::wstring_view> dlc_names(dlc_msg_ids.size());
+    ermerchant::get_messages(dlc_name_bnd, dlc_msg_ids, dlc_names);
+    for (size_t i = 0; i < dlc_positions.size(); i++)
+    {
+        names[dlc_positions[i]] = dlc_names[i];
+        result[indexes[dlc_positions[i]]].is_dlc = true;
+    }
+
+    for (size_t i = 0; i < indexes.size(); i++)
+    {
+        auto &status = result[indexes[i]];
+        auto name = names[i];
+        if (name.empty())
         {
-            gems_flags[row.equipId] = row.eventFlag_forRelease;
+            status.name = item_name::missing;
         }
-        // Record goods IDs that are used for replacement text in shops
-        if (row.nameMsgId != -1)
+        else if (name == cut_content_prefix)
         {
-            dummy_goods_ids.insert(row.nameMsgId);
+            status.name = item_name::cut_content_placeholder;
         }
-    }
-
-    for (auto [id, row] :
-         from::params::get_param<from::paramdef::EQUIP_PARAM_GOODS_ST>(L"EquipParamGoods"))
-    {
-        if (row.appearanceReplaceItemId != -1)
+        else if (name.starts_with(cut_content_prefix))
         {
-            dummy_goods_ids.insert(row.appearanceReplaceItemId);
+            status.name = item_name::cut_content;
+        }
+        else
+        {
+            status.name = item_name::normal;
         }
     }
 
-    // Count of the number of times each flag prefix is used, to help identify flags that are usable
-    // as stock counters.
-    std::map<unsigned int, int> goods_flag_counts;
-    for (auto [_, flag] : goods_flags)
-        goods_flag_counts[flag - flag % 10]++;
+    return result;
+}
 
-    // Iterate through every obtainable item in the game and create shop lineups in the appropriate
-    // ranges
-    for (auto [id, row] :
-         from::params::get_param<from::paramdef::EQUIP_PARAM_WEAPON_ST>(L"EquipParamWeapon"))
+static std::vector<item_name_status> classify_item_names(from::msgbnd name_bnd,
+                                                         from::msgbnd dlc_name_bnd,
+                                                         std::span<const uint64_t> ids)
+{
+    return classify_item_names(name_bnd, dlc_name_bnd, ids, [](size_t) { return true; });
+}
+
+/**
+ * Adds weapons and ammunition to their shops
+ */
+static void build_weapon_shops()
+{
+    auto &weapon_lineups = mod_shops[0].lineups;
+    auto &ammunition_lineups = mod_shops[4].lineups;
+    auto &dlc_weapon_lineups = mod_shops[12].lineups;
+    auto &dlc_ammunition_lineups = mod_shops[16].lineups;
+
+    auto weapon_columns = from::params::project(
+        from::params::get_param<from::paramdef::EQUIP_PARAM_WEAPON_ST>(),
+        [](auto &row) { return row.wepType; });
+    auto &weapon_ids = weapon_columns.ids;
+    auto &weapon_types = weapon_columns.column<0>();
+
+    // Weapon entries for heavy, keen, etc. have a nonzero affinity in the hundreds digits
+    auto base_weapons = from::params::select_remainder_below(weapon_ids, 10000, 100);
+
+    // The unarmed fist and duplicate entries are skipped below, so their names aren't needed
+    auto weapon_names = classify_item_names(
+        from::msgbnd::weapon_name, from::msgbnd::dlc_weapon_name, weapon_ids, [&](size_t i) {
+            return weapon_ids[i] != weapon_unarmed_id && from::params::is_selected(base_weapons, i);
+        });
+
+    for (size_t i = 0; i < weapon_ids.size(); i++)
     {
+        auto id = weapon_ids[i];
+        auto weapon_type = weapon_types[i];
+
         // Exclude unarmed fist
         if (id == weapon_unarmed_id)
         {
@@ -421,31 +565,24 @@ void ermerchant::setup_shops()
         }
 
         // Exclude duplicate weapon entries for heavy, keen, etc.
-        auto affinity_id = (id % 10000) / 100;
-        if (affinity_id != 0)
+        if (!from::params::is_selected(base_weapons, i))
         {
             continue;
         }
 
-        bool is_dlc = false;
-        auto weapon_name = ermerchant::get_message(from::msgbnd::weapon_name, id);
-        if (weapon_name.empty())
-        {
-            is_dlc = true;
-            weapon_name = ermerchant::get_message(from::msgbnd::dlc_weapon_name, id);
-        }
+        bool is_dlc = weapon_names[i].is_dlc;
 
         // Exclude weapon entries without valid names - these are placeholders for data used by
         // non-weapons (e.g. perfumes) or unused/cut items.
-        if (weapon_name.empty() || weapon_name.starts_with(cut_content_prefix))
+        if (weapon_names[i].name != item_name::normal)
         {
             continue;
         }
 
         std::vector<from::paramdef::SHOP_LINEUP_PARAM> *lineups = nullptr;
 
-        if (row.wepType == weapon_type_arrow || row.wepType == weapon_type_greatarrow ||
-            row.wepType == weapon_type_bolt || row.wepType == weapon_type_ballista_bolt)
+        if (weapon_type == weapon_type_arrow || weapon_type == weapon_type_greatarrow ||
+            weapon_type == weapon_type_bolt || weapon_type == weapon_type_ballista_bolt)
         {
 
             if (is_dlc)
@@ -468,10 +605,31 @@ void ermerchant::setup_shops()
 
         lineups->push_back({.equipId = (int)id, .equipType = equip_type_weapon});
     }
+}
 
-    for (auto [id, row] :
-         from::params::get_param<from::paramdef::EQUIP_PARAM_PROTECTOR_ST>(L"EquipParamProtector"))
+/**
+ * Adds armor to its shops
+ */
+static void build_protector_shops()
+{
+    auto &armor_lineups = mod_shops[1].lineups;
+    auto &cut_armor_lineups = mod_shops[11].lineups;
+    auto &dlc_armor_lineups = mod_shops[13].lineups;
+
+    auto protector_columns = from::params::project(
+        from::params::get_param<from::paramdef::EQUIP_PARAM_PROTECTOR_ST>(),
+        [](auto &row) { return row.protectorCategory; });
+    auto &protector_ids = protector_columns.ids;
+    auto &protector_categories = protector_columns.column<0>();
+
+    auto protector_names = classify_item_names(
+        from::msgbnd::protector_name, from::msgbnd::dlc_protector_name, protector_ids);
+
+    for (size_t i = 0; i < protector_ids.size(); i++)
     {
+        auto id = protector_ids[i];
+        auto protector_category = protector_categories[i];
+
         // Exclude bare unarmored head/chest/etc.
         if (id == protector_bare_head_id || id == protector_bare_chest_id ||
             id == protector_bare_arms_id || id == protector_bare_legs_id)
@@ -480,30 +638,25 @@ void ermerchant::setup_shops()
         }
 
         // Exclude protector entries other than armor (e.g. hair)
-        if (row.protectorCategory != protector_category_head &&
-            row.protectorCategory != protector_category_chest &&
-            row.protectorCategory != protector_category_arms &&
-            row.protectorCategory != protector_category_legs)
+        if (protector_category != protector_category_head &&
+            protector_category != protector_category_chest &&
+            protector_category != protector_category_arms &&
+            protector_category != protector_category_legs)
         {
             continue;
         }
 
-        bool is_dlc = false;
-        auto protector_name = ermerchant::get_message(from::msgbnd::protector_name, id);
-        if (protector_name.empty())
-        {
-            is_dlc = true;
-            protector_name = ermerchant::get_message(from::msgbnd::dlc_protector_name, id);
-        }
-
-        if (protector_name.empty() || protector_name == cut_content_prefix)
+        auto [protector_name, is_dlc] = protector_names[i];
+        if (protector_name == item_name::missing ||
+            protector_name == item_name::cut_content_placeholder)
         {
             continue;
         }
 
         std::vector<from::paramdef::SHOP_LINEUP_PARAM> *lineups = nullptr;
 
-        if (protector_name.starts_with(cut_content_prefix) || cut_content_protectors.contains(id))
+        if (protector_name == item_name::cut_content ||
+            std::ranges::binary_search(cut_content_protectors, id))
         {
             lineups = &cut_armor_lineups;
         }
@@ -518,19 +671,27 @@ void ermerchant::setup_shops()
 
         lineups->push_back({.equipId = (int)id, .equipType = equip_type_protector});
     }
+}
 
-    for (auto [id, row] :
-         from::params::get_param<from::paramdef::EQUIP_PARAM_ACCESSORY_ST>(L"EquipParamAccessory"))
-    {
-        bool is_dlc = false;
-        auto accessory_name = ermerchant::get_message(from::msgbnd::accessory_name, id);
-        if (accessory_name.empty())
-        {
-            is_dlc = true;
-            accessory_name = ermerchant::get_message(from::msgbnd::dlc_accessory_name, id);
-        }
+/**
+ * Adds talismans to their shops
+ */
+static void build_accessory_shops()
+{
+    auto &talisman_lineups = mod_shops[3].lineups;
+    auto &dlc_talisman_lineups = mod_shops[15].lineups;
+
+    auto accessory_ids =
+        from::params::project(from::params::get_param<from::paramdef::EQUIP_PARAM_ACCESSORY_ST>())
+            .ids;
+    auto accessory_names = classify_item_names(
+        from::msgbnd::accessory_name, from::msgbnd::dlc_accessory_name, accessory_ids);
 
-        if (accessory_name.empty() || accessory_name.starts_with(cut_content_prefix))
+    for (size_t i = 0; i < accessory_ids.size(); i++)
+    {
+        auto id = accessory_ids[i];
+        auto [accessory_name, is_dlc] = accessory_names[i];
+        if (accessory_name != item_name::normal)
         {
             continue;
         }
@@ -548,52 +709,117 @@ void ermerchant::setup_shops()
 
         lineups->push_back({.equipId = (int)id, .equipType = equip_type_accessory});
     }
+}
 
-    for (auto [id, row] :
-         from::params::get_param<from::paramdef::EQUIP_PARAM_GOODS_ST>(L"EquipParamGoods"))
+/**
+ * Adds goods (spells, consumables, etc.) to their shops, and records goods that shouldn't be
+ * allowed in the storage box
+ */
+static void build_goods_shops(const modutils::flat_map<int, unsigned int> &goods_flags,
+                              const std::vector<long long> &dummy_goods_ids,
+                              std::vector<unsigned int> &no_repository_goods_ids)
+{
+    auto &spell_lineups = mod_shops[2].lineups;
+    auto &spirit_summon_lineups = mod_shops[6].lineups;
+    auto &consumable_lineups = mod_shops[7].lineups;
+    auto &material_lineups = mod_shops[8].lineups;
+    auto &miscellaneous_item_lineups = mod_shops[9].lineups;
+    auto &cut_good_lineups = mod_shops[10].lineups;
+    auto &dlc_spell_lineups = mod_shops[14].lineups;
+    auto &dlc_spirit_summon_lineups = mod_shops[18].lineups;
+    auto &dlc_consumable_lineups = mod_shops[19].lineups;
+    auto &dlc_material_lineups = mod_shops[20].lineups;
+    auto &dlc_miscellaneous_item_lineups = mod_shops[21].lineups;
+
+    // Count of the number of times each flag prefix is used, to help identify flags that are usable
+    // as stock counters.
+    std::vector<unsigned int> goods_flag_prefixes;
+    goods_flag_prefixes.reserve(goods_flags.size());
+    for (auto [_, flag] : goods_flags)
+        goods_flag_prefixes.push_back(flag - flag % 10);
+    std::ranges::sort(goods_flag_prefixes);
+
+    auto goods_columns = from::params::project(
+        from::params::get_param<from::paramdef::EQUIP_PARAM_GOODS_ST>(),
+        [](auto &row) { return row.goodsType; }, [](auto &row) { return row.sortGroupId; },
+        [](auto &row) { return row.iconId; }, [](auto &row) { return row.isConsume; },
+        [](auto &row) { return row.disable_offline; }, [](auto &row) { return row.maxNum; },
+        [](auto &row) { return row.maxRepositoryNum; });
+    auto &goods_ids = goods_columns.ids;
+    auto &goods_types = goods_columns.column<0>();
+    auto &goods_sort_group_ids = goods_columns.column<1>();
+    auto &goods_icon_ids = goods_columns.column<2>();
+    auto &goods_is_consume = goods_columns.column<3>();
+    auto &goods_disable_offline = goods_columns.column<4>();
+    auto &goods_max_nums = goods_columns.column<5>();
+    auto &goods_max_repository_nums = goods_columns.column<6>();
+
+    // Base game and DLC lineups for each goods_shop
+    std::vector<from::paramdef::SHOP_LINEUP_PARAM> *goods_shop_lineups[][2] = {
+        {nullptr, nullptr},
+        {nullptr, nullptr},
+        {&spell_lineups, &dlc_spell_lineups},
+        {&spirit_summon_lineups, &dlc_spirit_summon_lineups},
+        {&consumable_lineups, &dlc_consumable_lineups},
+        {&material_lineups, &dlc_material_lineups},
+        {&miscellaneous_item_lineups, &dlc_miscellaneous_item_lineups},
+        {&cut_good_lineups, &cut_good_lineups},
+    };
+
+    // Look up every item's shop in the compiled rules up front
+    std::vector<ermerchant::goods_shop> goods_shops(goods_ids.size());
+    for (size_t i = 0; i < goods_ids.size(); i++)
     {
-        // Exclude goods which are obtained automatically in some way
-        if (excluded_goods.contains(id))
-        {
-            continue;
-        }
+        goods_shops[i] =
+            compiled_goods_shop_rules.find(goods_types[i], goods_sort_group_ids[i],
+                                           goods_is_consume[i] && !goods_disable_offline[i]);
+    }
+
+    // Upgraded spirit ashes have a nonzero upgrade level in the last two digits
+    auto base_goods = from::params::select_remainder_below(goods_ids, 100, 1);
+
+    // Only look up the names of goods that aren't skipped below before their name is checked
+    auto goods_names = classify_item_names(
+        from::msgbnd::goods_name, from::msgbnd::dlc_goods_name, goods_ids, [&](size_t i) {
+            return !std::ranges::binary_search(excluded_goods, goods_ids[i]) &&
+                   goods_shops[i] != ermerchant::goods_shop::excluded &&
+                   !std::ranges::binary_search(dummy_goods_ids, goods_ids[i]);
+        });
+
+    for (size_t i = 0; i < goods_ids.size(); i++)
+    {
+        auto id = goods_ids[i];
+        auto goods_shop = goods_shops[i];
 
-        // Exclude gestures, which are technically goods but are unlocked in a different way
-        if (row.goodsType == goods_type_normal_item && row.sortGroupId == goods_sort_group_gesture)
+        // Exclude goods which are obtained automatically in some way
+        if (std::ranges::binary_search(excluded_goods, id))
         {
             continue;
         }
 
-        // Exclude tutorials, which are also goods but aren't useful to buy
-        if (row.goodsType == goods_type_info_item && row.sortGroupId == goods_sort_group_tutorial)
+        // Exclude goods the rules say are never sold, like gestures and tutorials
+        if (goods_shop == ermerchant::goods_shop::excluded)
         {
             continue;
         }
 
         // Exclude goods entries that are just used to replace the icon of another entry or a shop
         // name or description
-        if (dummy_goods_ids.contains(id))
+        if (std::ranges::binary_search(dummy_goods_ids, id))
         {
             continue;
         }
 
-        bool is_dlc = false;
-        auto goods_name = ermerchant::get_message(from::msgbnd::goods_name, id);
-        if (goods_name.empty())
-        {
-            is_dlc = true;
-            goods_name = ermerchant::get_message(from::msgbnd::dlc_goods_name, id);
-        }
-
-        if (goods_name.empty() || goods_name == cut_content_prefix)
+        auto [goods_name, is_dlc] = goods_names[i];
+        if (goods_name == item_name::missing || goods_name == item_name::cut_content_placeholder)
         {
             continue;
         }
 
         std::vector<from::paramdef::SHOP_LINEUP_PARAM> *lineups = nullptr;
 
-        if (goods_name.starts_with(cut_content_prefix) || !row.iconId ||
-            cut_content_goods.contains(id))
+        if (goods_name == item_name::cut_content || !goods_icon_ids[i] ||
+            std::ranges::binary_search(cut_content_goods, id))
         {
             // Put cut items in a separate shop
             lineups = &cut_good_lineups;
@@ -603,80 +829,32 @@ void ermerchant::setup_shops()
             // These are classified as materials, but should really appear in the consumables shop
             lineups = is_dlc ? &dlc_consumable_lineups : &consumable_lineups;
         }
-        else
+        else if (goods_shop != ermerchant::goods_shop::spirit_summons ||
+                 from::params::is_selected(base_goods, i))
         {
-            switch (row.goodsType)
-            {
-            case goods_type_normal_item:
-                if (row.isConsume && !row.disable_offline)
-                {
-                    lineups = is_dlc ? &dlc_consumable_lineups : &consumable_lineups;
-                }
-                else
-                {
-                    lineups =
-                        is_dlc ? &dlc_miscellaneous_item_lineups : &miscellaneous_item_lineups;
-                }
-                break;
-
-            case goods_type_sorcery:
-            case goods_type_incantation:
-            case goods_type_self_buff_sorcery:
-            case goods_type_self_buff_incantation:
-                lineups = is_dlc ? &dlc_spell_lineups : &spell_lineups;
-                break;
-
-            case goods_type_spirit_summon_lesser:
-            case goods_type_spirit_summon_greater: {
-                // Exclude duplicate entries for upgraded spirit ashes
-                auto upgrade_level = id % 100;
-                if (upgrade_level == 0)
-                {
-                    lineups = is_dlc ? &dlc_spirit_summon_lineups : &spirit_summon_lineups;
-                }
-                break;
-            }
-
-            case goods_type_remembrance:
-            case goods_type_regenerative_material:
-            case goods_type_convergence_rune:
-            case goods_type_convergence_remembrance:
-                lineups = is_dlc ? &dlc_consumable_lineups : &consumable_lineups;
-                break;
-
-            case goods_type_crafting_material:
-            case goods_type_reinforcement_material:
-                lineups = is_dlc ? &dlc_material_lineups : &material_lineups;
-                break;
-
-            case goods_type_key_item:
-            case goods_type_info_item:
-            case goods_type_wondrous_physick:
-            case goods_type_wondrous_physick_tear:
-            case goods_type_great_rune:
-                lineups = is_dlc ? &dlc_miscellaneous_item_lineups : &miscellaneous_item_lineups;
-                break;
-            }
+            // Exclude duplicate entries for upgraded spirit ashes
+            lineups = goods_shop_lineups[static_cast<size_t>(goods_shop)][is_dlc];
         }
 
         if (lineups)
         {
-            auto event_flag = goods_flags[id];
+            auto event_flag = goods_flags.value_or(id, 0);
             short sell_quantity = -1;
 
             // Check for maps, crafting kit, key items, etc. that shouldn't be allowed to have
             // duplicates. Buying extra copies of key items can unset event flags and break things
             // like unlocked map progress.
-            if (event_flag && row.maxNum == 1 && row.maxRepositoryNum == 1)
+            if (event_flag && goods_max_nums[i] == 1 && goods_max_repository_nums[i] == 1)
             {
                 // Don't allow these items to be stored in the item box, since this is basically
                 // a loophole for buying a second copy
-                no_repository_item_ids.insert(0x40000000 | id);
+                no_repository_goods_ids.push_back(0x40000000 | id);
 
                 // Additionally, limit the sold quantity of items if they have an event flag that
                 // can store stock counts. This is mainly for the flask of wondrous physic, which
                 // otherwise would be duplicatable by drinking it before opening the shop.
-                if (event_flag % 10 == 0 && goods_flag_counts[event_flag - event_flag % 10] == 1)
+                if (event_flag % 10 == 0 &&
+                    std::ranges::equal_range(goods_flag_prefixes, event_flag).size() == 1)
                 {
                     sell_quantity = 1;
                 }
@@ -690,19 +868,26 @@ void ermerchant::setup_shops()
             });
         }
     }
+}
 
-    for (auto [id, row] :
-         from::params::get_param<from::paramdef::EQUIP_PARAM_GEM_ST>(L"EquipParamGem"))
-    {
-        bool is_dlc = false;
-        auto gem_name = ermerchant::get_message(from::msgbnd::gem_name, id);
-        if (gem_name.empty())
-        {
-            is_dlc = true;
-            gem_name = ermerchant::get_message(from::msgbnd::dlc_gem_name, id);
-        }
+/**
+ * Adds ashes of war to their shops
+ */
+static void build_gem_shops(const modutils::flat_map<int, unsigned int> &gems_flags)
+{
+    auto &ash_of_war_lineups = mod_shops[5].lineups;
+    auto &dlc_ashes_of_war_lineups = mod_shops[17].lineups;
 
-        if (gem_name.empty() || gem_name.starts_with(cut_content_prefix))
+    auto gem_ids =
+        from::params::project(from::params::get_param<from::paramdef::EQUIP_PARAM_GEM_ST>()).ids;
+    auto gem_names =
+        classify_item_names(from::msgbnd::gem_name, from::msgbnd::dlc_gem_name, gem_ids);
+
+    for (size_t i = 0; i < gem_ids.size(); i++)
+    {
+        auto id = gem_ids[i];
+        auto [gem_name, is_dlc] = gem_names[i];
+        if (gem_name != item_name::normal)
         {
             continue;
         }
@@ -718,20 +903,595 @@ void ermerchant::setup_shops()
             lineups = &ash_of_war_lineups;
         }
 
-        auto event_flag_it = gems_flags.find(id);
         lineups->push_back({
             .equipId = (int)id,
-            .eventFlag_forStock = event_flag_it == gems_flags.end() ? 0 : event_flag_it->second,
+            .eventFlag_forStock = gems_flags.value_or(id, 0),
             .equipType = equip_type_gem,
         });
     }
+}
+
+/**
+ * State of a param table that shops were built from. The table pointer changes when the param is
+ * reloaded, and the fingerprint changes when its rows change.
+ */
+struct param_state
+{
+    std::wstring_view name;
+    const from::params::ParamTable *param_table;
+    size_t row_size;
+    from::params::ParamFingerprint fingerprint;
+};
+
+/**
+ * Returns the state of a param without its fingerprint, which is filled in by
+ * fingerprint_param_states()
+ */
+template <typename T, size_t Index = 0> static param_state get_param_state()
+{
+    auto param = from::params::get_param<T, Index>();
+    return {param.name(), param.table(), sizeof(T), {}};
+}
+
+/**
+ * Fingerprints the params in param_states. Every table is hashed, even if its pointer and row
+ * count haven't changed, since rows can be edited in place without changing either.
+ */
+static void fingerprint_param_states(std::vector<param_state> &param_states)
+{
+    for (auto &state : param_states)
+    {
+        state.fingerprint = from::params::fingerprint(state.param_table, state.row_size);
+    }
+}
+
+/**
+ * Returns true if the params have the same rows in both states, even if some were reloaded
+ */
+static bool have_same_fingerprints(const std::vector<param_state> &a,
+                                   const std::vector<param_state> &b)
+{
+    return std::ranges::equal(a, b, {}, &param_state::fingerprint, &param_state::fingerprint);
+}
+
+/**
+ * Params scanned once and shared by the goods and ash of war shops
+ */
+struct shop_inputs
+{
+    // Event flags set when acquiring items like maps and cookbooks. Simply possessing these items
+    // doesn't actually unlock anything, an event flag must also be set.
+    modutils::flat_map<int, unsigned int> goods_flags;
+
+    // Event flags required for Hewg to duplicate AoWs
+    modutils::flat_map<int, unsigned int> gems_flags;
+
+    // Goods IDs that are only used for replacement text in shops. These aren't actual obtainable
+    // items.
+    std::vector<long long> dummy_goods_ids;
+};
+
+static std::vector<param_state> get_shop_input_param_states()
+{
+    return {
+        get_param_state<from::paramdef::ITEMLOT_PARAM_ST, 0>(),
+        get_param_state<from::paramdef::ITEMLOT_PARAM_ST, 1>(),
+        get_param_state<from::paramdef::SHOP_LINEUP_PARAM>(),
+        get_param_state<from::paramdef::EQUIP_PARAM_GOODS_ST>(),
+    };
+}
+
+static shop_inputs build_shop_inputs()
+{
+    // Later entries for the same ID take precedence
+    std::vector<std::pair<int, unsigned int>> goods_flag_entries;
+    std::vector<std::pair<int, unsigned int>> gems_flag_entries;
+    std::vector<long long> dummy_goods_ids;
+
+    for (auto item_lot_param : from::params::get_params<from::paramdef::ITEMLOT_PARAM_ST>())
+    {
+        using item_lot_flags = std::vector<std::pair<int, unsigned int>>;
+        auto chunk_flags = from::params::parallel_for_each<item_lot_flags>(
+            item_lot_param, [](auto id, auto &row, item_lot_flags &flags) {
+                // Record flags set when looting goods
+                if (row.lotItemCategory01 == lot_item_category_goods && row.getItemFlagId > 0)
+                {
+                    flags.emplace_back(row.lotItemId01, row.getItemFlagId);
+                }
+            });
+
+        for (auto &flags : chunk_flags)
+        {
+            for (auto [goods_id, flag] : flags)
+            {
+                goods_flag_entries.emplace_back(goods_id, flag);
+            }
+        }
+    }
+    for (auto [id, row] : from::params::get_param<from::paramdef::SHOP_LINEUP_PARAM>())
+    {
+        // Record flags set when purchasing goods
+        if (row.equipType == equip_type_goods)
+        {
+            goods_flag_entries.emplace_back(row.equipId, row.eventFlag_forStock);
+        }
+        // Record flags required for Hewg to duplicate AoWs
+        else if (row.equipType == equip_type_gem && row.costType == cost_type_lost_ashes_of_war)
+        {
+            gems_flag_entries.emplace_back(row.equipId, row.eventFlag_forRelease);
+        }
+        // Record goods IDs that are used for replacement text in shops
+        if (row.nameMsgId != -1)
+        {
+            dummy_goods_ids.push_back(row.nameMsgId);
+        }
+    }
+
+    for (auto [id, row] : from::params::get_param<from::paramdef::EQUIP_PARAM_GOODS_ST>())
+    {
+        if (row.appearanceReplaceItemId != -1)
+        {
+            dummy_goods_ids.push_back(row.appearanceReplaceItemId);
+        }
+    }
+
+    std::ranges::sort(dummy_goods_ids);
+    dummy_goods_ids.erase(std::ranges::unique(dummy_goods_ids).begin(), dummy_goods_ids.end());
+
+    return {
+        .goods_flags = modutils::flat_map(std::move(goods_flag_entries)),
+        .gems_flags = modutils::flat_map(std::move(gems_flag_entries)),
+        .dummy_goods_ids = std::move(dummy_goods_ids),
+    };
+}
+
+static std::mutex shop_inputs_mutex;
+static std::shared_ptr<const shop_inputs> current_shop_inputs;
+static std::vector<param_state> shop_input_param_states;
+
+/**
+ * Returns the shared shop inputs, building them on first use or if their params have changed. If
+ * another thread is already building them, this waits for it to finish.
+ */
+static std::shared_ptr<const shop_inputs> get_shop_inputs()
+{
+    std::lock_guard lock(shop_inputs_mutex);
+
+    auto param_states = get_shop_input_param_states();
+    fingerprint_param_states(param_states);
+    if (current_shop_inputs == nullptr ||
+        !have_same_fingerprints(param_states, shop_input_param_states))
+    {
+        current_shop_inputs = std::make_shared<const shop_inputs>(build_shop_inputs());
+    }
+    shop_input_param_states = std::move(param_states);
+
+    return current_shop_inputs;
+}
+
+/**
+ * Returns a copy of a weapon shop's lineups for every max reinforce level the player can have, with
+ * each weapon upgraded to the level it's sold at. Opening the shop then only has to pick one,
+ * instead of looking up every weapon's upgrade path.
+ */
+static std::vector<std::vector<from::paramdef::SHOP_LINEUP_PARAM>> build_upgraded_lineups(
+    const std::vector<from::paramdef::SHOP_LINEUP_PARAM> &lineups,
+    const modutils::flat_map<short, unsigned char> &max_levels)
+{
+    if (!ermerchant::config::auto_upgrade_weapons)
+    {
+        return {};
+    }
+
+    // Resolve every weapon in the shop with one batched pass over EquipParamWeapon
+    std::vector<std::pair<uint64_t, size_t>> weapon_lineups;
+    for (size_t i = 0; i < lineups.size(); i++)
+    {
+        if (lineups[i].equipType == equip_type_weapon)
+        {
+            weapon_lineups.emplace_back(lineups[i].equipId - lineups[i].equipId % 100, i);
+        }
+    }
+    std::ranges::sort(weapon_lineups, {}, &decltype(weapon_lineups)::value_type::first);
+
+    std::vector<uint64_t> weapon_ids;
+    weapon_ids.reserve(weapon_lineups.size());
+    for (auto [weapon_id, _] : weapon_lineups)
+    {
+        weapon_ids.push_back(weapon_id);
+    }
+
+    std::vector<from::paramdef::EQUIP_PARAM_WEAPON_ST *> weapons(weapon_ids.size());
+    from::params::get_param<from::paramdef::EQUIP_PARAM_WEAPON_ST>().get_many(weapon_ids, weapons);
 
-    for (auto [id, row] : from::params::get_param<from::paramdef::REINFORCE_PARAM_WEAPON_ST>(
-             L"ReinforceParamWeapon"))
+    std::vector<std::vector<from::paramdef::SHOP_LINEUP_PARAM>> upgraded_lineups(
+        max_player_reinforce_level + 1, lineups);
+    for (size_t i = 0; i < weapon_lineups.size(); i++)
+    {
+        auto [weapon_id, lineup_index] = weapon_lineups[i];
+        if (weapons[i] == nullptr)
+        {
+            continue;
+        }
+
+        auto max_level = max_levels.value_or(weapons[i]->reinforceTypeId, 0);
+        for (int max_reinforce_level = 0; max_reinforce_level <= max_player_reinforce_level;
+             max_reinforce_level++)
+        {
+            auto reinforce_level = (int)std::floor((max_reinforce_level + 0.5) * max_level /
+                                                   max_player_reinforce_level);
+            upgraded_lineups[max_reinforce_level][lineup_index].equipId =
+                (int)weapon_id + reinforce_level;
+        }
+    }
+
+    return upgraded_lineups;
+}
+
+/**
+ * Builds the weapon shops, and their lineups upgraded for each max reinforce level
+ */
+static void build_weapon_category()
+{
+    build_weapon_shops();
+
+    std::vector<std::pair<short, unsigned char>> max_level_entries;
+    for (auto [id, row] : from::params::get_param<from::paramdef::REINFORCE_PARAM_WEAPON_ST>())
     {
         auto level = id % 50;
-        max_level_by_reinforce_type_id[id - level] = level;
+        max_level_entries.emplace_back(id - level, level);
     }
+    modutils::flat_map max_levels(std::move(max_level_entries));
+
+    auto upgraded_weapon_lineups = build_upgraded_lineups(mod_shops[0].lineups, max_levels);
+    auto upgraded_dlc_weapon_lineups = build_upgraded_lineups(mod_shops[12].lineups, max_levels);
+
+    std::unique_lock lock(shop_lineup_mutex);
+    max_level_by_reinforce_type_id = std::move(max_levels);
+    for (auto shop_index : {0, 12})
+    {
+        if (!mod_shops[shop_index].upgraded_lineups.empty())
+        {
+            retired_upgraded_lineups.push_back(std::move(mod_shops[shop_index].upgraded_lineups));
+        }
+    }
+    mod_shops[0].upgraded_lineups = std::move(upgraded_weapon_lineups);
+    mod_shops[12].upgraded_lineups = std::move(upgraded_dlc_weapon_lineups);
+}
+
+/**
+ * Builds the goods shops, and records the goods that shouldn't be allowed in the storage box
+ */
+static void build_goods_category()
+{
+    auto inputs = get_shop_inputs();
+
+    std::vector<unsigned int> item_ids;
+    build_goods_shops(inputs->goods_flags, inputs->dummy_goods_ids, item_ids);
+    std::ranges::sort(item_ids);
+
+    std::unique_lock lock(shop_lineup_mutex);
+    no_repository_item_ids = std::move(item_ids);
+}
+
+static void build_gem_category()
+{
+    build_gem_shops(get_shop_inputs()->gems_flags);
+}
+
+/**
+ * A group of shops built together from one pass over an item param
+ */
+struct shop_category
+{
+    const char *name;
+    std::vector<long long> shop_ids;
+    void (*build)();
+
+    // Returns the current state of the params the shops are built from
+    std::vector<param_state> (*get_param_states)();
+
+    std::mutex mutex;
+    bool is_built = false;
+    std::vector<param_state> param_states;
+};
+
+// Shops are built by category the first time one of them is opened, and the rest are built in
+// the background in this order, roughly how likely players are to open them first
+static shop_category shop_categories[] = {
+    {
+        "weapon",
+        {ermerchant::shops::weapons, ermerchant::shops::ammunition, ermerchant::shops::dlc_weapons,
+         ermerchant::shops::dlc_ammunition},
+        build_weapon_category,
+        []() {
+            return std::vector{
+                get_param_state<from::paramdef::EQUIP_PARAM_WEAPON_ST>(),
+                get_param_state<from::paramdef::REINFORCE_PARAM_WEAPON_ST>(),
+            };
+        },
+    },
+    {
+        "armor",
+        {ermerchant::shops::armor, ermerchant::shops::cut_armor, ermerchant::shops::dlc_armor},
+        build_protector_shops,
+        []() { return std::vector{get_param_state<from::paramdef::EQUIP_PARAM_PROTECTOR_ST>()}; },
+    },
+    {
+        "goods",
+        {ermerchant::shops::spells, ermerchant::shops::spirit_summons,
+         ermerchant::shops::consumables, ermerchant::shops::materials,
+         ermerchant::shops::miscellaneous_items, ermerchant::shops::cut_goods,
+         ermerchant::shops::dlc_spells, ermerchant::shops::dlc_spirit_summons,
+         ermerchant::shops::dlc_consumables, ermerchant::shops::dlc_materials,
+         ermerchant::shops::dlc_miscellaneous_items},
+        build_goods_category,
+        // EquipParamGoods is one of the shop inputs' params
+        get_shop_input_param_states,
+    },
+    {
+        "talisman",
+        {ermerchant::shops::talismans, ermerchant::shops::dlc_talismans},
+        build_accessory_shops,
+        []() { return std::vector{get_param_state<from::paramdef::EQUIP_PARAM_ACCESSORY_ST>()}; },
+    },
+    {
+        "ash of war",
+        {ermerchant::shops::ashes_of_war, ermerchant::shops::dlc_ashes_of_war},
+        build_gem_category,
+        []() {
+            auto param_states = get_shop_input_param_states();
+            param_states.push_back(get_param_state<from::paramdef::EQUIP_PARAM_GEM_ST>());
+            return param_states;
+        },
+    },
+};
+
+/**
+ * Replaces the lineups of a category's shops in the shop lineup overlay. Rows of other shops are
+ * left as they are.
+ */
+static void set_shop_category_lineups(const shop_category &category)
+{
+    std::unique_lock lock(shop_lineup_mutex);
+    for (auto shop_id : category.shop_ids)
+    {
+        auto &shop = *get_mod_shop(shop_id);
+        shop_lineup_overlay.erase_rows(shop.id, shop.id + ermerchant::shop_capacity);
+        for (size_t i = 0; i < shop.lineups.size(); i++)
+        {
+            shop_lineup_overlay.set_row(shop.id + i, shop.lineups[i]);
+        }
+    }
+    shop_lineup_overlay.commit();
+}
+
+/**
+ * Builds the shops in a category if they haven't been built yet, or if rebuild_if_changed is set
+ * and the params they were built from have changed since. Returns false if building them failed.
+ * If another thread is already building them, this waits for it to finish.
+ *
+ * This is called from the game's shop hooks, so nothing is allowed to escape. If a build fails,
+ * the overlay keeps whatever rows the category had before, and the hooks fall back to the vanilla
+ * lookups for any shop that has none.
+ */
+static bool build_shop_category(shop_category &category, bool rebuild_if_changed = false)
+{
+    try
+    {
+        std::lock_guard lock(category.mutex);
+        if (category.is_built && !rebuild_if_changed)
+        {
+            return true;
+        }
+
+        auto param_states = category.get_param_states();
+        fingerprint_param_states(param_states);
+        if (category.is_built)
+        {
+            if (have_same_fingerprints(param_states, category.param_states))
+            {
+                // Reloaded tables with the same rows only need their new pointers recorded
+                category.param_states = std::move(param_states);
+                return true;
+            }
+
+            spdlog::info("Params used by the {} shops have changed, rebuilding them",
+                         category.name);
+        }
+
+        auto start_time = std::chrono::steady_clock::now();
+
+        for (auto shop_id : category.shop_ids)
+        {
+            get_mod_shop(shop_id)->lineups.clear();
+        }
+        category.build();
+        set_shop_category_lineups(category);
+
+        category.param_states = std::move(param_states);
+        category.is_built = true;
+
+        std::chrono::duration<double, std::milli> duration =
+            std::chrono::steady_clock::now() - start_time;
+        spdlog::info("Built {} shops in {:.1f} ms", category.name, duration.count());
+        return true;
+    }
+    catch (std::exception const &e)
+    {
+        spdlog::error("Failed to build {} shops: {}", category.name, e.what());
+        return false;
+    }
+    catch (...)
+    {
+        spdlog::error("Failed to build {} shops", category.name);
+        return false;
+    }
+}
+
+static shop_category *get_shop_category(long long shop_id)
+{
+    for (auto &category : shop_categories)
+    {
+        if (std::ranges::find(category.shop_ids, shop_id) != category.shop_ids.end())
+        {
+            return &category;
+        }
+    }
+
+    return nullptr;
+}
+
+static void build_shop(long long shop_id)
+{
+    if (auto category = get_shop_category(shop_id))
+    {
+        build_shop_category(*category);
+    }
+}
+
+static void refresh_shop(long long shop_id)
+{
+    if (auto category = get_shop_category(shop_id))
+    {
+        build_shop_category(*category, true);
+    }
+}
+
+// Where the shops are cached, and the fingerprints of the params at startup that a cached copy
+// must match. If the cache is out of date, it's saved again once every shop has been built.
+static std::filesystem::path shop_cache_path;
+static std::vector<from::params::ParamFingerprint> shop_cache_fingerprints;
+static bool is_shop_cache_valid = false;
+
+static ermerchant::shop_cache_key get_shop_cache_key(
+    std::vector<from::params::ParamFingerprint> param_fingerprints)
+{
+    return {
+        .mod_version = mod_version,
+        .language = ermerchant::get_language(),
+        .param_fingerprints = std::move(param_fingerprints),
+        .goods_shop_rules_hash = compiled_goods_shop_rules.hash(),
+    };
+}
+
+/**
+ * Returns the fingerprints of the params the shops were actually built from, in the same order as
+ * shop_param_fingerprints, so saved shops are keyed by their own inputs even if a param changed
+ * after startup. Returns nullopt if two categories were built from different versions of a param
+ * they share. Every category's mutex must be held.
+ */
+static std::optional<std::vector<from::params::ParamFingerprint>> get_built_param_fingerprints()
+{
+    std::vector<std::pair<std::wstring_view, from::params::ParamFingerprint>> built_fingerprints;
+    for (auto &category : shop_categories)
+    {
+        for (auto &state : category.param_states)
+        {
+            auto built = std::ranges::find(built_fingerprints, state.name,
+                                           &decltype(built_fingerprints)::value_type::first);
+            if (built == built_fingerprints.end())
+            {
+                built_fingerprints.emplace_back(state.name, state.fingerprint);
+            }
+            else if (built->second != state.fingerprint)
+            {
+                return std::nullopt;
+            }
+        }
+    }
+
+    std::vector<from::params::ParamFingerprint> param_fingerprints;
+    for (auto &[name, fingerprint] : shop_param_fingerprints)
+    {
+        auto built = std::ranges::find(built_fingerprints, name,
+                                       &decltype(built_fingerprints)::value_type::first);
+        if (built == built_fingerprints.end())
+        {
+            return std::nullopt;
+        }
+        param_fingerprints.push_back(built->second);
+    }
+
+    return param_fingerprints;
+}
+
+/**
+ * Fills in the fingerprints of the params in param_states from shop_param_fingerprints, which
+ * setup_shops() just recorded from the same tables, instead of hashing them again. Any param that
+ * wasn't recorded is hashed.
+ */
+static void use_recorded_fingerprints(std::vector<param_state> &param_states)
+{
+    for (auto &state : param_states)
+    {
+        auto recorded = std::ranges::find(shop_param_fingerprints, state.name,
+                                          &decltype(shop_param_fingerprints)::value_type::first);
+        state.fingerprint = recorded != shop_param_fingerprints.end()
+                                ? recorded->second
+                                : from::params::fingerprint(state.param_table, state.row_size);
+    }
+}
+
+void ermerchant::setup_shops(const std::filesystem::path &cache_path)
+{
+    // Log exactly which regulation the lineups are built from
+    shop_param_fingerprints.clear();
+    for (auto item_lot_param : from::params::get_params<from::paramdef::ITEMLOT_PARAM_ST>())
+    {
+        record_fingerprint(item_lot_param);
+    }
+    record_fingerprint(from::params::get_param<from::paramdef::SHOP_LINEUP_PARAM>());
+    record_fingerprint(from::params::get_param<from::paramdef::EQUIP_PARAM_GOODS_ST>());
+    record_fingerprint(from::params::get_param<from::paramdef::EQUIP_PARAM_WEAPON_ST>());
+    record_fingerprint(from::params::get_param<from::paramdef::EQUIP_PARAM_PROTECTOR_ST>());
+    record_fingerprint(from::params::get_param<from::paramdef::EQUIP_PARAM_ACCESSORY_ST>());
+    record_fingerprint(from::params::get_param<from::paramdef::EQUIP_PARAM_GEM_ST>());
+    record_fingerprint(from::params::get_param<from::paramdef::REINFORCE_PARAM_WEAPON_ST>());
+
+    compiled_goods_shop_rules =
+        ermerchant::compile_goods_shop_rules(ermerchant::config::goods_shop_rules);
+
+    shop_cache_path = cache_path;
+    shop_cache_fingerprints.clear();
+    for (auto &[name, fingerprint] : shop_param_fingerprints)
+    {
+        shop_cache_fingerprints.push_back(fingerprint);
+    }
+
+    ermerchant::shop_cache_contents cache;
+    is_shop_cache_valid =
+        ermerchant::load_shop_cache(shop_cache_path, get_shop_cache_key(shop_cache_fingerprints),
+                                    cache) &&
+        cache.lineups.size() == mod_shops.size();
+    if (is_shop_cache_valid)
+    {
+        for (size_t i = 0; i < mod_shops.size(); i++)
+        {
+            mod_shops[i].lineups = std::move(cache.lineups[i]);
+        }
+        no_repository_item_ids = std::move(cache.no_repository_item_ids);
+        std::ranges::sort(no_repository_item_ids);
+        max_level_by_reinforce_type_id =
+            modutils::flat_map(std::move(cache.max_level_by_reinforce_type_id));
+        mod_shops[0].upgraded_lineups =
+            build_upgraded_lineups(mod_shops[0].lineups, max_level_by_reinforce_type_id);
+        mod_shops[12].upgraded_lineups =
+            build_upgraded_lineups(mod_shops[12].lineups, max_level_by_reinforce_type_id);
+
+        // Every shop is already built, so just add them to the overlay
+        for (auto &category : shop_categories)
+        {
+            std::lock_guard lock(category.mutex);
+            set_shop_category_lineups(category);
+            category.param_states = category.get_param_states();
+            use_recorded_fingerprints(category.param_states);
+            category.is_built = true;
+        }
+    }
+
+    // Otherwise, the shops are built when they're first opened or by prewarm_shops(), whichever
+    // comes first
 
     // Hook SoloParamRepositoryImp::LookupShopMenu to return the new shops added by the mod
     modutils::hook(
@@ -822,6 +1582,71 @@ void ermerchant::setup_shops()
     });
 }
 
+void ermerchant::prewarm_shops()
+{
+    if (is_shop_cache_valid)
+    {
+        return;
+    }
+
+    // Categories are handed out in order, so the likeliest shops to be opened are started first
+    std::atomic<bool> is_every_shop_built = true;
+    modutils::run_parallel(std::size(shop_categories), [&](size_t i) {
+        if (!build_shop_category(shop_categories[i]))
+        {
+            is_every_shop_built = false;
+        }
+    });
+
+    if (!is_every_shop_built)
+    {
+        return;
+    }
+
+    // Hold every category while copying, so the saved lineups and the fingerprints they're keyed
+    // by come from the same builds. Nothing else holds more than one category's mutex at a time.
+    std::vector<std::unique_lock<std::mutex>> category_locks;
+    for (auto &category : shop_categories)
+    {
+        category_locks.emplace_back(category.mutex);
+    }
+
+    auto param_fingerprints = get_built_param_fingerprints();
+    if (!param_fingerprints)
+    {
+        spdlog::info("Params changed while the shops were being built, not saving shop cache");
+        return;
+    }
+
+    ermerchant::shop_cache_contents cache;
+    cache.lineups.resize(mod_shops.size());
+    for (auto &category : shop_categories)
+    {
+        for (auto shop_id : category.shop_ids)
+        {
+            auto shop = get_mod_shop(shop_id);
+            cache.lineups[shop - mod_shops.data()] = shop->lineups;
+        }
+    }
+    {
+        std::shared_lock lock(shop_lineup_mutex);
+        cache.no_repository_item_ids = no_repository_item_ids;
+        cache.max_level_by_reinforce_type_id.assign(max_level_by_reinforce_type_id.begin(),
+                                                    max_level_by_reinforce_type_id.end());
+    }
+    category_locks.clear();
+
+    try
+    {
+        ermerchant::save_shop_cache(shop_cache_path, get_shop_cache_key(*param_fingerprints),
+                                    cache);
+    }
+    catch (std::runtime_error const &e)
+    {
+        spdlog::warn("Failed to save shop cache: {}", e.what());
+    }
+}
+
 void ermerchant::set_shop_open(bool shop_open)
 {
     is_shop_open = shop_open;
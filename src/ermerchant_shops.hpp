@@ -1,5 +1,7 @@
 #pragma once
 
+#include <filesystem>
+
 #include "ermerchant_memory.hpp"
 
 namespace ermerchant
@@ -34,9 +36,16 @@ static constexpr long long dlc_miscellaneous_items = 9390000;
 }
 
 /**
- * Set up new params and hooks used by the Glorious Merchant shop
+ * Set up new params and hooks used by the Glorious Merchant shop. The shops are loaded from the
+ * given cache file if it's up to date, and otherwise built from params and saved to it.
+ */
+void setup_shops(const std::filesystem::path &cache_path);
+
+/**
+ * Build every shop that hasn't been opened yet, so they're ready before the player gets to them.
+ * Shops are otherwise built the first time they're opened.
  */
-void setup_shops();
+void prewarm_shops();
 
 void set_shop_open(bool);
 
@@ -1,12 +1,55 @@
 #pragma once
 
+#include <cstdint>
+
 namespace from
 {
 
+/**
+ * Header of a loaded FMG message table (version 2). The groups follow the header, and each one
+ * maps a range of consecutive message IDs to consecutive entries in the string offset table.
+ */
+struct FmgHeader
+{
+    uint8_t unk00;
+    bool big_endian;
+    uint8_t version;
+    uint8_t unk03;
+    int32_t file_size;
+
+    uint8_t unk08;
+    uint8_t pad00[3];
+    int32_t group_count;
+    int32_t string_count;
+    int32_t unk14;
+
+    // Offset of the string offset table from the start of the header. Each string offset is also
+    // relative to the header, or 0 if the message is empty.
+    int64_t string_offsets_offset;
+    int64_t unk20;
+};
+
+struct FmgGroup
+{
+    int32_t string_index;
+    int32_t first_id;
+    int32_t last_id;
+    int32_t pad00;
+};
+
 namespace CS
 {
 
-class MsgRepositoryImp;
+class MsgRepositoryImp
+{
+  public:
+    void **vftable_ptr;
+
+    // Loaded message tables, indexed by [version][msgbnd]
+    FmgHeader ***fmgs;
+    uint32_t version_count;
+    uint32_t bnd_count;
+};
 
 }
 
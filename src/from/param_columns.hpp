@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "params.hpp"
+
+namespace from
+{
+namespace params
+{
+
+/**
+ * Selected fields of a param copied into dense arrays, one per field, in row order. Filters that
+ * only look at a few fields can run over these instead of striding across the full row structs.
+ */
+template <typename... Fields> struct ParamColumns
+{
+    std::vector<uint64_t> ids;
+    std::tuple<std::vector<Fields>...> columns;
+
+    size_t size() const
+    {
+        return ids.size();
+    }
+
+    template <size_t Index> auto &column()
+    {
+        return std::get<Index>(columns);
+    }
+
+    template <size_t Index> const auto &column() const
+    {
+        return std::get<Index>(columns);
+    }
+};
+
+namespace internal
+{
+// Flags are stored as bytes rather than in a packed std::vector<bool>, so every column is a plain
+// contiguous array
+template <typename Projection, typename T>
+using column_type = std::conditional_t<
+    std::is_same_v<std::remove_cvref_t<std::invoke_result_t<Projection, const T &>>, bool>,
+    unsigned char, std::remove_cvref_t<std::invoke_result_t<Projection, const T &>>>;
+}
+
+/**
+ * Extracts the row IDs and the given fields of every row of a param in a single pass. Fields are
+ * given as projections from the row struct rather than member pointers, so bitfields can be
+ * projected too, e.g. [](auto &row) { return row.isConsume; }
+ */
+template <typename T, typename... Projections>
+auto project(const ParamTableSequence<T> &param, Projections... projections)
+{
+    ParamColumns<internal::column_type<Projections, T>...> result;
+
+    result.ids.reserve(param.size());
+    std::apply([&](auto &...columns) { (columns.reserve(param.size()), ...); }, result.columns);
+
+    for (auto [id, row] : param)
+    {
+        result.ids.push_back(id);
+        std::apply(
+            [&](auto &...columns) { (columns.push_back(std::invoke(projections, row)), ...); },
+            result.columns);
+    }
+
+    return result;
+}
+
+}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "param_fields.hpp"
+#include "params.hpp"
+
+namespace from
+{
+namespace params
+{
+
+/**
+ * Row IDs that differ between two versions of a param
+ */
+struct ParamDiff
+{
+    std::vector<uint64_t> added;
+    std::vector<uint64_t> removed;
+    std::vector<uint64_t> changed;
+
+    // (row ID, field name) for every field that differs in a changed row. Only filled in for
+    // params whose field descriptors (paramdef/fields/) are included.
+    std::vector<std::pair<uint64_t, std::string_view>> changed_fields;
+
+    bool empty() const
+    {
+        return added.empty() && removed.empty() && changed.empty();
+    }
+};
+
+namespace internal
+{
+template <typename T>
+std::vector<std::pair<uint64_t, const T *>> rows_by_id(const ParamTableSequence<T> &param)
+{
+    std::vector<std::pair<uint64_t, const T *>> rows;
+    rows.reserve(param.size());
+    for (auto [id, row] : param)
+    {
+        rows.emplace_back(id, &row);
+    }
+
+    if (!std::ranges::is_sorted(rows, {}, &std::pair<uint64_t, const T *>::first))
+    {
+        std::ranges::stable_sort(rows, {}, &std::pair<uint64_t, const T *>::first);
+    }
+
+    return rows;
+}
+}
+
+/**
+ * Compares two versions of a param (e.g. from the game and from a snapshot, or from two
+ * snapshots) by merge-joining their rows by ID. Rows with the same ID are compared with memcmp,
+ * and only rows that differ are compared field by field.
+ */
+template <typename T>
+ParamDiff diff(const ParamTableSequence<T> &before, const ParamTableSequence<T> &after)
+{
+    auto before_rows = internal::rows_by_id(before);
+    auto after_rows = internal::rows_by_id(after);
+
+    ParamDiff result;
+
+    auto before_row = before_rows.begin();
+    auto after_row = after_rows.begin();
+    while (before_row != before_rows.end() && after_row != after_rows.end())
+    {
+        if (before_row->first < after_row->first)
+        {
+            result.removed.push_back((before_row++)->first);
+        }
+        else if (after_row->first < before_row->first)
+        {
+            result.added.push_back((after_row++)->first);
+        }
+        else
+        {
+            auto id = before_row->first;
+            auto before_data = (before_row++)->second;
+            auto after_data = (after_row++)->second;
+            if (memcmp(before_data, after_data, sizeof(T)) == 0)
+            {
+                continue;
+            }
+
+            result.changed.push_back(id);
+            if constexpr (reflected_param<T>)
+            {
+                for_each_field<T>([&](const field_descriptor &field) {
+                    if (!field_equal(before_data, after_data, field))
+                    {
+                        result.changed_fields.emplace_back(id, field.name);
+                    }
+                });
+            }
+        }
+    }
+
+    for (; before_row != before_rows.end(); before_row++)
+    {
+        result.removed.push_back(before_row->first);
+    }
+    for (; after_row != after_rows.end(); after_row++)
+    {
+        result.added.push_back(after_row->first);
+    }
+
+    return result;
+}
+
+}
+}
@@ -0,0 +1,7 @@
+/**
+ * param_fields.cpp
+ *
+ * Compiles every generated paramdef field list, so the offsets they static_assert are checked by
+ * the build even for params nothing else includes yet.
+ */
+#include "paramdef/fields/all.hpp"
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+namespace from
+{
+namespace params
+{
+
+enum class field_type : unsigned char
+{
+    s8,
+    u8,
+    s16,
+    u16,
+    s32,
+    u32,
+    f32,
+    boolean,
+    character,
+    wide_character,
+};
+
+/**
+ * Layout of one field of a paramdef struct. Bitfields are described by the storage unit that
+ * holds them (offset and size), and their value is read through the struct member by
+ * read_bitfield, so their position within the unit comes from the compiler.
+ */
+struct field_descriptor
+{
+    std::string_view name;
+    field_type type;
+    size_t offset;
+    size_t size;
+    size_t count;
+    uint64_t (*read_bitfield)(const void *row);
+
+    constexpr bool is_bitfield() const
+    {
+        return read_bitfield != nullptr;
+    }
+};
+
+/**
+ * Compile-time field list of a paramdef struct, generated by tools/generate_paramdef_fields.py
+ * into src/from/paramdef/fields/. Every list is compiled by param_fields.cpp, which checks its
+ * offsets.
+ */
+template <typename T> struct paramdef_fields;
+
+template <typename T>
+concept reflected_param = requires { paramdef_fields<T>::fields; };
+
+/**
+ * Calls fn(field) for every field of T in declaration order. The field list is a constant, so the
+ * loop is unrolled and each field's offset and size fold into the call.
+ */
+template <reflected_param T, typename Fn> constexpr void for_each_field(Fn &&fn)
+{
+    constexpr auto &fields = paramdef_fields<T>::fields;
+    [&]<size_t... Indexes>(std::index_sequence<Indexes...>) {
+        (fn(fields[Indexes]), ...);
+    }(std::make_index_sequence<fields.size()>());
+}
+
+/**
+ * Compares one field of two rows. Floats are compared bitwise, so a changed NaN payload or -0.0
+ * counts as a difference.
+ */
+inline bool field_equal(const void *row1, const void *row2, const field_descriptor &field)
+{
+    if (field.is_bitfield())
+    {
+        return field.read_bitfield(row1) == field.read_bitfield(row2);
+    }
+
+    return memcmp(static_cast<const std::byte *>(row1) + field.offset,
+                  static_cast<const std::byte *>(row2) + field.offset,
+                  field.size * field.count) == 0;
+}
+
+}
+}
@@ -0,0 +1,60 @@
+#include "param_file.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+
+using namespace std;
+
+from::params::ParamFile::ParamFile(const filesystem::path &path)
+    : file(path), param_table(reinterpret_cast<ParamTable *>(file.data().data())),
+      param_name(path.stem().wstring())
+{
+    auto data = file.data();
+
+    if (data.size() < offsetof(ParamTable, rows) ||
+        data.size() < offsetof(ParamTable, rows) + param_table->num_rows * sizeof(ParamRowInfo) ||
+        param_table->param_type_offset >= data.size() || !rows_fit(0))
+    {
+        spdlog::error("Invalid param file {}", path.string());
+        throw runtime_error("Invalid param file");
+    }
+
+    spdlog::info("Loaded param file {} ({}, {} rows)", path.string(), get_param_type(),
+                 param_table->num_rows);
+}
+
+from::params::ParamFile::~ParamFile()
+{
+    release_table_index(param_table);
+}
+
+string_view from::params::ParamFile::get_param_type() const
+{
+    auto data = file.data();
+    if (param_table->param_type_offset == 0)
+    {
+        return {};
+    }
+
+    auto param_type = reinterpret_cast<const char *>(data.data() + param_table->param_type_offset);
+    return {param_type, strnlen(param_type, data.size() - param_table->param_type_offset)};
+}
+
+size_t from::params::ParamFile::get_row_size() const
+{
+    if (param_table->num_rows < 2)
+    {
+        return 0;
+    }
+
+    return param_table->rows[1].param_offset - param_table->rows[0].param_offset;
+}
+
+bool from::params::ParamFile::rows_fit(size_t row_size) const
+{
+    auto data_size = file.data().size();
+    return ranges::all_of(span(param_table->rows, param_table->num_rows), [&](auto &row) {
+        return row.param_offset <= data_size && row_size <= data_size - row.param_offset;
+    });
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <filesystem>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "../modutils.hpp"
+#include "params.hpp"
+
+namespace from
+{
+namespace params
+{
+
+/**
+ * A standalone PARAM file (e.g. extracted from regulation.bin) mapped into memory. The game loads
+ * these files as-is, so the mapped bytes have the same layout as an in-memory ParamTable and rows
+ * are read in place without any copies.
+ */
+class ParamFile
+{
+  public:
+    /**
+     * Maps the given file and checks that its row array and row offsets are within bounds. The
+     * param is named after the file, e.g. EquipParamWeapon.param is "EquipParamWeapon".
+     */
+    explicit ParamFile(const std::filesystem::path &path);
+    ~ParamFile();
+
+    ParamFile(const ParamFile &) = delete;
+    ParamFile &operator=(const ParamFile &) = delete;
+
+    /**
+     * Returns the rows of the file as the given paramdef struct, after checking that every row
+     * fits in the file and that the row stride matches the size of the struct
+     */
+    template <typename T> ParamTableSequence<T> get()
+    {
+        auto row_size = get_row_size();
+        if (row_size != 0 && row_size != sizeof(T))
+        {
+            spdlog::error("Param file {} has {} byte rows, expected {}", modutils::utf8{param_name},
+                          row_size, sizeof(T));
+            throw std::runtime_error("Param file row size mismatch");
+        }
+
+        if (!rows_fit(sizeof(T)))
+        {
+            spdlog::error("Param file {} is truncated", modutils::utf8{param_name});
+            throw std::runtime_error("Param file truncated");
+        }
+
+        return ParamTableSequence<T>(param_table, param_name);
+    }
+
+    /**
+     * Returns the paramdef type name stored in the file (e.g. EQUIP_PARAM_WEAPON_ST), or an empty
+     * string if there isn't one
+     */
+    std::string_view get_param_type() const;
+
+    size_t size() const
+    {
+        return param_table->num_rows;
+    }
+
+  private:
+    modutils::mapped_file file;
+    ParamTable *param_table;
+    std::wstring param_name;
+
+    /**
+     * Returns the distance between the first two rows' data, or 0 if there are fewer than two rows
+     */
+    size_t get_row_size() const;
+
+    bool rows_fit(size_t row_size) const;
+};
+
+}
+}
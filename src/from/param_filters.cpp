@@ -0,0 +1,131 @@
+#include "param_filters.hpp"
+
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AVX2_TARGET
+#endif
+
+static void set_bit(from::params::selection &rows, size_t index)
+{
+    rows[index / 64] |= 1ull << (index % 64);
+}
+
+static void select_remainder_below_scalar(span<const uint64_t> ids, uint64_t modulus,
+                                          uint64_t bound, size_t begin,
+                                          from::params::selection &rows)
+{
+    for (size_t i = begin; i < ids.size(); i++)
+    {
+        if (ids[i] % modulus < bound)
+        {
+            set_bit(rows, i);
+        }
+    }
+}
+
+/**
+ * Four IDs at a time. There's no 64-bit integer division in AVX2, so the IDs are converted to
+ * doubles, which is exact as long as both the IDs and the modulus are below 2^52.
+ */
+AVX2_TARGET static void select_remainder_below_avx2(span<const uint64_t> ids, uint64_t modulus,
+                                                    uint64_t bound, from::params::selection &rows)
+{
+    static constexpr uint64_t exact_limit = 1ull << 52;
+    if (modulus >= exact_limit)
+    {
+        select_remainder_below_scalar(ids, modulus, bound, 0, rows);
+        return;
+    }
+
+    // Adding 2^52 as an integer to the exponent bits and then subtracting it as a double converts
+    // values below 2^52 without a 64-bit integer conversion instruction
+    auto magic_int = _mm256_set1_epi64x(0x4330000000000000);
+    auto magic_double = _mm256_set1_pd(4503599627370496.0);
+    auto modulus_double = _mm256_set1_pd((double)modulus);
+    auto bound_double = _mm256_set1_pd((double)min(bound, modulus));
+
+    size_t i = 0;
+    for (; i + 4 <= ids.size(); i += 4)
+    {
+        auto id = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&ids[i]));
+        if (!_mm256_testz_si256(id, _mm256_set1_epi64x(-(int64_t)exact_limit)))
+        {
+            for (size_t j = i; j < i + 4; j++)
+            {
+                if (ids[j] % modulus < bound)
+                {
+                    set_bit(rows, j);
+                }
+            }
+            continue;
+        }
+
+        auto id_double = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(id, magic_int)),
+                                       magic_double);
+        auto quotient = _mm256_floor_pd(_mm256_div_pd(id_double, modulus_double));
+        auto remainder = _mm256_sub_pd(id_double, _mm256_mul_pd(quotient, modulus_double));
+        auto is_below = _mm256_cmp_pd(remainder, bound_double, _CMP_LT_OQ);
+        auto mask = (uint64_t)_mm256_movemask_pd(is_below);
+
+        rows[i / 64] |= mask << (i % 64);
+    }
+
+    select_remainder_below_scalar(ids, modulus, bound, i, rows);
+}
+
+static bool detect_avx2()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+
+    // AVX2 also needs the OS to save the YMM registers
+    __cpuid(info, 1);
+    bool has_osxsave = info[2] & (1 << 27);
+    bool has_avx = info[2] & (1 << 28);
+    if (!has_osxsave || !has_avx || (_xgetbv(0) & 6) != 6)
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return info[1] & (1 << 5);
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+static bool is_avx2_supported()
+{
+    static const bool avx2_supported = detect_avx2();
+    return avx2_supported;
+}
+
+from::params::selection from::params::select_remainder_below(span<const uint64_t> ids,
+                                                             uint64_t modulus, uint64_t bound)
+{
+    selection rows((ids.size() + 63) / 64, 0);
+
+    if (is_avx2_supported())
+    {
+        select_remainder_below_avx2(ids, modulus, bound, rows);
+    }
+    else
+    {
+        select_remainder_below_scalar(ids, modulus, bound, 0, rows);
+    }
+
+    return rows;
+}
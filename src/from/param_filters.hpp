@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace from
+{
+namespace params
+{
+
+/**
+ * Bitmask over the rows of a param column, with bit i of word i / 64 set if row i was selected
+ */
+using selection = std::vector<uint64_t>;
+
+inline bool is_selected(const selection &rows, size_t index)
+{
+    return (rows[index / 64] >> (index % 64)) & 1;
+}
+
+/**
+ * Selects the row IDs whose remainder modulo the given modulus is below the given bound. This
+ * covers checks on the decimal digits of an ID, such as (id % 10000) / 100 == 0 for weapons with
+ * no affinity, or id % 100 == 0 for spirit ashes with no upgrades.
+ */
+selection select_remainder_below(std::span<const uint64_t> ids, uint64_t modulus, uint64_t bound);
+
+}
+}
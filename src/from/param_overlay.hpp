@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <ranges>
+#include <vector>
+
+namespace from
+{
+namespace params
+{
+
+/**
+ * Rows added by the mod, served in front of a vanilla param table. The game's memory is never
+ * written to (which would also stop Seamless Co-op from matchmaking); a lookup hook checks the
+ * overlay first and falls back to the vanilla lookup for any ID the overlay doesn't have.
+ *
+ * Rows are changed with set_row() and erase_rows(), and then commit() rebuilds a sorted index of
+ * the overlay rows, so a lookup is a single binary search over a contiguous array.
+ */
+template <typename T> class ParamOverlay
+{
+  public:
+    struct Row
+    {
+        uint64_t id;
+        T *row;
+    };
+
+    /**
+     * Adds a row to the overlay, or replaces an existing overlay row
+     */
+    T &set_row(uint64_t id, const T &row)
+    {
+        return overlay_rows.insert_or_assign(id, row).first->second;
+    }
+
+    /**
+     * Removes the overlay rows with IDs in [begin_id, end_id), which makes the vanilla rows with
+     * those IDs visible again after the next commit(). The removed rows aren't freed until
+     * release_retired_rows(), since the game may still hold pointers to rows it looked up.
+     */
+    void erase_rows(uint64_t begin_id, uint64_t end_id)
+    {
+        auto row = overlay_rows.lower_bound(begin_id);
+        auto end = overlay_rows.lower_bound(end_id);
+        while (row != end)
+        {
+            retired_rows.push_back(overlay_rows.extract(row++));
+        }
+    }
+
+    /**
+     * Frees the rows removed by erase_rows()
+     */
+    void release_retired_rows()
+    {
+        retired_rows.clear();
+    }
+
+    /**
+     * Rebuilds the index after rows were added or removed
+     */
+    void commit()
+    {
+        index.clear();
+        index.reserve(overlay_rows.size());
+        for (auto &[id, row] : overlay_rows)
+        {
+            index.push_back({id, &row});
+        }
+    }
+
+    /**
+     * Returns the overlay row with the given ID, or nullptr if the overlay doesn't have one
+     */
+    T *find(uint64_t id) const
+    {
+        auto row = std::ranges::lower_bound(index, id, {}, &Row::id);
+        if (row != index.end() && row->id == id)
+        {
+            return row->row;
+        }
+
+        return nullptr;
+    }
+
+    size_t size() const
+    {
+        return index.size();
+    }
+
+  private:
+    std::map<uint64_t, T> overlay_rows;
+    std::vector<typename std::map<uint64_t, T>::node_type> retired_rows;
+    std::vector<Row> index;
+};
+
+}
+}
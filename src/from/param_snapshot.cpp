@@ -0,0 +1,181 @@
+#include "param_snapshot.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <spdlog/spdlog.h>
+
+using namespace std;
+
+void from::params::ParamSnapshotWriter::add_table(wstring_view name, size_t row_size)
+{
+    auto param_res_cap = find_param_res_cap(name);
+    if (param_res_cap == nullptr)
+    {
+        spdlog::warn("Param {} not found, leaving it out of the snapshot", modutils::utf8{name});
+        return;
+    }
+
+    auto param_table = param_res_cap->param_header->param_table;
+    auto table_bytes = reinterpret_cast<const std::byte *>(param_table);
+
+    // The table ends after whichever is last of the row array, the row data or the param type
+    // name
+    size_t size = offsetof(ParamTable, rows) + param_table->num_rows * sizeof(ParamRowInfo);
+    for (auto &row : span(param_table->rows, param_table->num_rows))
+    {
+        size = max<size_t>(size, row.param_offset + row_size);
+    }
+    if (param_table->param_type_offset != 0)
+    {
+        auto param_type =
+            reinterpret_cast<const char *>(table_bytes + param_table->param_type_offset);
+        size = max<size_t>(size, param_table->param_type_offset + strlen(param_type) + 1);
+    }
+
+    tables.push_back({
+        .name = modutils::to_utf8(name),
+        .data = table_bytes,
+        .size = size,
+        .row_size = row_size,
+    });
+}
+
+void from::params::ParamSnapshotWriter::save(const filesystem::path &path) const
+{
+    snapshot::snapshot_header header = {.version = snapshot::version,
+                                        .table_count = static_cast<uint32_t>(tables.size())};
+    memcpy(header.magic, snapshot::magic, sizeof(header.magic));
+
+    vector<snapshot::snapshot_table_entry> entries;
+    auto offset = sizeof(header) + tables.size() * sizeof(snapshot::snapshot_table_entry);
+    for (auto &table : tables)
+    {
+        offset = (offset + snapshot::table_alignment - 1) / snapshot::table_alignment *
+                 snapshot::table_alignment;
+
+        snapshot::snapshot_table_entry entry = {
+            .offset = offset, .size = table.size, .row_size = table.row_size};
+        strncpy(entry.name, table.name.c_str(), sizeof(entry.name) - 1);
+        entries.push_back(entry);
+
+        offset += table.size;
+    }
+
+    ofstream file(path, ios::binary | ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(entries.data()),
+               entries.size() * sizeof(snapshot::snapshot_table_entry));
+
+    for (size_t i = 0; i < tables.size(); i++)
+    {
+        static constexpr char padding[snapshot::table_alignment] = {};
+        file.write(padding, entries[i].offset - file.tellp());
+        file.write(reinterpret_cast<const char *>(tables[i].data), tables[i].size);
+    }
+
+    if (!file)
+    {
+        throw runtime_error("Failed to write param snapshot " + path.string());
+    }
+
+    spdlog::info("Saved {} params to {}", tables.size(), path.string());
+}
+
+from::params::ParamSnapshot::ParamSnapshot(const filesystem::path &path)
+    : file(path), param_list(make_unique<ParamList>())
+{
+    auto data = file.data();
+
+    auto invalid = [&](const char *reason) {
+        spdlog::error("Invalid param snapshot {}: {}", path.string(), reason);
+        return runtime_error("Invalid param snapshot");
+    };
+
+    if (data.size() < sizeof(snapshot::snapshot_header))
+    {
+        throw invalid("too small");
+    }
+
+    auto header = reinterpret_cast<const snapshot::snapshot_header *>(data.data());
+    if (memcmp(header->magic, snapshot::magic, sizeof(header->magic)) != 0 ||
+        header->version != snapshot::version)
+    {
+        throw invalid("unknown format or version");
+    }
+
+    auto entries_size = header->table_count * sizeof(snapshot::snapshot_table_entry);
+    if (header->table_count > size(param_list->entries) ||
+        data.size() < sizeof(*header) + entries_size)
+    {
+        throw invalid("bad table count");
+    }
+
+    auto entries = span(reinterpret_cast<const snapshot::snapshot_table_entry *>(header + 1),
+                        header->table_count);
+
+    param_names.reserve(entries.size());
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        auto &entry = entries[i];
+        if (entry.offset % snapshot::table_alignment != 0 || entry.offset > data.size() ||
+            entry.size > data.size() - entry.offset || entry.size < offsetof(ParamTable, rows))
+        {
+            throw invalid("table out of bounds");
+        }
+
+        // Every row must fit in the table, not just start inside it
+        auto param_table = reinterpret_cast<ParamTable *>(data.data() + entry.offset);
+        auto rows_size = param_table->num_rows * sizeof(ParamRowInfo);
+        if (offsetof(ParamTable, rows) + rows_size > entry.size ||
+            any_of(param_table->rows, param_table->rows + param_table->num_rows, [&](auto &row) {
+                return row.param_offset > entry.size ||
+                       entry.row_size > entry.size - row.param_offset;
+            }))
+        {
+            throw invalid("rows out of bounds");
+        }
+
+        string_view name(entry.name, strnlen(entry.name, sizeof(entry.name)));
+        auto &param_name = param_names.emplace_back(name.begin(), name.end());
+        row_sizes.push_back(entry.row_size);
+
+        auto param_header = make_unique<ParamHeader>();
+        param_header->param_table = param_table;
+
+        auto param_res_cap = make_unique<ParamResCap>();
+        param_res_cap->param_name.str.ptr = param_name.data();
+        param_res_cap->param_name.length = param_name.size();
+        param_res_cap->param_name.capacity = max<size_t>(param_name.size(), 8);
+        param_res_cap->param_header = param_header.get();
+
+        param_list->entries[i].param_res_cap = param_res_cap.get();
+
+        param_headers.push_back(std::move(param_header));
+        param_res_caps.push_back(std::move(param_res_cap));
+    }
+
+    spdlog::info("Loaded {} params from snapshot {}", entries.size(), path.string());
+}
+
+from::params::ParamSnapshot::~ParamSnapshot()
+{
+    if (param_list_address == &param_list_ptr)
+    {
+        param_list_address = previous_param_list_address;
+        invalidate_param_caches();
+    }
+
+    for (auto &param_header : param_headers)
+    {
+        release_table_index(param_header->param_table);
+    }
+}
+
+void from::params::ParamSnapshot::install()
+{
+    param_list_ptr = param_list.get();
+    previous_param_list_address = param_list_address;
+    param_list_address = &param_list_ptr;
+    invalidate_param_caches();
+}
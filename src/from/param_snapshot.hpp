@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../modutils.hpp"
+#include "params.hpp"
+
+namespace from
+{
+namespace params
+{
+
+/**
+ * Binary snapshot of param tables, so the params the mod read can be inspected or diffed without
+ * the game.
+ *
+ * The file is a snapshot_header, followed by one snapshot_table_entry per table, followed by each
+ * table's bytes exactly as they were in memory (ParamTable header, ParamRowInfo array and row
+ * data). Row offsets are relative to the start of a table, so tables can be used straight out of
+ * a memory mapping.
+ */
+namespace snapshot
+{
+static constexpr char magic[8] = {'E', 'R', 'M', 'P', 'A', 'R', 'A', 'M'};
+static constexpr uint32_t version = 2;
+static constexpr size_t table_alignment = 16;
+
+struct snapshot_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t table_count;
+};
+
+struct snapshot_table_entry
+{
+    char name[64];
+    uint64_t offset;
+    uint64_t size;
+
+    // Size of the paramdef struct the table was saved with, so every row can be bounds checked
+    uint64_t row_size;
+};
+}
+
+/**
+ * Collects loaded param tables and writes them to a snapshot file
+ */
+class ParamSnapshotWriter
+{
+  public:
+    /**
+     * Adds every param bound to the given paramdef struct
+     */
+    template <bound_param T> void add()
+    {
+        for (auto name : param_traits<T>::names)
+        {
+            add_table(name, sizeof(T));
+        }
+    }
+
+    /**
+     * Adds the param with the given name. The row size is needed to know where the last row ends.
+     */
+    void add_table(std::wstring_view name, size_t row_size);
+
+    void save(const std::filesystem::path &path) const;
+
+  private:
+    struct table
+    {
+        std::string name;
+        const std::byte *data;
+        size_t size;
+        size_t row_size;
+    };
+
+    std::vector<table> tables;
+};
+
+/**
+ * A snapshot file mapped into memory, exposed through a fake ParamList so get_param() can read
+ * from it like the game's params
+ */
+class ParamSnapshot
+{
+  public:
+    explicit ParamSnapshot(const std::filesystem::path &path);
+    ~ParamSnapshot();
+
+    /**
+     * Points param_list_address at this snapshot until it's destroyed, when the previous list is
+     * restored. Params returned while it was installed must not be used after that.
+     */
+    void install();
+
+    /**
+     * Returns a param from this snapshot without installing it, e.g. to compare two snapshots. The
+     * rows must have been saved with a paramdef struct at least as large as T.
+     */
+    template <bound_param T, size_t Index = 0> ParamTableSequence<T> get() const
+    {
+        auto name = param_traits<T>::names[Index];
+        for (size_t i = 0; i < param_names.size(); i++)
+        {
+            if (param_names[i] == name)
+            {
+                if (sizeof(T) > row_sizes[i])
+                {
+                    spdlog::error("Param {} in snapshot has {} byte rows, expected {}",
+                                  modutils::utf8{name}, row_sizes[i], sizeof(T));
+                    throw std::runtime_error("Param row size mismatch");
+                }
+
+                return ParamTableSequence<T>(param_headers[i]->param_table, param_names[i]);
+            }
+        }
+
+        spdlog::error("Param {} not found in snapshot", modutils::utf8{name});
+        throw std::runtime_error("Param not found");
+    }
+
+  private:
+    modutils::mapped_file file;
+
+    std::unique_ptr<ParamList> param_list;
+    ParamList *param_list_ptr = nullptr;
+    ParamList **previous_param_list_address = nullptr;
+    std::vector<std::unique_ptr<ParamResCap>> param_res_caps;
+    std::vector<std::unique_ptr<ParamHeader>> param_headers;
+    std::vector<std::wstring> param_names;
+    std::vector<size_t> row_sizes;
+};
+
+}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <string_view>
+
+namespace from
+{
+namespace paramdef
+{
+struct ATK_PARAM_ST;
+struct BEHAVIOR_PARAM_ST;
+struct BULLET_PARAM_ST;
+struct CHARACTER_INIT_PARAM;
+struct EQUIP_MTRL_SET_PARAM_ST;
+struct EQUIP_PARAM_ACCESSORY_ST;
+struct EQUIP_PARAM_CUSTOM_WEAPON_ST;
+struct EQUIP_PARAM_GEM_ST;
+struct EQUIP_PARAM_GOODS_ST;
+struct EQUIP_PARAM_PROTECTOR_ST;
+struct EQUIP_PARAM_WEAPON_ST;
+struct GESTURE_PARAM_ST;
+struct ITEMLOT_PARAM_ST;
+struct MAGIC_PARAM_ST;
+struct NPC_PARAM_ST;
+struct REINFORCE_PARAM_PROTECTOR_ST;
+struct REINFORCE_PARAM_WEAPON_ST;
+struct SHOP_LINEUP_PARAM;
+struct SP_EFFECT_PARAM_ST;
+struct SWORD_ARTS_PARAM_ST;
+}
+
+namespace params
+{
+
+/**
+ * Compile-time binding of a paramdef struct to the name(s) of the params that use it. Several
+ * params can share one struct (e.g. ItemLotParam_map and ItemLotParam_enemy), in which case
+ * they're selected by index.
+ */
+template <typename T> struct param_traits;
+
+template <typename T>
+concept bound_param = requires { param_traits<T>::names; };
+
+#define FROM_PARAM_TRAITS(paramdef_type, ...)                                                      \
+    template <> struct param_traits<paramdef::paramdef_type>                                       \
+    {                                                                                              \
+        static constexpr auto names = std::to_array<std::wstring_view>({__VA_ARGS__});             \
+    }
+
+FROM_PARAM_TRAITS(ATK_PARAM_ST, L"AtkParam_Pc", L"AtkParam_Npc");
+FROM_PARAM_TRAITS(BEHAVIOR_PARAM_ST, L"BehaviorParam", L"BehaviorParam_PC");
+FROM_PARAM_TRAITS(BULLET_PARAM_ST, L"Bullet");
+FROM_PARAM_TRAITS(CHARACTER_INIT_PARAM, L"CharaInitParam");
+FROM_PARAM_TRAITS(EQUIP_MTRL_SET_PARAM_ST, L"EquipMtrlSetParam");
+FROM_PARAM_TRAITS(EQUIP_PARAM_ACCESSORY_ST, L"EquipParamAccessory");
+FROM_PARAM_TRAITS(EQUIP_PARAM_CUSTOM_WEAPON_ST, L"EquipParamCustomWeapon");
+FROM_PARAM_TRAITS(EQUIP_PARAM_GEM_ST, L"EquipParamGem");
+FROM_PARAM_TRAITS(EQUIP_PARAM_GOODS_ST, L"EquipParamGoods");
+FROM_PARAM_TRAITS(EQUIP_PARAM_PROTECTOR_ST, L"EquipParamProtector");
+FROM_PARAM_TRAITS(EQUIP_PARAM_WEAPON_ST, L"EquipParamWeapon");
+FROM_PARAM_TRAITS(GESTURE_PARAM_ST, L"GestureParam");
+FROM_PARAM_TRAITS(ITEMLOT_PARAM_ST, L"ItemLotParam_map", L"ItemLotParam_enemy");
+FROM_PARAM_TRAITS(MAGIC_PARAM_ST, L"Magic");
+FROM_PARAM_TRAITS(NPC_PARAM_ST, L"NpcParam");
+FROM_PARAM_TRAITS(REINFORCE_PARAM_PROTECTOR_ST, L"ReinforceParamProtector");
+FROM_PARAM_TRAITS(REINFORCE_PARAM_WEAPON_ST, L"ReinforceParamWeapon");
+FROM_PARAM_TRAITS(SHOP_LINEUP_PARAM, L"ShopLineupParam", L"ShopLineupParam_Recipe");
+FROM_PARAM_TRAITS(SP_EFFECT_PARAM_ST, L"SpEffectParam");
+FROM_PARAM_TRAITS(SWORD_ARTS_PARAM_ST, L"SwordArtsParam");
+
+#undef FROM_PARAM_TRAITS
+
+}
+}
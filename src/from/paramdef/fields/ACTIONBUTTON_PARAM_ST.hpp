@@ -0,0 +1,74 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../ACTIONBUTTON_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::ACTIONBUTTON_PARAM_ST> {
+    using T = paramdef::ACTIONBUTTON_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 29> fields = {{
+        { "regionType", field_type::u8, offsetof(T, regionType), 1, 1, nullptr },
+        { "category", field_type::u8, offsetof(T, category), 1, 1, nullptr },
+        { "padding1", field_type::u8, offsetof(T, padding1), 1, 2, nullptr },
+        { "dummyPoly1", field_type::s32, offsetof(T, dummyPoly1), 4, 1, nullptr },
+        { "dummyPoly2", field_type::s32, offsetof(T, dummyPoly2), 4, 1, nullptr },
+        { "radius", field_type::f32, offsetof(T, radius), 4, 1, nullptr },
+        { "angle", field_type::s32, offsetof(T, angle), 4, 1, nullptr },
+        { "depth", field_type::f32, offsetof(T, depth), 4, 1, nullptr },
+        { "width", field_type::f32, offsetof(T, width), 4, 1, nullptr },
+        { "height", field_type::f32, offsetof(T, height), 4, 1, nullptr },
+        { "baseHeightOffset", field_type::f32, offsetof(T, baseHeightOffset), 4, 1, nullptr },
+        { "angleCheckType", field_type::u8, offsetof(T, angleCheckType), 1, 1, nullptr },
+        { "padding2", field_type::u8, offsetof(T, padding2), 1, 3, nullptr },
+        { "allowAngle", field_type::s32, offsetof(T, allowAngle), 4, 1, nullptr },
+        { "spotDummyPoly", field_type::s32, offsetof(T, spotDummyPoly), 4, 1, nullptr },
+        { "textBoxType", field_type::u8, offsetof(T, textBoxType), 1, 1, nullptr },
+        { "padding3", field_type::u8, offsetof(T, padding3), 1, 2, nullptr },
+        { "padding5", field_type::u8, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->padding5; } },
+        { "isInvalidForRide", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isInvalidForRide; } },
+        { "isGrayoutForRide", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isGrayoutForRide; } },
+        { "isInvalidForCrouching", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isInvalidForCrouching; } },
+        { "isGrayoutForCrouching", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isGrayoutForCrouching; } },
+        { "padding4", field_type::u8, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->padding4; } },
+        { "textId", field_type::s32, offsetof(T, textId), 4, 1, nullptr },
+        { "invalidFlag", field_type::u32, offsetof(T, invalidFlag), 4, 1, nullptr },
+        { "grayoutFlag", field_type::u32, offsetof(T, grayoutFlag), 4, 1, nullptr },
+        { "overrideActionButtonIdForRide", field_type::s32, offsetof(T, overrideActionButtonIdForRide), 4, 1, nullptr },
+        { "execInvalidTime", field_type::f32, offsetof(T, execInvalidTime), 4, 1, nullptr },
+        { "padding6", field_type::u8, offsetof(T, padding6), 1, 28, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, regionType) == 0);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, category) == 1);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, padding1) == 2);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, dummyPoly1) == 4);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, dummyPoly2) == 8);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, radius) == 12);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, angle) == 16);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, depth) == 20);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, width) == 24);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, height) == 28);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, baseHeightOffset) == 32);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, angleCheckType) == 36);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, padding2) == 37);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, allowAngle) == 40);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, spotDummyPoly) == 44);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, textBoxType) == 48);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, padding3) == 49);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, textId) == 52);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, invalidFlag) == 56);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, grayoutFlag) == 60);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, overrideActionButtonIdForRide) == 64);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, execInvalidTime) == 68);
+static_assert(offsetof(paramdef::ACTIONBUTTON_PARAM_ST, padding6) == 72);
+
+}; // namespace params
+}; // namespace from
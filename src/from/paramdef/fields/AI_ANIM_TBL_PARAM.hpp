@@ -0,0 +1,234 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../AI_ANIM_TBL_PARAM.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::AI_ANIM_TBL_PARAM> {
+    using T = paramdef::AI_ANIM_TBL_PARAM;
+
+    static constexpr std::array<field_descriptor, 121> fields = {{
+        { "atk0_EzStateId", field_type::u16, offsetof(T, atk0_EzStateId), 2, 1, nullptr },
+        { "atk1_EzStateId", field_type::u16, offsetof(T, atk1_EzStateId), 2, 1, nullptr },
+        { "atk2_EzStateId", field_type::u16, offsetof(T, atk2_EzStateId), 2, 1, nullptr },
+        { "atk3_EzStateId", field_type::u16, offsetof(T, atk3_EzStateId), 2, 1, nullptr },
+        { "atk4_EzStateId", field_type::u16, offsetof(T, atk4_EzStateId), 2, 1, nullptr },
+        { "atk5_EzStateId", field_type::u16, offsetof(T, atk5_EzStateId), 2, 1, nullptr },
+        { "atk6_EzStateId", field_type::u16, offsetof(T, atk6_EzStateId), 2, 1, nullptr },
+        { "atk7_EzStateId", field_type::u16, offsetof(T, atk7_EzStateId), 2, 1, nullptr },
+        { "atk8_EzStateId", field_type::u16, offsetof(T, atk8_EzStateId), 2, 1, nullptr },
+        { "atk9_EzStateId", field_type::u16, offsetof(T, atk9_EzStateId), 2, 1, nullptr },
+        { "atk10_EzStateId", field_type::u16, offsetof(T, atk10_EzStateId), 2, 1, nullptr },
+        { "atk11_EzStateId", field_type::u16, offsetof(T, atk11_EzStateId), 2, 1, nullptr },
+        { "atk12_EzStateId", field_type::u16, offsetof(T, atk12_EzStateId), 2, 1, nullptr },
+        { "atk13_EzStateId", field_type::u16, offsetof(T, atk13_EzStateId), 2, 1, nullptr },
+        { "atk14_EzStateId", field_type::u16, offsetof(T, atk14_EzStateId), 2, 1, nullptr },
+        { "atk15_EzStateId", field_type::u16, offsetof(T, atk15_EzStateId), 2, 1, nullptr },
+        { "atk16_EzStateId", field_type::u16, offsetof(T, atk16_EzStateId), 2, 1, nullptr },
+        { "atk17_EzStateId", field_type::u16, offsetof(T, atk17_EzStateId), 2, 1, nullptr },
+        { "atk18_EzStateId", field_type::u16, offsetof(T, atk18_EzStateId), 2, 1, nullptr },
+        { "atk19_EzStateId", field_type::u16, offsetof(T, atk19_EzStateId), 2, 1, nullptr },
+        { "atk20_EzStateId", field_type::u16, offsetof(T, atk20_EzStateId), 2, 1, nullptr },
+        { "atk21_EzStateId", field_type::u16, offsetof(T, atk21_EzStateId), 2, 1, nullptr },
+        { "atk22_EzStateId", field_type::u16, offsetof(T, atk22_EzStateId), 2, 1, nullptr },
+        { "atk23_EzStateId", field_type::u16, offsetof(T, atk23_EzStateId), 2, 1, nullptr },
+        { "atk24_EzStateId", field_type::u16, offsetof(T, atk24_EzStateId), 2, 1, nullptr },
+        { "atk25_EzStateId", field_type::u16, offsetof(T, atk25_EzStateId), 2, 1, nullptr },
+        { "atk26_EzStateId", field_type::u16, offsetof(T, atk26_EzStateId), 2, 1, nullptr },
+        { "atk27_EzStateId", field_type::u16, offsetof(T, atk27_EzStateId), 2, 1, nullptr },
+        { "atk28_EzStateId", field_type::u16, offsetof(T, atk28_EzStateId), 2, 1, nullptr },
+        { "atk29_EzStateId", field_type::u16, offsetof(T, atk29_EzStateId), 2, 1, nullptr },
+        { "atk0_MinDist", field_type::u16, offsetof(T, atk0_MinDist), 2, 1, nullptr },
+        { "atk1_MinDist", field_type::u16, offsetof(T, atk1_MinDist), 2, 1, nullptr },
+        { "atk2_MinDist", field_type::u16, offsetof(T, atk2_MinDist), 2, 1, nullptr },
+        { "atk3_MinDist", field_type::u16, offsetof(T, atk3_MinDist), 2, 1, nullptr },
+        { "atk4_MinDist", field_type::u16, offsetof(T, atk4_MinDist), 2, 1, nullptr },
+        { "atk5_MinDist", field_type::u16, offsetof(T, atk5_MinDist), 2, 1, nullptr },
+        { "atk6_MinDist", field_type::u16, offsetof(T, atk6_MinDist), 2, 1, nullptr },
+        { "atk7_MinDist", field_type::u16, offsetof(T, atk7_MinDist), 2, 1, nullptr },
+        { "atk8_MinDist", field_type::u16, offsetof(T, atk8_MinDist), 2, 1, nullptr },
+        { "atk9_MinDist", field_type::u16, offsetof(T, atk9_MinDist), 2, 1, nullptr },
+        { "atk10_MinDist", field_type::u16, offsetof(T, atk10_MinDist), 2, 1, nullptr },
+        { "atk11_MinDist", field_type::u16, offsetof(T, atk11_MinDist), 2, 1, nullptr },
+        { "atk12_MinDist", field_type::u16, offsetof(T, atk12_MinDist), 2, 1, nullptr },
+        { "atk13_MinDist", field_type::u16, offsetof(T, atk13_MinDist), 2, 1, nullptr },
+        { "atk14_MinDist", field_type::u16, offsetof(T, atk14_MinDist), 2, 1, nullptr },
+        { "atk15_MinDist", field_type::u16, offsetof(T, atk15_MinDist), 2, 1, nullptr },
+        { "atk16_MinDist", field_type::u16, offsetof(T, atk16_MinDist), 2, 1, nullptr },
+        { "atk17_MinDist", field_type::u16, offsetof(T, atk17_MinDist), 2, 1, nullptr },
+        { "atk18_MinDist", field_type::u16, offsetof(T, atk18_MinDist), 2, 1, nullptr },
+        { "atk19_MinDist", field_type::u16, offsetof(T, atk19_MinDist), 2, 1, nullptr },
+        { "atk20_MinDist", field_type::u16, offsetof(T, atk20_MinDist), 2, 1, nullptr },
+        { "atk21_MinDist", field_type::u16, offsetof(T, atk21_MinDist), 2, 1, nullptr },
+        { "atk22_MinDist", field_type::u16, offsetof(T, atk22_MinDist), 2, 1, nullptr },
+        { "atk23_MinDist", field_type::u16, offsetof(T, atk23_MinDist), 2, 1, nullptr },
+        { "atk24_MinDist", field_type::u16, offsetof(T, atk24_MinDist), 2, 1, nullptr },
+        { "atk25_MinDist", field_type::u16, offsetof(T, atk25_MinDist), 2, 1, nullptr },
+        { "atk26_MinDist", field_type::u16, offsetof(T, atk26_MinDist), 2, 1, nullptr },
+        { "atk27_MinDist", field_type::u16, offsetof(T, atk27_MinDist), 2, 1, nullptr },
+        { "atk28_MinDist", field_type::u16, offsetof(T, atk28_MinDist), 2, 1, nullptr },
+        { "atk29_MinDist", field_type::u16, offsetof(T, atk29_MinDist), 2, 1, nullptr },
+        { "atk0_MaxDist", field_type::u16, offsetof(T, atk0_MaxDist), 2, 1, nullptr },
+        { "atk1_MaxDist", field_type::u16, offsetof(T, atk1_MaxDist), 2, 1, nullptr },
+        { "atk2_MaxDist", field_type::u16, offsetof(T, atk2_MaxDist), 2, 1, nullptr },
+        { "atk3_MaxDist", field_type::u16, offsetof(T, atk3_MaxDist), 2, 1, nullptr },
+        { "atk4_MaxDist", field_type::u16, offsetof(T, atk4_MaxDist), 2, 1, nullptr },
+        { "atk5_MaxDist", field_type::u16, offsetof(T, atk5_MaxDist), 2, 1, nullptr },
+        { "atk6_MaxDist", field_type::u16, offsetof(T, atk6_MaxDist), 2, 1, nullptr },
+        { "atk7_MaxDist", field_type::u16, offsetof(T, atk7_MaxDist), 2, 1, nullptr },
+        { "atk8_MaxDist", field_type::u16, offsetof(T, atk8_MaxDist), 2, 1, nullptr },
+        { "atk9_MaxDist", field_type::u16, offsetof(T, atk9_MaxDist), 2, 1, nullptr },
+        { "atk10_MaxDist", field_type::u16, offsetof(T, atk10_MaxDist), 2, 1, nullptr },
+        { "atk11_MaxDist", field_type::u16, offsetof(T, atk11_MaxDist), 2, 1, nullptr },
+        { "atk12_MaxDist", field_type::u16, offsetof(T, atk12_MaxDist), 2, 1, nullptr },
+        { "atk13_MaxDist", field_type::u16, offsetof(T, atk13_MaxDist), 2, 1, nullptr },
+        { "atk14_MaxDist", field_type::u16, offsetof(T, atk14_MaxDist), 2, 1, nullptr },
+        { "atk15_MaxDist", field_type::u16, offsetof(T, atk15_MaxDist), 2, 1, nullptr },
+        { "atk16_MaxDist", field_type::u16, offsetof(T, atk16_MaxDist), 2, 1, nullptr },
+        { "atk17_MaxDist", field_type::u16, offsetof(T, atk17_MaxDist), 2, 1, nullptr },
+        { "atk18_MaxDist", field_type::u16, offsetof(T, atk18_MaxDist), 2, 1, nullptr },
+        { "atk19_MaxDist", field_type::u16, offsetof(T, atk19_MaxDist), 2, 1, nullptr },
+        { "atk20_MaxDist", field_type::u16, offsetof(T, atk20_MaxDist), 2, 1, nullptr },
+        { "atk21_MaxDist", field_type::u16, offsetof(T, atk21_MaxDist), 2, 1, nullptr },
+        { "atk22_MaxDist", field_type::u16, offsetof(T, atk22_MaxDist), 2, 1, nullptr },
+        { "atk23_MaxDist", field_type::u16, offsetof(T, atk23_MaxDist), 2, 1, nullptr },
+        { "atk24_MaxDist", field_type::u16, offsetof(T, atk24_MaxDist), 2, 1, nullptr },
+        { "atk25_MaxDist", field_type::u16, offsetof(T, atk25_MaxDist), 2, 1, nullptr },
+        { "atk26_MaxDist", field_type::u16, offsetof(T, atk26_MaxDist), 2, 1, nullptr },
+        { "atk27_MaxDist", field_type::u16, offsetof(T, atk27_MaxDist), 2, 1, nullptr },
+        { "atk28_MaxDist", field_type::u16, offsetof(T, atk28_MaxDist), 2, 1, nullptr },
+        { "atk29_MaxDist", field_type::u16, offsetof(T, atk29_MaxDist), 2, 1, nullptr },
+        { "atk0_AtkDistType", field_type::u8, 180, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk0_AtkDistType; } },
+        { "atk1_AtkDistType", field_type::u8, 180, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk1_AtkDistType; } },
+        { "atk2_AtkDistType", field_type::u8, 181, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk2_AtkDistType; } },
+        { "atk3_AtkDistType", field_type::u8, 181, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk3_AtkDistType; } },
+        { "atk4_AtkDistType", field_type::u8, 182, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk4_AtkDistType; } },
+        { "atk5_AtkDistType", field_type::u8, 182, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk5_AtkDistType; } },
+        { "atk6_AtkDistType", field_type::u8, 183, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk6_AtkDistType; } },
+        { "atk7_AtkDistType", field_type::u8, 183, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk7_AtkDistType; } },
+        { "atk8_AtkDistType", field_type::u8, 184, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk8_AtkDistType; } },
+        { "atk9_AtkDistType", field_type::u8, 184, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk9_AtkDistType; } },
+        { "atk10_AtkDistType", field_type::u8, 185, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk10_AtkDistType; } },
+        { "atk11_AtkDistType", field_type::u8, 185, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk11_AtkDistType; } },
+        { "atk12_AtkDistType", field_type::u8, 186, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk12_AtkDistType; } },
+        { "atk13_AtkDistType", field_type::u8, 186, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk13_AtkDistType; } },
+        { "atk14_AtkDistType", field_type::u8, 187, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk14_AtkDistType; } },
+        { "atk15_AtkDistType", field_type::u8, 187, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk15_AtkDistType; } },
+        { "atk16_AtkDistType", field_type::u8, 188, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk16_AtkDistType; } },
+        { "atk17_AtkDistType", field_type::u8, 188, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk17_AtkDistType; } },
+        { "atk18_AtkDistType", field_type::u8, 189, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk18_AtkDistType; } },
+        { "atk19_AtkDistType", field_type::u8, 189, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk19_AtkDistType; } },
+        { "atk20_AtkDistType", field_type::u8, 190, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk20_AtkDistType; } },
+        { "atk21_AtkDistType", field_type::u8, 190, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk21_AtkDistType; } },
+        { "atk22_AtkDistType", field_type::u8, 191, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk22_AtkDistType; } },
+        { "atk23_AtkDistType", field_type::u8, 191, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk23_AtkDistType; } },
+        { "atk24_AtkDistType", field_type::u8, 192, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk24_AtkDistType; } },
+        { "atk25_AtkDistType", field_type::u8, 192, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk25_AtkDistType; } },
+        { "atk26_AtkDistType", field_type::u8, 193, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk26_AtkDistType; } },
+        { "atk27_AtkDistType", field_type::u8, 193, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk27_AtkDistType; } },
+        { "atk28_AtkDistType", field_type::u8, 194, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk28_AtkDistType; } },
+        { "atk29_AtkDistType", field_type::u8, 194, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->atk29_AtkDistType; } },
+        { "pad0", field_type::u8, offsetof(T, pad0), 1, 13, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk0_EzStateId) == 0);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk1_EzStateId) == 2);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk2_EzStateId) == 4);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk3_EzStateId) == 6);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk4_EzStateId) == 8);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk5_EzStateId) == 10);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk6_EzStateId) == 12);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk7_EzStateId) == 14);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk8_EzStateId) == 16);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk9_EzStateId) == 18);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk10_EzStateId) == 20);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk11_EzStateId) == 22);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk12_EzStateId) == 24);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk13_EzStateId) == 26);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk14_EzStateId) == 28);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk15_EzStateId) == 30);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk16_EzStateId) == 32);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk17_EzStateId) == 34);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk18_EzStateId) == 36);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk19_EzStateId) == 38);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk20_EzStateId) == 40);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk21_EzStateId) == 42);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk22_EzStateId) == 44);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk23_EzStateId) == 46);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk24_EzStateId) == 48);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk25_EzStateId) == 50);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk26_EzStateId) == 52);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk27_EzStateId) == 54);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk28_EzStateId) == 56);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk29_EzStateId) == 58);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk0_MinDist) == 60);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk1_MinDist) == 62);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk2_MinDist) == 64);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk3_MinDist) == 66);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk4_MinDist) == 68);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk5_MinDist) == 70);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk6_MinDist) == 72);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk7_MinDist) == 74);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk8_MinDist) == 76);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk9_MinDist) == 78);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk10_MinDist) == 80);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk11_MinDist) == 82);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk12_MinDist) == 84);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk13_MinDist) == 86);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk14_MinDist) == 88);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk15_MinDist) == 90);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk16_MinDist) == 92);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk17_MinDist) == 94);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk18_MinDist) == 96);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk19_MinDist) == 98);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk20_MinDist) == 100);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk21_MinDist) == 102);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk22_MinDist) == 104);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk23_MinDist) == 106);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk24_MinDist) == 108);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk25_MinDist) == 110);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk26_MinDist) == 112);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk27_MinDist) == 114);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk28_MinDist) == 116);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk29_MinDist) == 118);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk0_MaxDist) == 120);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk1_MaxDist) == 122);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk2_MaxDist) == 124);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk3_MaxDist) == 126);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk4_MaxDist) == 128);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk5_MaxDist) == 130);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk6_MaxDist) == 132);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk7_MaxDist) == 134);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk8_MaxDist) == 136);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk9_MaxDist) == 138);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk10_MaxDist) == 140);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk11_MaxDist) == 142);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk12_MaxDist) == 144);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk13_MaxDist) == 146);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk14_MaxDist) == 148);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk15_MaxDist) == 150);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk16_MaxDist) == 152);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk17_MaxDist) == 154);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk18_MaxDist) == 156);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk19_MaxDist) == 158);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk20_MaxDist) == 160);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk21_MaxDist) == 162);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk22_MaxDist) == 164);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk23_MaxDist) == 166);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk24_MaxDist) == 168);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk25_MaxDist) == 170);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk26_MaxDist) == 172);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk27_MaxDist) == 174);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk28_MaxDist) == 176);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, atk29_MaxDist) == 178);
+static_assert(offsetof(paramdef::AI_ANIM_TBL_PARAM, pad0) == 195);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,116 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../AI_ATTACK_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::AI_ATTACK_PARAM_ST> {
+    using T = paramdef::AI_ATTACK_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 47> fields = {{
+        { "attackTableId", field_type::s32, offsetof(T, attackTableId), 4, 1, nullptr },
+        { "attackId", field_type::s32, offsetof(T, attackId), 4, 1, nullptr },
+        { "successDistance", field_type::f32, offsetof(T, successDistance), 4, 1, nullptr },
+        { "turnTimeBeforeAttack", field_type::f32, offsetof(T, turnTimeBeforeAttack), 4, 1, nullptr },
+        { "frontAngleRange", field_type::s16, offsetof(T, frontAngleRange), 2, 1, nullptr },
+        { "upAngleThreshold", field_type::s16, offsetof(T, upAngleThreshold), 2, 1, nullptr },
+        { "downAngleThershold", field_type::s16, offsetof(T, downAngleThershold), 2, 1, nullptr },
+        { "isFirstAttack", field_type::boolean, offsetof(T, isFirstAttack), 1, 1, nullptr },
+        { "doesSelectOnOutRange", field_type::boolean, offsetof(T, doesSelectOnOutRange), 1, 1, nullptr },
+        { "minOptimalDistance", field_type::f32, offsetof(T, minOptimalDistance), 4, 1, nullptr },
+        { "maxOptimalDistance", field_type::f32, offsetof(T, maxOptimalDistance), 4, 1, nullptr },
+        { "baseDirectionForOptimalAngle1", field_type::s16, offsetof(T, baseDirectionForOptimalAngle1), 2, 1, nullptr },
+        { "optimalAttackAngleRange1", field_type::s16, offsetof(T, optimalAttackAngleRange1), 2, 1, nullptr },
+        { "baseDirectionForOptimalAngle2", field_type::s16, offsetof(T, baseDirectionForOptimalAngle2), 2, 1, nullptr },
+        { "optimalAttackAngleRange2", field_type::s16, offsetof(T, optimalAttackAngleRange2), 2, 1, nullptr },
+        { "intervalForExec", field_type::f32, offsetof(T, intervalForExec), 4, 1, nullptr },
+        { "selectionTendency", field_type::f32, offsetof(T, selectionTendency), 4, 1, nullptr },
+        { "shortRangeTendency", field_type::f32, offsetof(T, shortRangeTendency), 4, 1, nullptr },
+        { "middleRangeTendency", field_type::f32, offsetof(T, middleRangeTendency), 4, 1, nullptr },
+        { "farRangeTendency", field_type::f32, offsetof(T, farRangeTendency), 4, 1, nullptr },
+        { "outRangeTendency", field_type::f32, offsetof(T, outRangeTendency), 4, 1, nullptr },
+        { "deriveAttackId1", field_type::s32, offsetof(T, deriveAttackId1), 4, 1, nullptr },
+        { "deriveAttackId2", field_type::s32, offsetof(T, deriveAttackId2), 4, 1, nullptr },
+        { "deriveAttackId3", field_type::s32, offsetof(T, deriveAttackId3), 4, 1, nullptr },
+        { "deriveAttackId4", field_type::s32, offsetof(T, deriveAttackId4), 4, 1, nullptr },
+        { "deriveAttackId5", field_type::s32, offsetof(T, deriveAttackId5), 4, 1, nullptr },
+        { "deriveAttackId6", field_type::s32, offsetof(T, deriveAttackId6), 4, 1, nullptr },
+        { "deriveAttackId7", field_type::s32, offsetof(T, deriveAttackId7), 4, 1, nullptr },
+        { "deriveAttackId8", field_type::s32, offsetof(T, deriveAttackId8), 4, 1, nullptr },
+        { "deriveAttackId9", field_type::s32, offsetof(T, deriveAttackId9), 4, 1, nullptr },
+        { "deriveAttackId10", field_type::s32, offsetof(T, deriveAttackId10), 4, 1, nullptr },
+        { "deriveAttackId11", field_type::s32, offsetof(T, deriveAttackId11), 4, 1, nullptr },
+        { "deriveAttackId12", field_type::s32, offsetof(T, deriveAttackId12), 4, 1, nullptr },
+        { "deriveAttackId13", field_type::s32, offsetof(T, deriveAttackId13), 4, 1, nullptr },
+        { "deriveAttackId14", field_type::s32, offsetof(T, deriveAttackId14), 4, 1, nullptr },
+        { "deriveAttackId15", field_type::s32, offsetof(T, deriveAttackId15), 4, 1, nullptr },
+        { "deriveAttackId16", field_type::s32, offsetof(T, deriveAttackId16), 4, 1, nullptr },
+        { "goalLifeMin", field_type::f32, offsetof(T, goalLifeMin), 4, 1, nullptr },
+        { "goalLifeMax", field_type::f32, offsetof(T, goalLifeMax), 4, 1, nullptr },
+        { "doesSelectOnInnerRange", field_type::boolean, offsetof(T, doesSelectOnInnerRange), 1, 1, nullptr },
+        { "enableAttackOnBattleStart", field_type::boolean, offsetof(T, enableAttackOnBattleStart), 1, 1, nullptr },
+        { "doesSelectOnTargetDown", field_type::boolean, offsetof(T, doesSelectOnTargetDown), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 1, nullptr },
+        { "minArriveDistance", field_type::f32, offsetof(T, minArriveDistance), 4, 1, nullptr },
+        { "maxArriveDistance", field_type::f32, offsetof(T, maxArriveDistance), 4, 1, nullptr },
+        { "comboExecDistance", field_type::f32, offsetof(T, comboExecDistance), 4, 1, nullptr },
+        { "comboExecRange", field_type::f32, offsetof(T, comboExecRange), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, attackTableId) == 0);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, attackId) == 4);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, successDistance) == 8);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, turnTimeBeforeAttack) == 12);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, frontAngleRange) == 16);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, upAngleThreshold) == 18);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, downAngleThershold) == 20);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, isFirstAttack) == 22);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, doesSelectOnOutRange) == 23);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, minOptimalDistance) == 24);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, maxOptimalDistance) == 28);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, baseDirectionForOptimalAngle1) == 32);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, optimalAttackAngleRange1) == 34);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, baseDirectionForOptimalAngle2) == 36);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, optimalAttackAngleRange2) == 38);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, intervalForExec) == 40);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, selectionTendency) == 44);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, shortRangeTendency) == 48);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, middleRangeTendency) == 52);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, farRangeTendency) == 56);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, outRangeTendency) == 60);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId1) == 64);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId2) == 68);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId3) == 72);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId4) == 76);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId5) == 80);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId6) == 84);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId7) == 88);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId8) == 92);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId9) == 96);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId10) == 100);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId11) == 104);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId12) == 108);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId13) == 112);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId14) == 116);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId15) == 120);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, deriveAttackId16) == 124);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, goalLifeMin) == 128);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, goalLifeMax) == 132);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, doesSelectOnInnerRange) == 136);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, enableAttackOnBattleStart) == 137);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, doesSelectOnTargetDown) == 138);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, pad1) == 139);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, minArriveDistance) == 140);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, maxArriveDistance) == 144);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, comboExecDistance) == 148);
+static_assert(offsetof(paramdef::AI_ATTACK_PARAM_ST, comboExecRange) == 152);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,224 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../AI_ODDS_PARAM.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::AI_ODDS_PARAM> {
+    using T = paramdef::AI_ODDS_PARAM;
+
+    static constexpr std::array<field_descriptor, 101> fields = {{
+        { "act0", field_type::u8, offsetof(T, act0), 1, 1, nullptr },
+        { "act1", field_type::u8, offsetof(T, act1), 1, 1, nullptr },
+        { "act2", field_type::u8, offsetof(T, act2), 1, 1, nullptr },
+        { "act3", field_type::u8, offsetof(T, act3), 1, 1, nullptr },
+        { "act4", field_type::u8, offsetof(T, act4), 1, 1, nullptr },
+        { "act5", field_type::u8, offsetof(T, act5), 1, 1, nullptr },
+        { "act6", field_type::u8, offsetof(T, act6), 1, 1, nullptr },
+        { "act7", field_type::u8, offsetof(T, act7), 1, 1, nullptr },
+        { "act8", field_type::u8, offsetof(T, act8), 1, 1, nullptr },
+        { "act9", field_type::u8, offsetof(T, act9), 1, 1, nullptr },
+        { "act10", field_type::u8, offsetof(T, act10), 1, 1, nullptr },
+        { "act11", field_type::u8, offsetof(T, act11), 1, 1, nullptr },
+        { "act12", field_type::u8, offsetof(T, act12), 1, 1, nullptr },
+        { "act13", field_type::u8, offsetof(T, act13), 1, 1, nullptr },
+        { "act14", field_type::u8, offsetof(T, act14), 1, 1, nullptr },
+        { "act15", field_type::u8, offsetof(T, act15), 1, 1, nullptr },
+        { "act16", field_type::u8, offsetof(T, act16), 1, 1, nullptr },
+        { "act17", field_type::u8, offsetof(T, act17), 1, 1, nullptr },
+        { "act18", field_type::u8, offsetof(T, act18), 1, 1, nullptr },
+        { "act19", field_type::u8, offsetof(T, act19), 1, 1, nullptr },
+        { "act20", field_type::u8, offsetof(T, act20), 1, 1, nullptr },
+        { "act21", field_type::u8, offsetof(T, act21), 1, 1, nullptr },
+        { "act22", field_type::u8, offsetof(T, act22), 1, 1, nullptr },
+        { "act23", field_type::u8, offsetof(T, act23), 1, 1, nullptr },
+        { "act24", field_type::u8, offsetof(T, act24), 1, 1, nullptr },
+        { "act25", field_type::u8, offsetof(T, act25), 1, 1, nullptr },
+        { "act26", field_type::u8, offsetof(T, act26), 1, 1, nullptr },
+        { "act27", field_type::u8, offsetof(T, act27), 1, 1, nullptr },
+        { "act28", field_type::u8, offsetof(T, act28), 1, 1, nullptr },
+        { "act29", field_type::u8, offsetof(T, act29), 1, 1, nullptr },
+        { "act30", field_type::u8, offsetof(T, act30), 1, 1, nullptr },
+        { "act31", field_type::u8, offsetof(T, act31), 1, 1, nullptr },
+        { "act32", field_type::u8, offsetof(T, act32), 1, 1, nullptr },
+        { "act33", field_type::u8, offsetof(T, act33), 1, 1, nullptr },
+        { "act34", field_type::u8, offsetof(T, act34), 1, 1, nullptr },
+        { "act35", field_type::u8, offsetof(T, act35), 1, 1, nullptr },
+        { "act36", field_type::u8, offsetof(T, act36), 1, 1, nullptr },
+        { "act37", field_type::u8, offsetof(T, act37), 1, 1, nullptr },
+        { "act38", field_type::u8, offsetof(T, act38), 1, 1, nullptr },
+        { "act39", field_type::u8, offsetof(T, act39), 1, 1, nullptr },
+        { "act40", field_type::u8, offsetof(T, act40), 1, 1, nullptr },
+        { "act41", field_type::u8, offsetof(T, act41), 1, 1, nullptr },
+        { "act42", field_type::u8, offsetof(T, act42), 1, 1, nullptr },
+        { "act43", field_type::u8, offsetof(T, act43), 1, 1, nullptr },
+        { "act44", field_type::u8, offsetof(T, act44), 1, 1, nullptr },
+        { "act45", field_type::u8, offsetof(T, act45), 1, 1, nullptr },
+        { "act46", field_type::u8, offsetof(T, act46), 1, 1, nullptr },
+        { "act47", field_type::u8, offsetof(T, act47), 1, 1, nullptr },
+        { "act48", field_type::u8, offsetof(T, act48), 1, 1, nullptr },
+        { "act49", field_type::u8, offsetof(T, act49), 1, 1, nullptr },
+        { "act50", field_type::u8, offsetof(T, act50), 1, 1, nullptr },
+        { "act51", field_type::u8, offsetof(T, act51), 1, 1, nullptr },
+        { "act52", field_type::u8, offsetof(T, act52), 1, 1, nullptr },
+        { "act53", field_type::u8, offsetof(T, act53), 1, 1, nullptr },
+        { "act54", field_type::u8, offsetof(T, act54), 1, 1, nullptr },
+        { "act55", field_type::u8, offsetof(T, act55), 1, 1, nullptr },
+        { "act56", field_type::u8, offsetof(T, act56), 1, 1, nullptr },
+        { "act57", field_type::u8, offsetof(T, act57), 1, 1, nullptr },
+        { "act58", field_type::u8, offsetof(T, act58), 1, 1, nullptr },
+        { "act59", field_type::u8, offsetof(T, act59), 1, 1, nullptr },
+        { "act60", field_type::u8, offsetof(T, act60), 1, 1, nullptr },
+        { "act61", field_type::u8, offsetof(T, act61), 1, 1, nullptr },
+        { "act62", field_type::u8, offsetof(T, act62), 1, 1, nullptr },
+        { "act63", field_type::u8, offsetof(T, act63), 1, 1, nullptr },
+        { "act64", field_type::u8, offsetof(T, act64), 1, 1, nullptr },
+        { "act65", field_type::u8, offsetof(T, act65), 1, 1, nullptr },
+        { "act66", field_type::u8, offsetof(T, act66), 1, 1, nullptr },
+        { "act67", field_type::u8, offsetof(T, act67), 1, 1, nullptr },
+        { "act68", field_type::u8, offsetof(T, act68), 1, 1, nullptr },
+        { "act69", field_type::u8, offsetof(T, act69), 1, 1, nullptr },
+        { "act70", field_type::u8, offsetof(T, act70), 1, 1, nullptr },
+        { "act71", field_type::u8, offsetof(T, act71), 1, 1, nullptr },
+        { "act72", field_type::u8, offsetof(T, act72), 1, 1, nullptr },
+        { "act73", field_type::u8, offsetof(T, act73), 1, 1, nullptr },
+        { "act74", field_type::u8, offsetof(T, act74), 1, 1, nullptr },
+        { "act75", field_type::u8, offsetof(T, act75), 1, 1, nullptr },
+        { "act76", field_type::u8, offsetof(T, act76), 1, 1, nullptr },
+        { "act77", field_type::u8, offsetof(T, act77), 1, 1, nullptr },
+        { "act78", field_type::u8, offsetof(T, act78), 1, 1, nullptr },
+        { "act79", field_type::u8, offsetof(T, act79), 1, 1, nullptr },
+        { "act80", field_type::u8, offsetof(T, act80), 1, 1, nullptr },
+        { "act81", field_type::u8, offsetof(T, act81), 1, 1, nullptr },
+        { "act82", field_type::u8, offsetof(T, act82), 1, 1, nullptr },
+        { "act83", field_type::u8, offsetof(T, act83), 1, 1, nullptr },
+        { "act84", field_type::u8, offsetof(T, act84), 1, 1, nullptr },
+        { "act85", field_type::u8, offsetof(T, act85), 1, 1, nullptr },
+        { "act86", field_type::u8, offsetof(T, act86), 1, 1, nullptr },
+        { "act87", field_type::u8, offsetof(T, act87), 1, 1, nullptr },
+        { "act88", field_type::u8, offsetof(T, act88), 1, 1, nullptr },
+        { "act89", field_type::u8, offsetof(T, act89), 1, 1, nullptr },
+        { "act90", field_type::u8, offsetof(T, act90), 1, 1, nullptr },
+        { "act91", field_type::u8, offsetof(T, act91), 1, 1, nullptr },
+        { "act92", field_type::u8, offsetof(T, act92), 1, 1, nullptr },
+        { "act93", field_type::u8, offsetof(T, act93), 1, 1, nullptr },
+        { "act94", field_type::u8, offsetof(T, act94), 1, 1, nullptr },
+        { "act95", field_type::u8, offsetof(T, act95), 1, 1, nullptr },
+        { "act96", field_type::u8, offsetof(T, act96), 1, 1, nullptr },
+        { "act97", field_type::u8, offsetof(T, act97), 1, 1, nullptr },
+        { "act98", field_type::u8, offsetof(T, act98), 1, 1, nullptr },
+        { "act99", field_type::u8, offsetof(T, act99), 1, 1, nullptr },
+        { "pad0", field_type::u8, offsetof(T, pad0), 1, 12, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act0) == 0);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act1) == 1);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act2) == 2);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act3) == 3);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act4) == 4);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act5) == 5);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act6) == 6);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act7) == 7);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act8) == 8);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act9) == 9);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act10) == 10);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act11) == 11);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act12) == 12);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act13) == 13);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act14) == 14);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act15) == 15);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act16) == 16);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act17) == 17);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act18) == 18);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act19) == 19);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act20) == 20);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act21) == 21);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act22) == 22);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act23) == 23);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act24) == 24);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act25) == 25);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act26) == 26);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act27) == 27);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act28) == 28);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act29) == 29);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act30) == 30);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act31) == 31);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act32) == 32);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act33) == 33);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act34) == 34);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act35) == 35);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act36) == 36);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act37) == 37);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act38) == 38);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act39) == 39);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act40) == 40);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act41) == 41);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act42) == 42);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act43) == 43);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act44) == 44);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act45) == 45);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act46) == 46);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act47) == 47);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act48) == 48);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act49) == 49);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act50) == 50);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act51) == 51);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act52) == 52);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act53) == 53);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act54) == 54);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act55) == 55);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act56) == 56);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act57) == 57);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act58) == 58);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act59) == 59);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act60) == 60);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act61) == 61);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act62) == 62);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act63) == 63);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act64) == 64);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act65) == 65);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act66) == 66);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act67) == 67);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act68) == 68);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act69) == 69);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act70) == 70);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act71) == 71);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act72) == 72);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act73) == 73);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act74) == 74);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act75) == 75);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act76) == 76);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act77) == 77);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act78) == 78);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act79) == 79);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act80) == 80);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act81) == 81);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act82) == 82);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act83) == 83);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act84) == 84);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act85) == 85);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act86) == 86);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act87) == 87);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act88) == 88);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act89) == 89);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act90) == 90);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act91) == 91);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act92) == 92);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act93) == 93);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act94) == 94);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act95) == 95);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act96) == 96);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act97) == 97);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act98) == 98);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, act99) == 99);
+static_assert(offsetof(paramdef::AI_ODDS_PARAM, pad0) == 100);
+
+}; // namespace params
+}; // namespace from
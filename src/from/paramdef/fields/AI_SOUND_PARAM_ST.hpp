@@ -0,0 +1,48 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../AI_SOUND_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::AI_SOUND_PARAM_ST> {
+    using T = paramdef::AI_SOUND_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 15> fields = {{
+        { "radius", field_type::f32, offsetof(T, radius), 4, 1, nullptr },
+        { "lifeFrame", field_type::f32, offsetof(T, lifeFrame), 4, 1, nullptr },
+        { "bSpEffectEnable", field_type::boolean, offsetof(T, bSpEffectEnable), 1, 1, nullptr },
+        { "type", field_type::u8, offsetof(T, type), 1, 1, nullptr },
+        { "opposeTarget", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->opposeTarget; } },
+        { "friendlyTarget", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->friendlyTarget; } },
+        { "selfTarget", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->selfTarget; } },
+        { "disableOnTargetPCompany", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableOnTargetPCompany; } },
+        { "rank", field_type::u8, offsetof(T, rank), 1, 1, nullptr },
+        { "forgetTime", field_type::f32, offsetof(T, forgetTime), 4, 1, nullptr },
+        { "priority", field_type::s32, offsetof(T, priority), 4, 1, nullptr },
+        { "soundBehaviorId", field_type::s32, offsetof(T, soundBehaviorId), 4, 1, nullptr },
+        { "aiSoundLevel", field_type::u8, offsetof(T, aiSoundLevel), 1, 1, nullptr },
+        { "replaningState", field_type::u8, offsetof(T, replaningState), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 6, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, radius) == 0);
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, lifeFrame) == 4);
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, bSpEffectEnable) == 8);
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, type) == 9);
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, rank) == 11);
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, forgetTime) == 12);
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, priority) == 16);
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, soundBehaviorId) == 20);
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, aiSoundLevel) == 24);
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, replaningState) == 25);
+static_assert(offsetof(paramdef::AI_SOUND_PARAM_ST, pad1) == 26);
+
+}; // namespace params
+}; // namespace from
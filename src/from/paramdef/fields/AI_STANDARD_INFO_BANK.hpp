@@ -0,0 +1,102 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../AI_STANDARD_INFO_BANK.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::AI_STANDARD_INFO_BANK> {
+    using T = paramdef::AI_STANDARD_INFO_BANK;
+
+    static constexpr std::array<field_descriptor, 40> fields = {{
+        { "RadarRange", field_type::u16, offsetof(T, RadarRange), 2, 1, nullptr },
+        { "RadarAngleX", field_type::u8, offsetof(T, RadarAngleX), 1, 1, nullptr },
+        { "RadarAngleY", field_type::u8, offsetof(T, RadarAngleY), 1, 1, nullptr },
+        { "TerritorySize", field_type::u16, offsetof(T, TerritorySize), 2, 1, nullptr },
+        { "ThreatBeforeAttackRate", field_type::u8, offsetof(T, ThreatBeforeAttackRate), 1, 1, nullptr },
+        { "ForceThreatOnFirstLocked", field_type::boolean, offsetof(T, ForceThreatOnFirstLocked), 1, 1, nullptr },
+        { "reserve0", field_type::u8, offsetof(T, reserve0), 1, 24, nullptr },
+        { "Attack1_Distance", field_type::u16, offsetof(T, Attack1_Distance), 2, 1, nullptr },
+        { "Attack1_Margin", field_type::u16, offsetof(T, Attack1_Margin), 2, 1, nullptr },
+        { "Attack1_Rate", field_type::u8, offsetof(T, Attack1_Rate), 1, 1, nullptr },
+        { "Attack1_ActionID", field_type::u8, offsetof(T, Attack1_ActionID), 1, 1, nullptr },
+        { "Attack1_DelayMin", field_type::u8, offsetof(T, Attack1_DelayMin), 1, 1, nullptr },
+        { "Attack1_DelayMax", field_type::u8, offsetof(T, Attack1_DelayMax), 1, 1, nullptr },
+        { "Attack1_ConeAngle", field_type::u8, offsetof(T, Attack1_ConeAngle), 1, 1, nullptr },
+        { "reserve10", field_type::u8, offsetof(T, reserve10), 1, 7, nullptr },
+        { "Attack2_Distance", field_type::u16, offsetof(T, Attack2_Distance), 2, 1, nullptr },
+        { "Attack2_Margin", field_type::u16, offsetof(T, Attack2_Margin), 2, 1, nullptr },
+        { "Attack2_Rate", field_type::u8, offsetof(T, Attack2_Rate), 1, 1, nullptr },
+        { "Attack2_ActionID", field_type::u8, offsetof(T, Attack2_ActionID), 1, 1, nullptr },
+        { "Attack2_DelayMin", field_type::u8, offsetof(T, Attack2_DelayMin), 1, 1, nullptr },
+        { "Attack2_DelayMax", field_type::u8, offsetof(T, Attack2_DelayMax), 1, 1, nullptr },
+        { "Attack2_ConeAngle", field_type::u8, offsetof(T, Attack2_ConeAngle), 1, 1, nullptr },
+        { "reserve11", field_type::u8, offsetof(T, reserve11), 1, 7, nullptr },
+        { "Attack3_Distance", field_type::u16, offsetof(T, Attack3_Distance), 2, 1, nullptr },
+        { "Attack3_Margin", field_type::u16, offsetof(T, Attack3_Margin), 2, 1, nullptr },
+        { "Attack3_Rate", field_type::u8, offsetof(T, Attack3_Rate), 1, 1, nullptr },
+        { "Attack3_ActionID", field_type::u8, offsetof(T, Attack3_ActionID), 1, 1, nullptr },
+        { "Attack3_DelayMin", field_type::u8, offsetof(T, Attack3_DelayMin), 1, 1, nullptr },
+        { "Attack3_DelayMax", field_type::u8, offsetof(T, Attack3_DelayMax), 1, 1, nullptr },
+        { "Attack3_ConeAngle", field_type::u8, offsetof(T, Attack3_ConeAngle), 1, 1, nullptr },
+        { "reserve12", field_type::u8, offsetof(T, reserve12), 1, 7, nullptr },
+        { "Attack4_Distance", field_type::u16, offsetof(T, Attack4_Distance), 2, 1, nullptr },
+        { "Attack4_Margin", field_type::u16, offsetof(T, Attack4_Margin), 2, 1, nullptr },
+        { "Attack4_Rate", field_type::u8, offsetof(T, Attack4_Rate), 1, 1, nullptr },
+        { "Attack4_ActionID", field_type::u8, offsetof(T, Attack4_ActionID), 1, 1, nullptr },
+        { "Attack4_DelayMin", field_type::u8, offsetof(T, Attack4_DelayMin), 1, 1, nullptr },
+        { "Attack4_DelayMax", field_type::u8, offsetof(T, Attack4_DelayMax), 1, 1, nullptr },
+        { "Attack4_ConeAngle", field_type::u8, offsetof(T, Attack4_ConeAngle), 1, 1, nullptr },
+        { "reserve13", field_type::u8, offsetof(T, reserve13), 1, 7, nullptr },
+        { "reserve_last", field_type::u8, offsetof(T, reserve_last), 1, 32, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, RadarRange) == 0);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, RadarAngleX) == 2);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, RadarAngleY) == 3);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, TerritorySize) == 4);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, ThreatBeforeAttackRate) == 6);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, ForceThreatOnFirstLocked) == 7);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, reserve0) == 8);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack1_Distance) == 32);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack1_Margin) == 34);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack1_Rate) == 36);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack1_ActionID) == 37);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack1_DelayMin) == 38);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack1_DelayMax) == 39);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack1_ConeAngle) == 40);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, reserve10) == 41);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack2_Distance) == 48);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack2_Margin) == 50);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack2_Rate) == 52);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack2_ActionID) == 53);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack2_DelayMin) == 54);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack2_DelayMax) == 55);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack2_ConeAngle) == 56);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, reserve11) == 57);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack3_Distance) == 64);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack3_Margin) == 66);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack3_Rate) == 68);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack3_ActionID) == 69);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack3_DelayMin) == 70);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack3_DelayMax) == 71);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack3_ConeAngle) == 72);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, reserve12) == 73);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack4_Distance) == 80);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack4_Margin) == 82);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack4_Rate) == 84);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack4_ActionID) == 85);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack4_DelayMin) == 86);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack4_DelayMax) == 87);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, Attack4_ConeAngle) == 88);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, reserve13) == 89);
+static_assert(offsetof(paramdef::AI_STANDARD_INFO_BANK, reserve_last) == 96);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,245 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../ASSET_GEOMETORY_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::ASSET_GEOMETORY_PARAM_ST> {
+    using T = paramdef::ASSET_GEOMETORY_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 123> fields = {{
+        { "soundBankId", field_type::s32, offsetof(T, soundBankId), 4, 1, nullptr },
+        { "soundBreakSEId", field_type::s32, offsetof(T, soundBreakSEId), 4, 1, nullptr },
+        { "refDrawParamId", field_type::s32, offsetof(T, refDrawParamId), 4, 1, nullptr },
+        { "hitCreateType", field_type::s8, offsetof(T, hitCreateType), 1, 1, nullptr },
+        { "behaviorType", field_type::u8, offsetof(T, behaviorType), 1, 1, nullptr },
+        { "collisionType", field_type::u8, offsetof(T, collisionType), 1, 1, nullptr },
+        { "rainBlockingType", field_type::u8, offsetof(T, rainBlockingType), 1, 1, nullptr },
+        { "hp", field_type::s16, offsetof(T, hp), 2, 1, nullptr },
+        { "defense", field_type::u16, offsetof(T, defense), 2, 1, nullptr },
+        { "breakStopTime", field_type::f32, offsetof(T, breakStopTime), 4, 1, nullptr },
+        { "breakSfxId", field_type::s32, offsetof(T, breakSfxId), 4, 1, nullptr },
+        { "breakSfxCpId", field_type::s32, offsetof(T, breakSfxCpId), 4, 1, nullptr },
+        { "breakLandingSfxId", field_type::s32, offsetof(T, breakLandingSfxId), 4, 1, nullptr },
+        { "breakBulletBehaviorId", field_type::s32, offsetof(T, breakBulletBehaviorId), 4, 1, nullptr },
+        { "breakBulletCpId", field_type::s32, offsetof(T, breakBulletCpId), 4, 1, nullptr },
+        { "FragmentInvisibleWaitTime", field_type::f32, offsetof(T, FragmentInvisibleWaitTime), 4, 1, nullptr },
+        { "FragmentInvisibleTime", field_type::f32, offsetof(T, FragmentInvisibleTime), 4, 1, nullptr },
+        { "BreakAiSoundID", field_type::s32, offsetof(T, BreakAiSoundID), 4, 1, nullptr },
+        { "breakItemLotType", field_type::s8, offsetof(T, breakItemLotType), 1, 1, nullptr },
+        { "animBreakIdMax", field_type::u8, offsetof(T, animBreakIdMax), 1, 1, nullptr },
+        { "breakBulletAttributeDamageType", field_type::s8, offsetof(T, breakBulletAttributeDamageType), 1, 1, nullptr },
+        { "isBreakByPlayerCollide", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBreakByPlayerCollide; } },
+        { "isBreakByEnemyCollide", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBreakByEnemyCollide; } },
+        { "isBreak_ByChrRide", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBreak_ByChrRide; } },
+        { "isDisableBreakForFirstAppear", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableBreakForFirstAppear; } },
+        { "isAnimBreak", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnimBreak; } },
+        { "isDamageCover", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDamageCover; } },
+        { "isAttackBacklash", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAttackBacklash; } },
+        { "Reserve_2", field_type::u8, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->Reserve_2; } },
+        { "isLadder", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isLadder; } },
+        { "isMoveObj", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isMoveObj; } },
+        { "isSkydomeFlag", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSkydomeFlag; } },
+        { "isAnimPauseOnRemoPlay", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnimPauseOnRemoPlay; } },
+        { "isBurn", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBurn; } },
+        { "isEnableRepick", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableRepick; } },
+        { "isBreakOnPickUp", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBreakOnPickUp; } },
+        { "isBreakByHugeenemyCollide", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBreakByHugeenemyCollide; } },
+        { "navimeshFlag", field_type::u8, offsetof(T, navimeshFlag), 1, 1, nullptr },
+        { "burnBulletInterval", field_type::u16, offsetof(T, burnBulletInterval), 2, 1, nullptr },
+        { "clothUpdateDist", field_type::f32, offsetof(T, clothUpdateDist), 4, 1, nullptr },
+        { "lifeTime_forRuntimeCreate", field_type::f32, offsetof(T, lifeTime_forRuntimeCreate), 4, 1, nullptr },
+        { "contactSeId", field_type::s32, offsetof(T, contactSeId), 4, 1, nullptr },
+        { "repickAnimIdOffset", field_type::s32, offsetof(T, repickAnimIdOffset), 4, 1, nullptr },
+        { "windEffectRate_0", field_type::f32, offsetof(T, windEffectRate_0), 4, 1, nullptr },
+        { "windEffectRate_1", field_type::f32, offsetof(T, windEffectRate_1), 4, 1, nullptr },
+        { "windEffectType_0", field_type::u8, offsetof(T, windEffectType_0), 1, 1, nullptr },
+        { "windEffectType_1", field_type::u8, offsetof(T, windEffectType_1), 1, 1, nullptr },
+        { "overrideMaterialId", field_type::s16, offsetof(T, overrideMaterialId), 2, 1, nullptr },
+        { "autoCreateOffsetHeight", field_type::f32, offsetof(T, autoCreateOffsetHeight), 4, 1, nullptr },
+        { "burnTime", field_type::f32, offsetof(T, burnTime), 4, 1, nullptr },
+        { "burnBraekRate", field_type::f32, offsetof(T, burnBraekRate), 4, 1, nullptr },
+        { "burnSfxId", field_type::s32, offsetof(T, burnSfxId), 4, 1, nullptr },
+        { "burnSfxId_1", field_type::s32, offsetof(T, burnSfxId_1), 4, 1, nullptr },
+        { "burnSfxId_2", field_type::s32, offsetof(T, burnSfxId_2), 4, 1, nullptr },
+        { "burnSfxId_3", field_type::s32, offsetof(T, burnSfxId_3), 4, 1, nullptr },
+        { "burnSfxDelayTimeMin", field_type::f32, offsetof(T, burnSfxDelayTimeMin), 4, 1, nullptr },
+        { "burnSfxDelayTimeMin_1", field_type::f32, offsetof(T, burnSfxDelayTimeMin_1), 4, 1, nullptr },
+        { "burnSfxDelayTimeMin_2", field_type::f32, offsetof(T, burnSfxDelayTimeMin_2), 4, 1, nullptr },
+        { "burnSfxDelayTimeMin_3", field_type::f32, offsetof(T, burnSfxDelayTimeMin_3), 4, 1, nullptr },
+        { "burnSfxDelayTimeMax", field_type::f32, offsetof(T, burnSfxDelayTimeMax), 4, 1, nullptr },
+        { "burnSfxDelayTimeMax_1", field_type::f32, offsetof(T, burnSfxDelayTimeMax_1), 4, 1, nullptr },
+        { "burnSfxDelayTimeMax_2", field_type::f32, offsetof(T, burnSfxDelayTimeMax_2), 4, 1, nullptr },
+        { "burnSfxDelayTimeMax_3", field_type::f32, offsetof(T, burnSfxDelayTimeMax_3), 4, 1, nullptr },
+        { "burnBulletBehaviorId", field_type::s32, offsetof(T, burnBulletBehaviorId), 4, 1, nullptr },
+        { "burnBulletBehaviorId_1", field_type::s32, offsetof(T, burnBulletBehaviorId_1), 4, 1, nullptr },
+        { "burnBulletBehaviorId_2", field_type::s32, offsetof(T, burnBulletBehaviorId_2), 4, 1, nullptr },
+        { "burnBulletBehaviorId_3", field_type::s32, offsetof(T, burnBulletBehaviorId_3), 4, 1, nullptr },
+        { "burnBulletDelayTime", field_type::f32, offsetof(T, burnBulletDelayTime), 4, 1, nullptr },
+        { "paintDecalTargetTextureSize", field_type::u16, offsetof(T, paintDecalTargetTextureSize), 2, 1, nullptr },
+        { "navimeshFlag_after", field_type::u8, offsetof(T, navimeshFlag_after), 1, 1, nullptr },
+        { "camNearBehaviorType", field_type::s8, offsetof(T, camNearBehaviorType), 1, 1, nullptr },
+        { "breakItemLotParamId", field_type::s32, offsetof(T, breakItemLotParamId), 4, 1, nullptr },
+        { "pickUpActionButtonParamId", field_type::s32, offsetof(T, pickUpActionButtonParamId), 4, 1, nullptr },
+        { "pickUpItemLotParamId", field_type::s32, offsetof(T, pickUpItemLotParamId), 4, 1, nullptr },
+        { "autoDrawGroupBackFaceCheck", field_type::u8, offsetof(T, autoDrawGroupBackFaceCheck), 1, 1, nullptr },
+        { "autoDrawGroupDepthWrite", field_type::u8, offsetof(T, autoDrawGroupDepthWrite), 1, 1, nullptr },
+        { "autoDrawGroupShadowTest", field_type::u8, offsetof(T, autoDrawGroupShadowTest), 1, 1, nullptr },
+        { "debug_isHeightCheckEnable", field_type::boolean, offsetof(T, debug_isHeightCheckEnable), 1, 1, nullptr },
+        { "hitCarverCancelAreaFlag", field_type::u8, offsetof(T, hitCarverCancelAreaFlag), 1, 1, nullptr },
+        { "assetNavimeshNoCombine", field_type::u8, offsetof(T, assetNavimeshNoCombine), 1, 1, nullptr },
+        { "navimeshFlagApply", field_type::u8, offsetof(T, navimeshFlagApply), 1, 1, nullptr },
+        { "navimeshFlagApply_after", field_type::u8, offsetof(T, navimeshFlagApply_after), 1, 1, nullptr },
+        { "autoDrawGroupPassPixelNum", field_type::f32, offsetof(T, autoDrawGroupPassPixelNum), 4, 1, nullptr },
+        { "pickUpReplacementEventFlag", field_type::u32, offsetof(T, pickUpReplacementEventFlag), 4, 1, nullptr },
+        { "pickUpReplacementAnimIdOffset", field_type::s32, offsetof(T, pickUpReplacementAnimIdOffset), 4, 1, nullptr },
+        { "pickUpReplacementActionButtonParamId", field_type::s32, offsetof(T, pickUpReplacementActionButtonParamId), 4, 1, nullptr },
+        { "pickUpReplacementItemLotParamId", field_type::s32, offsetof(T, pickUpReplacementItemLotParamId), 4, 1, nullptr },
+        { "slidingBulletHitType", field_type::u8, offsetof(T, slidingBulletHitType), 1, 1, nullptr },
+        { "isBushesForDamage", field_type::boolean, offsetof(T, isBushesForDamage), 1, 1, nullptr },
+        { "penetrationBulletType", field_type::u8, offsetof(T, penetrationBulletType), 1, 1, nullptr },
+        { "Reserve_3", field_type::u8, offsetof(T, Reserve_3), 1, 1, nullptr },
+        { "Reserve_4", field_type::u8, offsetof(T, Reserve_4), 1, 4, nullptr },
+        { "soundBreakSECpId", field_type::s32, offsetof(T, soundBreakSECpId), 4, 1, nullptr },
+        { "debug_HeightCheckCapacityMin", field_type::f32, offsetof(T, debug_HeightCheckCapacityMin), 4, 1, nullptr },
+        { "debug_HeightCheckCapacityMax", field_type::f32, offsetof(T, debug_HeightCheckCapacityMax), 4, 1, nullptr },
+        { "repickActionButtonParamId", field_type::s32, offsetof(T, repickActionButtonParamId), 4, 1, nullptr },
+        { "repickItemLotParamId", field_type::s32, offsetof(T, repickItemLotParamId), 4, 1, nullptr },
+        { "repickReplacementAnimIdOffset", field_type::s32, offsetof(T, repickReplacementAnimIdOffset), 4, 1, nullptr },
+        { "repickReplacementActionButtonParamId", field_type::s32, offsetof(T, repickReplacementActionButtonParamId), 4, 1, nullptr },
+        { "repickReplacementItemLotParamId", field_type::s32, offsetof(T, repickReplacementItemLotParamId), 4, 1, nullptr },
+        { "noGenerateCarver", field_type::boolean, offsetof(T, noGenerateCarver), 1, 1, nullptr },
+        { "noHitHugeAfterBreak", field_type::boolean, offsetof(T, noHitHugeAfterBreak), 1, 1, nullptr },
+        { "isEnabledBreakSync", field_type::boolean, 258, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnabledBreakSync; } },
+        { "isHiddenOnRepick", field_type::boolean, 258, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHiddenOnRepick; } },
+        { "isCreateMultiPlayOnly", field_type::boolean, 258, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isCreateMultiPlayOnly; } },
+        { "isDisableBulletHitSfx", field_type::boolean, 258, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableBulletHitSfx; } },
+        { "isEnableSignPreBreak", field_type::boolean, 258, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableSignPreBreak; } },
+        { "isEnableSignPostBreak", field_type::boolean, 258, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableSignPostBreak; } },
+        { "Reserve_1", field_type::u8, 258, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->Reserve_1; } },
+        { "generateMultiForbiddenRegion", field_type::u8, offsetof(T, generateMultiForbiddenRegion), 1, 1, nullptr },
+        { "residentSeId0", field_type::s32, offsetof(T, residentSeId0), 4, 1, nullptr },
+        { "residentSeId1", field_type::s32, offsetof(T, residentSeId1), 4, 1, nullptr },
+        { "residentSeId2", field_type::s32, offsetof(T, residentSeId2), 4, 1, nullptr },
+        { "residentSeId3", field_type::s32, offsetof(T, residentSeId3), 4, 1, nullptr },
+        { "residentSeDmypolyId0", field_type::s16, offsetof(T, residentSeDmypolyId0), 2, 1, nullptr },
+        { "residentSeDmypolyId1", field_type::s16, offsetof(T, residentSeDmypolyId1), 2, 1, nullptr },
+        { "residentSeDmypolyId2", field_type::s16, offsetof(T, residentSeDmypolyId2), 2, 1, nullptr },
+        { "residentSeDmypolyId3", field_type::s16, offsetof(T, residentSeDmypolyId3), 2, 1, nullptr },
+        { "excludeActivateRatio_Xboxone_Grid", field_type::u8, offsetof(T, excludeActivateRatio_Xboxone_Grid), 1, 1, nullptr },
+        { "excludeActivateRatio_Xboxone_Legacy", field_type::u8, offsetof(T, excludeActivateRatio_Xboxone_Legacy), 1, 1, nullptr },
+        { "excludeActivateRatio_PS4_Grid", field_type::u8, offsetof(T, excludeActivateRatio_PS4_Grid), 1, 1, nullptr },
+        { "excludeActivateRatio_PS4_Legacy", field_type::u8, offsetof(T, excludeActivateRatio_PS4_Legacy), 1, 1, nullptr },
+        { "Reserve_0", field_type::u8, offsetof(T, Reserve_0), 1, 32, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, soundBankId) == 0);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, soundBreakSEId) == 4);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, refDrawParamId) == 8);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, hitCreateType) == 12);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, behaviorType) == 13);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, collisionType) == 14);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, rainBlockingType) == 15);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, hp) == 16);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, defense) == 18);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, breakStopTime) == 20);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, breakSfxId) == 24);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, breakSfxCpId) == 28);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, breakLandingSfxId) == 32);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, breakBulletBehaviorId) == 36);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, breakBulletCpId) == 40);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, FragmentInvisibleWaitTime) == 44);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, FragmentInvisibleTime) == 48);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, BreakAiSoundID) == 52);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, breakItemLotType) == 56);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, animBreakIdMax) == 57);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, breakBulletAttributeDamageType) == 58);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, navimeshFlag) == 61);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnBulletInterval) == 62);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, clothUpdateDist) == 64);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, lifeTime_forRuntimeCreate) == 68);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, contactSeId) == 72);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, repickAnimIdOffset) == 76);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, windEffectRate_0) == 80);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, windEffectRate_1) == 84);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, windEffectType_0) == 88);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, windEffectType_1) == 89);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, overrideMaterialId) == 90);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, autoCreateOffsetHeight) == 92);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnTime) == 96);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnBraekRate) == 100);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxId) == 104);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxId_1) == 108);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxId_2) == 112);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxId_3) == 116);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxDelayTimeMin) == 120);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxDelayTimeMin_1) == 124);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxDelayTimeMin_2) == 128);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxDelayTimeMin_3) == 132);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxDelayTimeMax) == 136);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxDelayTimeMax_1) == 140);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxDelayTimeMax_2) == 144);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnSfxDelayTimeMax_3) == 148);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnBulletBehaviorId) == 152);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnBulletBehaviorId_1) == 156);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnBulletBehaviorId_2) == 160);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnBulletBehaviorId_3) == 164);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, burnBulletDelayTime) == 168);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, paintDecalTargetTextureSize) == 172);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, navimeshFlag_after) == 174);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, camNearBehaviorType) == 175);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, breakItemLotParamId) == 176);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, pickUpActionButtonParamId) == 180);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, pickUpItemLotParamId) == 184);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, autoDrawGroupBackFaceCheck) == 188);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, autoDrawGroupDepthWrite) == 189);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, autoDrawGroupShadowTest) == 190);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, debug_isHeightCheckEnable) == 191);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, hitCarverCancelAreaFlag) == 192);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, assetNavimeshNoCombine) == 193);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, navimeshFlagApply) == 194);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, navimeshFlagApply_after) == 195);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, autoDrawGroupPassPixelNum) == 196);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, pickUpReplacementEventFlag) == 200);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, pickUpReplacementAnimIdOffset) == 204);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, pickUpReplacementActionButtonParamId) == 208);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, pickUpReplacementItemLotParamId) == 212);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, slidingBulletHitType) == 216);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, isBushesForDamage) == 217);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, penetrationBulletType) == 218);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, Reserve_3) == 219);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, Reserve_4) == 220);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, soundBreakSECpId) == 224);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, debug_HeightCheckCapacityMin) == 228);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, debug_HeightCheckCapacityMax) == 232);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, repickActionButtonParamId) == 236);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, repickItemLotParamId) == 240);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, repickReplacementAnimIdOffset) == 244);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, repickReplacementActionButtonParamId) == 248);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, repickReplacementItemLotParamId) == 252);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, noGenerateCarver) == 256);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, noHitHugeAfterBreak) == 257);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, generateMultiForbiddenRegion) == 259);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, residentSeId0) == 260);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, residentSeId1) == 264);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, residentSeId2) == 268);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, residentSeId3) == 272);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, residentSeDmypolyId0) == 276);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, residentSeDmypolyId1) == 278);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, residentSeDmypolyId2) == 280);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, residentSeDmypolyId3) == 282);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, excludeActivateRatio_Xboxone_Grid) == 284);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, excludeActivateRatio_Xboxone_Legacy) == 285);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, excludeActivateRatio_PS4_Grid) == 286);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, excludeActivateRatio_PS4_Legacy) == 287);
+static_assert(offsetof(paramdef::ASSET_GEOMETORY_PARAM_ST, Reserve_0) == 288);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,415 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../ATK_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::ATK_PARAM_ST> {
+    using T = paramdef::ATK_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 207> fields = {{
+        { "hit0_Radius", field_type::f32, offsetof(T, hit0_Radius), 4, 1, nullptr },
+        { "hit1_Radius", field_type::f32, offsetof(T, hit1_Radius), 4, 1, nullptr },
+        { "hit2_Radius", field_type::f32, offsetof(T, hit2_Radius), 4, 1, nullptr },
+        { "hit3_Radius", field_type::f32, offsetof(T, hit3_Radius), 4, 1, nullptr },
+        { "knockbackDist", field_type::f32, offsetof(T, knockbackDist), 4, 1, nullptr },
+        { "hitStopTime", field_type::f32, offsetof(T, hitStopTime), 4, 1, nullptr },
+        { "spEffectId0", field_type::s32, offsetof(T, spEffectId0), 4, 1, nullptr },
+        { "spEffectId1", field_type::s32, offsetof(T, spEffectId1), 4, 1, nullptr },
+        { "spEffectId2", field_type::s32, offsetof(T, spEffectId2), 4, 1, nullptr },
+        { "spEffectId3", field_type::s32, offsetof(T, spEffectId3), 4, 1, nullptr },
+        { "spEffectId4", field_type::s32, offsetof(T, spEffectId4), 4, 1, nullptr },
+        { "hit0_DmyPoly1", field_type::s16, offsetof(T, hit0_DmyPoly1), 2, 1, nullptr },
+        { "hit1_DmyPoly1", field_type::s16, offsetof(T, hit1_DmyPoly1), 2, 1, nullptr },
+        { "hit2_DmyPoly1", field_type::s16, offsetof(T, hit2_DmyPoly1), 2, 1, nullptr },
+        { "hit3_DmyPoly1", field_type::s16, offsetof(T, hit3_DmyPoly1), 2, 1, nullptr },
+        { "hit0_DmyPoly2", field_type::s16, offsetof(T, hit0_DmyPoly2), 2, 1, nullptr },
+        { "hit1_DmyPoly2", field_type::s16, offsetof(T, hit1_DmyPoly2), 2, 1, nullptr },
+        { "hit2_DmyPoly2", field_type::s16, offsetof(T, hit2_DmyPoly2), 2, 1, nullptr },
+        { "hit3_DmyPoly2", field_type::s16, offsetof(T, hit3_DmyPoly2), 2, 1, nullptr },
+        { "blowingCorrection", field_type::u16, offsetof(T, blowingCorrection), 2, 1, nullptr },
+        { "atkPhysCorrection", field_type::u16, offsetof(T, atkPhysCorrection), 2, 1, nullptr },
+        { "atkMagCorrection", field_type::u16, offsetof(T, atkMagCorrection), 2, 1, nullptr },
+        { "atkFireCorrection", field_type::u16, offsetof(T, atkFireCorrection), 2, 1, nullptr },
+        { "atkThunCorrection", field_type::u16, offsetof(T, atkThunCorrection), 2, 1, nullptr },
+        { "atkStamCorrection", field_type::u16, offsetof(T, atkStamCorrection), 2, 1, nullptr },
+        { "guardAtkRateCorrection", field_type::u16, offsetof(T, guardAtkRateCorrection), 2, 1, nullptr },
+        { "guardBreakCorrection", field_type::u16, offsetof(T, guardBreakCorrection), 2, 1, nullptr },
+        { "atkThrowEscapeCorrection", field_type::u16, offsetof(T, atkThrowEscapeCorrection), 2, 1, nullptr },
+        { "subCategory1", field_type::u8, offsetof(T, subCategory1), 1, 1, nullptr },
+        { "subCategory2", field_type::u8, offsetof(T, subCategory2), 1, 1, nullptr },
+        { "atkPhys", field_type::u16, offsetof(T, atkPhys), 2, 1, nullptr },
+        { "atkMag", field_type::u16, offsetof(T, atkMag), 2, 1, nullptr },
+        { "atkFire", field_type::u16, offsetof(T, atkFire), 2, 1, nullptr },
+        { "atkThun", field_type::u16, offsetof(T, atkThun), 2, 1, nullptr },
+        { "atkStam", field_type::u16, offsetof(T, atkStam), 2, 1, nullptr },
+        { "guardAtkRate", field_type::u16, offsetof(T, guardAtkRate), 2, 1, nullptr },
+        { "guardBreakRate", field_type::u16, offsetof(T, guardBreakRate), 2, 1, nullptr },
+        { "pad6", field_type::u8, offsetof(T, pad6), 1, 1, nullptr },
+        { "isEnableCalcDamageForBushesObj", field_type::boolean, offsetof(T, isEnableCalcDamageForBushesObj), 1, 1, nullptr },
+        { "atkThrowEscape", field_type::u16, offsetof(T, atkThrowEscape), 2, 1, nullptr },
+        { "atkObj", field_type::u16, offsetof(T, atkObj), 2, 1, nullptr },
+        { "guardStaminaCutRate", field_type::s16, offsetof(T, guardStaminaCutRate), 2, 1, nullptr },
+        { "guardRate", field_type::s16, offsetof(T, guardRate), 2, 1, nullptr },
+        { "throwTypeId", field_type::u16, offsetof(T, throwTypeId), 2, 1, nullptr },
+        { "hit0_hitType", field_type::u8, offsetof(T, hit0_hitType), 1, 1, nullptr },
+        { "hit1_hitType", field_type::u8, offsetof(T, hit1_hitType), 1, 1, nullptr },
+        { "hit2_hitType", field_type::u8, offsetof(T, hit2_hitType), 1, 1, nullptr },
+        { "hit3_hitType", field_type::u8, offsetof(T, hit3_hitType), 1, 1, nullptr },
+        { "hti0_Priority", field_type::u8, offsetof(T, hti0_Priority), 1, 1, nullptr },
+        { "hti1_Priority", field_type::u8, offsetof(T, hti1_Priority), 1, 1, nullptr },
+        { "hti2_Priority", field_type::u8, offsetof(T, hti2_Priority), 1, 1, nullptr },
+        { "hti3_Priority", field_type::u8, offsetof(T, hti3_Priority), 1, 1, nullptr },
+        { "dmgLevel", field_type::u8, offsetof(T, dmgLevel), 1, 1, nullptr },
+        { "mapHitType", field_type::u8, offsetof(T, mapHitType), 1, 1, nullptr },
+        { "guardCutCancelRate", field_type::s8, offsetof(T, guardCutCancelRate), 1, 1, nullptr },
+        { "atkAttribute", field_type::u8, offsetof(T, atkAttribute), 1, 1, nullptr },
+        { "spAttribute", field_type::u8, offsetof(T, spAttribute), 1, 1, nullptr },
+        { "atkType", field_type::u8, offsetof(T, atkType), 1, 1, nullptr },
+        { "atkMaterial", field_type::u8, offsetof(T, atkMaterial), 1, 1, nullptr },
+        { "guardRangeType", field_type::u8, offsetof(T, guardRangeType), 1, 1, nullptr },
+        { "defSeMaterial1", field_type::u16, offsetof(T, defSeMaterial1), 2, 1, nullptr },
+        { "hitSourceType", field_type::u8, offsetof(T, hitSourceType), 1, 1, nullptr },
+        { "throwFlag", field_type::u8, offsetof(T, throwFlag), 1, 1, nullptr },
+        { "disableGuard", field_type::boolean, 126, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableGuard; } },
+        { "disableStaminaAttack", field_type::boolean, 126, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableStaminaAttack; } },
+        { "disableHitSpEffect", field_type::boolean, 126, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableHitSpEffect; } },
+        { "IgnoreNotifyMissSwingForAI", field_type::boolean, 126, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->IgnoreNotifyMissSwingForAI; } },
+        { "repeatHitSfx", field_type::boolean, 126, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->repeatHitSfx; } },
+        { "isArrowAtk", field_type::boolean, 126, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isArrowAtk; } },
+        { "isGhostAtk", field_type::boolean, 126, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isGhostAtk; } },
+        { "isDisableNoDamage", field_type::boolean, 126, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableNoDamage; } },
+        { "atkPow_forSfx", field_type::s8, offsetof(T, atkPow_forSfx), 1, 1, nullptr },
+        { "atkDir_forSfx", field_type::s8, offsetof(T, atkDir_forSfx), 1, 1, nullptr },
+        { "opposeTarget", field_type::boolean, 129, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->opposeTarget; } },
+        { "friendlyTarget", field_type::boolean, 129, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->friendlyTarget; } },
+        { "selfTarget", field_type::boolean, 129, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->selfTarget; } },
+        { "isCheckDoorPenetration", field_type::boolean, 129, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isCheckDoorPenetration; } },
+        { "isVsRideAtk", field_type::boolean, 129, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isVsRideAtk; } },
+        { "isAddBaseAtk", field_type::boolean, 129, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAddBaseAtk; } },
+        { "excludeThreatLvNotify", field_type::boolean, 129, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->excludeThreatLvNotify; } },
+        { "pad1", field_type::u8, 129, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad1; } },
+        { "atkBehaviorId", field_type::u8, offsetof(T, atkBehaviorId), 1, 1, nullptr },
+        { "atkPow_forSe", field_type::s8, offsetof(T, atkPow_forSe), 1, 1, nullptr },
+        { "atkSuperArmor", field_type::f32, offsetof(T, atkSuperArmor), 4, 1, nullptr },
+        { "decalId1", field_type::s32, offsetof(T, decalId1), 4, 1, nullptr },
+        { "decalId2", field_type::s32, offsetof(T, decalId2), 4, 1, nullptr },
+        { "AppearAiSoundId", field_type::s32, offsetof(T, AppearAiSoundId), 4, 1, nullptr },
+        { "HitAiSoundId", field_type::s32, offsetof(T, HitAiSoundId), 4, 1, nullptr },
+        { "HitRumbleId", field_type::s32, offsetof(T, HitRumbleId), 4, 1, nullptr },
+        { "HitRumbleIdByNormal", field_type::s32, offsetof(T, HitRumbleIdByNormal), 4, 1, nullptr },
+        { "HitRumbleIdByMiddle", field_type::s32, offsetof(T, HitRumbleIdByMiddle), 4, 1, nullptr },
+        { "HitRumbleIdByRoot", field_type::s32, offsetof(T, HitRumbleIdByRoot), 4, 1, nullptr },
+        { "traceSfxId0", field_type::s32, offsetof(T, traceSfxId0), 4, 1, nullptr },
+        { "traceDmyIdHead0", field_type::s32, offsetof(T, traceDmyIdHead0), 4, 1, nullptr },
+        { "traceDmyIdTail0", field_type::s32, offsetof(T, traceDmyIdTail0), 4, 1, nullptr },
+        { "traceSfxId1", field_type::s32, offsetof(T, traceSfxId1), 4, 1, nullptr },
+        { "traceDmyIdHead1", field_type::s32, offsetof(T, traceDmyIdHead1), 4, 1, nullptr },
+        { "traceDmyIdTail1", field_type::s32, offsetof(T, traceDmyIdTail1), 4, 1, nullptr },
+        { "traceSfxId2", field_type::s32, offsetof(T, traceSfxId2), 4, 1, nullptr },
+        { "traceDmyIdHead2", field_type::s32, offsetof(T, traceDmyIdHead2), 4, 1, nullptr },
+        { "traceDmyIdTail2", field_type::s32, offsetof(T, traceDmyIdTail2), 4, 1, nullptr },
+        { "traceSfxId3", field_type::s32, offsetof(T, traceSfxId3), 4, 1, nullptr },
+        { "traceDmyIdHead3", field_type::s32, offsetof(T, traceDmyIdHead3), 4, 1, nullptr },
+        { "traceDmyIdTail3", field_type::s32, offsetof(T, traceDmyIdTail3), 4, 1, nullptr },
+        { "traceSfxId4", field_type::s32, offsetof(T, traceSfxId4), 4, 1, nullptr },
+        { "traceDmyIdHead4", field_type::s32, offsetof(T, traceDmyIdHead4), 4, 1, nullptr },
+        { "traceDmyIdTail4", field_type::s32, offsetof(T, traceDmyIdTail4), 4, 1, nullptr },
+        { "traceSfxId5", field_type::s32, offsetof(T, traceSfxId5), 4, 1, nullptr },
+        { "traceDmyIdHead5", field_type::s32, offsetof(T, traceDmyIdHead5), 4, 1, nullptr },
+        { "traceDmyIdTail5", field_type::s32, offsetof(T, traceDmyIdTail5), 4, 1, nullptr },
+        { "traceSfxId6", field_type::s32, offsetof(T, traceSfxId6), 4, 1, nullptr },
+        { "traceDmyIdHead6", field_type::s32, offsetof(T, traceDmyIdHead6), 4, 1, nullptr },
+        { "traceDmyIdTail6", field_type::s32, offsetof(T, traceDmyIdTail6), 4, 1, nullptr },
+        { "traceSfxId7", field_type::s32, offsetof(T, traceSfxId7), 4, 1, nullptr },
+        { "traceDmyIdHead7", field_type::s32, offsetof(T, traceDmyIdHead7), 4, 1, nullptr },
+        { "traceDmyIdTail7", field_type::s32, offsetof(T, traceDmyIdTail7), 4, 1, nullptr },
+        { "hit4_Radius", field_type::f32, offsetof(T, hit4_Radius), 4, 1, nullptr },
+        { "hit5_Radius", field_type::f32, offsetof(T, hit5_Radius), 4, 1, nullptr },
+        { "hit6_Radius", field_type::f32, offsetof(T, hit6_Radius), 4, 1, nullptr },
+        { "hit7_Radius", field_type::f32, offsetof(T, hit7_Radius), 4, 1, nullptr },
+        { "hit8_Radius", field_type::f32, offsetof(T, hit8_Radius), 4, 1, nullptr },
+        { "hit9_Radius", field_type::f32, offsetof(T, hit9_Radius), 4, 1, nullptr },
+        { "hit10_Radius", field_type::f32, offsetof(T, hit10_Radius), 4, 1, nullptr },
+        { "hit11_Radius", field_type::f32, offsetof(T, hit11_Radius), 4, 1, nullptr },
+        { "hit12_Radius", field_type::f32, offsetof(T, hit12_Radius), 4, 1, nullptr },
+        { "hit13_Radius", field_type::f32, offsetof(T, hit13_Radius), 4, 1, nullptr },
+        { "hit14_Radius", field_type::f32, offsetof(T, hit14_Radius), 4, 1, nullptr },
+        { "hit15_Radius", field_type::f32, offsetof(T, hit15_Radius), 4, 1, nullptr },
+        { "hit4_DmyPoly1", field_type::s16, offsetof(T, hit4_DmyPoly1), 2, 1, nullptr },
+        { "hit5_DmyPoly1", field_type::s16, offsetof(T, hit5_DmyPoly1), 2, 1, nullptr },
+        { "hit6_DmyPoly1", field_type::s16, offsetof(T, hit6_DmyPoly1), 2, 1, nullptr },
+        { "hit7_DmyPoly1", field_type::s16, offsetof(T, hit7_DmyPoly1), 2, 1, nullptr },
+        { "hit8_DmyPoly1", field_type::s16, offsetof(T, hit8_DmyPoly1), 2, 1, nullptr },
+        { "hit9_DmyPoly1", field_type::s16, offsetof(T, hit9_DmyPoly1), 2, 1, nullptr },
+        { "hit10_DmyPoly1", field_type::s16, offsetof(T, hit10_DmyPoly1), 2, 1, nullptr },
+        { "hit11_DmyPoly1", field_type::s16, offsetof(T, hit11_DmyPoly1), 2, 1, nullptr },
+        { "hit12_DmyPoly1", field_type::s16, offsetof(T, hit12_DmyPoly1), 2, 1, nullptr },
+        { "hit13_DmyPoly1", field_type::s16, offsetof(T, hit13_DmyPoly1), 2, 1, nullptr },
+        { "hit14_DmyPoly1", field_type::s16, offsetof(T, hit14_DmyPoly1), 2, 1, nullptr },
+        { "hit15_DmyPoly1", field_type::s16, offsetof(T, hit15_DmyPoly1), 2, 1, nullptr },
+        { "hit4_DmyPoly2", field_type::s16, offsetof(T, hit4_DmyPoly2), 2, 1, nullptr },
+        { "hit5_DmyPoly2", field_type::s16, offsetof(T, hit5_DmyPoly2), 2, 1, nullptr },
+        { "hit6_DmyPoly2", field_type::s16, offsetof(T, hit6_DmyPoly2), 2, 1, nullptr },
+        { "hit7_DmyPoly2", field_type::s16, offsetof(T, hit7_DmyPoly2), 2, 1, nullptr },
+        { "hit8_DmyPoly2", field_type::s16, offsetof(T, hit8_DmyPoly2), 2, 1, nullptr },
+        { "hit9_DmyPoly2", field_type::s16, offsetof(T, hit9_DmyPoly2), 2, 1, nullptr },
+        { "hit10_DmyPoly2", field_type::s16, offsetof(T, hit10_DmyPoly2), 2, 1, nullptr },
+        { "hit11_DmyPoly2", field_type::s16, offsetof(T, hit11_DmyPoly2), 2, 1, nullptr },
+        { "hit12_DmyPoly2", field_type::s16, offsetof(T, hit12_DmyPoly2), 2, 1, nullptr },
+        { "hit13_DmyPoly2", field_type::s16, offsetof(T, hit13_DmyPoly2), 2, 1, nullptr },
+        { "hit14_DmyPoly2", field_type::s16, offsetof(T, hit14_DmyPoly2), 2, 1, nullptr },
+        { "hit15_DmyPoly2", field_type::s16, offsetof(T, hit15_DmyPoly2), 2, 1, nullptr },
+        { "hit4_hitType", field_type::u8, offsetof(T, hit4_hitType), 1, 1, nullptr },
+        { "hit5_hitType", field_type::u8, offsetof(T, hit5_hitType), 1, 1, nullptr },
+        { "hit6_hitType", field_type::u8, offsetof(T, hit6_hitType), 1, 1, nullptr },
+        { "hit7_hitType", field_type::u8, offsetof(T, hit7_hitType), 1, 1, nullptr },
+        { "hit8_hitType", field_type::u8, offsetof(T, hit8_hitType), 1, 1, nullptr },
+        { "hit9_hitType", field_type::u8, offsetof(T, hit9_hitType), 1, 1, nullptr },
+        { "hit10_hitType", field_type::u8, offsetof(T, hit10_hitType), 1, 1, nullptr },
+        { "hit11_hitType", field_type::u8, offsetof(T, hit11_hitType), 1, 1, nullptr },
+        { "hit12_hitType", field_type::u8, offsetof(T, hit12_hitType), 1, 1, nullptr },
+        { "hit13_hitType", field_type::u8, offsetof(T, hit13_hitType), 1, 1, nullptr },
+        { "hit14_hitType", field_type::u8, offsetof(T, hit14_hitType), 1, 1, nullptr },
+        { "hit15_hitType", field_type::u8, offsetof(T, hit15_hitType), 1, 1, nullptr },
+        { "hti4_Priority", field_type::u8, offsetof(T, hti4_Priority), 1, 1, nullptr },
+        { "hti5_Priority", field_type::u8, offsetof(T, hti5_Priority), 1, 1, nullptr },
+        { "hti6_Priority", field_type::u8, offsetof(T, hti6_Priority), 1, 1, nullptr },
+        { "hti7_Priority", field_type::u8, offsetof(T, hti7_Priority), 1, 1, nullptr },
+        { "hti8_Priority", field_type::u8, offsetof(T, hti8_Priority), 1, 1, nullptr },
+        { "hti9_Priority", field_type::u8, offsetof(T, hti9_Priority), 1, 1, nullptr },
+        { "hti10_Priority", field_type::u8, offsetof(T, hti10_Priority), 1, 1, nullptr },
+        { "hti11_Priority", field_type::u8, offsetof(T, hti11_Priority), 1, 1, nullptr },
+        { "hti12_Priority", field_type::u8, offsetof(T, hti12_Priority), 1, 1, nullptr },
+        { "hti13_Priority", field_type::u8, offsetof(T, hti13_Priority), 1, 1, nullptr },
+        { "hti14_Priority", field_type::u8, offsetof(T, hti14_Priority), 1, 1, nullptr },
+        { "hti15_Priority", field_type::u8, offsetof(T, hti15_Priority), 1, 1, nullptr },
+        { "defSfxMaterial1", field_type::u16, offsetof(T, defSfxMaterial1), 2, 1, nullptr },
+        { "defSeMaterial2", field_type::u16, offsetof(T, defSeMaterial2), 2, 1, nullptr },
+        { "defSfxMaterial2", field_type::u16, offsetof(T, defSfxMaterial2), 2, 1, nullptr },
+        { "atkDarkCorrection", field_type::u16, offsetof(T, atkDarkCorrection), 2, 1, nullptr },
+        { "atkDark", field_type::u16, offsetof(T, atkDark), 2, 1, nullptr },
+        { "pad5", field_type::u8, 394, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad5; } },
+        { "isDisableParry", field_type::boolean, 394, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableParry; } },
+        { "isDisableBothHandsAtkBonus", field_type::boolean, 394, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableBothHandsAtkBonus; } },
+        { "isInvalidatedByNoDamageInAir", field_type::boolean, 394, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isInvalidatedByNoDamageInAir; } },
+        { "pad2", field_type::u8, 394, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad2; } },
+        { "dmgLevel_vsPlayer", field_type::s8, offsetof(T, dmgLevel_vsPlayer), 1, 1, nullptr },
+        { "statusAilmentAtkPowerCorrectRate", field_type::u16, offsetof(T, statusAilmentAtkPowerCorrectRate), 2, 1, nullptr },
+        { "spEffectAtkPowerCorrectRate_byPoint", field_type::u16, offsetof(T, spEffectAtkPowerCorrectRate_byPoint), 2, 1, nullptr },
+        { "spEffectAtkPowerCorrectRate_byRate", field_type::u16, offsetof(T, spEffectAtkPowerCorrectRate_byRate), 2, 1, nullptr },
+        { "spEffectAtkPowerCorrectRate_byDmg", field_type::u16, offsetof(T, spEffectAtkPowerCorrectRate_byDmg), 2, 1, nullptr },
+        { "atkBehaviorId_2", field_type::u8, offsetof(T, atkBehaviorId_2), 1, 1, nullptr },
+        { "throwDamageAttribute", field_type::u8, offsetof(T, throwDamageAttribute), 1, 1, nullptr },
+        { "statusAilmentAtkPowerCorrectRate_byPoint", field_type::u16, offsetof(T, statusAilmentAtkPowerCorrectRate_byPoint), 2, 1, nullptr },
+        { "overwriteAttackElementCorrectId", field_type::s32, offsetof(T, overwriteAttackElementCorrectId), 4, 1, nullptr },
+        { "decalBaseId1", field_type::s16, offsetof(T, decalBaseId1), 2, 1, nullptr },
+        { "decalBaseId2", field_type::s16, offsetof(T, decalBaseId2), 2, 1, nullptr },
+        { "wepRegainHpScale", field_type::u16, offsetof(T, wepRegainHpScale), 2, 1, nullptr },
+        { "atkRegainHp", field_type::u16, offsetof(T, atkRegainHp), 2, 1, nullptr },
+        { "regainableTimeScale", field_type::f32, offsetof(T, regainableTimeScale), 4, 1, nullptr },
+        { "regainableHpRateScale", field_type::f32, offsetof(T, regainableHpRateScale), 4, 1, nullptr },
+        { "regainableSlotId", field_type::s8, offsetof(T, regainableSlotId), 1, 1, nullptr },
+        { "spAttributeVariationValue", field_type::u8, offsetof(T, spAttributeVariationValue), 1, 1, nullptr },
+        { "parryForwardOffset", field_type::s16, offsetof(T, parryForwardOffset), 2, 1, nullptr },
+        { "atkSuperArmorCorrection", field_type::f32, offsetof(T, atkSuperArmorCorrection), 4, 1, nullptr },
+        { "defSfxMaterialVariationValue", field_type::u8, offsetof(T, defSfxMaterialVariationValue), 1, 1, nullptr },
+        { "pad4", field_type::u8, offsetof(T, pad4), 1, 19, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit0_Radius) == 0);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit1_Radius) == 4);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit2_Radius) == 8);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit3_Radius) == 12);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, knockbackDist) == 16);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hitStopTime) == 20);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, spEffectId0) == 24);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, spEffectId1) == 28);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, spEffectId2) == 32);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, spEffectId3) == 36);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, spEffectId4) == 40);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit0_DmyPoly1) == 44);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit1_DmyPoly1) == 46);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit2_DmyPoly1) == 48);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit3_DmyPoly1) == 50);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit0_DmyPoly2) == 52);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit1_DmyPoly2) == 54);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit2_DmyPoly2) == 56);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit3_DmyPoly2) == 58);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, blowingCorrection) == 60);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkPhysCorrection) == 62);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkMagCorrection) == 64);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkFireCorrection) == 66);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkThunCorrection) == 68);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkStamCorrection) == 70);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, guardAtkRateCorrection) == 72);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, guardBreakCorrection) == 74);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkThrowEscapeCorrection) == 76);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, subCategory1) == 78);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, subCategory2) == 79);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkPhys) == 80);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkMag) == 82);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkFire) == 84);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkThun) == 86);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkStam) == 88);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, guardAtkRate) == 90);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, guardBreakRate) == 92);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, pad6) == 94);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, isEnableCalcDamageForBushesObj) == 95);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkThrowEscape) == 96);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkObj) == 98);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, guardStaminaCutRate) == 100);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, guardRate) == 102);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, throwTypeId) == 104);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit0_hitType) == 106);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit1_hitType) == 107);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit2_hitType) == 108);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit3_hitType) == 109);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti0_Priority) == 110);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti1_Priority) == 111);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti2_Priority) == 112);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti3_Priority) == 113);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, dmgLevel) == 114);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, mapHitType) == 115);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, guardCutCancelRate) == 116);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkAttribute) == 117);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, spAttribute) == 118);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkType) == 119);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkMaterial) == 120);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, guardRangeType) == 121);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, defSeMaterial1) == 122);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hitSourceType) == 124);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, throwFlag) == 125);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkPow_forSfx) == 127);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkDir_forSfx) == 128);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkBehaviorId) == 130);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkPow_forSe) == 131);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkSuperArmor) == 132);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, decalId1) == 136);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, decalId2) == 140);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, AppearAiSoundId) == 144);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, HitAiSoundId) == 148);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, HitRumbleId) == 152);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, HitRumbleIdByNormal) == 156);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, HitRumbleIdByMiddle) == 160);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, HitRumbleIdByRoot) == 164);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceSfxId0) == 168);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdHead0) == 172);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdTail0) == 176);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceSfxId1) == 180);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdHead1) == 184);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdTail1) == 188);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceSfxId2) == 192);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdHead2) == 196);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdTail2) == 200);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceSfxId3) == 204);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdHead3) == 208);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdTail3) == 212);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceSfxId4) == 216);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdHead4) == 220);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdTail4) == 224);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceSfxId5) == 228);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdHead5) == 232);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdTail5) == 236);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceSfxId6) == 240);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdHead6) == 244);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdTail6) == 248);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceSfxId7) == 252);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdHead7) == 256);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, traceDmyIdTail7) == 260);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit4_Radius) == 264);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit5_Radius) == 268);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit6_Radius) == 272);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit7_Radius) == 276);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit8_Radius) == 280);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit9_Radius) == 284);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit10_Radius) == 288);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit11_Radius) == 292);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit12_Radius) == 296);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit13_Radius) == 300);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit14_Radius) == 304);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit15_Radius) == 308);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit4_DmyPoly1) == 312);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit5_DmyPoly1) == 314);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit6_DmyPoly1) == 316);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit7_DmyPoly1) == 318);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit8_DmyPoly1) == 320);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit9_DmyPoly1) == 322);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit10_DmyPoly1) == 324);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit11_DmyPoly1) == 326);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit12_DmyPoly1) == 328);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit13_DmyPoly1) == 330);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit14_DmyPoly1) == 332);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit15_DmyPoly1) == 334);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit4_DmyPoly2) == 336);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit5_DmyPoly2) == 338);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit6_DmyPoly2) == 340);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit7_DmyPoly2) == 342);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit8_DmyPoly2) == 344);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit9_DmyPoly2) == 346);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit10_DmyPoly2) == 348);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit11_DmyPoly2) == 350);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit12_DmyPoly2) == 352);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit13_DmyPoly2) == 354);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit14_DmyPoly2) == 356);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit15_DmyPoly2) == 358);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit4_hitType) == 360);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit5_hitType) == 361);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit6_hitType) == 362);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit7_hitType) == 363);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit8_hitType) == 364);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit9_hitType) == 365);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit10_hitType) == 366);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit11_hitType) == 367);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit12_hitType) == 368);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit13_hitType) == 369);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit14_hitType) == 370);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hit15_hitType) == 371);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti4_Priority) == 372);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti5_Priority) == 373);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti6_Priority) == 374);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti7_Priority) == 375);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti8_Priority) == 376);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti9_Priority) == 377);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti10_Priority) == 378);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti11_Priority) == 379);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti12_Priority) == 380);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti13_Priority) == 381);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti14_Priority) == 382);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, hti15_Priority) == 383);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, defSfxMaterial1) == 384);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, defSeMaterial2) == 386);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, defSfxMaterial2) == 388);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkDarkCorrection) == 390);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkDark) == 392);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, dmgLevel_vsPlayer) == 395);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, statusAilmentAtkPowerCorrectRate) == 396);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, spEffectAtkPowerCorrectRate_byPoint) == 398);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, spEffectAtkPowerCorrectRate_byRate) == 400);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, spEffectAtkPowerCorrectRate_byDmg) == 402);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkBehaviorId_2) == 404);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, throwDamageAttribute) == 405);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, statusAilmentAtkPowerCorrectRate_byPoint) == 406);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, overwriteAttackElementCorrectId) == 408);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, decalBaseId1) == 412);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, decalBaseId2) == 414);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, wepRegainHpScale) == 416);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkRegainHp) == 418);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, regainableTimeScale) == 420);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, regainableHpRateScale) == 424);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, regainableSlotId) == 428);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, spAttributeVariationValue) == 429);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, parryForwardOffset) == 430);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, atkSuperArmorCorrection) == 432);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, defSfxMaterialVariationValue) == 436);
+static_assert(offsetof(paramdef::ATK_PARAM_ST, pad4) == 437);
+
+}; // namespace params
+}; // namespace from
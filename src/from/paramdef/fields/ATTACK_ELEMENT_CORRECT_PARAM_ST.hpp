@@ -0,0 +1,150 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../ATTACK_ELEMENT_CORRECT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST> {
+    using T = paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 77> fields = {{
+        { "isStrengthCorrect_byPhysics", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isStrengthCorrect_byPhysics; } },
+        { "isDexterityCorrect_byPhysics", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDexterityCorrect_byPhysics; } },
+        { "isMagicCorrect_byPhysics", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isMagicCorrect_byPhysics; } },
+        { "isFaithCorrect_byPhysics", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isFaithCorrect_byPhysics; } },
+        { "isLuckCorrect_byPhysics", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isLuckCorrect_byPhysics; } },
+        { "isStrengthCorrect_byMagic", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isStrengthCorrect_byMagic; } },
+        { "isDexterityCorrect_byMagic", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDexterityCorrect_byMagic; } },
+        { "isMagicCorrect_byMagic", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isMagicCorrect_byMagic; } },
+        { "isFaithCorrect_byMagic", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isFaithCorrect_byMagic; } },
+        { "isLuckCorrect_byMagic", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isLuckCorrect_byMagic; } },
+        { "isStrengthCorrect_byFire", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isStrengthCorrect_byFire; } },
+        { "isDexterityCorrect_byFire", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDexterityCorrect_byFire; } },
+        { "isMagicCorrect_byFire", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isMagicCorrect_byFire; } },
+        { "isFaithCorrect_byFire", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isFaithCorrect_byFire; } },
+        { "isLuckCorrect_byFire", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isLuckCorrect_byFire; } },
+        { "isStrengthCorrect_byThunder", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isStrengthCorrect_byThunder; } },
+        { "isDexterityCorrect_byThunder", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDexterityCorrect_byThunder; } },
+        { "isMagicCorrect_byThunder", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isMagicCorrect_byThunder; } },
+        { "isFaithCorrect_byThunder", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isFaithCorrect_byThunder; } },
+        { "isLuckCorrect_byThunder", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isLuckCorrect_byThunder; } },
+        { "isStrengthCorrect_byDark", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isStrengthCorrect_byDark; } },
+        { "isDexterityCorrect_byDark", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDexterityCorrect_byDark; } },
+        { "isMagicCorrect_byDark", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isMagicCorrect_byDark; } },
+        { "isFaithCorrect_byDark", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isFaithCorrect_byDark; } },
+        { "isLuckCorrect_byDark", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isLuckCorrect_byDark; } },
+        { "pad1", field_type::u8, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad1; } },
+        { "overwriteStrengthCorrectRate_byPhysics", field_type::s16, offsetof(T, overwriteStrengthCorrectRate_byPhysics), 2, 1, nullptr },
+        { "overwriteDexterityCorrectRate_byPhysics", field_type::s16, offsetof(T, overwriteDexterityCorrectRate_byPhysics), 2, 1, nullptr },
+        { "overwriteMagicCorrectRate_byPhysics", field_type::s16, offsetof(T, overwriteMagicCorrectRate_byPhysics), 2, 1, nullptr },
+        { "overwriteFaithCorrectRate_byPhysics", field_type::s16, offsetof(T, overwriteFaithCorrectRate_byPhysics), 2, 1, nullptr },
+        { "overwriteLuckCorrectRate_byPhysics", field_type::s16, offsetof(T, overwriteLuckCorrectRate_byPhysics), 2, 1, nullptr },
+        { "overwriteStrengthCorrectRate_byMagic", field_type::s16, offsetof(T, overwriteStrengthCorrectRate_byMagic), 2, 1, nullptr },
+        { "overwriteDexterityCorrectRate_byMagic", field_type::s16, offsetof(T, overwriteDexterityCorrectRate_byMagic), 2, 1, nullptr },
+        { "overwriteMagicCorrectRate_byMagic", field_type::s16, offsetof(T, overwriteMagicCorrectRate_byMagic), 2, 1, nullptr },
+        { "overwriteFaithCorrectRate_byMagic", field_type::s16, offsetof(T, overwriteFaithCorrectRate_byMagic), 2, 1, nullptr },
+        { "overwriteLuckCorrectRate_byMagic", field_type::s16, offsetof(T, overwriteLuckCorrectRate_byMagic), 2, 1, nullptr },
+        { "overwriteStrengthCorrectRate_byFire", field_type::s16, offsetof(T, overwriteStrengthCorrectRate_byFire), 2, 1, nullptr },
+        { "overwriteDexterityCorrectRate_byFire", field_type::s16, offsetof(T, overwriteDexterityCorrectRate_byFire), 2, 1, nullptr },
+        { "overwriteMagicCorrectRate_byFire", field_type::s16, offsetof(T, overwriteMagicCorrectRate_byFire), 2, 1, nullptr },
+        { "overwriteFaithCorrectRate_byFire", field_type::s16, offsetof(T, overwriteFaithCorrectRate_byFire), 2, 1, nullptr },
+        { "overwriteLuckCorrectRate_byFire", field_type::s16, offsetof(T, overwriteLuckCorrectRate_byFire), 2, 1, nullptr },
+        { "overwriteStrengthCorrectRate_byThunder", field_type::s16, offsetof(T, overwriteStrengthCorrectRate_byThunder), 2, 1, nullptr },
+        { "overwriteDexterityCorrectRate_byThunder", field_type::s16, offsetof(T, overwriteDexterityCorrectRate_byThunder), 2, 1, nullptr },
+        { "overwriteMagicCorrectRate_byThunder", field_type::s16, offsetof(T, overwriteMagicCorrectRate_byThunder), 2, 1, nullptr },
+        { "overwriteFaithCorrectRate_byThunder", field_type::s16, offsetof(T, overwriteFaithCorrectRate_byThunder), 2, 1, nullptr },
+        { "overwriteLuckCorrectRate_byThunder", field_type::s16, offsetof(T, overwriteLuckCorrectRate_byThunder), 2, 1, nullptr },
+        { "overwriteStrengthCorrectRate_byDark", field_type::s16, offsetof(T, overwriteStrengthCorrectRate_byDark), 2, 1, nullptr },
+        { "overwriteDexterityCorrectRate_byDark", field_type::s16, offsetof(T, overwriteDexterityCorrectRate_byDark), 2, 1, nullptr },
+        { "overwriteMagicCorrectRate_byDark", field_type::s16, offsetof(T, overwriteMagicCorrectRate_byDark), 2, 1, nullptr },
+        { "overwriteFaithCorrectRate_byDark", field_type::s16, offsetof(T, overwriteFaithCorrectRate_byDark), 2, 1, nullptr },
+        { "overwriteLuckCorrectRate_byDark", field_type::s16, offsetof(T, overwriteLuckCorrectRate_byDark), 2, 1, nullptr },
+        { "InfluenceStrengthCorrectRate_byPhysics", field_type::s16, offsetof(T, InfluenceStrengthCorrectRate_byPhysics), 2, 1, nullptr },
+        { "InfluenceDexterityCorrectRate_byPhysics", field_type::s16, offsetof(T, InfluenceDexterityCorrectRate_byPhysics), 2, 1, nullptr },
+        { "InfluenceMagicCorrectRate_byPhysics", field_type::s16, offsetof(T, InfluenceMagicCorrectRate_byPhysics), 2, 1, nullptr },
+        { "InfluenceFaithCorrectRate_byPhysics", field_type::s16, offsetof(T, InfluenceFaithCorrectRate_byPhysics), 2, 1, nullptr },
+        { "InfluenceLuckCorrectRate_byPhysics", field_type::s16, offsetof(T, InfluenceLuckCorrectRate_byPhysics), 2, 1, nullptr },
+        { "InfluenceStrengthCorrectRate_byMagic", field_type::s16, offsetof(T, InfluenceStrengthCorrectRate_byMagic), 2, 1, nullptr },
+        { "InfluenceDexterityCorrectRate_byMagic", field_type::s16, offsetof(T, InfluenceDexterityCorrectRate_byMagic), 2, 1, nullptr },
+        { "InfluenceMagicCorrectRate_byMagic", field_type::s16, offsetof(T, InfluenceMagicCorrectRate_byMagic), 2, 1, nullptr },
+        { "InfluenceFaithCorrectRate_byMagic", field_type::s16, offsetof(T, InfluenceFaithCorrectRate_byMagic), 2, 1, nullptr },
+        { "InfluenceLuckCorrectRate_byMagic", field_type::s16, offsetof(T, InfluenceLuckCorrectRate_byMagic), 2, 1, nullptr },
+        { "InfluenceStrengthCorrectRate_byFire", field_type::s16, offsetof(T, InfluenceStrengthCorrectRate_byFire), 2, 1, nullptr },
+        { "InfluenceDexterityCorrectRate_byFire", field_type::s16, offsetof(T, InfluenceDexterityCorrectRate_byFire), 2, 1, nullptr },
+        { "InfluenceMagicCorrectRate_byFire", field_type::s16, offsetof(T, InfluenceMagicCorrectRate_byFire), 2, 1, nullptr },
+        { "InfluenceFaithCorrectRate_byFire", field_type::s16, offsetof(T, InfluenceFaithCorrectRate_byFire), 2, 1, nullptr },
+        { "InfluenceLuckCorrectRate_byFire", field_type::s16, offsetof(T, InfluenceLuckCorrectRate_byFire), 2, 1, nullptr },
+        { "InfluenceStrengthCorrectRate_byThunder", field_type::s16, offsetof(T, InfluenceStrengthCorrectRate_byThunder), 2, 1, nullptr },
+        { "InfluenceDexterityCorrectRate_byThunder", field_type::s16, offsetof(T, InfluenceDexterityCorrectRate_byThunder), 2, 1, nullptr },
+        { "InfluenceMagicCorrectRate_byThunder", field_type::s16, offsetof(T, InfluenceMagicCorrectRate_byThunder), 2, 1, nullptr },
+        { "InfluenceFaithCorrectRate_byThunder", field_type::s16, offsetof(T, InfluenceFaithCorrectRate_byThunder), 2, 1, nullptr },
+        { "InfluenceLuckCorrectRate_byThunder", field_type::s16, offsetof(T, InfluenceLuckCorrectRate_byThunder), 2, 1, nullptr },
+        { "InfluenceStrengthCorrectRate_byDark", field_type::s16, offsetof(T, InfluenceStrengthCorrectRate_byDark), 2, 1, nullptr },
+        { "InfluenceDexterityCorrectRate_byDark", field_type::s16, offsetof(T, InfluenceDexterityCorrectRate_byDark), 2, 1, nullptr },
+        { "InfluenceMagicCorrectRate_byDark", field_type::s16, offsetof(T, InfluenceMagicCorrectRate_byDark), 2, 1, nullptr },
+        { "InfluenceFaithCorrectRate_byDark", field_type::s16, offsetof(T, InfluenceFaithCorrectRate_byDark), 2, 1, nullptr },
+        { "InfluenceLuckCorrectRate_byDark", field_type::s16, offsetof(T, InfluenceLuckCorrectRate_byDark), 2, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 24, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteStrengthCorrectRate_byPhysics) == 4);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteDexterityCorrectRate_byPhysics) == 6);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteMagicCorrectRate_byPhysics) == 8);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteFaithCorrectRate_byPhysics) == 10);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteLuckCorrectRate_byPhysics) == 12);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteStrengthCorrectRate_byMagic) == 14);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteDexterityCorrectRate_byMagic) == 16);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteMagicCorrectRate_byMagic) == 18);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteFaithCorrectRate_byMagic) == 20);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteLuckCorrectRate_byMagic) == 22);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteStrengthCorrectRate_byFire) == 24);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteDexterityCorrectRate_byFire) == 26);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteMagicCorrectRate_byFire) == 28);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteFaithCorrectRate_byFire) == 30);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteLuckCorrectRate_byFire) == 32);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteStrengthCorrectRate_byThunder) == 34);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteDexterityCorrectRate_byThunder) == 36);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteMagicCorrectRate_byThunder) == 38);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteFaithCorrectRate_byThunder) == 40);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteLuckCorrectRate_byThunder) == 42);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteStrengthCorrectRate_byDark) == 44);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteDexterityCorrectRate_byDark) == 46);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteMagicCorrectRate_byDark) == 48);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteFaithCorrectRate_byDark) == 50);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, overwriteLuckCorrectRate_byDark) == 52);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceStrengthCorrectRate_byPhysics) == 54);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceDexterityCorrectRate_byPhysics) == 56);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceMagicCorrectRate_byPhysics) == 58);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceFaithCorrectRate_byPhysics) == 60);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceLuckCorrectRate_byPhysics) == 62);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceStrengthCorrectRate_byMagic) == 64);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceDexterityCorrectRate_byMagic) == 66);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceMagicCorrectRate_byMagic) == 68);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceFaithCorrectRate_byMagic) == 70);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceLuckCorrectRate_byMagic) == 72);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceStrengthCorrectRate_byFire) == 74);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceDexterityCorrectRate_byFire) == 76);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceMagicCorrectRate_byFire) == 78);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceFaithCorrectRate_byFire) == 80);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceLuckCorrectRate_byFire) == 82);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceStrengthCorrectRate_byThunder) == 84);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceDexterityCorrectRate_byThunder) == 86);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceMagicCorrectRate_byThunder) == 88);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceFaithCorrectRate_byThunder) == 90);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceLuckCorrectRate_byThunder) == 92);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceStrengthCorrectRate_byDark) == 94);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceDexterityCorrectRate_byDark) == 96);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceMagicCorrectRate_byDark) == 98);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceFaithCorrectRate_byDark) == 100);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, InfluenceLuckCorrectRate_byDark) == 102);
+static_assert(offsetof(paramdef::ATTACK_ELEMENT_CORRECT_PARAM_ST, pad2) == 104);
+
+}; // namespace params
+}; // namespace from
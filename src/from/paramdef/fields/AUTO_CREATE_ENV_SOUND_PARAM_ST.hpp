@@ -0,0 +1,38 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../AUTO_CREATE_ENV_SOUND_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::AUTO_CREATE_ENV_SOUND_PARAM_ST> {
+    using T = paramdef::AUTO_CREATE_ENV_SOUND_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 8> fields = {{
+        { "RangeMin", field_type::f32, offsetof(T, RangeMin), 4, 1, nullptr },
+        { "RangeMax", field_type::f32, offsetof(T, RangeMax), 4, 1, nullptr },
+        { "LifeTimeMin", field_type::f32, offsetof(T, LifeTimeMin), 4, 1, nullptr },
+        { "LifeTimeMax", field_type::f32, offsetof(T, LifeTimeMax), 4, 1, nullptr },
+        { "DeleteDist", field_type::f32, offsetof(T, DeleteDist), 4, 1, nullptr },
+        { "NearDist", field_type::f32, offsetof(T, NearDist), 4, 1, nullptr },
+        { "LimiteRotateMin", field_type::f32, offsetof(T, LimiteRotateMin), 4, 1, nullptr },
+        { "LimiteRotateMax", field_type::f32, offsetof(T, LimiteRotateMax), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::AUTO_CREATE_ENV_SOUND_PARAM_ST, RangeMin) == 0);
+static_assert(offsetof(paramdef::AUTO_CREATE_ENV_SOUND_PARAM_ST, RangeMax) == 4);
+static_assert(offsetof(paramdef::AUTO_CREATE_ENV_SOUND_PARAM_ST, LifeTimeMin) == 8);
+static_assert(offsetof(paramdef::AUTO_CREATE_ENV_SOUND_PARAM_ST, LifeTimeMax) == 12);
+static_assert(offsetof(paramdef::AUTO_CREATE_ENV_SOUND_PARAM_ST, DeleteDist) == 16);
+static_assert(offsetof(paramdef::AUTO_CREATE_ENV_SOUND_PARAM_ST, NearDist) == 20);
+static_assert(offsetof(paramdef::AUTO_CREATE_ENV_SOUND_PARAM_ST, LimiteRotateMin) == 24);
+static_assert(offsetof(paramdef::AUTO_CREATE_ENV_SOUND_PARAM_ST, LimiteRotateMax) == 28);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,36 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../BASECHR_SELECT_MENU_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::BASECHR_SELECT_MENU_PARAM_ST> {
+    using T = paramdef::BASECHR_SELECT_MENU_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 8> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "chrInitParam", field_type::u32, offsetof(T, chrInitParam), 4, 1, nullptr },
+        { "originChrInitParam", field_type::u32, offsetof(T, originChrInitParam), 4, 1, nullptr },
+        { "imageId", field_type::s32, offsetof(T, imageId), 4, 1, nullptr },
+        { "textId", field_type::s32, offsetof(T, textId), 4, 1, nullptr },
+        { "reserve", field_type::u8, offsetof(T, reserve), 1, 12, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::BASECHR_SELECT_MENU_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::BASECHR_SELECT_MENU_PARAM_ST, chrInitParam) == 4);
+static_assert(offsetof(paramdef::BASECHR_SELECT_MENU_PARAM_ST, originChrInitParam) == 8);
+static_assert(offsetof(paramdef::BASECHR_SELECT_MENU_PARAM_ST, imageId) == 12);
+static_assert(offsetof(paramdef::BASECHR_SELECT_MENU_PARAM_ST, textId) == 16);
+static_assert(offsetof(paramdef::BASECHR_SELECT_MENU_PARAM_ST, reserve) == 20);
+
+}; // namespace params
+}; // namespace from
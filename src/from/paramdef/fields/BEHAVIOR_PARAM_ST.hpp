@@ -0,0 +1,46 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../BEHAVIOR_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::BEHAVIOR_PARAM_ST> {
+    using T = paramdef::BEHAVIOR_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 12> fields = {{
+        { "variationId", field_type::s32, offsetof(T, variationId), 4, 1, nullptr },
+        { "behaviorJudgeId", field_type::s32, offsetof(T, behaviorJudgeId), 4, 1, nullptr },
+        { "ezStateBehaviorType_old", field_type::u8, offsetof(T, ezStateBehaviorType_old), 1, 1, nullptr },
+        { "refType", field_type::u8, offsetof(T, refType), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 2, nullptr },
+        { "refId", field_type::s32, offsetof(T, refId), 4, 1, nullptr },
+        { "consumeSA", field_type::f32, offsetof(T, consumeSA), 4, 1, nullptr },
+        { "stamina", field_type::s32, offsetof(T, stamina), 4, 1, nullptr },
+        { "consumeDurability", field_type::s32, offsetof(T, consumeDurability), 4, 1, nullptr },
+        { "category", field_type::u8, offsetof(T, category), 1, 1, nullptr },
+        { "heroPoint", field_type::u8, offsetof(T, heroPoint), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 2, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, variationId) == 0);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, behaviorJudgeId) == 4);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, ezStateBehaviorType_old) == 8);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, refType) == 9);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, pad2) == 10);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, refId) == 12);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, consumeSA) == 16);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, stamina) == 20);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, consumeDurability) == 24);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, category) == 28);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, heroPoint) == 29);
+static_assert(offsetof(paramdef::BEHAVIOR_PARAM_ST, pad1) == 30);
+
+}; // namespace params
+}; // namespace from
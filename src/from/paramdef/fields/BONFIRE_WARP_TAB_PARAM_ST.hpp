@@ -0,0 +1,34 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../BONFIRE_WARP_TAB_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::BONFIRE_WARP_TAB_PARAM_ST> {
+    using T = paramdef::BONFIRE_WARP_TAB_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 7> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "textId", field_type::s32, offsetof(T, textId), 4, 1, nullptr },
+        { "sortId", field_type::s32, offsetof(T, sortId), 4, 1, nullptr },
+        { "iconId", field_type::u16, offsetof(T, iconId), 2, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 2, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::BONFIRE_WARP_TAB_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::BONFIRE_WARP_TAB_PARAM_ST, textId) == 4);
+static_assert(offsetof(paramdef::BONFIRE_WARP_TAB_PARAM_ST, sortId) == 8);
+static_assert(offsetof(paramdef::BONFIRE_WARP_TAB_PARAM_ST, iconId) == 12);
+static_assert(offsetof(paramdef::BONFIRE_WARP_TAB_PARAM_ST, pad) == 14);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,110 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../BUDDY_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::BUDDY_PARAM_ST> {
+    using T = paramdef::BUDDY_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 45> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "triggerSpEffectId", field_type::s32, offsetof(T, triggerSpEffectId), 4, 1, nullptr },
+        { "npcParamId", field_type::s32, offsetof(T, npcParamId), 4, 1, nullptr },
+        { "npcThinkParamId", field_type::s32, offsetof(T, npcThinkParamId), 4, 1, nullptr },
+        { "npcParamId_ridden", field_type::s32, offsetof(T, npcParamId_ridden), 4, 1, nullptr },
+        { "npcThinkParamId_ridden", field_type::s32, offsetof(T, npcThinkParamId_ridden), 4, 1, nullptr },
+        { "x_offset", field_type::f32, offsetof(T, x_offset), 4, 1, nullptr },
+        { "z_offset", field_type::f32, offsetof(T, z_offset), 4, 1, nullptr },
+        { "y_angle", field_type::f32, offsetof(T, y_angle), 4, 1, nullptr },
+        { "appearOnAroundSekihi", field_type::boolean, offsetof(T, appearOnAroundSekihi), 1, 1, nullptr },
+        { "disablePCTargetShare", field_type::boolean, offsetof(T, disablePCTargetShare), 1, 1, nullptr },
+        { "pcFollowType", field_type::u8, offsetof(T, pcFollowType), 1, 1, nullptr },
+        { "Reserve", field_type::u8, offsetof(T, Reserve), 1, 1, nullptr },
+        { "dopingSpEffect_lv0", field_type::s32, offsetof(T, dopingSpEffect_lv0), 4, 1, nullptr },
+        { "dopingSpEffect_lv1", field_type::s32, offsetof(T, dopingSpEffect_lv1), 4, 1, nullptr },
+        { "dopingSpEffect_lv2", field_type::s32, offsetof(T, dopingSpEffect_lv2), 4, 1, nullptr },
+        { "dopingSpEffect_lv3", field_type::s32, offsetof(T, dopingSpEffect_lv3), 4, 1, nullptr },
+        { "dopingSpEffect_lv4", field_type::s32, offsetof(T, dopingSpEffect_lv4), 4, 1, nullptr },
+        { "dopingSpEffect_lv5", field_type::s32, offsetof(T, dopingSpEffect_lv5), 4, 1, nullptr },
+        { "dopingSpEffect_lv6", field_type::s32, offsetof(T, dopingSpEffect_lv6), 4, 1, nullptr },
+        { "dopingSpEffect_lv7", field_type::s32, offsetof(T, dopingSpEffect_lv7), 4, 1, nullptr },
+        { "dopingSpEffect_lv8", field_type::s32, offsetof(T, dopingSpEffect_lv8), 4, 1, nullptr },
+        { "dopingSpEffect_lv9", field_type::s32, offsetof(T, dopingSpEffect_lv9), 4, 1, nullptr },
+        { "dopingSpEffect_lv10", field_type::s32, offsetof(T, dopingSpEffect_lv10), 4, 1, nullptr },
+        { "npcPlayerInitParamId", field_type::s32, offsetof(T, npcPlayerInitParamId), 4, 1, nullptr },
+        { "generateAnimId", field_type::s32, offsetof(T, generateAnimId), 4, 1, nullptr },
+        { "Unk1", field_type::u32, offsetof(T, Unk1), 4, 1, nullptr },
+        { "Unk2", field_type::u32, offsetof(T, Unk2), 4, 1, nullptr },
+        { "Unk3", field_type::s32, offsetof(T, Unk3), 4, 1, nullptr },
+        { "Unk4", field_type::s32, offsetof(T, Unk4), 4, 1, nullptr },
+        { "Unk5", field_type::s32, offsetof(T, Unk5), 4, 1, nullptr },
+        { "Unk6", field_type::s32, offsetof(T, Unk6), 4, 1, nullptr },
+        { "Unk7", field_type::s32, offsetof(T, Unk7), 4, 1, nullptr },
+        { "Unk8", field_type::s32, offsetof(T, Unk8), 4, 1, nullptr },
+        { "Unk9", field_type::s32, offsetof(T, Unk9), 4, 1, nullptr },
+        { "Unk10", field_type::s32, offsetof(T, Unk10), 4, 1, nullptr },
+        { "Unk11", field_type::u32, offsetof(T, Unk11), 4, 1, nullptr },
+        { "Unk12", field_type::s32, offsetof(T, Unk12), 4, 1, nullptr },
+        { "Unk13", field_type::s32, offsetof(T, Unk13), 4, 1, nullptr },
+        { "Unk14", field_type::s32, offsetof(T, Unk14), 4, 1, nullptr },
+        { "Unk15", field_type::s32, offsetof(T, Unk15), 4, 1, nullptr },
+        { "Unk16", field_type::s32, offsetof(T, Unk16), 4, 1, nullptr },
+        { "Unk17", field_type::u32, offsetof(T, Unk17), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, triggerSpEffectId) == 4);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, npcParamId) == 8);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, npcThinkParamId) == 12);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, npcParamId_ridden) == 16);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, npcThinkParamId_ridden) == 20);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, x_offset) == 24);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, z_offset) == 28);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, y_angle) == 32);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, appearOnAroundSekihi) == 36);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, disablePCTargetShare) == 37);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, pcFollowType) == 38);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Reserve) == 39);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv0) == 40);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv1) == 44);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv2) == 48);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv3) == 52);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv4) == 56);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv5) == 60);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv6) == 64);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv7) == 68);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv8) == 72);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv9) == 76);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, dopingSpEffect_lv10) == 80);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, npcPlayerInitParamId) == 84);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, generateAnimId) == 88);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk1) == 92);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk2) == 96);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk3) == 100);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk4) == 104);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk5) == 108);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk6) == 112);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk7) == 116);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk8) == 120);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk9) == 124);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk10) == 128);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk11) == 132);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk12) == 136);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk13) == 140);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk14) == 144);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk15) == 148);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk16) == 152);
+static_assert(offsetof(paramdef::BUDDY_PARAM_ST, Unk17) == 156);
+
+}; // namespace params
+}; // namespace from
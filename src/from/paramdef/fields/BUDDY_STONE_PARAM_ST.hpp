@@ -0,0 +1,50 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../BUDDY_STONE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::BUDDY_STONE_PARAM_ST> {
+    using T = paramdef::BUDDY_STONE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 16> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "talkChrEntityId", field_type::u32, offsetof(T, talkChrEntityId), 4, 1, nullptr },
+        { "eliminateTargetEntityId", field_type::u32, offsetof(T, eliminateTargetEntityId), 4, 1, nullptr },
+        { "summonedEventFlagId", field_type::u32, offsetof(T, summonedEventFlagId), 4, 1, nullptr },
+        { "isSpecial", field_type::boolean, 16, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSpecial; } },
+        { "pad1", field_type::u8, 16, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad1; } },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 3, nullptr },
+        { "buddyId", field_type::s32, offsetof(T, buddyId), 4, 1, nullptr },
+        { "dopingSpEffectId", field_type::s32, offsetof(T, dopingSpEffectId), 4, 1, nullptr },
+        { "activateRange", field_type::u16, offsetof(T, activateRange), 2, 1, nullptr },
+        { "overwriteReturnRange", field_type::s16, offsetof(T, overwriteReturnRange), 2, 1, nullptr },
+        { "overwriteActivateRegionEntityId", field_type::u32, offsetof(T, overwriteActivateRegionEntityId), 4, 1, nullptr },
+        { "warnRegionEntityId", field_type::u32, offsetof(T, warnRegionEntityId), 4, 1, nullptr },
+        { "pad3", field_type::u8, offsetof(T, pad3), 1, 24, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, talkChrEntityId) == 4);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, eliminateTargetEntityId) == 8);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, summonedEventFlagId) == 12);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, pad2) == 17);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, buddyId) == 20);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, dopingSpEffectId) == 24);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, activateRange) == 28);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, overwriteReturnRange) == 30);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, overwriteActivateRegionEntityId) == 32);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, warnRegionEntityId) == 36);
+static_assert(offsetof(paramdef::BUDDY_STONE_PARAM_ST, pad3) == 40);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,78 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../BUDGET_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::BUDGET_PARAM_ST> {
+    using T = paramdef::BUDGET_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 28> fields = {{
+        { "vram_all", field_type::f32, offsetof(T, vram_all), 4, 1, nullptr },
+        { "vram_mapobj_tex", field_type::f32, offsetof(T, vram_mapobj_tex), 4, 1, nullptr },
+        { "vram_mapobj_mdl", field_type::f32, offsetof(T, vram_mapobj_mdl), 4, 1, nullptr },
+        { "vram_map", field_type::f32, offsetof(T, vram_map), 4, 1, nullptr },
+        { "vram_chr", field_type::f32, offsetof(T, vram_chr), 4, 1, nullptr },
+        { "vram_parts", field_type::f32, offsetof(T, vram_parts), 4, 1, nullptr },
+        { "vram_sfx", field_type::f32, offsetof(T, vram_sfx), 4, 1, nullptr },
+        { "vram_chr_tex", field_type::f32, offsetof(T, vram_chr_tex), 4, 1, nullptr },
+        { "vram_chr_mdl", field_type::f32, offsetof(T, vram_chr_mdl), 4, 1, nullptr },
+        { "vram_parts_tex", field_type::f32, offsetof(T, vram_parts_tex), 4, 1, nullptr },
+        { "vram_parts_mdl", field_type::f32, offsetof(T, vram_parts_mdl), 4, 1, nullptr },
+        { "vram_sfx_tex", field_type::f32, offsetof(T, vram_sfx_tex), 4, 1, nullptr },
+        { "vram_sfx_mdl", field_type::f32, offsetof(T, vram_sfx_mdl), 4, 1, nullptr },
+        { "vram_gi", field_type::f32, offsetof(T, vram_gi), 4, 1, nullptr },
+        { "vram_menu_tex", field_type::f32, offsetof(T, vram_menu_tex), 4, 1, nullptr },
+        { "vram_decal_rt", field_type::f32, offsetof(T, vram_decal_rt), 4, 1, nullptr },
+        { "vram_decal", field_type::f32, offsetof(T, vram_decal), 4, 1, nullptr },
+        { "reserve_0", field_type::u8, offsetof(T, reserve_0), 1, 4, nullptr },
+        { "vram_other_tex", field_type::f32, offsetof(T, vram_other_tex), 4, 1, nullptr },
+        { "vram_other_mdl", field_type::f32, offsetof(T, vram_other_mdl), 4, 1, nullptr },
+        { "havok_anim", field_type::f32, offsetof(T, havok_anim), 4, 1, nullptr },
+        { "havok_ins", field_type::f32, offsetof(T, havok_ins), 4, 1, nullptr },
+        { "havok_hit", field_type::f32, offsetof(T, havok_hit), 4, 1, nullptr },
+        { "vram_other", field_type::f32, offsetof(T, vram_other), 4, 1, nullptr },
+        { "vram_detail_all", field_type::f32, offsetof(T, vram_detail_all), 4, 1, nullptr },
+        { "vram_chr_and_parts", field_type::f32, offsetof(T, vram_chr_and_parts), 4, 1, nullptr },
+        { "havok_navimesh", field_type::f32, offsetof(T, havok_navimesh), 4, 1, nullptr },
+        { "reserve_1", field_type::u8, offsetof(T, reserve_1), 1, 24, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_all) == 0);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_mapobj_tex) == 4);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_mapobj_mdl) == 8);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_map) == 12);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_chr) == 16);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_parts) == 20);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_sfx) == 24);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_chr_tex) == 28);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_chr_mdl) == 32);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_parts_tex) == 36);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_parts_mdl) == 40);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_sfx_tex) == 44);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_sfx_mdl) == 48);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_gi) == 52);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_menu_tex) == 56);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_decal_rt) == 60);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_decal) == 64);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, reserve_0) == 68);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_other_tex) == 72);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_other_mdl) == 76);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, havok_anim) == 80);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, havok_ins) == 84);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, havok_hit) == 88);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_other) == 92);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_detail_all) == 96);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, vram_chr_and_parts) == 100);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, havok_navimesh) == 104);
+static_assert(offsetof(paramdef::BUDGET_PARAM_ST, reserve_1) == 108);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,28 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../BULLET_CREATE_LIMIT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::BULLET_CREATE_LIMIT_PARAM_ST> {
+    using T = paramdef::BULLET_CREATE_LIMIT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "limitNum_byGroup", field_type::u8, offsetof(T, limitNum_byGroup), 1, 1, nullptr },
+        { "isLimitEachOwner", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isLimitEachOwner; } },
+        { "pad2", field_type::u8, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad2; } },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 30, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::BULLET_CREATE_LIMIT_PARAM_ST, limitNum_byGroup) == 0);
+static_assert(offsetof(paramdef::BULLET_CREATE_LIMIT_PARAM_ST, pad) == 2);
+
+}; // namespace params
+}; // namespace from
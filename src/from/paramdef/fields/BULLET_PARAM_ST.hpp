@@ -0,0 +1,230 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../BULLET_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::BULLET_PARAM_ST> {
+    using T = paramdef::BULLET_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 119> fields = {{
+        { "atkId_Bullet", field_type::s32, offsetof(T, atkId_Bullet), 4, 1, nullptr },
+        { "sfxId_Bullet", field_type::s32, offsetof(T, sfxId_Bullet), 4, 1, nullptr },
+        { "sfxId_Hit", field_type::s32, offsetof(T, sfxId_Hit), 4, 1, nullptr },
+        { "sfxId_Flick", field_type::s32, offsetof(T, sfxId_Flick), 4, 1, nullptr },
+        { "life", field_type::f32, offsetof(T, life), 4, 1, nullptr },
+        { "dist", field_type::f32, offsetof(T, dist), 4, 1, nullptr },
+        { "shootInterval", field_type::f32, offsetof(T, shootInterval), 4, 1, nullptr },
+        { "gravityInRange", field_type::f32, offsetof(T, gravityInRange), 4, 1, nullptr },
+        { "gravityOutRange", field_type::f32, offsetof(T, gravityOutRange), 4, 1, nullptr },
+        { "hormingStopRange", field_type::f32, offsetof(T, hormingStopRange), 4, 1, nullptr },
+        { "initVellocity", field_type::f32, offsetof(T, initVellocity), 4, 1, nullptr },
+        { "accelInRange", field_type::f32, offsetof(T, accelInRange), 4, 1, nullptr },
+        { "accelOutRange", field_type::f32, offsetof(T, accelOutRange), 4, 1, nullptr },
+        { "maxVellocity", field_type::f32, offsetof(T, maxVellocity), 4, 1, nullptr },
+        { "minVellocity", field_type::f32, offsetof(T, minVellocity), 4, 1, nullptr },
+        { "accelTime", field_type::f32, offsetof(T, accelTime), 4, 1, nullptr },
+        { "homingBeginDist", field_type::f32, offsetof(T, homingBeginDist), 4, 1, nullptr },
+        { "hitRadius", field_type::f32, offsetof(T, hitRadius), 4, 1, nullptr },
+        { "hitRadiusMax", field_type::f32, offsetof(T, hitRadiusMax), 4, 1, nullptr },
+        { "spreadTime", field_type::f32, offsetof(T, spreadTime), 4, 1, nullptr },
+        { "expDelay", field_type::f32, offsetof(T, expDelay), 4, 1, nullptr },
+        { "hormingOffsetRange", field_type::f32, offsetof(T, hormingOffsetRange), 4, 1, nullptr },
+        { "dmgHitRecordLifeTime", field_type::f32, offsetof(T, dmgHitRecordLifeTime), 4, 1, nullptr },
+        { "externalForce", field_type::f32, offsetof(T, externalForce), 4, 1, nullptr },
+        { "spEffectIDForShooter", field_type::s32, offsetof(T, spEffectIDForShooter), 4, 1, nullptr },
+        { "autoSearchNPCThinkID", field_type::s32, offsetof(T, autoSearchNPCThinkID), 4, 1, nullptr },
+        { "HitBulletID", field_type::s32, offsetof(T, HitBulletID), 4, 1, nullptr },
+        { "spEffectId0", field_type::s32, offsetof(T, spEffectId0), 4, 1, nullptr },
+        { "spEffectId1", field_type::s32, offsetof(T, spEffectId1), 4, 1, nullptr },
+        { "spEffectId2", field_type::s32, offsetof(T, spEffectId2), 4, 1, nullptr },
+        { "spEffectId3", field_type::s32, offsetof(T, spEffectId3), 4, 1, nullptr },
+        { "spEffectId4", field_type::s32, offsetof(T, spEffectId4), 4, 1, nullptr },
+        { "numShoot", field_type::u16, offsetof(T, numShoot), 2, 1, nullptr },
+        { "homingAngle", field_type::s16, offsetof(T, homingAngle), 2, 1, nullptr },
+        { "shootAngle", field_type::s16, offsetof(T, shootAngle), 2, 1, nullptr },
+        { "shootAngleInterval", field_type::s16, offsetof(T, shootAngleInterval), 2, 1, nullptr },
+        { "shootAngleXInterval", field_type::s16, offsetof(T, shootAngleXInterval), 2, 1, nullptr },
+        { "damageDamp", field_type::s8, offsetof(T, damageDamp), 1, 1, nullptr },
+        { "spelDamageDamp", field_type::s8, offsetof(T, spelDamageDamp), 1, 1, nullptr },
+        { "fireDamageDamp", field_type::s8, offsetof(T, fireDamageDamp), 1, 1, nullptr },
+        { "thunderDamageDamp", field_type::s8, offsetof(T, thunderDamageDamp), 1, 1, nullptr },
+        { "staminaDamp", field_type::s8, offsetof(T, staminaDamp), 1, 1, nullptr },
+        { "knockbackDamp", field_type::s8, offsetof(T, knockbackDamp), 1, 1, nullptr },
+        { "shootAngleXZ", field_type::s8, offsetof(T, shootAngleXZ), 1, 1, nullptr },
+        { "lockShootLimitAng", field_type::u8, offsetof(T, lockShootLimitAng), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 1, nullptr },
+        { "prevVelocityDirRate", field_type::u8, offsetof(T, prevVelocityDirRate), 1, 1, nullptr },
+        { "atkAttribute", field_type::u8, offsetof(T, atkAttribute), 1, 1, nullptr },
+        { "spAttribute", field_type::u8, offsetof(T, spAttribute), 1, 1, nullptr },
+        { "Material_AttackType", field_type::u8, offsetof(T, Material_AttackType), 1, 1, nullptr },
+        { "Material_AttackMaterial", field_type::u8, offsetof(T, Material_AttackMaterial), 1, 1, nullptr },
+        { "isPenetrateChr", field_type::boolean, 152, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isPenetrateChr; } },
+        { "isPenetrateObj", field_type::boolean, 152, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isPenetrateObj; } },
+        { "pad", field_type::u8, 152, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad; } },
+        { "launchConditionType", field_type::u8, offsetof(T, launchConditionType), 1, 1, nullptr },
+        { "FollowType", field_type::u8, 154, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->FollowType; } },
+        { "EmittePosType", field_type::u8, 154, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->EmittePosType; } },
+        { "isAttackSFX", field_type::boolean, 154, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAttackSFX; } },
+        { "isEndlessHit", field_type::boolean, 154, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEndlessHit; } },
+        { "isPenetrateMap", field_type::boolean, 155, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isPenetrateMap; } },
+        { "isHitBothTeam", field_type::boolean, 155, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHitBothTeam; } },
+        { "isUseSharedHitList", field_type::boolean, 155, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseSharedHitList; } },
+        { "isUseMultiDmyPolyIfPlace", field_type::boolean, 155, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseMultiDmyPolyIfPlace; } },
+        { "isHitOtherBulletForceEraseA", field_type::boolean, 155, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHitOtherBulletForceEraseA; } },
+        { "isHitOtherBulletForceEraseB", field_type::boolean, 155, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHitOtherBulletForceEraseB; } },
+        { "isHitForceMagic", field_type::boolean, 155, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHitForceMagic; } },
+        { "isIgnoreSfxIfHitWater", field_type::boolean, 155, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isIgnoreSfxIfHitWater; } },
+        { "isIgnoreMoveStateIfHitWater", field_type::boolean, 156, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isIgnoreMoveStateIfHitWater; } },
+        { "isHitDarkForceMagic", field_type::boolean, 156, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHitDarkForceMagic; } },
+        { "dmgCalcSide", field_type::u8, 156, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->dmgCalcSide; } },
+        { "isEnableAutoHoming", field_type::boolean, 156, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableAutoHoming; } },
+        { "isSyncBulletCulcDumypolyPos", field_type::boolean, 156, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSyncBulletCulcDumypolyPos; } },
+        { "isOwnerOverrideInitAngle", field_type::boolean, 156, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isOwnerOverrideInitAngle; } },
+        { "isInheritSfxToChild", field_type::boolean, 156, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isInheritSfxToChild; } },
+        { "darkDamageDamp", field_type::s8, offsetof(T, darkDamageDamp), 1, 1, nullptr },
+        { "bulletSfxDeleteType_byHit", field_type::s8, offsetof(T, bulletSfxDeleteType_byHit), 1, 1, nullptr },
+        { "bulletSfxDeleteType_byLifeDead", field_type::s8, offsetof(T, bulletSfxDeleteType_byLifeDead), 1, 1, nullptr },
+        { "targetYOffsetRange", field_type::f32, offsetof(T, targetYOffsetRange), 4, 1, nullptr },
+        { "shootAngleYMaxRandom", field_type::f32, offsetof(T, shootAngleYMaxRandom), 4, 1, nullptr },
+        { "shootAngleXMaxRandom", field_type::f32, offsetof(T, shootAngleXMaxRandom), 4, 1, nullptr },
+        { "intervalCreateBulletId", field_type::s32, offsetof(T, intervalCreateBulletId), 4, 1, nullptr },
+        { "intervalCreateTimeMin", field_type::f32, offsetof(T, intervalCreateTimeMin), 4, 1, nullptr },
+        { "intervalCreateTimeMax", field_type::f32, offsetof(T, intervalCreateTimeMax), 4, 1, nullptr },
+        { "predictionShootObserveTime", field_type::f32, offsetof(T, predictionShootObserveTime), 4, 1, nullptr },
+        { "intervalCreateWaitTime", field_type::f32, offsetof(T, intervalCreateWaitTime), 4, 1, nullptr },
+        { "sfxPostureType", field_type::u8, offsetof(T, sfxPostureType), 1, 1, nullptr },
+        { "createLimitGroupId", field_type::u8, offsetof(T, createLimitGroupId), 1, 1, nullptr },
+        { "pad5", field_type::u8, offsetof(T, pad5), 1, 1, nullptr },
+        { "isInheritSpeedToChild", field_type::boolean, 195, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isInheritSpeedToChild; } },
+        { "isDisableHitSfx_byChrAndObj", field_type::boolean, 195, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableHitSfx_byChrAndObj; } },
+        { "isCheckWall_byCenterRay", field_type::boolean, 195, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isCheckWall_byCenterRay; } },
+        { "isHitFlare", field_type::boolean, 195, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHitFlare; } },
+        { "isUseBulletWallFilter", field_type::boolean, 195, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseBulletWallFilter; } },
+        { "pad1", field_type::u8, 195, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad1; } },
+        { "isNonDependenceMagicForFunnleNum", field_type::boolean, 195, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isNonDependenceMagicForFunnleNum; } },
+        { "isAiInterruptShootNoDamageBullet", field_type::boolean, 195, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAiInterruptShootNoDamageBullet; } },
+        { "randomCreateRadius", field_type::f32, offsetof(T, randomCreateRadius), 4, 1, nullptr },
+        { "followOffset_BaseHeight", field_type::f32, offsetof(T, followOffset_BaseHeight), 4, 1, nullptr },
+        { "assetNo_Hit", field_type::s32, offsetof(T, assetNo_Hit), 4, 1, nullptr },
+        { "lifeRandomRange", field_type::f32, offsetof(T, lifeRandomRange), 4, 1, nullptr },
+        { "homingAngleX", field_type::s16, offsetof(T, homingAngleX), 2, 1, nullptr },
+        { "ballisticCalcType", field_type::u8, offsetof(T, ballisticCalcType), 1, 1, nullptr },
+        { "attachEffectType", field_type::u8, offsetof(T, attachEffectType), 1, 1, nullptr },
+        { "seId_Bullet1", field_type::s32, offsetof(T, seId_Bullet1), 4, 1, nullptr },
+        { "seId_Bullet2", field_type::s32, offsetof(T, seId_Bullet2), 4, 1, nullptr },
+        { "seId_Hit", field_type::s32, offsetof(T, seId_Hit), 4, 1, nullptr },
+        { "seId_Flick", field_type::s32, offsetof(T, seId_Flick), 4, 1, nullptr },
+        { "howitzerShootAngleXMin", field_type::s16, offsetof(T, howitzerShootAngleXMin), 2, 1, nullptr },
+        { "howitzerShootAngleXMax", field_type::s16, offsetof(T, howitzerShootAngleXMax), 2, 1, nullptr },
+        { "howitzerInitMinVelocity", field_type::f32, offsetof(T, howitzerInitMinVelocity), 4, 1, nullptr },
+        { "howitzerInitMaxVelocity", field_type::f32, offsetof(T, howitzerInitMaxVelocity), 4, 1, nullptr },
+        { "sfxId_ForceErase", field_type::s32, offsetof(T, sfxId_ForceErase), 4, 1, nullptr },
+        { "bulletSfxDeleteType_byForceErase", field_type::s8, offsetof(T, bulletSfxDeleteType_byForceErase), 1, 1, nullptr },
+        { "pad3", field_type::u8, offsetof(T, pad3), 1, 1, nullptr },
+        { "followDmypoly_forSfxPose", field_type::s16, offsetof(T, followDmypoly_forSfxPose), 2, 1, nullptr },
+        { "followOffset_Radius", field_type::f32, offsetof(T, followOffset_Radius), 4, 1, nullptr },
+        { "spBulletDistUpRate", field_type::f32, offsetof(T, spBulletDistUpRate), 4, 1, nullptr },
+        { "nolockTargetDist", field_type::f32, offsetof(T, nolockTargetDist), 4, 1, nullptr },
+        { "pad4", field_type::u8, offsetof(T, pad4), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, atkId_Bullet) == 0);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, sfxId_Bullet) == 4);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, sfxId_Hit) == 8);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, sfxId_Flick) == 12);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, life) == 16);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, dist) == 20);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, shootInterval) == 24);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, gravityInRange) == 28);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, gravityOutRange) == 32);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, hormingStopRange) == 36);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, initVellocity) == 40);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, accelInRange) == 44);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, accelOutRange) == 48);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, maxVellocity) == 52);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, minVellocity) == 56);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, accelTime) == 60);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, homingBeginDist) == 64);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, hitRadius) == 68);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, hitRadiusMax) == 72);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, spreadTime) == 76);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, expDelay) == 80);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, hormingOffsetRange) == 84);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, dmgHitRecordLifeTime) == 88);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, externalForce) == 92);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, spEffectIDForShooter) == 96);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, autoSearchNPCThinkID) == 100);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, HitBulletID) == 104);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, spEffectId0) == 108);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, spEffectId1) == 112);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, spEffectId2) == 116);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, spEffectId3) == 120);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, spEffectId4) == 124);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, numShoot) == 128);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, homingAngle) == 130);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, shootAngle) == 132);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, shootAngleInterval) == 134);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, shootAngleXInterval) == 136);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, damageDamp) == 138);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, spelDamageDamp) == 139);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, fireDamageDamp) == 140);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, thunderDamageDamp) == 141);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, staminaDamp) == 142);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, knockbackDamp) == 143);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, shootAngleXZ) == 144);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, lockShootLimitAng) == 145);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, pad2) == 146);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, prevVelocityDirRate) == 147);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, atkAttribute) == 148);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, spAttribute) == 149);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, Material_AttackType) == 150);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, Material_AttackMaterial) == 151);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, launchConditionType) == 153);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, darkDamageDamp) == 157);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, bulletSfxDeleteType_byHit) == 158);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, bulletSfxDeleteType_byLifeDead) == 159);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, targetYOffsetRange) == 160);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, shootAngleYMaxRandom) == 164);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, shootAngleXMaxRandom) == 168);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, intervalCreateBulletId) == 172);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, intervalCreateTimeMin) == 176);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, intervalCreateTimeMax) == 180);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, predictionShootObserveTime) == 184);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, intervalCreateWaitTime) == 188);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, sfxPostureType) == 192);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, createLimitGroupId) == 193);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, pad5) == 194);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, randomCreateRadius) == 196);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, followOffset_BaseHeight) == 200);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, assetNo_Hit) == 204);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, lifeRandomRange) == 208);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, homingAngleX) == 212);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, ballisticCalcType) == 214);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, attachEffectType) == 215);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, seId_Bullet1) == 216);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, seId_Bullet2) == 220);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, seId_Hit) == 224);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, seId_Flick) == 228);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, howitzerShootAngleXMin) == 232);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, howitzerShootAngleXMax) == 234);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, howitzerInitMinVelocity) == 236);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, howitzerInitMaxVelocity) == 240);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, sfxId_ForceErase) == 244);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, bulletSfxDeleteType_byForceErase) == 248);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, pad3) == 249);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, followDmypoly_forSfxPose) == 250);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, followOffset_Radius) == 252);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, spBulletDistUpRate) == 256);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, nolockTargetDist) == 260);
+static_assert(offsetof(paramdef::BULLET_PARAM_ST, pad4) == 264);
+
+}; // namespace params
+}; // namespace from
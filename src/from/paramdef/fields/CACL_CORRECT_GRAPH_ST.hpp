@@ -0,0 +1,62 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CACL_CORRECT_GRAPH_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CACL_CORRECT_GRAPH_ST> {
+    using T = paramdef::CACL_CORRECT_GRAPH_ST;
+
+    static constexpr std::array<field_descriptor, 20> fields = {{
+        { "stageMaxVal0", field_type::f32, offsetof(T, stageMaxVal0), 4, 1, nullptr },
+        { "stageMaxVal1", field_type::f32, offsetof(T, stageMaxVal1), 4, 1, nullptr },
+        { "stageMaxVal2", field_type::f32, offsetof(T, stageMaxVal2), 4, 1, nullptr },
+        { "stageMaxVal3", field_type::f32, offsetof(T, stageMaxVal3), 4, 1, nullptr },
+        { "stageMaxVal4", field_type::f32, offsetof(T, stageMaxVal4), 4, 1, nullptr },
+        { "stageMaxGrowVal0", field_type::f32, offsetof(T, stageMaxGrowVal0), 4, 1, nullptr },
+        { "stageMaxGrowVal1", field_type::f32, offsetof(T, stageMaxGrowVal1), 4, 1, nullptr },
+        { "stageMaxGrowVal2", field_type::f32, offsetof(T, stageMaxGrowVal2), 4, 1, nullptr },
+        { "stageMaxGrowVal3", field_type::f32, offsetof(T, stageMaxGrowVal3), 4, 1, nullptr },
+        { "stageMaxGrowVal4", field_type::f32, offsetof(T, stageMaxGrowVal4), 4, 1, nullptr },
+        { "adjPt_maxGrowVal0", field_type::f32, offsetof(T, adjPt_maxGrowVal0), 4, 1, nullptr },
+        { "adjPt_maxGrowVal1", field_type::f32, offsetof(T, adjPt_maxGrowVal1), 4, 1, nullptr },
+        { "adjPt_maxGrowVal2", field_type::f32, offsetof(T, adjPt_maxGrowVal2), 4, 1, nullptr },
+        { "adjPt_maxGrowVal3", field_type::f32, offsetof(T, adjPt_maxGrowVal3), 4, 1, nullptr },
+        { "adjPt_maxGrowVal4", field_type::f32, offsetof(T, adjPt_maxGrowVal4), 4, 1, nullptr },
+        { "init_inclination_soul", field_type::f32, offsetof(T, init_inclination_soul), 4, 1, nullptr },
+        { "adjustment_value", field_type::f32, offsetof(T, adjustment_value), 4, 1, nullptr },
+        { "boundry_inclination_soul", field_type::f32, offsetof(T, boundry_inclination_soul), 4, 1, nullptr },
+        { "boundry_value", field_type::f32, offsetof(T, boundry_value), 4, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, stageMaxVal0) == 0);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, stageMaxVal1) == 4);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, stageMaxVal2) == 8);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, stageMaxVal3) == 12);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, stageMaxVal4) == 16);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, stageMaxGrowVal0) == 20);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, stageMaxGrowVal1) == 24);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, stageMaxGrowVal2) == 28);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, stageMaxGrowVal3) == 32);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, stageMaxGrowVal4) == 36);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, adjPt_maxGrowVal0) == 40);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, adjPt_maxGrowVal1) == 44);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, adjPt_maxGrowVal2) == 48);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, adjPt_maxGrowVal3) == 52);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, adjPt_maxGrowVal4) == 56);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, init_inclination_soul) == 60);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, adjustment_value) == 64);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, boundry_inclination_soul) == 68);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, boundry_value) == 72);
+static_assert(offsetof(paramdef::CACL_CORRECT_GRAPH_ST, pad) == 76);
+
+}; // namespace params
+}; // namespace from
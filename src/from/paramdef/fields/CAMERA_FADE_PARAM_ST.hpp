@@ -0,0 +1,34 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CAMERA_FADE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CAMERA_FADE_PARAM_ST> {
+    using T = paramdef::CAMERA_FADE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 6> fields = {{
+        { "NearMinDist", field_type::f32, offsetof(T, NearMinDist), 4, 1, nullptr },
+        { "NearMaxDist", field_type::f32, offsetof(T, NearMaxDist), 4, 1, nullptr },
+        { "FarMinDist", field_type::f32, offsetof(T, FarMinDist), 4, 1, nullptr },
+        { "FarMaxDist", field_type::f32, offsetof(T, FarMaxDist), 4, 1, nullptr },
+        { "MiddleAlpha", field_type::f32, offsetof(T, MiddleAlpha), 4, 1, nullptr },
+        { "dummy", field_type::u8, offsetof(T, dummy), 1, 12, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CAMERA_FADE_PARAM_ST, NearMinDist) == 0);
+static_assert(offsetof(paramdef::CAMERA_FADE_PARAM_ST, NearMaxDist) == 4);
+static_assert(offsetof(paramdef::CAMERA_FADE_PARAM_ST, FarMinDist) == 8);
+static_assert(offsetof(paramdef::CAMERA_FADE_PARAM_ST, FarMaxDist) == 12);
+static_assert(offsetof(paramdef::CAMERA_FADE_PARAM_ST, MiddleAlpha) == 16);
+static_assert(offsetof(paramdef::CAMERA_FADE_PARAM_ST, dummy) == 20);
+
+}; // namespace params
+}; // namespace from
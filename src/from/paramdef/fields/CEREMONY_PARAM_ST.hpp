@@ -0,0 +1,34 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CEREMONY_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CEREMONY_PARAM_ST> {
+    using T = paramdef::CEREMONY_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 6> fields = {{
+        { "eventLayerId", field_type::s32, offsetof(T, eventLayerId), 4, 1, nullptr },
+        { "mapStudioLayerId", field_type::s32, offsetof(T, mapStudioLayerId), 4, 1, nullptr },
+        { "multiPlayAreaOffset", field_type::s32, offsetof(T, multiPlayAreaOffset), 4, 1, nullptr },
+        { "overrideMapPlaceNameId", field_type::s32, offsetof(T, overrideMapPlaceNameId), 4, 1, nullptr },
+        { "overrideSaveMapNameId", field_type::s32, offsetof(T, overrideSaveMapNameId), 4, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 16, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CEREMONY_PARAM_ST, eventLayerId) == 0);
+static_assert(offsetof(paramdef::CEREMONY_PARAM_ST, mapStudioLayerId) == 4);
+static_assert(offsetof(paramdef::CEREMONY_PARAM_ST, multiPlayAreaOffset) == 8);
+static_assert(offsetof(paramdef::CEREMONY_PARAM_ST, overrideMapPlaceNameId) == 12);
+static_assert(offsetof(paramdef::CEREMONY_PARAM_ST, overrideSaveMapNameId) == 16);
+static_assert(offsetof(paramdef::CEREMONY_PARAM_ST, pad2) == 20);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,247 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CHARACTER_INIT_PARAM.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CHARACTER_INIT_PARAM> {
+    using T = paramdef::CHARACTER_INIT_PARAM;
+
+    static constexpr std::array<field_descriptor, 114> fields = {{
+        { "baseRec_mp", field_type::f32, offsetof(T, baseRec_mp), 4, 1, nullptr },
+        { "baseRec_sp", field_type::f32, offsetof(T, baseRec_sp), 4, 1, nullptr },
+        { "red_Falldam", field_type::f32, offsetof(T, red_Falldam), 4, 1, nullptr },
+        { "soul", field_type::s32, offsetof(T, soul), 4, 1, nullptr },
+        { "equip_Wep_Right", field_type::s32, offsetof(T, equip_Wep_Right), 4, 1, nullptr },
+        { "equip_Subwep_Right", field_type::s32, offsetof(T, equip_Subwep_Right), 4, 1, nullptr },
+        { "equip_Wep_Left", field_type::s32, offsetof(T, equip_Wep_Left), 4, 1, nullptr },
+        { "equip_Subwep_Left", field_type::s32, offsetof(T, equip_Subwep_Left), 4, 1, nullptr },
+        { "equip_Helm", field_type::s32, offsetof(T, equip_Helm), 4, 1, nullptr },
+        { "equip_Armer", field_type::s32, offsetof(T, equip_Armer), 4, 1, nullptr },
+        { "equip_Gaunt", field_type::s32, offsetof(T, equip_Gaunt), 4, 1, nullptr },
+        { "equip_Leg", field_type::s32, offsetof(T, equip_Leg), 4, 1, nullptr },
+        { "equip_Arrow", field_type::s32, offsetof(T, equip_Arrow), 4, 1, nullptr },
+        { "equip_Bolt", field_type::s32, offsetof(T, equip_Bolt), 4, 1, nullptr },
+        { "equip_SubArrow", field_type::s32, offsetof(T, equip_SubArrow), 4, 1, nullptr },
+        { "equip_SubBolt", field_type::s32, offsetof(T, equip_SubBolt), 4, 1, nullptr },
+        { "equip_Accessory01", field_type::s32, offsetof(T, equip_Accessory01), 4, 1, nullptr },
+        { "equip_Accessory02", field_type::s32, offsetof(T, equip_Accessory02), 4, 1, nullptr },
+        { "equip_Accessory03", field_type::s32, offsetof(T, equip_Accessory03), 4, 1, nullptr },
+        { "equip_Accessory04", field_type::s32, offsetof(T, equip_Accessory04), 4, 1, nullptr },
+        { "pad8", field_type::u8, offsetof(T, pad8), 1, 4, nullptr },
+        { "elixir_material00", field_type::s32, offsetof(T, elixir_material00), 4, 1, nullptr },
+        { "elixir_material01", field_type::s32, offsetof(T, elixir_material01), 4, 1, nullptr },
+        { "elixir_material02", field_type::s32, offsetof(T, elixir_material02), 4, 1, nullptr },
+        { "equip_Spell_01", field_type::s32, offsetof(T, equip_Spell_01), 4, 1, nullptr },
+        { "equip_Spell_02", field_type::s32, offsetof(T, equip_Spell_02), 4, 1, nullptr },
+        { "equip_Spell_03", field_type::s32, offsetof(T, equip_Spell_03), 4, 1, nullptr },
+        { "equip_Spell_04", field_type::s32, offsetof(T, equip_Spell_04), 4, 1, nullptr },
+        { "equip_Spell_05", field_type::s32, offsetof(T, equip_Spell_05), 4, 1, nullptr },
+        { "equip_Spell_06", field_type::s32, offsetof(T, equip_Spell_06), 4, 1, nullptr },
+        { "equip_Spell_07", field_type::s32, offsetof(T, equip_Spell_07), 4, 1, nullptr },
+        { "item_01", field_type::s32, offsetof(T, item_01), 4, 1, nullptr },
+        { "item_02", field_type::s32, offsetof(T, item_02), 4, 1, nullptr },
+        { "item_03", field_type::s32, offsetof(T, item_03), 4, 1, nullptr },
+        { "item_04", field_type::s32, offsetof(T, item_04), 4, 1, nullptr },
+        { "item_05", field_type::s32, offsetof(T, item_05), 4, 1, nullptr },
+        { "item_06", field_type::s32, offsetof(T, item_06), 4, 1, nullptr },
+        { "item_07", field_type::s32, offsetof(T, item_07), 4, 1, nullptr },
+        { "item_08", field_type::s32, offsetof(T, item_08), 4, 1, nullptr },
+        { "item_09", field_type::s32, offsetof(T, item_09), 4, 1, nullptr },
+        { "item_10", field_type::s32, offsetof(T, item_10), 4, 1, nullptr },
+        { "npcPlayerFaceGenId", field_type::s32, offsetof(T, npcPlayerFaceGenId), 4, 1, nullptr },
+        { "npcPlayerThinkId", field_type::s32, offsetof(T, npcPlayerThinkId), 4, 1, nullptr },
+        { "baseHp", field_type::u16, offsetof(T, baseHp), 2, 1, nullptr },
+        { "baseMp", field_type::u16, offsetof(T, baseMp), 2, 1, nullptr },
+        { "baseSp", field_type::u16, offsetof(T, baseSp), 2, 1, nullptr },
+        { "arrowNum", field_type::u16, offsetof(T, arrowNum), 2, 1, nullptr },
+        { "boltNum", field_type::u16, offsetof(T, boltNum), 2, 1, nullptr },
+        { "subArrowNum", field_type::u16, offsetof(T, subArrowNum), 2, 1, nullptr },
+        { "subBoltNum", field_type::u16, offsetof(T, subBoltNum), 2, 1, nullptr },
+        { "pad4", field_type::u8, offsetof(T, pad4), 1, 6, nullptr },
+        { "soulLv", field_type::s16, offsetof(T, soulLv), 2, 1, nullptr },
+        { "baseVit", field_type::u8, offsetof(T, baseVit), 1, 1, nullptr },
+        { "baseWil", field_type::u8, offsetof(T, baseWil), 1, 1, nullptr },
+        { "baseEnd", field_type::u8, offsetof(T, baseEnd), 1, 1, nullptr },
+        { "baseStr", field_type::u8, offsetof(T, baseStr), 1, 1, nullptr },
+        { "baseDex", field_type::u8, offsetof(T, baseDex), 1, 1, nullptr },
+        { "baseMag", field_type::u8, offsetof(T, baseMag), 1, 1, nullptr },
+        { "baseFai", field_type::u8, offsetof(T, baseFai), 1, 1, nullptr },
+        { "baseLuc", field_type::u8, offsetof(T, baseLuc), 1, 1, nullptr },
+        { "baseHeroPoint", field_type::u8, offsetof(T, baseHeroPoint), 1, 1, nullptr },
+        { "baseDurability", field_type::u8, offsetof(T, baseDurability), 1, 1, nullptr },
+        { "itemNum_01", field_type::u8, offsetof(T, itemNum_01), 1, 1, nullptr },
+        { "itemNum_02", field_type::u8, offsetof(T, itemNum_02), 1, 1, nullptr },
+        { "itemNum_03", field_type::u8, offsetof(T, itemNum_03), 1, 1, nullptr },
+        { "itemNum_04", field_type::u8, offsetof(T, itemNum_04), 1, 1, nullptr },
+        { "itemNum_05", field_type::u8, offsetof(T, itemNum_05), 1, 1, nullptr },
+        { "itemNum_06", field_type::u8, offsetof(T, itemNum_06), 1, 1, nullptr },
+        { "itemNum_07", field_type::u8, offsetof(T, itemNum_07), 1, 1, nullptr },
+        { "itemNum_08", field_type::u8, offsetof(T, itemNum_08), 1, 1, nullptr },
+        { "itemNum_09", field_type::u8, offsetof(T, itemNum_09), 1, 1, nullptr },
+        { "itemNum_10", field_type::u8, offsetof(T, itemNum_10), 1, 1, nullptr },
+        { "pad5", field_type::u8, offsetof(T, pad5), 1, 5, nullptr },
+        { "gestureId0", field_type::s8, offsetof(T, gestureId0), 1, 1, nullptr },
+        { "gestureId1", field_type::s8, offsetof(T, gestureId1), 1, 1, nullptr },
+        { "gestureId2", field_type::s8, offsetof(T, gestureId2), 1, 1, nullptr },
+        { "gestureId3", field_type::s8, offsetof(T, gestureId3), 1, 1, nullptr },
+        { "gestureId4", field_type::s8, offsetof(T, gestureId4), 1, 1, nullptr },
+        { "gestureId5", field_type::s8, offsetof(T, gestureId5), 1, 1, nullptr },
+        { "gestureId6", field_type::s8, offsetof(T, gestureId6), 1, 1, nullptr },
+        { "npcPlayerType", field_type::u8, offsetof(T, npcPlayerType), 1, 1, nullptr },
+        { "npcPlayerDrawType", field_type::s8, offsetof(T, npcPlayerDrawType), 1, 1, nullptr },
+        { "npcPlayerSex", field_type::u8, offsetof(T, npcPlayerSex), 1, 1, nullptr },
+        { "vowType", field_type::u8, 229, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType; } },
+        { "isSyncTarget", field_type::boolean, 229, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSyncTarget; } },
+        { "pad", field_type::u8, 229, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad; } },
+        { "pad6", field_type::u8, offsetof(T, pad6), 1, 2, nullptr },
+        { "wepParamType_Right1", field_type::u8, offsetof(T, wepParamType_Right1), 1, 1, nullptr },
+        { "wepParamType_Right2", field_type::u8, offsetof(T, wepParamType_Right2), 1, 1, nullptr },
+        { "wepParamType_Right3", field_type::u8, offsetof(T, wepParamType_Right3), 1, 1, nullptr },
+        { "wepParamType_Left1", field_type::u8, offsetof(T, wepParamType_Left1), 1, 1, nullptr },
+        { "wepParamType_Left2", field_type::u8, offsetof(T, wepParamType_Left2), 1, 1, nullptr },
+        { "wepParamType_Left3", field_type::u8, offsetof(T, wepParamType_Left3), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 26, nullptr },
+        { "equip_Subwep_Right3", field_type::s32, offsetof(T, equip_Subwep_Right3), 4, 1, nullptr },
+        { "equip_Subwep_Left3", field_type::s32, offsetof(T, equip_Subwep_Left3), 4, 1, nullptr },
+        { "pad3", field_type::u8, offsetof(T, pad3), 1, 4, nullptr },
+        { "secondaryItem_01", field_type::s32, offsetof(T, secondaryItem_01), 4, 1, nullptr },
+        { "secondaryItem_02", field_type::s32, offsetof(T, secondaryItem_02), 4, 1, nullptr },
+        { "secondaryItem_03", field_type::s32, offsetof(T, secondaryItem_03), 4, 1, nullptr },
+        { "secondaryItem_04", field_type::s32, offsetof(T, secondaryItem_04), 4, 1, nullptr },
+        { "secondaryItem_05", field_type::s32, offsetof(T, secondaryItem_05), 4, 1, nullptr },
+        { "secondaryItem_06", field_type::s32, offsetof(T, secondaryItem_06), 4, 1, nullptr },
+        { "secondaryItemNum_01", field_type::u8, offsetof(T, secondaryItemNum_01), 1, 1, nullptr },
+        { "secondaryItemNum_02", field_type::u8, offsetof(T, secondaryItemNum_02), 1, 1, nullptr },
+        { "secondaryItemNum_03", field_type::u8, offsetof(T, secondaryItemNum_03), 1, 1, nullptr },
+        { "secondaryItemNum_04", field_type::u8, offsetof(T, secondaryItemNum_04), 1, 1, nullptr },
+        { "secondaryItemNum_05", field_type::u8, offsetof(T, secondaryItemNum_05), 1, 1, nullptr },
+        { "secondaryItemNum_06", field_type::u8, offsetof(T, secondaryItemNum_06), 1, 1, nullptr },
+        { "HpEstMax", field_type::s8, offsetof(T, HpEstMax), 1, 1, nullptr },
+        { "MpEstMax", field_type::s8, offsetof(T, MpEstMax), 1, 1, nullptr },
+        { "pad7", field_type::u8, offsetof(T, pad7), 1, 5, nullptr },
+        { "voiceType", field_type::u8, offsetof(T, voiceType), 1, 1, nullptr },
+        { "reserve", field_type::u8, offsetof(T, reserve), 1, 6, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseRec_mp) == 0);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseRec_sp) == 4);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, red_Falldam) == 8);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, soul) == 12);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Wep_Right) == 16);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Subwep_Right) == 20);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Wep_Left) == 24);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Subwep_Left) == 28);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Helm) == 32);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Armer) == 36);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Gaunt) == 40);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Leg) == 44);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Arrow) == 48);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Bolt) == 52);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_SubArrow) == 56);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_SubBolt) == 60);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Accessory01) == 64);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Accessory02) == 68);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Accessory03) == 72);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Accessory04) == 76);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, pad8) == 80);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, elixir_material00) == 84);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, elixir_material01) == 88);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, elixir_material02) == 92);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Spell_01) == 96);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Spell_02) == 100);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Spell_03) == 104);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Spell_04) == 108);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Spell_05) == 112);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Spell_06) == 116);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Spell_07) == 120);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, item_01) == 124);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, item_02) == 128);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, item_03) == 132);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, item_04) == 136);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, item_05) == 140);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, item_06) == 144);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, item_07) == 148);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, item_08) == 152);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, item_09) == 156);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, item_10) == 160);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, npcPlayerFaceGenId) == 164);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, npcPlayerThinkId) == 168);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseHp) == 172);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseMp) == 174);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseSp) == 176);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, arrowNum) == 178);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, boltNum) == 180);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, subArrowNum) == 182);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, subBoltNum) == 184);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, pad4) == 186);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, soulLv) == 192);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseVit) == 194);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseWil) == 195);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseEnd) == 196);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseStr) == 197);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseDex) == 198);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseMag) == 199);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseFai) == 200);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseLuc) == 201);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseHeroPoint) == 202);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, baseDurability) == 203);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, itemNum_01) == 204);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, itemNum_02) == 205);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, itemNum_03) == 206);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, itemNum_04) == 207);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, itemNum_05) == 208);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, itemNum_06) == 209);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, itemNum_07) == 210);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, itemNum_08) == 211);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, itemNum_09) == 212);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, itemNum_10) == 213);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, pad5) == 214);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, gestureId0) == 219);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, gestureId1) == 220);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, gestureId2) == 221);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, gestureId3) == 222);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, gestureId4) == 223);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, gestureId5) == 224);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, gestureId6) == 225);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, npcPlayerType) == 226);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, npcPlayerDrawType) == 227);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, npcPlayerSex) == 228);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, pad6) == 230);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, wepParamType_Right1) == 232);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, wepParamType_Right2) == 233);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, wepParamType_Right3) == 234);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, wepParamType_Left1) == 235);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, wepParamType_Left2) == 236);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, wepParamType_Left3) == 237);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, pad2) == 238);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Subwep_Right3) == 264);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, equip_Subwep_Left3) == 268);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, pad3) == 272);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItem_01) == 276);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItem_02) == 280);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItem_03) == 284);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItem_04) == 288);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItem_05) == 292);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItem_06) == 296);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItemNum_01) == 300);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItemNum_02) == 301);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItemNum_03) == 302);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItemNum_04) == 303);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItemNum_05) == 304);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, secondaryItemNum_06) == 305);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, HpEstMax) == 306);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, MpEstMax) == 307);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, pad7) == 308);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, voiceType) == 313);
+static_assert(offsetof(paramdef::CHARACTER_INIT_PARAM, reserve) == 314);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,48 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CHARMAKEMENUTOP_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CHARMAKEMENUTOP_PARAM_ST> {
+    using T = paramdef::CHARMAKEMENUTOP_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 13> fields = {{
+        { "commandType", field_type::s32, offsetof(T, commandType), 4, 1, nullptr },
+        { "captionId", field_type::s32, offsetof(T, captionId), 4, 1, nullptr },
+        { "faceParamId", field_type::s32, offsetof(T, faceParamId), 4, 1, nullptr },
+        { "tableId", field_type::s32, offsetof(T, tableId), 4, 1, nullptr },
+        { "viewCondition", field_type::s32, offsetof(T, viewCondition), 4, 1, nullptr },
+        { "previewMode", field_type::s8, offsetof(T, previewMode), 1, 1, nullptr },
+        { "reserved2", field_type::u8, offsetof(T, reserved2), 1, 3, nullptr },
+        { "tableId2", field_type::s32, offsetof(T, tableId2), 4, 1, nullptr },
+        { "refFaceParamId", field_type::s32, offsetof(T, refFaceParamId), 4, 1, nullptr },
+        { "refTextId", field_type::s32, offsetof(T, refTextId), 4, 1, nullptr },
+        { "helpTextId", field_type::s32, offsetof(T, helpTextId), 4, 1, nullptr },
+        { "unlockEventFlagId", field_type::u32, offsetof(T, unlockEventFlagId), 4, 1, nullptr },
+        { "reserved", field_type::u8, offsetof(T, reserved), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, commandType) == 0);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, captionId) == 4);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, faceParamId) == 8);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, tableId) == 12);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, viewCondition) == 16);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, previewMode) == 20);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, reserved2) == 21);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, tableId2) == 24);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, refFaceParamId) == 28);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, refTextId) == 32);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, helpTextId) == 36);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, unlockEventFlagId) == 40);
+static_assert(offsetof(paramdef::CHARMAKEMENUTOP_PARAM_ST, reserved) == 44);
+
+}; // namespace params
+}; // namespace from
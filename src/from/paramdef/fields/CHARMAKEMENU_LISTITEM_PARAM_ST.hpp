@@ -0,0 +1,30 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CHARMAKEMENU_LISTITEM_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CHARMAKEMENU_LISTITEM_PARAM_ST> {
+    using T = paramdef::CHARMAKEMENU_LISTITEM_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "value", field_type::s32, offsetof(T, value), 4, 1, nullptr },
+        { "captionId", field_type::s32, offsetof(T, captionId), 4, 1, nullptr },
+        { "iconId", field_type::u8, offsetof(T, iconId), 1, 1, nullptr },
+        { "reserved", field_type::u8, offsetof(T, reserved), 1, 7, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CHARMAKEMENU_LISTITEM_PARAM_ST, value) == 0);
+static_assert(offsetof(paramdef::CHARMAKEMENU_LISTITEM_PARAM_ST, captionId) == 4);
+static_assert(offsetof(paramdef::CHARMAKEMENU_LISTITEM_PARAM_ST, iconId) == 8);
+static_assert(offsetof(paramdef::CHARMAKEMENU_LISTITEM_PARAM_ST, reserved) == 9);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,47 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CHR_ACTIVATE_CONDITION_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CHR_ACTIVATE_CONDITION_PARAM_ST> {
+    using T = paramdef::CHR_ACTIVATE_CONDITION_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 20> fields = {{
+        { "weatherSunny", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherSunny; } },
+        { "weatherClearSky", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherClearSky; } },
+        { "weatherWeakCloudy", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherWeakCloudy; } },
+        { "weatherCloudy", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherCloudy; } },
+        { "weatherRain", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherRain; } },
+        { "weatherHeavyRain", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherHeavyRain; } },
+        { "weatherStorm", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherStorm; } },
+        { "weatherStormForBattle", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherStormForBattle; } },
+        { "weatherSnow", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherSnow; } },
+        { "weatherHeavySnow", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherHeavySnow; } },
+        { "weatherFog", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherFog; } },
+        { "weatherHeavyFog", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherHeavyFog; } },
+        { "weatherHeavyFogRain", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherHeavyFogRain; } },
+        { "weatherSandStorm", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->weatherSandStorm; } },
+        { "pad1", field_type::u8, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad1; } },
+        { "timeStartHour", field_type::u8, offsetof(T, timeStartHour), 1, 1, nullptr },
+        { "timeStartMin", field_type::u8, offsetof(T, timeStartMin), 1, 1, nullptr },
+        { "timeEndHour", field_type::u8, offsetof(T, timeEndHour), 1, 1, nullptr },
+        { "timeEndMin", field_type::u8, offsetof(T, timeEndMin), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 2, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CHR_ACTIVATE_CONDITION_PARAM_ST, timeStartHour) == 2);
+static_assert(offsetof(paramdef::CHR_ACTIVATE_CONDITION_PARAM_ST, timeStartMin) == 3);
+static_assert(offsetof(paramdef::CHR_ACTIVATE_CONDITION_PARAM_ST, timeEndHour) == 4);
+static_assert(offsetof(paramdef::CHR_ACTIVATE_CONDITION_PARAM_ST, timeEndMin) == 5);
+static_assert(offsetof(paramdef::CHR_ACTIVATE_CONDITION_PARAM_ST, pad2) == 6);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,36 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CHR_MODEL_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CHR_MODEL_PARAM_ST> {
+    using T = paramdef::CHR_MODEL_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 8> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "modelMemoryType", field_type::u8, offsetof(T, modelMemoryType), 1, 1, nullptr },
+        { "texMemoryType", field_type::u8, offsetof(T, texMemoryType), 1, 1, nullptr },
+        { "cameraDitherFadeId", field_type::s16, offsetof(T, cameraDitherFadeId), 2, 1, nullptr },
+        { "reportAnimMemSizeMb", field_type::f32, offsetof(T, reportAnimMemSizeMb), 4, 1, nullptr },
+        { "unk", field_type::u32, offsetof(T, unk), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CHR_MODEL_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::CHR_MODEL_PARAM_ST, modelMemoryType) == 4);
+static_assert(offsetof(paramdef::CHR_MODEL_PARAM_ST, texMemoryType) == 5);
+static_assert(offsetof(paramdef::CHR_MODEL_PARAM_ST, cameraDitherFadeId) == 6);
+static_assert(offsetof(paramdef::CHR_MODEL_PARAM_ST, reportAnimMemSizeMb) == 8);
+static_assert(offsetof(paramdef::CHR_MODEL_PARAM_ST, unk) == 12);
+
+}; // namespace params
+}; // namespace from
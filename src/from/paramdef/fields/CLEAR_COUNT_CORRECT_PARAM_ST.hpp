@@ -0,0 +1,86 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CLEAR_COUNT_CORRECT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CLEAR_COUNT_CORRECT_PARAM_ST> {
+    using T = paramdef::CLEAR_COUNT_CORRECT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 32> fields = {{
+        { "MaxHpRate", field_type::f32, offsetof(T, MaxHpRate), 4, 1, nullptr },
+        { "MaxMpRate", field_type::f32, offsetof(T, MaxMpRate), 4, 1, nullptr },
+        { "MaxStaminaRate", field_type::f32, offsetof(T, MaxStaminaRate), 4, 1, nullptr },
+        { "PhysicsAttackRate", field_type::f32, offsetof(T, PhysicsAttackRate), 4, 1, nullptr },
+        { "SlashAttackRate", field_type::f32, offsetof(T, SlashAttackRate), 4, 1, nullptr },
+        { "BlowAttackRate", field_type::f32, offsetof(T, BlowAttackRate), 4, 1, nullptr },
+        { "ThrustAttackRate", field_type::f32, offsetof(T, ThrustAttackRate), 4, 1, nullptr },
+        { "NeturalAttackRate", field_type::f32, offsetof(T, NeturalAttackRate), 4, 1, nullptr },
+        { "MagicAttackRate", field_type::f32, offsetof(T, MagicAttackRate), 4, 1, nullptr },
+        { "FireAttackRate", field_type::f32, offsetof(T, FireAttackRate), 4, 1, nullptr },
+        { "ThunderAttackRate", field_type::f32, offsetof(T, ThunderAttackRate), 4, 1, nullptr },
+        { "DarkAttackRate", field_type::f32, offsetof(T, DarkAttackRate), 4, 1, nullptr },
+        { "PhysicsDefenseRate", field_type::f32, offsetof(T, PhysicsDefenseRate), 4, 1, nullptr },
+        { "MagicDefenseRate", field_type::f32, offsetof(T, MagicDefenseRate), 4, 1, nullptr },
+        { "FireDefenseRate", field_type::f32, offsetof(T, FireDefenseRate), 4, 1, nullptr },
+        { "ThunderDefenseRate", field_type::f32, offsetof(T, ThunderDefenseRate), 4, 1, nullptr },
+        { "DarkDefenseRate", field_type::f32, offsetof(T, DarkDefenseRate), 4, 1, nullptr },
+        { "StaminaAttackRate", field_type::f32, offsetof(T, StaminaAttackRate), 4, 1, nullptr },
+        { "SoulRate", field_type::f32, offsetof(T, SoulRate), 4, 1, nullptr },
+        { "PoisionResistRate", field_type::f32, offsetof(T, PoisionResistRate), 4, 1, nullptr },
+        { "DiseaseResistRate", field_type::f32, offsetof(T, DiseaseResistRate), 4, 1, nullptr },
+        { "BloodResistRate", field_type::f32, offsetof(T, BloodResistRate), 4, 1, nullptr },
+        { "CurseResistRate", field_type::f32, offsetof(T, CurseResistRate), 4, 1, nullptr },
+        { "FreezeResistRate", field_type::f32, offsetof(T, FreezeResistRate), 4, 1, nullptr },
+        { "BloodDamageRate", field_type::f32, offsetof(T, BloodDamageRate), 4, 1, nullptr },
+        { "SuperArmorDamageRate", field_type::f32, offsetof(T, SuperArmorDamageRate), 4, 1, nullptr },
+        { "FreezeDamageRate", field_type::f32, offsetof(T, FreezeDamageRate), 4, 1, nullptr },
+        { "SleepResistRate", field_type::f32, offsetof(T, SleepResistRate), 4, 1, nullptr },
+        { "MadnessResistRate", field_type::f32, offsetof(T, MadnessResistRate), 4, 1, nullptr },
+        { "SleepDamageRate", field_type::f32, offsetof(T, SleepDamageRate), 4, 1, nullptr },
+        { "MadnessDamageRate", field_type::f32, offsetof(T, MadnessDamageRate), 4, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, MaxHpRate) == 0);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, MaxMpRate) == 4);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, MaxStaminaRate) == 8);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, PhysicsAttackRate) == 12);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, SlashAttackRate) == 16);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, BlowAttackRate) == 20);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, ThrustAttackRate) == 24);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, NeturalAttackRate) == 28);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, MagicAttackRate) == 32);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, FireAttackRate) == 36);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, ThunderAttackRate) == 40);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, DarkAttackRate) == 44);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, PhysicsDefenseRate) == 48);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, MagicDefenseRate) == 52);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, FireDefenseRate) == 56);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, ThunderDefenseRate) == 60);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, DarkDefenseRate) == 64);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, StaminaAttackRate) == 68);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, SoulRate) == 72);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, PoisionResistRate) == 76);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, DiseaseResistRate) == 80);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, BloodResistRate) == 84);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, CurseResistRate) == 88);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, FreezeResistRate) == 92);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, BloodDamageRate) == 96);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, SuperArmorDamageRate) == 100);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, FreezeDamageRate) == 104);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, SleepResistRate) == 108);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, MadnessResistRate) == 112);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, SleepDamageRate) == 116);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, MadnessDamageRate) == 120);
+static_assert(offsetof(paramdef::CLEAR_COUNT_CORRECT_PARAM_ST, pad1) == 124);
+
+}; // namespace params
+}; // namespace from
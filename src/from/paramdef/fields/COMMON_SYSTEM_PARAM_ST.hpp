@@ -0,0 +1,26 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../COMMON_SYSTEM_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::COMMON_SYSTEM_PARAM_ST> {
+    using T = paramdef::COMMON_SYSTEM_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 2> fields = {{
+        { "mapSaveMapNameIdOnGameStart", field_type::u32, offsetof(T, mapSaveMapNameIdOnGameStart), 4, 1, nullptr },
+        { "reserve0", field_type::u8, offsetof(T, reserve0), 1, 60, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::COMMON_SYSTEM_PARAM_ST, mapSaveMapNameIdOnGameStart) == 0);
+static_assert(offsetof(paramdef::COMMON_SYSTEM_PARAM_ST, reserve0) == 4);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,38 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../COOL_TIME_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::COOL_TIME_PARAM_ST> {
+    using T = paramdef::COOL_TIME_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 8> fields = {{
+        { "limitationTime_0", field_type::f32, offsetof(T, limitationTime_0), 4, 1, nullptr },
+        { "observeTime_0", field_type::f32, offsetof(T, observeTime_0), 4, 1, nullptr },
+        { "limitationTime_1", field_type::f32, offsetof(T, limitationTime_1), 4, 1, nullptr },
+        { "observeTime_1", field_type::f32, offsetof(T, observeTime_1), 4, 1, nullptr },
+        { "limitationTime_2", field_type::f32, offsetof(T, limitationTime_2), 4, 1, nullptr },
+        { "observeTime_2", field_type::f32, offsetof(T, observeTime_2), 4, 1, nullptr },
+        { "limitationTime_3", field_type::f32, offsetof(T, limitationTime_3), 4, 1, nullptr },
+        { "observeTime_3", field_type::f32, offsetof(T, observeTime_3), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::COOL_TIME_PARAM_ST, limitationTime_0) == 0);
+static_assert(offsetof(paramdef::COOL_TIME_PARAM_ST, observeTime_0) == 4);
+static_assert(offsetof(paramdef::COOL_TIME_PARAM_ST, limitationTime_1) == 8);
+static_assert(offsetof(paramdef::COOL_TIME_PARAM_ST, observeTime_1) == 12);
+static_assert(offsetof(paramdef::COOL_TIME_PARAM_ST, limitationTime_2) == 16);
+static_assert(offsetof(paramdef::COOL_TIME_PARAM_ST, observeTime_2) == 20);
+static_assert(offsetof(paramdef::COOL_TIME_PARAM_ST, limitationTime_3) == 24);
+static_assert(offsetof(paramdef::COOL_TIME_PARAM_ST, observeTime_3) == 28);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,28 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_AA_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_AA_QUALITY_DETAIL> {
+    using T = paramdef::CS_AA_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 3> fields = {{
+        { "enabled", field_type::boolean, offsetof(T, enabled), 1, 1, nullptr },
+        { "forceFXAA2", field_type::boolean, offsetof(T, forceFXAA2), 1, 1, nullptr },
+        { "dmy", field_type::u8, offsetof(T, dmy), 1, 2, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_AA_QUALITY_DETAIL, enabled) == 0);
+static_assert(offsetof(paramdef::CS_AA_QUALITY_DETAIL, forceFXAA2) == 1);
+static_assert(offsetof(paramdef::CS_AA_QUALITY_DETAIL, dmy) == 2);
+
+}; // namespace params
+}; // namespace from
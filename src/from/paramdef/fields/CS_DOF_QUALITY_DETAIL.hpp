@@ -0,0 +1,30 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_DOF_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_DOF_QUALITY_DETAIL> {
+    using T = paramdef::CS_DOF_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "enabled", field_type::boolean, offsetof(T, enabled), 1, 1, nullptr },
+        { "dmy", field_type::u8, offsetof(T, dmy), 1, 3, nullptr },
+        { "forceHiResoBlur", field_type::s32, offsetof(T, forceHiResoBlur), 4, 1, nullptr },
+        { "maxBlurLevel", field_type::s32, offsetof(T, maxBlurLevel), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_DOF_QUALITY_DETAIL, enabled) == 0);
+static_assert(offsetof(paramdef::CS_DOF_QUALITY_DETAIL, dmy) == 1);
+static_assert(offsetof(paramdef::CS_DOF_QUALITY_DETAIL, forceHiResoBlur) == 4);
+static_assert(offsetof(paramdef::CS_DOF_QUALITY_DETAIL, maxBlurLevel) == 8);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,46 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_EFFECT_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_EFFECT_QUALITY_DETAIL> {
+    using T = paramdef::CS_EFFECT_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 12> fields = {{
+        { "softParticleEnabled", field_type::boolean, offsetof(T, softParticleEnabled), 1, 1, nullptr },
+        { "glowEnabled", field_type::boolean, offsetof(T, glowEnabled), 1, 1, nullptr },
+        { "distortionEnable", field_type::boolean, offsetof(T, distortionEnable), 1, 1, nullptr },
+        { "cs_upScaleEnabledType", field_type::u8, offsetof(T, cs_upScaleEnabledType), 1, 1, nullptr },
+        { "fNumOnceEmitsScale", field_type::f32, offsetof(T, fNumOnceEmitsScale), 4, 1, nullptr },
+        { "fEmitSpanScale", field_type::f32, offsetof(T, fEmitSpanScale), 4, 1, nullptr },
+        { "fLodDistance1Scale", field_type::f32, offsetof(T, fLodDistance1Scale), 4, 1, nullptr },
+        { "fLodDistance2Scale", field_type::f32, offsetof(T, fLodDistance2Scale), 4, 1, nullptr },
+        { "fLodDistance3Scale", field_type::f32, offsetof(T, fLodDistance3Scale), 4, 1, nullptr },
+        { "fLodDistance4Scale", field_type::f32, offsetof(T, fLodDistance4Scale), 4, 1, nullptr },
+        { "fScaleRenderDistanceScale", field_type::f32, offsetof(T, fScaleRenderDistanceScale), 4, 1, nullptr },
+        { "dmy", field_type::u8, offsetof(T, dmy), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, softParticleEnabled) == 0);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, glowEnabled) == 1);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, distortionEnable) == 2);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, cs_upScaleEnabledType) == 3);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, fNumOnceEmitsScale) == 4);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, fEmitSpanScale) == 8);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, fLodDistance1Scale) == 12);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, fLodDistance2Scale) == 16);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, fLodDistance3Scale) == 20);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, fLodDistance4Scale) == 24);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, fScaleRenderDistanceScale) == 28);
+static_assert(offsetof(paramdef::CS_EFFECT_QUALITY_DETAIL, dmy) == 32);
+
+}; // namespace params
+}; // namespace from
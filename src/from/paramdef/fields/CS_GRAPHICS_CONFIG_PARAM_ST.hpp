@@ -0,0 +1,50 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_GRAPHICS_CONFIG_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_GRAPHICS_CONFIG_PARAM_ST> {
+    using T = paramdef::CS_GRAPHICS_CONFIG_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 14> fields = {{
+        { "m_textureFilterQuality", field_type::u8, offsetof(T, m_textureFilterQuality), 1, 1, nullptr },
+        { "m_aaQuality", field_type::u8, offsetof(T, m_aaQuality), 1, 1, nullptr },
+        { "m_ssaoQuality", field_type::u8, offsetof(T, m_ssaoQuality), 1, 1, nullptr },
+        { "m_dofQuality", field_type::u8, offsetof(T, m_dofQuality), 1, 1, nullptr },
+        { "m_motionBlurQuality", field_type::u8, offsetof(T, m_motionBlurQuality), 1, 1, nullptr },
+        { "m_shadowQuality", field_type::u8, offsetof(T, m_shadowQuality), 1, 1, nullptr },
+        { "m_lightingQuality", field_type::u8, offsetof(T, m_lightingQuality), 1, 1, nullptr },
+        { "m_effectQuality", field_type::u8, offsetof(T, m_effectQuality), 1, 1, nullptr },
+        { "m_decalQuality", field_type::u8, offsetof(T, m_decalQuality), 1, 1, nullptr },
+        { "m_reflectionQuality", field_type::u8, offsetof(T, m_reflectionQuality), 1, 1, nullptr },
+        { "m_waterQuality", field_type::u8, offsetof(T, m_waterQuality), 1, 1, nullptr },
+        { "m_shaderQuality", field_type::u8, offsetof(T, m_shaderQuality), 1, 1, nullptr },
+        { "m_volumetricEffectQuality", field_type::u8, offsetof(T, m_volumetricEffectQuality), 1, 1, nullptr },
+        { "m_dummy", field_type::u8, offsetof(T, m_dummy), 1, 3, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_textureFilterQuality) == 0);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_aaQuality) == 1);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_ssaoQuality) == 2);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_dofQuality) == 3);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_motionBlurQuality) == 4);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_shadowQuality) == 5);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_lightingQuality) == 6);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_effectQuality) == 7);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_decalQuality) == 8);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_reflectionQuality) == 9);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_waterQuality) == 10);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_shaderQuality) == 11);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_volumetricEffectQuality) == 12);
+static_assert(offsetof(paramdef::CS_GRAPHICS_CONFIG_PARAM_ST, m_dummy) == 13);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,42 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_KEY_ASSIGN_MENUITEM_PARAM.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM> {
+    using T = paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM;
+
+    static constexpr std::array<field_descriptor, 10> fields = {{
+        { "textID", field_type::s32, offsetof(T, textID), 4, 1, nullptr },
+        { "key", field_type::s32, offsetof(T, key), 4, 1, nullptr },
+        { "enableUnassign", field_type::boolean, offsetof(T, enableUnassign), 1, 1, nullptr },
+        { "enablePadConfig", field_type::boolean, offsetof(T, enablePadConfig), 1, 1, nullptr },
+        { "enableMouseConfig", field_type::boolean, offsetof(T, enableMouseConfig), 1, 1, nullptr },
+        { "group", field_type::u8, offsetof(T, group), 1, 1, nullptr },
+        { "mappingTextID", field_type::s32, offsetof(T, mappingTextID), 4, 1, nullptr },
+        { "viewPad", field_type::boolean, offsetof(T, viewPad), 1, 1, nullptr },
+        { "viewKeyboardMouse", field_type::boolean, offsetof(T, viewKeyboardMouse), 1, 1, nullptr },
+        { "padding", field_type::u8, offsetof(T, padding), 1, 6, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM, textID) == 0);
+static_assert(offsetof(paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM, key) == 4);
+static_assert(offsetof(paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM, enableUnassign) == 8);
+static_assert(offsetof(paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM, enablePadConfig) == 9);
+static_assert(offsetof(paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM, enableMouseConfig) == 10);
+static_assert(offsetof(paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM, group) == 11);
+static_assert(offsetof(paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM, mappingTextID) == 12);
+static_assert(offsetof(paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM, viewPad) == 16);
+static_assert(offsetof(paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM, viewKeyboardMouse) == 17);
+static_assert(offsetof(paramdef::CS_KEY_ASSIGN_MENUITEM_PARAM, padding) == 18);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,32 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_LIGHTING_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_LIGHTING_QUALITY_DETAIL> {
+    using T = paramdef::CS_LIGHTING_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 5> fields = {{
+        { "localLightDistFactor", field_type::f32, offsetof(T, localLightDistFactor), 4, 1, nullptr },
+        { "localLightShadowEnabled", field_type::boolean, offsetof(T, localLightShadowEnabled), 1, 1, nullptr },
+        { "forwardPassLightingEnabled", field_type::boolean, offsetof(T, forwardPassLightingEnabled), 1, 1, nullptr },
+        { "localLightShadowSpecLevelMax", field_type::u8, offsetof(T, localLightShadowSpecLevelMax), 1, 1, nullptr },
+        { "dmy", field_type::u8, offsetof(T, dmy), 1, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_LIGHTING_QUALITY_DETAIL, localLightDistFactor) == 0);
+static_assert(offsetof(paramdef::CS_LIGHTING_QUALITY_DETAIL, localLightShadowEnabled) == 4);
+static_assert(offsetof(paramdef::CS_LIGHTING_QUALITY_DETAIL, forwardPassLightingEnabled) == 5);
+static_assert(offsetof(paramdef::CS_LIGHTING_QUALITY_DETAIL, localLightShadowSpecLevelMax) == 6);
+static_assert(offsetof(paramdef::CS_LIGHTING_QUALITY_DETAIL, dmy) == 7);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,36 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_MOTION_BLUR_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_MOTION_BLUR_QUALITY_DETAIL> {
+    using T = paramdef::CS_MOTION_BLUR_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 7> fields = {{
+        { "enabled", field_type::boolean, offsetof(T, enabled), 1, 1, nullptr },
+        { "ombEnabled", field_type::boolean, offsetof(T, ombEnabled), 1, 1, nullptr },
+        { "forceScaleVelocityBuffer", field_type::boolean, offsetof(T, forceScaleVelocityBuffer), 1, 1, nullptr },
+        { "cheapFilterMode", field_type::boolean, offsetof(T, cheapFilterMode), 1, 1, nullptr },
+        { "sampleCountBias", field_type::s32, offsetof(T, sampleCountBias), 4, 1, nullptr },
+        { "recurrenceCountBias", field_type::s32, offsetof(T, recurrenceCountBias), 4, 1, nullptr },
+        { "blurMaxLengthScale", field_type::f32, offsetof(T, blurMaxLengthScale), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_MOTION_BLUR_QUALITY_DETAIL, enabled) == 0);
+static_assert(offsetof(paramdef::CS_MOTION_BLUR_QUALITY_DETAIL, ombEnabled) == 1);
+static_assert(offsetof(paramdef::CS_MOTION_BLUR_QUALITY_DETAIL, forceScaleVelocityBuffer) == 2);
+static_assert(offsetof(paramdef::CS_MOTION_BLUR_QUALITY_DETAIL, cheapFilterMode) == 3);
+static_assert(offsetof(paramdef::CS_MOTION_BLUR_QUALITY_DETAIL, sampleCountBias) == 4);
+static_assert(offsetof(paramdef::CS_MOTION_BLUR_QUALITY_DETAIL, recurrenceCountBias) == 8);
+static_assert(offsetof(paramdef::CS_MOTION_BLUR_QUALITY_DETAIL, blurMaxLengthScale) == 12);
+
+}; // namespace params
+}; // namespace from
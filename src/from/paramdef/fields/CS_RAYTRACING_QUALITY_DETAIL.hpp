@@ -0,0 +1,42 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_RAYTRACING_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_RAYTRACING_QUALITY_DETAIL> {
+    using T = paramdef::CS_RAYTRACING_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 10> fields = {{
+        { "enableRaytraceAO", field_type::u8, offsetof(T, enableRaytraceAO), 1, 1, nullptr },
+        { "enableRaytraceShadows", field_type::u8, offsetof(T, enableRaytraceShadows), 1, 1, nullptr },
+        { "Unk0x02", field_type::u8, offsetof(T, Unk0x02), 1, 1, nullptr },
+        { "Unk0x03", field_type::u8, offsetof(T, Unk0x03), 1, 1, nullptr },
+        { "UnkFloat0x04", field_type::f32, offsetof(T, UnkFloat0x04), 4, 1, nullptr },
+        { "Unk0x08", field_type::s32, offsetof(T, Unk0x08), 4, 1, nullptr },
+        { "UnkFloat0x0C", field_type::f32, offsetof(T, UnkFloat0x0C), 4, 1, nullptr },
+        { "Unk0x10", field_type::s32, offsetof(T, Unk0x10), 4, 1, nullptr },
+        { "UnkFloat0x14", field_type::f32, offsetof(T, UnkFloat0x14), 4, 1, nullptr },
+        { "UnkFloat0x18", field_type::f32, offsetof(T, UnkFloat0x18), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_RAYTRACING_QUALITY_DETAIL, enableRaytraceAO) == 0);
+static_assert(offsetof(paramdef::CS_RAYTRACING_QUALITY_DETAIL, enableRaytraceShadows) == 1);
+static_assert(offsetof(paramdef::CS_RAYTRACING_QUALITY_DETAIL, Unk0x02) == 2);
+static_assert(offsetof(paramdef::CS_RAYTRACING_QUALITY_DETAIL, Unk0x03) == 3);
+static_assert(offsetof(paramdef::CS_RAYTRACING_QUALITY_DETAIL, UnkFloat0x04) == 4);
+static_assert(offsetof(paramdef::CS_RAYTRACING_QUALITY_DETAIL, Unk0x08) == 8);
+static_assert(offsetof(paramdef::CS_RAYTRACING_QUALITY_DETAIL, UnkFloat0x0C) == 12);
+static_assert(offsetof(paramdef::CS_RAYTRACING_QUALITY_DETAIL, Unk0x10) == 16);
+static_assert(offsetof(paramdef::CS_RAYTRACING_QUALITY_DETAIL, UnkFloat0x14) == 20);
+static_assert(offsetof(paramdef::CS_RAYTRACING_QUALITY_DETAIL, UnkFloat0x18) == 24);
+
+}; // namespace params
+}; // namespace from
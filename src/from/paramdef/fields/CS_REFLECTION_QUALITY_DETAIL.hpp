@@ -0,0 +1,46 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_REFLECTION_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_REFLECTION_QUALITY_DETAIL> {
+    using T = paramdef::CS_REFLECTION_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 12> fields = {{
+        { "enabled", field_type::boolean, offsetof(T, enabled), 1, 1, nullptr },
+        { "localLightEnabled", field_type::boolean, offsetof(T, localLightEnabled), 1, 1, nullptr },
+        { "localLightForceEnabled", field_type::boolean, offsetof(T, localLightForceEnabled), 1, 1, nullptr },
+        { "dmy", field_type::u8, offsetof(T, dmy), 1, 1, nullptr },
+        { "resolutionDivider", field_type::u32, offsetof(T, resolutionDivider), 4, 1, nullptr },
+        { "ssrEnabled", field_type::boolean, offsetof(T, ssrEnabled), 1, 1, nullptr },
+        { "ssrGaussianBlurEnabled", field_type::boolean, offsetof(T, ssrGaussianBlurEnabled), 1, 1, nullptr },
+        { "dmy2", field_type::u8, offsetof(T, dmy2), 1, 2, nullptr },
+        { "ssrDepthRejectThresholdScale", field_type::f32, offsetof(T, ssrDepthRejectThresholdScale), 4, 1, nullptr },
+        { "ssrRayTraceStepScale", field_type::f32, offsetof(T, ssrRayTraceStepScale), 4, 1, nullptr },
+        { "ssrFadeToViewerBias", field_type::f32, offsetof(T, ssrFadeToViewerBias), 4, 1, nullptr },
+        { "ssrFresnelRejectBias", field_type::f32, offsetof(T, ssrFresnelRejectBias), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, enabled) == 0);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, localLightEnabled) == 1);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, localLightForceEnabled) == 2);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, dmy) == 3);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, resolutionDivider) == 4);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, ssrEnabled) == 8);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, ssrGaussianBlurEnabled) == 9);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, dmy2) == 10);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, ssrDepthRejectThresholdScale) == 12);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, ssrRayTraceStepScale) == 16);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, ssrFadeToViewerBias) == 20);
+static_assert(offsetof(paramdef::CS_REFLECTION_QUALITY_DETAIL, ssrFresnelRejectBias) == 24);
+
+}; // namespace params
+}; // namespace from
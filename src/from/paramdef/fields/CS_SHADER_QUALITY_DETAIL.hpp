@@ -0,0 +1,30 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_SHADER_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_SHADER_QUALITY_DETAIL> {
+    using T = paramdef::CS_SHADER_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "sssEnabled", field_type::boolean, offsetof(T, sssEnabled), 1, 1, nullptr },
+        { "tessellationEnabled", field_type::boolean, offsetof(T, tessellationEnabled), 1, 1, nullptr },
+        { "highPrecisionNormalEnabled", field_type::boolean, offsetof(T, highPrecisionNormalEnabled), 1, 1, nullptr },
+        { "dmy", field_type::character, offsetof(T, dmy), 1, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_SHADER_QUALITY_DETAIL, sssEnabled) == 0);
+static_assert(offsetof(paramdef::CS_SHADER_QUALITY_DETAIL, tessellationEnabled) == 1);
+static_assert(offsetof(paramdef::CS_SHADER_QUALITY_DETAIL, highPrecisionNormalEnabled) == 2);
+static_assert(offsetof(paramdef::CS_SHADER_QUALITY_DETAIL, dmy) == 3);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,38 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_SHADOW_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_SHADOW_QUALITY_DETAIL> {
+    using T = paramdef::CS_SHADOW_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 8> fields = {{
+        { "enabled", field_type::boolean, offsetof(T, enabled), 1, 1, nullptr },
+        { "maxFilterLevel", field_type::u8, offsetof(T, maxFilterLevel), 1, 1, nullptr },
+        { "dmy", field_type::u8, offsetof(T, dmy), 1, 2, nullptr },
+        { "textureSizeScaler", field_type::u32, offsetof(T, textureSizeScaler), 4, 1, nullptr },
+        { "textureSizeDivider", field_type::u32, offsetof(T, textureSizeDivider), 4, 1, nullptr },
+        { "textureMinSize", field_type::u32, offsetof(T, textureMinSize), 4, 1, nullptr },
+        { "textureMaxSize", field_type::u32, offsetof(T, textureMaxSize), 4, 1, nullptr },
+        { "blurCountBias", field_type::s32, offsetof(T, blurCountBias), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_SHADOW_QUALITY_DETAIL, enabled) == 0);
+static_assert(offsetof(paramdef::CS_SHADOW_QUALITY_DETAIL, maxFilterLevel) == 1);
+static_assert(offsetof(paramdef::CS_SHADOW_QUALITY_DETAIL, dmy) == 2);
+static_assert(offsetof(paramdef::CS_SHADOW_QUALITY_DETAIL, textureSizeScaler) == 4);
+static_assert(offsetof(paramdef::CS_SHADOW_QUALITY_DETAIL, textureSizeDivider) == 8);
+static_assert(offsetof(paramdef::CS_SHADOW_QUALITY_DETAIL, textureMinSize) == 12);
+static_assert(offsetof(paramdef::CS_SHADOW_QUALITY_DETAIL, textureMaxSize) == 16);
+static_assert(offsetof(paramdef::CS_SHADOW_QUALITY_DETAIL, blurCountBias) == 20);
+
+}; // namespace params
+}; // namespace from
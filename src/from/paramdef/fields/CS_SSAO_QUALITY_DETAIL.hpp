@@ -0,0 +1,32 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_SSAO_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_SSAO_QUALITY_DETAIL> {
+    using T = paramdef::CS_SSAO_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 5> fields = {{
+        { "enabled", field_type::boolean, offsetof(T, enabled), 1, 1, nullptr },
+        { "cs_reprojEnabledType", field_type::u8, offsetof(T, cs_reprojEnabledType), 1, 1, nullptr },
+        { "cs_upScaleEnabledType", field_type::u8, offsetof(T, cs_upScaleEnabledType), 1, 1, nullptr },
+        { "cs_useNormalEnabledType", field_type::u8, offsetof(T, cs_useNormalEnabledType), 1, 1, nullptr },
+        { "dmy", field_type::u8, offsetof(T, dmy), 1, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_SSAO_QUALITY_DETAIL, enabled) == 0);
+static_assert(offsetof(paramdef::CS_SSAO_QUALITY_DETAIL, cs_reprojEnabledType) == 1);
+static_assert(offsetof(paramdef::CS_SSAO_QUALITY_DETAIL, cs_upScaleEnabledType) == 2);
+static_assert(offsetof(paramdef::CS_SSAO_QUALITY_DETAIL, cs_useNormalEnabledType) == 3);
+static_assert(offsetof(paramdef::CS_SSAO_QUALITY_DETAIL, dmy) == 4);
+
+}; // namespace params
+}; // namespace from
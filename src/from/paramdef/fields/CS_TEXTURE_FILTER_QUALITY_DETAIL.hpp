@@ -0,0 +1,28 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_TEXTURE_FILTER_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_TEXTURE_FILTER_QUALITY_DETAIL> {
+    using T = paramdef::CS_TEXTURE_FILTER_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 3> fields = {{
+        { "filter", field_type::u8, offsetof(T, filter), 1, 1, nullptr },
+        { "dmy", field_type::u8, offsetof(T, dmy), 1, 3, nullptr },
+        { "maxAnisoLevel", field_type::u32, offsetof(T, maxAnisoLevel), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_TEXTURE_FILTER_QUALITY_DETAIL, filter) == 0);
+static_assert(offsetof(paramdef::CS_TEXTURE_FILTER_QUALITY_DETAIL, dmy) == 1);
+static_assert(offsetof(paramdef::CS_TEXTURE_FILTER_QUALITY_DETAIL, maxAnisoLevel) == 4);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,56 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL> {
+    using T = paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 17> fields = {{
+        { "fogEnabled", field_type::boolean, offsetof(T, fogEnabled), 1, 1, nullptr },
+        { "fogShadowEnabled", field_type::boolean, offsetof(T, fogShadowEnabled), 1, 1, nullptr },
+        { "dmy", field_type::u8, offsetof(T, dmy), 1, 2, nullptr },
+        { "fogShadowSampleCountBias", field_type::s32, offsetof(T, fogShadowSampleCountBias), 4, 1, nullptr },
+        { "fogLocalLightDistScale", field_type::f32, offsetof(T, fogLocalLightDistScale), 4, 1, nullptr },
+        { "fogVolueSizeScaler", field_type::u32, offsetof(T, fogVolueSizeScaler), 4, 1, nullptr },
+        { "fogVolueSizeDivider", field_type::u32, offsetof(T, fogVolueSizeDivider), 4, 1, nullptr },
+        { "fogVolumeDepthScaler", field_type::u32, offsetof(T, fogVolumeDepthScaler), 4, 1, nullptr },
+        { "fogVolumeDepthDivider", field_type::u32, offsetof(T, fogVolumeDepthDivider), 4, 1, nullptr },
+        { "fogVolumeEnabled", field_type::boolean, offsetof(T, fogVolumeEnabled), 1, 1, nullptr },
+        { "fogVolumeUpScaleType", field_type::u8, offsetof(T, fogVolumeUpScaleType), 1, 1, nullptr },
+        { "fogVolumeEdgeCorrectionLevel", field_type::u8, offsetof(T, fogVolumeEdgeCorrectionLevel), 1, 1, nullptr },
+        { "fogVolumeRayMarcingSampleCountOffset", field_type::s8, offsetof(T, fogVolumeRayMarcingSampleCountOffset), 1, 1, nullptr },
+        { "fogVolumeShadowEnabled", field_type::boolean, offsetof(T, fogVolumeShadowEnabled), 1, 1, nullptr },
+        { "fogVolumeForceShadowing", field_type::boolean, offsetof(T, fogVolumeForceShadowing), 1, 1, nullptr },
+        { "fogVolumeResolution", field_type::u8, offsetof(T, fogVolumeResolution), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogEnabled) == 0);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogShadowEnabled) == 1);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, dmy) == 2);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogShadowSampleCountBias) == 4);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogLocalLightDistScale) == 8);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolueSizeScaler) == 12);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolueSizeDivider) == 16);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolumeDepthScaler) == 20);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolumeDepthDivider) == 24);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolumeEnabled) == 28);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolumeUpScaleType) == 29);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolumeEdgeCorrectionLevel) == 30);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolumeRayMarcingSampleCountOffset) == 31);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolumeShadowEnabled) == 32);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolumeForceShadowing) == 33);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, fogVolumeResolution) == 34);
+static_assert(offsetof(paramdef::CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL, pad2) == 35);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,26 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CS_WATER_QUALITY_DETAIL.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CS_WATER_QUALITY_DETAIL> {
+    using T = paramdef::CS_WATER_QUALITY_DETAIL;
+
+    static constexpr std::array<field_descriptor, 2> fields = {{
+        { "interactionEnabled", field_type::boolean, offsetof(T, interactionEnabled), 1, 1, nullptr },
+        { "dmy", field_type::u8, offsetof(T, dmy), 1, 3, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CS_WATER_QUALITY_DETAIL, interactionEnabled) == 0);
+static_assert(offsetof(paramdef::CS_WATER_QUALITY_DETAIL, dmy) == 1);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,45 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CUTSCENE_GPARAM_TIME_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST> {
+    using T = paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 13> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParam_Debug", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_Debug; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "DstTimezone_Morning", field_type::u8, offsetof(T, DstTimezone_Morning), 1, 1, nullptr },
+        { "DstTimezone_Noon", field_type::u8, offsetof(T, DstTimezone_Noon), 1, 1, nullptr },
+        { "DstTimezone_AfterNoon", field_type::u8, offsetof(T, DstTimezone_AfterNoon), 1, 1, nullptr },
+        { "DstTimezone_Evening", field_type::u8, offsetof(T, DstTimezone_Evening), 1, 1, nullptr },
+        { "DstTimezone_Night", field_type::u8, offsetof(T, DstTimezone_Night), 1, 1, nullptr },
+        { "DstTimezone_DeepNightA", field_type::u8, offsetof(T, DstTimezone_DeepNightA), 1, 1, nullptr },
+        { "DstTimezone_DeepNightB", field_type::u8, offsetof(T, DstTimezone_DeepNightB), 1, 1, nullptr },
+        { "reserved", field_type::u8, offsetof(T, reserved), 1, 1, nullptr },
+        { "PostPlayIngameTime", field_type::f32, offsetof(T, PostPlayIngameTime), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST, DstTimezone_Morning) == 4);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST, DstTimezone_Noon) == 5);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST, DstTimezone_AfterNoon) == 6);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST, DstTimezone_Evening) == 7);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST, DstTimezone_Night) == 8);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST, DstTimezone_DeepNightA) == 9);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST, DstTimezone_DeepNightB) == 10);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST, reserved) == 11);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_TIME_PARAM_ST, PostPlayIngameTime) == 12);
+
+}; // namespace params
+}; // namespace from
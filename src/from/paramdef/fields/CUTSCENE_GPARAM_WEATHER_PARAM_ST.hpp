@@ -0,0 +1,129 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CUTSCENE_GPARAM_WEATHER_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST> {
+    using T = paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 55> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParam_Debug", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_Debug; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "DstWeather_Sunny", field_type::s16, offsetof(T, DstWeather_Sunny), 2, 1, nullptr },
+        { "DstWeather_ClearSky", field_type::s16, offsetof(T, DstWeather_ClearSky), 2, 1, nullptr },
+        { "DstWeather_WeakCloudy", field_type::s16, offsetof(T, DstWeather_WeakCloudy), 2, 1, nullptr },
+        { "DstWeather_Cloud", field_type::s16, offsetof(T, DstWeather_Cloud), 2, 1, nullptr },
+        { "DstWeather_Rain", field_type::s16, offsetof(T, DstWeather_Rain), 2, 1, nullptr },
+        { "DstWeather_HeavyRain", field_type::s16, offsetof(T, DstWeather_HeavyRain), 2, 1, nullptr },
+        { "DstWeather_Storm", field_type::s16, offsetof(T, DstWeather_Storm), 2, 1, nullptr },
+        { "DstWeather_StormForBattle", field_type::s16, offsetof(T, DstWeather_StormForBattle), 2, 1, nullptr },
+        { "DstWeather_Snow", field_type::s16, offsetof(T, DstWeather_Snow), 2, 1, nullptr },
+        { "DstWeather_HeavySnow", field_type::s16, offsetof(T, DstWeather_HeavySnow), 2, 1, nullptr },
+        { "DstWeather_Fog", field_type::s16, offsetof(T, DstWeather_Fog), 2, 1, nullptr },
+        { "DstWeather_HeavyFog", field_type::s16, offsetof(T, DstWeather_HeavyFog), 2, 1, nullptr },
+        { "DstWeather_SandStorm", field_type::s16, offsetof(T, DstWeather_SandStorm), 2, 1, nullptr },
+        { "DstWeather_HeavyFogRain", field_type::s16, offsetof(T, DstWeather_HeavyFogRain), 2, 1, nullptr },
+        { "PostPlayIngameWeather", field_type::s16, offsetof(T, PostPlayIngameWeather), 2, 1, nullptr },
+        { "IndoorOutdoorType", field_type::u8, offsetof(T, IndoorOutdoorType), 1, 1, nullptr },
+        { "TakeOverDstWeather_Sunny", field_type::boolean, offsetof(T, TakeOverDstWeather_Sunny), 1, 1, nullptr },
+        { "TakeOverDstWeather_ClearSky", field_type::boolean, offsetof(T, TakeOverDstWeather_ClearSky), 1, 1, nullptr },
+        { "TakeOverDstWeather_WeakCloudy", field_type::boolean, offsetof(T, TakeOverDstWeather_WeakCloudy), 1, 1, nullptr },
+        { "TakeOverDstWeather_Cloud", field_type::boolean, offsetof(T, TakeOverDstWeather_Cloud), 1, 1, nullptr },
+        { "TakeOverDstWeather_Rain", field_type::boolean, offsetof(T, TakeOverDstWeather_Rain), 1, 1, nullptr },
+        { "TakeOverDstWeather_HeavyRain", field_type::boolean, offsetof(T, TakeOverDstWeather_HeavyRain), 1, 1, nullptr },
+        { "TakeOverDstWeather_Storm", field_type::boolean, offsetof(T, TakeOverDstWeather_Storm), 1, 1, nullptr },
+        { "TakeOverDstWeather_StormForBattle", field_type::boolean, offsetof(T, TakeOverDstWeather_StormForBattle), 1, 1, nullptr },
+        { "TakeOverDstWeather_Snow", field_type::boolean, offsetof(T, TakeOverDstWeather_Snow), 1, 1, nullptr },
+        { "TakeOverDstWeather_HeavySnow", field_type::boolean, offsetof(T, TakeOverDstWeather_HeavySnow), 1, 1, nullptr },
+        { "TakeOverDstWeather_Fog", field_type::boolean, offsetof(T, TakeOverDstWeather_Fog), 1, 1, nullptr },
+        { "TakeOverDstWeather_HeavyFog", field_type::boolean, offsetof(T, TakeOverDstWeather_HeavyFog), 1, 1, nullptr },
+        { "TakeOverDstWeather_SandStorm", field_type::boolean, offsetof(T, TakeOverDstWeather_SandStorm), 1, 1, nullptr },
+        { "TakeOverDstWeather_HeavyFogRain", field_type::boolean, offsetof(T, TakeOverDstWeather_HeavyFogRain), 1, 1, nullptr },
+        { "reserved", field_type::u8, offsetof(T, reserved), 1, 7, nullptr },
+        { "DstWeather_Snowstorm", field_type::s16, offsetof(T, DstWeather_Snowstorm), 2, 1, nullptr },
+        { "DstWeather_LightningStorm", field_type::s16, offsetof(T, DstWeather_LightningStorm), 2, 1, nullptr },
+        { "DstWeather_Reserved3", field_type::s16, offsetof(T, DstWeather_Reserved3), 2, 1, nullptr },
+        { "DstWeather_Reserved4", field_type::s16, offsetof(T, DstWeather_Reserved4), 2, 1, nullptr },
+        { "DstWeather_Reserved5", field_type::s16, offsetof(T, DstWeather_Reserved5), 2, 1, nullptr },
+        { "DstWeather_Reserved6", field_type::s16, offsetof(T, DstWeather_Reserved6), 2, 1, nullptr },
+        { "DstWeather_Reserved7", field_type::s16, offsetof(T, DstWeather_Reserved7), 2, 1, nullptr },
+        { "DstWeather_Reserved8", field_type::s16, offsetof(T, DstWeather_Reserved8), 2, 1, nullptr },
+        { "TakeOverDstWeather_Snowstorm", field_type::boolean, offsetof(T, TakeOverDstWeather_Snowstorm), 1, 1, nullptr },
+        { "TakeOverDstWeather_LightningStorm", field_type::boolean, offsetof(T, TakeOverDstWeather_LightningStorm), 1, 1, nullptr },
+        { "TakeOverDstWeather_Reserved3", field_type::boolean, offsetof(T, TakeOverDstWeather_Reserved3), 1, 1, nullptr },
+        { "TakeOverDstWeather_Reserved4", field_type::boolean, offsetof(T, TakeOverDstWeather_Reserved4), 1, 1, nullptr },
+        { "TakeOverDstWeather_Reserved5", field_type::boolean, offsetof(T, TakeOverDstWeather_Reserved5), 1, 1, nullptr },
+        { "TakeOverDstWeather_Reserved6", field_type::boolean, offsetof(T, TakeOverDstWeather_Reserved6), 1, 1, nullptr },
+        { "TakeOverDstWeather_Reserved7", field_type::boolean, offsetof(T, TakeOverDstWeather_Reserved7), 1, 1, nullptr },
+        { "TakeOverDstWeather_Reserved8", field_type::boolean, offsetof(T, TakeOverDstWeather_Reserved8), 1, 1, nullptr },
+        { "IsEnableApplyMapGdRegionIdForGparam", field_type::boolean, offsetof(T, IsEnableApplyMapGdRegionIdForGparam), 1, 1, nullptr },
+        { "reserved2", field_type::u8, offsetof(T, reserved2), 1, 1, nullptr },
+        { "OverrideMapGdRegionId", field_type::s16, offsetof(T, OverrideMapGdRegionId), 2, 1, nullptr },
+        { "reserved1", field_type::u8, offsetof(T, reserved1), 1, 12, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Sunny) == 4);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_ClearSky) == 6);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_WeakCloudy) == 8);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Cloud) == 10);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Rain) == 12);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_HeavyRain) == 14);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Storm) == 16);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_StormForBattle) == 18);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Snow) == 20);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_HeavySnow) == 22);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Fog) == 24);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_HeavyFog) == 26);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_SandStorm) == 28);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_HeavyFogRain) == 30);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, PostPlayIngameWeather) == 32);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, IndoorOutdoorType) == 34);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Sunny) == 35);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_ClearSky) == 36);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_WeakCloudy) == 37);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Cloud) == 38);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Rain) == 39);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_HeavyRain) == 40);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Storm) == 41);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_StormForBattle) == 42);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Snow) == 43);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_HeavySnow) == 44);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Fog) == 45);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_HeavyFog) == 46);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_SandStorm) == 47);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_HeavyFogRain) == 48);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, reserved) == 49);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Snowstorm) == 56);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_LightningStorm) == 58);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Reserved3) == 60);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Reserved4) == 62);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Reserved5) == 64);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Reserved6) == 66);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Reserved7) == 68);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, DstWeather_Reserved8) == 70);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Snowstorm) == 72);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_LightningStorm) == 73);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Reserved3) == 74);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Reserved4) == 75);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Reserved5) == 76);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Reserved6) == 77);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Reserved7) == 78);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, TakeOverDstWeather_Reserved8) == 79);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, IsEnableApplyMapGdRegionIdForGparam) == 80);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, reserved2) == 81);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, OverrideMapGdRegionId) == 82);
+static_assert(offsetof(paramdef::CUTSCENE_GPARAM_WEATHER_PARAM_ST, reserved1) == 84);
+
+}; // namespace params
+}; // namespace from
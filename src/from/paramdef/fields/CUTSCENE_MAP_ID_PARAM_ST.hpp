@@ -0,0 +1,47 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CUTSCENE_MAP_ID_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CUTSCENE_MAP_ID_PARAM_ST> {
+    using T = paramdef::CUTSCENE_MAP_ID_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 14> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParam_Debug", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_Debug; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "PlayMapId", field_type::u32, offsetof(T, PlayMapId), 4, 1, nullptr },
+        { "RequireMapId0", field_type::u32, offsetof(T, RequireMapId0), 4, 1, nullptr },
+        { "RequireMapId1", field_type::u32, offsetof(T, RequireMapId1), 4, 1, nullptr },
+        { "RequireMapId2", field_type::u32, offsetof(T, RequireMapId2), 4, 1, nullptr },
+        { "RefCamPosHitPartsID", field_type::s32, offsetof(T, RefCamPosHitPartsID), 4, 1, nullptr },
+        { "reserved_2", field_type::u8, offsetof(T, reserved_2), 1, 12, nullptr },
+        { "ClientDisableViewTimeForProgress", field_type::u16, offsetof(T, ClientDisableViewTimeForProgress), 2, 1, nullptr },
+        { "reserved", field_type::u8, offsetof(T, reserved), 1, 2, nullptr },
+        { "HitParts_0", field_type::s32, offsetof(T, HitParts_0), 4, 1, nullptr },
+        { "HitParts_1", field_type::s32, offsetof(T, HitParts_1), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, PlayMapId) == 4);
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, RequireMapId0) == 8);
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, RequireMapId1) == 12);
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, RequireMapId2) == 16);
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, RefCamPosHitPartsID) == 20);
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, reserved_2) == 24);
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, ClientDisableViewTimeForProgress) == 36);
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, reserved) == 38);
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, HitParts_0) == 40);
+static_assert(offsetof(paramdef::CUTSCENE_MAP_ID_PARAM_ST, HitParts_1) == 44);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,59 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CUTSCENE_TEXTURE_LOAD_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST> {
+    using T = paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 20> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParam_Debug", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_Debug; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "texName_00", field_type::character, offsetof(T, texName_00), 1, 16, nullptr },
+        { "texName_01", field_type::character, offsetof(T, texName_01), 1, 16, nullptr },
+        { "texName_02", field_type::character, offsetof(T, texName_02), 1, 16, nullptr },
+        { "texName_03", field_type::character, offsetof(T, texName_03), 1, 16, nullptr },
+        { "texName_04", field_type::character, offsetof(T, texName_04), 1, 16, nullptr },
+        { "texName_05", field_type::character, offsetof(T, texName_05), 1, 16, nullptr },
+        { "texName_06", field_type::character, offsetof(T, texName_06), 1, 16, nullptr },
+        { "texName_07", field_type::character, offsetof(T, texName_07), 1, 16, nullptr },
+        { "texName_08", field_type::character, offsetof(T, texName_08), 1, 16, nullptr },
+        { "texName_09", field_type::character, offsetof(T, texName_09), 1, 16, nullptr },
+        { "texName_10", field_type::character, offsetof(T, texName_10), 1, 16, nullptr },
+        { "texName_11", field_type::character, offsetof(T, texName_11), 1, 16, nullptr },
+        { "texName_12", field_type::character, offsetof(T, texName_12), 1, 16, nullptr },
+        { "texName_13", field_type::character, offsetof(T, texName_13), 1, 16, nullptr },
+        { "texName_14", field_type::character, offsetof(T, texName_14), 1, 16, nullptr },
+        { "texName_15", field_type::character, offsetof(T, texName_15), 1, 16, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_00) == 4);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_01) == 20);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_02) == 36);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_03) == 52);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_04) == 68);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_05) == 84);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_06) == 100);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_07) == 116);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_08) == 132);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_09) == 148);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_10) == 164);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_11) == 180);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_12) == 196);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_13) == 212);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_14) == 228);
+static_assert(offsetof(paramdef::CUTSCENE_TEXTURE_LOAD_PARAM_ST, texName_15) == 244);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,26 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CUTSCENE_TIMEZONE_CONVERT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CUTSCENE_TIMEZONE_CONVERT_PARAM_ST> {
+    using T = paramdef::CUTSCENE_TIMEZONE_CONVERT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 2> fields = {{
+        { "SrcTimezoneStart", field_type::f32, offsetof(T, SrcTimezoneStart), 4, 1, nullptr },
+        { "DstCutscenTime", field_type::f32, offsetof(T, DstCutscenTime), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CUTSCENE_TIMEZONE_CONVERT_PARAM_ST, SrcTimezoneStart) == 0);
+static_assert(offsetof(paramdef::CUTSCENE_TIMEZONE_CONVERT_PARAM_ST, DstCutscenTime) == 4);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,24 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../CUTSCENE_WEATHER_OVERRIDE_GPARAM_ID_CONVERT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::CUTSCENE_WEATHER_OVERRIDE_GPARAM_ID_CONVERT_PARAM_ST> {
+    using T = paramdef::CUTSCENE_WEATHER_OVERRIDE_GPARAM_ID_CONVERT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 1> fields = {{
+        { "weatherOverrideGparamId", field_type::u32, offsetof(T, weatherOverrideGparamId), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::CUTSCENE_WEATHER_OVERRIDE_GPARAM_ID_CONVERT_PARAM_ST, weatherOverrideGparamId) == 0);
+
+}; // namespace params
+}; // namespace from
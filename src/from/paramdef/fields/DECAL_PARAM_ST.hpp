@@ -0,0 +1,181 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../DECAL_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::DECAL_PARAM_ST> {
+    using T = paramdef::DECAL_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 90> fields = {{
+        { "textureId", field_type::s32, offsetof(T, textureId), 4, 1, nullptr },
+        { "dmypolyId", field_type::s32, offsetof(T, dmypolyId), 4, 1, nullptr },
+        { "pitchAngle", field_type::f32, offsetof(T, pitchAngle), 4, 1, nullptr },
+        { "yawAngle", field_type::f32, offsetof(T, yawAngle), 4, 1, nullptr },
+        { "nearDistance", field_type::f32, offsetof(T, nearDistance), 4, 1, nullptr },
+        { "farDistance", field_type::f32, offsetof(T, farDistance), 4, 1, nullptr },
+        { "nearSize", field_type::f32, offsetof(T, nearSize), 4, 1, nullptr },
+        { "farSize", field_type::f32, offsetof(T, farSize), 4, 1, nullptr },
+        { "maskSpeffectId", field_type::s32, offsetof(T, maskSpeffectId), 4, 1, nullptr },
+        { "pad_10", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad_10; } },
+        { "replaceTextureId_byMaterial", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->replaceTextureId_byMaterial; } },
+        { "dmypolyCategory", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->dmypolyCategory; } },
+        { "pad_05", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad_05; } },
+        { "useDeferredDecal", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->useDeferredDecal; } },
+        { "usePaintDecal", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->usePaintDecal; } },
+        { "bloodTypeEnable", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bloodTypeEnable; } },
+        { "bUseNormal", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bUseNormal; } },
+        { "pad_08", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad_08; } },
+        { "pad_09", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad_09; } },
+        { "usePom", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->usePom; } },
+        { "useEmissive", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->useEmissive; } },
+        { "putVertical", field_type::u32, 36, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->putVertical; } },
+        { "randomSizeMin", field_type::s16, offsetof(T, randomSizeMin), 2, 1, nullptr },
+        { "randomSizeMax", field_type::s16, offsetof(T, randomSizeMax), 2, 1, nullptr },
+        { "randomRollMin", field_type::f32, offsetof(T, randomRollMin), 4, 1, nullptr },
+        { "randomRollMax", field_type::f32, offsetof(T, randomRollMax), 4, 1, nullptr },
+        { "randomPitchMin", field_type::f32, offsetof(T, randomPitchMin), 4, 1, nullptr },
+        { "randomPitchMax", field_type::f32, offsetof(T, randomPitchMax), 4, 1, nullptr },
+        { "randomYawMin", field_type::f32, offsetof(T, randomYawMin), 4, 1, nullptr },
+        { "randomYawMax", field_type::f32, offsetof(T, randomYawMax), 4, 1, nullptr },
+        { "pomHightScale", field_type::f32, offsetof(T, pomHightScale), 4, 1, nullptr },
+        { "pomSampleMin", field_type::u8, offsetof(T, pomSampleMin), 1, 1, nullptr },
+        { "pomSampleMax", field_type::u8, offsetof(T, pomSampleMax), 1, 1, nullptr },
+        { "blendMode", field_type::s8, offsetof(T, blendMode), 1, 1, nullptr },
+        { "appearDirType", field_type::s8, offsetof(T, appearDirType), 1, 1, nullptr },
+        { "emissiveValueBegin", field_type::f32, offsetof(T, emissiveValueBegin), 4, 1, nullptr },
+        { "emissiveValueEnd", field_type::f32, offsetof(T, emissiveValueEnd), 4, 1, nullptr },
+        { "emissiveTime", field_type::f32, offsetof(T, emissiveTime), 4, 1, nullptr },
+        { "bIntpEnable", field_type::boolean, offsetof(T, bIntpEnable), 1, 1, nullptr },
+        { "pad_01", field_type::u8, offsetof(T, pad_01), 1, 3, nullptr },
+        { "intpIntervalDist", field_type::f32, offsetof(T, intpIntervalDist), 4, 1, nullptr },
+        { "beginIntpTextureId", field_type::s32, offsetof(T, beginIntpTextureId), 4, 1, nullptr },
+        { "endIntpTextureId", field_type::s32, offsetof(T, endIntpTextureId), 4, 1, nullptr },
+        { "appearSfxId", field_type::s32, offsetof(T, appearSfxId), 4, 1, nullptr },
+        { "appearSfxOffsetPos", field_type::f32, offsetof(T, appearSfxOffsetPos), 4, 1, nullptr },
+        { "maskTextureId", field_type::s32, offsetof(T, maskTextureId), 4, 1, nullptr },
+        { "diffuseTextureId", field_type::s32, offsetof(T, diffuseTextureId), 4, 1, nullptr },
+        { "reflecTextureId", field_type::s32, offsetof(T, reflecTextureId), 4, 1, nullptr },
+        { "maskScale", field_type::f32, offsetof(T, maskScale), 4, 1, nullptr },
+        { "normalTextureId", field_type::s32, offsetof(T, normalTextureId), 4, 1, nullptr },
+        { "heightTextureId", field_type::s32, offsetof(T, heightTextureId), 4, 1, nullptr },
+        { "emissiveTextureId", field_type::s32, offsetof(T, emissiveTextureId), 4, 1, nullptr },
+        { "diffuseColorR", field_type::u8, offsetof(T, diffuseColorR), 1, 1, nullptr },
+        { "diffuseColorG", field_type::u8, offsetof(T, diffuseColorG), 1, 1, nullptr },
+        { "diffuseColorB", field_type::u8, offsetof(T, diffuseColorB), 1, 1, nullptr },
+        { "pad_03", field_type::u8, offsetof(T, pad_03), 1, 1, nullptr },
+        { "reflecColorR", field_type::u8, offsetof(T, reflecColorR), 1, 1, nullptr },
+        { "reflecColorG", field_type::u8, offsetof(T, reflecColorG), 1, 1, nullptr },
+        { "reflecColorB", field_type::u8, offsetof(T, reflecColorB), 1, 1, nullptr },
+        { "bLifeEnable", field_type::boolean, offsetof(T, bLifeEnable), 1, 1, nullptr },
+        { "siniScale", field_type::f32, offsetof(T, siniScale), 4, 1, nullptr },
+        { "lifeTimeSec", field_type::f32, offsetof(T, lifeTimeSec), 4, 1, nullptr },
+        { "fadeOutTimeSec", field_type::f32, offsetof(T, fadeOutTimeSec), 4, 1, nullptr },
+        { "priority", field_type::s16, offsetof(T, priority), 2, 1, nullptr },
+        { "bDistThinOutEnable", field_type::boolean, offsetof(T, bDistThinOutEnable), 1, 1, nullptr },
+        { "bAlignedTexRandomVariationEnable", field_type::boolean, offsetof(T, bAlignedTexRandomVariationEnable), 1, 1, nullptr },
+        { "distThinOutCheckDist", field_type::f32, offsetof(T, distThinOutCheckDist), 4, 1, nullptr },
+        { "distThinOutCheckAngleDeg", field_type::f32, offsetof(T, distThinOutCheckAngleDeg), 4, 1, nullptr },
+        { "distThinOutMaxNum", field_type::u8, offsetof(T, distThinOutMaxNum), 1, 1, nullptr },
+        { "distThinOutCheckNum", field_type::u8, offsetof(T, distThinOutCheckNum), 1, 1, nullptr },
+        { "delayAppearFrame", field_type::s16, offsetof(T, delayAppearFrame), 2, 1, nullptr },
+        { "randVaria_Diffuse", field_type::u32, 176, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->randVaria_Diffuse; } },
+        { "randVaria_Mask", field_type::u32, 176, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->randVaria_Mask; } },
+        { "randVaria_Reflec", field_type::u32, 176, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->randVaria_Reflec; } },
+        { "pad_12", field_type::u32, 176, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad_12; } },
+        { "randVaria_Normal", field_type::u32, 176, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->randVaria_Normal; } },
+        { "randVaria_Height", field_type::u32, 176, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->randVaria_Height; } },
+        { "randVaria_Emissive", field_type::u32, 176, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->randVaria_Emissive; } },
+        { "pad_11", field_type::u32, 176, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad_11; } },
+        { "fadeInTimeSec", field_type::f32, offsetof(T, fadeInTimeSec), 4, 1, nullptr },
+        { "thinOutOverlapMultiRadius", field_type::f32, offsetof(T, thinOutOverlapMultiRadius), 4, 1, nullptr },
+        { "thinOutNeighborAddRadius", field_type::f32, offsetof(T, thinOutNeighborAddRadius), 4, 1, nullptr },
+        { "thinOutOverlapLimitNum", field_type::u32, offsetof(T, thinOutOverlapLimitNum), 4, 1, nullptr },
+        { "thinOutNeighborLimitNum", field_type::u32, offsetof(T, thinOutNeighborLimitNum), 4, 1, nullptr },
+        { "thinOutMode", field_type::s8, offsetof(T, thinOutMode), 1, 1, nullptr },
+        { "emissiveColorR", field_type::u8, offsetof(T, emissiveColorR), 1, 1, nullptr },
+        { "emissiveColorG", field_type::u8, offsetof(T, emissiveColorG), 1, 1, nullptr },
+        { "emissiveColorB", field_type::u8, offsetof(T, emissiveColorB), 1, 1, nullptr },
+        { "maxDecalSfxCreatableSlopeAngleDeg", field_type::f32, offsetof(T, maxDecalSfxCreatableSlopeAngleDeg), 4, 1, nullptr },
+        { "pad_02", field_type::u8, offsetof(T, pad_02), 1, 40, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, textureId) == 0);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, dmypolyId) == 4);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, pitchAngle) == 8);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, yawAngle) == 12);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, nearDistance) == 16);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, farDistance) == 20);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, nearSize) == 24);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, farSize) == 28);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, maskSpeffectId) == 32);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, randomSizeMin) == 40);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, randomSizeMax) == 42);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, randomRollMin) == 44);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, randomRollMax) == 48);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, randomPitchMin) == 52);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, randomPitchMax) == 56);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, randomYawMin) == 60);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, randomYawMax) == 64);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, pomHightScale) == 68);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, pomSampleMin) == 72);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, pomSampleMax) == 73);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, blendMode) == 74);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, appearDirType) == 75);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, emissiveValueBegin) == 76);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, emissiveValueEnd) == 80);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, emissiveTime) == 84);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, bIntpEnable) == 88);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, pad_01) == 89);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, intpIntervalDist) == 92);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, beginIntpTextureId) == 96);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, endIntpTextureId) == 100);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, appearSfxId) == 104);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, appearSfxOffsetPos) == 108);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, maskTextureId) == 112);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, diffuseTextureId) == 116);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, reflecTextureId) == 120);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, maskScale) == 124);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, normalTextureId) == 128);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, heightTextureId) == 132);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, emissiveTextureId) == 136);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, diffuseColorR) == 140);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, diffuseColorG) == 141);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, diffuseColorB) == 142);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, pad_03) == 143);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, reflecColorR) == 144);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, reflecColorG) == 145);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, reflecColorB) == 146);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, bLifeEnable) == 147);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, siniScale) == 148);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, lifeTimeSec) == 152);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, fadeOutTimeSec) == 156);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, priority) == 160);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, bDistThinOutEnable) == 162);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, bAlignedTexRandomVariationEnable) == 163);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, distThinOutCheckDist) == 164);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, distThinOutCheckAngleDeg) == 168);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, distThinOutMaxNum) == 172);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, distThinOutCheckNum) == 173);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, delayAppearFrame) == 174);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, fadeInTimeSec) == 180);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, thinOutOverlapMultiRadius) == 184);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, thinOutNeighborAddRadius) == 188);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, thinOutOverlapLimitNum) == 192);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, thinOutNeighborLimitNum) == 196);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, thinOutMode) == 200);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, emissiveColorR) == 201);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, emissiveColorG) == 202);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, emissiveColorB) == 203);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, maxDecalSfxCreatableSlopeAngleDeg) == 204);
+static_assert(offsetof(paramdef::DECAL_PARAM_ST, pad_02) == 208);
+
+}; // namespace params
+}; // namespace from
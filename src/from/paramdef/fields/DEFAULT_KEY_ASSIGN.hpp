@@ -0,0 +1,200 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../DEFAULT_KEY_ASSIGN.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::DEFAULT_KEY_ASSIGN> {
+    using T = paramdef::DEFAULT_KEY_ASSIGN;
+
+    static constexpr std::array<field_descriptor, 121> fields = {{
+        { "priority0", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority0; } },
+        { "priority1", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority1; } },
+        { "priority2", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority2; } },
+        { "priority3", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority3; } },
+        { "priority4", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority4; } },
+        { "priority5", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority5; } },
+        { "priority6", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority6; } },
+        { "priority7", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority7; } },
+        { "priority8", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority8; } },
+        { "priority9", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority9; } },
+        { "priority10", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority10; } },
+        { "priority11", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority11; } },
+        { "priority12", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority12; } },
+        { "priority13", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority13; } },
+        { "priority14", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority14; } },
+        { "priority15", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority15; } },
+        { "priority16", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority16; } },
+        { "priority17", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority17; } },
+        { "priority18", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority18; } },
+        { "priority19", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority19; } },
+        { "priority20", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority20; } },
+        { "priority21", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority21; } },
+        { "priority22", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority22; } },
+        { "priority23", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority23; } },
+        { "priority24", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority24; } },
+        { "priority25", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority25; } },
+        { "priority26", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority26; } },
+        { "priority27", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority27; } },
+        { "priority28", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority28; } },
+        { "priority29", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority29; } },
+        { "priority30", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority30; } },
+        { "priority31", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->priority31; } },
+        { "dummy", field_type::u8, offsetof(T, dummy), 1, 12, nullptr },
+        { "phyisicalKey_0", field_type::s32, offsetof(T, phyisicalKey_0), 4, 1, nullptr },
+        { "traitsType_0", field_type::u8, offsetof(T, traitsType_0), 1, 1, nullptr },
+        { "a2dOperator_0", field_type::u8, offsetof(T, a2dOperator_0), 1, 1, nullptr },
+        { "applyTarget_0", field_type::u8, offsetof(T, applyTarget_0), 1, 1, nullptr },
+        { "isAnalog_0", field_type::boolean, 23, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnalog_0; } },
+        { "enableWin64_0", field_type::boolean, 23, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableWin64_0; } },
+        { "enablePS4_0", field_type::boolean, 23, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enablePS4_0; } },
+        { "enableXboxOne_0", field_type::boolean, 23, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableXboxOne_0; } },
+        { "time1_0", field_type::f32, offsetof(T, time1_0), 4, 1, nullptr },
+        { "time2_0", field_type::f32, offsetof(T, time2_0), 4, 1, nullptr },
+        { "a2dThreshold_0", field_type::f32, offsetof(T, a2dThreshold_0), 4, 1, nullptr },
+        { "phyisicalKey_1", field_type::s32, offsetof(T, phyisicalKey_1), 4, 1, nullptr },
+        { "traitsType_1", field_type::u8, offsetof(T, traitsType_1), 1, 1, nullptr },
+        { "a2dOperator_1", field_type::u8, offsetof(T, a2dOperator_1), 1, 1, nullptr },
+        { "applyTarget_1", field_type::u8, offsetof(T, applyTarget_1), 1, 1, nullptr },
+        { "isAnalog_1", field_type::boolean, 43, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnalog_1; } },
+        { "enableWin64_1", field_type::boolean, 43, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableWin64_1; } },
+        { "enablePS4_1", field_type::boolean, 43, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enablePS4_1; } },
+        { "enableXboxOne_1", field_type::boolean, 43, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableXboxOne_1; } },
+        { "time1_1", field_type::f32, offsetof(T, time1_1), 4, 1, nullptr },
+        { "time2_1", field_type::f32, offsetof(T, time2_1), 4, 1, nullptr },
+        { "a2dThreshold_1", field_type::f32, offsetof(T, a2dThreshold_1), 4, 1, nullptr },
+        { "phyisicalKey_2", field_type::s32, offsetof(T, phyisicalKey_2), 4, 1, nullptr },
+        { "traitsType_2", field_type::u8, offsetof(T, traitsType_2), 1, 1, nullptr },
+        { "a2dOperator_2", field_type::u8, offsetof(T, a2dOperator_2), 1, 1, nullptr },
+        { "applyTarget_2", field_type::u8, offsetof(T, applyTarget_2), 1, 1, nullptr },
+        { "isAnalog_2", field_type::boolean, 63, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnalog_2; } },
+        { "enableWin64_2", field_type::boolean, 63, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableWin64_2; } },
+        { "enablePS4_2", field_type::boolean, 63, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enablePS4_2; } },
+        { "enableXboxOne_2", field_type::boolean, 63, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableXboxOne_2; } },
+        { "time1_2", field_type::f32, offsetof(T, time1_2), 4, 1, nullptr },
+        { "time2_2", field_type::f32, offsetof(T, time2_2), 4, 1, nullptr },
+        { "a2dThreshold_2", field_type::f32, offsetof(T, a2dThreshold_2), 4, 1, nullptr },
+        { "phyisicalKey_3", field_type::s32, offsetof(T, phyisicalKey_3), 4, 1, nullptr },
+        { "traitsType_3", field_type::u8, offsetof(T, traitsType_3), 1, 1, nullptr },
+        { "a2dOperator_3", field_type::u8, offsetof(T, a2dOperator_3), 1, 1, nullptr },
+        { "applyTarget_3", field_type::u8, offsetof(T, applyTarget_3), 1, 1, nullptr },
+        { "isAnalog_3", field_type::boolean, 83, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnalog_3; } },
+        { "enableWin64_3", field_type::boolean, 83, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableWin64_3; } },
+        { "enablePS4_3", field_type::boolean, 83, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enablePS4_3; } },
+        { "enableXboxOne_3", field_type::boolean, 83, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableXboxOne_3; } },
+        { "time1_3", field_type::f32, offsetof(T, time1_3), 4, 1, nullptr },
+        { "time2_3", field_type::f32, offsetof(T, time2_3), 4, 1, nullptr },
+        { "a2dThreshold_3", field_type::f32, offsetof(T, a2dThreshold_3), 4, 1, nullptr },
+        { "phyisicalKey_4", field_type::s32, offsetof(T, phyisicalKey_4), 4, 1, nullptr },
+        { "traitsType_4", field_type::u8, offsetof(T, traitsType_4), 1, 1, nullptr },
+        { "a2dOperator_4", field_type::u8, offsetof(T, a2dOperator_4), 1, 1, nullptr },
+        { "applyTarget_4", field_type::u8, offsetof(T, applyTarget_4), 1, 1, nullptr },
+        { "isAnalog_4", field_type::boolean, 103, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnalog_4; } },
+        { "enableWin64_4", field_type::boolean, 103, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableWin64_4; } },
+        { "enablePS4_4", field_type::boolean, 103, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enablePS4_4; } },
+        { "enableXboxOne_4", field_type::boolean, 103, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableXboxOne_4; } },
+        { "time1_4", field_type::f32, offsetof(T, time1_4), 4, 1, nullptr },
+        { "time2_4", field_type::f32, offsetof(T, time2_4), 4, 1, nullptr },
+        { "a2dThreshold_4", field_type::f32, offsetof(T, a2dThreshold_4), 4, 1, nullptr },
+        { "phyisicalKey_5", field_type::s32, offsetof(T, phyisicalKey_5), 4, 1, nullptr },
+        { "traitsType_5", field_type::u8, offsetof(T, traitsType_5), 1, 1, nullptr },
+        { "a2dOperator_5", field_type::u8, offsetof(T, a2dOperator_5), 1, 1, nullptr },
+        { "applyTarget_5", field_type::u8, offsetof(T, applyTarget_5), 1, 1, nullptr },
+        { "isAnalog_5", field_type::boolean, 123, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnalog_5; } },
+        { "enableWin64_5", field_type::boolean, 123, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableWin64_5; } },
+        { "enablePS4_5", field_type::boolean, 123, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enablePS4_5; } },
+        { "enableXboxOne_5", field_type::boolean, 123, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableXboxOne_5; } },
+        { "time1_5", field_type::f32, offsetof(T, time1_5), 4, 1, nullptr },
+        { "time2_5", field_type::f32, offsetof(T, time2_5), 4, 1, nullptr },
+        { "a2dThreshold_5", field_type::f32, offsetof(T, a2dThreshold_5), 4, 1, nullptr },
+        { "phyisicalKey_6", field_type::s32, offsetof(T, phyisicalKey_6), 4, 1, nullptr },
+        { "traitsType_6", field_type::u8, offsetof(T, traitsType_6), 1, 1, nullptr },
+        { "a2dOperator_6", field_type::u8, offsetof(T, a2dOperator_6), 1, 1, nullptr },
+        { "applyTarget_6", field_type::u8, offsetof(T, applyTarget_6), 1, 1, nullptr },
+        { "isAnalog_6", field_type::boolean, 143, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnalog_6; } },
+        { "enableWin64_6", field_type::boolean, 143, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableWin64_6; } },
+        { "enablePS4_6", field_type::boolean, 143, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enablePS4_6; } },
+        { "enableXboxOne_6", field_type::boolean, 143, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableXboxOne_6; } },
+        { "time1_6", field_type::f32, offsetof(T, time1_6), 4, 1, nullptr },
+        { "time2_6", field_type::f32, offsetof(T, time2_6), 4, 1, nullptr },
+        { "a2dThreshold_6", field_type::f32, offsetof(T, a2dThreshold_6), 4, 1, nullptr },
+        { "phyisicalKey_7", field_type::s32, offsetof(T, phyisicalKey_7), 4, 1, nullptr },
+        { "traitsType_7", field_type::u8, offsetof(T, traitsType_7), 1, 1, nullptr },
+        { "a2dOperator_7", field_type::u8, offsetof(T, a2dOperator_7), 1, 1, nullptr },
+        { "applyTarget_7", field_type::u8, offsetof(T, applyTarget_7), 1, 1, nullptr },
+        { "isAnalog_7", field_type::boolean, 163, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnalog_7; } },
+        { "enableWin64_7", field_type::boolean, 163, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableWin64_7; } },
+        { "enablePS4_7", field_type::boolean, 163, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enablePS4_7; } },
+        { "enableXboxOne_7", field_type::boolean, 163, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableXboxOne_7; } },
+        { "time1_7", field_type::f32, offsetof(T, time1_7), 4, 1, nullptr },
+        { "time2_7", field_type::f32, offsetof(T, time2_7), 4, 1, nullptr },
+        { "a2dThreshold_7", field_type::f32, offsetof(T, a2dThreshold_7), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, dummy) == 4);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, phyisicalKey_0) == 16);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, traitsType_0) == 20);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dOperator_0) == 21);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, applyTarget_0) == 22);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time1_0) == 24);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time2_0) == 28);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dThreshold_0) == 32);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, phyisicalKey_1) == 36);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, traitsType_1) == 40);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dOperator_1) == 41);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, applyTarget_1) == 42);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time1_1) == 44);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time2_1) == 48);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dThreshold_1) == 52);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, phyisicalKey_2) == 56);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, traitsType_2) == 60);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dOperator_2) == 61);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, applyTarget_2) == 62);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time1_2) == 64);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time2_2) == 68);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dThreshold_2) == 72);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, phyisicalKey_3) == 76);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, traitsType_3) == 80);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dOperator_3) == 81);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, applyTarget_3) == 82);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time1_3) == 84);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time2_3) == 88);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dThreshold_3) == 92);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, phyisicalKey_4) == 96);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, traitsType_4) == 100);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dOperator_4) == 101);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, applyTarget_4) == 102);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time1_4) == 104);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time2_4) == 108);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dThreshold_4) == 112);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, phyisicalKey_5) == 116);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, traitsType_5) == 120);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dOperator_5) == 121);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, applyTarget_5) == 122);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time1_5) == 124);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time2_5) == 128);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dThreshold_5) == 132);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, phyisicalKey_6) == 136);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, traitsType_6) == 140);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dOperator_6) == 141);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, applyTarget_6) == 142);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time1_6) == 144);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time2_6) == 148);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dThreshold_6) == 152);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, phyisicalKey_7) == 156);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, traitsType_7) == 160);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dOperator_7) == 161);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, applyTarget_7) == 162);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time1_7) == 164);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, time2_7) == 168);
+static_assert(offsetof(paramdef::DEFAULT_KEY_ASSIGN, a2dThreshold_7) == 172);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,26 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../DIRECTION_CAMERA_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::DIRECTION_CAMERA_PARAM_ST> {
+    using T = paramdef::DIRECTION_CAMERA_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 3> fields = {{
+        { "isUseOption", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseOption; } },
+        { "pad2", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad2; } },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 15, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::DIRECTION_CAMERA_PARAM_ST, pad1) == 1);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,40 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../ENEMY_COMMON_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::ENEMY_COMMON_PARAM_ST> {
+    using T = paramdef::ENEMY_COMMON_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 9> fields = {{
+        { "reserved0", field_type::u8, offsetof(T, reserved0), 1, 8, nullptr },
+        { "soundTargetTryApproachTime", field_type::s32, offsetof(T, soundTargetTryApproachTime), 4, 1, nullptr },
+        { "searchTargetTryApproachTime", field_type::s32, offsetof(T, searchTargetTryApproachTime), 4, 1, nullptr },
+        { "memoryTargetTryApproachTime", field_type::s32, offsetof(T, memoryTargetTryApproachTime), 4, 1, nullptr },
+        { "reserved5", field_type::u8, offsetof(T, reserved5), 1, 40, nullptr },
+        { "activateChrByTime_PhantomId", field_type::s32, offsetof(T, activateChrByTime_PhantomId), 4, 1, nullptr },
+        { "findUnfavorableFailedPointDist", field_type::f32, offsetof(T, findUnfavorableFailedPointDist), 4, 1, nullptr },
+        { "findUnfavorableFailedPointHeight", field_type::f32, offsetof(T, findUnfavorableFailedPointHeight), 4, 1, nullptr },
+        { "reserved18", field_type::u8, offsetof(T, reserved18), 1, 184, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::ENEMY_COMMON_PARAM_ST, reserved0) == 0);
+static_assert(offsetof(paramdef::ENEMY_COMMON_PARAM_ST, soundTargetTryApproachTime) == 8);
+static_assert(offsetof(paramdef::ENEMY_COMMON_PARAM_ST, searchTargetTryApproachTime) == 12);
+static_assert(offsetof(paramdef::ENEMY_COMMON_PARAM_ST, memoryTargetTryApproachTime) == 16);
+static_assert(offsetof(paramdef::ENEMY_COMMON_PARAM_ST, reserved5) == 20);
+static_assert(offsetof(paramdef::ENEMY_COMMON_PARAM_ST, activateChrByTime_PhantomId) == 60);
+static_assert(offsetof(paramdef::ENEMY_COMMON_PARAM_ST, findUnfavorableFailedPointDist) == 64);
+static_assert(offsetof(paramdef::ENEMY_COMMON_PARAM_ST, findUnfavorableFailedPointHeight) == 68);
+static_assert(offsetof(paramdef::ENEMY_COMMON_PARAM_ST, reserved18) == 72);
+
+}; // namespace params
+}; // namespace from
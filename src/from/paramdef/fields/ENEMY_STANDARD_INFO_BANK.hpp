@@ -0,0 +1,66 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../ENEMY_STANDARD_INFO_BANK.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::ENEMY_STANDARD_INFO_BANK> {
+    using T = paramdef::ENEMY_STANDARD_INFO_BANK;
+
+    static constexpr std::array<field_descriptor, 22> fields = {{
+        { "EnemyBehaviorID", field_type::s32, offsetof(T, EnemyBehaviorID), 4, 1, nullptr },
+        { "HP", field_type::u16, offsetof(T, HP), 2, 1, nullptr },
+        { "AttackPower", field_type::u16, offsetof(T, AttackPower), 2, 1, nullptr },
+        { "ChrType", field_type::s32, offsetof(T, ChrType), 4, 1, nullptr },
+        { "HitHeight", field_type::f32, offsetof(T, HitHeight), 4, 1, nullptr },
+        { "HitRadius", field_type::f32, offsetof(T, HitRadius), 4, 1, nullptr },
+        { "Weight", field_type::f32, offsetof(T, Weight), 4, 1, nullptr },
+        { "DynamicFriction", field_type::f32, offsetof(T, DynamicFriction), 4, 1, nullptr },
+        { "StaticFriction", field_type::f32, offsetof(T, StaticFriction), 4, 1, nullptr },
+        { "UpperDefState", field_type::s32, offsetof(T, UpperDefState), 4, 1, nullptr },
+        { "ActionDefState", field_type::s32, offsetof(T, ActionDefState), 4, 1, nullptr },
+        { "RotY_per_Second", field_type::f32, offsetof(T, RotY_per_Second), 4, 1, nullptr },
+        { "reserve0", field_type::u8, offsetof(T, reserve0), 1, 20, nullptr },
+        { "RotY_per_Second_old", field_type::u8, offsetof(T, RotY_per_Second_old), 1, 1, nullptr },
+        { "EnableSideStep", field_type::u8, offsetof(T, EnableSideStep), 1, 1, nullptr },
+        { "UseRagdollHit", field_type::u8, offsetof(T, UseRagdollHit), 1, 1, nullptr },
+        { "reserve_last", field_type::u8, offsetof(T, reserve_last), 1, 5, nullptr },
+        { "stamina", field_type::u16, offsetof(T, stamina), 2, 1, nullptr },
+        { "staminaRecover", field_type::u16, offsetof(T, staminaRecover), 2, 1, nullptr },
+        { "staminaConsumption", field_type::u16, offsetof(T, staminaConsumption), 2, 1, nullptr },
+        { "deffenct_Phys", field_type::u16, offsetof(T, deffenct_Phys), 2, 1, nullptr },
+        { "reserve_last2", field_type::u8, offsetof(T, reserve_last2), 1, 48, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, EnemyBehaviorID) == 0);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, HP) == 4);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, AttackPower) == 6);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, ChrType) == 8);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, HitHeight) == 12);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, HitRadius) == 16);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, Weight) == 20);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, DynamicFriction) == 24);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, StaticFriction) == 28);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, UpperDefState) == 32);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, ActionDefState) == 36);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, RotY_per_Second) == 40);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, reserve0) == 44);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, RotY_per_Second_old) == 64);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, EnableSideStep) == 65);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, UseRagdollHit) == 66);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, reserve_last) == 67);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, stamina) == 72);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, staminaRecover) == 74);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, staminaConsumption) == 76);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, deffenct_Phys) == 78);
+static_assert(offsetof(paramdef::ENEMY_STANDARD_INFO_BANK, reserve_last2) == 80);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,72 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../EQUIP_MTRL_SET_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::EQUIP_MTRL_SET_PARAM_ST> {
+    using T = paramdef::EQUIP_MTRL_SET_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 28> fields = {{
+        { "materialId01", field_type::s32, offsetof(T, materialId01), 4, 1, nullptr },
+        { "materialId02", field_type::s32, offsetof(T, materialId02), 4, 1, nullptr },
+        { "materialId03", field_type::s32, offsetof(T, materialId03), 4, 1, nullptr },
+        { "materialId04", field_type::s32, offsetof(T, materialId04), 4, 1, nullptr },
+        { "materialId05", field_type::s32, offsetof(T, materialId05), 4, 1, nullptr },
+        { "materialId06", field_type::s32, offsetof(T, materialId06), 4, 1, nullptr },
+        { "pad_id", field_type::u8, offsetof(T, pad_id), 1, 8, nullptr },
+        { "itemNum01", field_type::s8, offsetof(T, itemNum01), 1, 1, nullptr },
+        { "itemNum02", field_type::s8, offsetof(T, itemNum02), 1, 1, nullptr },
+        { "itemNum03", field_type::s8, offsetof(T, itemNum03), 1, 1, nullptr },
+        { "itemNum04", field_type::s8, offsetof(T, itemNum04), 1, 1, nullptr },
+        { "itemNum05", field_type::s8, offsetof(T, itemNum05), 1, 1, nullptr },
+        { "itemNum06", field_type::s8, offsetof(T, itemNum06), 1, 1, nullptr },
+        { "pad_num", field_type::u8, offsetof(T, pad_num), 1, 2, nullptr },
+        { "materialCate01", field_type::u8, offsetof(T, materialCate01), 1, 1, nullptr },
+        { "materialCate02", field_type::u8, offsetof(T, materialCate02), 1, 1, nullptr },
+        { "materialCate03", field_type::u8, offsetof(T, materialCate03), 1, 1, nullptr },
+        { "materialCate04", field_type::u8, offsetof(T, materialCate04), 1, 1, nullptr },
+        { "materialCate05", field_type::u8, offsetof(T, materialCate05), 1, 1, nullptr },
+        { "materialCate06", field_type::u8, offsetof(T, materialCate06), 1, 1, nullptr },
+        { "pad_cate", field_type::u8, offsetof(T, pad_cate), 1, 2, nullptr },
+        { "isDisableDispNum01", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableDispNum01; } },
+        { "isDisableDispNum02", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableDispNum02; } },
+        { "isDisableDispNum03", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableDispNum03; } },
+        { "isDisableDispNum04", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableDispNum04; } },
+        { "isDisableDispNum05", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableDispNum05; } },
+        { "isDisableDispNum06", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableDispNum06; } },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 3, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialId01) == 0);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialId02) == 4);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialId03) == 8);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialId04) == 12);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialId05) == 16);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialId06) == 20);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, pad_id) == 24);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, itemNum01) == 32);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, itemNum02) == 33);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, itemNum03) == 34);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, itemNum04) == 35);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, itemNum05) == 36);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, itemNum06) == 37);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, pad_num) == 38);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialCate01) == 40);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialCate02) == 41);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialCate03) == 42);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialCate04) == 43);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialCate05) == 44);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, materialCate06) == 45);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, pad_cate) == 46);
+static_assert(offsetof(paramdef::EQUIP_MTRL_SET_PARAM_ST, pad) == 49);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,99 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../EQUIP_PARAM_ACCESSORY_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::EQUIP_PARAM_ACCESSORY_ST> {
+    using T = paramdef::EQUIP_PARAM_ACCESSORY_ST;
+
+    static constexpr std::array<field_descriptor, 43> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "refId", field_type::s32, offsetof(T, refId), 4, 1, nullptr },
+        { "sfxVariationId", field_type::s32, offsetof(T, sfxVariationId), 4, 1, nullptr },
+        { "weight", field_type::f32, offsetof(T, weight), 4, 1, nullptr },
+        { "behaviorId", field_type::s32, offsetof(T, behaviorId), 4, 1, nullptr },
+        { "basicPrice", field_type::s32, offsetof(T, basicPrice), 4, 1, nullptr },
+        { "sellValue", field_type::s32, offsetof(T, sellValue), 4, 1, nullptr },
+        { "sortId", field_type::s32, offsetof(T, sortId), 4, 1, nullptr },
+        { "qwcId", field_type::s32, offsetof(T, qwcId), 4, 1, nullptr },
+        { "equipModelId", field_type::u16, offsetof(T, equipModelId), 2, 1, nullptr },
+        { "iconId", field_type::u16, offsetof(T, iconId), 2, 1, nullptr },
+        { "shopLv", field_type::s16, offsetof(T, shopLv), 2, 1, nullptr },
+        { "trophySGradeId", field_type::s16, offsetof(T, trophySGradeId), 2, 1, nullptr },
+        { "trophySeqId", field_type::s16, offsetof(T, trophySeqId), 2, 1, nullptr },
+        { "equipModelCategory", field_type::u8, offsetof(T, equipModelCategory), 1, 1, nullptr },
+        { "equipModelGender", field_type::u8, offsetof(T, equipModelGender), 1, 1, nullptr },
+        { "accessoryCategory", field_type::u8, offsetof(T, accessoryCategory), 1, 1, nullptr },
+        { "refCategory", field_type::u8, offsetof(T, refCategory), 1, 1, nullptr },
+        { "spEffectCategory", field_type::u8, offsetof(T, spEffectCategory), 1, 1, nullptr },
+        { "sortGroupId", field_type::u8, offsetof(T, sortGroupId), 1, 1, nullptr },
+        { "vagrantItemLotId", field_type::s32, offsetof(T, vagrantItemLotId), 4, 1, nullptr },
+        { "vagrantBonusEneDropItemLotId", field_type::s32, offsetof(T, vagrantBonusEneDropItemLotId), 4, 1, nullptr },
+        { "vagrantItemEneDropItemLotId", field_type::s32, offsetof(T, vagrantItemEneDropItemLotId), 4, 1, nullptr },
+        { "isDeposit", field_type::boolean, 64, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDeposit; } },
+        { "isEquipOutBrake", field_type::boolean, 64, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEquipOutBrake; } },
+        { "disableMultiDropShare", field_type::boolean, 64, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableMultiDropShare; } },
+        { "isDiscard", field_type::boolean, 64, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDiscard; } },
+        { "isDrop", field_type::boolean, 64, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDrop; } },
+        { "showLogCondType", field_type::boolean, 64, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->showLogCondType; } },
+        { "showDialogCondType", field_type::u8, 64, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->showDialogCondType; } },
+        { "rarity", field_type::u8, offsetof(T, rarity), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 2, nullptr },
+        { "saleValue", field_type::s32, offsetof(T, saleValue), 4, 1, nullptr },
+        { "accessoryGroup", field_type::s16, offsetof(T, accessoryGroup), 2, 1, nullptr },
+        { "pad3", field_type::u8, offsetof(T, pad3), 1, 1, nullptr },
+        { "compTrophySedId", field_type::s8, offsetof(T, compTrophySedId), 1, 1, nullptr },
+        { "residentSpEffectId1", field_type::s32, offsetof(T, residentSpEffectId1), 4, 1, nullptr },
+        { "residentSpEffectId2", field_type::s32, offsetof(T, residentSpEffectId2), 4, 1, nullptr },
+        { "residentSpEffectId3", field_type::s32, offsetof(T, residentSpEffectId3), 4, 1, nullptr },
+        { "residentSpEffectId4", field_type::s32, offsetof(T, residentSpEffectId4), 4, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, refId) == 4);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, sfxVariationId) == 8);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, weight) == 12);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, behaviorId) == 16);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, basicPrice) == 20);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, sellValue) == 24);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, sortId) == 28);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, qwcId) == 32);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, equipModelId) == 36);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, iconId) == 38);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, shopLv) == 40);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, trophySGradeId) == 42);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, trophySeqId) == 44);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, equipModelCategory) == 46);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, equipModelGender) == 47);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, accessoryCategory) == 48);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, refCategory) == 49);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, spEffectCategory) == 50);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, sortGroupId) == 51);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, vagrantItemLotId) == 52);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, vagrantBonusEneDropItemLotId) == 56);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, vagrantItemEneDropItemLotId) == 60);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, rarity) == 65);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, pad2) == 66);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, saleValue) == 68);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, accessoryGroup) == 72);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, pad3) == 74);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, compTrophySedId) == 75);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, residentSpEffectId1) == 76);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, residentSpEffectId2) == 80);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, residentSpEffectId3) == 84);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, residentSpEffectId4) == 88);
+static_assert(offsetof(paramdef::EQUIP_PARAM_ACCESSORY_ST, pad1) == 92);
+
+}; // namespace params
+}; // namespace from
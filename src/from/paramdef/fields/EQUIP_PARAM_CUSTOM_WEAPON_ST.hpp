@@ -0,0 +1,30 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../EQUIP_PARAM_CUSTOM_WEAPON_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::EQUIP_PARAM_CUSTOM_WEAPON_ST> {
+    using T = paramdef::EQUIP_PARAM_CUSTOM_WEAPON_ST;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "baseWepId", field_type::s32, offsetof(T, baseWepId), 4, 1, nullptr },
+        { "gemId", field_type::s32, offsetof(T, gemId), 4, 1, nullptr },
+        { "reinforceLv", field_type::u8, offsetof(T, reinforceLv), 1, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 7, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::EQUIP_PARAM_CUSTOM_WEAPON_ST, baseWepId) == 0);
+static_assert(offsetof(paramdef::EQUIP_PARAM_CUSTOM_WEAPON_ST, gemId) == 4);
+static_assert(offsetof(paramdef::EQUIP_PARAM_CUSTOM_WEAPON_ST, reinforceLv) == 8);
+static_assert(offsetof(paramdef::EQUIP_PARAM_CUSTOM_WEAPON_ST, pad) == 9);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,144 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../EQUIP_PARAM_GEM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::EQUIP_PARAM_GEM_ST> {
+    using T = paramdef::EQUIP_PARAM_GEM_ST;
+
+    static constexpr std::array<field_descriptor, 96> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "iconId", field_type::u16, offsetof(T, iconId), 2, 1, nullptr },
+        { "rank", field_type::s8, offsetof(T, rank), 1, 1, nullptr },
+        { "sortGroupId", field_type::u8, offsetof(T, sortGroupId), 1, 1, nullptr },
+        { "spEffectId0", field_type::s32, offsetof(T, spEffectId0), 4, 1, nullptr },
+        { "spEffectId1", field_type::s32, offsetof(T, spEffectId1), 4, 1, nullptr },
+        { "spEffectId2", field_type::s32, offsetof(T, spEffectId2), 4, 1, nullptr },
+        { "itemGetTutorialFlagId", field_type::u32, offsetof(T, itemGetTutorialFlagId), 4, 1, nullptr },
+        { "swordArtsParamId", field_type::s32, offsetof(T, swordArtsParamId), 4, 1, nullptr },
+        { "mountValue", field_type::s32, offsetof(T, mountValue), 4, 1, nullptr },
+        { "sellValue", field_type::s32, offsetof(T, sellValue), 4, 1, nullptr },
+        { "saleValue", field_type::s32, offsetof(T, saleValue), 4, 1, nullptr },
+        { "sortId", field_type::s32, offsetof(T, sortId), 4, 1, nullptr },
+        { "compTrophySedId", field_type::s16, offsetof(T, compTrophySedId), 2, 1, nullptr },
+        { "trophySeqId", field_type::s16, offsetof(T, trophySeqId), 2, 1, nullptr },
+        { "configurableWepAttr00", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr00; } },
+        { "configurableWepAttr01", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr01; } },
+        { "configurableWepAttr02", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr02; } },
+        { "configurableWepAttr03", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr03; } },
+        { "configurableWepAttr04", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr04; } },
+        { "configurableWepAttr05", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr05; } },
+        { "configurableWepAttr06", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr06; } },
+        { "configurableWepAttr07", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr07; } },
+        { "configurableWepAttr08", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr08; } },
+        { "configurableWepAttr09", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr09; } },
+        { "configurableWepAttr10", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr10; } },
+        { "configurableWepAttr11", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr11; } },
+        { "configurableWepAttr12", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr12; } },
+        { "configurableWepAttr13", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr13; } },
+        { "configurableWepAttr14", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr14; } },
+        { "configurableWepAttr15", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr15; } },
+        { "rarity", field_type::u8, offsetof(T, rarity), 1, 1, nullptr },
+        { "configurableWepAttr16", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr16; } },
+        { "configurableWepAttr17", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr17; } },
+        { "configurableWepAttr18", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr18; } },
+        { "configurableWepAttr19", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr19; } },
+        { "configurableWepAttr20", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr20; } },
+        { "configurableWepAttr21", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr21; } },
+        { "configurableWepAttr22", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr22; } },
+        { "configurableWepAttr23", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->configurableWepAttr23; } },
+        { "isDiscard", field_type::boolean, 52, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDiscard; } },
+        { "isDrop", field_type::boolean, 52, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDrop; } },
+        { "isDeposit", field_type::boolean, 52, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDeposit; } },
+        { "disableMultiDropShare", field_type::boolean, 52, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableMultiDropShare; } },
+        { "showDialogCondType", field_type::u8, 52, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->showDialogCondType; } },
+        { "showLogCondType", field_type::boolean, 52, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->showLogCondType; } },
+        { "pad", field_type::u8, 52, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad; } },
+        { "defaultWepAttr", field_type::u8, offsetof(T, defaultWepAttr), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 2, nullptr },
+        { "canMountWep_Dagger", field_type::boolean, 56, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Dagger; } },
+        { "canMountWep_SwordNormal", field_type::boolean, 56, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SwordNormal; } },
+        { "canMountWep_SwordLarge", field_type::boolean, 56, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SwordLarge; } },
+        { "canMountWep_SwordGigantic", field_type::boolean, 56, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SwordGigantic; } },
+        { "canMountWep_SaberNormal", field_type::boolean, 56, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SaberNormal; } },
+        { "canMountWep_SaberLarge", field_type::boolean, 56, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SaberLarge; } },
+        { "canMountWep_katana", field_type::boolean, 56, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_katana; } },
+        { "canMountWep_SwordDoubleEdge", field_type::boolean, 56, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SwordDoubleEdge; } },
+        { "canMountWep_SwordPierce", field_type::boolean, 57, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SwordPierce; } },
+        { "canMountWep_RapierHeavy", field_type::boolean, 57, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_RapierHeavy; } },
+        { "canMountWep_AxeNormal", field_type::boolean, 57, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_AxeNormal; } },
+        { "canMountWep_AxeLarge", field_type::boolean, 57, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_AxeLarge; } },
+        { "canMountWep_HammerNormal", field_type::boolean, 57, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_HammerNormal; } },
+        { "canMountWep_HammerLarge", field_type::boolean, 57, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_HammerLarge; } },
+        { "canMountWep_Flail", field_type::boolean, 57, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Flail; } },
+        { "canMountWep_SpearNormal", field_type::boolean, 57, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SpearNormal; } },
+        { "canMountWep_SpearLarge", field_type::boolean, 58, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SpearLarge; } },
+        { "canMountWep_SpearHeavy", field_type::boolean, 58, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SpearHeavy; } },
+        { "canMountWep_SpearAxe", field_type::boolean, 58, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_SpearAxe; } },
+        { "canMountWep_Sickle", field_type::boolean, 58, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Sickle; } },
+        { "canMountWep_Knuckle", field_type::boolean, 58, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Knuckle; } },
+        { "canMountWep_Claw", field_type::boolean, 58, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Claw; } },
+        { "canMountWep_Whip", field_type::boolean, 58, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Whip; } },
+        { "canMountWep_AxhammerLarge", field_type::boolean, 58, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_AxhammerLarge; } },
+        { "canMountWep_BowSmall", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_BowSmall; } },
+        { "canMountWep_BowNormal", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_BowNormal; } },
+        { "canMountWep_BowLarge", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_BowLarge; } },
+        { "canMountWep_ClossBow", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_ClossBow; } },
+        { "canMountWep_Ballista", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Ballista; } },
+        { "canMountWep_Staff", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Staff; } },
+        { "canMountWep_Sorcery", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Sorcery; } },
+        { "canMountWep_Talisman", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Talisman; } },
+        { "canMountWep_ShieldSmall", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_ShieldSmall; } },
+        { "canMountWep_ShieldNormal", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_ShieldNormal; } },
+        { "canMountWep_ShieldLarge", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_ShieldLarge; } },
+        { "canMountWep_Torch", field_type::boolean, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMountWep_Torch; } },
+        { "reserved_canMountWep", field_type::u8, 60, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->reserved_canMountWep; } },
+        { "reserved2_canMountWep", field_type::u8, offsetof(T, reserved2_canMountWep), 1, 3, nullptr },
+        { "spEffectMsgId0", field_type::s32, offsetof(T, spEffectMsgId0), 4, 1, nullptr },
+        { "spEffectMsgId1", field_type::s32, offsetof(T, spEffectMsgId1), 4, 1, nullptr },
+        { "spEffectId_forAtk0", field_type::s32, offsetof(T, spEffectId_forAtk0), 4, 1, nullptr },
+        { "spEffectId_forAtk1", field_type::s32, offsetof(T, spEffectId_forAtk1), 4, 1, nullptr },
+        { "spEffectId_forAtk2", field_type::s32, offsetof(T, spEffectId_forAtk2), 4, 1, nullptr },
+        { "mountWepTextId", field_type::s32, offsetof(T, mountWepTextId), 4, 1, nullptr },
+        { "pad6", field_type::u8, offsetof(T, pad6), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, iconId) == 4);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, rank) == 6);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, sortGroupId) == 7);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, spEffectId0) == 8);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, spEffectId1) == 12);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, spEffectId2) == 16);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, itemGetTutorialFlagId) == 20);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, swordArtsParamId) == 24);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, mountValue) == 28);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, sellValue) == 32);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, saleValue) == 36);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, sortId) == 40);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, compTrophySedId) == 44);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, trophySeqId) == 46);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, rarity) == 50);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, defaultWepAttr) == 53);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, pad2) == 54);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, reserved2_canMountWep) == 61);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, spEffectMsgId0) == 64);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, spEffectMsgId1) == 68);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, spEffectId_forAtk0) == 72);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, spEffectId_forAtk1) == 76);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, spEffectId_forAtk2) == 80);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, mountWepTextId) == 84);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GEM_ST, pad6) == 88);
+
+}; // namespace params
+}; // namespace from
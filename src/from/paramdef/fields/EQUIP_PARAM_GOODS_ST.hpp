@@ -0,0 +1,213 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../EQUIP_PARAM_GOODS_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::EQUIP_PARAM_GOODS_ST> {
+    using T = paramdef::EQUIP_PARAM_GOODS_ST;
+
+    static constexpr std::array<field_descriptor, 117> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "refId_default", field_type::s32, offsetof(T, refId_default), 4, 1, nullptr },
+        { "sfxVariationId", field_type::s32, offsetof(T, sfxVariationId), 4, 1, nullptr },
+        { "weight", field_type::f32, offsetof(T, weight), 4, 1, nullptr },
+        { "basicPrice", field_type::s32, offsetof(T, basicPrice), 4, 1, nullptr },
+        { "sellValue", field_type::s32, offsetof(T, sellValue), 4, 1, nullptr },
+        { "behaviorId", field_type::s32, offsetof(T, behaviorId), 4, 1, nullptr },
+        { "replaceItemId", field_type::s32, offsetof(T, replaceItemId), 4, 1, nullptr },
+        { "sortId", field_type::s32, offsetof(T, sortId), 4, 1, nullptr },
+        { "appearanceReplaceItemId", field_type::s32, offsetof(T, appearanceReplaceItemId), 4, 1, nullptr },
+        { "yesNoDialogMessageId", field_type::s32, offsetof(T, yesNoDialogMessageId), 4, 1, nullptr },
+        { "useEnableSpEffectType", field_type::u16, offsetof(T, useEnableSpEffectType), 2, 1, nullptr },
+        { "potGroupId", field_type::s8, offsetof(T, potGroupId), 1, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 1, nullptr },
+        { "iconId", field_type::u16, offsetof(T, iconId), 2, 1, nullptr },
+        { "modelId", field_type::u16, offsetof(T, modelId), 2, 1, nullptr },
+        { "shopLv", field_type::s16, offsetof(T, shopLv), 2, 1, nullptr },
+        { "compTrophySedId", field_type::s16, offsetof(T, compTrophySedId), 2, 1, nullptr },
+        { "trophySeqId", field_type::s16, offsetof(T, trophySeqId), 2, 1, nullptr },
+        { "maxNum", field_type::s16, offsetof(T, maxNum), 2, 1, nullptr },
+        { "consumeHeroPoint", field_type::u8, offsetof(T, consumeHeroPoint), 1, 1, nullptr },
+        { "overDexterity", field_type::u8, offsetof(T, overDexterity), 1, 1, nullptr },
+        { "goodsType", field_type::u8, offsetof(T, goodsType), 1, 1, nullptr },
+        { "refCategory", field_type::u8, offsetof(T, refCategory), 1, 1, nullptr },
+        { "spEffectCategory", field_type::u8, offsetof(T, spEffectCategory), 1, 1, nullptr },
+        { "pad3", field_type::u8, offsetof(T, pad3), 1, 1, nullptr },
+        { "goodsUseAnim", field_type::u8, offsetof(T, goodsUseAnim), 1, 1, nullptr },
+        { "opmeMenuType", field_type::u8, offsetof(T, opmeMenuType), 1, 1, nullptr },
+        { "useLimitCategory", field_type::u8, offsetof(T, useLimitCategory), 1, 1, nullptr },
+        { "replaceCategory", field_type::u8, offsetof(T, replaceCategory), 1, 1, nullptr },
+        { "reserve4", field_type::u8, offsetof(T, reserve4), 1, 2, nullptr },
+        { "enable_live", field_type::boolean, 72, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_live; } },
+        { "enable_gray", field_type::boolean, 72, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_gray; } },
+        { "enable_white", field_type::boolean, 72, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_white; } },
+        { "enable_black", field_type::boolean, 72, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_black; } },
+        { "enable_multi", field_type::boolean, 72, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_multi; } },
+        { "disable_offline", field_type::boolean, 72, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disable_offline; } },
+        { "isEquip", field_type::boolean, 72, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEquip; } },
+        { "isConsume", field_type::boolean, 72, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isConsume; } },
+        { "isAutoEquip", field_type::boolean, 73, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAutoEquip; } },
+        { "isEstablishment", field_type::boolean, 73, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEstablishment; } },
+        { "isOnlyOne", field_type::boolean, 73, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isOnlyOne; } },
+        { "isDiscard", field_type::boolean, 73, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDiscard; } },
+        { "isDeposit", field_type::boolean, 73, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDeposit; } },
+        { "isDisableHand", field_type::boolean, 73, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableHand; } },
+        { "isRemoveItem_forGameClear", field_type::boolean, 73, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isRemoveItem_forGameClear; } },
+        { "isSuppleItem", field_type::boolean, 73, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSuppleItem; } },
+        { "isFullSuppleItem", field_type::boolean, 74, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isFullSuppleItem; } },
+        { "isEnhance", field_type::boolean, 74, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnhance; } },
+        { "isFixItem", field_type::boolean, 74, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isFixItem; } },
+        { "disableMultiDropShare", field_type::boolean, 74, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableMultiDropShare; } },
+        { "disableUseAtColiseum", field_type::boolean, 74, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableUseAtColiseum; } },
+        { "disableUseAtOutOfColiseum", field_type::boolean, 74, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableUseAtOutOfColiseum; } },
+        { "isEnableFastUseItem", field_type::boolean, 74, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableFastUseItem; } },
+        { "isApplySpecialEffect", field_type::boolean, 74, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isApplySpecialEffect; } },
+        { "syncNumVaryId", field_type::u8, offsetof(T, syncNumVaryId), 1, 1, nullptr },
+        { "refId_1", field_type::s32, offsetof(T, refId_1), 4, 1, nullptr },
+        { "refVirtualWepId", field_type::s32, offsetof(T, refVirtualWepId), 4, 1, nullptr },
+        { "vagrantItemLotId", field_type::s32, offsetof(T, vagrantItemLotId), 4, 1, nullptr },
+        { "vagrantBonusEneDropItemLotId", field_type::s32, offsetof(T, vagrantBonusEneDropItemLotId), 4, 1, nullptr },
+        { "vagrantItemEneDropItemLotId", field_type::s32, offsetof(T, vagrantItemEneDropItemLotId), 4, 1, nullptr },
+        { "castSfxId", field_type::s32, offsetof(T, castSfxId), 4, 1, nullptr },
+        { "fireSfxId", field_type::s32, offsetof(T, fireSfxId), 4, 1, nullptr },
+        { "effectSfxId", field_type::s32, offsetof(T, effectSfxId), 4, 1, nullptr },
+        { "enable_ActiveBigRune", field_type::boolean, 108, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_ActiveBigRune; } },
+        { "isBonfireWarpItem", field_type::boolean, 108, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBonfireWarpItem; } },
+        { "enable_Ladder", field_type::boolean, 108, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_Ladder; } },
+        { "isUseMultiPlayPreparation", field_type::boolean, 108, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseMultiPlayPreparation; } },
+        { "canMultiUse", field_type::boolean, 108, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMultiUse; } },
+        { "isShieldEnchant", field_type::boolean, 108, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isShieldEnchant; } },
+        { "isWarpProhibited", field_type::boolean, 108, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isWarpProhibited; } },
+        { "isUseMultiPenaltyOnly", field_type::boolean, 108, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseMultiPenaltyOnly; } },
+        { "suppleType", field_type::u8, offsetof(T, suppleType), 1, 1, nullptr },
+        { "autoReplenishType", field_type::u8, offsetof(T, autoReplenishType), 1, 1, nullptr },
+        { "isDrop", field_type::boolean, 111, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDrop; } },
+        { "showLogCondType", field_type::boolean, 111, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->showLogCondType; } },
+        { "isSummonHorse", field_type::boolean, 111, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSummonHorse; } },
+        { "showDialogCondType", field_type::u8, 111, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->showDialogCondType; } },
+        { "isSleepCollectionItem", field_type::boolean, 111, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSleepCollectionItem; } },
+        { "enableRiding", field_type::boolean, 111, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableRiding; } },
+        { "disableRiding", field_type::boolean, 111, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableRiding; } },
+        { "maxRepositoryNum", field_type::s16, offsetof(T, maxRepositoryNum), 2, 1, nullptr },
+        { "sortGroupId", field_type::u8, offsetof(T, sortGroupId), 1, 1, nullptr },
+        { "isUseNoAttackRegion", field_type::boolean, 115, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseNoAttackRegion; } },
+        { "pad1", field_type::u8, 115, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad1; } },
+        { "saleValue", field_type::s32, offsetof(T, saleValue), 4, 1, nullptr },
+        { "rarity", field_type::u8, offsetof(T, rarity), 1, 1, nullptr },
+        { "useLimitSummonBuddy", field_type::u8, offsetof(T, useLimitSummonBuddy), 1, 1, nullptr },
+        { "useLimitSpEffectType", field_type::u16, offsetof(T, useLimitSpEffectType), 2, 1, nullptr },
+        { "aiUseJudgeId", field_type::s32, offsetof(T, aiUseJudgeId), 4, 1, nullptr },
+        { "consumeMP", field_type::s16, offsetof(T, consumeMP), 2, 1, nullptr },
+        { "consumeHP", field_type::s16, offsetof(T, consumeHP), 2, 1, nullptr },
+        { "reinforceGoodsId", field_type::s32, offsetof(T, reinforceGoodsId), 4, 1, nullptr },
+        { "reinforceMaterialId", field_type::s32, offsetof(T, reinforceMaterialId), 4, 1, nullptr },
+        { "reinforcePrice", field_type::s32, offsetof(T, reinforcePrice), 4, 1, nullptr },
+        { "useLevel_vowType0", field_type::s8, offsetof(T, useLevel_vowType0), 1, 1, nullptr },
+        { "useLevel_vowType1", field_type::s8, offsetof(T, useLevel_vowType1), 1, 1, nullptr },
+        { "useLevel_vowType2", field_type::s8, offsetof(T, useLevel_vowType2), 1, 1, nullptr },
+        { "useLevel_vowType3", field_type::s8, offsetof(T, useLevel_vowType3), 1, 1, nullptr },
+        { "useLevel_vowType4", field_type::s8, offsetof(T, useLevel_vowType4), 1, 1, nullptr },
+        { "useLevel_vowType5", field_type::s8, offsetof(T, useLevel_vowType5), 1, 1, nullptr },
+        { "useLevel_vowType6", field_type::s8, offsetof(T, useLevel_vowType6), 1, 1, nullptr },
+        { "useLevel_vowType7", field_type::s8, offsetof(T, useLevel_vowType7), 1, 1, nullptr },
+        { "useLevel_vowType8", field_type::s8, offsetof(T, useLevel_vowType8), 1, 1, nullptr },
+        { "useLevel_vowType9", field_type::s8, offsetof(T, useLevel_vowType9), 1, 1, nullptr },
+        { "useLevel_vowType10", field_type::s8, offsetof(T, useLevel_vowType10), 1, 1, nullptr },
+        { "useLevel_vowType11", field_type::s8, offsetof(T, useLevel_vowType11), 1, 1, nullptr },
+        { "useLevel_vowType12", field_type::s8, offsetof(T, useLevel_vowType12), 1, 1, nullptr },
+        { "useLevel_vowType13", field_type::s8, offsetof(T, useLevel_vowType13), 1, 1, nullptr },
+        { "useLevel_vowType14", field_type::s8, offsetof(T, useLevel_vowType14), 1, 1, nullptr },
+        { "useLevel_vowType15", field_type::s8, offsetof(T, useLevel_vowType15), 1, 1, nullptr },
+        { "useLevel", field_type::u16, offsetof(T, useLevel), 2, 1, nullptr },
+        { "reserve5", field_type::u8, offsetof(T, reserve5), 1, 2, nullptr },
+        { "itemGetTutorialFlagId", field_type::u32, offsetof(T, itemGetTutorialFlagId), 4, 1, nullptr },
+        { "reserve3", field_type::u8, offsetof(T, reserve3), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, refId_default) == 4);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, sfxVariationId) == 8);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, weight) == 12);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, basicPrice) == 16);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, sellValue) == 20);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, behaviorId) == 24);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, replaceItemId) == 28);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, sortId) == 32);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, appearanceReplaceItemId) == 36);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, yesNoDialogMessageId) == 40);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useEnableSpEffectType) == 44);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, potGroupId) == 46);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, pad) == 47);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, iconId) == 48);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, modelId) == 50);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, shopLv) == 52);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, compTrophySedId) == 54);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, trophySeqId) == 56);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, maxNum) == 58);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, consumeHeroPoint) == 60);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, overDexterity) == 61);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, goodsType) == 62);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, refCategory) == 63);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, spEffectCategory) == 64);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, pad3) == 65);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, goodsUseAnim) == 66);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, opmeMenuType) == 67);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLimitCategory) == 68);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, replaceCategory) == 69);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, reserve4) == 70);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, syncNumVaryId) == 75);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, refId_1) == 76);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, refVirtualWepId) == 80);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, vagrantItemLotId) == 84);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, vagrantBonusEneDropItemLotId) == 88);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, vagrantItemEneDropItemLotId) == 92);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, castSfxId) == 96);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, fireSfxId) == 100);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, effectSfxId) == 104);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, suppleType) == 109);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, autoReplenishType) == 110);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, maxRepositoryNum) == 112);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, sortGroupId) == 114);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, saleValue) == 116);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, rarity) == 120);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLimitSummonBuddy) == 121);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLimitSpEffectType) == 122);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, aiUseJudgeId) == 124);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, consumeMP) == 128);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, consumeHP) == 130);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, reinforceGoodsId) == 132);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, reinforceMaterialId) == 136);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, reinforcePrice) == 140);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType0) == 144);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType1) == 145);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType2) == 146);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType3) == 147);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType4) == 148);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType5) == 149);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType6) == 150);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType7) == 151);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType8) == 152);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType9) == 153);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType10) == 154);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType11) == 155);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType12) == 156);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType13) == 157);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType14) == 158);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel_vowType15) == 159);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, useLevel) == 160);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, reserve5) == 162);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, itemGetTutorialFlagId) == 164);
+static_assert(offsetof(paramdef::EQUIP_PARAM_GOODS_ST, reserve3) == 168);
+
+}; // namespace params
+}; // namespace from
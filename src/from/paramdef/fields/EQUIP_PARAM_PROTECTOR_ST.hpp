@@ -0,0 +1,471 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../EQUIP_PARAM_PROTECTOR_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::EQUIP_PARAM_PROTECTOR_ST> {
+    using T = paramdef::EQUIP_PARAM_PROTECTOR_ST;
+
+    static constexpr std::array<field_descriptor, 250> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "sortId", field_type::s32, offsetof(T, sortId), 4, 1, nullptr },
+        { "wanderingEquipId", field_type::u32, offsetof(T, wanderingEquipId), 4, 1, nullptr },
+        { "resistSleep", field_type::u16, offsetof(T, resistSleep), 2, 1, nullptr },
+        { "resistMadness", field_type::u16, offsetof(T, resistMadness), 2, 1, nullptr },
+        { "saDurability", field_type::f32, offsetof(T, saDurability), 4, 1, nullptr },
+        { "toughnessCorrectRate", field_type::f32, offsetof(T, toughnessCorrectRate), 4, 1, nullptr },
+        { "fixPrice", field_type::s32, offsetof(T, fixPrice), 4, 1, nullptr },
+        { "basicPrice", field_type::s32, offsetof(T, basicPrice), 4, 1, nullptr },
+        { "sellValue", field_type::s32, offsetof(T, sellValue), 4, 1, nullptr },
+        { "weight", field_type::f32, offsetof(T, weight), 4, 1, nullptr },
+        { "residentSpEffectId", field_type::s32, offsetof(T, residentSpEffectId), 4, 1, nullptr },
+        { "residentSpEffectId2", field_type::s32, offsetof(T, residentSpEffectId2), 4, 1, nullptr },
+        { "residentSpEffectId3", field_type::s32, offsetof(T, residentSpEffectId3), 4, 1, nullptr },
+        { "materialSetId", field_type::s32, offsetof(T, materialSetId), 4, 1, nullptr },
+        { "partsDamageRate", field_type::f32, offsetof(T, partsDamageRate), 4, 1, nullptr },
+        { "corectSARecover", field_type::f32, offsetof(T, corectSARecover), 4, 1, nullptr },
+        { "originEquipPro", field_type::s32, offsetof(T, originEquipPro), 4, 1, nullptr },
+        { "originEquipPro1", field_type::s32, offsetof(T, originEquipPro1), 4, 1, nullptr },
+        { "originEquipPro2", field_type::s32, offsetof(T, originEquipPro2), 4, 1, nullptr },
+        { "originEquipPro3", field_type::s32, offsetof(T, originEquipPro3), 4, 1, nullptr },
+        { "originEquipPro4", field_type::s32, offsetof(T, originEquipPro4), 4, 1, nullptr },
+        { "originEquipPro5", field_type::s32, offsetof(T, originEquipPro5), 4, 1, nullptr },
+        { "originEquipPro6", field_type::s32, offsetof(T, originEquipPro6), 4, 1, nullptr },
+        { "originEquipPro7", field_type::s32, offsetof(T, originEquipPro7), 4, 1, nullptr },
+        { "originEquipPro8", field_type::s32, offsetof(T, originEquipPro8), 4, 1, nullptr },
+        { "originEquipPro9", field_type::s32, offsetof(T, originEquipPro9), 4, 1, nullptr },
+        { "originEquipPro10", field_type::s32, offsetof(T, originEquipPro10), 4, 1, nullptr },
+        { "originEquipPro11", field_type::s32, offsetof(T, originEquipPro11), 4, 1, nullptr },
+        { "originEquipPro12", field_type::s32, offsetof(T, originEquipPro12), 4, 1, nullptr },
+        { "originEquipPro13", field_type::s32, offsetof(T, originEquipPro13), 4, 1, nullptr },
+        { "originEquipPro14", field_type::s32, offsetof(T, originEquipPro14), 4, 1, nullptr },
+        { "originEquipPro15", field_type::s32, offsetof(T, originEquipPro15), 4, 1, nullptr },
+        { "faceScaleM_ScaleX", field_type::f32, offsetof(T, faceScaleM_ScaleX), 4, 1, nullptr },
+        { "faceScaleM_ScaleZ", field_type::f32, offsetof(T, faceScaleM_ScaleZ), 4, 1, nullptr },
+        { "faceScaleM_MaxX", field_type::f32, offsetof(T, faceScaleM_MaxX), 4, 1, nullptr },
+        { "faceScaleM_MaxZ", field_type::f32, offsetof(T, faceScaleM_MaxZ), 4, 1, nullptr },
+        { "faceScaleF_ScaleX", field_type::f32, offsetof(T, faceScaleF_ScaleX), 4, 1, nullptr },
+        { "faceScaleF_ScaleZ", field_type::f32, offsetof(T, faceScaleF_ScaleZ), 4, 1, nullptr },
+        { "faceScaleF_MaxX", field_type::f32, offsetof(T, faceScaleF_MaxX), 4, 1, nullptr },
+        { "faceScaleF_MaxZ", field_type::f32, offsetof(T, faceScaleF_MaxZ), 4, 1, nullptr },
+        { "qwcId", field_type::s32, offsetof(T, qwcId), 4, 1, nullptr },
+        { "equipModelId", field_type::u16, offsetof(T, equipModelId), 2, 1, nullptr },
+        { "iconIdM", field_type::u16, offsetof(T, iconIdM), 2, 1, nullptr },
+        { "iconIdF", field_type::u16, offsetof(T, iconIdF), 2, 1, nullptr },
+        { "knockBack", field_type::u16, offsetof(T, knockBack), 2, 1, nullptr },
+        { "knockbackBounceRate", field_type::u16, offsetof(T, knockbackBounceRate), 2, 1, nullptr },
+        { "durability", field_type::u16, offsetof(T, durability), 2, 1, nullptr },
+        { "durabilityMax", field_type::u16, offsetof(T, durabilityMax), 2, 1, nullptr },
+        { "pad03", field_type::u8, offsetof(T, pad03), 1, 2, nullptr },
+        { "defFlickPower", field_type::u16, offsetof(T, defFlickPower), 2, 1, nullptr },
+        { "defensePhysics", field_type::u16, offsetof(T, defensePhysics), 2, 1, nullptr },
+        { "defenseMagic", field_type::u16, offsetof(T, defenseMagic), 2, 1, nullptr },
+        { "defenseFire", field_type::u16, offsetof(T, defenseFire), 2, 1, nullptr },
+        { "defenseThunder", field_type::u16, offsetof(T, defenseThunder), 2, 1, nullptr },
+        { "defenseSlash", field_type::s16, offsetof(T, defenseSlash), 2, 1, nullptr },
+        { "defenseBlow", field_type::s16, offsetof(T, defenseBlow), 2, 1, nullptr },
+        { "defenseThrust", field_type::s16, offsetof(T, defenseThrust), 2, 1, nullptr },
+        { "resistPoison", field_type::u16, offsetof(T, resistPoison), 2, 1, nullptr },
+        { "resistDisease", field_type::u16, offsetof(T, resistDisease), 2, 1, nullptr },
+        { "resistBlood", field_type::u16, offsetof(T, resistBlood), 2, 1, nullptr },
+        { "resistCurse", field_type::u16, offsetof(T, resistCurse), 2, 1, nullptr },
+        { "reinforceTypeId", field_type::s16, offsetof(T, reinforceTypeId), 2, 1, nullptr },
+        { "trophySGradeId", field_type::s16, offsetof(T, trophySGradeId), 2, 1, nullptr },
+        { "shopLv", field_type::s16, offsetof(T, shopLv), 2, 1, nullptr },
+        { "knockbackParamId", field_type::u8, offsetof(T, knockbackParamId), 1, 1, nullptr },
+        { "flickDamageCutRate", field_type::u8, offsetof(T, flickDamageCutRate), 1, 1, nullptr },
+        { "equipModelCategory", field_type::u8, offsetof(T, equipModelCategory), 1, 1, nullptr },
+        { "equipModelGender", field_type::u8, offsetof(T, equipModelGender), 1, 1, nullptr },
+        { "protectorCategory", field_type::u8, offsetof(T, protectorCategory), 1, 1, nullptr },
+        { "rarity", field_type::u8, offsetof(T, rarity), 1, 1, nullptr },
+        { "sortGroupId", field_type::u8, offsetof(T, sortGroupId), 1, 1, nullptr },
+        { "partsDmgType", field_type::u8, offsetof(T, partsDmgType), 1, 1, nullptr },
+        { "pad04", field_type::u8, offsetof(T, pad04), 1, 2, nullptr },
+        { "isDeposit", field_type::boolean, 220, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDeposit; } },
+        { "headEquip", field_type::boolean, 220, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->headEquip; } },
+        { "bodyEquip", field_type::boolean, 220, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bodyEquip; } },
+        { "armEquip", field_type::boolean, 220, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->armEquip; } },
+        { "legEquip", field_type::boolean, 220, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->legEquip; } },
+        { "useFaceScale", field_type::boolean, 220, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->useFaceScale; } },
+        { "isSkipWeakDamageAnim", field_type::boolean, 220, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSkipWeakDamageAnim; } },
+        { "pad06", field_type::u8, 220, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad06; } },
+        { "defenseMaterialVariationValue_Weak", field_type::u8, offsetof(T, defenseMaterialVariationValue_Weak), 1, 1, nullptr },
+        { "autoFootEffectDecalBaseId2", field_type::s16, offsetof(T, autoFootEffectDecalBaseId2), 2, 1, nullptr },
+        { "autoFootEffectDecalBaseId3", field_type::s16, offsetof(T, autoFootEffectDecalBaseId3), 2, 1, nullptr },
+        { "defenseMaterialVariationValue", field_type::u8, offsetof(T, defenseMaterialVariationValue), 1, 1, nullptr },
+        { "isDiscard", field_type::boolean, 227, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDiscard; } },
+        { "isDrop", field_type::boolean, 227, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDrop; } },
+        { "disableMultiDropShare", field_type::boolean, 227, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableMultiDropShare; } },
+        { "simpleModelForDlc", field_type::boolean, 227, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->simpleModelForDlc; } },
+        { "showLogCondType", field_type::boolean, 227, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->showLogCondType; } },
+        { "showDialogCondType", field_type::u8, 227, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->showDialogCondType; } },
+        { "pad", field_type::u8, 227, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad; } },
+        { "neutralDamageCutRate", field_type::f32, offsetof(T, neutralDamageCutRate), 4, 1, nullptr },
+        { "slashDamageCutRate", field_type::f32, offsetof(T, slashDamageCutRate), 4, 1, nullptr },
+        { "blowDamageCutRate", field_type::f32, offsetof(T, blowDamageCutRate), 4, 1, nullptr },
+        { "thrustDamageCutRate", field_type::f32, offsetof(T, thrustDamageCutRate), 4, 1, nullptr },
+        { "magicDamageCutRate", field_type::f32, offsetof(T, magicDamageCutRate), 4, 1, nullptr },
+        { "fireDamageCutRate", field_type::f32, offsetof(T, fireDamageCutRate), 4, 1, nullptr },
+        { "thunderDamageCutRate", field_type::f32, offsetof(T, thunderDamageCutRate), 4, 1, nullptr },
+        { "defenseMaterialSfx1", field_type::u16, offsetof(T, defenseMaterialSfx1), 2, 1, nullptr },
+        { "defenseMaterialSfx_Weak1", field_type::u16, offsetof(T, defenseMaterialSfx_Weak1), 2, 1, nullptr },
+        { "defenseMaterial1", field_type::u16, offsetof(T, defenseMaterial1), 2, 1, nullptr },
+        { "defenseMaterial_Weak1", field_type::u16, offsetof(T, defenseMaterial_Weak1), 2, 1, nullptr },
+        { "defenseMaterialSfx2", field_type::u16, offsetof(T, defenseMaterialSfx2), 2, 1, nullptr },
+        { "defenseMaterialSfx_Weak2", field_type::u16, offsetof(T, defenseMaterialSfx_Weak2), 2, 1, nullptr },
+        { "footMaterialSe", field_type::u16, offsetof(T, footMaterialSe), 2, 1, nullptr },
+        { "defenseMaterial_Weak2", field_type::u16, offsetof(T, defenseMaterial_Weak2), 2, 1, nullptr },
+        { "autoFootEffectDecalBaseId1", field_type::s32, offsetof(T, autoFootEffectDecalBaseId1), 4, 1, nullptr },
+        { "toughnessDamageCutRate", field_type::f32, offsetof(T, toughnessDamageCutRate), 4, 1, nullptr },
+        { "toughnessRecoverCorrection", field_type::f32, offsetof(T, toughnessRecoverCorrection), 4, 1, nullptr },
+        { "darkDamageCutRate", field_type::f32, offsetof(T, darkDamageCutRate), 4, 1, nullptr },
+        { "defenseDark", field_type::u16, offsetof(T, defenseDark), 2, 1, nullptr },
+        { "invisibleFlag48", field_type::u8, 290, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag48; } },
+        { "invisibleFlag49", field_type::u8, 290, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag49; } },
+        { "invisibleFlag50", field_type::u8, 290, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag50; } },
+        { "invisibleFlag51", field_type::u8, 290, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag51; } },
+        { "invisibleFlag52", field_type::u8, 290, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag52; } },
+        { "invisibleFlag53", field_type::u8, 290, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag53; } },
+        { "invisibleFlag54", field_type::u8, 290, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag54; } },
+        { "invisibleFlag55", field_type::u8, 290, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag55; } },
+        { "invisibleFlag56", field_type::u8, 291, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag56; } },
+        { "invisibleFlag57", field_type::u8, 291, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag57; } },
+        { "invisibleFlag58", field_type::u8, 291, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag58; } },
+        { "invisibleFlag59", field_type::u8, 291, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag59; } },
+        { "invisibleFlag60", field_type::u8, 291, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag60; } },
+        { "invisibleFlag61", field_type::u8, 291, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag61; } },
+        { "invisibleFlag62", field_type::u8, 291, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag62; } },
+        { "invisibleFlag63", field_type::u8, 291, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag63; } },
+        { "invisibleFlag64", field_type::u8, 292, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag64; } },
+        { "invisibleFlag65", field_type::u8, 292, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag65; } },
+        { "invisibleFlag66", field_type::u8, 292, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag66; } },
+        { "invisibleFlag67", field_type::u8, 292, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag67; } },
+        { "invisibleFlag68", field_type::u8, 292, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag68; } },
+        { "invisibleFlag69", field_type::u8, 292, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag69; } },
+        { "invisibleFlag70", field_type::u8, 292, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag70; } },
+        { "invisibleFlag71", field_type::u8, 292, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag71; } },
+        { "invisibleFlag72", field_type::u8, 293, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag72; } },
+        { "invisibleFlag73", field_type::u8, 293, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag73; } },
+        { "invisibleFlag74", field_type::u8, 293, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag74; } },
+        { "invisibleFlag75", field_type::u8, 293, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag75; } },
+        { "invisibleFlag76", field_type::u8, 293, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag76; } },
+        { "invisibleFlag77", field_type::u8, 293, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag77; } },
+        { "invisibleFlag78", field_type::u8, 293, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag78; } },
+        { "invisibleFlag79", field_type::u8, 293, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag79; } },
+        { "invisibleFlag80", field_type::u8, 294, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleFlag80; } },
+        { "padbit", field_type::u8, 294, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->padbit; } },
+        { "postureControlId", field_type::u8, offsetof(T, postureControlId), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 4, nullptr },
+        { "saleValue", field_type::s32, offsetof(T, saleValue), 4, 1, nullptr },
+        { "resistFreeze", field_type::u16, offsetof(T, resistFreeze), 2, 1, nullptr },
+        { "invisibleFlag_SexVer00", field_type::u8, offsetof(T, invisibleFlag_SexVer00), 1, 1, nullptr },
+        { "invisibleFlag_SexVer01", field_type::u8, offsetof(T, invisibleFlag_SexVer01), 1, 1, nullptr },
+        { "invisibleFlag_SexVer02", field_type::u8, offsetof(T, invisibleFlag_SexVer02), 1, 1, nullptr },
+        { "invisibleFlag_SexVer03", field_type::u8, offsetof(T, invisibleFlag_SexVer03), 1, 1, nullptr },
+        { "invisibleFlag_SexVer04", field_type::u8, offsetof(T, invisibleFlag_SexVer04), 1, 1, nullptr },
+        { "invisibleFlag_SexVer05", field_type::u8, offsetof(T, invisibleFlag_SexVer05), 1, 1, nullptr },
+        { "invisibleFlag_SexVer06", field_type::u8, offsetof(T, invisibleFlag_SexVer06), 1, 1, nullptr },
+        { "invisibleFlag_SexVer07", field_type::u8, offsetof(T, invisibleFlag_SexVer07), 1, 1, nullptr },
+        { "invisibleFlag_SexVer08", field_type::u8, offsetof(T, invisibleFlag_SexVer08), 1, 1, nullptr },
+        { "invisibleFlag_SexVer09", field_type::u8, offsetof(T, invisibleFlag_SexVer09), 1, 1, nullptr },
+        { "invisibleFlag_SexVer10", field_type::u8, offsetof(T, invisibleFlag_SexVer10), 1, 1, nullptr },
+        { "invisibleFlag_SexVer11", field_type::u8, offsetof(T, invisibleFlag_SexVer11), 1, 1, nullptr },
+        { "invisibleFlag_SexVer12", field_type::u8, offsetof(T, invisibleFlag_SexVer12), 1, 1, nullptr },
+        { "invisibleFlag_SexVer13", field_type::u8, offsetof(T, invisibleFlag_SexVer13), 1, 1, nullptr },
+        { "invisibleFlag_SexVer14", field_type::u8, offsetof(T, invisibleFlag_SexVer14), 1, 1, nullptr },
+        { "invisibleFlag_SexVer15", field_type::u8, offsetof(T, invisibleFlag_SexVer15), 1, 1, nullptr },
+        { "invisibleFlag_SexVer16", field_type::u8, offsetof(T, invisibleFlag_SexVer16), 1, 1, nullptr },
+        { "invisibleFlag_SexVer17", field_type::u8, offsetof(T, invisibleFlag_SexVer17), 1, 1, nullptr },
+        { "invisibleFlag_SexVer18", field_type::u8, offsetof(T, invisibleFlag_SexVer18), 1, 1, nullptr },
+        { "invisibleFlag_SexVer19", field_type::u8, offsetof(T, invisibleFlag_SexVer19), 1, 1, nullptr },
+        { "invisibleFlag_SexVer20", field_type::u8, offsetof(T, invisibleFlag_SexVer20), 1, 1, nullptr },
+        { "invisibleFlag_SexVer21", field_type::u8, offsetof(T, invisibleFlag_SexVer21), 1, 1, nullptr },
+        { "invisibleFlag_SexVer22", field_type::u8, offsetof(T, invisibleFlag_SexVer22), 1, 1, nullptr },
+        { "invisibleFlag_SexVer23", field_type::u8, offsetof(T, invisibleFlag_SexVer23), 1, 1, nullptr },
+        { "invisibleFlag_SexVer24", field_type::u8, offsetof(T, invisibleFlag_SexVer24), 1, 1, nullptr },
+        { "invisibleFlag_SexVer25", field_type::u8, offsetof(T, invisibleFlag_SexVer25), 1, 1, nullptr },
+        { "invisibleFlag_SexVer26", field_type::u8, offsetof(T, invisibleFlag_SexVer26), 1, 1, nullptr },
+        { "invisibleFlag_SexVer27", field_type::u8, offsetof(T, invisibleFlag_SexVer27), 1, 1, nullptr },
+        { "invisibleFlag_SexVer28", field_type::u8, offsetof(T, invisibleFlag_SexVer28), 1, 1, nullptr },
+        { "invisibleFlag_SexVer29", field_type::u8, offsetof(T, invisibleFlag_SexVer29), 1, 1, nullptr },
+        { "invisibleFlag_SexVer30", field_type::u8, offsetof(T, invisibleFlag_SexVer30), 1, 1, nullptr },
+        { "invisibleFlag_SexVer31", field_type::u8, offsetof(T, invisibleFlag_SexVer31), 1, 1, nullptr },
+        { "invisibleFlag_SexVer32", field_type::u8, offsetof(T, invisibleFlag_SexVer32), 1, 1, nullptr },
+        { "invisibleFlag_SexVer33", field_type::u8, offsetof(T, invisibleFlag_SexVer33), 1, 1, nullptr },
+        { "invisibleFlag_SexVer34", field_type::u8, offsetof(T, invisibleFlag_SexVer34), 1, 1, nullptr },
+        { "invisibleFlag_SexVer35", field_type::u8, offsetof(T, invisibleFlag_SexVer35), 1, 1, nullptr },
+        { "invisibleFlag_SexVer36", field_type::u8, offsetof(T, invisibleFlag_SexVer36), 1, 1, nullptr },
+        { "invisibleFlag_SexVer37", field_type::u8, offsetof(T, invisibleFlag_SexVer37), 1, 1, nullptr },
+        { "invisibleFlag_SexVer38", field_type::u8, offsetof(T, invisibleFlag_SexVer38), 1, 1, nullptr },
+        { "invisibleFlag_SexVer39", field_type::u8, offsetof(T, invisibleFlag_SexVer39), 1, 1, nullptr },
+        { "invisibleFlag_SexVer40", field_type::u8, offsetof(T, invisibleFlag_SexVer40), 1, 1, nullptr },
+        { "invisibleFlag_SexVer41", field_type::u8, offsetof(T, invisibleFlag_SexVer41), 1, 1, nullptr },
+        { "invisibleFlag_SexVer42", field_type::u8, offsetof(T, invisibleFlag_SexVer42), 1, 1, nullptr },
+        { "invisibleFlag_SexVer43", field_type::u8, offsetof(T, invisibleFlag_SexVer43), 1, 1, nullptr },
+        { "invisibleFlag_SexVer44", field_type::u8, offsetof(T, invisibleFlag_SexVer44), 1, 1, nullptr },
+        { "invisibleFlag_SexVer45", field_type::u8, offsetof(T, invisibleFlag_SexVer45), 1, 1, nullptr },
+        { "invisibleFlag_SexVer46", field_type::u8, offsetof(T, invisibleFlag_SexVer46), 1, 1, nullptr },
+        { "invisibleFlag_SexVer47", field_type::u8, offsetof(T, invisibleFlag_SexVer47), 1, 1, nullptr },
+        { "invisibleFlag_SexVer48", field_type::u8, offsetof(T, invisibleFlag_SexVer48), 1, 1, nullptr },
+        { "invisibleFlag_SexVer49", field_type::u8, offsetof(T, invisibleFlag_SexVer49), 1, 1, nullptr },
+        { "invisibleFlag_SexVer50", field_type::u8, offsetof(T, invisibleFlag_SexVer50), 1, 1, nullptr },
+        { "invisibleFlag_SexVer51", field_type::u8, offsetof(T, invisibleFlag_SexVer51), 1, 1, nullptr },
+        { "invisibleFlag_SexVer52", field_type::u8, offsetof(T, invisibleFlag_SexVer52), 1, 1, nullptr },
+        { "invisibleFlag_SexVer53", field_type::u8, offsetof(T, invisibleFlag_SexVer53), 1, 1, nullptr },
+        { "invisibleFlag_SexVer54", field_type::u8, offsetof(T, invisibleFlag_SexVer54), 1, 1, nullptr },
+        { "invisibleFlag_SexVer55", field_type::u8, offsetof(T, invisibleFlag_SexVer55), 1, 1, nullptr },
+        { "invisibleFlag_SexVer56", field_type::u8, offsetof(T, invisibleFlag_SexVer56), 1, 1, nullptr },
+        { "invisibleFlag_SexVer57", field_type::u8, offsetof(T, invisibleFlag_SexVer57), 1, 1, nullptr },
+        { "invisibleFlag_SexVer58", field_type::u8, offsetof(T, invisibleFlag_SexVer58), 1, 1, nullptr },
+        { "invisibleFlag_SexVer59", field_type::u8, offsetof(T, invisibleFlag_SexVer59), 1, 1, nullptr },
+        { "invisibleFlag_SexVer60", field_type::u8, offsetof(T, invisibleFlag_SexVer60), 1, 1, nullptr },
+        { "invisibleFlag_SexVer61", field_type::u8, offsetof(T, invisibleFlag_SexVer61), 1, 1, nullptr },
+        { "invisibleFlag_SexVer62", field_type::u8, offsetof(T, invisibleFlag_SexVer62), 1, 1, nullptr },
+        { "invisibleFlag_SexVer63", field_type::u8, offsetof(T, invisibleFlag_SexVer63), 1, 1, nullptr },
+        { "invisibleFlag_SexVer64", field_type::u8, offsetof(T, invisibleFlag_SexVer64), 1, 1, nullptr },
+        { "invisibleFlag_SexVer65", field_type::u8, offsetof(T, invisibleFlag_SexVer65), 1, 1, nullptr },
+        { "invisibleFlag_SexVer66", field_type::u8, offsetof(T, invisibleFlag_SexVer66), 1, 1, nullptr },
+        { "invisibleFlag_SexVer67", field_type::u8, offsetof(T, invisibleFlag_SexVer67), 1, 1, nullptr },
+        { "invisibleFlag_SexVer68", field_type::u8, offsetof(T, invisibleFlag_SexVer68), 1, 1, nullptr },
+        { "invisibleFlag_SexVer69", field_type::u8, offsetof(T, invisibleFlag_SexVer69), 1, 1, nullptr },
+        { "invisibleFlag_SexVer70", field_type::u8, offsetof(T, invisibleFlag_SexVer70), 1, 1, nullptr },
+        { "invisibleFlag_SexVer71", field_type::u8, offsetof(T, invisibleFlag_SexVer71), 1, 1, nullptr },
+        { "invisibleFlag_SexVer72", field_type::u8, offsetof(T, invisibleFlag_SexVer72), 1, 1, nullptr },
+        { "invisibleFlag_SexVer73", field_type::u8, offsetof(T, invisibleFlag_SexVer73), 1, 1, nullptr },
+        { "invisibleFlag_SexVer74", field_type::u8, offsetof(T, invisibleFlag_SexVer74), 1, 1, nullptr },
+        { "invisibleFlag_SexVer75", field_type::u8, offsetof(T, invisibleFlag_SexVer75), 1, 1, nullptr },
+        { "invisibleFlag_SexVer76", field_type::u8, offsetof(T, invisibleFlag_SexVer76), 1, 1, nullptr },
+        { "invisibleFlag_SexVer77", field_type::u8, offsetof(T, invisibleFlag_SexVer77), 1, 1, nullptr },
+        { "invisibleFlag_SexVer78", field_type::u8, offsetof(T, invisibleFlag_SexVer78), 1, 1, nullptr },
+        { "invisibleFlag_SexVer79", field_type::u8, offsetof(T, invisibleFlag_SexVer79), 1, 1, nullptr },
+        { "invisibleFlag_SexVer80", field_type::u8, offsetof(T, invisibleFlag_SexVer80), 1, 1, nullptr },
+        { "invisibleFlag_SexVer81", field_type::u8, offsetof(T, invisibleFlag_SexVer81), 1, 1, nullptr },
+        { "invisibleFlag_SexVer82", field_type::u8, offsetof(T, invisibleFlag_SexVer82), 1, 1, nullptr },
+        { "invisibleFlag_SexVer83", field_type::u8, offsetof(T, invisibleFlag_SexVer83), 1, 1, nullptr },
+        { "invisibleFlag_SexVer84", field_type::u8, offsetof(T, invisibleFlag_SexVer84), 1, 1, nullptr },
+        { "invisibleFlag_SexVer85", field_type::u8, offsetof(T, invisibleFlag_SexVer85), 1, 1, nullptr },
+        { "invisibleFlag_SexVer86", field_type::u8, offsetof(T, invisibleFlag_SexVer86), 1, 1, nullptr },
+        { "invisibleFlag_SexVer87", field_type::u8, offsetof(T, invisibleFlag_SexVer87), 1, 1, nullptr },
+        { "invisibleFlag_SexVer88", field_type::u8, offsetof(T, invisibleFlag_SexVer88), 1, 1, nullptr },
+        { "invisibleFlag_SexVer89", field_type::u8, offsetof(T, invisibleFlag_SexVer89), 1, 1, nullptr },
+        { "invisibleFlag_SexVer90", field_type::u8, offsetof(T, invisibleFlag_SexVer90), 1, 1, nullptr },
+        { "invisibleFlag_SexVer91", field_type::u8, offsetof(T, invisibleFlag_SexVer91), 1, 1, nullptr },
+        { "invisibleFlag_SexVer92", field_type::u8, offsetof(T, invisibleFlag_SexVer92), 1, 1, nullptr },
+        { "invisibleFlag_SexVer93", field_type::u8, offsetof(T, invisibleFlag_SexVer93), 1, 1, nullptr },
+        { "invisibleFlag_SexVer94", field_type::u8, offsetof(T, invisibleFlag_SexVer94), 1, 1, nullptr },
+        { "invisibleFlag_SexVer95", field_type::u8, offsetof(T, invisibleFlag_SexVer95), 1, 1, nullptr },
+        { "pad404", field_type::u8, offsetof(T, pad404), 1, 14, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, sortId) == 4);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, wanderingEquipId) == 8);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, resistSleep) == 12);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, resistMadness) == 14);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, saDurability) == 16);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, toughnessCorrectRate) == 20);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, fixPrice) == 24);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, basicPrice) == 28);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, sellValue) == 32);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, weight) == 36);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, residentSpEffectId) == 40);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, residentSpEffectId2) == 44);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, residentSpEffectId3) == 48);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, materialSetId) == 52);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, partsDamageRate) == 56);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, corectSARecover) == 60);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro) == 64);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro1) == 68);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro2) == 72);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro3) == 76);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro4) == 80);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro5) == 84);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro6) == 88);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro7) == 92);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro8) == 96);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro9) == 100);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro10) == 104);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro11) == 108);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro12) == 112);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro13) == 116);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro14) == 120);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, originEquipPro15) == 124);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, faceScaleM_ScaleX) == 128);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, faceScaleM_ScaleZ) == 132);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, faceScaleM_MaxX) == 136);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, faceScaleM_MaxZ) == 140);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, faceScaleF_ScaleX) == 144);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, faceScaleF_ScaleZ) == 148);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, faceScaleF_MaxX) == 152);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, faceScaleF_MaxZ) == 156);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, qwcId) == 160);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, equipModelId) == 164);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, iconIdM) == 166);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, iconIdF) == 168);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, knockBack) == 170);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, knockbackBounceRate) == 172);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, durability) == 174);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, durabilityMax) == 176);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, pad03) == 178);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defFlickPower) == 180);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defensePhysics) == 182);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseMagic) == 184);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseFire) == 186);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseThunder) == 188);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseSlash) == 190);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseBlow) == 192);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseThrust) == 194);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, resistPoison) == 196);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, resistDisease) == 198);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, resistBlood) == 200);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, resistCurse) == 202);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, reinforceTypeId) == 204);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, trophySGradeId) == 206);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, shopLv) == 208);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, knockbackParamId) == 210);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, flickDamageCutRate) == 211);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, equipModelCategory) == 212);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, equipModelGender) == 213);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, protectorCategory) == 214);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, rarity) == 215);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, sortGroupId) == 216);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, partsDmgType) == 217);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, pad04) == 218);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseMaterialVariationValue_Weak) == 221);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, autoFootEffectDecalBaseId2) == 222);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, autoFootEffectDecalBaseId3) == 224);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseMaterialVariationValue) == 226);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, neutralDamageCutRate) == 228);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, slashDamageCutRate) == 232);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, blowDamageCutRate) == 236);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, thrustDamageCutRate) == 240);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, magicDamageCutRate) == 244);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, fireDamageCutRate) == 248);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, thunderDamageCutRate) == 252);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseMaterialSfx1) == 256);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseMaterialSfx_Weak1) == 258);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseMaterial1) == 260);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseMaterial_Weak1) == 262);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseMaterialSfx2) == 264);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseMaterialSfx_Weak2) == 266);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, footMaterialSe) == 268);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseMaterial_Weak2) == 270);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, autoFootEffectDecalBaseId1) == 272);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, toughnessDamageCutRate) == 276);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, toughnessRecoverCorrection) == 280);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, darkDamageCutRate) == 284);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, defenseDark) == 288);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, postureControlId) == 295);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, pad2) == 296);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, saleValue) == 300);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, resistFreeze) == 304);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer00) == 306);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer01) == 307);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer02) == 308);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer03) == 309);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer04) == 310);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer05) == 311);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer06) == 312);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer07) == 313);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer08) == 314);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer09) == 315);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer10) == 316);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer11) == 317);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer12) == 318);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer13) == 319);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer14) == 320);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer15) == 321);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer16) == 322);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer17) == 323);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer18) == 324);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer19) == 325);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer20) == 326);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer21) == 327);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer22) == 328);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer23) == 329);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer24) == 330);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer25) == 331);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer26) == 332);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer27) == 333);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer28) == 334);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer29) == 335);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer30) == 336);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer31) == 337);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer32) == 338);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer33) == 339);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer34) == 340);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer35) == 341);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer36) == 342);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer37) == 343);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer38) == 344);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer39) == 345);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer40) == 346);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer41) == 347);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer42) == 348);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer43) == 349);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer44) == 350);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer45) == 351);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer46) == 352);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer47) == 353);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer48) == 354);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer49) == 355);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer50) == 356);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer51) == 357);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer52) == 358);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer53) == 359);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer54) == 360);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer55) == 361);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer56) == 362);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer57) == 363);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer58) == 364);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer59) == 365);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer60) == 366);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer61) == 367);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer62) == 368);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer63) == 369);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer64) == 370);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer65) == 371);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer66) == 372);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer67) == 373);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer68) == 374);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer69) == 375);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer70) == 376);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer71) == 377);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer72) == 378);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer73) == 379);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer74) == 380);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer75) == 381);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer76) == 382);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer77) == 383);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer78) == 384);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer79) == 385);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer80) == 386);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer81) == 387);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer82) == 388);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer83) == 389);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer84) == 390);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer85) == 391);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer86) == 392);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer87) == 393);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer88) == 394);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer89) == 395);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer90) == 396);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer91) == 397);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer92) == 398);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer93) == 399);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer94) == 400);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, invisibleFlag_SexVer95) == 401);
+static_assert(offsetof(paramdef::EQUIP_PARAM_PROTECTOR_ST, pad404) == 402);
+
+}; // namespace params
+}; // namespace from
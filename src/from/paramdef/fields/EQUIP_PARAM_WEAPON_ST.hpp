@@ -0,0 +1,512 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../EQUIP_PARAM_WEAPON_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::EQUIP_PARAM_WEAPON_ST> {
+    using T = paramdef::EQUIP_PARAM_WEAPON_ST;
+
+    static constexpr std::array<field_descriptor, 270> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "behaviorVariationId", field_type::s32, offsetof(T, behaviorVariationId), 4, 1, nullptr },
+        { "sortId", field_type::s32, offsetof(T, sortId), 4, 1, nullptr },
+        { "wanderingEquipId", field_type::u32, offsetof(T, wanderingEquipId), 4, 1, nullptr },
+        { "weight", field_type::f32, offsetof(T, weight), 4, 1, nullptr },
+        { "weaponWeightRate", field_type::f32, offsetof(T, weaponWeightRate), 4, 1, nullptr },
+        { "fixPrice", field_type::s32, offsetof(T, fixPrice), 4, 1, nullptr },
+        { "reinforcePrice", field_type::s32, offsetof(T, reinforcePrice), 4, 1, nullptr },
+        { "sellValue", field_type::s32, offsetof(T, sellValue), 4, 1, nullptr },
+        { "correctStrength", field_type::f32, offsetof(T, correctStrength), 4, 1, nullptr },
+        { "correctAgility", field_type::f32, offsetof(T, correctAgility), 4, 1, nullptr },
+        { "correctMagic", field_type::f32, offsetof(T, correctMagic), 4, 1, nullptr },
+        { "correctFaith", field_type::f32, offsetof(T, correctFaith), 4, 1, nullptr },
+        { "physGuardCutRate", field_type::f32, offsetof(T, physGuardCutRate), 4, 1, nullptr },
+        { "magGuardCutRate", field_type::f32, offsetof(T, magGuardCutRate), 4, 1, nullptr },
+        { "fireGuardCutRate", field_type::f32, offsetof(T, fireGuardCutRate), 4, 1, nullptr },
+        { "thunGuardCutRate", field_type::f32, offsetof(T, thunGuardCutRate), 4, 1, nullptr },
+        { "spEffectBehaviorId0", field_type::s32, offsetof(T, spEffectBehaviorId0), 4, 1, nullptr },
+        { "spEffectBehaviorId1", field_type::s32, offsetof(T, spEffectBehaviorId1), 4, 1, nullptr },
+        { "spEffectBehaviorId2", field_type::s32, offsetof(T, spEffectBehaviorId2), 4, 1, nullptr },
+        { "residentSpEffectId", field_type::s32, offsetof(T, residentSpEffectId), 4, 1, nullptr },
+        { "residentSpEffectId1", field_type::s32, offsetof(T, residentSpEffectId1), 4, 1, nullptr },
+        { "residentSpEffectId2", field_type::s32, offsetof(T, residentSpEffectId2), 4, 1, nullptr },
+        { "materialSetId", field_type::s32, offsetof(T, materialSetId), 4, 1, nullptr },
+        { "originEquipWep", field_type::s32, offsetof(T, originEquipWep), 4, 1, nullptr },
+        { "originEquipWep1", field_type::s32, offsetof(T, originEquipWep1), 4, 1, nullptr },
+        { "originEquipWep2", field_type::s32, offsetof(T, originEquipWep2), 4, 1, nullptr },
+        { "originEquipWep3", field_type::s32, offsetof(T, originEquipWep3), 4, 1, nullptr },
+        { "originEquipWep4", field_type::s32, offsetof(T, originEquipWep4), 4, 1, nullptr },
+        { "originEquipWep5", field_type::s32, offsetof(T, originEquipWep5), 4, 1, nullptr },
+        { "originEquipWep6", field_type::s32, offsetof(T, originEquipWep6), 4, 1, nullptr },
+        { "originEquipWep7", field_type::s32, offsetof(T, originEquipWep7), 4, 1, nullptr },
+        { "originEquipWep8", field_type::s32, offsetof(T, originEquipWep8), 4, 1, nullptr },
+        { "originEquipWep9", field_type::s32, offsetof(T, originEquipWep9), 4, 1, nullptr },
+        { "originEquipWep10", field_type::s32, offsetof(T, originEquipWep10), 4, 1, nullptr },
+        { "originEquipWep11", field_type::s32, offsetof(T, originEquipWep11), 4, 1, nullptr },
+        { "originEquipWep12", field_type::s32, offsetof(T, originEquipWep12), 4, 1, nullptr },
+        { "originEquipWep13", field_type::s32, offsetof(T, originEquipWep13), 4, 1, nullptr },
+        { "originEquipWep14", field_type::s32, offsetof(T, originEquipWep14), 4, 1, nullptr },
+        { "originEquipWep15", field_type::s32, offsetof(T, originEquipWep15), 4, 1, nullptr },
+        { "weakA_DamageRate", field_type::f32, offsetof(T, weakA_DamageRate), 4, 1, nullptr },
+        { "weakB_DamageRate", field_type::f32, offsetof(T, weakB_DamageRate), 4, 1, nullptr },
+        { "weakC_DamageRate", field_type::f32, offsetof(T, weakC_DamageRate), 4, 1, nullptr },
+        { "weakD_DamageRate", field_type::f32, offsetof(T, weakD_DamageRate), 4, 1, nullptr },
+        { "sleepGuardResist_MaxCorrect", field_type::f32, offsetof(T, sleepGuardResist_MaxCorrect), 4, 1, nullptr },
+        { "madnessGuardResist_MaxCorrect", field_type::f32, offsetof(T, madnessGuardResist_MaxCorrect), 4, 1, nullptr },
+        { "saWeaponDamage", field_type::f32, offsetof(T, saWeaponDamage), 4, 1, nullptr },
+        { "equipModelId", field_type::u16, offsetof(T, equipModelId), 2, 1, nullptr },
+        { "iconId", field_type::u16, offsetof(T, iconId), 2, 1, nullptr },
+        { "durability", field_type::u16, offsetof(T, durability), 2, 1, nullptr },
+        { "durabilityMax", field_type::u16, offsetof(T, durabilityMax), 2, 1, nullptr },
+        { "attackThrowEscape", field_type::u16, offsetof(T, attackThrowEscape), 2, 1, nullptr },
+        { "parryDamageLife", field_type::s16, offsetof(T, parryDamageLife), 2, 1, nullptr },
+        { "attackBasePhysics", field_type::u16, offsetof(T, attackBasePhysics), 2, 1, nullptr },
+        { "attackBaseMagic", field_type::u16, offsetof(T, attackBaseMagic), 2, 1, nullptr },
+        { "attackBaseFire", field_type::u16, offsetof(T, attackBaseFire), 2, 1, nullptr },
+        { "attackBaseThunder", field_type::u16, offsetof(T, attackBaseThunder), 2, 1, nullptr },
+        { "attackBaseStamina", field_type::u16, offsetof(T, attackBaseStamina), 2, 1, nullptr },
+        { "guardAngle", field_type::s16, offsetof(T, guardAngle), 2, 1, nullptr },
+        { "saDurability", field_type::f32, offsetof(T, saDurability), 4, 1, nullptr },
+        { "staminaGuardDef", field_type::s16, offsetof(T, staminaGuardDef), 2, 1, nullptr },
+        { "reinforceTypeId", field_type::s16, offsetof(T, reinforceTypeId), 2, 1, nullptr },
+        { "trophySGradeId", field_type::s16, offsetof(T, trophySGradeId), 2, 1, nullptr },
+        { "trophySeqId", field_type::s16, offsetof(T, trophySeqId), 2, 1, nullptr },
+        { "throwAtkRate", field_type::s16, offsetof(T, throwAtkRate), 2, 1, nullptr },
+        { "bowDistRate", field_type::s16, offsetof(T, bowDistRate), 2, 1, nullptr },
+        { "equipModelCategory", field_type::u8, offsetof(T, equipModelCategory), 1, 1, nullptr },
+        { "equipModelGender", field_type::u8, offsetof(T, equipModelGender), 1, 1, nullptr },
+        { "weaponCategory", field_type::u8, offsetof(T, weaponCategory), 1, 1, nullptr },
+        { "wepmotionCategory", field_type::u8, offsetof(T, wepmotionCategory), 1, 1, nullptr },
+        { "guardmotionCategory", field_type::u8, offsetof(T, guardmotionCategory), 1, 1, nullptr },
+        { "atkMaterial", field_type::u8, offsetof(T, atkMaterial), 1, 1, nullptr },
+        { "defSeMaterial1", field_type::u16, offsetof(T, defSeMaterial1), 2, 1, nullptr },
+        { "correctType_Physics", field_type::u8, offsetof(T, correctType_Physics), 1, 1, nullptr },
+        { "spAttribute", field_type::u8, offsetof(T, spAttribute), 1, 1, nullptr },
+        { "spAtkcategory", field_type::u16, offsetof(T, spAtkcategory), 2, 1, nullptr },
+        { "wepmotionOneHandId", field_type::u8, offsetof(T, wepmotionOneHandId), 1, 1, nullptr },
+        { "wepmotionBothHandId", field_type::u8, offsetof(T, wepmotionBothHandId), 1, 1, nullptr },
+        { "properStrength", field_type::u8, offsetof(T, properStrength), 1, 1, nullptr },
+        { "properAgility", field_type::u8, offsetof(T, properAgility), 1, 1, nullptr },
+        { "properMagic", field_type::u8, offsetof(T, properMagic), 1, 1, nullptr },
+        { "properFaith", field_type::u8, offsetof(T, properFaith), 1, 1, nullptr },
+        { "overStrength", field_type::u8, offsetof(T, overStrength), 1, 1, nullptr },
+        { "attackBaseParry", field_type::u8, offsetof(T, attackBaseParry), 1, 1, nullptr },
+        { "defenseBaseParry", field_type::u8, offsetof(T, defenseBaseParry), 1, 1, nullptr },
+        { "guardBaseRepel", field_type::u8, offsetof(T, guardBaseRepel), 1, 1, nullptr },
+        { "attackBaseRepel", field_type::u8, offsetof(T, attackBaseRepel), 1, 1, nullptr },
+        { "guardCutCancelRate", field_type::s8, offsetof(T, guardCutCancelRate), 1, 1, nullptr },
+        { "guardLevel", field_type::s8, offsetof(T, guardLevel), 1, 1, nullptr },
+        { "slashGuardCutRate", field_type::s8, offsetof(T, slashGuardCutRate), 1, 1, nullptr },
+        { "blowGuardCutRate", field_type::s8, offsetof(T, blowGuardCutRate), 1, 1, nullptr },
+        { "thrustGuardCutRate", field_type::s8, offsetof(T, thrustGuardCutRate), 1, 1, nullptr },
+        { "poisonGuardResist", field_type::s8, offsetof(T, poisonGuardResist), 1, 1, nullptr },
+        { "diseaseGuardResist", field_type::s8, offsetof(T, diseaseGuardResist), 1, 1, nullptr },
+        { "bloodGuardResist", field_type::s8, offsetof(T, bloodGuardResist), 1, 1, nullptr },
+        { "curseGuardResist", field_type::s8, offsetof(T, curseGuardResist), 1, 1, nullptr },
+        { "atkAttribute", field_type::u8, offsetof(T, atkAttribute), 1, 1, nullptr },
+        { "rightHandEquipable", field_type::boolean, 261, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->rightHandEquipable; } },
+        { "leftHandEquipable", field_type::boolean, 261, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->leftHandEquipable; } },
+        { "bothHandEquipable", field_type::boolean, 261, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bothHandEquipable; } },
+        { "arrowSlotEquipable", field_type::boolean, 261, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->arrowSlotEquipable; } },
+        { "boltSlotEquipable", field_type::boolean, 261, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->boltSlotEquipable; } },
+        { "enableGuard", field_type::boolean, 261, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableGuard; } },
+        { "enableParry", field_type::boolean, 261, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableParry; } },
+        { "enableMagic", field_type::boolean, 261, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableMagic; } },
+        { "enableSorcery", field_type::boolean, 262, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableSorcery; } },
+        { "enableMiracle", field_type::boolean, 262, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableMiracle; } },
+        { "enableVowMagic", field_type::boolean, 262, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableVowMagic; } },
+        { "isNormalAttackType", field_type::boolean, 262, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isNormalAttackType; } },
+        { "isBlowAttackType", field_type::boolean, 262, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBlowAttackType; } },
+        { "isSlashAttackType", field_type::boolean, 262, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSlashAttackType; } },
+        { "isThrustAttackType", field_type::boolean, 262, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isThrustAttackType; } },
+        { "isEnhance", field_type::boolean, 262, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnhance; } },
+        { "isHeroPointCorrect", field_type::boolean, 263, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHeroPointCorrect; } },
+        { "isCustom", field_type::boolean, 263, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isCustom; } },
+        { "disableBaseChangeReset", field_type::boolean, 263, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableBaseChangeReset; } },
+        { "disableRepair", field_type::boolean, 263, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableRepair; } },
+        { "isDarkHand", field_type::boolean, 263, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDarkHand; } },
+        { "simpleModelForDlc", field_type::boolean, 263, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->simpleModelForDlc; } },
+        { "lanternWep", field_type::boolean, 263, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->lanternWep; } },
+        { "isVersusGhostWep", field_type::boolean, 263, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isVersusGhostWep; } },
+        { "baseChangeCategory", field_type::u8, 264, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->baseChangeCategory; } },
+        { "isDragonSlayer", field_type::boolean, 264, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDragonSlayer; } },
+        { "isDeposit", field_type::boolean, 264, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDeposit; } },
+        { "disableMultiDropShare", field_type::boolean, 265, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableMultiDropShare; } },
+        { "isDiscard", field_type::boolean, 265, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDiscard; } },
+        { "isDrop", field_type::boolean, 265, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDrop; } },
+        { "showLogCondType", field_type::boolean, 265, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->showLogCondType; } },
+        { "enableThrow", field_type::boolean, 265, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableThrow; } },
+        { "showDialogCondType", field_type::u8, 265, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->showDialogCondType; } },
+        { "disableGemAttr", field_type::boolean, 265, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableGemAttr; } },
+        { "defSfxMaterial1", field_type::u16, offsetof(T, defSfxMaterial1), 2, 1, nullptr },
+        { "wepCollidableType0", field_type::u8, offsetof(T, wepCollidableType0), 1, 1, nullptr },
+        { "wepCollidableType1", field_type::u8, offsetof(T, wepCollidableType1), 1, 1, nullptr },
+        { "postureControlId_Right", field_type::u8, offsetof(T, postureControlId_Right), 1, 1, nullptr },
+        { "postureControlId_Left", field_type::u8, offsetof(T, postureControlId_Left), 1, 1, nullptr },
+        { "traceSfxId0", field_type::s32, offsetof(T, traceSfxId0), 4, 1, nullptr },
+        { "traceDmyIdHead0", field_type::s32, offsetof(T, traceDmyIdHead0), 4, 1, nullptr },
+        { "traceDmyIdTail0", field_type::s32, offsetof(T, traceDmyIdTail0), 4, 1, nullptr },
+        { "traceSfxId1", field_type::s32, offsetof(T, traceSfxId1), 4, 1, nullptr },
+        { "traceDmyIdHead1", field_type::s32, offsetof(T, traceDmyIdHead1), 4, 1, nullptr },
+        { "traceDmyIdTail1", field_type::s32, offsetof(T, traceDmyIdTail1), 4, 1, nullptr },
+        { "traceSfxId2", field_type::s32, offsetof(T, traceSfxId2), 4, 1, nullptr },
+        { "traceDmyIdHead2", field_type::s32, offsetof(T, traceDmyIdHead2), 4, 1, nullptr },
+        { "traceDmyIdTail2", field_type::s32, offsetof(T, traceDmyIdTail2), 4, 1, nullptr },
+        { "traceSfxId3", field_type::s32, offsetof(T, traceSfxId3), 4, 1, nullptr },
+        { "traceDmyIdHead3", field_type::s32, offsetof(T, traceDmyIdHead3), 4, 1, nullptr },
+        { "traceDmyIdTail3", field_type::s32, offsetof(T, traceDmyIdTail3), 4, 1, nullptr },
+        { "traceSfxId4", field_type::s32, offsetof(T, traceSfxId4), 4, 1, nullptr },
+        { "traceDmyIdHead4", field_type::s32, offsetof(T, traceDmyIdHead4), 4, 1, nullptr },
+        { "traceDmyIdTail4", field_type::s32, offsetof(T, traceDmyIdTail4), 4, 1, nullptr },
+        { "traceSfxId5", field_type::s32, offsetof(T, traceSfxId5), 4, 1, nullptr },
+        { "traceDmyIdHead5", field_type::s32, offsetof(T, traceDmyIdHead5), 4, 1, nullptr },
+        { "traceDmyIdTail5", field_type::s32, offsetof(T, traceDmyIdTail5), 4, 1, nullptr },
+        { "traceSfxId6", field_type::s32, offsetof(T, traceSfxId6), 4, 1, nullptr },
+        { "traceDmyIdHead6", field_type::s32, offsetof(T, traceDmyIdHead6), 4, 1, nullptr },
+        { "traceDmyIdTail6", field_type::s32, offsetof(T, traceDmyIdTail6), 4, 1, nullptr },
+        { "traceSfxId7", field_type::s32, offsetof(T, traceSfxId7), 4, 1, nullptr },
+        { "traceDmyIdHead7", field_type::s32, offsetof(T, traceDmyIdHead7), 4, 1, nullptr },
+        { "traceDmyIdTail7", field_type::s32, offsetof(T, traceDmyIdTail7), 4, 1, nullptr },
+        { "defSfxMaterial2", field_type::u16, offsetof(T, defSfxMaterial2), 2, 1, nullptr },
+        { "defSeMaterial2", field_type::u16, offsetof(T, defSeMaterial2), 2, 1, nullptr },
+        { "absorpParamId", field_type::s32, offsetof(T, absorpParamId), 4, 1, nullptr },
+        { "toughnessCorrectRate", field_type::f32, offsetof(T, toughnessCorrectRate), 4, 1, nullptr },
+        { "isValidTough_ProtSADmg", field_type::boolean, 380, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isValidTough_ProtSADmg; } },
+        { "isDualBlade", field_type::boolean, 380, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDualBlade; } },
+        { "isAutoEquip", field_type::boolean, 380, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAutoEquip; } },
+        { "isEnableEmergencyStep", field_type::boolean, 380, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableEmergencyStep; } },
+        { "invisibleOnRemo", field_type::boolean, 380, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleOnRemo; } },
+        { "pad2", field_type::u8, 380, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad2; } },
+        { "correctType_Magic", field_type::u8, offsetof(T, correctType_Magic), 1, 1, nullptr },
+        { "correctType_Fire", field_type::u8, offsetof(T, correctType_Fire), 1, 1, nullptr },
+        { "correctType_Thunder", field_type::u8, offsetof(T, correctType_Thunder), 1, 1, nullptr },
+        { "weakE_DamageRate", field_type::f32, offsetof(T, weakE_DamageRate), 4, 1, nullptr },
+        { "weakF_DamageRate", field_type::f32, offsetof(T, weakF_DamageRate), 4, 1, nullptr },
+        { "darkGuardCutRate", field_type::f32, offsetof(T, darkGuardCutRate), 4, 1, nullptr },
+        { "attackBaseDark", field_type::u16, offsetof(T, attackBaseDark), 2, 1, nullptr },
+        { "correctType_Dark", field_type::u8, offsetof(T, correctType_Dark), 1, 1, nullptr },
+        { "correctType_Poison", field_type::u8, offsetof(T, correctType_Poison), 1, 1, nullptr },
+        { "sortGroupId", field_type::u8, offsetof(T, sortGroupId), 1, 1, nullptr },
+        { "atkAttribute2", field_type::u8, offsetof(T, atkAttribute2), 1, 1, nullptr },
+        { "sleepGuardResist", field_type::s8, offsetof(T, sleepGuardResist), 1, 1, nullptr },
+        { "madnessGuardResist", field_type::s8, offsetof(T, madnessGuardResist), 1, 1, nullptr },
+        { "correctType_Blood", field_type::u8, offsetof(T, correctType_Blood), 1, 1, nullptr },
+        { "properLuck", field_type::u8, offsetof(T, properLuck), 1, 1, nullptr },
+        { "freezeGuardResist", field_type::s8, offsetof(T, freezeGuardResist), 1, 1, nullptr },
+        { "autoReplenishType", field_type::u8, offsetof(T, autoReplenishType), 1, 1, nullptr },
+        { "swordArtsParamId", field_type::s32, offsetof(T, swordArtsParamId), 4, 1, nullptr },
+        { "correctLuck", field_type::f32, offsetof(T, correctLuck), 4, 1, nullptr },
+        { "arrowBoltEquipId", field_type::u32, offsetof(T, arrowBoltEquipId), 4, 1, nullptr },
+        { "DerivationLevelType", field_type::u8, offsetof(T, DerivationLevelType), 1, 1, nullptr },
+        { "enchantSfxSize", field_type::u8, offsetof(T, enchantSfxSize), 1, 1, nullptr },
+        { "wepType", field_type::u16, offsetof(T, wepType), 2, 1, nullptr },
+        { "physGuardCutRate_MaxCorrect", field_type::f32, offsetof(T, physGuardCutRate_MaxCorrect), 4, 1, nullptr },
+        { "magGuardCutRate_MaxCorrect", field_type::f32, offsetof(T, magGuardCutRate_MaxCorrect), 4, 1, nullptr },
+        { "fireGuardCutRate_MaxCorrect", field_type::f32, offsetof(T, fireGuardCutRate_MaxCorrect), 4, 1, nullptr },
+        { "thunGuardCutRate_MaxCorrect", field_type::f32, offsetof(T, thunGuardCutRate_MaxCorrect), 4, 1, nullptr },
+        { "darkGuardCutRate_MaxCorrect", field_type::f32, offsetof(T, darkGuardCutRate_MaxCorrect), 4, 1, nullptr },
+        { "poisonGuardResist_MaxCorrect", field_type::f32, offsetof(T, poisonGuardResist_MaxCorrect), 4, 1, nullptr },
+        { "diseaseGuardResist_MaxCorrect", field_type::f32, offsetof(T, diseaseGuardResist_MaxCorrect), 4, 1, nullptr },
+        { "bloodGuardResist_MaxCorrect", field_type::f32, offsetof(T, bloodGuardResist_MaxCorrect), 4, 1, nullptr },
+        { "curseGuardResist_MaxCorrect", field_type::f32, offsetof(T, curseGuardResist_MaxCorrect), 4, 1, nullptr },
+        { "freezeGuardResist_MaxCorrect", field_type::f32, offsetof(T, freezeGuardResist_MaxCorrect), 4, 1, nullptr },
+        { "staminaGuardDef_MaxCorrect", field_type::f32, offsetof(T, staminaGuardDef_MaxCorrect), 4, 1, nullptr },
+        { "residentSfxId_1", field_type::s32, offsetof(T, residentSfxId_1), 4, 1, nullptr },
+        { "residentSfxId_2", field_type::s32, offsetof(T, residentSfxId_2), 4, 1, nullptr },
+        { "residentSfxId_3", field_type::s32, offsetof(T, residentSfxId_3), 4, 1, nullptr },
+        { "residentSfxId_4", field_type::s32, offsetof(T, residentSfxId_4), 4, 1, nullptr },
+        { "residentSfx_DmyId_1", field_type::s32, offsetof(T, residentSfx_DmyId_1), 4, 1, nullptr },
+        { "residentSfx_DmyId_2", field_type::s32, offsetof(T, residentSfx_DmyId_2), 4, 1, nullptr },
+        { "residentSfx_DmyId_3", field_type::s32, offsetof(T, residentSfx_DmyId_3), 4, 1, nullptr },
+        { "residentSfx_DmyId_4", field_type::s32, offsetof(T, residentSfx_DmyId_4), 4, 1, nullptr },
+        { "staminaConsumptionRate", field_type::f32, offsetof(T, staminaConsumptionRate), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Physics", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Physics), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Magic", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Magic), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Fire", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Fire), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Thunder", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Thunder), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Dark", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Dark), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Poison", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Poison), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Blood", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Blood), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Freeze", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Freeze), 4, 1, nullptr },
+        { "attainmentWepStatusStr", field_type::s32, offsetof(T, attainmentWepStatusStr), 4, 1, nullptr },
+        { "attainmentWepStatusDex", field_type::s32, offsetof(T, attainmentWepStatusDex), 4, 1, nullptr },
+        { "attainmentWepStatusMag", field_type::s32, offsetof(T, attainmentWepStatusMag), 4, 1, nullptr },
+        { "attainmentWepStatusFai", field_type::s32, offsetof(T, attainmentWepStatusFai), 4, 1, nullptr },
+        { "attainmentWepStatusLuc", field_type::s32, offsetof(T, attainmentWepStatusLuc), 4, 1, nullptr },
+        { "attackElementCorrectId", field_type::s32, offsetof(T, attackElementCorrectId), 4, 1, nullptr },
+        { "saleValue", field_type::s32, offsetof(T, saleValue), 4, 1, nullptr },
+        { "reinforceShopCategory", field_type::u8, offsetof(T, reinforceShopCategory), 1, 1, nullptr },
+        { "maxArrowQuantity", field_type::u8, offsetof(T, maxArrowQuantity), 1, 1, nullptr },
+        { "residentSfx_1_IsVisibleForHang", field_type::boolean, 566, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->residentSfx_1_IsVisibleForHang; } },
+        { "residentSfx_2_IsVisibleForHang", field_type::boolean, 566, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->residentSfx_2_IsVisibleForHang; } },
+        { "residentSfx_3_IsVisibleForHang", field_type::boolean, 566, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->residentSfx_3_IsVisibleForHang; } },
+        { "residentSfx_4_IsVisibleForHang", field_type::boolean, 566, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->residentSfx_4_IsVisibleForHang; } },
+        { "isSoulParamIdChange_model0", field_type::boolean, 566, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSoulParamIdChange_model0; } },
+        { "isSoulParamIdChange_model1", field_type::boolean, 566, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSoulParamIdChange_model1; } },
+        { "isSoulParamIdChange_model2", field_type::boolean, 566, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSoulParamIdChange_model2; } },
+        { "isSoulParamIdChange_model3", field_type::boolean, 566, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSoulParamIdChange_model3; } },
+        { "wepSeIdOffset", field_type::s8, offsetof(T, wepSeIdOffset), 1, 1, nullptr },
+        { "baseChangePrice", field_type::s32, offsetof(T, baseChangePrice), 4, 1, nullptr },
+        { "levelSyncCorrectId", field_type::s16, offsetof(T, levelSyncCorrectId), 2, 1, nullptr },
+        { "correctType_Sleep", field_type::u8, offsetof(T, correctType_Sleep), 1, 1, nullptr },
+        { "correctType_Madness", field_type::u8, offsetof(T, correctType_Madness), 1, 1, nullptr },
+        { "rarity", field_type::u8, offsetof(T, rarity), 1, 1, nullptr },
+        { "gemMountType", field_type::u8, offsetof(T, gemMountType), 1, 1, nullptr },
+        { "wepRegainHp", field_type::u16, offsetof(T, wepRegainHp), 2, 1, nullptr },
+        { "spEffectMsgId0", field_type::s32, offsetof(T, spEffectMsgId0), 4, 1, nullptr },
+        { "spEffectMsgId1", field_type::s32, offsetof(T, spEffectMsgId1), 4, 1, nullptr },
+        { "spEffectMsgId2", field_type::s32, offsetof(T, spEffectMsgId2), 4, 1, nullptr },
+        { "originEquipWep16", field_type::s32, offsetof(T, originEquipWep16), 4, 1, nullptr },
+        { "originEquipWep17", field_type::s32, offsetof(T, originEquipWep17), 4, 1, nullptr },
+        { "originEquipWep18", field_type::s32, offsetof(T, originEquipWep18), 4, 1, nullptr },
+        { "originEquipWep19", field_type::s32, offsetof(T, originEquipWep19), 4, 1, nullptr },
+        { "originEquipWep20", field_type::s32, offsetof(T, originEquipWep20), 4, 1, nullptr },
+        { "originEquipWep21", field_type::s32, offsetof(T, originEquipWep21), 4, 1, nullptr },
+        { "originEquipWep22", field_type::s32, offsetof(T, originEquipWep22), 4, 1, nullptr },
+        { "originEquipWep23", field_type::s32, offsetof(T, originEquipWep23), 4, 1, nullptr },
+        { "originEquipWep24", field_type::s32, offsetof(T, originEquipWep24), 4, 1, nullptr },
+        { "originEquipWep25", field_type::s32, offsetof(T, originEquipWep25), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Sleep", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Sleep), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Madness", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Madness), 4, 1, nullptr },
+        { "saGuardCutRate", field_type::f32, offsetof(T, saGuardCutRate), 4, 1, nullptr },
+        { "defMaterialVariationValue", field_type::u8, offsetof(T, defMaterialVariationValue), 1, 1, nullptr },
+        { "spAttributeVariationValue", field_type::u8, offsetof(T, spAttributeVariationValue), 1, 1, nullptr },
+        { "stealthAtkRate", field_type::s16, offsetof(T, stealthAtkRate), 2, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Disease", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Disease), 4, 1, nullptr },
+        { "vsPlayerDmgCorrectRate_Curse", field_type::f32, offsetof(T, vsPlayerDmgCorrectRate_Curse), 4, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, behaviorVariationId) == 4);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, sortId) == 8);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, wanderingEquipId) == 12);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, weight) == 16);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, weaponWeightRate) == 20);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, fixPrice) == 24);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, reinforcePrice) == 28);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, sellValue) == 32);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctStrength) == 36);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctAgility) == 40);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctMagic) == 44);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctFaith) == 48);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, physGuardCutRate) == 52);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, magGuardCutRate) == 56);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, fireGuardCutRate) == 60);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, thunGuardCutRate) == 64);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, spEffectBehaviorId0) == 68);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, spEffectBehaviorId1) == 72);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, spEffectBehaviorId2) == 76);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSpEffectId) == 80);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSpEffectId1) == 84);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSpEffectId2) == 88);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, materialSetId) == 92);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep) == 96);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep1) == 100);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep2) == 104);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep3) == 108);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep4) == 112);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep5) == 116);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep6) == 120);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep7) == 124);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep8) == 128);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep9) == 132);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep10) == 136);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep11) == 140);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep12) == 144);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep13) == 148);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep14) == 152);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep15) == 156);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, weakA_DamageRate) == 160);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, weakB_DamageRate) == 164);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, weakC_DamageRate) == 168);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, weakD_DamageRate) == 172);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, sleepGuardResist_MaxCorrect) == 176);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, madnessGuardResist_MaxCorrect) == 180);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, saWeaponDamage) == 184);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, equipModelId) == 188);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, iconId) == 190);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, durability) == 192);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, durabilityMax) == 194);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attackThrowEscape) == 196);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, parryDamageLife) == 198);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attackBasePhysics) == 200);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attackBaseMagic) == 202);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attackBaseFire) == 204);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attackBaseThunder) == 206);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attackBaseStamina) == 208);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, guardAngle) == 210);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, saDurability) == 212);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, staminaGuardDef) == 216);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, reinforceTypeId) == 218);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, trophySGradeId) == 220);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, trophySeqId) == 222);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, throwAtkRate) == 224);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, bowDistRate) == 226);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, equipModelCategory) == 228);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, equipModelGender) == 229);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, weaponCategory) == 230);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, wepmotionCategory) == 231);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, guardmotionCategory) == 232);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, atkMaterial) == 233);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, defSeMaterial1) == 234);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctType_Physics) == 236);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, spAttribute) == 237);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, spAtkcategory) == 238);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, wepmotionOneHandId) == 240);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, wepmotionBothHandId) == 241);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, properStrength) == 242);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, properAgility) == 243);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, properMagic) == 244);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, properFaith) == 245);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, overStrength) == 246);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attackBaseParry) == 247);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, defenseBaseParry) == 248);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, guardBaseRepel) == 249);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attackBaseRepel) == 250);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, guardCutCancelRate) == 251);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, guardLevel) == 252);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, slashGuardCutRate) == 253);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, blowGuardCutRate) == 254);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, thrustGuardCutRate) == 255);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, poisonGuardResist) == 256);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, diseaseGuardResist) == 257);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, bloodGuardResist) == 258);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, curseGuardResist) == 259);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, atkAttribute) == 260);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, defSfxMaterial1) == 266);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, wepCollidableType0) == 268);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, wepCollidableType1) == 269);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, postureControlId_Right) == 270);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, postureControlId_Left) == 271);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceSfxId0) == 272);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdHead0) == 276);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdTail0) == 280);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceSfxId1) == 284);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdHead1) == 288);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdTail1) == 292);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceSfxId2) == 296);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdHead2) == 300);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdTail2) == 304);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceSfxId3) == 308);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdHead3) == 312);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdTail3) == 316);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceSfxId4) == 320);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdHead4) == 324);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdTail4) == 328);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceSfxId5) == 332);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdHead5) == 336);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdTail5) == 340);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceSfxId6) == 344);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdHead6) == 348);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdTail6) == 352);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceSfxId7) == 356);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdHead7) == 360);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, traceDmyIdTail7) == 364);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, defSfxMaterial2) == 368);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, defSeMaterial2) == 370);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, absorpParamId) == 372);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, toughnessCorrectRate) == 376);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctType_Magic) == 381);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctType_Fire) == 382);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctType_Thunder) == 383);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, weakE_DamageRate) == 384);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, weakF_DamageRate) == 388);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, darkGuardCutRate) == 392);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attackBaseDark) == 396);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctType_Dark) == 398);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctType_Poison) == 399);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, sortGroupId) == 400);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, atkAttribute2) == 401);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, sleepGuardResist) == 402);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, madnessGuardResist) == 403);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctType_Blood) == 404);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, properLuck) == 405);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, freezeGuardResist) == 406);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, autoReplenishType) == 407);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, swordArtsParamId) == 408);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctLuck) == 412);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, arrowBoltEquipId) == 416);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, DerivationLevelType) == 420);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, enchantSfxSize) == 421);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, wepType) == 422);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, physGuardCutRate_MaxCorrect) == 424);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, magGuardCutRate_MaxCorrect) == 428);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, fireGuardCutRate_MaxCorrect) == 432);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, thunGuardCutRate_MaxCorrect) == 436);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, darkGuardCutRate_MaxCorrect) == 440);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, poisonGuardResist_MaxCorrect) == 444);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, diseaseGuardResist_MaxCorrect) == 448);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, bloodGuardResist_MaxCorrect) == 452);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, curseGuardResist_MaxCorrect) == 456);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, freezeGuardResist_MaxCorrect) == 460);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, staminaGuardDef_MaxCorrect) == 464);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSfxId_1) == 468);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSfxId_2) == 472);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSfxId_3) == 476);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSfxId_4) == 480);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSfx_DmyId_1) == 484);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSfx_DmyId_2) == 488);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSfx_DmyId_3) == 492);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, residentSfx_DmyId_4) == 496);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, staminaConsumptionRate) == 500);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Physics) == 504);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Magic) == 508);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Fire) == 512);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Thunder) == 516);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Dark) == 520);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Poison) == 524);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Blood) == 528);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Freeze) == 532);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attainmentWepStatusStr) == 536);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attainmentWepStatusDex) == 540);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attainmentWepStatusMag) == 544);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attainmentWepStatusFai) == 548);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attainmentWepStatusLuc) == 552);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, attackElementCorrectId) == 556);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, saleValue) == 560);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, reinforceShopCategory) == 564);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, maxArrowQuantity) == 565);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, wepSeIdOffset) == 567);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, baseChangePrice) == 568);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, levelSyncCorrectId) == 572);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctType_Sleep) == 574);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, correctType_Madness) == 575);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, rarity) == 576);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, gemMountType) == 577);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, wepRegainHp) == 578);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, spEffectMsgId0) == 580);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, spEffectMsgId1) == 584);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, spEffectMsgId2) == 588);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep16) == 592);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep17) == 596);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep18) == 600);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep19) == 604);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep20) == 608);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep21) == 612);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep22) == 616);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep23) == 620);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep24) == 624);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, originEquipWep25) == 628);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Sleep) == 632);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Madness) == 636);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, saGuardCutRate) == 640);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, defMaterialVariationValue) == 644);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, spAttributeVariationValue) == 645);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, stealthAtkRate) == 646);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Disease) == 648);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, vsPlayerDmgCorrectRate_Curse) == 652);
+static_assert(offsetof(paramdef::EQUIP_PARAM_WEAPON_ST, pad) == 656);
+
+}; // namespace params
+}; // namespace from
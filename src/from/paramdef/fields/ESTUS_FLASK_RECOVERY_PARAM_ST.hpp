@@ -0,0 +1,64 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../ESTUS_FLASK_RECOVERY_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST> {
+    using T = paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 21> fields = {{
+        { "host", field_type::u8, offsetof(T, host), 1, 1, nullptr },
+        { "invadeOrb_None", field_type::u8, offsetof(T, invadeOrb_None), 1, 1, nullptr },
+        { "invadeOrb_Umbasa", field_type::u8, offsetof(T, invadeOrb_Umbasa), 1, 1, nullptr },
+        { "invadeOrb_Berserker", field_type::u8, offsetof(T, invadeOrb_Berserker), 1, 1, nullptr },
+        { "invadeOrb_Sinners", field_type::u8, offsetof(T, invadeOrb_Sinners), 1, 1, nullptr },
+        { "invadeSign_None", field_type::u8, offsetof(T, invadeSign_None), 1, 1, nullptr },
+        { "invadeSign_Umbasa", field_type::u8, offsetof(T, invadeSign_Umbasa), 1, 1, nullptr },
+        { "invadeSign_Berserker", field_type::u8, offsetof(T, invadeSign_Berserker), 1, 1, nullptr },
+        { "invadeSign_Sinners", field_type::u8, offsetof(T, invadeSign_Sinners), 1, 1, nullptr },
+        { "invadeRing_Sinners", field_type::u8, offsetof(T, invadeRing_Sinners), 1, 1, nullptr },
+        { "invadeRing_Rosalia", field_type::u8, offsetof(T, invadeRing_Rosalia), 1, 1, nullptr },
+        { "invadeRing_Forest", field_type::u8, offsetof(T, invadeRing_Forest), 1, 1, nullptr },
+        { "coopSign_None", field_type::u8, offsetof(T, coopSign_None), 1, 1, nullptr },
+        { "coopSign_Umbasa", field_type::u8, offsetof(T, coopSign_Umbasa), 1, 1, nullptr },
+        { "coopSign_Berserker", field_type::u8, offsetof(T, coopSign_Berserker), 1, 1, nullptr },
+        { "coopSign_Sinners", field_type::u8, offsetof(T, coopSign_Sinners), 1, 1, nullptr },
+        { "coopRing_RedHunter", field_type::u8, offsetof(T, coopRing_RedHunter), 1, 1, nullptr },
+        { "invadeRing_Anor", field_type::u8, offsetof(T, invadeRing_Anor), 1, 1, nullptr },
+        { "paramReplaceRate", field_type::u16, offsetof(T, paramReplaceRate), 2, 1, nullptr },
+        { "paramReplaceId", field_type::s32, offsetof(T, paramReplaceId), 4, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, host) == 0);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeOrb_None) == 1);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeOrb_Umbasa) == 2);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeOrb_Berserker) == 3);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeOrb_Sinners) == 4);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeSign_None) == 5);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeSign_Umbasa) == 6);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeSign_Berserker) == 7);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeSign_Sinners) == 8);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeRing_Sinners) == 9);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeRing_Rosalia) == 10);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeRing_Forest) == 11);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, coopSign_None) == 12);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, coopSign_Umbasa) == 13);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, coopSign_Berserker) == 14);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, coopSign_Sinners) == 15);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, coopRing_RedHunter) == 16);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, invadeRing_Anor) == 17);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, paramReplaceRate) == 18);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, paramReplaceId) == 20);
+static_assert(offsetof(paramdef::ESTUS_FLASK_RECOVERY_PARAM_ST, pad) == 24);
+
+}; // namespace params
+}; // namespace from
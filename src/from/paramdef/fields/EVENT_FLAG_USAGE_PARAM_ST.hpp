@@ -0,0 +1,32 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../EVENT_FLAG_USAGE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::EVENT_FLAG_USAGE_PARAM_ST> {
+    using T = paramdef::EVENT_FLAG_USAGE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 5> fields = {{
+        { "usageType", field_type::u8, offsetof(T, usageType), 1, 1, nullptr },
+        { "playlogCategory", field_type::u8, offsetof(T, playlogCategory), 1, 1, nullptr },
+        { "padding1", field_type::u8, offsetof(T, padding1), 1, 2, nullptr },
+        { "flagNum", field_type::s32, offsetof(T, flagNum), 4, 1, nullptr },
+        { "padding2", field_type::u8, offsetof(T, padding2), 1, 24, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::EVENT_FLAG_USAGE_PARAM_ST, usageType) == 0);
+static_assert(offsetof(paramdef::EVENT_FLAG_USAGE_PARAM_ST, playlogCategory) == 1);
+static_assert(offsetof(paramdef::EVENT_FLAG_USAGE_PARAM_ST, padding1) == 2);
+static_assert(offsetof(paramdef::EVENT_FLAG_USAGE_PARAM_ST, flagNum) == 4);
+static_assert(offsetof(paramdef::EVENT_FLAG_USAGE_PARAM_ST, padding2) == 8);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,499 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../FACE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::FACE_PARAM_ST> {
+    using T = paramdef::FACE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 242> fields = {{
+        { "face_partsId", field_type::u8, offsetof(T, face_partsId), 1, 1, nullptr },
+        { "skin_color_R", field_type::u8, offsetof(T, skin_color_R), 1, 1, nullptr },
+        { "skin_color_G", field_type::u8, offsetof(T, skin_color_G), 1, 1, nullptr },
+        { "skin_color_B", field_type::u8, offsetof(T, skin_color_B), 1, 1, nullptr },
+        { "skin_gloss", field_type::u8, offsetof(T, skin_gloss), 1, 1, nullptr },
+        { "skin_pores", field_type::u8, offsetof(T, skin_pores), 1, 1, nullptr },
+        { "face_beard", field_type::u8, offsetof(T, face_beard), 1, 1, nullptr },
+        { "face_aroundEye", field_type::u8, offsetof(T, face_aroundEye), 1, 1, nullptr },
+        { "face_aroundEyeColor_R", field_type::u8, offsetof(T, face_aroundEyeColor_R), 1, 1, nullptr },
+        { "face_aroundEyeColor_G", field_type::u8, offsetof(T, face_aroundEyeColor_G), 1, 1, nullptr },
+        { "face_aroundEyeColor_B", field_type::u8, offsetof(T, face_aroundEyeColor_B), 1, 1, nullptr },
+        { "face_cheek", field_type::u8, offsetof(T, face_cheek), 1, 1, nullptr },
+        { "face_cheekColor_R", field_type::u8, offsetof(T, face_cheekColor_R), 1, 1, nullptr },
+        { "face_cheekColor_G", field_type::u8, offsetof(T, face_cheekColor_G), 1, 1, nullptr },
+        { "face_cheekColor_B", field_type::u8, offsetof(T, face_cheekColor_B), 1, 1, nullptr },
+        { "face_eyeLine", field_type::u8, offsetof(T, face_eyeLine), 1, 1, nullptr },
+        { "face_eyeLineColor_R", field_type::u8, offsetof(T, face_eyeLineColor_R), 1, 1, nullptr },
+        { "face_eyeLineColor_G", field_type::u8, offsetof(T, face_eyeLineColor_G), 1, 1, nullptr },
+        { "face_eyeLineColor_B", field_type::u8, offsetof(T, face_eyeLineColor_B), 1, 1, nullptr },
+        { "face_eyeShadowDown", field_type::u8, offsetof(T, face_eyeShadowDown), 1, 1, nullptr },
+        { "face_eyeShadowDownColor_R", field_type::u8, offsetof(T, face_eyeShadowDownColor_R), 1, 1, nullptr },
+        { "face_eyeShadowDownColor_G", field_type::u8, offsetof(T, face_eyeShadowDownColor_G), 1, 1, nullptr },
+        { "face_eyeShadowDownColor_B", field_type::u8, offsetof(T, face_eyeShadowDownColor_B), 1, 1, nullptr },
+        { "face_eyeShadowUp", field_type::u8, offsetof(T, face_eyeShadowUp), 1, 1, nullptr },
+        { "face_eyeShadowUpColor_R", field_type::u8, offsetof(T, face_eyeShadowUpColor_R), 1, 1, nullptr },
+        { "face_eyeShadowUpColor_G", field_type::u8, offsetof(T, face_eyeShadowUpColor_G), 1, 1, nullptr },
+        { "face_eyeShadowUpColor_B", field_type::u8, offsetof(T, face_eyeShadowUpColor_B), 1, 1, nullptr },
+        { "face_lip", field_type::u8, offsetof(T, face_lip), 1, 1, nullptr },
+        { "face_lipColor_R", field_type::u8, offsetof(T, face_lipColor_R), 1, 1, nullptr },
+        { "face_lipColor_G", field_type::u8, offsetof(T, face_lipColor_G), 1, 1, nullptr },
+        { "face_lipColor_B", field_type::u8, offsetof(T, face_lipColor_B), 1, 1, nullptr },
+        { "body_hair", field_type::u8, offsetof(T, body_hair), 1, 1, nullptr },
+        { "body_hairColor_R", field_type::u8, offsetof(T, body_hairColor_R), 1, 1, nullptr },
+        { "body_hairColor_G", field_type::u8, offsetof(T, body_hairColor_G), 1, 1, nullptr },
+        { "body_hairColor_B", field_type::u8, offsetof(T, body_hairColor_B), 1, 1, nullptr },
+        { "eye_partsId", field_type::u8, offsetof(T, eye_partsId), 1, 1, nullptr },
+        { "eyeR_irisColor_R", field_type::u8, offsetof(T, eyeR_irisColor_R), 1, 1, nullptr },
+        { "eyeR_irisColor_G", field_type::u8, offsetof(T, eyeR_irisColor_G), 1, 1, nullptr },
+        { "eyeR_irisColor_B", field_type::u8, offsetof(T, eyeR_irisColor_B), 1, 1, nullptr },
+        { "eyeR_irisScale", field_type::u8, offsetof(T, eyeR_irisScale), 1, 1, nullptr },
+        { "eyeR_cataract", field_type::u8, offsetof(T, eyeR_cataract), 1, 1, nullptr },
+        { "eyeR_cataractColor_R", field_type::u8, offsetof(T, eyeR_cataractColor_R), 1, 1, nullptr },
+        { "eyeR_cataractColor_G", field_type::u8, offsetof(T, eyeR_cataractColor_G), 1, 1, nullptr },
+        { "eyeR_cataractColor_B", field_type::u8, offsetof(T, eyeR_cataractColor_B), 1, 1, nullptr },
+        { "eyeR_scleraColor_R", field_type::u8, offsetof(T, eyeR_scleraColor_R), 1, 1, nullptr },
+        { "eyeR_scleraColor_G", field_type::u8, offsetof(T, eyeR_scleraColor_G), 1, 1, nullptr },
+        { "eyeR_scleraColor_B", field_type::u8, offsetof(T, eyeR_scleraColor_B), 1, 1, nullptr },
+        { "eyeR_irisDistance", field_type::u8, offsetof(T, eyeR_irisDistance), 1, 1, nullptr },
+        { "eyeL_irisColor_R", field_type::u8, offsetof(T, eyeL_irisColor_R), 1, 1, nullptr },
+        { "eyeL_irisColor_G", field_type::u8, offsetof(T, eyeL_irisColor_G), 1, 1, nullptr },
+        { "eyeL_irisColor_B", field_type::u8, offsetof(T, eyeL_irisColor_B), 1, 1, nullptr },
+        { "eyeL_irisScale", field_type::u8, offsetof(T, eyeL_irisScale), 1, 1, nullptr },
+        { "eyeL_cataract", field_type::u8, offsetof(T, eyeL_cataract), 1, 1, nullptr },
+        { "eyeL_cataractColor_R", field_type::u8, offsetof(T, eyeL_cataractColor_R), 1, 1, nullptr },
+        { "eyeL_cataractColor_G", field_type::u8, offsetof(T, eyeL_cataractColor_G), 1, 1, nullptr },
+        { "eyeL_cataractColor_B", field_type::u8, offsetof(T, eyeL_cataractColor_B), 1, 1, nullptr },
+        { "eyeL_scleraColor_R", field_type::u8, offsetof(T, eyeL_scleraColor_R), 1, 1, nullptr },
+        { "eyeL_scleraColor_G", field_type::u8, offsetof(T, eyeL_scleraColor_G), 1, 1, nullptr },
+        { "eyeL_scleraColor_B", field_type::u8, offsetof(T, eyeL_scleraColor_B), 1, 1, nullptr },
+        { "eyeL_irisDistance", field_type::u8, offsetof(T, eyeL_irisDistance), 1, 1, nullptr },
+        { "hair_partsId", field_type::u8, offsetof(T, hair_partsId), 1, 1, nullptr },
+        { "hair_color_R", field_type::u8, offsetof(T, hair_color_R), 1, 1, nullptr },
+        { "hair_color_G", field_type::u8, offsetof(T, hair_color_G), 1, 1, nullptr },
+        { "hair_color_B", field_type::u8, offsetof(T, hair_color_B), 1, 1, nullptr },
+        { "hair_shininess", field_type::u8, offsetof(T, hair_shininess), 1, 1, nullptr },
+        { "hair_rootBlack", field_type::u8, offsetof(T, hair_rootBlack), 1, 1, nullptr },
+        { "hair_whiteDensity", field_type::u8, offsetof(T, hair_whiteDensity), 1, 1, nullptr },
+        { "beard_partsId", field_type::u8, offsetof(T, beard_partsId), 1, 1, nullptr },
+        { "beard_color_R", field_type::u8, offsetof(T, beard_color_R), 1, 1, nullptr },
+        { "beard_color_G", field_type::u8, offsetof(T, beard_color_G), 1, 1, nullptr },
+        { "beard_color_B", field_type::u8, offsetof(T, beard_color_B), 1, 1, nullptr },
+        { "beard_shininess", field_type::u8, offsetof(T, beard_shininess), 1, 1, nullptr },
+        { "beard_rootBlack", field_type::u8, offsetof(T, beard_rootBlack), 1, 1, nullptr },
+        { "beard_whiteDensity", field_type::u8, offsetof(T, beard_whiteDensity), 1, 1, nullptr },
+        { "eyebrow_partsId", field_type::u8, offsetof(T, eyebrow_partsId), 1, 1, nullptr },
+        { "eyebrow_color_R", field_type::u8, offsetof(T, eyebrow_color_R), 1, 1, nullptr },
+        { "eyebrow_color_G", field_type::u8, offsetof(T, eyebrow_color_G), 1, 1, nullptr },
+        { "eyebrow_color_B", field_type::u8, offsetof(T, eyebrow_color_B), 1, 1, nullptr },
+        { "eyebrow_shininess", field_type::u8, offsetof(T, eyebrow_shininess), 1, 1, nullptr },
+        { "eyebrow_rootBlack", field_type::u8, offsetof(T, eyebrow_rootBlack), 1, 1, nullptr },
+        { "eyebrow_whiteDensity", field_type::u8, offsetof(T, eyebrow_whiteDensity), 1, 1, nullptr },
+        { "eyelash_partsId", field_type::u8, offsetof(T, eyelash_partsId), 1, 1, nullptr },
+        { "eyelash_color_R", field_type::u8, offsetof(T, eyelash_color_R), 1, 1, nullptr },
+        { "eyelash_color_G", field_type::u8, offsetof(T, eyelash_color_G), 1, 1, nullptr },
+        { "eyelash_color_B", field_type::u8, offsetof(T, eyelash_color_B), 1, 1, nullptr },
+        { "accessories_partsId", field_type::u8, offsetof(T, accessories_partsId), 1, 1, nullptr },
+        { "accessories_color_R", field_type::u8, offsetof(T, accessories_color_R), 1, 1, nullptr },
+        { "accessories_color_G", field_type::u8, offsetof(T, accessories_color_G), 1, 1, nullptr },
+        { "accessories_color_B", field_type::u8, offsetof(T, accessories_color_B), 1, 1, nullptr },
+        { "decal_partsId", field_type::u8, offsetof(T, decal_partsId), 1, 1, nullptr },
+        { "decal_posX", field_type::u8, offsetof(T, decal_posX), 1, 1, nullptr },
+        { "decal_posY", field_type::u8, offsetof(T, decal_posY), 1, 1, nullptr },
+        { "decal_angle", field_type::u8, offsetof(T, decal_angle), 1, 1, nullptr },
+        { "decal_scale", field_type::u8, offsetof(T, decal_scale), 1, 1, nullptr },
+        { "decal_color_R", field_type::u8, offsetof(T, decal_color_R), 1, 1, nullptr },
+        { "decal_color_G", field_type::u8, offsetof(T, decal_color_G), 1, 1, nullptr },
+        { "decal_color_B", field_type::u8, offsetof(T, decal_color_B), 1, 1, nullptr },
+        { "decal_gloss", field_type::u8, offsetof(T, decal_gloss), 1, 1, nullptr },
+        { "decal_mirror", field_type::u8, offsetof(T, decal_mirror), 1, 1, nullptr },
+        { "chrBodyScaleHead", field_type::u8, offsetof(T, chrBodyScaleHead), 1, 1, nullptr },
+        { "chrBodyScaleBreast", field_type::u8, offsetof(T, chrBodyScaleBreast), 1, 1, nullptr },
+        { "chrBodyScaleAbdomen", field_type::u8, offsetof(T, chrBodyScaleAbdomen), 1, 1, nullptr },
+        { "chrBodyScaleRArm", field_type::u8, offsetof(T, chrBodyScaleRArm), 1, 1, nullptr },
+        { "chrBodyScaleRLeg", field_type::u8, offsetof(T, chrBodyScaleRLeg), 1, 1, nullptr },
+        { "chrBodyScaleLArm", field_type::u8, offsetof(T, chrBodyScaleLArm), 1, 1, nullptr },
+        { "chrBodyScaleLLeg", field_type::u8, offsetof(T, chrBodyScaleLLeg), 1, 1, nullptr },
+        { "burn_scar", field_type::u8, offsetof(T, burn_scar), 1, 1, nullptr },
+        { "override_eye_partsId", field_type::boolean, 107, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->override_eye_partsId; } },
+        { "override_eye_irisColor", field_type::boolean, 107, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->override_eye_irisColor; } },
+        { "override_eye_cataract", field_type::boolean, 107, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->override_eye_cataract; } },
+        { "override_eye_cataractColor", field_type::boolean, 107, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->override_eye_cataractColor; } },
+        { "override_eye_scleraColor", field_type::boolean, 107, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->override_eye_scleraColor; } },
+        { "override_burn_scar", field_type::boolean, 107, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->override_burn_scar; } },
+        { "pad2", field_type::u8, 107, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad2; } },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 5, nullptr },
+        { "age", field_type::u8, offsetof(T, age), 1, 1, nullptr },
+        { "gender", field_type::u8, offsetof(T, gender), 1, 1, nullptr },
+        { "caricatureGeometry", field_type::u8, offsetof(T, caricatureGeometry), 1, 1, nullptr },
+        { "caricatureTexture", field_type::u8, offsetof(T, caricatureTexture), 1, 1, nullptr },
+        { "faceGeoData00", field_type::u8, offsetof(T, faceGeoData00), 1, 1, nullptr },
+        { "faceGeoData01", field_type::u8, offsetof(T, faceGeoData01), 1, 1, nullptr },
+        { "faceGeoData02", field_type::u8, offsetof(T, faceGeoData02), 1, 1, nullptr },
+        { "faceGeoData03", field_type::u8, offsetof(T, faceGeoData03), 1, 1, nullptr },
+        { "faceGeoData04", field_type::u8, offsetof(T, faceGeoData04), 1, 1, nullptr },
+        { "faceGeoData05", field_type::u8, offsetof(T, faceGeoData05), 1, 1, nullptr },
+        { "faceGeoData06", field_type::u8, offsetof(T, faceGeoData06), 1, 1, nullptr },
+        { "faceGeoData07", field_type::u8, offsetof(T, faceGeoData07), 1, 1, nullptr },
+        { "faceGeoData08", field_type::u8, offsetof(T, faceGeoData08), 1, 1, nullptr },
+        { "faceGeoData09", field_type::u8, offsetof(T, faceGeoData09), 1, 1, nullptr },
+        { "faceGeoData10", field_type::u8, offsetof(T, faceGeoData10), 1, 1, nullptr },
+        { "faceGeoData11", field_type::u8, offsetof(T, faceGeoData11), 1, 1, nullptr },
+        { "faceGeoData12", field_type::u8, offsetof(T, faceGeoData12), 1, 1, nullptr },
+        { "faceGeoData13", field_type::u8, offsetof(T, faceGeoData13), 1, 1, nullptr },
+        { "faceGeoData14", field_type::u8, offsetof(T, faceGeoData14), 1, 1, nullptr },
+        { "faceGeoData15", field_type::u8, offsetof(T, faceGeoData15), 1, 1, nullptr },
+        { "faceGeoData16", field_type::u8, offsetof(T, faceGeoData16), 1, 1, nullptr },
+        { "faceGeoData17", field_type::u8, offsetof(T, faceGeoData17), 1, 1, nullptr },
+        { "faceGeoData18", field_type::u8, offsetof(T, faceGeoData18), 1, 1, nullptr },
+        { "faceGeoData19", field_type::u8, offsetof(T, faceGeoData19), 1, 1, nullptr },
+        { "faceGeoData20", field_type::u8, offsetof(T, faceGeoData20), 1, 1, nullptr },
+        { "faceGeoData21", field_type::u8, offsetof(T, faceGeoData21), 1, 1, nullptr },
+        { "faceGeoData22", field_type::u8, offsetof(T, faceGeoData22), 1, 1, nullptr },
+        { "faceGeoData23", field_type::u8, offsetof(T, faceGeoData23), 1, 1, nullptr },
+        { "faceGeoData24", field_type::u8, offsetof(T, faceGeoData24), 1, 1, nullptr },
+        { "faceGeoData25", field_type::u8, offsetof(T, faceGeoData25), 1, 1, nullptr },
+        { "faceGeoData26", field_type::u8, offsetof(T, faceGeoData26), 1, 1, nullptr },
+        { "faceGeoData27", field_type::u8, offsetof(T, faceGeoData27), 1, 1, nullptr },
+        { "faceGeoData28", field_type::u8, offsetof(T, faceGeoData28), 1, 1, nullptr },
+        { "faceGeoData29", field_type::u8, offsetof(T, faceGeoData29), 1, 1, nullptr },
+        { "faceGeoData30", field_type::u8, offsetof(T, faceGeoData30), 1, 1, nullptr },
+        { "faceGeoData31", field_type::u8, offsetof(T, faceGeoData31), 1, 1, nullptr },
+        { "faceGeoData32", field_type::u8, offsetof(T, faceGeoData32), 1, 1, nullptr },
+        { "faceGeoData33", field_type::u8, offsetof(T, faceGeoData33), 1, 1, nullptr },
+        { "faceGeoData34", field_type::u8, offsetof(T, faceGeoData34), 1, 1, nullptr },
+        { "faceGeoData35", field_type::u8, offsetof(T, faceGeoData35), 1, 1, nullptr },
+        { "faceGeoData36", field_type::u8, offsetof(T, faceGeoData36), 1, 1, nullptr },
+        { "faceGeoData37", field_type::u8, offsetof(T, faceGeoData37), 1, 1, nullptr },
+        { "faceGeoData38", field_type::u8, offsetof(T, faceGeoData38), 1, 1, nullptr },
+        { "faceGeoData39", field_type::u8, offsetof(T, faceGeoData39), 1, 1, nullptr },
+        { "faceGeoData40", field_type::u8, offsetof(T, faceGeoData40), 1, 1, nullptr },
+        { "faceGeoData41", field_type::u8, offsetof(T, faceGeoData41), 1, 1, nullptr },
+        { "faceGeoData42", field_type::u8, offsetof(T, faceGeoData42), 1, 1, nullptr },
+        { "faceGeoData43", field_type::u8, offsetof(T, faceGeoData43), 1, 1, nullptr },
+        { "faceGeoData44", field_type::u8, offsetof(T, faceGeoData44), 1, 1, nullptr },
+        { "faceGeoData45", field_type::u8, offsetof(T, faceGeoData45), 1, 1, nullptr },
+        { "faceGeoData46", field_type::u8, offsetof(T, faceGeoData46), 1, 1, nullptr },
+        { "faceGeoData47", field_type::u8, offsetof(T, faceGeoData47), 1, 1, nullptr },
+        { "faceGeoData48", field_type::u8, offsetof(T, faceGeoData48), 1, 1, nullptr },
+        { "faceGeoData49", field_type::u8, offsetof(T, faceGeoData49), 1, 1, nullptr },
+        { "faceGeoData50", field_type::u8, offsetof(T, faceGeoData50), 1, 1, nullptr },
+        { "faceGeoData51", field_type::u8, offsetof(T, faceGeoData51), 1, 1, nullptr },
+        { "faceGeoData52", field_type::u8, offsetof(T, faceGeoData52), 1, 1, nullptr },
+        { "faceGeoData53", field_type::u8, offsetof(T, faceGeoData53), 1, 1, nullptr },
+        { "faceGeoData54", field_type::u8, offsetof(T, faceGeoData54), 1, 1, nullptr },
+        { "faceGeoData55", field_type::u8, offsetof(T, faceGeoData55), 1, 1, nullptr },
+        { "faceGeoData56", field_type::u8, offsetof(T, faceGeoData56), 1, 1, nullptr },
+        { "faceGeoData57", field_type::u8, offsetof(T, faceGeoData57), 1, 1, nullptr },
+        { "faceGeoData58", field_type::u8, offsetof(T, faceGeoData58), 1, 1, nullptr },
+        { "faceGeoData59", field_type::u8, offsetof(T, faceGeoData59), 1, 1, nullptr },
+        { "faceGeoData60", field_type::u8, offsetof(T, faceGeoData60), 1, 1, nullptr },
+        { "faceTexData00", field_type::u8, offsetof(T, faceTexData00), 1, 1, nullptr },
+        { "faceTexData01", field_type::u8, offsetof(T, faceTexData01), 1, 1, nullptr },
+        { "faceTexData02", field_type::u8, offsetof(T, faceTexData02), 1, 1, nullptr },
+        { "faceTexData03", field_type::u8, offsetof(T, faceTexData03), 1, 1, nullptr },
+        { "faceTexData04", field_type::u8, offsetof(T, faceTexData04), 1, 1, nullptr },
+        { "faceTexData05", field_type::u8, offsetof(T, faceTexData05), 1, 1, nullptr },
+        { "faceTexData06", field_type::u8, offsetof(T, faceTexData06), 1, 1, nullptr },
+        { "faceTexData07", field_type::u8, offsetof(T, faceTexData07), 1, 1, nullptr },
+        { "faceTexData08", field_type::u8, offsetof(T, faceTexData08), 1, 1, nullptr },
+        { "faceTexData09", field_type::u8, offsetof(T, faceTexData09), 1, 1, nullptr },
+        { "faceTexData10", field_type::u8, offsetof(T, faceTexData10), 1, 1, nullptr },
+        { "faceTexData11", field_type::u8, offsetof(T, faceTexData11), 1, 1, nullptr },
+        { "faceTexData12", field_type::u8, offsetof(T, faceTexData12), 1, 1, nullptr },
+        { "faceTexData13", field_type::u8, offsetof(T, faceTexData13), 1, 1, nullptr },
+        { "faceTexData14", field_type::u8, offsetof(T, faceTexData14), 1, 1, nullptr },
+        { "faceTexData15", field_type::u8, offsetof(T, faceTexData15), 1, 1, nullptr },
+        { "faceTexData16", field_type::u8, offsetof(T, faceTexData16), 1, 1, nullptr },
+        { "faceTexData17", field_type::u8, offsetof(T, faceTexData17), 1, 1, nullptr },
+        { "faceTexData18", field_type::u8, offsetof(T, faceTexData18), 1, 1, nullptr },
+        { "faceTexData19", field_type::u8, offsetof(T, faceTexData19), 1, 1, nullptr },
+        { "faceTexData20", field_type::u8, offsetof(T, faceTexData20), 1, 1, nullptr },
+        { "faceTexData21", field_type::u8, offsetof(T, faceTexData21), 1, 1, nullptr },
+        { "faceTexData22", field_type::u8, offsetof(T, faceTexData22), 1, 1, nullptr },
+        { "faceTexData23", field_type::u8, offsetof(T, faceTexData23), 1, 1, nullptr },
+        { "faceTexData24", field_type::u8, offsetof(T, faceTexData24), 1, 1, nullptr },
+        { "faceTexData25", field_type::u8, offsetof(T, faceTexData25), 1, 1, nullptr },
+        { "faceTexData26", field_type::u8, offsetof(T, faceTexData26), 1, 1, nullptr },
+        { "faceTexData27", field_type::u8, offsetof(T, faceTexData27), 1, 1, nullptr },
+        { "faceTexData28", field_type::u8, offsetof(T, faceTexData28), 1, 1, nullptr },
+        { "faceTexData29", field_type::u8, offsetof(T, faceTexData29), 1, 1, nullptr },
+        { "faceTexData30", field_type::u8, offsetof(T, faceTexData30), 1, 1, nullptr },
+        { "faceTexData31", field_type::u8, offsetof(T, faceTexData31), 1, 1, nullptr },
+        { "faceTexData32", field_type::u8, offsetof(T, faceTexData32), 1, 1, nullptr },
+        { "faceTexData33", field_type::u8, offsetof(T, faceTexData33), 1, 1, nullptr },
+        { "faceTexData34", field_type::u8, offsetof(T, faceTexData34), 1, 1, nullptr },
+        { "faceTexData35", field_type::u8, offsetof(T, faceTexData35), 1, 1, nullptr },
+        { "faceGeoAsymData00", field_type::u8, offsetof(T, faceGeoAsymData00), 1, 1, nullptr },
+        { "faceGeoAsymData01", field_type::u8, offsetof(T, faceGeoAsymData01), 1, 1, nullptr },
+        { "faceGeoAsymData02", field_type::u8, offsetof(T, faceGeoAsymData02), 1, 1, nullptr },
+        { "faceGeoAsymData03", field_type::u8, offsetof(T, faceGeoAsymData03), 1, 1, nullptr },
+        { "faceGeoAsymData04", field_type::u8, offsetof(T, faceGeoAsymData04), 1, 1, nullptr },
+        { "faceGeoAsymData05", field_type::u8, offsetof(T, faceGeoAsymData05), 1, 1, nullptr },
+        { "faceGeoAsymData06", field_type::u8, offsetof(T, faceGeoAsymData06), 1, 1, nullptr },
+        { "faceGeoAsymData07", field_type::u8, offsetof(T, faceGeoAsymData07), 1, 1, nullptr },
+        { "faceGeoAsymData08", field_type::u8, offsetof(T, faceGeoAsymData08), 1, 1, nullptr },
+        { "faceGeoAsymData09", field_type::u8, offsetof(T, faceGeoAsymData09), 1, 1, nullptr },
+        { "faceGeoAsymData10", field_type::u8, offsetof(T, faceGeoAsymData10), 1, 1, nullptr },
+        { "faceGeoAsymData11", field_type::u8, offsetof(T, faceGeoAsymData11), 1, 1, nullptr },
+        { "faceGeoAsymData12", field_type::u8, offsetof(T, faceGeoAsymData12), 1, 1, nullptr },
+        { "faceGeoAsymData13", field_type::u8, offsetof(T, faceGeoAsymData13), 1, 1, nullptr },
+        { "faceGeoAsymData14", field_type::u8, offsetof(T, faceGeoAsymData14), 1, 1, nullptr },
+        { "faceGeoAsymData15", field_type::u8, offsetof(T, faceGeoAsymData15), 1, 1, nullptr },
+        { "faceGeoAsymData16", field_type::u8, offsetof(T, faceGeoAsymData16), 1, 1, nullptr },
+        { "faceGeoAsymData17", field_type::u8, offsetof(T, faceGeoAsymData17), 1, 1, nullptr },
+        { "faceGeoAsymData18", field_type::u8, offsetof(T, faceGeoAsymData18), 1, 1, nullptr },
+        { "faceGeoAsymData19", field_type::u8, offsetof(T, faceGeoAsymData19), 1, 1, nullptr },
+        { "faceGeoAsymData20", field_type::u8, offsetof(T, faceGeoAsymData20), 1, 1, nullptr },
+        { "faceGeoAsymData21", field_type::u8, offsetof(T, faceGeoAsymData21), 1, 1, nullptr },
+        { "faceGeoAsymData22", field_type::u8, offsetof(T, faceGeoAsymData22), 1, 1, nullptr },
+        { "faceGeoAsymData23", field_type::u8, offsetof(T, faceGeoAsymData23), 1, 1, nullptr },
+        { "faceGeoAsymData24", field_type::u8, offsetof(T, faceGeoAsymData24), 1, 1, nullptr },
+        { "faceGeoAsymData25", field_type::u8, offsetof(T, faceGeoAsymData25), 1, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_partsId) == 0);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, skin_color_R) == 1);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, skin_color_G) == 2);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, skin_color_B) == 3);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, skin_gloss) == 4);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, skin_pores) == 5);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_beard) == 6);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_aroundEye) == 7);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_aroundEyeColor_R) == 8);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_aroundEyeColor_G) == 9);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_aroundEyeColor_B) == 10);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_cheek) == 11);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_cheekColor_R) == 12);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_cheekColor_G) == 13);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_cheekColor_B) == 14);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeLine) == 15);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeLineColor_R) == 16);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeLineColor_G) == 17);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeLineColor_B) == 18);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeShadowDown) == 19);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeShadowDownColor_R) == 20);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeShadowDownColor_G) == 21);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeShadowDownColor_B) == 22);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeShadowUp) == 23);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeShadowUpColor_R) == 24);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeShadowUpColor_G) == 25);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_eyeShadowUpColor_B) == 26);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_lip) == 27);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_lipColor_R) == 28);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_lipColor_G) == 29);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, face_lipColor_B) == 30);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, body_hair) == 31);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, body_hairColor_R) == 32);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, body_hairColor_G) == 33);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, body_hairColor_B) == 34);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eye_partsId) == 35);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_irisColor_R) == 36);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_irisColor_G) == 37);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_irisColor_B) == 38);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_irisScale) == 39);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_cataract) == 40);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_cataractColor_R) == 41);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_cataractColor_G) == 42);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_cataractColor_B) == 43);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_scleraColor_R) == 44);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_scleraColor_G) == 45);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_scleraColor_B) == 46);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeR_irisDistance) == 47);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_irisColor_R) == 48);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_irisColor_G) == 49);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_irisColor_B) == 50);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_irisScale) == 51);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_cataract) == 52);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_cataractColor_R) == 53);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_cataractColor_G) == 54);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_cataractColor_B) == 55);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_scleraColor_R) == 56);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_scleraColor_G) == 57);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_scleraColor_B) == 58);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyeL_irisDistance) == 59);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, hair_partsId) == 60);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, hair_color_R) == 61);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, hair_color_G) == 62);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, hair_color_B) == 63);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, hair_shininess) == 64);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, hair_rootBlack) == 65);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, hair_whiteDensity) == 66);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, beard_partsId) == 67);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, beard_color_R) == 68);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, beard_color_G) == 69);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, beard_color_B) == 70);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, beard_shininess) == 71);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, beard_rootBlack) == 72);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, beard_whiteDensity) == 73);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyebrow_partsId) == 74);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyebrow_color_R) == 75);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyebrow_color_G) == 76);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyebrow_color_B) == 77);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyebrow_shininess) == 78);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyebrow_rootBlack) == 79);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyebrow_whiteDensity) == 80);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyelash_partsId) == 81);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyelash_color_R) == 82);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyelash_color_G) == 83);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, eyelash_color_B) == 84);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, accessories_partsId) == 85);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, accessories_color_R) == 86);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, accessories_color_G) == 87);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, accessories_color_B) == 88);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, decal_partsId) == 89);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, decal_posX) == 90);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, decal_posY) == 91);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, decal_angle) == 92);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, decal_scale) == 93);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, decal_color_R) == 94);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, decal_color_G) == 95);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, decal_color_B) == 96);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, decal_gloss) == 97);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, decal_mirror) == 98);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, chrBodyScaleHead) == 99);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, chrBodyScaleBreast) == 100);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, chrBodyScaleAbdomen) == 101);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, chrBodyScaleRArm) == 102);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, chrBodyScaleRLeg) == 103);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, chrBodyScaleLArm) == 104);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, chrBodyScaleLLeg) == 105);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, burn_scar) == 106);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, pad) == 108);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, age) == 113);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, gender) == 114);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, caricatureGeometry) == 115);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, caricatureTexture) == 116);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData00) == 117);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData01) == 118);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData02) == 119);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData03) == 120);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData04) == 121);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData05) == 122);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData06) == 123);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData07) == 124);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData08) == 125);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData09) == 126);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData10) == 127);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData11) == 128);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData12) == 129);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData13) == 130);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData14) == 131);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData15) == 132);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData16) == 133);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData17) == 134);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData18) == 135);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData19) == 136);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData20) == 137);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData21) == 138);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData22) == 139);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData23) == 140);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData24) == 141);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData25) == 142);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData26) == 143);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData27) == 144);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData28) == 145);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData29) == 146);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData30) == 147);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData31) == 148);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData32) == 149);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData33) == 150);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData34) == 151);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData35) == 152);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData36) == 153);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData37) == 154);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData38) == 155);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData39) == 156);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData40) == 157);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData41) == 158);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData42) == 159);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData43) == 160);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData44) == 161);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData45) == 162);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData46) == 163);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData47) == 164);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData48) == 165);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData49) == 166);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData50) == 167);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData51) == 168);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData52) == 169);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData53) == 170);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData54) == 171);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData55) == 172);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData56) == 173);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData57) == 174);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData58) == 175);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData59) == 176);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoData60) == 177);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData00) == 178);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData01) == 179);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData02) == 180);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData03) == 181);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData04) == 182);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData05) == 183);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData06) == 184);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData07) == 185);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData08) == 186);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData09) == 187);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData10) == 188);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData11) == 189);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData12) == 190);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData13) == 191);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData14) == 192);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData15) == 193);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData16) == 194);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData17) == 195);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData18) == 196);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData19) == 197);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData20) == 198);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData21) == 199);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData22) == 200);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData23) == 201);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData24) == 202);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData25) == 203);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData26) == 204);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData27) == 205);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData28) == 206);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData29) == 207);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData30) == 208);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData31) == 209);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData32) == 210);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData33) == 211);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData34) == 212);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceTexData35) == 213);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData00) == 214);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData01) == 215);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData02) == 216);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData03) == 217);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData04) == 218);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData05) == 219);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData06) == 220);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData07) == 221);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData08) == 222);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData09) == 223);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData10) == 224);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData11) == 225);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData12) == 226);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData13) == 227);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData14) == 228);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData15) == 229);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData16) == 230);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData17) == 231);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData18) == 232);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData19) == 233);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData20) == 234);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData21) == 235);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData22) == 236);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData23) == 237);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData24) == 238);
+static_assert(offsetof(paramdef::FACE_PARAM_ST, faceGeoAsymData25) == 239);
+
+}; // namespace params
+}; // namespace from
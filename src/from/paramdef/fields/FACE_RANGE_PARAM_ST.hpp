@@ -0,0 +1,434 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../FACE_RANGE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::FACE_RANGE_PARAM_ST> {
+    using T = paramdef::FACE_RANGE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 206> fields = {{
+        { "face_partsId", field_type::f32, offsetof(T, face_partsId), 4, 1, nullptr },
+        { "skin_color_R", field_type::f32, offsetof(T, skin_color_R), 4, 1, nullptr },
+        { "skin_color_G", field_type::f32, offsetof(T, skin_color_G), 4, 1, nullptr },
+        { "skin_color_B", field_type::f32, offsetof(T, skin_color_B), 4, 1, nullptr },
+        { "skin_gloss", field_type::f32, offsetof(T, skin_gloss), 4, 1, nullptr },
+        { "skin_pores", field_type::f32, offsetof(T, skin_pores), 4, 1, nullptr },
+        { "face_beard", field_type::f32, offsetof(T, face_beard), 4, 1, nullptr },
+        { "face_aroundEye", field_type::f32, offsetof(T, face_aroundEye), 4, 1, nullptr },
+        { "face_aroundEyeColor_R", field_type::f32, offsetof(T, face_aroundEyeColor_R), 4, 1, nullptr },
+        { "face_aroundEyeColor_G", field_type::f32, offsetof(T, face_aroundEyeColor_G), 4, 1, nullptr },
+        { "face_aroundEyeColor_B", field_type::f32, offsetof(T, face_aroundEyeColor_B), 4, 1, nullptr },
+        { "face_cheek", field_type::f32, offsetof(T, face_cheek), 4, 1, nullptr },
+        { "face_cheekColor_R", field_type::f32, offsetof(T, face_cheekColor_R), 4, 1, nullptr },
+        { "face_cheekColor_G", field_type::f32, offsetof(T, face_cheekColor_G), 4, 1, nullptr },
+        { "face_cheekColor_B", field_type::f32, offsetof(T, face_cheekColor_B), 4, 1, nullptr },
+        { "face_eyeLine", field_type::f32, offsetof(T, face_eyeLine), 4, 1, nullptr },
+        { "face_eyeLineColor_R", field_type::f32, offsetof(T, face_eyeLineColor_R), 4, 1, nullptr },
+        { "face_eyeLineColor_G", field_type::f32, offsetof(T, face_eyeLineColor_G), 4, 1, nullptr },
+        { "face_eyeLineColor_B", field_type::f32, offsetof(T, face_eyeLineColor_B), 4, 1, nullptr },
+        { "face_eyeShadowDown", field_type::f32, offsetof(T, face_eyeShadowDown), 4, 1, nullptr },
+        { "face_eyeShadowDownColor_R", field_type::f32, offsetof(T, face_eyeShadowDownColor_R), 4, 1, nullptr },
+        { "face_eyeShadowDownColor_G", field_type::f32, offsetof(T, face_eyeShadowDownColor_G), 4, 1, nullptr },
+        { "face_eyeShadowDownColor_B", field_type::f32, offsetof(T, face_eyeShadowDownColor_B), 4, 1, nullptr },
+        { "face_eyeShadowUp", field_type::f32, offsetof(T, face_eyeShadowUp), 4, 1, nullptr },
+        { "face_eyeShadowUpColor_R", field_type::f32, offsetof(T, face_eyeShadowUpColor_R), 4, 1, nullptr },
+        { "face_eyeShadowUpColor_G", field_type::f32, offsetof(T, face_eyeShadowUpColor_G), 4, 1, nullptr },
+        { "face_eyeShadowUpColor_B", field_type::f32, offsetof(T, face_eyeShadowUpColor_B), 4, 1, nullptr },
+        { "face_lip", field_type::f32, offsetof(T, face_lip), 4, 1, nullptr },
+        { "face_lipColor_R", field_type::f32, offsetof(T, face_lipColor_R), 4, 1, nullptr },
+        { "face_lipColor_G", field_type::f32, offsetof(T, face_lipColor_G), 4, 1, nullptr },
+        { "face_lipColor_B", field_type::f32, offsetof(T, face_lipColor_B), 4, 1, nullptr },
+        { "body_hair", field_type::f32, offsetof(T, body_hair), 4, 1, nullptr },
+        { "body_hairColor_R", field_type::f32, offsetof(T, body_hairColor_R), 4, 1, nullptr },
+        { "body_hairColor_G", field_type::f32, offsetof(T, body_hairColor_G), 4, 1, nullptr },
+        { "body_hairColor_B", field_type::f32, offsetof(T, body_hairColor_B), 4, 1, nullptr },
+        { "eye_partsId", field_type::f32, offsetof(T, eye_partsId), 4, 1, nullptr },
+        { "eyeR_irisColor_R", field_type::f32, offsetof(T, eyeR_irisColor_R), 4, 1, nullptr },
+        { "eyeR_irisColor_G", field_type::f32, offsetof(T, eyeR_irisColor_G), 4, 1, nullptr },
+        { "eyeR_irisColor_B", field_type::f32, offsetof(T, eyeR_irisColor_B), 4, 1, nullptr },
+        { "eyeR_irisScale", field_type::f32, offsetof(T, eyeR_irisScale), 4, 1, nullptr },
+        { "eyeR_cataract", field_type::f32, offsetof(T, eyeR_cataract), 4, 1, nullptr },
+        { "eyeR_cataractColor_R", field_type::f32, offsetof(T, eyeR_cataractColor_R), 4, 1, nullptr },
+        { "eyeR_cataractColor_G", field_type::f32, offsetof(T, eyeR_cataractColor_G), 4, 1, nullptr },
+        { "eyeR_cataractColor_B", field_type::f32, offsetof(T, eyeR_cataractColor_B), 4, 1, nullptr },
+        { "eyeR_scleraColor_R", field_type::f32, offsetof(T, eyeR_scleraColor_R), 4, 1, nullptr },
+        { "eyeR_scleraColor_G", field_type::f32, offsetof(T, eyeR_scleraColor_G), 4, 1, nullptr },
+        { "eyeR_scleraColor_B", field_type::f32, offsetof(T, eyeR_scleraColor_B), 4, 1, nullptr },
+        { "eyeR_irisDistance", field_type::f32, offsetof(T, eyeR_irisDistance), 4, 1, nullptr },
+        { "eyeL_irisColor_R", field_type::f32, offsetof(T, eyeL_irisColor_R), 4, 1, nullptr },
+        { "eyeL_irisColor_G", field_type::f32, offsetof(T, eyeL_irisColor_G), 4, 1, nullptr },
+        { "eyeL_irisColor_B", field_type::f32, offsetof(T, eyeL_irisColor_B), 4, 1, nullptr },
+        { "eyeL_irisScale", field_type::f32, offsetof(T, eyeL_irisScale), 4, 1, nullptr },
+        { "eyeL_cataract", field_type::f32, offsetof(T, eyeL_cataract), 4, 1, nullptr },
+        { "eyeL_cataractColor_R", field_type::f32, offsetof(T, eyeL_cataractColor_R), 4, 1, nullptr },
+        { "eyeL_cataractColor_G", field_type::f32, offsetof(T, eyeL_cataractColor_G), 4, 1, nullptr },
+        { "eyeL_cataractColor_B", field_type::f32, offsetof(T, eyeL_cataractColor_B), 4, 1, nullptr },
+        { "eyeL_scleraColor_R", field_type::f32, offsetof(T, eyeL_scleraColor_R), 4, 1, nullptr },
+        { "eyeL_scleraColor_G", field_type::f32, offsetof(T, eyeL_scleraColor_G), 4, 1, nullptr },
+        { "eyeL_scleraColor_B", field_type::f32, offsetof(T, eyeL_scleraColor_B), 4, 1, nullptr },
+        { "eyeL_irisDistance", field_type::f32, offsetof(T, eyeL_irisDistance), 4, 1, nullptr },
+        { "hair_partsId", field_type::f32, offsetof(T, hair_partsId), 4, 1, nullptr },
+        { "hair_color_R", field_type::f32, offsetof(T, hair_color_R), 4, 1, nullptr },
+        { "hair_color_G", field_type::f32, offsetof(T, hair_color_G), 4, 1, nullptr },
+        { "hair_color_B", field_type::f32, offsetof(T, hair_color_B), 4, 1, nullptr },
+        { "hair_shininess", field_type::f32, offsetof(T, hair_shininess), 4, 1, nullptr },
+        { "hair_rootBlack", field_type::f32, offsetof(T, hair_rootBlack), 4, 1, nullptr },
+        { "hair_whiteDensity", field_type::f32, offsetof(T, hair_whiteDensity), 4, 1, nullptr },
+        { "beard_partsId", field_type::f32, offsetof(T, beard_partsId), 4, 1, nullptr },
+        { "beard_color_R", field_type::f32, offsetof(T, beard_color_R), 4, 1, nullptr },
+        { "beard_color_G", field_type::f32, offsetof(T, beard_color_G), 4, 1, nullptr },
+        { "beard_color_B", field_type::f32, offsetof(T, beard_color_B), 4, 1, nullptr },
+        { "beard_shininess", field_type::f32, offsetof(T, beard_shininess), 4, 1, nullptr },
+        { "beard_rootBlack", field_type::f32, offsetof(T, beard_rootBlack), 4, 1, nullptr },
+        { "beard_whiteDensity", field_type::f32, offsetof(T, beard_whiteDensity), 4, 1, nullptr },
+        { "eyebrow_partsId", field_type::f32, offsetof(T, eyebrow_partsId), 4, 1, nullptr },
+        { "eyebrow_color_R", field_type::f32, offsetof(T, eyebrow_color_R), 4, 1, nullptr },
+        { "eyebrow_color_G", field_type::f32, offsetof(T, eyebrow_color_G), 4, 1, nullptr },
+        { "eyebrow_color_B", field_type::f32, offsetof(T, eyebrow_color_B), 4, 1, nullptr },
+        { "eyebrow_shininess", field_type::f32, offsetof(T, eyebrow_shininess), 4, 1, nullptr },
+        { "eyebrow_rootBlack", field_type::f32, offsetof(T, eyebrow_rootBlack), 4, 1, nullptr },
+        { "eyebrow_whiteDensity", field_type::f32, offsetof(T, eyebrow_whiteDensity), 4, 1, nullptr },
+        { "eyelash_partsId", field_type::f32, offsetof(T, eyelash_partsId), 4, 1, nullptr },
+        { "eyelash_color_R", field_type::f32, offsetof(T, eyelash_color_R), 4, 1, nullptr },
+        { "eyelash_color_G", field_type::f32, offsetof(T, eyelash_color_G), 4, 1, nullptr },
+        { "eyelash_color_B", field_type::f32, offsetof(T, eyelash_color_B), 4, 1, nullptr },
+        { "accessories_partsId", field_type::f32, offsetof(T, accessories_partsId), 4, 1, nullptr },
+        { "accessories_color_R", field_type::f32, offsetof(T, accessories_color_R), 4, 1, nullptr },
+        { "accessories_color_G", field_type::f32, offsetof(T, accessories_color_G), 4, 1, nullptr },
+        { "accessories_color_B", field_type::f32, offsetof(T, accessories_color_B), 4, 1, nullptr },
+        { "decal_partsId", field_type::f32, offsetof(T, decal_partsId), 4, 1, nullptr },
+        { "decal_posX", field_type::f32, offsetof(T, decal_posX), 4, 1, nullptr },
+        { "decal_posY", field_type::f32, offsetof(T, decal_posY), 4, 1, nullptr },
+        { "decal_angle", field_type::f32, offsetof(T, decal_angle), 4, 1, nullptr },
+        { "decal_scale", field_type::f32, offsetof(T, decal_scale), 4, 1, nullptr },
+        { "decal_color_R", field_type::f32, offsetof(T, decal_color_R), 4, 1, nullptr },
+        { "decal_color_G", field_type::f32, offsetof(T, decal_color_G), 4, 1, nullptr },
+        { "decal_color_B", field_type::f32, offsetof(T, decal_color_B), 4, 1, nullptr },
+        { "decal_gloss", field_type::f32, offsetof(T, decal_gloss), 4, 1, nullptr },
+        { "decal_mirror", field_type::f32, offsetof(T, decal_mirror), 4, 1, nullptr },
+        { "chrBodyScaleHead", field_type::f32, offsetof(T, chrBodyScaleHead), 4, 1, nullptr },
+        { "chrBodyScaleBreast", field_type::f32, offsetof(T, chrBodyScaleBreast), 4, 1, nullptr },
+        { "chrBodyScaleAbdomen", field_type::f32, offsetof(T, chrBodyScaleAbdomen), 4, 1, nullptr },
+        { "chrBodyScaleArm", field_type::f32, offsetof(T, chrBodyScaleArm), 4, 1, nullptr },
+        { "chrBodyScaleLeg", field_type::f32, offsetof(T, chrBodyScaleLeg), 4, 1, nullptr },
+        { "age", field_type::f32, offsetof(T, age), 4, 1, nullptr },
+        { "gender", field_type::f32, offsetof(T, gender), 4, 1, nullptr },
+        { "caricatureGeometry", field_type::f32, offsetof(T, caricatureGeometry), 4, 1, nullptr },
+        { "caricatureTexture", field_type::f32, offsetof(T, caricatureTexture), 4, 1, nullptr },
+        { "faceGeoData00", field_type::f32, offsetof(T, faceGeoData00), 4, 1, nullptr },
+        { "faceGeoData01", field_type::f32, offsetof(T, faceGeoData01), 4, 1, nullptr },
+        { "faceGeoData02", field_type::f32, offsetof(T, faceGeoData02), 4, 1, nullptr },
+        { "faceGeoData03", field_type::f32, offsetof(T, faceGeoData03), 4, 1, nullptr },
+        { "faceGeoData04", field_type::f32, offsetof(T, faceGeoData04), 4, 1, nullptr },
+        { "faceGeoData05", field_type::f32, offsetof(T, faceGeoData05), 4, 1, nullptr },
+        { "faceGeoData06", field_type::f32, offsetof(T, faceGeoData06), 4, 1, nullptr },
+        { "faceGeoData07", field_type::f32, offsetof(T, faceGeoData07), 4, 1, nullptr },
+        { "faceGeoData08", field_type::f32, offsetof(T, faceGeoData08), 4, 1, nullptr },
+        { "faceGeoData09", field_type::f32, offsetof(T, faceGeoData09), 4, 1, nullptr },
+        { "faceGeoData10", field_type::f32, offsetof(T, faceGeoData10), 4, 1, nullptr },
+        { "faceGeoData11", field_type::f32, offsetof(T, faceGeoData11), 4, 1, nullptr },
+        { "faceGeoData12", field_type::f32, offsetof(T, faceGeoData12), 4, 1, nullptr },
+        { "faceGeoData13", field_type::f32, offsetof(T, faceGeoData13), 4, 1, nullptr },
+        { "faceGeoData14", field_type::f32, offsetof(T, faceGeoData14), 4, 1, nullptr },
+        { "faceGeoData15", field_type::f32, offsetof(T, faceGeoData15), 4, 1, nullptr },
+        { "faceGeoData16", field_type::f32, offsetof(T, faceGeoData16), 4, 1, nullptr },
+        { "faceGeoData17", field_type::f32, offsetof(T, faceGeoData17), 4, 1, nullptr },
+        { "faceGeoData18", field_type::f32, offsetof(T, faceGeoData18), 4, 1, nullptr },
+        { "faceGeoData19", field_type::f32, offsetof(T, faceGeoData19), 4, 1, nullptr },
+        { "faceGeoData20", field_type::f32, offsetof(T, faceGeoData20), 4, 1, nullptr },
+        { "faceGeoData21", field_type::f32, offsetof(T, faceGeoData21), 4, 1, nullptr },
+        { "faceGeoData22", field_type::f32, offsetof(T, faceGeoData22), 4, 1, nullptr },
+        { "faceGeoData23", field_type::f32, offsetof(T, faceGeoData23), 4, 1, nullptr },
+        { "faceGeoData24", field_type::f32, offsetof(T, faceGeoData24), 4, 1, nullptr },
+        { "faceGeoData25", field_type::f32, offsetof(T, faceGeoData25), 4, 1, nullptr },
+        { "faceGeoData26", field_type::f32, offsetof(T, faceGeoData26), 4, 1, nullptr },
+        { "faceGeoData27", field_type::f32, offsetof(T, faceGeoData27), 4, 1, nullptr },
+        { "faceGeoData28", field_type::f32, offsetof(T, faceGeoData28), 4, 1, nullptr },
+        { "faceGeoData29", field_type::f32, offsetof(T, faceGeoData29), 4, 1, nullptr },
+        { "faceGeoData30", field_type::f32, offsetof(T, faceGeoData30), 4, 1, nullptr },
+        { "faceGeoData31", field_type::f32, offsetof(T, faceGeoData31), 4, 1, nullptr },
+        { "faceGeoData32", field_type::f32, offsetof(T, faceGeoData32), 4, 1, nullptr },
+        { "faceGeoData33", field_type::f32, offsetof(T, faceGeoData33), 4, 1, nullptr },
+        { "faceGeoData34", field_type::f32, offsetof(T, faceGeoData34), 4, 1, nullptr },
+        { "faceGeoData35", field_type::f32, offsetof(T, faceGeoData35), 4, 1, nullptr },
+        { "faceGeoData36", field_type::f32, offsetof(T, faceGeoData36), 4, 1, nullptr },
+        { "faceGeoData37", field_type::f32, offsetof(T, faceGeoData37), 4, 1, nullptr },
+        { "faceGeoData38", field_type::f32, offsetof(T, faceGeoData38), 4, 1, nullptr },
+        { "faceGeoData39", field_type::f32, offsetof(T, faceGeoData39), 4, 1, nullptr },
+        { "faceGeoData40", field_type::f32, offsetof(T, faceGeoData40), 4, 1, nullptr },
+        { "faceGeoData41", field_type::f32, offsetof(T, faceGeoData41), 4, 1, nullptr },
+        { "faceGeoData42", field_type::f32, offsetof(T, faceGeoData42), 4, 1, nullptr },
+        { "faceGeoData43", field_type::f32, offsetof(T, faceGeoData43), 4, 1, nullptr },
+        { "faceGeoData44", field_type::f32, offsetof(T, faceGeoData44), 4, 1, nullptr },
+        { "faceGeoData45", field_type::f32, offsetof(T, faceGeoData45), 4, 1, nullptr },
+        { "faceGeoData46", field_type::f32, offsetof(T, faceGeoData46), 4, 1, nullptr },
+        { "faceGeoData47", field_type::f32, offsetof(T, faceGeoData47), 4, 1, nullptr },
+        { "faceGeoData48", field_type::f32, offsetof(T, faceGeoData48), 4, 1, nullptr },
+        { "faceGeoData49", field_type::f32, offsetof(T, faceGeoData49), 4, 1, nullptr },
+        { "faceGeoData50", field_type::f32, offsetof(T, faceGeoData50), 4, 1, nullptr },
+        { "faceGeoData51", field_type::f32, offsetof(T, faceGeoData51), 4, 1, nullptr },
+        { "faceGeoData52", field_type::f32, offsetof(T, faceGeoData52), 4, 1, nullptr },
+        { "faceGeoData53", field_type::f32, offsetof(T, faceGeoData53), 4, 1, nullptr },
+        { "faceGeoData54", field_type::f32, offsetof(T, faceGeoData54), 4, 1, nullptr },
+        { "faceGeoData55", field_type::f32, offsetof(T, faceGeoData55), 4, 1, nullptr },
+        { "faceGeoData56", field_type::f32, offsetof(T, faceGeoData56), 4, 1, nullptr },
+        { "faceGeoData57", field_type::f32, offsetof(T, faceGeoData57), 4, 1, nullptr },
+        { "faceGeoData58", field_type::f32, offsetof(T, faceGeoData58), 4, 1, nullptr },
+        { "faceGeoData59", field_type::f32, offsetof(T, faceGeoData59), 4, 1, nullptr },
+        { "faceGeoData60", field_type::f32, offsetof(T, faceGeoData60), 4, 1, nullptr },
+        { "faceTexData00", field_type::f32, offsetof(T, faceTexData00), 4, 1, nullptr },
+        { "faceTexData01", field_type::f32, offsetof(T, faceTexData01), 4, 1, nullptr },
+        { "faceTexData02", field_type::f32, offsetof(T, faceTexData02), 4, 1, nullptr },
+        { "faceTexData03", field_type::f32, offsetof(T, faceTexData03), 4, 1, nullptr },
+        { "faceTexData04", field_type::f32, offsetof(T, faceTexData04), 4, 1, nullptr },
+        { "faceTexData05", field_type::f32, offsetof(T, faceTexData05), 4, 1, nullptr },
+        { "faceTexData06", field_type::f32, offsetof(T, faceTexData06), 4, 1, nullptr },
+        { "faceTexData07", field_type::f32, offsetof(T, faceTexData07), 4, 1, nullptr },
+        { "faceTexData08", field_type::f32, offsetof(T, faceTexData08), 4, 1, nullptr },
+        { "faceTexData09", field_type::f32, offsetof(T, faceTexData09), 4, 1, nullptr },
+        { "faceTexData10", field_type::f32, offsetof(T, faceTexData10), 4, 1, nullptr },
+        { "faceTexData11", field_type::f32, offsetof(T, faceTexData11), 4, 1, nullptr },
+        { "faceTexData12", field_type::f32, offsetof(T, faceTexData12), 4, 1, nullptr },
+        { "faceTexData13", field_type::f32, offsetof(T, faceTexData13), 4, 1, nullptr },
+        { "faceTexData14", field_type::f32, offsetof(T, faceTexData14), 4, 1, nullptr },
+        { "faceTexData15", field_type::f32, offsetof(T, faceTexData15), 4, 1, nullptr },
+        { "faceTexData16", field_type::f32, offsetof(T, faceTexData16), 4, 1, nullptr },
+        { "faceTexData17", field_type::f32, offsetof(T, faceTexData17), 4, 1, nullptr },
+        { "faceTexData18", field_type::f32, offsetof(T, faceTexData18), 4, 1, nullptr },
+        { "faceTexData19", field_type::f32, offsetof(T, faceTexData19), 4, 1, nullptr },
+        { "faceTexData20", field_type::f32, offsetof(T, faceTexData20), 4, 1, nullptr },
+        { "faceTexData21", field_type::f32, offsetof(T, faceTexData21), 4, 1, nullptr },
+        { "faceTexData22", field_type::f32, offsetof(T, faceTexData22), 4, 1, nullptr },
+        { "faceTexData23", field_type::f32, offsetof(T, faceTexData23), 4, 1, nullptr },
+        { "faceTexData24", field_type::f32, offsetof(T, faceTexData24), 4, 1, nullptr },
+        { "faceTexData25", field_type::f32, offsetof(T, faceTexData25), 4, 1, nullptr },
+        { "faceTexData26", field_type::f32, offsetof(T, faceTexData26), 4, 1, nullptr },
+        { "faceTexData27", field_type::f32, offsetof(T, faceTexData27), 4, 1, nullptr },
+        { "faceTexData28", field_type::f32, offsetof(T, faceTexData28), 4, 1, nullptr },
+        { "faceTexData29", field_type::f32, offsetof(T, faceTexData29), 4, 1, nullptr },
+        { "faceTexData30", field_type::f32, offsetof(T, faceTexData30), 4, 1, nullptr },
+        { "faceTexData31", field_type::f32, offsetof(T, faceTexData31), 4, 1, nullptr },
+        { "faceTexData32", field_type::f32, offsetof(T, faceTexData32), 4, 1, nullptr },
+        { "faceTexData33", field_type::f32, offsetof(T, faceTexData33), 4, 1, nullptr },
+        { "faceTexData34", field_type::f32, offsetof(T, faceTexData34), 4, 1, nullptr },
+        { "faceTexData35", field_type::f32, offsetof(T, faceTexData35), 4, 1, nullptr },
+        { "burn_scar", field_type::f32, offsetof(T, burn_scar), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_partsId) == 0);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, skin_color_R) == 4);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, skin_color_G) == 8);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, skin_color_B) == 12);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, skin_gloss) == 16);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, skin_pores) == 20);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_beard) == 24);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_aroundEye) == 28);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_aroundEyeColor_R) == 32);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_aroundEyeColor_G) == 36);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_aroundEyeColor_B) == 40);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_cheek) == 44);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_cheekColor_R) == 48);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_cheekColor_G) == 52);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_cheekColor_B) == 56);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeLine) == 60);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeLineColor_R) == 64);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeLineColor_G) == 68);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeLineColor_B) == 72);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeShadowDown) == 76);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeShadowDownColor_R) == 80);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeShadowDownColor_G) == 84);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeShadowDownColor_B) == 88);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeShadowUp) == 92);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeShadowUpColor_R) == 96);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeShadowUpColor_G) == 100);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_eyeShadowUpColor_B) == 104);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_lip) == 108);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_lipColor_R) == 112);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_lipColor_G) == 116);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, face_lipColor_B) == 120);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, body_hair) == 124);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, body_hairColor_R) == 128);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, body_hairColor_G) == 132);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, body_hairColor_B) == 136);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eye_partsId) == 140);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_irisColor_R) == 144);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_irisColor_G) == 148);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_irisColor_B) == 152);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_irisScale) == 156);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_cataract) == 160);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_cataractColor_R) == 164);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_cataractColor_G) == 168);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_cataractColor_B) == 172);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_scleraColor_R) == 176);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_scleraColor_G) == 180);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_scleraColor_B) == 184);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeR_irisDistance) == 188);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_irisColor_R) == 192);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_irisColor_G) == 196);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_irisColor_B) == 200);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_irisScale) == 204);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_cataract) == 208);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_cataractColor_R) == 212);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_cataractColor_G) == 216);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_cataractColor_B) == 220);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_scleraColor_R) == 224);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_scleraColor_G) == 228);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_scleraColor_B) == 232);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyeL_irisDistance) == 236);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, hair_partsId) == 240);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, hair_color_R) == 244);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, hair_color_G) == 248);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, hair_color_B) == 252);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, hair_shininess) == 256);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, hair_rootBlack) == 260);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, hair_whiteDensity) == 264);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, beard_partsId) == 268);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, beard_color_R) == 272);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, beard_color_G) == 276);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, beard_color_B) == 280);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, beard_shininess) == 284);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, beard_rootBlack) == 288);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, beard_whiteDensity) == 292);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyebrow_partsId) == 296);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyebrow_color_R) == 300);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyebrow_color_G) == 304);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyebrow_color_B) == 308);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyebrow_shininess) == 312);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyebrow_rootBlack) == 316);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyebrow_whiteDensity) == 320);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyelash_partsId) == 324);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyelash_color_R) == 328);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyelash_color_G) == 332);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, eyelash_color_B) == 336);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, accessories_partsId) == 340);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, accessories_color_R) == 344);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, accessories_color_G) == 348);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, accessories_color_B) == 352);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, decal_partsId) == 356);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, decal_posX) == 360);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, decal_posY) == 364);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, decal_angle) == 368);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, decal_scale) == 372);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, decal_color_R) == 376);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, decal_color_G) == 380);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, decal_color_B) == 384);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, decal_gloss) == 388);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, decal_mirror) == 392);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, chrBodyScaleHead) == 396);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, chrBodyScaleBreast) == 400);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, chrBodyScaleAbdomen) == 404);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, chrBodyScaleArm) == 408);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, chrBodyScaleLeg) == 412);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, age) == 416);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, gender) == 420);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, caricatureGeometry) == 424);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, caricatureTexture) == 428);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData00) == 432);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData01) == 436);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData02) == 440);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData03) == 444);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData04) == 448);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData05) == 452);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData06) == 456);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData07) == 460);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData08) == 464);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData09) == 468);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData10) == 472);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData11) == 476);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData12) == 480);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData13) == 484);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData14) == 488);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData15) == 492);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData16) == 496);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData17) == 500);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData18) == 504);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData19) == 508);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData20) == 512);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData21) == 516);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData22) == 520);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData23) == 524);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData24) == 528);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData25) == 532);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData26) == 536);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData27) == 540);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData28) == 544);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData29) == 548);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData30) == 552);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData31) == 556);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData32) == 560);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData33) == 564);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData34) == 568);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData35) == 572);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData36) == 576);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData37) == 580);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData38) == 584);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData39) == 588);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData40) == 592);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData41) == 596);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData42) == 600);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData43) == 604);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData44) == 608);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData45) == 612);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData46) == 616);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData47) == 620);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData48) == 624);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData49) == 628);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData50) == 632);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData51) == 636);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData52) == 640);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData53) == 644);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData54) == 648);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData55) == 652);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData56) == 656);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData57) == 660);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData58) == 664);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData59) == 668);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceGeoData60) == 672);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData00) == 676);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData01) == 680);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData02) == 684);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData03) == 688);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData04) == 692);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData05) == 696);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData06) == 700);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData07) == 704);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData08) == 708);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData09) == 712);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData10) == 716);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData11) == 720);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData12) == 724);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData13) == 728);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData14) == 732);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData15) == 736);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData16) == 740);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData17) == 744);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData18) == 748);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData19) == 752);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData20) == 756);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData21) == 760);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData22) == 764);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData23) == 768);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData24) == 772);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData25) == 776);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData26) == 780);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData27) == 784);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData28) == 788);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData29) == 792);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData30) == 796);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData31) == 800);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData32) == 804);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData33) == 808);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData34) == 812);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, faceTexData35) == 816);
+static_assert(offsetof(paramdef::FACE_RANGE_PARAM_ST, burn_scar) == 820);
+
+}; // namespace params
+}; // namespace from
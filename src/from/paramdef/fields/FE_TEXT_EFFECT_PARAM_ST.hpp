@@ -0,0 +1,34 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../FE_TEXT_EFFECT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::FE_TEXT_EFFECT_PARAM_ST> {
+    using T = paramdef::FE_TEXT_EFFECT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 7> fields = {{
+        { "resId", field_type::s16, offsetof(T, resId), 2, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 2, nullptr },
+        { "textId", field_type::s32, offsetof(T, textId), 4, 1, nullptr },
+        { "seId", field_type::s32, offsetof(T, seId), 4, 1, nullptr },
+        { "canMixMapName", field_type::boolean, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canMixMapName; } },
+        { "pad3", field_type::u8, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad3; } },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 19, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::FE_TEXT_EFFECT_PARAM_ST, resId) == 0);
+static_assert(offsetof(paramdef::FE_TEXT_EFFECT_PARAM_ST, pad1) == 2);
+static_assert(offsetof(paramdef::FE_TEXT_EFFECT_PARAM_ST, textId) == 4);
+static_assert(offsetof(paramdef::FE_TEXT_EFFECT_PARAM_ST, seId) == 8);
+static_assert(offsetof(paramdef::FE_TEXT_EFFECT_PARAM_ST, pad2) == 13);
+
+}; // namespace params
+}; // namespace from
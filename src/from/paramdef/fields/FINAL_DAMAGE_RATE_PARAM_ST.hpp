@@ -0,0 +1,36 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../FINAL_DAMAGE_RATE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::FINAL_DAMAGE_RATE_PARAM_ST> {
+    using T = paramdef::FINAL_DAMAGE_RATE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 7> fields = {{
+        { "physRate", field_type::f32, offsetof(T, physRate), 4, 1, nullptr },
+        { "magRate", field_type::f32, offsetof(T, magRate), 4, 1, nullptr },
+        { "fireRate", field_type::f32, offsetof(T, fireRate), 4, 1, nullptr },
+        { "thunRate", field_type::f32, offsetof(T, thunRate), 4, 1, nullptr },
+        { "darkRate", field_type::f32, offsetof(T, darkRate), 4, 1, nullptr },
+        { "staminaRate", field_type::f32, offsetof(T, staminaRate), 4, 1, nullptr },
+        { "saRate", field_type::f32, offsetof(T, saRate), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::FINAL_DAMAGE_RATE_PARAM_ST, physRate) == 0);
+static_assert(offsetof(paramdef::FINAL_DAMAGE_RATE_PARAM_ST, magRate) == 4);
+static_assert(offsetof(paramdef::FINAL_DAMAGE_RATE_PARAM_ST, fireRate) == 8);
+static_assert(offsetof(paramdef::FINAL_DAMAGE_RATE_PARAM_ST, thunRate) == 12);
+static_assert(offsetof(paramdef::FINAL_DAMAGE_RATE_PARAM_ST, darkRate) == 16);
+static_assert(offsetof(paramdef::FINAL_DAMAGE_RATE_PARAM_ST, staminaRate) == 20);
+static_assert(offsetof(paramdef::FINAL_DAMAGE_RATE_PARAM_ST, saRate) == 24);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,422 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../FOOT_SFX_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::FOOT_SFX_PARAM_ST> {
+    using T = paramdef::FOOT_SFX_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 200> fields = {{
+        { "sfxId_00", field_type::u32, offsetof(T, sfxId_00), 4, 1, nullptr },
+        { "sfxId_01", field_type::u32, offsetof(T, sfxId_01), 4, 1, nullptr },
+        { "sfxId_02", field_type::u32, offsetof(T, sfxId_02), 4, 1, nullptr },
+        { "sfxId_03", field_type::u32, offsetof(T, sfxId_03), 4, 1, nullptr },
+        { "sfxId_04", field_type::u32, offsetof(T, sfxId_04), 4, 1, nullptr },
+        { "sfxId_05", field_type::u32, offsetof(T, sfxId_05), 4, 1, nullptr },
+        { "sfxId_06", field_type::u32, offsetof(T, sfxId_06), 4, 1, nullptr },
+        { "sfxId_07", field_type::u32, offsetof(T, sfxId_07), 4, 1, nullptr },
+        { "sfxId_08", field_type::u32, offsetof(T, sfxId_08), 4, 1, nullptr },
+        { "sfxId_09", field_type::u32, offsetof(T, sfxId_09), 4, 1, nullptr },
+        { "sfxId_10", field_type::u32, offsetof(T, sfxId_10), 4, 1, nullptr },
+        { "sfxId_11", field_type::u32, offsetof(T, sfxId_11), 4, 1, nullptr },
+        { "sfxId_12", field_type::u32, offsetof(T, sfxId_12), 4, 1, nullptr },
+        { "sfxId_13", field_type::u32, offsetof(T, sfxId_13), 4, 1, nullptr },
+        { "sfxId_14", field_type::u32, offsetof(T, sfxId_14), 4, 1, nullptr },
+        { "sfxId_15", field_type::u32, offsetof(T, sfxId_15), 4, 1, nullptr },
+        { "sfxId_16", field_type::u32, offsetof(T, sfxId_16), 4, 1, nullptr },
+        { "sfxId_17", field_type::u32, offsetof(T, sfxId_17), 4, 1, nullptr },
+        { "sfxId_18", field_type::u32, offsetof(T, sfxId_18), 4, 1, nullptr },
+        { "sfxId_19", field_type::u32, offsetof(T, sfxId_19), 4, 1, nullptr },
+        { "sfxId_20", field_type::u32, offsetof(T, sfxId_20), 4, 1, nullptr },
+        { "sfxId_21", field_type::u32, offsetof(T, sfxId_21), 4, 1, nullptr },
+        { "sfxId_22", field_type::u32, offsetof(T, sfxId_22), 4, 1, nullptr },
+        { "sfxId_23", field_type::u32, offsetof(T, sfxId_23), 4, 1, nullptr },
+        { "sfxId_24", field_type::u32, offsetof(T, sfxId_24), 4, 1, nullptr },
+        { "sfxId_25", field_type::u32, offsetof(T, sfxId_25), 4, 1, nullptr },
+        { "sfxId_26", field_type::u32, offsetof(T, sfxId_26), 4, 1, nullptr },
+        { "sfxId_27", field_type::u32, offsetof(T, sfxId_27), 4, 1, nullptr },
+        { "sfxId_28", field_type::u32, offsetof(T, sfxId_28), 4, 1, nullptr },
+        { "sfxId_29", field_type::u32, offsetof(T, sfxId_29), 4, 1, nullptr },
+        { "sfxId_30", field_type::u32, offsetof(T, sfxId_30), 4, 1, nullptr },
+        { "sfxId_31", field_type::u32, offsetof(T, sfxId_31), 4, 1, nullptr },
+        { "sfxId_32", field_type::u32, offsetof(T, sfxId_32), 4, 1, nullptr },
+        { "sfxId_33", field_type::u32, offsetof(T, sfxId_33), 4, 1, nullptr },
+        { "sfxId_34", field_type::u32, offsetof(T, sfxId_34), 4, 1, nullptr },
+        { "sfxId_35", field_type::u32, offsetof(T, sfxId_35), 4, 1, nullptr },
+        { "sfxId_36", field_type::u32, offsetof(T, sfxId_36), 4, 1, nullptr },
+        { "sfxId_37", field_type::u32, offsetof(T, sfxId_37), 4, 1, nullptr },
+        { "sfxId_38", field_type::u32, offsetof(T, sfxId_38), 4, 1, nullptr },
+        { "sfxId_39", field_type::u32, offsetof(T, sfxId_39), 4, 1, nullptr },
+        { "sfxId_40", field_type::u32, offsetof(T, sfxId_40), 4, 1, nullptr },
+        { "sfxId_41", field_type::u32, offsetof(T, sfxId_41), 4, 1, nullptr },
+        { "sfxId_42", field_type::u32, offsetof(T, sfxId_42), 4, 1, nullptr },
+        { "sfxId_43", field_type::u32, offsetof(T, sfxId_43), 4, 1, nullptr },
+        { "sfxId_44", field_type::u32, offsetof(T, sfxId_44), 4, 1, nullptr },
+        { "sfxId_45", field_type::u32, offsetof(T, sfxId_45), 4, 1, nullptr },
+        { "sfxId_46", field_type::u32, offsetof(T, sfxId_46), 4, 1, nullptr },
+        { "sfxId_47", field_type::u32, offsetof(T, sfxId_47), 4, 1, nullptr },
+        { "sfxId_48", field_type::u32, offsetof(T, sfxId_48), 4, 1, nullptr },
+        { "sfxId_49", field_type::u32, offsetof(T, sfxId_49), 4, 1, nullptr },
+        { "sfxId_50", field_type::u32, offsetof(T, sfxId_50), 4, 1, nullptr },
+        { "sfxId_51", field_type::u32, offsetof(T, sfxId_51), 4, 1, nullptr },
+        { "sfxId_52", field_type::u32, offsetof(T, sfxId_52), 4, 1, nullptr },
+        { "sfxId_53", field_type::u32, offsetof(T, sfxId_53), 4, 1, nullptr },
+        { "sfxId_54", field_type::u32, offsetof(T, sfxId_54), 4, 1, nullptr },
+        { "sfxId_55", field_type::u32, offsetof(T, sfxId_55), 4, 1, nullptr },
+        { "sfxId_56", field_type::u32, offsetof(T, sfxId_56), 4, 1, nullptr },
+        { "sfxId_57", field_type::u32, offsetof(T, sfxId_57), 4, 1, nullptr },
+        { "sfxId_58", field_type::u32, offsetof(T, sfxId_58), 4, 1, nullptr },
+        { "sfxId_59", field_type::u32, offsetof(T, sfxId_59), 4, 1, nullptr },
+        { "sfxId_60", field_type::u32, offsetof(T, sfxId_60), 4, 1, nullptr },
+        { "sfxId_61", field_type::u32, offsetof(T, sfxId_61), 4, 1, nullptr },
+        { "sfxId_62", field_type::u32, offsetof(T, sfxId_62), 4, 1, nullptr },
+        { "sfxId_63", field_type::u32, offsetof(T, sfxId_63), 4, 1, nullptr },
+        { "sfxId_64", field_type::u32, offsetof(T, sfxId_64), 4, 1, nullptr },
+        { "sfxId_65", field_type::u32, offsetof(T, sfxId_65), 4, 1, nullptr },
+        { "sfxId_66", field_type::u32, offsetof(T, sfxId_66), 4, 1, nullptr },
+        { "sfxId_67", field_type::u32, offsetof(T, sfxId_67), 4, 1, nullptr },
+        { "sfxId_68", field_type::u32, offsetof(T, sfxId_68), 4, 1, nullptr },
+        { "sfxId_69", field_type::u32, offsetof(T, sfxId_69), 4, 1, nullptr },
+        { "sfxId_70", field_type::u32, offsetof(T, sfxId_70), 4, 1, nullptr },
+        { "sfxId_71", field_type::u32, offsetof(T, sfxId_71), 4, 1, nullptr },
+        { "sfxId_72", field_type::u32, offsetof(T, sfxId_72), 4, 1, nullptr },
+        { "sfxId_73", field_type::u32, offsetof(T, sfxId_73), 4, 1, nullptr },
+        { "sfxId_74", field_type::u32, offsetof(T, sfxId_74), 4, 1, nullptr },
+        { "sfxId_75", field_type::u32, offsetof(T, sfxId_75), 4, 1, nullptr },
+        { "sfxId_76", field_type::u32, offsetof(T, sfxId_76), 4, 1, nullptr },
+        { "sfxId_77", field_type::u32, offsetof(T, sfxId_77), 4, 1, nullptr },
+        { "sfxId_78", field_type::u32, offsetof(T, sfxId_78), 4, 1, nullptr },
+        { "sfxId_79", field_type::u32, offsetof(T, sfxId_79), 4, 1, nullptr },
+        { "sfxId_80", field_type::u32, offsetof(T, sfxId_80), 4, 1, nullptr },
+        { "sfxId_81", field_type::u32, offsetof(T, sfxId_81), 4, 1, nullptr },
+        { "sfxId_82", field_type::u32, offsetof(T, sfxId_82), 4, 1, nullptr },
+        { "sfxId_83", field_type::u32, offsetof(T, sfxId_83), 4, 1, nullptr },
+        { "sfxId_84", field_type::u32, offsetof(T, sfxId_84), 4, 1, nullptr },
+        { "sfxId_85", field_type::u32, offsetof(T, sfxId_85), 4, 1, nullptr },
+        { "sfxId_86", field_type::u32, offsetof(T, sfxId_86), 4, 1, nullptr },
+        { "sfxId_87", field_type::u32, offsetof(T, sfxId_87), 4, 1, nullptr },
+        { "sfxId_88", field_type::u32, offsetof(T, sfxId_88), 4, 1, nullptr },
+        { "sfxId_89", field_type::u32, offsetof(T, sfxId_89), 4, 1, nullptr },
+        { "sfxId_90", field_type::u32, offsetof(T, sfxId_90), 4, 1, nullptr },
+        { "sfxId_91", field_type::u32, offsetof(T, sfxId_91), 4, 1, nullptr },
+        { "sfxId_92", field_type::u32, offsetof(T, sfxId_92), 4, 1, nullptr },
+        { "sfxId_93", field_type::u32, offsetof(T, sfxId_93), 4, 1, nullptr },
+        { "sfxId_94", field_type::u32, offsetof(T, sfxId_94), 4, 1, nullptr },
+        { "sfxId_95", field_type::u32, offsetof(T, sfxId_95), 4, 1, nullptr },
+        { "sfxId_96", field_type::u32, offsetof(T, sfxId_96), 4, 1, nullptr },
+        { "sfxId_97", field_type::u32, offsetof(T, sfxId_97), 4, 1, nullptr },
+        { "sfxId_98", field_type::u32, offsetof(T, sfxId_98), 4, 1, nullptr },
+        { "sfxId_99", field_type::u32, offsetof(T, sfxId_99), 4, 1, nullptr },
+        { "sfxId_100", field_type::u32, offsetof(T, sfxId_100), 4, 1, nullptr },
+        { "sfxId_101", field_type::u32, offsetof(T, sfxId_101), 4, 1, nullptr },
+        { "sfxId_102", field_type::u32, offsetof(T, sfxId_102), 4, 1, nullptr },
+        { "sfxId_103", field_type::u32, offsetof(T, sfxId_103), 4, 1, nullptr },
+        { "sfxId_104", field_type::u32, offsetof(T, sfxId_104), 4, 1, nullptr },
+        { "sfxId_105", field_type::u32, offsetof(T, sfxId_105), 4, 1, nullptr },
+        { "sfxId_106", field_type::u32, offsetof(T, sfxId_106), 4, 1, nullptr },
+        { "sfxId_107", field_type::u32, offsetof(T, sfxId_107), 4, 1, nullptr },
+        { "sfxId_108", field_type::u32, offsetof(T, sfxId_108), 4, 1, nullptr },
+        { "sfxId_109", field_type::u32, offsetof(T, sfxId_109), 4, 1, nullptr },
+        { "sfxId_110", field_type::u32, offsetof(T, sfxId_110), 4, 1, nullptr },
+        { "sfxId_111", field_type::u32, offsetof(T, sfxId_111), 4, 1, nullptr },
+        { "sfxId_112", field_type::u32, offsetof(T, sfxId_112), 4, 1, nullptr },
+        { "sfxId_113", field_type::u32, offsetof(T, sfxId_113), 4, 1, nullptr },
+        { "sfxId_114", field_type::u32, offsetof(T, sfxId_114), 4, 1, nullptr },
+        { "sfxId_115", field_type::u32, offsetof(T, sfxId_115), 4, 1, nullptr },
+        { "sfxId_116", field_type::u32, offsetof(T, sfxId_116), 4, 1, nullptr },
+        { "sfxId_117", field_type::u32, offsetof(T, sfxId_117), 4, 1, nullptr },
+        { "sfxId_118", field_type::u32, offsetof(T, sfxId_118), 4, 1, nullptr },
+        { "sfxId_119", field_type::u32, offsetof(T, sfxId_119), 4, 1, nullptr },
+        { "sfxId_120", field_type::u32, offsetof(T, sfxId_120), 4, 1, nullptr },
+        { "sfxId_121", field_type::u32, offsetof(T, sfxId_121), 4, 1, nullptr },
+        { "sfxId_122", field_type::u32, offsetof(T, sfxId_122), 4, 1, nullptr },
+        { "sfxId_123", field_type::u32, offsetof(T, sfxId_123), 4, 1, nullptr },
+        { "sfxId_124", field_type::u32, offsetof(T, sfxId_124), 4, 1, nullptr },
+        { "sfxId_125", field_type::u32, offsetof(T, sfxId_125), 4, 1, nullptr },
+        { "sfxId_126", field_type::u32, offsetof(T, sfxId_126), 4, 1, nullptr },
+        { "sfxId_127", field_type::u32, offsetof(T, sfxId_127), 4, 1, nullptr },
+        { "sfxId_128", field_type::u32, offsetof(T, sfxId_128), 4, 1, nullptr },
+        { "sfxId_129", field_type::u32, offsetof(T, sfxId_129), 4, 1, nullptr },
+        { "sfxId_130", field_type::u32, offsetof(T, sfxId_130), 4, 1, nullptr },
+        { "sfxId_131", field_type::u32, offsetof(T, sfxId_131), 4, 1, nullptr },
+        { "sfxId_132", field_type::u32, offsetof(T, sfxId_132), 4, 1, nullptr },
+        { "sfxId_133", field_type::u32, offsetof(T, sfxId_133), 4, 1, nullptr },
+        { "sfxId_134", field_type::u32, offsetof(T, sfxId_134), 4, 1, nullptr },
+        { "sfxId_135", field_type::u32, offsetof(T, sfxId_135), 4, 1, nullptr },
+        { "sfxId_136", field_type::u32, offsetof(T, sfxId_136), 4, 1, nullptr },
+        { "sfxId_137", field_type::u32, offsetof(T, sfxId_137), 4, 1, nullptr },
+        { "sfxId_138", field_type::u32, offsetof(T, sfxId_138), 4, 1, nullptr },
+        { "sfxId_139", field_type::u32, offsetof(T, sfxId_139), 4, 1, nullptr },
+        { "sfxId_140", field_type::u32, offsetof(T, sfxId_140), 4, 1, nullptr },
+        { "sfxId_141", field_type::u32, offsetof(T, sfxId_141), 4, 1, nullptr },
+        { "sfxId_142", field_type::u32, offsetof(T, sfxId_142), 4, 1, nullptr },
+        { "sfxId_143", field_type::u32, offsetof(T, sfxId_143), 4, 1, nullptr },
+        { "sfxId_144", field_type::u32, offsetof(T, sfxId_144), 4, 1, nullptr },
+        { "sfxId_145", field_type::u32, offsetof(T, sfxId_145), 4, 1, nullptr },
+        { "sfxId_146", field_type::u32, offsetof(T, sfxId_146), 4, 1, nullptr },
+        { "sfxId_147", field_type::u32, offsetof(T, sfxId_147), 4, 1, nullptr },
+        { "sfxId_148", field_type::u32, offsetof(T, sfxId_148), 4, 1, nullptr },
+        { "sfxId_149", field_type::u32, offsetof(T, sfxId_149), 4, 1, nullptr },
+        { "sfxId_150", field_type::u32, offsetof(T, sfxId_150), 4, 1, nullptr },
+        { "sfxId_151", field_type::u32, offsetof(T, sfxId_151), 4, 1, nullptr },
+        { "sfxId_152", field_type::u32, offsetof(T, sfxId_152), 4, 1, nullptr },
+        { "sfxId_153", field_type::u32, offsetof(T, sfxId_153), 4, 1, nullptr },
+        { "sfxId_154", field_type::u32, offsetof(T, sfxId_154), 4, 1, nullptr },
+        { "sfxId_155", field_type::u32, offsetof(T, sfxId_155), 4, 1, nullptr },
+        { "sfxId_156", field_type::u32, offsetof(T, sfxId_156), 4, 1, nullptr },
+        { "sfxId_157", field_type::u32, offsetof(T, sfxId_157), 4, 1, nullptr },
+        { "sfxId_158", field_type::u32, offsetof(T, sfxId_158), 4, 1, nullptr },
+        { "sfxId_159", field_type::u32, offsetof(T, sfxId_159), 4, 1, nullptr },
+        { "sfxId_160", field_type::u32, offsetof(T, sfxId_160), 4, 1, nullptr },
+        { "sfxId_161", field_type::u32, offsetof(T, sfxId_161), 4, 1, nullptr },
+        { "sfxId_162", field_type::u32, offsetof(T, sfxId_162), 4, 1, nullptr },
+        { "sfxId_163", field_type::u32, offsetof(T, sfxId_163), 4, 1, nullptr },
+        { "sfxId_164", field_type::u32, offsetof(T, sfxId_164), 4, 1, nullptr },
+        { "sfxId_165", field_type::u32, offsetof(T, sfxId_165), 4, 1, nullptr },
+        { "sfxId_166", field_type::u32, offsetof(T, sfxId_166), 4, 1, nullptr },
+        { "sfxId_167", field_type::u32, offsetof(T, sfxId_167), 4, 1, nullptr },
+        { "sfxId_168", field_type::u32, offsetof(T, sfxId_168), 4, 1, nullptr },
+        { "sfxId_169", field_type::u32, offsetof(T, sfxId_169), 4, 1, nullptr },
+        { "sfxId_170", field_type::u32, offsetof(T, sfxId_170), 4, 1, nullptr },
+        { "sfxId_171", field_type::u32, offsetof(T, sfxId_171), 4, 1, nullptr },
+        { "sfxId_172", field_type::u32, offsetof(T, sfxId_172), 4, 1, nullptr },
+        { "sfxId_173", field_type::u32, offsetof(T, sfxId_173), 4, 1, nullptr },
+        { "sfxId_174", field_type::u32, offsetof(T, sfxId_174), 4, 1, nullptr },
+        { "sfxId_175", field_type::u32, offsetof(T, sfxId_175), 4, 1, nullptr },
+        { "sfxId_176", field_type::u32, offsetof(T, sfxId_176), 4, 1, nullptr },
+        { "sfxId_177", field_type::u32, offsetof(T, sfxId_177), 4, 1, nullptr },
+        { "sfxId_178", field_type::u32, offsetof(T, sfxId_178), 4, 1, nullptr },
+        { "sfxId_179", field_type::u32, offsetof(T, sfxId_179), 4, 1, nullptr },
+        { "sfxId_180", field_type::u32, offsetof(T, sfxId_180), 4, 1, nullptr },
+        { "sfxId_181", field_type::u32, offsetof(T, sfxId_181), 4, 1, nullptr },
+        { "sfxId_182", field_type::u32, offsetof(T, sfxId_182), 4, 1, nullptr },
+        { "sfxId_183", field_type::u32, offsetof(T, sfxId_183), 4, 1, nullptr },
+        { "sfxId_184", field_type::u32, offsetof(T, sfxId_184), 4, 1, nullptr },
+        { "sfxId_185", field_type::u32, offsetof(T, sfxId_185), 4, 1, nullptr },
+        { "sfxId_186", field_type::u32, offsetof(T, sfxId_186), 4, 1, nullptr },
+        { "sfxId_187", field_type::u32, offsetof(T, sfxId_187), 4, 1, nullptr },
+        { "sfxId_188", field_type::u32, offsetof(T, sfxId_188), 4, 1, nullptr },
+        { "sfxId_189", field_type::u32, offsetof(T, sfxId_189), 4, 1, nullptr },
+        { "sfxId_190", field_type::u32, offsetof(T, sfxId_190), 4, 1, nullptr },
+        { "sfxId_191", field_type::u32, offsetof(T, sfxId_191), 4, 1, nullptr },
+        { "sfxId_192", field_type::u32, offsetof(T, sfxId_192), 4, 1, nullptr },
+        { "sfxId_193", field_type::u32, offsetof(T, sfxId_193), 4, 1, nullptr },
+        { "sfxId_194", field_type::u32, offsetof(T, sfxId_194), 4, 1, nullptr },
+        { "sfxId_195", field_type::u32, offsetof(T, sfxId_195), 4, 1, nullptr },
+        { "sfxId_196", field_type::u32, offsetof(T, sfxId_196), 4, 1, nullptr },
+        { "sfxId_197", field_type::u32, offsetof(T, sfxId_197), 4, 1, nullptr },
+        { "sfxId_198", field_type::u32, offsetof(T, sfxId_198), 4, 1, nullptr },
+        { "sfxId_199", field_type::u32, offsetof(T, sfxId_199), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_00) == 0);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_01) == 4);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_02) == 8);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_03) == 12);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_04) == 16);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_05) == 20);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_06) == 24);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_07) == 28);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_08) == 32);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_09) == 36);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_10) == 40);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_11) == 44);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_12) == 48);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_13) == 52);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_14) == 56);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_15) == 60);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_16) == 64);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_17) == 68);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_18) == 72);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_19) == 76);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_20) == 80);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_21) == 84);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_22) == 88);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_23) == 92);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_24) == 96);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_25) == 100);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_26) == 104);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_27) == 108);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_28) == 112);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_29) == 116);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_30) == 120);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_31) == 124);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_32) == 128);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_33) == 132);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_34) == 136);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_35) == 140);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_36) == 144);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_37) == 148);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_38) == 152);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_39) == 156);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_40) == 160);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_41) == 164);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_42) == 168);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_43) == 172);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_44) == 176);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_45) == 180);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_46) == 184);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_47) == 188);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_48) == 192);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_49) == 196);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_50) == 200);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_51) == 204);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_52) == 208);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_53) == 212);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_54) == 216);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_55) == 220);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_56) == 224);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_57) == 228);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_58) == 232);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_59) == 236);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_60) == 240);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_61) == 244);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_62) == 248);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_63) == 252);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_64) == 256);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_65) == 260);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_66) == 264);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_67) == 268);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_68) == 272);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_69) == 276);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_70) == 280);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_71) == 284);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_72) == 288);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_73) == 292);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_74) == 296);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_75) == 300);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_76) == 304);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_77) == 308);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_78) == 312);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_79) == 316);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_80) == 320);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_81) == 324);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_82) == 328);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_83) == 332);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_84) == 336);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_85) == 340);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_86) == 344);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_87) == 348);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_88) == 352);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_89) == 356);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_90) == 360);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_91) == 364);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_92) == 368);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_93) == 372);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_94) == 376);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_95) == 380);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_96) == 384);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_97) == 388);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_98) == 392);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_99) == 396);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_100) == 400);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_101) == 404);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_102) == 408);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_103) == 412);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_104) == 416);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_105) == 420);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_106) == 424);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_107) == 428);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_108) == 432);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_109) == 436);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_110) == 440);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_111) == 444);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_112) == 448);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_113) == 452);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_114) == 456);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_115) == 460);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_116) == 464);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_117) == 468);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_118) == 472);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_119) == 476);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_120) == 480);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_121) == 484);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_122) == 488);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_123) == 492);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_124) == 496);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_125) == 500);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_126) == 504);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_127) == 508);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_128) == 512);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_129) == 516);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_130) == 520);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_131) == 524);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_132) == 528);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_133) == 532);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_134) == 536);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_135) == 540);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_136) == 544);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_137) == 548);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_138) == 552);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_139) == 556);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_140) == 560);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_141) == 564);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_142) == 568);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_143) == 572);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_144) == 576);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_145) == 580);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_146) == 584);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_147) == 588);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_148) == 592);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_149) == 596);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_150) == 600);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_151) == 604);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_152) == 608);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_153) == 612);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_154) == 616);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_155) == 620);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_156) == 624);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_157) == 628);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_158) == 632);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_159) == 636);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_160) == 640);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_161) == 644);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_162) == 648);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_163) == 652);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_164) == 656);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_165) == 660);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_166) == 664);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_167) == 668);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_168) == 672);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_169) == 676);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_170) == 680);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_171) == 684);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_172) == 688);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_173) == 692);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_174) == 696);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_175) == 700);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_176) == 704);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_177) == 708);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_178) == 712);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_179) == 716);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_180) == 720);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_181) == 724);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_182) == 728);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_183) == 732);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_184) == 736);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_185) == 740);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_186) == 744);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_187) == 748);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_188) == 752);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_189) == 756);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_190) == 760);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_191) == 764);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_192) == 768);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_193) == 772);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_194) == 776);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_195) == 780);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_196) == 784);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_197) == 788);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_198) == 792);
+static_assert(offsetof(paramdef::FOOT_SFX_PARAM_ST, sfxId_199) == 796);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,84 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../GAME_AREA_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::GAME_AREA_PARAM_ST> {
+    using T = paramdef::GAME_AREA_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 32> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "bonusSoul_single", field_type::u32, offsetof(T, bonusSoul_single), 4, 1, nullptr },
+        { "bonusSoul_multi", field_type::u32, offsetof(T, bonusSoul_multi), 4, 1, nullptr },
+        { "humanityPointCountFlagIdTop", field_type::u32, offsetof(T, humanityPointCountFlagIdTop), 4, 1, nullptr },
+        { "humanityDropPoint1", field_type::u16, offsetof(T, humanityDropPoint1), 2, 1, nullptr },
+        { "humanityDropPoint2", field_type::u16, offsetof(T, humanityDropPoint2), 2, 1, nullptr },
+        { "humanityDropPoint3", field_type::u16, offsetof(T, humanityDropPoint3), 2, 1, nullptr },
+        { "humanityDropPoint4", field_type::u16, offsetof(T, humanityDropPoint4), 2, 1, nullptr },
+        { "humanityDropPoint5", field_type::u16, offsetof(T, humanityDropPoint5), 2, 1, nullptr },
+        { "humanityDropPoint6", field_type::u16, offsetof(T, humanityDropPoint6), 2, 1, nullptr },
+        { "humanityDropPoint7", field_type::u16, offsetof(T, humanityDropPoint7), 2, 1, nullptr },
+        { "humanityDropPoint8", field_type::u16, offsetof(T, humanityDropPoint8), 2, 1, nullptr },
+        { "humanityDropPoint9", field_type::u16, offsetof(T, humanityDropPoint9), 2, 1, nullptr },
+        { "humanityDropPoint10", field_type::u16, offsetof(T, humanityDropPoint10), 2, 1, nullptr },
+        { "soloBreakInPoint_Min", field_type::u32, offsetof(T, soloBreakInPoint_Min), 4, 1, nullptr },
+        { "soloBreakInPoint_Max", field_type::u32, offsetof(T, soloBreakInPoint_Max), 4, 1, nullptr },
+        { "defeatBossFlagId_forSignAimList", field_type::u32, offsetof(T, defeatBossFlagId_forSignAimList), 4, 1, nullptr },
+        { "displayAimFlagId", field_type::u32, offsetof(T, displayAimFlagId), 4, 1, nullptr },
+        { "foundBossFlagId", field_type::u32, offsetof(T, foundBossFlagId), 4, 1, nullptr },
+        { "foundBossTextId", field_type::s32, offsetof(T, foundBossTextId), 4, 1, nullptr },
+        { "notFindBossTextId", field_type::s32, offsetof(T, notFindBossTextId), 4, 1, nullptr },
+        { "bossChallengeFlagId", field_type::u32, offsetof(T, bossChallengeFlagId), 4, 1, nullptr },
+        { "defeatBossFlagId", field_type::u32, offsetof(T, defeatBossFlagId), 4, 1, nullptr },
+        { "bossPosX", field_type::f32, offsetof(T, bossPosX), 4, 1, nullptr },
+        { "bossPosY", field_type::f32, offsetof(T, bossPosY), 4, 1, nullptr },
+        { "bossPosZ", field_type::f32, offsetof(T, bossPosZ), 4, 1, nullptr },
+        { "bossMapAreaNo", field_type::u8, offsetof(T, bossMapAreaNo), 1, 1, nullptr },
+        { "bossMapBlockNo", field_type::u8, offsetof(T, bossMapBlockNo), 1, 1, nullptr },
+        { "bossMapMapNo", field_type::u8, offsetof(T, bossMapMapNo), 1, 1, nullptr },
+        { "reserve", field_type::u8, offsetof(T, reserve), 1, 9, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, bonusSoul_single) == 4);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, bonusSoul_multi) == 8);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityPointCountFlagIdTop) == 12);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityDropPoint1) == 16);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityDropPoint2) == 18);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityDropPoint3) == 20);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityDropPoint4) == 22);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityDropPoint5) == 24);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityDropPoint6) == 26);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityDropPoint7) == 28);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityDropPoint8) == 30);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityDropPoint9) == 32);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, humanityDropPoint10) == 34);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, soloBreakInPoint_Min) == 36);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, soloBreakInPoint_Max) == 40);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, defeatBossFlagId_forSignAimList) == 44);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, displayAimFlagId) == 48);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, foundBossFlagId) == 52);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, foundBossTextId) == 56);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, notFindBossTextId) == 60);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, bossChallengeFlagId) == 64);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, defeatBossFlagId) == 68);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, bossPosX) == 72);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, bossPosY) == 76);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, bossPosZ) == 80);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, bossMapAreaNo) == 84);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, bossMapBlockNo) == 85);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, bossMapMapNo) == 86);
+static_assert(offsetof(paramdef::GAME_AREA_PARAM_ST, reserve) == 87);
+
+}; // namespace params
+}; // namespace from
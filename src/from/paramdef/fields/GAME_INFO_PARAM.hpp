@@ -0,0 +1,34 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../GAME_INFO_PARAM.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::GAME_INFO_PARAM> {
+    using T = paramdef::GAME_INFO_PARAM;
+
+    static constexpr std::array<field_descriptor, 6> fields = {{
+        { "titleMsgId", field_type::s32, offsetof(T, titleMsgId), 4, 1, nullptr },
+        { "contentMsgId", field_type::s32, offsetof(T, contentMsgId), 4, 1, nullptr },
+        { "value", field_type::s32, offsetof(T, value), 4, 1, nullptr },
+        { "sortId", field_type::s32, offsetof(T, sortId), 4, 1, nullptr },
+        { "eventId", field_type::s32, offsetof(T, eventId), 4, 1, nullptr },
+        { "Pad", field_type::u8, offsetof(T, Pad), 1, 12, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::GAME_INFO_PARAM, titleMsgId) == 0);
+static_assert(offsetof(paramdef::GAME_INFO_PARAM, contentMsgId) == 4);
+static_assert(offsetof(paramdef::GAME_INFO_PARAM, value) == 8);
+static_assert(offsetof(paramdef::GAME_INFO_PARAM, sortId) == 12);
+static_assert(offsetof(paramdef::GAME_INFO_PARAM, eventId) == 16);
+static_assert(offsetof(paramdef::GAME_INFO_PARAM, Pad) == 20);
+
+}; // namespace params
+}; // namespace from
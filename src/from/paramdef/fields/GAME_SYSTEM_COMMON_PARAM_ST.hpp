@@ -0,0 +1,620 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../GAME_SYSTEM_COMMON_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::GAME_SYSTEM_COMMON_PARAM_ST> {
+    using T = paramdef::GAME_SYSTEM_COMMON_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 299> fields = {{
+        { "baseToughnessRecoverTime", field_type::f32, offsetof(T, baseToughnessRecoverTime), 4, 1, nullptr },
+        { "chrEventTrun_byLeft90", field_type::s32, offsetof(T, chrEventTrun_byLeft90), 4, 1, nullptr },
+        { "chrEventTrun_byRight90", field_type::s32, offsetof(T, chrEventTrun_byRight90), 4, 1, nullptr },
+        { "chrEventTrun_byLeft180", field_type::s32, offsetof(T, chrEventTrun_byLeft180), 4, 1, nullptr },
+        { "chrEventTrun_byRight180", field_type::s32, offsetof(T, chrEventTrun_byRight180), 4, 1, nullptr },
+        { "chrEventTrun_90TurnStartAngle", field_type::s16, offsetof(T, chrEventTrun_90TurnStartAngle), 2, 1, nullptr },
+        { "chrEventTrun_180TurnStartAngle", field_type::s16, offsetof(T, chrEventTrun_180TurnStartAngle), 2, 1, nullptr },
+        { "stealthAtkDamageRate", field_type::f32, offsetof(T, stealthAtkDamageRate), 4, 1, nullptr },
+        { "flickDamageCutRateSuccessGurad", field_type::f32, offsetof(T, flickDamageCutRateSuccessGurad), 4, 1, nullptr },
+        { "npcTalkAnimBeginDiffAngle", field_type::f32, offsetof(T, npcTalkAnimBeginDiffAngle), 4, 1, nullptr },
+        { "npcTalkAnimEndDiffAngle", field_type::f32, offsetof(T, npcTalkAnimEndDiffAngle), 4, 1, nullptr },
+        { "sleepCollectorItemActionButtonParamId", field_type::s32, offsetof(T, sleepCollectorItemActionButtonParamId), 4, 1, nullptr },
+        { "allowUseBuddyItem_sfxInterval", field_type::f32, offsetof(T, allowUseBuddyItem_sfxInterval), 4, 1, nullptr },
+        { "allowUseBuddyItem_sfxDmyPolyId", field_type::s32, offsetof(T, allowUseBuddyItem_sfxDmyPolyId), 4, 1, nullptr },
+        { "allowUseBuddyItem_sfxDmyPolyId_horse", field_type::s32, offsetof(T, allowUseBuddyItem_sfxDmyPolyId_horse), 4, 1, nullptr },
+        { "allowUseBuddyItem_sfxId", field_type::s32, offsetof(T, allowUseBuddyItem_sfxId), 4, 1, nullptr },
+        { "onBuddySummon_inActivateRange_sfxInterval", field_type::f32, offsetof(T, onBuddySummon_inActivateRange_sfxInterval), 4, 1, nullptr },
+        { "onBuddySummon_inActivateRange_sfxDmyPolyId", field_type::s32, offsetof(T, onBuddySummon_inActivateRange_sfxDmyPolyId), 4, 1, nullptr },
+        { "onBuddySummon_inActivateRange_sfxDmyPolyId_horse", field_type::s32, offsetof(T, onBuddySummon_inActivateRange_sfxDmyPolyId_horse), 4, 1, nullptr },
+        { "onBuddySummon_inActivateRange_sfxId", field_type::s32, offsetof(T, onBuddySummon_inActivateRange_sfxId), 4, 1, nullptr },
+        { "onBuddySummon_inActivateRange_spEffectId_pc", field_type::s32, offsetof(T, onBuddySummon_inActivateRange_spEffectId_pc), 4, 1, nullptr },
+        { "onBuddySummon_inWarnRange_spEffectId_pc", field_type::s32, offsetof(T, onBuddySummon_inWarnRange_spEffectId_pc), 4, 1, nullptr },
+        { "onBuddySummon_atBuddyUnsummon_spEffectId_pc", field_type::s32, offsetof(T, onBuddySummon_atBuddyUnsummon_spEffectId_pc), 4, 1, nullptr },
+        { "onBuddySummon_inWarnRange_spEffectId_buddy", field_type::s32, offsetof(T, onBuddySummon_inWarnRange_spEffectId_buddy), 4, 1, nullptr },
+        { "morningIngameHour", field_type::u8, offsetof(T, morningIngameHour), 1, 1, nullptr },
+        { "morningIngameMinute", field_type::u8, offsetof(T, morningIngameMinute), 1, 1, nullptr },
+        { "morningIngameSecond", field_type::u8, offsetof(T, morningIngameSecond), 1, 1, nullptr },
+        { "noonIngameHour", field_type::u8, offsetof(T, noonIngameHour), 1, 1, nullptr },
+        { "noonIngameMinute", field_type::u8, offsetof(T, noonIngameMinute), 1, 1, nullptr },
+        { "noonIngameSecond", field_type::u8, offsetof(T, noonIngameSecond), 1, 1, nullptr },
+        { "nightIngameHour", field_type::u8, offsetof(T, nightIngameHour), 1, 1, nullptr },
+        { "nightIngameMinute", field_type::u8, offsetof(T, nightIngameMinute), 1, 1, nullptr },
+        { "nightIngameSecond", field_type::u8, offsetof(T, nightIngameSecond), 1, 1, nullptr },
+        { "aiSightRateStart_Morning_Hour", field_type::u8, offsetof(T, aiSightRateStart_Morning_Hour), 1, 1, nullptr },
+        { "aiSightRateStart_Morning_Minute", field_type::u8, offsetof(T, aiSightRateStart_Morning_Minute), 1, 1, nullptr },
+        { "aiSightRateStart_Noon_Hour", field_type::u8, offsetof(T, aiSightRateStart_Noon_Hour), 1, 1, nullptr },
+        { "aiSightRateStart_Noon_Minute", field_type::u8, offsetof(T, aiSightRateStart_Noon_Minute), 1, 1, nullptr },
+        { "aiSightRateStart_Evening_Hour", field_type::u8, offsetof(T, aiSightRateStart_Evening_Hour), 1, 1, nullptr },
+        { "aiSightRateStart_Evening_Minute", field_type::u8, offsetof(T, aiSightRateStart_Evening_Minute), 1, 1, nullptr },
+        { "aiSightRateStart_Night_Hour", field_type::u8, offsetof(T, aiSightRateStart_Night_Hour), 1, 1, nullptr },
+        { "aiSightRateStart_Night_Minute", field_type::u8, offsetof(T, aiSightRateStart_Night_Minute), 1, 1, nullptr },
+        { "aiSightRateStart_Midnight_Hour", field_type::u8, offsetof(T, aiSightRateStart_Midnight_Hour), 1, 1, nullptr },
+        { "aiSightRateStart_Midnight_Minute", field_type::u8, offsetof(T, aiSightRateStart_Midnight_Minute), 1, 1, nullptr },
+        { "saLargeDamageHitSfx_Threshold", field_type::u8, offsetof(T, saLargeDamageHitSfx_Threshold), 1, 1, nullptr },
+        { "saLargeDamageHitSfx_SfxId", field_type::s32, offsetof(T, saLargeDamageHitSfx_SfxId), 4, 1, nullptr },
+        { "signCreatableDistFromSafePos", field_type::f32, offsetof(T, signCreatableDistFromSafePos), 4, 1, nullptr },
+        { "guestResummonDist", field_type::f32, offsetof(T, guestResummonDist), 4, 1, nullptr },
+        { "guestLeavingMessageDistMax", field_type::f32, offsetof(T, guestLeavingMessageDistMax), 4, 1, nullptr },
+        { "guestLeavingMessageDistMin", field_type::f32, offsetof(T, guestLeavingMessageDistMin), 4, 1, nullptr },
+        { "guestLeaveSessionDist", field_type::f32, offsetof(T, guestLeaveSessionDist), 4, 1, nullptr },
+        { "retryPointAreaRadius", field_type::f32, offsetof(T, retryPointAreaRadius), 4, 1, nullptr },
+        { "sleepCollectorSpEffectId", field_type::s32, offsetof(T, sleepCollectorSpEffectId), 4, 1, nullptr },
+        { "recoverBelowMaxHpCompletionNoticeSpEffectId", field_type::s32, offsetof(T, recoverBelowMaxHpCompletionNoticeSpEffectId), 4, 1, nullptr },
+        { "estusFlaskRecovery_AbsorptionProductionSfxId_byHp", field_type::s32, offsetof(T, estusFlaskRecovery_AbsorptionProductionSfxId_byHp), 4, 1, nullptr },
+        { "estusFlaskRecovery_AbsorptionProductionSfxId_byMp", field_type::s32, offsetof(T, estusFlaskRecovery_AbsorptionProductionSfxId_byMp), 4, 1, nullptr },
+        { "respawnSpecialEffectActiveCheckerSpEffectId", field_type::s32, offsetof(T, respawnSpecialEffectActiveCheckerSpEffectId), 4, 1, nullptr },
+        { "onBuddySummon_inActivateRange_spEffectId_buddy", field_type::s32, offsetof(T, onBuddySummon_inActivateRange_spEffectId_buddy), 4, 1, nullptr },
+        { "estusFlaskRecovery_AddEstusTime", field_type::f32, offsetof(T, estusFlaskRecovery_AddEstusTime), 4, 1, nullptr },
+        { "defeatMultiModeEnemyOfSoulCorrectRate_byHost", field_type::f32, offsetof(T, defeatMultiModeEnemyOfSoulCorrectRate_byHost), 4, 1, nullptr },
+        { "defeatMultiModeEnemyOfSoulCorrectRate_byTeamGhost", field_type::f32, offsetof(T, defeatMultiModeEnemyOfSoulCorrectRate_byTeamGhost), 4, 1, nullptr },
+        { "defeatMultiModeBossOfSoulCorrectRate_byHost", field_type::f32, offsetof(T, defeatMultiModeBossOfSoulCorrectRate_byHost), 4, 1, nullptr },
+        { "defeatMultiModeBossOfSoulCorrectRate_byTeamGhost", field_type::f32, offsetof(T, defeatMultiModeBossOfSoulCorrectRate_byTeamGhost), 4, 1, nullptr },
+        { "enemyHpGaugeScreenOffset_byUp", field_type::u16, offsetof(T, enemyHpGaugeScreenOffset_byUp), 2, 1, nullptr },
+        { "playRegionCollectDist", field_type::u16, offsetof(T, playRegionCollectDist), 2, 1, nullptr },
+        { "enemyDetectionSpEffect_ShootBulletDummypolyId", field_type::u16, offsetof(T, enemyDetectionSpEffect_ShootBulletDummypolyId), 2, 1, nullptr },
+        { "bigRuneGreaterDemonBreakInGoodsNum", field_type::u16, offsetof(T, bigRuneGreaterDemonBreakInGoodsNum), 2, 1, nullptr },
+        { "bigRuneGreaterDemonBreakInGoodsId", field_type::s32, offsetof(T, bigRuneGreaterDemonBreakInGoodsId), 4, 1, nullptr },
+        { "rideJumpRegionDefaultSfxId", field_type::s32, offsetof(T, rideJumpRegionDefaultSfxId), 4, 1, nullptr },
+        { "saAttackRate_forVsRideAtk", field_type::f32, offsetof(T, saAttackRate_forVsRideAtk), 4, 1, nullptr },
+        { "enemySpEffectIdAfterSleepCollectorItemLot", field_type::s32, offsetof(T, enemySpEffectIdAfterSleepCollectorItemLot), 4, 1, nullptr },
+        { "afterEndingMapUid", field_type::s32, offsetof(T, afterEndingMapUid), 4, 1, nullptr },
+        { "afterEndingReturnPointEntityId", field_type::u32, offsetof(T, afterEndingReturnPointEntityId), 4, 1, nullptr },
+        { "enemyDetectionSpEffect_BulletId_byCoopRing_RedHunter", field_type::s32, offsetof(T, enemyDetectionSpEffect_BulletId_byCoopRing_RedHunter), 4, 1, nullptr },
+        { "enemyDetectionSpEffect_BulletId_byInvadeOrb_None", field_type::s32, offsetof(T, enemyDetectionSpEffect_BulletId_byInvadeOrb_None), 4, 1, nullptr },
+        { "tutorialFlagOnAccessDistView", field_type::u32, offsetof(T, tutorialFlagOnAccessDistView), 4, 1, nullptr },
+        { "tutorialFlagOnAccessRetryPoint", field_type::u32, offsetof(T, tutorialFlagOnAccessRetryPoint), 4, 1, nullptr },
+        { "tutorialFlagOnGetGroupReward", field_type::u32, offsetof(T, tutorialFlagOnGetGroupReward), 4, 1, nullptr },
+        { "tutorialFlagOnEnterRideJumpRegion", field_type::u32, offsetof(T, tutorialFlagOnEnterRideJumpRegion), 4, 1, nullptr },
+        { "tutorialCheckRideJumpRegionExpandRange", field_type::f32, offsetof(T, tutorialCheckRideJumpRegionExpandRange), 4, 1, nullptr },
+        { "retryPointActivatedPcAnimId", field_type::s32, offsetof(T, retryPointActivatedPcAnimId), 4, 1, nullptr },
+        { "retryPointActivatedDialogDelayTime", field_type::f32, offsetof(T, retryPointActivatedDialogDelayTime), 4, 1, nullptr },
+        { "retryPointActivatedDialogTextId", field_type::s32, offsetof(T, retryPointActivatedDialogTextId), 4, 1, nullptr },
+        { "signPuddleOpenPcAnimId", field_type::s32, offsetof(T, signPuddleOpenPcAnimId), 4, 1, nullptr },
+        { "signPuddleOpenDialogDelayTime", field_type::f32, offsetof(T, signPuddleOpenDialogDelayTime), 4, 1, nullptr },
+        { "activityOfDeadSpEffect_BulletId", field_type::s32, offsetof(T, activityOfDeadSpEffect_BulletId), 4, 1, nullptr },
+        { "activityOfDeadSpEffect_ShootBulletDummypolyId", field_type::s32, offsetof(T, activityOfDeadSpEffect_ShootBulletDummypolyId), 4, 1, nullptr },
+        { "activityOfDeadSpEffect_DeadFadeOutTime", field_type::f32, offsetof(T, activityOfDeadSpEffect_DeadFadeOutTime), 4, 1, nullptr },
+        { "ignorNetStateSyncTime_ForThrow", field_type::f32, offsetof(T, ignorNetStateSyncTime_ForThrow), 4, 1, nullptr },
+        { "netPenaltyPointLanDisconnect", field_type::u16, offsetof(T, netPenaltyPointLanDisconnect), 2, 1, nullptr },
+        { "netPenaltyPointProfileSignout", field_type::u16, offsetof(T, netPenaltyPointProfileSignout), 2, 1, nullptr },
+        { "netPenaltyPointReboot", field_type::u16, offsetof(T, netPenaltyPointReboot), 2, 1, nullptr },
+        { "netPnaltyPointSuspend", field_type::u16, offsetof(T, netPnaltyPointSuspend), 2, 1, nullptr },
+        { "netPenaltyForgiveItemLimitTime", field_type::f32, offsetof(T, netPenaltyForgiveItemLimitTime), 4, 1, nullptr },
+        { "netPenaltyPointThreshold", field_type::u16, offsetof(T, netPenaltyPointThreshold), 2, 1, nullptr },
+        { "uncontrolledMoveThresholdTime", field_type::u16, offsetof(T, uncontrolledMoveThresholdTime), 2, 1, nullptr },
+        { "enemyDetectionSpEffect_BulletId_byNpcEnemy", field_type::s32, offsetof(T, enemyDetectionSpEffect_BulletId_byNpcEnemy), 4, 1, nullptr },
+        { "activityOfDeadTargetSearchSpEffect_OnHitSpEffect", field_type::s32, offsetof(T, activityOfDeadTargetSearchSpEffect_OnHitSpEffect), 4, 1, nullptr },
+        { "activityOfDeadTargetSearchSpEffect_MaxLength", field_type::f32, offsetof(T, activityOfDeadTargetSearchSpEffect_MaxLength), 4, 1, nullptr },
+        { "sightRangeLowerPromiseRate", field_type::f32, offsetof(T, sightRangeLowerPromiseRate), 4, 1, nullptr },
+        { "saLargeDamageHitSfx_MinDamage", field_type::s16, offsetof(T, saLargeDamageHitSfx_MinDamage), 2, 1, nullptr },
+        { "saLargeDamageHitSfx_ForceDamage", field_type::s16, offsetof(T, saLargeDamageHitSfx_ForceDamage), 2, 1, nullptr },
+        { "soloBreakInMaxPoint", field_type::u32, offsetof(T, soloBreakInMaxPoint), 4, 1, nullptr },
+        { "npcTalkTimeOutThreshold", field_type::f32, offsetof(T, npcTalkTimeOutThreshold), 4, 1, nullptr },
+        { "sendPlayLogIntervalTime", field_type::f32, offsetof(T, sendPlayLogIntervalTime), 4, 1, nullptr },
+        { "item370_MaxSfxNum", field_type::u8, offsetof(T, item370_MaxSfxNum), 1, 1, nullptr },
+        { "chrActivateDist_forLeavePC", field_type::u8, offsetof(T, chrActivateDist_forLeavePC), 1, 1, nullptr },
+        { "summonDataCoopMatchingLevelUpperAbs", field_type::s16, offsetof(T, summonDataCoopMatchingLevelUpperAbs), 2, 1, nullptr },
+        { "summonDataCoopMatchingLevelUpperRel", field_type::s16, offsetof(T, summonDataCoopMatchingLevelUpperRel), 2, 1, nullptr },
+        { "summonDataCoopMatchingWepLevelMul", field_type::s16, offsetof(T, summonDataCoopMatchingWepLevelMul), 2, 1, nullptr },
+        { "pickUpBerserkerSignSpEffectBulletId", field_type::s32, offsetof(T, pickUpBerserkerSignSpEffectBulletId), 4, 1, nullptr },
+        { "succeedBerserkerSelfKillingEffectId", field_type::s32, offsetof(T, succeedBerserkerSelfKillingEffectId), 4, 1, nullptr },
+        { "machingLevelWhiteSignUpperRel", field_type::u8, offsetof(T, machingLevelWhiteSignUpperRel), 1, 1, nullptr },
+        { "machingLevelWhiteSignUpperAbs", field_type::u8, offsetof(T, machingLevelWhiteSignUpperAbs), 1, 1, nullptr },
+        { "machingLevelRedSignUpperRel", field_type::u8, offsetof(T, machingLevelRedSignUpperRel), 1, 1, nullptr },
+        { "machingLevelRedSignUpperAbs", field_type::u8, offsetof(T, machingLevelRedSignUpperAbs), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_0", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_0), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_1", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_1), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_2", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_2), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_3", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_3), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_4", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_4), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_5", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_5), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_6", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_6), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_7", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_7), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_8", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_8), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_9", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_9), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_10", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_10), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_0", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_0), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_1", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_1), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_2", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_2), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_3", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_3), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_4", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_4), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_5", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_5), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_6", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_6), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_7", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_7), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_8", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_8), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_9", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_9), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_10", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_10), 1, 1, nullptr },
+        { "autoInvadePoint_generateDist", field_type::u8, offsetof(T, autoInvadePoint_generateDist), 1, 1, nullptr },
+        { "autoInvadePoint_cancelDist", field_type::u8, offsetof(T, autoInvadePoint_cancelDist), 1, 1, nullptr },
+        { "sendGlobalEventLogIntervalTime", field_type::f32, offsetof(T, sendGlobalEventLogIntervalTime), 4, 1, nullptr },
+        { "addSoloBreakInPoint_White", field_type::u16, offsetof(T, addSoloBreakInPoint_White), 2, 1, nullptr },
+        { "addSoloBreakInPoint_Black", field_type::u16, offsetof(T, addSoloBreakInPoint_Black), 2, 1, nullptr },
+        { "addSoloBreakInPoint_ForceJoin", field_type::u16, offsetof(T, addSoloBreakInPoint_ForceJoin), 2, 1, nullptr },
+        { "addSoloBreakInPoint_VisitorGuardian", field_type::u16, offsetof(T, addSoloBreakInPoint_VisitorGuardian), 2, 1, nullptr },
+        { "addSoloBreakInPoint_VisitorRedHunter", field_type::u16, offsetof(T, addSoloBreakInPoint_VisitorRedHunter), 2, 1, nullptr },
+        { "invincibleTimer_forNetPC_initSync", field_type::u8, offsetof(T, invincibleTimer_forNetPC_initSync), 1, 1, nullptr },
+        { "invincibleTimer_forNetPC", field_type::u8, offsetof(T, invincibleTimer_forNetPC), 1, 1, nullptr },
+        { "redHunter_HostBossAreaGetSoulRate", field_type::f32, offsetof(T, redHunter_HostBossAreaGetSoulRate), 4, 1, nullptr },
+        { "ghostFootprintDecalParamId", field_type::s32, offsetof(T, ghostFootprintDecalParamId), 4, 1, nullptr },
+        { "leaveAroundHostWarningTime", field_type::f32, offsetof(T, leaveAroundHostWarningTime), 4, 1, nullptr },
+        { "hostModeCostItemId", field_type::s32, offsetof(T, hostModeCostItemId), 4, 1, nullptr },
+        { "aIJump_DecelerateParam", field_type::f32, offsetof(T, aIJump_DecelerateParam), 4, 1, nullptr },
+        { "buddyDisappearDelaySec", field_type::f32, offsetof(T, buddyDisappearDelaySec), 4, 1, nullptr },
+        { "aIJump_AnimYMoveCorrectRate_onJumpOff", field_type::f32, offsetof(T, aIJump_AnimYMoveCorrectRate_onJumpOff), 4, 1, nullptr },
+        { "stealthSystemSightRate_NotInStealthRigid_NotSightHide_StealthMode", field_type::f32, offsetof(T, stealthSystemSightRate_NotInStealthRigid_NotSightHide_StealthMode), 4, 1, nullptr },
+        { "stealthSystemSightRate_NotInStealthRigid_SightHide_NotStealthMode", field_type::f32, offsetof(T, stealthSystemSightRate_NotInStealthRigid_SightHide_NotStealthMode), 4, 1, nullptr },
+        { "stealthSystemSightRate_NotInStealthRigid_SightHide_StealthMode", field_type::f32, offsetof(T, stealthSystemSightRate_NotInStealthRigid_SightHide_StealthMode), 4, 1, nullptr },
+        { "stealthSystemSightRate_InStealthRigid_NotSightHide_NotStealthMode", field_type::f32, offsetof(T, stealthSystemSightRate_InStealthRigid_NotSightHide_NotStealthMode), 4, 1, nullptr },
+        { "stealthSystemSightRate_InStealthRigid_NotSightHide_StealthMode", field_type::f32, offsetof(T, stealthSystemSightRate_InStealthRigid_NotSightHide_StealthMode), 4, 1, nullptr },
+        { "stealthSystemSightRate_InStealthRigid_SightHide_NotStealthMode", field_type::f32, offsetof(T, stealthSystemSightRate_InStealthRigid_SightHide_NotStealthMode), 4, 1, nullptr },
+        { "stealthSystemSightRate_InStealthRigid_SightHide_StealthMode", field_type::f32, offsetof(T, stealthSystemSightRate_InStealthRigid_SightHide_StealthMode), 4, 1, nullptr },
+        { "msbEventGeomTreasureInfo_actionButtonParamId_corpse", field_type::s32, offsetof(T, msbEventGeomTreasureInfo_actionButtonParamId_corpse), 4, 1, nullptr },
+        { "msbEventGeomTreasureInfo_itemGetAnimId_corpse", field_type::s32, offsetof(T, msbEventGeomTreasureInfo_itemGetAnimId_corpse), 4, 1, nullptr },
+        { "msbEventGeomTreasureInfo_actionButtonParamId_box", field_type::s32, offsetof(T, msbEventGeomTreasureInfo_actionButtonParamId_box), 4, 1, nullptr },
+        { "msbEventGeomTreasureInfo_itemGetAnimId_box", field_type::s32, offsetof(T, msbEventGeomTreasureInfo_itemGetAnimId_box), 4, 1, nullptr },
+        { "msbEventGeomTreasureInfo_actionButtonParamId_shine", field_type::s32, offsetof(T, msbEventGeomTreasureInfo_actionButtonParamId_shine), 4, 1, nullptr },
+        { "msbEventGeomTreasureInfo_itemGetAnimId_shine", field_type::s32, offsetof(T, msbEventGeomTreasureInfo_itemGetAnimId_shine), 4, 1, nullptr },
+        { "signPuddleAssetId", field_type::s32, offsetof(T, signPuddleAssetId), 4, 1, nullptr },
+        { "signPuddleAppearDmypolyId0", field_type::s32, offsetof(T, signPuddleAppearDmypolyId0), 4, 1, nullptr },
+        { "signPuddleAppearDmypolyId1", field_type::s32, offsetof(T, signPuddleAppearDmypolyId1), 4, 1, nullptr },
+        { "signPuddleAppearDmypolyId2", field_type::s32, offsetof(T, signPuddleAppearDmypolyId2), 4, 1, nullptr },
+        { "signPuddleAppearDmypolyId3", field_type::s32, offsetof(T, signPuddleAppearDmypolyId3), 4, 1, nullptr },
+        { "fallDamageRate_forRidePC", field_type::f32, offsetof(T, fallDamageRate_forRidePC), 4, 1, nullptr },
+        { "fallDamageRate_forRideNPC", field_type::f32, offsetof(T, fallDamageRate_forRideNPC), 4, 1, nullptr },
+        { "OldMonkOfYellow_CreateSignSpEffectId", field_type::s32, offsetof(T, OldMonkOfYellow_CreateSignSpEffectId), 4, 1, nullptr },
+        { "StragglerActivateDist", field_type::f32, offsetof(T, StragglerActivateDist), 4, 1, nullptr },
+        { "SpEffectId_EnableUseItem_StragglerActivate", field_type::s32, offsetof(T, SpEffectId_EnableUseItem_StragglerActivate), 4, 1, nullptr },
+        { "SpEffectId_StragglerWakeUp", field_type::s32, offsetof(T, SpEffectId_StragglerWakeUp), 4, 1, nullptr },
+        { "SpEffectId_StragglerTarget", field_type::s32, offsetof(T, SpEffectId_StragglerTarget), 4, 1, nullptr },
+        { "SpEffectId_StragglerOppose", field_type::s32, offsetof(T, SpEffectId_StragglerOppose), 4, 1, nullptr },
+        { "buddyWarp_TriggerTimeRayBlocked", field_type::f32, offsetof(T, buddyWarp_TriggerTimeRayBlocked), 4, 1, nullptr },
+        { "buddyWarp_TriggerDistToPlayer", field_type::f32, offsetof(T, buddyWarp_TriggerDistToPlayer), 4, 1, nullptr },
+        { "buddyWarp_ThresholdTimePathStacked", field_type::f32, offsetof(T, buddyWarp_ThresholdTimePathStacked), 4, 1, nullptr },
+        { "buddyWarp_ThresholdRangePathStacked", field_type::f32, offsetof(T, buddyWarp_ThresholdRangePathStacked), 4, 1, nullptr },
+        { "aiSightRate_morning", field_type::f32, offsetof(T, aiSightRate_morning), 4, 1, nullptr },
+        { "aiSightRate_noonA", field_type::f32, offsetof(T, aiSightRate_noonA), 4, 1, nullptr },
+        { "buddyPassThroughTriggerTime", field_type::f32, offsetof(T, buddyPassThroughTriggerTime), 4, 1, nullptr },
+        { "aiSightRate_evening", field_type::f32, offsetof(T, aiSightRate_evening), 4, 1, nullptr },
+        { "aiSightRate_night", field_type::f32, offsetof(T, aiSightRate_night), 4, 1, nullptr },
+        { "aiSightRate_midnightA", field_type::f32, offsetof(T, aiSightRate_midnightA), 4, 1, nullptr },
+        { "reserve4_2", field_type::u8, offsetof(T, reserve4_2), 1, 4, nullptr },
+        { "aiSightRate_sunloss_light", field_type::f32, offsetof(T, aiSightRate_sunloss_light), 4, 1, nullptr },
+        { "aiSightRate_sunloss_dark", field_type::f32, offsetof(T, aiSightRate_sunloss_dark), 4, 1, nullptr },
+        { "aiSightRate_sunloss_veryDark", field_type::f32, offsetof(T, aiSightRate_sunloss_veryDark), 4, 1, nullptr },
+        { "stealthSystemSightAngleReduceRate_NotInStealthRigid_NotSightHide_StealthMode", field_type::f32, offsetof(T, stealthSystemSightAngleReduceRate_NotInStealthRigid_NotSightHide_StealthMode), 4, 1, nullptr },
+        { "stealthSystemSightAngleReduceRate_NotInStealthRigid_SightHide_NotStealthMode", field_type::f32, offsetof(T, stealthSystemSightAngleReduceRate_NotInStealthRigid_SightHide_NotStealthMode), 4, 1, nullptr },
+        { "stealthSystemSightAngleReduceRate_NotInStealthRigid_SightHide_StealthMode", field_type::f32, offsetof(T, stealthSystemSightAngleReduceRate_NotInStealthRigid_SightHide_StealthMode), 4, 1, nullptr },
+        { "stealthSystemSightAngleReduceRate_InStealthRigid_NotSightHide_NotStealthMode", field_type::f32, offsetof(T, stealthSystemSightAngleReduceRate_InStealthRigid_NotSightHide_NotStealthMode), 4, 1, nullptr },
+        { "stealthSystemSightAngleReduceRate_InStealthRigid_NotSightHide_StealthMode", field_type::f32, offsetof(T, stealthSystemSightAngleReduceRate_InStealthRigid_NotSightHide_StealthMode), 4, 1, nullptr },
+        { "stealthSystemSightAngleReduceRate_InStealthRigid_SightHide_NotStealthMode", field_type::f32, offsetof(T, stealthSystemSightAngleReduceRate_InStealthRigid_SightHide_NotStealthMode), 4, 1, nullptr },
+        { "stealthSystemSightAngleReduceRate_InStealthRigid_SightHide_StealthMode", field_type::f32, offsetof(T, stealthSystemSightAngleReduceRate_InStealthRigid_SightHide_StealthMode), 4, 1, nullptr },
+        { "weatherLotConditionStart_Morning_Hour", field_type::u8, offsetof(T, weatherLotConditionStart_Morning_Hour), 1, 1, nullptr },
+        { "weatherLotConditionStart_Morning_Minute", field_type::u8, offsetof(T, weatherLotConditionStart_Morning_Minute), 1, 1, nullptr },
+        { "weatherLotConditionStart_Day_Hour", field_type::u8, offsetof(T, weatherLotConditionStart_Day_Hour), 1, 1, nullptr },
+        { "weatherLotConditionStart_Day_Minute", field_type::u8, offsetof(T, weatherLotConditionStart_Day_Minute), 1, 1, nullptr },
+        { "weatherLotConditionStart_Evening_Hour", field_type::u8, offsetof(T, weatherLotConditionStart_Evening_Hour), 1, 1, nullptr },
+        { "weatherLotConditionStart_Evening_Minute", field_type::u8, offsetof(T, weatherLotConditionStart_Evening_Minute), 1, 1, nullptr },
+        { "weatherLotConditionStart_Night_Hour", field_type::u8, offsetof(T, weatherLotConditionStart_Night_Hour), 1, 1, nullptr },
+        { "weatherLotConditionStart_Night_Minute", field_type::u8, offsetof(T, weatherLotConditionStart_Night_Minute), 1, 1, nullptr },
+        { "weatherLotConditionStart_DayBreak_Hour", field_type::u8, offsetof(T, weatherLotConditionStart_DayBreak_Hour), 1, 1, nullptr },
+        { "weatherLotConditionStart_DayBreak_Minute", field_type::u8, offsetof(T, weatherLotConditionStart_DayBreak_Minute), 1, 1, nullptr },
+        { "weatherLotCondition_reserved", field_type::u8, offsetof(T, weatherLotCondition_reserved), 1, 2, nullptr },
+        { "pclightScaleChangeStart_Hour", field_type::u8, offsetof(T, pclightScaleChangeStart_Hour), 1, 1, nullptr },
+        { "pclightScaleChangeStart_Minute", field_type::u8, offsetof(T, pclightScaleChangeStart_Minute), 1, 1, nullptr },
+        { "pclightScaleChangeEnd_Hour", field_type::u8, offsetof(T, pclightScaleChangeEnd_Hour), 1, 1, nullptr },
+        { "pclightScaleChangeEnd_Minute", field_type::u8, offsetof(T, pclightScaleChangeEnd_Minute), 1, 1, nullptr },
+        { "pclightScaleByTimezone", field_type::f32, offsetof(T, pclightScaleByTimezone), 4, 1, nullptr },
+        { "bigRuneGreaterDemon_SummonBuddySpecialEffectId_Buddy", field_type::s32, offsetof(T, bigRuneGreaterDemon_SummonBuddySpecialEffectId_Buddy), 4, 1, nullptr },
+        { "bigRuneGreaterDemon_SummonBuddySpecialEffectId_Pc", field_type::s32, offsetof(T, bigRuneGreaterDemon_SummonBuddySpecialEffectId_Pc), 4, 1, nullptr },
+        { "homeBonfireParamId", field_type::s32, offsetof(T, homeBonfireParamId), 4, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_11", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_11), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_12", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_12), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_13", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_13), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_14", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_14), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_15", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_15), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_16", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_16), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_17", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_17), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_18", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_18), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_19", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_19), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_20", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_20), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_21", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_21), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_22", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_22), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_23", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_23), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_24", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_24), 1, 1, nullptr },
+        { "machingWeaponLevelUpperWhiteSign_25", field_type::u8, offsetof(T, machingWeaponLevelUpperWhiteSign_25), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_11", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_11), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_12", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_12), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_13", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_13), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_14", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_14), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_15", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_15), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_16", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_16), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_17", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_17), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_18", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_18), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_19", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_19), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_20", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_20), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_21", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_21), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_22", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_22), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_23", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_23), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_24", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_24), 1, 1, nullptr },
+        { "machingWeaponLevelUpperRedSign_25", field_type::u8, offsetof(T, machingWeaponLevelUpperRedSign_25), 1, 1, nullptr },
+        { "menuTimezoneStart_Morning_Hour", field_type::u8, offsetof(T, menuTimezoneStart_Morning_Hour), 1, 1, nullptr },
+        { "menuTimezoneStart_Morning_Minute", field_type::u8, offsetof(T, menuTimezoneStart_Morning_Minute), 1, 1, nullptr },
+        { "menuTimezoneStart_Day1_Hour", field_type::u8, offsetof(T, menuTimezoneStart_Day1_Hour), 1, 1, nullptr },
+        { "menuTimezoneStart_Day1_Minute", field_type::u8, offsetof(T, menuTimezoneStart_Day1_Minute), 1, 1, nullptr },
+        { "menuTimezoneStart_Day2_Hour", field_type::u8, offsetof(T, menuTimezoneStart_Day2_Hour), 1, 1, nullptr },
+        { "menuTimezoneStart_Day2_Minute", field_type::u8, offsetof(T, menuTimezoneStart_Day2_Minute), 1, 1, nullptr },
+        { "menuTimezoneStart_Evening_Hour", field_type::u8, offsetof(T, menuTimezoneStart_Evening_Hour), 1, 1, nullptr },
+        { "menuTimezoneStart_Evening_Minute", field_type::u8, offsetof(T, menuTimezoneStart_Evening_Minute), 1, 1, nullptr },
+        { "menuTimezoneStart_Night_Hour", field_type::u8, offsetof(T, menuTimezoneStart_Night_Hour), 1, 1, nullptr },
+        { "menuTimezoneStart_Night_Minute", field_type::u8, offsetof(T, menuTimezoneStart_Night_Minute), 1, 1, nullptr },
+        { "menuTimezoneStart_Midnight_Hour", field_type::u8, offsetof(T, menuTimezoneStart_Midnight_Hour), 1, 1, nullptr },
+        { "menuTimezoneStart_Midnight_Minute", field_type::u8, offsetof(T, menuTimezoneStart_Midnight_Minute), 1, 1, nullptr },
+        { "remotePlayerThreatLvNotify_ThreatLv", field_type::u16, offsetof(T, remotePlayerThreatLvNotify_ThreatLv), 2, 1, nullptr },
+        { "remotePlayerThreatLvNotify_NotifyDist", field_type::f32, offsetof(T, remotePlayerThreatLvNotify_NotifyDist), 4, 1, nullptr },
+        { "remotePlayerThreatLvNotify_EndNotifyDist", field_type::f32, offsetof(T, remotePlayerThreatLvNotify_EndNotifyDist), 4, 1, nullptr },
+        { "worldMapPointDiscoveryExpandRange", field_type::f32, offsetof(T, worldMapPointDiscoveryExpandRange), 4, 1, nullptr },
+        { "worldMapPointReentryExpandRange", field_type::f32, offsetof(T, worldMapPointReentryExpandRange), 4, 1, nullptr },
+        { "remotePlayerThreatLvNotify_NotifyTime", field_type::u16, offsetof(T, remotePlayerThreatLvNotify_NotifyTime), 2, 1, nullptr },
+        { "breakIn_A_rebreakInGoodsNum", field_type::u16, offsetof(T, breakIn_A_rebreakInGoodsNum), 2, 1, nullptr },
+        { "breakIn_A_rebreakInGoodsId", field_type::s32, offsetof(T, breakIn_A_rebreakInGoodsId), 4, 1, nullptr },
+        { "rideJumpoff_SfxId", field_type::s32, offsetof(T, rideJumpoff_SfxId), 4, 1, nullptr },
+        { "rideJumpoff_SfxHeightOffset", field_type::f32, offsetof(T, rideJumpoff_SfxHeightOffset), 4, 1, nullptr },
+        { "rideJumpoff_SpEffectId", field_type::s32, offsetof(T, rideJumpoff_SpEffectId), 4, 1, nullptr },
+        { "rideJumpoff_SpEffectIdPc", field_type::s32, offsetof(T, rideJumpoff_SpEffectIdPc), 4, 1, nullptr },
+        { "unlockExchangeMenuEventFlagId", field_type::u32, offsetof(T, unlockExchangeMenuEventFlagId), 4, 1, nullptr },
+        { "unlockMessageMenuEventFlagId", field_type::u32, offsetof(T, unlockMessageMenuEventFlagId), 4, 1, nullptr },
+        { "breakInOnce_A_rebreakInGoodsNum", field_type::u16, offsetof(T, breakInOnce_A_rebreakInGoodsNum), 2, 1, nullptr },
+        { "breakIn_B_rebreakInGoodsNum", field_type::u16, offsetof(T, breakIn_B_rebreakInGoodsNum), 2, 1, nullptr },
+        { "breakInOnce_A_rebreakInGoodsId", field_type::s32, offsetof(T, breakInOnce_A_rebreakInGoodsId), 4, 1, nullptr },
+        { "breakIn_B_rebreakInGoodsId", field_type::s32, offsetof(T, breakIn_B_rebreakInGoodsId), 4, 1, nullptr },
+        { "actionButtonInputCancelTime", field_type::f32, offsetof(T, actionButtonInputCancelTime), 4, 1, nullptr },
+        { "blockClearBonusDelayTime", field_type::f32, offsetof(T, blockClearBonusDelayTime), 4, 1, nullptr },
+        { "bonfireCheckEnemyRange", field_type::f32, offsetof(T, bonfireCheckEnemyRange), 4, 1, nullptr },
+        { "reserved_124", field_type::u8, offsetof(T, reserved_124), 1, 32, nullptr },
+        { "unkR00", field_type::f32, offsetof(T, unkR00), 4, 1, nullptr },
+        { "unkR04", field_type::f32, offsetof(T, unkR04), 4, 1, nullptr },
+        { "unkR08", field_type::f32, offsetof(T, unkR08), 4, 1, nullptr },
+        { "unkR12", field_type::f32, offsetof(T, unkR12), 4, 1, nullptr },
+        { "unkR16", field_type::f32, offsetof(T, unkR16), 4, 1, nullptr },
+        { "unkR20", field_type::f32, offsetof(T, unkR20), 4, 1, nullptr },
+        { "unkR24", field_type::f32, offsetof(T, unkR24), 4, 1, nullptr },
+        { "unkR28", field_type::f32, offsetof(T, unkR28), 4, 1, nullptr },
+        { "unkR32", field_type::f32, offsetof(T, unkR32), 4, 1, nullptr },
+        { "unkR36", field_type::f32, offsetof(T, unkR36), 4, 1, nullptr },
+        { "unkR40", field_type::f32, offsetof(T, unkR40), 4, 1, nullptr },
+        { "unkR44", field_type::f32, offsetof(T, unkR44), 4, 1, nullptr },
+        { "unkR48", field_type::f32, offsetof(T, unkR48), 4, 1, nullptr },
+        { "unkR52", field_type::f32, offsetof(T, unkR52), 4, 1, nullptr },
+        { "reserved_124_2", field_type::u8, offsetof(T, reserved_124_2), 1, 40, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, baseToughnessRecoverTime) == 0);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, chrEventTrun_byLeft90) == 4);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, chrEventTrun_byRight90) == 8);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, chrEventTrun_byLeft180) == 12);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, chrEventTrun_byRight180) == 16);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, chrEventTrun_90TurnStartAngle) == 20);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, chrEventTrun_180TurnStartAngle) == 22);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthAtkDamageRate) == 24);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, flickDamageCutRateSuccessGurad) == 28);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, npcTalkAnimBeginDiffAngle) == 32);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, npcTalkAnimEndDiffAngle) == 36);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, sleepCollectorItemActionButtonParamId) == 40);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, allowUseBuddyItem_sfxInterval) == 44);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, allowUseBuddyItem_sfxDmyPolyId) == 48);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, allowUseBuddyItem_sfxDmyPolyId_horse) == 52);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, allowUseBuddyItem_sfxId) == 56);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, onBuddySummon_inActivateRange_sfxInterval) == 60);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, onBuddySummon_inActivateRange_sfxDmyPolyId) == 64);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, onBuddySummon_inActivateRange_sfxDmyPolyId_horse) == 68);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, onBuddySummon_inActivateRange_sfxId) == 72);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, onBuddySummon_inActivateRange_spEffectId_pc) == 76);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, onBuddySummon_inWarnRange_spEffectId_pc) == 80);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, onBuddySummon_atBuddyUnsummon_spEffectId_pc) == 84);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, onBuddySummon_inWarnRange_spEffectId_buddy) == 88);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, morningIngameHour) == 92);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, morningIngameMinute) == 93);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, morningIngameSecond) == 94);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, noonIngameHour) == 95);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, noonIngameMinute) == 96);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, noonIngameSecond) == 97);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, nightIngameHour) == 98);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, nightIngameMinute) == 99);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, nightIngameSecond) == 100);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRateStart_Morning_Hour) == 101);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRateStart_Morning_Minute) == 102);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRateStart_Noon_Hour) == 103);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRateStart_Noon_Minute) == 104);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRateStart_Evening_Hour) == 105);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRateStart_Evening_Minute) == 106);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRateStart_Night_Hour) == 107);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRateStart_Night_Minute) == 108);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRateStart_Midnight_Hour) == 109);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRateStart_Midnight_Minute) == 110);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, saLargeDamageHitSfx_Threshold) == 111);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, saLargeDamageHitSfx_SfxId) == 112);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, signCreatableDistFromSafePos) == 116);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, guestResummonDist) == 120);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, guestLeavingMessageDistMax) == 124);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, guestLeavingMessageDistMin) == 128);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, guestLeaveSessionDist) == 132);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, retryPointAreaRadius) == 136);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, sleepCollectorSpEffectId) == 140);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, recoverBelowMaxHpCompletionNoticeSpEffectId) == 144);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, estusFlaskRecovery_AbsorptionProductionSfxId_byHp) == 148);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, estusFlaskRecovery_AbsorptionProductionSfxId_byMp) == 152);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, respawnSpecialEffectActiveCheckerSpEffectId) == 156);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, onBuddySummon_inActivateRange_spEffectId_buddy) == 160);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, estusFlaskRecovery_AddEstusTime) == 164);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, defeatMultiModeEnemyOfSoulCorrectRate_byHost) == 168);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, defeatMultiModeEnemyOfSoulCorrectRate_byTeamGhost) == 172);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, defeatMultiModeBossOfSoulCorrectRate_byHost) == 176);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, defeatMultiModeBossOfSoulCorrectRate_byTeamGhost) == 180);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, enemyHpGaugeScreenOffset_byUp) == 184);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, playRegionCollectDist) == 186);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, enemyDetectionSpEffect_ShootBulletDummypolyId) == 188);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, bigRuneGreaterDemonBreakInGoodsNum) == 190);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, bigRuneGreaterDemonBreakInGoodsId) == 192);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, rideJumpRegionDefaultSfxId) == 196);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, saAttackRate_forVsRideAtk) == 200);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, enemySpEffectIdAfterSleepCollectorItemLot) == 204);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, afterEndingMapUid) == 208);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, afterEndingReturnPointEntityId) == 212);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, enemyDetectionSpEffect_BulletId_byCoopRing_RedHunter) == 216);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, enemyDetectionSpEffect_BulletId_byInvadeOrb_None) == 220);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, tutorialFlagOnAccessDistView) == 224);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, tutorialFlagOnAccessRetryPoint) == 228);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, tutorialFlagOnGetGroupReward) == 232);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, tutorialFlagOnEnterRideJumpRegion) == 236);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, tutorialCheckRideJumpRegionExpandRange) == 240);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, retryPointActivatedPcAnimId) == 244);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, retryPointActivatedDialogDelayTime) == 248);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, retryPointActivatedDialogTextId) == 252);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, signPuddleOpenPcAnimId) == 256);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, signPuddleOpenDialogDelayTime) == 260);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, activityOfDeadSpEffect_BulletId) == 264);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, activityOfDeadSpEffect_ShootBulletDummypolyId) == 268);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, activityOfDeadSpEffect_DeadFadeOutTime) == 272);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, ignorNetStateSyncTime_ForThrow) == 276);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, netPenaltyPointLanDisconnect) == 280);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, netPenaltyPointProfileSignout) == 282);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, netPenaltyPointReboot) == 284);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, netPnaltyPointSuspend) == 286);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, netPenaltyForgiveItemLimitTime) == 288);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, netPenaltyPointThreshold) == 292);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, uncontrolledMoveThresholdTime) == 294);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, enemyDetectionSpEffect_BulletId_byNpcEnemy) == 296);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, activityOfDeadTargetSearchSpEffect_OnHitSpEffect) == 300);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, activityOfDeadTargetSearchSpEffect_MaxLength) == 304);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, sightRangeLowerPromiseRate) == 308);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, saLargeDamageHitSfx_MinDamage) == 312);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, saLargeDamageHitSfx_ForceDamage) == 314);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, soloBreakInMaxPoint) == 316);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, npcTalkTimeOutThreshold) == 320);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, sendPlayLogIntervalTime) == 324);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, item370_MaxSfxNum) == 328);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, chrActivateDist_forLeavePC) == 329);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, summonDataCoopMatchingLevelUpperAbs) == 330);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, summonDataCoopMatchingLevelUpperRel) == 332);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, summonDataCoopMatchingWepLevelMul) == 334);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, pickUpBerserkerSignSpEffectBulletId) == 336);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, succeedBerserkerSelfKillingEffectId) == 340);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingLevelWhiteSignUpperRel) == 344);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingLevelWhiteSignUpperAbs) == 345);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingLevelRedSignUpperRel) == 346);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingLevelRedSignUpperAbs) == 347);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_0) == 348);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_1) == 349);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_2) == 350);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_3) == 351);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_4) == 352);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_5) == 353);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_6) == 354);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_7) == 355);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_8) == 356);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_9) == 357);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_10) == 358);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_0) == 359);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_1) == 360);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_2) == 361);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_3) == 362);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_4) == 363);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_5) == 364);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_6) == 365);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_7) == 366);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_8) == 367);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_9) == 368);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_10) == 369);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, autoInvadePoint_generateDist) == 370);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, autoInvadePoint_cancelDist) == 371);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, sendGlobalEventLogIntervalTime) == 372);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, addSoloBreakInPoint_White) == 376);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, addSoloBreakInPoint_Black) == 378);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, addSoloBreakInPoint_ForceJoin) == 380);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, addSoloBreakInPoint_VisitorGuardian) == 382);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, addSoloBreakInPoint_VisitorRedHunter) == 384);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, invincibleTimer_forNetPC_initSync) == 386);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, invincibleTimer_forNetPC) == 387);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, redHunter_HostBossAreaGetSoulRate) == 388);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, ghostFootprintDecalParamId) == 392);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, leaveAroundHostWarningTime) == 396);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, hostModeCostItemId) == 400);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aIJump_DecelerateParam) == 404);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, buddyDisappearDelaySec) == 408);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aIJump_AnimYMoveCorrectRate_onJumpOff) == 412);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightRate_NotInStealthRigid_NotSightHide_StealthMode) == 416);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightRate_NotInStealthRigid_SightHide_NotStealthMode) == 420);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightRate_NotInStealthRigid_SightHide_StealthMode) == 424);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightRate_InStealthRigid_NotSightHide_NotStealthMode) == 428);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightRate_InStealthRigid_NotSightHide_StealthMode) == 432);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightRate_InStealthRigid_SightHide_NotStealthMode) == 436);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightRate_InStealthRigid_SightHide_StealthMode) == 440);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, msbEventGeomTreasureInfo_actionButtonParamId_corpse) == 444);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, msbEventGeomTreasureInfo_itemGetAnimId_corpse) == 448);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, msbEventGeomTreasureInfo_actionButtonParamId_box) == 452);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, msbEventGeomTreasureInfo_itemGetAnimId_box) == 456);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, msbEventGeomTreasureInfo_actionButtonParamId_shine) == 460);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, msbEventGeomTreasureInfo_itemGetAnimId_shine) == 464);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, signPuddleAssetId) == 468);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, signPuddleAppearDmypolyId0) == 472);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, signPuddleAppearDmypolyId1) == 476);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, signPuddleAppearDmypolyId2) == 480);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, signPuddleAppearDmypolyId3) == 484);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, fallDamageRate_forRidePC) == 488);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, fallDamageRate_forRideNPC) == 492);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, OldMonkOfYellow_CreateSignSpEffectId) == 496);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, StragglerActivateDist) == 500);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, SpEffectId_EnableUseItem_StragglerActivate) == 504);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, SpEffectId_StragglerWakeUp) == 508);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, SpEffectId_StragglerTarget) == 512);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, SpEffectId_StragglerOppose) == 516);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, buddyWarp_TriggerTimeRayBlocked) == 520);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, buddyWarp_TriggerDistToPlayer) == 524);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, buddyWarp_ThresholdTimePathStacked) == 528);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, buddyWarp_ThresholdRangePathStacked) == 532);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRate_morning) == 536);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRate_noonA) == 540);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, buddyPassThroughTriggerTime) == 544);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRate_evening) == 548);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRate_night) == 552);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRate_midnightA) == 556);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, reserve4_2) == 560);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRate_sunloss_light) == 564);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRate_sunloss_dark) == 568);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, aiSightRate_sunloss_veryDark) == 572);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightAngleReduceRate_NotInStealthRigid_NotSightHide_StealthMode) == 576);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightAngleReduceRate_NotInStealthRigid_SightHide_NotStealthMode) == 580);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightAngleReduceRate_NotInStealthRigid_SightHide_StealthMode) == 584);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightAngleReduceRate_InStealthRigid_NotSightHide_NotStealthMode) == 588);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightAngleReduceRate_InStealthRigid_NotSightHide_StealthMode) == 592);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightAngleReduceRate_InStealthRigid_SightHide_NotStealthMode) == 596);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, stealthSystemSightAngleReduceRate_InStealthRigid_SightHide_StealthMode) == 600);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotConditionStart_Morning_Hour) == 604);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotConditionStart_Morning_Minute) == 605);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotConditionStart_Day_Hour) == 606);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotConditionStart_Day_Minute) == 607);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotConditionStart_Evening_Hour) == 608);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotConditionStart_Evening_Minute) == 609);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotConditionStart_Night_Hour) == 610);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotConditionStart_Night_Minute) == 611);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotConditionStart_DayBreak_Hour) == 612);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotConditionStart_DayBreak_Minute) == 613);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, weatherLotCondition_reserved) == 614);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, pclightScaleChangeStart_Hour) == 616);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, pclightScaleChangeStart_Minute) == 617);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, pclightScaleChangeEnd_Hour) == 618);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, pclightScaleChangeEnd_Minute) == 619);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, pclightScaleByTimezone) == 620);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, bigRuneGreaterDemon_SummonBuddySpecialEffectId_Buddy) == 624);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, bigRuneGreaterDemon_SummonBuddySpecialEffectId_Pc) == 628);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, homeBonfireParamId) == 632);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_11) == 636);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_12) == 637);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_13) == 638);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_14) == 639);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_15) == 640);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_16) == 641);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_17) == 642);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_18) == 643);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_19) == 644);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_20) == 645);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_21) == 646);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_22) == 647);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_23) == 648);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_24) == 649);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperWhiteSign_25) == 650);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_11) == 651);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_12) == 652);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_13) == 653);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_14) == 654);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_15) == 655);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_16) == 656);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_17) == 657);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_18) == 658);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_19) == 659);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_20) == 660);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_21) == 661);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_22) == 662);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_23) == 663);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_24) == 664);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, machingWeaponLevelUpperRedSign_25) == 665);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Morning_Hour) == 666);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Morning_Minute) == 667);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Day1_Hour) == 668);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Day1_Minute) == 669);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Day2_Hour) == 670);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Day2_Minute) == 671);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Evening_Hour) == 672);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Evening_Minute) == 673);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Night_Hour) == 674);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Night_Minute) == 675);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Midnight_Hour) == 676);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, menuTimezoneStart_Midnight_Minute) == 677);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, remotePlayerThreatLvNotify_ThreatLv) == 678);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, remotePlayerThreatLvNotify_NotifyDist) == 680);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, remotePlayerThreatLvNotify_EndNotifyDist) == 684);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, worldMapPointDiscoveryExpandRange) == 688);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, worldMapPointReentryExpandRange) == 692);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, remotePlayerThreatLvNotify_NotifyTime) == 696);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, breakIn_A_rebreakInGoodsNum) == 698);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, breakIn_A_rebreakInGoodsId) == 700);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, rideJumpoff_SfxId) == 704);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, rideJumpoff_SfxHeightOffset) == 708);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, rideJumpoff_SpEffectId) == 712);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, rideJumpoff_SpEffectIdPc) == 716);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unlockExchangeMenuEventFlagId) == 720);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unlockMessageMenuEventFlagId) == 724);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, breakInOnce_A_rebreakInGoodsNum) == 728);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, breakIn_B_rebreakInGoodsNum) == 730);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, breakInOnce_A_rebreakInGoodsId) == 732);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, breakIn_B_rebreakInGoodsId) == 736);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, actionButtonInputCancelTime) == 740);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, blockClearBonusDelayTime) == 744);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, bonfireCheckEnemyRange) == 748);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, reserved_124) == 752);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR00) == 784);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR04) == 788);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR08) == 792);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR12) == 796);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR16) == 800);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR20) == 804);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR24) == 808);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR28) == 812);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR32) == 816);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR36) == 820);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR40) == 824);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR44) == 828);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR48) == 832);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, unkR52) == 836);
+static_assert(offsetof(paramdef::GAME_SYSTEM_COMMON_PARAM_ST, reserved_124_2) == 840);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,34 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../GESTURE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::GESTURE_PARAM_ST> {
+    using T = paramdef::GESTURE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 8> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "itemId", field_type::s32, offsetof(T, itemId), 4, 1, nullptr },
+        { "msgAnimId", field_type::s32, offsetof(T, msgAnimId), 4, 1, nullptr },
+        { "cannotUseRiding", field_type::boolean, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->cannotUseRiding; } },
+        { "pad2", field_type::u8, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad2; } },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 3, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::GESTURE_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::GESTURE_PARAM_ST, itemId) == 4);
+static_assert(offsetof(paramdef::GESTURE_PARAM_ST, msgAnimId) == 8);
+static_assert(offsetof(paramdef::GESTURE_PARAM_ST, pad1) == 13);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,26 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../GPARAM_GRID_REGION_INFO_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::GPARAM_GRID_REGION_INFO_PARAM_ST> {
+    using T = paramdef::GPARAM_GRID_REGION_INFO_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 2> fields = {{
+        { "GparamGridRegionId", field_type::u32, offsetof(T, GparamGridRegionId), 4, 1, nullptr },
+        { "Reserve", field_type::u8, offsetof(T, Reserve), 1, 28, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::GPARAM_GRID_REGION_INFO_PARAM_ST, GparamGridRegionId) == 0);
+static_assert(offsetof(paramdef::GPARAM_GRID_REGION_INFO_PARAM_ST, Reserve) == 4);
+
+}; // namespace params
+}; // namespace from
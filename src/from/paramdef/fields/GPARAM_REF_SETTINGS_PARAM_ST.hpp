@@ -0,0 +1,30 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../GPARAM_REF_SETTINGS_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::GPARAM_REF_SETTINGS_PARAM_ST> {
+    using T = paramdef::GPARAM_REF_SETTINGS_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 5> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "RefTargetMapId", field_type::s32, offsetof(T, RefTargetMapId), 4, 1, nullptr },
+        { "Reserve", field_type::u8, offsetof(T, Reserve), 1, 24, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::GPARAM_REF_SETTINGS_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::GPARAM_REF_SETTINGS_PARAM_ST, RefTargetMapId) == 4);
+static_assert(offsetof(paramdef::GPARAM_REF_SETTINGS_PARAM_ST, Reserve) == 8);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,30 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../GRAPHICS_COMMON_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::GRAPHICS_COMMON_PARAM_ST> {
+    using T = paramdef::GRAPHICS_COMMON_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "hitBulletDecalOffset_HitIns", field_type::f32, offsetof(T, hitBulletDecalOffset_HitIns), 4, 1, nullptr },
+        { "reserved02", field_type::u8, offsetof(T, reserved02), 1, 8, nullptr },
+        { "charaWetDecalFadeRange", field_type::f32, offsetof(T, charaWetDecalFadeRange), 4, 1, nullptr },
+        { "reserved04", field_type::u8, offsetof(T, reserved04), 1, 240, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::GRAPHICS_COMMON_PARAM_ST, hitBulletDecalOffset_HitIns) == 0);
+static_assert(offsetof(paramdef::GRAPHICS_COMMON_PARAM_ST, reserved02) == 4);
+static_assert(offsetof(paramdef::GRAPHICS_COMMON_PARAM_ST, charaWetDecalFadeRange) == 12);
+static_assert(offsetof(paramdef::GRAPHICS_COMMON_PARAM_ST, reserved04) == 16);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,34 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../GRASS_LOD_RANGE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::GRASS_LOD_RANGE_PARAM_ST> {
+    using T = paramdef::GRASS_LOD_RANGE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 6> fields = {{
+        { "LOD0_range", field_type::f32, offsetof(T, LOD0_range), 4, 1, nullptr },
+        { "LOD0_play", field_type::f32, offsetof(T, LOD0_play), 4, 1, nullptr },
+        { "LOD1_range", field_type::f32, offsetof(T, LOD1_range), 4, 1, nullptr },
+        { "LOD1_play", field_type::f32, offsetof(T, LOD1_play), 4, 1, nullptr },
+        { "LOD2_range", field_type::f32, offsetof(T, LOD2_range), 4, 1, nullptr },
+        { "LOD2_play", field_type::f32, offsetof(T, LOD2_play), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::GRASS_LOD_RANGE_PARAM_ST, LOD0_range) == 0);
+static_assert(offsetof(paramdef::GRASS_LOD_RANGE_PARAM_ST, LOD0_play) == 4);
+static_assert(offsetof(paramdef::GRASS_LOD_RANGE_PARAM_ST, LOD1_range) == 8);
+static_assert(offsetof(paramdef::GRASS_LOD_RANGE_PARAM_ST, LOD1_play) == 12);
+static_assert(offsetof(paramdef::GRASS_LOD_RANGE_PARAM_ST, LOD2_range) == 16);
+static_assert(offsetof(paramdef::GRASS_LOD_RANGE_PARAM_ST, LOD2_play) == 20);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,28 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../GRASS_MAP_SETTINGS_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::GRASS_MAP_SETTINGS_PARAM_ST> {
+    using T = paramdef::GRASS_MAP_SETTINGS_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 3> fields = {{
+        { "grassType0", field_type::u32, offsetof(T, grassType0), 4, 1, nullptr },
+        { "grassType1", field_type::u32, offsetof(T, grassType1), 4, 1, nullptr },
+        { "grassType2", field_type::u32, offsetof(T, grassType2), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::GRASS_MAP_SETTINGS_PARAM_ST, grassType0) == 0);
+static_assert(offsetof(paramdef::GRASS_MAP_SETTINGS_PARAM_ST, grassType1) == 4);
+static_assert(offsetof(paramdef::GRASS_MAP_SETTINGS_PARAM_ST, grassType2) == 8);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,98 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../GRASS_TYPE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::GRASS_TYPE_PARAM_ST> {
+    using T = paramdef::GRASS_TYPE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 38> fields = {{
+        { "lodRange", field_type::u16, offsetof(T, lodRange), 2, 1, nullptr },
+        { "lod0ClusterType", field_type::u8, offsetof(T, lod0ClusterType), 1, 1, nullptr },
+        { "lod1ClusterType", field_type::u8, offsetof(T, lod1ClusterType), 1, 1, nullptr },
+        { "lod2ClusterType", field_type::u8, offsetof(T, lod2ClusterType), 1, 1, nullptr },
+        { "pad0", field_type::u8, offsetof(T, pad0), 1, 2, nullptr },
+        { "distributionType", field_type::u8, offsetof(T, distributionType), 1, 1, nullptr },
+        { "baseDensity", field_type::f32, offsetof(T, baseDensity), 4, 1, nullptr },
+        { "model0Name", field_type::wide_character, offsetof(T, model0Name), 2, 16, nullptr },
+        { "flatTextureName", field_type::wide_character, offsetof(T, flatTextureName), 2, 32, nullptr },
+        { "billboardTextureName", field_type::wide_character, offsetof(T, billboardTextureName), 2, 32, nullptr },
+        { "normalInfluence", field_type::u8, offsetof(T, normalInfluence), 1, 1, nullptr },
+        { "inclinationMax", field_type::u8, offsetof(T, inclinationMax), 1, 1, nullptr },
+        { "inclinationJitter", field_type::u8, offsetof(T, inclinationJitter), 1, 1, nullptr },
+        { "scaleBaseMin", field_type::u8, offsetof(T, scaleBaseMin), 1, 1, nullptr },
+        { "scaleBaseMax", field_type::u8, offsetof(T, scaleBaseMax), 1, 1, nullptr },
+        { "scaleHeightMin", field_type::u8, offsetof(T, scaleHeightMin), 1, 1, nullptr },
+        { "scaleHeightMax", field_type::u8, offsetof(T, scaleHeightMax), 1, 1, nullptr },
+        { "colorShade1_r", field_type::u8, offsetof(T, colorShade1_r), 1, 1, nullptr },
+        { "colorShade1_g", field_type::u8, offsetof(T, colorShade1_g), 1, 1, nullptr },
+        { "colorShade1_b", field_type::u8, offsetof(T, colorShade1_b), 1, 1, nullptr },
+        { "colorShade2_r", field_type::u8, offsetof(T, colorShade2_r), 1, 1, nullptr },
+        { "colorShade2_g", field_type::u8, offsetof(T, colorShade2_g), 1, 1, nullptr },
+        { "colorShade2_b", field_type::u8, offsetof(T, colorShade2_b), 1, 1, nullptr },
+        { "flatSplitType", field_type::u8, offsetof(T, flatSplitType), 1, 1, nullptr },
+        { "flatBladeCount", field_type::u8, offsetof(T, flatBladeCount), 1, 1, nullptr },
+        { "flatSlant", field_type::s8, offsetof(T, flatSlant), 1, 1, nullptr },
+        { "flatRadius", field_type::f32, offsetof(T, flatRadius), 4, 1, nullptr },
+        { "castShadow", field_type::u8, offsetof(T, castShadow), 1, 1, nullptr },
+        { "windAmplitude", field_type::u8, offsetof(T, windAmplitude), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 1, nullptr },
+        { "windCycle", field_type::u8, offsetof(T, windCycle), 1, 1, nullptr },
+        { "orientationAngle", field_type::f32, offsetof(T, orientationAngle), 4, 1, nullptr },
+        { "orientationRange", field_type::f32, offsetof(T, orientationRange), 4, 1, nullptr },
+        { "spacing", field_type::f32, offsetof(T, spacing), 4, 1, nullptr },
+        { "dithering", field_type::u8, offsetof(T, dithering), 1, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 3, nullptr },
+        { "simpleModelName", field_type::wide_character, offsetof(T, simpleModelName), 2, 16, nullptr },
+        { "model1Name", field_type::wide_character, offsetof(T, model1Name), 2, 16, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, lodRange) == 0);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, lod0ClusterType) == 2);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, lod1ClusterType) == 3);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, lod2ClusterType) == 4);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, pad0) == 5);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, distributionType) == 7);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, baseDensity) == 8);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, model0Name) == 12);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, flatTextureName) == 44);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, billboardTextureName) == 108);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, normalInfluence) == 172);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, inclinationMax) == 173);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, inclinationJitter) == 174);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, scaleBaseMin) == 175);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, scaleBaseMax) == 176);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, scaleHeightMin) == 177);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, scaleHeightMax) == 178);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, colorShade1_r) == 179);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, colorShade1_g) == 180);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, colorShade1_b) == 181);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, colorShade2_r) == 182);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, colorShade2_g) == 183);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, colorShade2_b) == 184);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, flatSplitType) == 185);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, flatBladeCount) == 186);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, flatSlant) == 187);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, flatRadius) == 188);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, castShadow) == 192);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, windAmplitude) == 193);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, pad1) == 194);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, windCycle) == 195);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, orientationAngle) == 196);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, orientationRange) == 200);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, spacing) == 204);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, dithering) == 208);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, pad) == 209);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, simpleModelName) == 212);
+static_assert(offsetof(paramdef::GRASS_TYPE_PARAM_ST, model1Name) == 244);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,294 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../HIT_EFFECT_SE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::HIT_EFFECT_SE_PARAM_ST> {
+    using T = paramdef::HIT_EFFECT_SE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 136> fields = {{
+        { "Iron_Slash_S", field_type::s32, offsetof(T, Iron_Slash_S), 4, 1, nullptr },
+        { "Iron_Slash_L", field_type::s32, offsetof(T, Iron_Slash_L), 4, 1, nullptr },
+        { "Iron_Slash_LL", field_type::s32, offsetof(T, Iron_Slash_LL), 4, 1, nullptr },
+        { "Iron_Thrust_S", field_type::s32, offsetof(T, Iron_Thrust_S), 4, 1, nullptr },
+        { "Iron_Thrust_L", field_type::s32, offsetof(T, Iron_Thrust_L), 4, 1, nullptr },
+        { "Iron_Thrust_LL", field_type::s32, offsetof(T, Iron_Thrust_LL), 4, 1, nullptr },
+        { "Iron_Blow_S", field_type::s32, offsetof(T, Iron_Blow_S), 4, 1, nullptr },
+        { "Iron_Blow_L", field_type::s32, offsetof(T, Iron_Blow_L), 4, 1, nullptr },
+        { "Iron_Blow_LL", field_type::s32, offsetof(T, Iron_Blow_LL), 4, 1, nullptr },
+        { "Fire_Slash_S", field_type::s32, offsetof(T, Fire_Slash_S), 4, 1, nullptr },
+        { "Fire_Slash_L", field_type::s32, offsetof(T, Fire_Slash_L), 4, 1, nullptr },
+        { "Fire_Slash_LL", field_type::s32, offsetof(T, Fire_Slash_LL), 4, 1, nullptr },
+        { "Fire_Thrust_S", field_type::s32, offsetof(T, Fire_Thrust_S), 4, 1, nullptr },
+        { "Fire_Thrust_L", field_type::s32, offsetof(T, Fire_Thrust_L), 4, 1, nullptr },
+        { "Fire_Thrust_LL", field_type::s32, offsetof(T, Fire_Thrust_LL), 4, 1, nullptr },
+        { "Fire_Blow_S", field_type::s32, offsetof(T, Fire_Blow_S), 4, 1, nullptr },
+        { "Fire_Blow_L", field_type::s32, offsetof(T, Fire_Blow_L), 4, 1, nullptr },
+        { "Fire_Blow_LL", field_type::s32, offsetof(T, Fire_Blow_LL), 4, 1, nullptr },
+        { "Wood_Slash_S", field_type::s32, offsetof(T, Wood_Slash_S), 4, 1, nullptr },
+        { "Wood_Slash_L", field_type::s32, offsetof(T, Wood_Slash_L), 4, 1, nullptr },
+        { "Wood_Slash_LL", field_type::s32, offsetof(T, Wood_Slash_LL), 4, 1, nullptr },
+        { "Wood_Thrust_S", field_type::s32, offsetof(T, Wood_Thrust_S), 4, 1, nullptr },
+        { "Wood_Thrust_L", field_type::s32, offsetof(T, Wood_Thrust_L), 4, 1, nullptr },
+        { "Wood_Thrust_LL", field_type::s32, offsetof(T, Wood_Thrust_LL), 4, 1, nullptr },
+        { "Wood_Blow_S", field_type::s32, offsetof(T, Wood_Blow_S), 4, 1, nullptr },
+        { "Wood_Blow_L", field_type::s32, offsetof(T, Wood_Blow_L), 4, 1, nullptr },
+        { "Wood_Blow_LL", field_type::s32, offsetof(T, Wood_Blow_LL), 4, 1, nullptr },
+        { "Body_Slash_S", field_type::s32, offsetof(T, Body_Slash_S), 4, 1, nullptr },
+        { "Body_Slash_L", field_type::s32, offsetof(T, Body_Slash_L), 4, 1, nullptr },
+        { "Body_Slash_LL", field_type::s32, offsetof(T, Body_Slash_LL), 4, 1, nullptr },
+        { "Body_Thrust_S", field_type::s32, offsetof(T, Body_Thrust_S), 4, 1, nullptr },
+        { "Body_Thrust_L", field_type::s32, offsetof(T, Body_Thrust_L), 4, 1, nullptr },
+        { "Body_Thrust_LL", field_type::s32, offsetof(T, Body_Thrust_LL), 4, 1, nullptr },
+        { "Body_Blow_S", field_type::s32, offsetof(T, Body_Blow_S), 4, 1, nullptr },
+        { "Body_Blow_L", field_type::s32, offsetof(T, Body_Blow_L), 4, 1, nullptr },
+        { "Body_Blow_LL", field_type::s32, offsetof(T, Body_Blow_LL), 4, 1, nullptr },
+        { "Eclipse_Slash_S", field_type::s32, offsetof(T, Eclipse_Slash_S), 4, 1, nullptr },
+        { "Eclipse_Slash_L", field_type::s32, offsetof(T, Eclipse_Slash_L), 4, 1, nullptr },
+        { "Eclipse_Slash_LL", field_type::s32, offsetof(T, Eclipse_Slash_LL), 4, 1, nullptr },
+        { "Eclipse_Thrust_S", field_type::s32, offsetof(T, Eclipse_Thrust_S), 4, 1, nullptr },
+        { "Eclipse_Thrust_L", field_type::s32, offsetof(T, Eclipse_Thrust_L), 4, 1, nullptr },
+        { "Eclipse_Thrust_LL", field_type::s32, offsetof(T, Eclipse_Thrust_LL), 4, 1, nullptr },
+        { "Eclipse_Blow_S", field_type::s32, offsetof(T, Eclipse_Blow_S), 4, 1, nullptr },
+        { "Eclipse_Blow_L", field_type::s32, offsetof(T, Eclipse_Blow_L), 4, 1, nullptr },
+        { "Eclipse_Blow_LL", field_type::s32, offsetof(T, Eclipse_Blow_LL), 4, 1, nullptr },
+        { "Energy_Slash_S", field_type::s32, offsetof(T, Energy_Slash_S), 4, 1, nullptr },
+        { "Energy_Slash_L", field_type::s32, offsetof(T, Energy_Slash_L), 4, 1, nullptr },
+        { "Energy_Slash_LL", field_type::s32, offsetof(T, Energy_Slash_LL), 4, 1, nullptr },
+        { "Energy_Thrust_S", field_type::s32, offsetof(T, Energy_Thrust_S), 4, 1, nullptr },
+        { "Energy_Thrust_L", field_type::s32, offsetof(T, Energy_Thrust_L), 4, 1, nullptr },
+        { "Energy_Thrust_LL", field_type::s32, offsetof(T, Energy_Thrust_LL), 4, 1, nullptr },
+        { "Energy_Blow_S", field_type::s32, offsetof(T, Energy_Blow_S), 4, 1, nullptr },
+        { "Energy_Blow_L", field_type::s32, offsetof(T, Energy_Blow_L), 4, 1, nullptr },
+        { "Energy_Blow_LL", field_type::s32, offsetof(T, Energy_Blow_LL), 4, 1, nullptr },
+        { "None_Slash_S", field_type::s32, offsetof(T, None_Slash_S), 4, 1, nullptr },
+        { "None_Slash_L", field_type::s32, offsetof(T, None_Slash_L), 4, 1, nullptr },
+        { "None_Slash_LL", field_type::s32, offsetof(T, None_Slash_LL), 4, 1, nullptr },
+        { "None_Thrust_S", field_type::s32, offsetof(T, None_Thrust_S), 4, 1, nullptr },
+        { "None_Thrust_L", field_type::s32, offsetof(T, None_Thrust_L), 4, 1, nullptr },
+        { "None_Thrust_LL", field_type::s32, offsetof(T, None_Thrust_LL), 4, 1, nullptr },
+        { "None_Blow_S", field_type::s32, offsetof(T, None_Blow_S), 4, 1, nullptr },
+        { "None_Blow_L", field_type::s32, offsetof(T, None_Blow_L), 4, 1, nullptr },
+        { "None_Blow_LL", field_type::s32, offsetof(T, None_Blow_LL), 4, 1, nullptr },
+        { "Dmy1_Slash_S", field_type::s32, offsetof(T, Dmy1_Slash_S), 4, 1, nullptr },
+        { "Dmy1_Slash_L", field_type::s32, offsetof(T, Dmy1_Slash_L), 4, 1, nullptr },
+        { "Dmy1_Slash_LL", field_type::s32, offsetof(T, Dmy1_Slash_LL), 4, 1, nullptr },
+        { "Dmy1_Thrust_S", field_type::s32, offsetof(T, Dmy1_Thrust_S), 4, 1, nullptr },
+        { "Dmy1_Thrust_L", field_type::s32, offsetof(T, Dmy1_Thrust_L), 4, 1, nullptr },
+        { "Dmy1_Thrust_LL", field_type::s32, offsetof(T, Dmy1_Thrust_LL), 4, 1, nullptr },
+        { "Dmy1_Blow_S", field_type::s32, offsetof(T, Dmy1_Blow_S), 4, 1, nullptr },
+        { "Dmy1_Blow_L", field_type::s32, offsetof(T, Dmy1_Blow_L), 4, 1, nullptr },
+        { "Dmy1_Blow_LL", field_type::s32, offsetof(T, Dmy1_Blow_LL), 4, 1, nullptr },
+        { "Dmy2_Slash_S", field_type::s32, offsetof(T, Dmy2_Slash_S), 4, 1, nullptr },
+        { "Dmy2_Slash_L", field_type::s32, offsetof(T, Dmy2_Slash_L), 4, 1, nullptr },
+        { "Dmy2_Slash_LL", field_type::s32, offsetof(T, Dmy2_Slash_LL), 4, 1, nullptr },
+        { "Dmy2_Thrust_S", field_type::s32, offsetof(T, Dmy2_Thrust_S), 4, 1, nullptr },
+        { "Dmy2_Thrust_L", field_type::s32, offsetof(T, Dmy2_Thrust_L), 4, 1, nullptr },
+        { "Dmy2_Thrust_LL", field_type::s32, offsetof(T, Dmy2_Thrust_LL), 4, 1, nullptr },
+        { "Dmy2_Blow_S", field_type::s32, offsetof(T, Dmy2_Blow_S), 4, 1, nullptr },
+        { "Dmy2_Blow_L", field_type::s32, offsetof(T, Dmy2_Blow_L), 4, 1, nullptr },
+        { "Dmy2_Blow_LL", field_type::s32, offsetof(T, Dmy2_Blow_LL), 4, 1, nullptr },
+        { "Dmy3_Slash_S", field_type::s32, offsetof(T, Dmy3_Slash_S), 4, 1, nullptr },
+        { "Dmy3_Slash_L", field_type::s32, offsetof(T, Dmy3_Slash_L), 4, 1, nullptr },
+        { "Dmy3_Slash_LL", field_type::s32, offsetof(T, Dmy3_Slash_LL), 4, 1, nullptr },
+        { "Dmy3_Thrust_S", field_type::s32, offsetof(T, Dmy3_Thrust_S), 4, 1, nullptr },
+        { "Dmy3_Thrust_L", field_type::s32, offsetof(T, Dmy3_Thrust_L), 4, 1, nullptr },
+        { "Dmy3_Thrust_LL", field_type::s32, offsetof(T, Dmy3_Thrust_LL), 4, 1, nullptr },
+        { "Dmy3_Blow_S", field_type::s32, offsetof(T, Dmy3_Blow_S), 4, 1, nullptr },
+        { "Dmy3_Blow_L", field_type::s32, offsetof(T, Dmy3_Blow_L), 4, 1, nullptr },
+        { "Dmy3_Blow_LL", field_type::s32, offsetof(T, Dmy3_Blow_LL), 4, 1, nullptr },
+        { "Maggot_Slash_S", field_type::s32, offsetof(T, Maggot_Slash_S), 4, 1, nullptr },
+        { "Maggot_Slash_L", field_type::s32, offsetof(T, Maggot_Slash_L), 4, 1, nullptr },
+        { "Maggot_Slash_LL", field_type::s32, offsetof(T, Maggot_Slash_LL), 4, 1, nullptr },
+        { "Maggot_Thrust_S", field_type::s32, offsetof(T, Maggot_Thrust_S), 4, 1, nullptr },
+        { "Maggot_Thrust_L", field_type::s32, offsetof(T, Maggot_Thrust_L), 4, 1, nullptr },
+        { "Maggot_Thrust_LL", field_type::s32, offsetof(T, Maggot_Thrust_LL), 4, 1, nullptr },
+        { "Maggot_Blow_S", field_type::s32, offsetof(T, Maggot_Blow_S), 4, 1, nullptr },
+        { "Maggot_Blow_L", field_type::s32, offsetof(T, Maggot_Blow_L), 4, 1, nullptr },
+        { "Maggot_Blow_LL", field_type::s32, offsetof(T, Maggot_Blow_LL), 4, 1, nullptr },
+        { "Wax_Slash_S", field_type::s32, offsetof(T, Wax_Slash_S), 4, 1, nullptr },
+        { "Wax_Slash_L", field_type::s32, offsetof(T, Wax_Slash_L), 4, 1, nullptr },
+        { "Wax_Slash_LL", field_type::s32, offsetof(T, Wax_Slash_LL), 4, 1, nullptr },
+        { "Wax_Thrust_S", field_type::s32, offsetof(T, Wax_Thrust_S), 4, 1, nullptr },
+        { "Wax_Thrust_L", field_type::s32, offsetof(T, Wax_Thrust_L), 4, 1, nullptr },
+        { "Wax_Thrust_LL", field_type::s32, offsetof(T, Wax_Thrust_LL), 4, 1, nullptr },
+        { "Wax_Blow_S", field_type::s32, offsetof(T, Wax_Blow_S), 4, 1, nullptr },
+        { "Wax_Blow_L", field_type::s32, offsetof(T, Wax_Blow_L), 4, 1, nullptr },
+        { "Wax_Blow_LL", field_type::s32, offsetof(T, Wax_Blow_LL), 4, 1, nullptr },
+        { "FireFlame_Slash_S", field_type::s32, offsetof(T, FireFlame_Slash_S), 4, 1, nullptr },
+        { "FireFlame_Slash_L", field_type::s32, offsetof(T, FireFlame_Slash_L), 4, 1, nullptr },
+        { "FireFlame_Slash_LL", field_type::s32, offsetof(T, FireFlame_Slash_LL), 4, 1, nullptr },
+        { "FireFlame_Thrust_S", field_type::s32, offsetof(T, FireFlame_Thrust_S), 4, 1, nullptr },
+        { "FireFlame_Thrust_L", field_type::s32, offsetof(T, FireFlame_Thrust_L), 4, 1, nullptr },
+        { "FireFlame_Thrust_LL", field_type::s32, offsetof(T, FireFlame_Thrust_LL), 4, 1, nullptr },
+        { "FireFlame_Blow_S", field_type::s32, offsetof(T, FireFlame_Blow_S), 4, 1, nullptr },
+        { "FireFlame_Blow_L", field_type::s32, offsetof(T, FireFlame_Blow_L), 4, 1, nullptr },
+        { "FireFlame_Blow_LL", field_type::s32, offsetof(T, FireFlame_Blow_LL), 4, 1, nullptr },
+        { "EclipseGas_Slash_S", field_type::s32, offsetof(T, EclipseGas_Slash_S), 4, 1, nullptr },
+        { "EclipseGas_Slash_L", field_type::s32, offsetof(T, EclipseGas_Slash_L), 4, 1, nullptr },
+        { "EclipseGas_Slash_LL", field_type::s32, offsetof(T, EclipseGas_Slash_LL), 4, 1, nullptr },
+        { "EclipseGas_Thrust_S", field_type::s32, offsetof(T, EclipseGas_Thrust_S), 4, 1, nullptr },
+        { "EclipseGas_Thrust_L", field_type::s32, offsetof(T, EclipseGas_Thrust_L), 4, 1, nullptr },
+        { "EclipseGas_Thrust_LL", field_type::s32, offsetof(T, EclipseGas_Thrust_LL), 4, 1, nullptr },
+        { "EclipseGas_Blow_S", field_type::s32, offsetof(T, EclipseGas_Blow_S), 4, 1, nullptr },
+        { "EclipseGas_Blow_L", field_type::s32, offsetof(T, EclipseGas_Blow_L), 4, 1, nullptr },
+        { "EclipseGas_Blow_LL", field_type::s32, offsetof(T, EclipseGas_Blow_LL), 4, 1, nullptr },
+        { "EnergyStrong_Slash_S", field_type::s32, offsetof(T, EnergyStrong_Slash_S), 4, 1, nullptr },
+        { "EnergyStrong_Slash_L", field_type::s32, offsetof(T, EnergyStrong_Slash_L), 4, 1, nullptr },
+        { "EnergyStrong_Slash_LL", field_type::s32, offsetof(T, EnergyStrong_Slash_LL), 4, 1, nullptr },
+        { "EnergyStrong_Thrust_S", field_type::s32, offsetof(T, EnergyStrong_Thrust_S), 4, 1, nullptr },
+        { "EnergyStrong_Thrust_L", field_type::s32, offsetof(T, EnergyStrong_Thrust_L), 4, 1, nullptr },
+        { "EnergyStrong_Thrust_LL", field_type::s32, offsetof(T, EnergyStrong_Thrust_LL), 4, 1, nullptr },
+        { "EnergyStrong_Blow_S", field_type::s32, offsetof(T, EnergyStrong_Blow_S), 4, 1, nullptr },
+        { "EnergyStrong_Blow_L", field_type::s32, offsetof(T, EnergyStrong_Blow_L), 4, 1, nullptr },
+        { "EnergyStrong_Blow_LL", field_type::s32, offsetof(T, EnergyStrong_Blow_LL), 4, 1, nullptr },
+        { "reserve", field_type::u8, offsetof(T, reserve), 1, 100, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Iron_Slash_S) == 0);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Iron_Slash_L) == 4);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Iron_Slash_LL) == 8);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Iron_Thrust_S) == 12);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Iron_Thrust_L) == 16);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Iron_Thrust_LL) == 20);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Iron_Blow_S) == 24);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Iron_Blow_L) == 28);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Iron_Blow_LL) == 32);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Fire_Slash_S) == 36);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Fire_Slash_L) == 40);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Fire_Slash_LL) == 44);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Fire_Thrust_S) == 48);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Fire_Thrust_L) == 52);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Fire_Thrust_LL) == 56);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Fire_Blow_S) == 60);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Fire_Blow_L) == 64);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Fire_Blow_LL) == 68);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wood_Slash_S) == 72);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wood_Slash_L) == 76);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wood_Slash_LL) == 80);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wood_Thrust_S) == 84);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wood_Thrust_L) == 88);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wood_Thrust_LL) == 92);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wood_Blow_S) == 96);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wood_Blow_L) == 100);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wood_Blow_LL) == 104);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Body_Slash_S) == 108);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Body_Slash_L) == 112);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Body_Slash_LL) == 116);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Body_Thrust_S) == 120);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Body_Thrust_L) == 124);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Body_Thrust_LL) == 128);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Body_Blow_S) == 132);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Body_Blow_L) == 136);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Body_Blow_LL) == 140);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Eclipse_Slash_S) == 144);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Eclipse_Slash_L) == 148);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Eclipse_Slash_LL) == 152);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Eclipse_Thrust_S) == 156);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Eclipse_Thrust_L) == 160);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Eclipse_Thrust_LL) == 164);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Eclipse_Blow_S) == 168);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Eclipse_Blow_L) == 172);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Eclipse_Blow_LL) == 176);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Energy_Slash_S) == 180);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Energy_Slash_L) == 184);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Energy_Slash_LL) == 188);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Energy_Thrust_S) == 192);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Energy_Thrust_L) == 196);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Energy_Thrust_LL) == 200);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Energy_Blow_S) == 204);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Energy_Blow_L) == 208);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Energy_Blow_LL) == 212);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, None_Slash_S) == 216);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, None_Slash_L) == 220);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, None_Slash_LL) == 224);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, None_Thrust_S) == 228);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, None_Thrust_L) == 232);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, None_Thrust_LL) == 236);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, None_Blow_S) == 240);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, None_Blow_L) == 244);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, None_Blow_LL) == 248);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy1_Slash_S) == 252);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy1_Slash_L) == 256);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy1_Slash_LL) == 260);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy1_Thrust_S) == 264);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy1_Thrust_L) == 268);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy1_Thrust_LL) == 272);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy1_Blow_S) == 276);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy1_Blow_L) == 280);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy1_Blow_LL) == 284);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy2_Slash_S) == 288);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy2_Slash_L) == 292);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy2_Slash_LL) == 296);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy2_Thrust_S) == 300);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy2_Thrust_L) == 304);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy2_Thrust_LL) == 308);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy2_Blow_S) == 312);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy2_Blow_L) == 316);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy2_Blow_LL) == 320);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy3_Slash_S) == 324);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy3_Slash_L) == 328);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy3_Slash_LL) == 332);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy3_Thrust_S) == 336);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy3_Thrust_L) == 340);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy3_Thrust_LL) == 344);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy3_Blow_S) == 348);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy3_Blow_L) == 352);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Dmy3_Blow_LL) == 356);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Maggot_Slash_S) == 360);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Maggot_Slash_L) == 364);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Maggot_Slash_LL) == 368);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Maggot_Thrust_S) == 372);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Maggot_Thrust_L) == 376);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Maggot_Thrust_LL) == 380);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Maggot_Blow_S) == 384);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Maggot_Blow_L) == 388);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Maggot_Blow_LL) == 392);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wax_Slash_S) == 396);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wax_Slash_L) == 400);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wax_Slash_LL) == 404);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wax_Thrust_S) == 408);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wax_Thrust_L) == 412);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wax_Thrust_LL) == 416);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wax_Blow_S) == 420);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wax_Blow_L) == 424);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, Wax_Blow_LL) == 428);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, FireFlame_Slash_S) == 432);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, FireFlame_Slash_L) == 436);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, FireFlame_Slash_LL) == 440);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, FireFlame_Thrust_S) == 444);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, FireFlame_Thrust_L) == 448);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, FireFlame_Thrust_LL) == 452);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, FireFlame_Blow_S) == 456);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, FireFlame_Blow_L) == 460);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, FireFlame_Blow_LL) == 464);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EclipseGas_Slash_S) == 468);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EclipseGas_Slash_L) == 472);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EclipseGas_Slash_LL) == 476);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EclipseGas_Thrust_S) == 480);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EclipseGas_Thrust_L) == 484);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EclipseGas_Thrust_LL) == 488);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EclipseGas_Blow_S) == 492);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EclipseGas_Blow_L) == 496);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EclipseGas_Blow_LL) == 500);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EnergyStrong_Slash_S) == 504);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EnergyStrong_Slash_L) == 508);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EnergyStrong_Slash_LL) == 512);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EnergyStrong_Thrust_S) == 516);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EnergyStrong_Thrust_L) == 520);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EnergyStrong_Thrust_LL) == 524);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EnergyStrong_Blow_S) == 528);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EnergyStrong_Blow_L) == 532);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, EnergyStrong_Blow_LL) == 536);
+static_assert(offsetof(paramdef::HIT_EFFECT_SE_PARAM_ST, reserve) == 540);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,50 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../HIT_EFFECT_SFX_CONCEPT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST> {
+    using T = paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 14> fields = {{
+        { "atkIron_1", field_type::s16, offsetof(T, atkIron_1), 2, 1, nullptr },
+        { "atkIron_2", field_type::s16, offsetof(T, atkIron_2), 2, 1, nullptr },
+        { "atkLeather_1", field_type::s16, offsetof(T, atkLeather_1), 2, 1, nullptr },
+        { "atkLeather_2", field_type::s16, offsetof(T, atkLeather_2), 2, 1, nullptr },
+        { "atkWood_1", field_type::s16, offsetof(T, atkWood_1), 2, 1, nullptr },
+        { "atkWood_2", field_type::s16, offsetof(T, atkWood_2), 2, 1, nullptr },
+        { "atkBody_1", field_type::s16, offsetof(T, atkBody_1), 2, 1, nullptr },
+        { "atkBody_2", field_type::s16, offsetof(T, atkBody_2), 2, 1, nullptr },
+        { "atkStone_1", field_type::s16, offsetof(T, atkStone_1), 2, 1, nullptr },
+        { "atkStone_2", field_type::s16, offsetof(T, atkStone_2), 2, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 4, nullptr },
+        { "atkNone_1", field_type::s16, offsetof(T, atkNone_1), 2, 1, nullptr },
+        { "atkNone_2", field_type::s16, offsetof(T, atkNone_2), 2, 1, nullptr },
+        { "reserve", field_type::u8, offsetof(T, reserve), 1, 52, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkIron_1) == 0);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkIron_2) == 2);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkLeather_1) == 4);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkLeather_2) == 6);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkWood_1) == 8);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkWood_2) == 10);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkBody_1) == 12);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkBody_2) == 14);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkStone_1) == 16);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkStone_2) == 18);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, pad) == 20);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkNone_1) == 24);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, atkNone_2) == 26);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_CONCEPT_PARAM_ST, reserve) == 28);
+
+}; // namespace params
+}; // namespace from
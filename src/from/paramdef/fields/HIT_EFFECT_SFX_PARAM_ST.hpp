@@ -0,0 +1,62 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../HIT_EFFECT_SFX_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::HIT_EFFECT_SFX_PARAM_ST> {
+    using T = paramdef::HIT_EFFECT_SFX_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 20> fields = {{
+        { "Slash_Normal", field_type::s32, offsetof(T, Slash_Normal), 4, 1, nullptr },
+        { "Slash_S", field_type::s32, offsetof(T, Slash_S), 4, 1, nullptr },
+        { "Slash_L", field_type::s32, offsetof(T, Slash_L), 4, 1, nullptr },
+        { "Slash_Specific1", field_type::s32, offsetof(T, Slash_Specific1), 4, 1, nullptr },
+        { "Slash_Specific2", field_type::s32, offsetof(T, Slash_Specific2), 4, 1, nullptr },
+        { "Blow_Normal", field_type::s32, offsetof(T, Blow_Normal), 4, 1, nullptr },
+        { "Blow_S", field_type::s32, offsetof(T, Blow_S), 4, 1, nullptr },
+        { "Blow_L", field_type::s32, offsetof(T, Blow_L), 4, 1, nullptr },
+        { "Blow_Specific1", field_type::s32, offsetof(T, Blow_Specific1), 4, 1, nullptr },
+        { "Blow_Specific2", field_type::s32, offsetof(T, Blow_Specific2), 4, 1, nullptr },
+        { "Thrust_Normal", field_type::s32, offsetof(T, Thrust_Normal), 4, 1, nullptr },
+        { "Thrust_S", field_type::s32, offsetof(T, Thrust_S), 4, 1, nullptr },
+        { "Thrust_L", field_type::s32, offsetof(T, Thrust_L), 4, 1, nullptr },
+        { "Thrust_Specific1", field_type::s32, offsetof(T, Thrust_Specific1), 4, 1, nullptr },
+        { "Thrust_Specific2", field_type::s32, offsetof(T, Thrust_Specific2), 4, 1, nullptr },
+        { "Neutral_Normal", field_type::s32, offsetof(T, Neutral_Normal), 4, 1, nullptr },
+        { "Neutral_S", field_type::s32, offsetof(T, Neutral_S), 4, 1, nullptr },
+        { "Neutral_L", field_type::s32, offsetof(T, Neutral_L), 4, 1, nullptr },
+        { "Neutral_Specific1", field_type::s32, offsetof(T, Neutral_Specific1), 4, 1, nullptr },
+        { "Neutral_Specific2", field_type::s32, offsetof(T, Neutral_Specific2), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Slash_Normal) == 0);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Slash_S) == 4);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Slash_L) == 8);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Slash_Specific1) == 12);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Slash_Specific2) == 16);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Blow_Normal) == 20);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Blow_S) == 24);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Blow_L) == 28);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Blow_Specific1) == 32);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Blow_Specific2) == 36);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Thrust_Normal) == 40);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Thrust_S) == 44);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Thrust_L) == 48);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Thrust_Specific1) == 52);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Thrust_Specific2) == 56);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Neutral_Normal) == 60);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Neutral_S) == 64);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Neutral_L) == 68);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Neutral_Specific1) == 72);
+static_assert(offsetof(paramdef::HIT_EFFECT_SFX_PARAM_ST, Neutral_Specific2) == 76);
+
+}; // namespace params
+}; // namespace from
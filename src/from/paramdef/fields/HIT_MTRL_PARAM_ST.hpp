@@ -0,0 +1,79 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../HIT_MTRL_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::HIT_MTRL_PARAM_ST> {
+    using T = paramdef::HIT_MTRL_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 31> fields = {{
+        { "aiVolumeRate", field_type::f32, offsetof(T, aiVolumeRate), 4, 1, nullptr },
+        { "spEffectIdOnHit0", field_type::s32, offsetof(T, spEffectIdOnHit0), 4, 1, nullptr },
+        { "spEffectIdOnHit1", field_type::s32, offsetof(T, spEffectIdOnHit1), 4, 1, nullptr },
+        { "footEffectHeightType", field_type::u8, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->footEffectHeightType; } },
+        { "footEffectDirType", field_type::u8, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->footEffectDirType; } },
+        { "floorHeightType", field_type::u8, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->floorHeightType; } },
+        { "disableFallDamage", field_type::boolean, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableFallDamage; } },
+        { "isHardnessForSoundReverb", field_type::boolean, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHardnessForSoundReverb; } },
+        { "hardnessType", field_type::u8, offsetof(T, hardnessType), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 6, nullptr },
+        { "spEffectIdOnHit0_ClearCount_2", field_type::s32, offsetof(T, spEffectIdOnHit0_ClearCount_2), 4, 1, nullptr },
+        { "spEffectIdOnHit0_ClearCount_3", field_type::s32, offsetof(T, spEffectIdOnHit0_ClearCount_3), 4, 1, nullptr },
+        { "spEffectIdOnHit0_ClearCount_4", field_type::s32, offsetof(T, spEffectIdOnHit0_ClearCount_4), 4, 1, nullptr },
+        { "spEffectIdOnHit0_ClearCount_5", field_type::s32, offsetof(T, spEffectIdOnHit0_ClearCount_5), 4, 1, nullptr },
+        { "spEffectIdOnHit0_ClearCount_6", field_type::s32, offsetof(T, spEffectIdOnHit0_ClearCount_6), 4, 1, nullptr },
+        { "spEffectIdOnHit0_ClearCount_7", field_type::s32, offsetof(T, spEffectIdOnHit0_ClearCount_7), 4, 1, nullptr },
+        { "spEffectIdOnHit0_ClearCount_8", field_type::s32, offsetof(T, spEffectIdOnHit0_ClearCount_8), 4, 1, nullptr },
+        { "spEffectIdOnHit1_ClearCount_2", field_type::s32, offsetof(T, spEffectIdOnHit1_ClearCount_2), 4, 1, nullptr },
+        { "spEffectIdOnHit1_ClearCount_3", field_type::s32, offsetof(T, spEffectIdOnHit1_ClearCount_3), 4, 1, nullptr },
+        { "spEffectIdOnHit1_ClearCount_4", field_type::s32, offsetof(T, spEffectIdOnHit1_ClearCount_4), 4, 1, nullptr },
+        { "spEffectIdOnHit1_ClearCount_5", field_type::s32, offsetof(T, spEffectIdOnHit1_ClearCount_5), 4, 1, nullptr },
+        { "spEffectIdOnHit1_ClearCount_6", field_type::s32, offsetof(T, spEffectIdOnHit1_ClearCount_6), 4, 1, nullptr },
+        { "spEffectIdOnHit1_ClearCount_7", field_type::s32, offsetof(T, spEffectIdOnHit1_ClearCount_7), 4, 1, nullptr },
+        { "spEffectIdOnHit1_ClearCount_8", field_type::s32, offsetof(T, spEffectIdOnHit1_ClearCount_8), 4, 1, nullptr },
+        { "replaceMateiralId_Rain", field_type::s16, offsetof(T, replaceMateiralId_Rain), 2, 1, nullptr },
+        { "pad4", field_type::u8, offsetof(T, pad4), 1, 2, nullptr },
+        { "spEffectId_forWet00", field_type::s32, offsetof(T, spEffectId_forWet00), 4, 1, nullptr },
+        { "spEffectId_forWet01", field_type::s32, offsetof(T, spEffectId_forWet01), 4, 1, nullptr },
+        { "spEffectId_forWet02", field_type::s32, offsetof(T, spEffectId_forWet02), 4, 1, nullptr },
+        { "spEffectId_forWet03", field_type::s32, offsetof(T, spEffectId_forWet03), 4, 1, nullptr },
+        { "spEffectId_forWet04", field_type::s32, offsetof(T, spEffectId_forWet04), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, aiVolumeRate) == 0);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit0) == 4);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit1) == 8);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, hardnessType) == 13);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, pad2) == 14);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit0_ClearCount_2) == 20);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit0_ClearCount_3) == 24);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit0_ClearCount_4) == 28);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit0_ClearCount_5) == 32);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit0_ClearCount_6) == 36);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit0_ClearCount_7) == 40);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit0_ClearCount_8) == 44);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit1_ClearCount_2) == 48);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit1_ClearCount_3) == 52);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit1_ClearCount_4) == 56);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit1_ClearCount_5) == 60);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit1_ClearCount_6) == 64);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit1_ClearCount_7) == 68);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectIdOnHit1_ClearCount_8) == 72);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, replaceMateiralId_Rain) == 76);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, pad4) == 78);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectId_forWet00) == 80);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectId_forWet01) == 84);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectId_forWet02) == 88);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectId_forWet03) == 92);
+static_assert(offsetof(paramdef::HIT_MTRL_PARAM_ST, spEffectId_forWet04) == 96);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,149 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../ITEMLOT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::ITEMLOT_PARAM_ST> {
+    using T = paramdef::ITEMLOT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 73> fields = {{
+        { "lotItemId01", field_type::s32, offsetof(T, lotItemId01), 4, 1, nullptr },
+        { "lotItemId02", field_type::s32, offsetof(T, lotItemId02), 4, 1, nullptr },
+        { "lotItemId03", field_type::s32, offsetof(T, lotItemId03), 4, 1, nullptr },
+        { "lotItemId04", field_type::s32, offsetof(T, lotItemId04), 4, 1, nullptr },
+        { "lotItemId05", field_type::s32, offsetof(T, lotItemId05), 4, 1, nullptr },
+        { "lotItemId06", field_type::s32, offsetof(T, lotItemId06), 4, 1, nullptr },
+        { "lotItemId07", field_type::s32, offsetof(T, lotItemId07), 4, 1, nullptr },
+        { "lotItemId08", field_type::s32, offsetof(T, lotItemId08), 4, 1, nullptr },
+        { "lotItemCategory01", field_type::s32, offsetof(T, lotItemCategory01), 4, 1, nullptr },
+        { "lotItemCategory02", field_type::s32, offsetof(T, lotItemCategory02), 4, 1, nullptr },
+        { "lotItemCategory03", field_type::s32, offsetof(T, lotItemCategory03), 4, 1, nullptr },
+        { "lotItemCategory04", field_type::s32, offsetof(T, lotItemCategory04), 4, 1, nullptr },
+        { "lotItemCategory05", field_type::s32, offsetof(T, lotItemCategory05), 4, 1, nullptr },
+        { "lotItemCategory06", field_type::s32, offsetof(T, lotItemCategory06), 4, 1, nullptr },
+        { "lotItemCategory07", field_type::s32, offsetof(T, lotItemCategory07), 4, 1, nullptr },
+        { "lotItemCategory08", field_type::s32, offsetof(T, lotItemCategory08), 4, 1, nullptr },
+        { "lotItemBasePoint01", field_type::u16, offsetof(T, lotItemBasePoint01), 2, 1, nullptr },
+        { "lotItemBasePoint02", field_type::u16, offsetof(T, lotItemBasePoint02), 2, 1, nullptr },
+        { "lotItemBasePoint03", field_type::u16, offsetof(T, lotItemBasePoint03), 2, 1, nullptr },
+        { "lotItemBasePoint04", field_type::u16, offsetof(T, lotItemBasePoint04), 2, 1, nullptr },
+        { "lotItemBasePoint05", field_type::u16, offsetof(T, lotItemBasePoint05), 2, 1, nullptr },
+        { "lotItemBasePoint06", field_type::u16, offsetof(T, lotItemBasePoint06), 2, 1, nullptr },
+        { "lotItemBasePoint07", field_type::u16, offsetof(T, lotItemBasePoint07), 2, 1, nullptr },
+        { "lotItemBasePoint08", field_type::u16, offsetof(T, lotItemBasePoint08), 2, 1, nullptr },
+        { "cumulateLotPoint01", field_type::u16, offsetof(T, cumulateLotPoint01), 2, 1, nullptr },
+        { "cumulateLotPoint02", field_type::u16, offsetof(T, cumulateLotPoint02), 2, 1, nullptr },
+        { "cumulateLotPoint03", field_type::u16, offsetof(T, cumulateLotPoint03), 2, 1, nullptr },
+        { "cumulateLotPoint04", field_type::u16, offsetof(T, cumulateLotPoint04), 2, 1, nullptr },
+        { "cumulateLotPoint05", field_type::u16, offsetof(T, cumulateLotPoint05), 2, 1, nullptr },
+        { "cumulateLotPoint06", field_type::u16, offsetof(T, cumulateLotPoint06), 2, 1, nullptr },
+        { "cumulateLotPoint07", field_type::u16, offsetof(T, cumulateLotPoint07), 2, 1, nullptr },
+        { "cumulateLotPoint08", field_type::u16, offsetof(T, cumulateLotPoint08), 2, 1, nullptr },
+        { "getItemFlagId01", field_type::u32, offsetof(T, getItemFlagId01), 4, 1, nullptr },
+        { "getItemFlagId02", field_type::u32, offsetof(T, getItemFlagId02), 4, 1, nullptr },
+        { "getItemFlagId03", field_type::u32, offsetof(T, getItemFlagId03), 4, 1, nullptr },
+        { "getItemFlagId04", field_type::u32, offsetof(T, getItemFlagId04), 4, 1, nullptr },
+        { "getItemFlagId05", field_type::u32, offsetof(T, getItemFlagId05), 4, 1, nullptr },
+        { "getItemFlagId06", field_type::u32, offsetof(T, getItemFlagId06), 4, 1, nullptr },
+        { "getItemFlagId07", field_type::u32, offsetof(T, getItemFlagId07), 4, 1, nullptr },
+        { "getItemFlagId08", field_type::u32, offsetof(T, getItemFlagId08), 4, 1, nullptr },
+        { "getItemFlagId", field_type::u32, offsetof(T, getItemFlagId), 4, 1, nullptr },
+        { "cumulateNumFlagId", field_type::u32, offsetof(T, cumulateNumFlagId), 4, 1, nullptr },
+        { "cumulateNumMax", field_type::u8, offsetof(T, cumulateNumMax), 1, 1, nullptr },
+        { "lotItem_Rarity", field_type::s8, offsetof(T, lotItem_Rarity), 1, 1, nullptr },
+        { "lotItemNum01", field_type::u8, offsetof(T, lotItemNum01), 1, 1, nullptr },
+        { "lotItemNum02", field_type::u8, offsetof(T, lotItemNum02), 1, 1, nullptr },
+        { "lotItemNum03", field_type::u8, offsetof(T, lotItemNum03), 1, 1, nullptr },
+        { "lotItemNum04", field_type::u8, offsetof(T, lotItemNum04), 1, 1, nullptr },
+        { "lotItemNum05", field_type::u8, offsetof(T, lotItemNum05), 1, 1, nullptr },
+        { "lotItemNum06", field_type::u8, offsetof(T, lotItemNum06), 1, 1, nullptr },
+        { "lotItemNum07", field_type::u8, offsetof(T, lotItemNum07), 1, 1, nullptr },
+        { "lotItemNum08", field_type::u8, offsetof(T, lotItemNum08), 1, 1, nullptr },
+        { "enableLuck01", field_type::boolean, 146, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableLuck01; } },
+        { "enableLuck02", field_type::boolean, 146, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableLuck02; } },
+        { "enableLuck03", field_type::boolean, 146, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableLuck03; } },
+        { "enableLuck04", field_type::boolean, 146, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableLuck04; } },
+        { "enableLuck05", field_type::boolean, 146, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableLuck05; } },
+        { "enableLuck06", field_type::boolean, 146, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableLuck06; } },
+        { "enableLuck07", field_type::boolean, 146, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableLuck07; } },
+        { "enableLuck08", field_type::boolean, 146, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableLuck08; } },
+        { "cumulateReset01", field_type::boolean, 147, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->cumulateReset01; } },
+        { "cumulateReset02", field_type::boolean, 147, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->cumulateReset02; } },
+        { "cumulateReset03", field_type::boolean, 147, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->cumulateReset03; } },
+        { "cumulateReset04", field_type::boolean, 147, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->cumulateReset04; } },
+        { "cumulateReset05", field_type::boolean, 147, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->cumulateReset05; } },
+        { "cumulateReset06", field_type::boolean, 147, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->cumulateReset06; } },
+        { "cumulateReset07", field_type::boolean, 147, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->cumulateReset07; } },
+        { "cumulateReset08", field_type::boolean, 147, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->cumulateReset08; } },
+        { "GameClearOffset", field_type::s8, offsetof(T, GameClearOffset), 1, 1, nullptr },
+        { "canExecByFriendlyGhost", field_type::boolean, 149, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canExecByFriendlyGhost; } },
+        { "canExecByHostileGhost", field_type::boolean, 149, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->canExecByHostileGhost; } },
+        { "PAD1", field_type::u8, 149, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->PAD1; } },
+        { "PAD2", field_type::u16, offsetof(T, PAD2), 2, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemId01) == 0);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemId02) == 4);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemId03) == 8);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemId04) == 12);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemId05) == 16);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemId06) == 20);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemId07) == 24);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemId08) == 28);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemCategory01) == 32);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemCategory02) == 36);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemCategory03) == 40);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemCategory04) == 44);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemCategory05) == 48);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemCategory06) == 52);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemCategory07) == 56);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemCategory08) == 60);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemBasePoint01) == 64);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemBasePoint02) == 66);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemBasePoint03) == 68);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemBasePoint04) == 70);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemBasePoint05) == 72);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemBasePoint06) == 74);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemBasePoint07) == 76);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemBasePoint08) == 78);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, cumulateLotPoint01) == 80);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, cumulateLotPoint02) == 82);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, cumulateLotPoint03) == 84);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, cumulateLotPoint04) == 86);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, cumulateLotPoint05) == 88);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, cumulateLotPoint06) == 90);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, cumulateLotPoint07) == 92);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, cumulateLotPoint08) == 94);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, getItemFlagId01) == 96);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, getItemFlagId02) == 100);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, getItemFlagId03) == 104);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, getItemFlagId04) == 108);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, getItemFlagId05) == 112);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, getItemFlagId06) == 116);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, getItemFlagId07) == 120);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, getItemFlagId08) == 124);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, getItemFlagId) == 128);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, cumulateNumFlagId) == 132);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, cumulateNumMax) == 136);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItem_Rarity) == 137);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemNum01) == 138);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemNum02) == 139);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemNum03) == 140);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemNum04) == 141);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemNum05) == 142);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemNum06) == 143);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemNum07) == 144);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, lotItemNum08) == 145);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, GameClearOffset) == 148);
+static_assert(offsetof(paramdef::ITEMLOT_PARAM_ST, PAD2) == 150);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,34 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../KEY_ASSIGN_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::KEY_ASSIGN_PARAM_ST> {
+    using T = paramdef::KEY_ASSIGN_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 6> fields = {{
+        { "padKeyId", field_type::s32, offsetof(T, padKeyId), 4, 1, nullptr },
+        { "keyboardModifyKey", field_type::s32, offsetof(T, keyboardModifyKey), 4, 1, nullptr },
+        { "keyboardKeyId", field_type::s32, offsetof(T, keyboardKeyId), 4, 1, nullptr },
+        { "mouseModifyKey", field_type::s32, offsetof(T, mouseModifyKey), 4, 1, nullptr },
+        { "mouseKeyId", field_type::s32, offsetof(T, mouseKeyId), 4, 1, nullptr },
+        { "reserved", field_type::u8, offsetof(T, reserved), 1, 12, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::KEY_ASSIGN_PARAM_ST, padKeyId) == 0);
+static_assert(offsetof(paramdef::KEY_ASSIGN_PARAM_ST, keyboardModifyKey) == 4);
+static_assert(offsetof(paramdef::KEY_ASSIGN_PARAM_ST, keyboardKeyId) == 8);
+static_assert(offsetof(paramdef::KEY_ASSIGN_PARAM_ST, mouseModifyKey) == 12);
+static_assert(offsetof(paramdef::KEY_ASSIGN_PARAM_ST, mouseKeyId) == 16);
+static_assert(offsetof(paramdef::KEY_ASSIGN_PARAM_ST, reserved) == 20);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,84 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../KNOCKBACK_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::KNOCKBACK_PARAM_ST> {
+    using T = paramdef::KNOCKBACK_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 31> fields = {{
+        { "damage_Min_ContTime", field_type::f32, offsetof(T, damage_Min_ContTime), 4, 1, nullptr },
+        { "damage_S_ContTime", field_type::f32, offsetof(T, damage_S_ContTime), 4, 1, nullptr },
+        { "damage_M_ContTime", field_type::f32, offsetof(T, damage_M_ContTime), 4, 1, nullptr },
+        { "damage_L_ContTime", field_type::f32, offsetof(T, damage_L_ContTime), 4, 1, nullptr },
+        { "damage_BlowS_ContTime", field_type::f32, offsetof(T, damage_BlowS_ContTime), 4, 1, nullptr },
+        { "damage_BlowM_ContTime", field_type::f32, offsetof(T, damage_BlowM_ContTime), 4, 1, nullptr },
+        { "damage_Strike_ContTime", field_type::f32, offsetof(T, damage_Strike_ContTime), 4, 1, nullptr },
+        { "damage_Uppercut_ContTime", field_type::f32, offsetof(T, damage_Uppercut_ContTime), 4, 1, nullptr },
+        { "damage_Push_ContTime", field_type::f32, offsetof(T, damage_Push_ContTime), 4, 1, nullptr },
+        { "damage_Breath_ContTime", field_type::f32, offsetof(T, damage_Breath_ContTime), 4, 1, nullptr },
+        { "damage_HeadShot_ContTime", field_type::f32, offsetof(T, damage_HeadShot_ContTime), 4, 1, nullptr },
+        { "guard_S_ContTime", field_type::f32, offsetof(T, guard_S_ContTime), 4, 1, nullptr },
+        { "guard_L_ContTime", field_type::f32, offsetof(T, guard_L_ContTime), 4, 1, nullptr },
+        { "guard_LL_ContTime", field_type::f32, offsetof(T, guard_LL_ContTime), 4, 1, nullptr },
+        { "guardBrake_ContTime", field_type::f32, offsetof(T, guardBrake_ContTime), 4, 1, nullptr },
+        { "damage_Min_DecTime", field_type::f32, offsetof(T, damage_Min_DecTime), 4, 1, nullptr },
+        { "damage_S_DecTime", field_type::f32, offsetof(T, damage_S_DecTime), 4, 1, nullptr },
+        { "damage_M_DecTime", field_type::f32, offsetof(T, damage_M_DecTime), 4, 1, nullptr },
+        { "damage_L_DecTime", field_type::f32, offsetof(T, damage_L_DecTime), 4, 1, nullptr },
+        { "damage_BlowS_DecTime", field_type::f32, offsetof(T, damage_BlowS_DecTime), 4, 1, nullptr },
+        { "damage_BlowM_DecTime", field_type::f32, offsetof(T, damage_BlowM_DecTime), 4, 1, nullptr },
+        { "damage_Strike_DecTime", field_type::f32, offsetof(T, damage_Strike_DecTime), 4, 1, nullptr },
+        { "damage_Uppercut_DecTime", field_type::f32, offsetof(T, damage_Uppercut_DecTime), 4, 1, nullptr },
+        { "damage_Push_DecTime", field_type::f32, offsetof(T, damage_Push_DecTime), 4, 1, nullptr },
+        { "damage_Breath_DecTime", field_type::f32, offsetof(T, damage_Breath_DecTime), 4, 1, nullptr },
+        { "damage_HeadShot_DecTime", field_type::f32, offsetof(T, damage_HeadShot_DecTime), 4, 1, nullptr },
+        { "guard_S_DecTime", field_type::f32, offsetof(T, guard_S_DecTime), 4, 1, nullptr },
+        { "guard_L_DecTime", field_type::f32, offsetof(T, guard_L_DecTime), 4, 1, nullptr },
+        { "guard_LL_DecTime", field_type::f32, offsetof(T, guard_LL_DecTime), 4, 1, nullptr },
+        { "guardBrake_DecTime", field_type::f32, offsetof(T, guardBrake_DecTime), 4, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_Min_ContTime) == 0);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_S_ContTime) == 4);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_M_ContTime) == 8);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_L_ContTime) == 12);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_BlowS_ContTime) == 16);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_BlowM_ContTime) == 20);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_Strike_ContTime) == 24);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_Uppercut_ContTime) == 28);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_Push_ContTime) == 32);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_Breath_ContTime) == 36);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_HeadShot_ContTime) == 40);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, guard_S_ContTime) == 44);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, guard_L_ContTime) == 48);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, guard_LL_ContTime) == 52);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, guardBrake_ContTime) == 56);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_Min_DecTime) == 60);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_S_DecTime) == 64);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_M_DecTime) == 68);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_L_DecTime) == 72);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_BlowS_DecTime) == 76);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_BlowM_DecTime) == 80);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_Strike_DecTime) == 84);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_Uppercut_DecTime) == 88);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_Push_DecTime) == 92);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_Breath_DecTime) == 96);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, damage_HeadShot_DecTime) == 100);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, guard_S_DecTime) == 104);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, guard_L_DecTime) == 108);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, guard_LL_DecTime) == 112);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, guardBrake_DecTime) == 116);
+static_assert(offsetof(paramdef::KNOCKBACK_PARAM_ST, pad) == 120);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,32 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../KNOWLEDGE_LOADSCREEN_ITEM_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::KNOWLEDGE_LOADSCREEN_ITEM_PARAM_ST> {
+    using T = paramdef::KNOWLEDGE_LOADSCREEN_ITEM_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 6> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "unlockFlagId", field_type::u32, offsetof(T, unlockFlagId), 4, 1, nullptr },
+        { "invalidFlagId", field_type::u32, offsetof(T, invalidFlagId), 4, 1, nullptr },
+        { "msgId", field_type::s32, offsetof(T, msgId), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::KNOWLEDGE_LOADSCREEN_ITEM_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::KNOWLEDGE_LOADSCREEN_ITEM_PARAM_ST, unlockFlagId) == 4);
+static_assert(offsetof(paramdef::KNOWLEDGE_LOADSCREEN_ITEM_PARAM_ST, invalidFlagId) == 8);
+static_assert(offsetof(paramdef::KNOWLEDGE_LOADSCREEN_ITEM_PARAM_ST, msgId) == 12);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,60 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM> {
+    using T = paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM;
+
+    static constexpr std::array<field_descriptor, 19> fields = {{
+        { "TargetMapId", field_type::s32, offsetof(T, TargetMapId), 4, 1, nullptr },
+        { "TargetEventId", field_type::u32, offsetof(T, TargetEventId), 4, 1, nullptr },
+        { "SrcAssetId", field_type::s32, offsetof(T, SrcAssetId), 4, 1, nullptr },
+        { "SrcAssetPartsNo", field_type::s32, offsetof(T, SrcAssetPartsNo), 4, 1, nullptr },
+        { "DstAssetId", field_type::s32, offsetof(T, DstAssetId), 4, 1, nullptr },
+        { "DstAssetPartsNo", field_type::s32, offsetof(T, DstAssetPartsNo), 4, 1, nullptr },
+        { "SrcAssetIdRangeMin", field_type::s32, offsetof(T, SrcAssetIdRangeMin), 4, 1, nullptr },
+        { "SrcAssetIdRangeMax", field_type::s32, offsetof(T, SrcAssetIdRangeMax), 4, 1, nullptr },
+        { "DstAssetIdRangeMin", field_type::s32, offsetof(T, DstAssetIdRangeMin), 4, 1, nullptr },
+        { "DstAssetIdRangeMax", field_type::s32, offsetof(T, DstAssetIdRangeMax), 4, 1, nullptr },
+        { "LimitedMapRegionId0", field_type::s8, offsetof(T, LimitedMapRegionId0), 1, 1, nullptr },
+        { "LimitedMapRegionId1", field_type::s8, offsetof(T, LimitedMapRegionId1), 1, 1, nullptr },
+        { "LimitedMapRegionId2", field_type::s8, offsetof(T, LimitedMapRegionId2), 1, 1, nullptr },
+        { "LimitedMapRegionId3", field_type::s8, offsetof(T, LimitedMapRegionId3), 1, 1, nullptr },
+        { "reserve", field_type::u8, offsetof(T, reserve), 1, 4, nullptr },
+        { "LimitedMapRegionAssetId", field_type::s32, offsetof(T, LimitedMapRegionAssetId), 4, 1, nullptr },
+        { "LimitedMapRegioAssetPartsNo", field_type::s32, offsetof(T, LimitedMapRegioAssetPartsNo), 4, 1, nullptr },
+        { "LimitedMapRegioAssetIdRangeMin", field_type::s32, offsetof(T, LimitedMapRegioAssetIdRangeMin), 4, 1, nullptr },
+        { "LimitedMapRegioAssetIdRangeMax", field_type::s32, offsetof(T, LimitedMapRegioAssetIdRangeMax), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, TargetMapId) == 0);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, TargetEventId) == 4);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, SrcAssetId) == 8);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, SrcAssetPartsNo) == 12);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, DstAssetId) == 16);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, DstAssetPartsNo) == 20);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, SrcAssetIdRangeMin) == 24);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, SrcAssetIdRangeMax) == 28);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, DstAssetIdRangeMin) == 32);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, DstAssetIdRangeMax) == 36);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, LimitedMapRegionId0) == 40);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, LimitedMapRegionId1) == 41);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, LimitedMapRegionId2) == 42);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, LimitedMapRegionId3) == 43);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, reserve) == 44);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, LimitedMapRegionAssetId) == 48);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, LimitedMapRegioAssetPartsNo) == 52);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, LimitedMapRegioAssetIdRangeMin) == 56);
+static_assert(offsetof(paramdef::LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM, LimitedMapRegioAssetIdRangeMax) == 60);
+
+}; // namespace params
+}; // namespace from
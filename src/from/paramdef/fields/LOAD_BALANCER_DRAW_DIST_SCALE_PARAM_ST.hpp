@@ -0,0 +1,66 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST> {
+    using T = paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 22> fields = {{
+        { "Lv00", field_type::f32, offsetof(T, Lv00), 4, 1, nullptr },
+        { "Lv01", field_type::f32, offsetof(T, Lv01), 4, 1, nullptr },
+        { "Lv02", field_type::f32, offsetof(T, Lv02), 4, 1, nullptr },
+        { "Lv03", field_type::f32, offsetof(T, Lv03), 4, 1, nullptr },
+        { "Lv04", field_type::f32, offsetof(T, Lv04), 4, 1, nullptr },
+        { "Lv05", field_type::f32, offsetof(T, Lv05), 4, 1, nullptr },
+        { "Lv06", field_type::f32, offsetof(T, Lv06), 4, 1, nullptr },
+        { "Lv07", field_type::f32, offsetof(T, Lv07), 4, 1, nullptr },
+        { "Lv08", field_type::f32, offsetof(T, Lv08), 4, 1, nullptr },
+        { "Lv09", field_type::f32, offsetof(T, Lv09), 4, 1, nullptr },
+        { "Lv10", field_type::f32, offsetof(T, Lv10), 4, 1, nullptr },
+        { "Lv11", field_type::f32, offsetof(T, Lv11), 4, 1, nullptr },
+        { "Lv12", field_type::f32, offsetof(T, Lv12), 4, 1, nullptr },
+        { "Lv13", field_type::f32, offsetof(T, Lv13), 4, 1, nullptr },
+        { "Lv14", field_type::f32, offsetof(T, Lv14), 4, 1, nullptr },
+        { "Lv15", field_type::f32, offsetof(T, Lv15), 4, 1, nullptr },
+        { "Lv16", field_type::f32, offsetof(T, Lv16), 4, 1, nullptr },
+        { "Lv17", field_type::f32, offsetof(T, Lv17), 4, 1, nullptr },
+        { "Lv18", field_type::f32, offsetof(T, Lv18), 4, 1, nullptr },
+        { "Lv19", field_type::f32, offsetof(T, Lv19), 4, 1, nullptr },
+        { "Lv20", field_type::f32, offsetof(T, Lv20), 4, 1, nullptr },
+        { "reserve", field_type::u8, offsetof(T, reserve), 1, 44, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv00) == 0);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv01) == 4);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv02) == 8);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv03) == 12);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv04) == 16);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv05) == 20);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv06) == 24);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv07) == 28);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv08) == 32);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv09) == 36);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv10) == 40);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv11) == 44);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv12) == 48);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv13) == 52);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv14) == 56);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv15) == 60);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv16) == 64);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv17) == 68);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv18) == 72);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv19) == 76);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, Lv20) == 80);
+static_assert(offsetof(paramdef::LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST, reserve) == 84);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,44 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST> {
+    using T = paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 11> fields = {{
+        { "DrawDist_LvBegin", field_type::u8, offsetof(T, DrawDist_LvBegin), 1, 1, nullptr },
+        { "DrawDist_LvEnd", field_type::u8, offsetof(T, DrawDist_LvEnd), 1, 1, nullptr },
+        { "reserve0", field_type::u8, offsetof(T, reserve0), 1, 2, nullptr },
+        { "DrawDist_ScaleBegin", field_type::f32, offsetof(T, DrawDist_ScaleBegin), 4, 1, nullptr },
+        { "DrawDist_ScaleEnd", field_type::f32, offsetof(T, DrawDist_ScaleEnd), 4, 1, nullptr },
+        { "ShadwDrawDist_LvBegin", field_type::u8, offsetof(T, ShadwDrawDist_LvBegin), 1, 1, nullptr },
+        { "ShadwDrawDist_LvEnd", field_type::u8, offsetof(T, ShadwDrawDist_LvEnd), 1, 1, nullptr },
+        { "reserve1", field_type::u8, offsetof(T, reserve1), 1, 2, nullptr },
+        { "ShadwDrawDist_ScaleBegin", field_type::f32, offsetof(T, ShadwDrawDist_ScaleBegin), 4, 1, nullptr },
+        { "ShadwDrawDist_ScaleEnd", field_type::f32, offsetof(T, ShadwDrawDist_ScaleEnd), 4, 1, nullptr },
+        { "reserve2", field_type::u8, offsetof(T, reserve2), 1, 24, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, DrawDist_LvBegin) == 0);
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, DrawDist_LvEnd) == 1);
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, reserve0) == 2);
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, DrawDist_ScaleBegin) == 4);
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, DrawDist_ScaleEnd) == 8);
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, ShadwDrawDist_LvBegin) == 12);
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, ShadwDrawDist_LvEnd) == 13);
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, reserve1) == 14);
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, ShadwDrawDist_ScaleBegin) == 16);
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, ShadwDrawDist_ScaleEnd) == 20);
+static_assert(offsetof(paramdef::LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST, reserve2) == 24);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,88 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../LOAD_BALANCER_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::LOAD_BALANCER_PARAM_ST> {
+    using T = paramdef::LOAD_BALANCER_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 33> fields = {{
+        { "lowerFpsThreshold", field_type::f32, offsetof(T, lowerFpsThreshold), 4, 1, nullptr },
+        { "upperFpsThreshold", field_type::f32, offsetof(T, upperFpsThreshold), 4, 1, nullptr },
+        { "lowerFpsContinousCount", field_type::u32, offsetof(T, lowerFpsContinousCount), 4, 1, nullptr },
+        { "upperFpsContinousCount", field_type::u32, offsetof(T, upperFpsContinousCount), 4, 1, nullptr },
+        { "downAfterChangeSleep", field_type::u32, offsetof(T, downAfterChangeSleep), 4, 1, nullptr },
+        { "upAfterChangeSleep", field_type::u32, offsetof(T, upAfterChangeSleep), 4, 1, nullptr },
+        { "postProcessLightShaft", field_type::u8, offsetof(T, postProcessLightShaft), 1, 1, nullptr },
+        { "postProcessBloom", field_type::u8, offsetof(T, postProcessBloom), 1, 1, nullptr },
+        { "postProcessGlow", field_type::u8, offsetof(T, postProcessGlow), 1, 1, nullptr },
+        { "postProcessAA", field_type::u8, offsetof(T, postProcessAA), 1, 1, nullptr },
+        { "postProcessSSAO", field_type::u8, offsetof(T, postProcessSSAO), 1, 1, nullptr },
+        { "postProcessDOF", field_type::u8, offsetof(T, postProcessDOF), 1, 1, nullptr },
+        { "postProcessMotionBlur", field_type::u8, offsetof(T, postProcessMotionBlur), 1, 1, nullptr },
+        { "postProcessMotionBlurIteration", field_type::u8, offsetof(T, postProcessMotionBlurIteration), 1, 1, nullptr },
+        { "reserve0", field_type::u8, offsetof(T, reserve0), 1, 1, nullptr },
+        { "shadowBlur", field_type::u8, offsetof(T, shadowBlur), 1, 1, nullptr },
+        { "sfxParticleHalf", field_type::u8, offsetof(T, sfxParticleHalf), 1, 1, nullptr },
+        { "sfxReflection", field_type::u8, offsetof(T, sfxReflection), 1, 1, nullptr },
+        { "sfxWaterInteraction", field_type::u8, offsetof(T, sfxWaterInteraction), 1, 1, nullptr },
+        { "sfxGlow", field_type::u8, offsetof(T, sfxGlow), 1, 1, nullptr },
+        { "sfxDistortion", field_type::u8, offsetof(T, sfxDistortion), 1, 1, nullptr },
+        { "sftSoftSprite", field_type::u8, offsetof(T, sftSoftSprite), 1, 1, nullptr },
+        { "sfxLightShaft", field_type::u8, offsetof(T, sfxLightShaft), 1, 1, nullptr },
+        { "sfxScaleRenderDistanceScale", field_type::u8, offsetof(T, sfxScaleRenderDistanceScale), 1, 1, nullptr },
+        { "dynamicResolution", field_type::u8, offsetof(T, dynamicResolution), 1, 1, nullptr },
+        { "shadowCascade0ResolutionHalf", field_type::u8, offsetof(T, shadowCascade0ResolutionHalf), 1, 1, nullptr },
+        { "shadowCascade1ResolutionHalf", field_type::u8, offsetof(T, shadowCascade1ResolutionHalf), 1, 1, nullptr },
+        { "chrWetDisablePlayer", field_type::u8, offsetof(T, chrWetDisablePlayer), 1, 1, nullptr },
+        { "chrWetDisableRemotePlayer", field_type::u8, offsetof(T, chrWetDisableRemotePlayer), 1, 1, nullptr },
+        { "chrWetDisableEnemy", field_type::u8, offsetof(T, chrWetDisableEnemy), 1, 1, nullptr },
+        { "dynamicResolutionPercentageMin", field_type::u8, offsetof(T, dynamicResolutionPercentageMin), 1, 1, nullptr },
+        { "dynamicResolutionPercentageMax", field_type::u8, offsetof(T, dynamicResolutionPercentageMax), 1, 1, nullptr },
+        { "reserve1", field_type::u8, offsetof(T, reserve1), 1, 30, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, lowerFpsThreshold) == 0);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, upperFpsThreshold) == 4);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, lowerFpsContinousCount) == 8);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, upperFpsContinousCount) == 12);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, downAfterChangeSleep) == 16);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, upAfterChangeSleep) == 20);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, postProcessLightShaft) == 24);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, postProcessBloom) == 25);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, postProcessGlow) == 26);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, postProcessAA) == 27);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, postProcessSSAO) == 28);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, postProcessDOF) == 29);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, postProcessMotionBlur) == 30);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, postProcessMotionBlurIteration) == 31);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, reserve0) == 32);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, shadowBlur) == 33);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, sfxParticleHalf) == 34);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, sfxReflection) == 35);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, sfxWaterInteraction) == 36);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, sfxGlow) == 37);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, sfxDistortion) == 38);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, sftSoftSprite) == 39);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, sfxLightShaft) == 40);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, sfxScaleRenderDistanceScale) == 41);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, dynamicResolution) == 42);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, shadowCascade0ResolutionHalf) == 43);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, shadowCascade1ResolutionHalf) == 44);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, chrWetDisablePlayer) == 45);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, chrWetDisableRemotePlayer) == 46);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, chrWetDisableEnemy) == 47);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, dynamicResolutionPercentageMin) == 48);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, dynamicResolutionPercentageMax) == 49);
+static_assert(offsetof(paramdef::LOAD_BALANCER_PARAM_ST, reserve1) == 50);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,64 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../LOCK_CAM_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::LOCK_CAM_PARAM_ST> {
+    using T = paramdef::LOCK_CAM_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 21> fields = {{
+        { "camDistTarget", field_type::f32, offsetof(T, camDistTarget), 4, 1, nullptr },
+        { "rotRangeMinX", field_type::f32, offsetof(T, rotRangeMinX), 4, 1, nullptr },
+        { "lockRotXShiftRatio", field_type::f32, offsetof(T, lockRotXShiftRatio), 4, 1, nullptr },
+        { "chrOrgOffset_Y", field_type::f32, offsetof(T, chrOrgOffset_Y), 4, 1, nullptr },
+        { "chrLockRangeMaxRadius", field_type::f32, offsetof(T, chrLockRangeMaxRadius), 4, 1, nullptr },
+        { "camFovY", field_type::f32, offsetof(T, camFovY), 4, 1, nullptr },
+        { "chrLockRangeMaxRadius_forD", field_type::f32, offsetof(T, chrLockRangeMaxRadius_forD), 4, 1, nullptr },
+        { "chrLockRangeMaxRadius_forPD", field_type::f32, offsetof(T, chrLockRangeMaxRadius_forPD), 4, 1, nullptr },
+        { "closeMaxHeight", field_type::f32, offsetof(T, closeMaxHeight), 4, 1, nullptr },
+        { "closeMinHeight", field_type::f32, offsetof(T, closeMinHeight), 4, 1, nullptr },
+        { "closeAngRange", field_type::f32, offsetof(T, closeAngRange), 4, 1, nullptr },
+        { "closeMaxRadius", field_type::f32, offsetof(T, closeMaxRadius), 4, 1, nullptr },
+        { "closeMaxRadius_forD", field_type::f32, offsetof(T, closeMaxRadius_forD), 4, 1, nullptr },
+        { "closeMaxRadius_forPD", field_type::f32, offsetof(T, closeMaxRadius_forPD), 4, 1, nullptr },
+        { "bulletMaxRadius", field_type::f32, offsetof(T, bulletMaxRadius), 4, 1, nullptr },
+        { "bulletMaxRadius_forD", field_type::f32, offsetof(T, bulletMaxRadius_forD), 4, 1, nullptr },
+        { "bulletMaxRadius_forPD", field_type::f32, offsetof(T, bulletMaxRadius_forPD), 4, 1, nullptr },
+        { "bulletAngRange", field_type::f32, offsetof(T, bulletAngRange), 4, 1, nullptr },
+        { "lockTgtKeepTime", field_type::f32, offsetof(T, lockTgtKeepTime), 4, 1, nullptr },
+        { "chrTransChaseRateForNormal", field_type::f32, offsetof(T, chrTransChaseRateForNormal), 4, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 48, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, camDistTarget) == 0);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, rotRangeMinX) == 4);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, lockRotXShiftRatio) == 8);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, chrOrgOffset_Y) == 12);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, chrLockRangeMaxRadius) == 16);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, camFovY) == 20);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, chrLockRangeMaxRadius_forD) == 24);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, chrLockRangeMaxRadius_forPD) == 28);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, closeMaxHeight) == 32);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, closeMinHeight) == 36);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, closeAngRange) == 40);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, closeMaxRadius) == 44);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, closeMaxRadius_forD) == 48);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, closeMaxRadius_forPD) == 52);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, bulletMaxRadius) == 56);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, bulletMaxRadius_forD) == 60);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, bulletMaxRadius_forPD) == 64);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, bulletAngRange) == 68);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, lockTgtKeepTime) == 72);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, chrTransChaseRateForNormal) == 76);
+static_assert(offsetof(paramdef::LOCK_CAM_PARAM_ST, pad) == 80);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,212 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MAGIC_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MAGIC_PARAM_ST> {
+    using T = paramdef::MAGIC_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 112> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "yesNoDialogMessageId", field_type::s32, offsetof(T, yesNoDialogMessageId), 4, 1, nullptr },
+        { "limitCancelSpEffectId", field_type::s32, offsetof(T, limitCancelSpEffectId), 4, 1, nullptr },
+        { "sortId", field_type::s16, offsetof(T, sortId), 2, 1, nullptr },
+        { "requirementLuck", field_type::u8, offsetof(T, requirementLuck), 1, 1, nullptr },
+        { "aiNotifyType", field_type::u8, offsetof(T, aiNotifyType), 1, 1, nullptr },
+        { "mp", field_type::s16, offsetof(T, mp), 2, 1, nullptr },
+        { "stamina", field_type::s16, offsetof(T, stamina), 2, 1, nullptr },
+        { "iconId", field_type::s16, offsetof(T, iconId), 2, 1, nullptr },
+        { "behaviorId", field_type::s16, offsetof(T, behaviorId), 2, 1, nullptr },
+        { "mtrlItemId", field_type::s16, offsetof(T, mtrlItemId), 2, 1, nullptr },
+        { "replaceMagicId", field_type::s16, offsetof(T, replaceMagicId), 2, 1, nullptr },
+        { "maxQuantity", field_type::s16, offsetof(T, maxQuantity), 2, 1, nullptr },
+        { "refCategory1", field_type::u8, offsetof(T, refCategory1), 1, 1, nullptr },
+        { "overDexterity", field_type::u8, offsetof(T, overDexterity), 1, 1, nullptr },
+        { "refCategory2", field_type::u8, offsetof(T, refCategory2), 1, 1, nullptr },
+        { "slotLength", field_type::u8, offsetof(T, slotLength), 1, 1, nullptr },
+        { "requirementIntellect", field_type::u8, offsetof(T, requirementIntellect), 1, 1, nullptr },
+        { "requirementFaith", field_type::u8, offsetof(T, requirementFaith), 1, 1, nullptr },
+        { "analogDexterityMin", field_type::u8, offsetof(T, analogDexterityMin), 1, 1, nullptr },
+        { "analogDexterityMax", field_type::u8, offsetof(T, analogDexterityMax), 1, 1, nullptr },
+        { "ezStateBehaviorType", field_type::u8, offsetof(T, ezStateBehaviorType), 1, 1, nullptr },
+        { "refCategory3", field_type::u8, offsetof(T, refCategory3), 1, 1, nullptr },
+        { "spEffectCategory", field_type::u8, offsetof(T, spEffectCategory), 1, 1, nullptr },
+        { "refType", field_type::u8, offsetof(T, refType), 1, 1, nullptr },
+        { "opmeMenuType", field_type::u8, offsetof(T, opmeMenuType), 1, 1, nullptr },
+        { "refCategory4", field_type::u8, offsetof(T, refCategory4), 1, 1, nullptr },
+        { "hasSpEffectType", field_type::u16, offsetof(T, hasSpEffectType), 2, 1, nullptr },
+        { "replaceCategory", field_type::u8, offsetof(T, replaceCategory), 1, 1, nullptr },
+        { "useLimitCategory", field_type::u8, offsetof(T, useLimitCategory), 1, 1, nullptr },
+        { "vowType0", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType0; } },
+        { "vowType1", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType1; } },
+        { "vowType2", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType2; } },
+        { "vowType3", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType3; } },
+        { "vowType4", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType4; } },
+        { "vowType5", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType5; } },
+        { "vowType6", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType6; } },
+        { "vowType7", field_type::boolean, 48, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType7; } },
+        { "enable_multi", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_multi; } },
+        { "enable_multi_only", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_multi_only; } },
+        { "isEnchant", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnchant; } },
+        { "isShieldEnchant", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isShieldEnchant; } },
+        { "enable_live", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_live; } },
+        { "enable_gray", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_gray; } },
+        { "enable_white", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_white; } },
+        { "enable_black", field_type::boolean, 49, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enable_black; } },
+        { "disableOffline", field_type::boolean, 50, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableOffline; } },
+        { "castResonanceMagic", field_type::boolean, 50, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->castResonanceMagic; } },
+        { "isValidTough_ProtSADmg", field_type::boolean, 50, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isValidTough_ProtSADmg; } },
+        { "isWarpMagic", field_type::boolean, 50, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isWarpMagic; } },
+        { "enableRiding", field_type::boolean, 50, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableRiding; } },
+        { "disableRiding", field_type::boolean, 50, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableRiding; } },
+        { "isUseNoAttackRegion", field_type::boolean, 50, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseNoAttackRegion; } },
+        { "pad_1", field_type::u8, 50, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad_1; } },
+        { "vowType8", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType8; } },
+        { "vowType9", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType9; } },
+        { "vowType10", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType10; } },
+        { "vowType11", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType11; } },
+        { "vowType12", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType12; } },
+        { "vowType13", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType13; } },
+        { "vowType14", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType14; } },
+        { "vowType15", field_type::boolean, 51, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType15; } },
+        { "castSfxId", field_type::s32, offsetof(T, castSfxId), 4, 1, nullptr },
+        { "fireSfxId", field_type::s32, offsetof(T, fireSfxId), 4, 1, nullptr },
+        { "effectSfxId", field_type::s32, offsetof(T, effectSfxId), 4, 1, nullptr },
+        { "toughnessCorrectRate", field_type::f32, offsetof(T, toughnessCorrectRate), 4, 1, nullptr },
+        { "ReplacementStatusType", field_type::u8, offsetof(T, ReplacementStatusType), 1, 1, nullptr },
+        { "ReplacementStatus1", field_type::s8, offsetof(T, ReplacementStatus1), 1, 1, nullptr },
+        { "ReplacementStatus2", field_type::s8, offsetof(T, ReplacementStatus2), 1, 1, nullptr },
+        { "ReplacementStatus3", field_type::s8, offsetof(T, ReplacementStatus3), 1, 1, nullptr },
+        { "ReplacementStatus4", field_type::s8, offsetof(T, ReplacementStatus4), 1, 1, nullptr },
+        { "refCategory5", field_type::u8, offsetof(T, refCategory5), 1, 1, nullptr },
+        { "consumeSA", field_type::s16, offsetof(T, consumeSA), 2, 1, nullptr },
+        { "ReplacementMagic1", field_type::s32, offsetof(T, ReplacementMagic1), 4, 1, nullptr },
+        { "ReplacementMagic2", field_type::s32, offsetof(T, ReplacementMagic2), 4, 1, nullptr },
+        { "ReplacementMagic3", field_type::s32, offsetof(T, ReplacementMagic3), 4, 1, nullptr },
+        { "ReplacementMagic4", field_type::s32, offsetof(T, ReplacementMagic4), 4, 1, nullptr },
+        { "mp_charge", field_type::s16, offsetof(T, mp_charge), 2, 1, nullptr },
+        { "stamina_charge", field_type::s16, offsetof(T, stamina_charge), 2, 1, nullptr },
+        { "createLimitGroupId", field_type::u8, offsetof(T, createLimitGroupId), 1, 1, nullptr },
+        { "refCategory6", field_type::u8, offsetof(T, refCategory6), 1, 1, nullptr },
+        { "subCategory1", field_type::u8, offsetof(T, subCategory1), 1, 1, nullptr },
+        { "subCategory2", field_type::u8, offsetof(T, subCategory2), 1, 1, nullptr },
+        { "refCategory7", field_type::u8, offsetof(T, refCategory7), 1, 1, nullptr },
+        { "refCategory8", field_type::u8, offsetof(T, refCategory8), 1, 1, nullptr },
+        { "refCategory9", field_type::u8, offsetof(T, refCategory9), 1, 1, nullptr },
+        { "refCategory10", field_type::u8, offsetof(T, refCategory10), 1, 1, nullptr },
+        { "refId1", field_type::s32, offsetof(T, refId1), 4, 1, nullptr },
+        { "refId2", field_type::s32, offsetof(T, refId2), 4, 1, nullptr },
+        { "refId3", field_type::s32, offsetof(T, refId3), 4, 1, nullptr },
+        { "aiUseJudgeId", field_type::s32, offsetof(T, aiUseJudgeId), 4, 1, nullptr },
+        { "refId4", field_type::s32, offsetof(T, refId4), 4, 1, nullptr },
+        { "refId5", field_type::s32, offsetof(T, refId5), 4, 1, nullptr },
+        { "refId6", field_type::s32, offsetof(T, refId6), 4, 1, nullptr },
+        { "refId7", field_type::s32, offsetof(T, refId7), 4, 1, nullptr },
+        { "refId8", field_type::s32, offsetof(T, refId8), 4, 1, nullptr },
+        { "refId9", field_type::s32, offsetof(T, refId9), 4, 1, nullptr },
+        { "refId10", field_type::s32, offsetof(T, refId10), 4, 1, nullptr },
+        { "consumeType1", field_type::u8, offsetof(T, consumeType1), 1, 1, nullptr },
+        { "consumeType2", field_type::u8, offsetof(T, consumeType2), 1, 1, nullptr },
+        { "consumeType3", field_type::u8, offsetof(T, consumeType3), 1, 1, nullptr },
+        { "consumeType4", field_type::u8, offsetof(T, consumeType4), 1, 1, nullptr },
+        { "consumeType5", field_type::u8, offsetof(T, consumeType5), 1, 1, nullptr },
+        { "consumeType6", field_type::u8, offsetof(T, consumeType6), 1, 1, nullptr },
+        { "consumeType7", field_type::u8, offsetof(T, consumeType7), 1, 1, nullptr },
+        { "consumeType8", field_type::u8, offsetof(T, consumeType8), 1, 1, nullptr },
+        { "consumeType9", field_type::u8, offsetof(T, consumeType9), 1, 1, nullptr },
+        { "consumeType10", field_type::u8, offsetof(T, consumeType10), 1, 1, nullptr },
+        { "consumeLoopMP_forMenu", field_type::s16, offsetof(T, consumeLoopMP_forMenu), 2, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, yesNoDialogMessageId) == 4);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, limitCancelSpEffectId) == 8);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, sortId) == 12);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, requirementLuck) == 14);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, aiNotifyType) == 15);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, mp) == 16);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, stamina) == 18);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, iconId) == 20);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, behaviorId) == 22);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, mtrlItemId) == 24);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, replaceMagicId) == 26);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, maxQuantity) == 28);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refCategory1) == 30);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, overDexterity) == 31);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refCategory2) == 32);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, slotLength) == 33);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, requirementIntellect) == 34);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, requirementFaith) == 35);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, analogDexterityMin) == 36);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, analogDexterityMax) == 37);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, ezStateBehaviorType) == 38);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refCategory3) == 39);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, spEffectCategory) == 40);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refType) == 41);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, opmeMenuType) == 42);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refCategory4) == 43);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, hasSpEffectType) == 44);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, replaceCategory) == 46);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, useLimitCategory) == 47);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, castSfxId) == 52);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, fireSfxId) == 56);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, effectSfxId) == 60);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, toughnessCorrectRate) == 64);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, ReplacementStatusType) == 68);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, ReplacementStatus1) == 69);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, ReplacementStatus2) == 70);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, ReplacementStatus3) == 71);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, ReplacementStatus4) == 72);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refCategory5) == 73);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeSA) == 74);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, ReplacementMagic1) == 76);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, ReplacementMagic2) == 80);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, ReplacementMagic3) == 84);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, ReplacementMagic4) == 88);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, mp_charge) == 92);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, stamina_charge) == 94);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, createLimitGroupId) == 96);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refCategory6) == 97);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, subCategory1) == 98);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, subCategory2) == 99);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refCategory7) == 100);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refCategory8) == 101);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refCategory9) == 102);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refCategory10) == 103);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refId1) == 104);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refId2) == 108);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refId3) == 112);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, aiUseJudgeId) == 116);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refId4) == 120);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refId5) == 124);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refId6) == 128);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refId7) == 132);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refId8) == 136);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refId9) == 140);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, refId10) == 144);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeType1) == 148);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeType2) == 149);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeType3) == 150);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeType4) == 151);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeType5) == 152);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeType6) == 153);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeType7) == 154);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeType8) == 155);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeType9) == 156);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeType10) == 157);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, consumeLoopMP_forMenu) == 158);
+static_assert(offsetof(paramdef::MAGIC_PARAM_ST, pad) == 160);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,72 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MAP_DEFAULT_INFO_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MAP_DEFAULT_INFO_PARAM_ST> {
+    using T = paramdef::MAP_DEFAULT_INFO_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 26> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "EnableFastTravelEventFlagId", field_type::u32, offsetof(T, EnableFastTravelEventFlagId), 4, 1, nullptr },
+        { "WeatherLotTimeOffsetIngameSeconds", field_type::s32, offsetof(T, WeatherLotTimeOffsetIngameSeconds), 4, 1, nullptr },
+        { "WeatherCreateAssetLimitId", field_type::s8, offsetof(T, WeatherCreateAssetLimitId), 1, 1, nullptr },
+        { "MapAiSightType", field_type::u8, offsetof(T, MapAiSightType), 1, 1, nullptr },
+        { "SoundIndoorType", field_type::u8, offsetof(T, SoundIndoorType), 1, 1, nullptr },
+        { "ReverbDefaultType", field_type::s8, offsetof(T, ReverbDefaultType), 1, 1, nullptr },
+        { "BgmPlaceInfo", field_type::s16, offsetof(T, BgmPlaceInfo), 2, 1, nullptr },
+        { "EnvPlaceInfo", field_type::s16, offsetof(T, EnvPlaceInfo), 2, 1, nullptr },
+        { "MapAdditionalSoundBankId", field_type::s32, offsetof(T, MapAdditionalSoundBankId), 4, 1, nullptr },
+        { "MapHeightForSound", field_type::s16, offsetof(T, MapHeightForSound), 2, 1, nullptr },
+        { "IsEnableBlendTimezoneEnvmap", field_type::boolean, offsetof(T, IsEnableBlendTimezoneEnvmap), 1, 1, nullptr },
+        { "OverrideGIResolution_XSS", field_type::s8, offsetof(T, OverrideGIResolution_XSS), 1, 1, nullptr },
+        { "MapLoHiChangeBorderDist_XZ", field_type::f32, offsetof(T, MapLoHiChangeBorderDist_XZ), 4, 1, nullptr },
+        { "MapLoHiChangeBorderDist_Y", field_type::f32, offsetof(T, MapLoHiChangeBorderDist_Y), 4, 1, nullptr },
+        { "MapLoHiChangePlayDist", field_type::f32, offsetof(T, MapLoHiChangePlayDist), 4, 1, nullptr },
+        { "MapAutoDrawGroupBackFacePixelNum", field_type::u32, offsetof(T, MapAutoDrawGroupBackFacePixelNum), 4, 1, nullptr },
+        { "PlayerLigntScale", field_type::f32, offsetof(T, PlayerLigntScale), 4, 1, nullptr },
+        { "IsEnableTimezonnePlayerLigntScale", field_type::boolean, offsetof(T, IsEnableTimezonnePlayerLigntScale), 1, 1, nullptr },
+        { "isDisableAutoCliffWind", field_type::boolean, offsetof(T, isDisableAutoCliffWind), 1, 1, nullptr },
+        { "OpenChrActivateThreshold", field_type::s16, offsetof(T, OpenChrActivateThreshold), 2, 1, nullptr },
+        { "MapMimicryEstablishmentParamId", field_type::s32, offsetof(T, MapMimicryEstablishmentParamId), 4, 1, nullptr },
+        { "OverrideGIResolution_XSX", field_type::s8, offsetof(T, OverrideGIResolution_XSX), 1, 1, nullptr },
+        { "Reserve", field_type::u8, offsetof(T, Reserve), 1, 7, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, EnableFastTravelEventFlagId) == 4);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, WeatherLotTimeOffsetIngameSeconds) == 8);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, WeatherCreateAssetLimitId) == 12);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, MapAiSightType) == 13);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, SoundIndoorType) == 14);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, ReverbDefaultType) == 15);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, BgmPlaceInfo) == 16);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, EnvPlaceInfo) == 18);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, MapAdditionalSoundBankId) == 20);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, MapHeightForSound) == 24);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, IsEnableBlendTimezoneEnvmap) == 26);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, OverrideGIResolution_XSS) == 27);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, MapLoHiChangeBorderDist_XZ) == 28);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, MapLoHiChangeBorderDist_Y) == 32);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, MapLoHiChangePlayDist) == 36);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, MapAutoDrawGroupBackFacePixelNum) == 40);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, PlayerLigntScale) == 44);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, IsEnableTimezonnePlayerLigntScale) == 48);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, isDisableAutoCliffWind) == 49);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, OpenChrActivateThreshold) == 50);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, MapMimicryEstablishmentParamId) == 52);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, OverrideGIResolution_XSX) == 56);
+static_assert(offsetof(paramdef::MAP_DEFAULT_INFO_PARAM_ST, Reserve) == 57);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,28 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MAP_GD_REGION_DRAW_PARAM.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MAP_GD_REGION_DRAW_PARAM> {
+    using T = paramdef::MAP_GD_REGION_DRAW_PARAM;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "overrideIVLocalLightScale", field_type::f32, offsetof(T, overrideIVLocalLightScale), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MAP_GD_REGION_DRAW_PARAM, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::MAP_GD_REGION_DRAW_PARAM, overrideIVLocalLightScale) == 4);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,28 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MAP_GRID_CREATE_HEIGHT_LIMIT_INFO_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MAP_GRID_CREATE_HEIGHT_LIMIT_INFO_PARAM_ST> {
+    using T = paramdef::MAP_GRID_CREATE_HEIGHT_LIMIT_INFO_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 3> fields = {{
+        { "GridEnableCreateHeightMin", field_type::f32, offsetof(T, GridEnableCreateHeightMin), 4, 1, nullptr },
+        { "GridEnableCreateHeightMax", field_type::f32, offsetof(T, GridEnableCreateHeightMax), 4, 1, nullptr },
+        { "Reserve", field_type::u8, offsetof(T, Reserve), 1, 24, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MAP_GRID_CREATE_HEIGHT_LIMIT_INFO_PARAM_ST, GridEnableCreateHeightMin) == 0);
+static_assert(offsetof(paramdef::MAP_GRID_CREATE_HEIGHT_LIMIT_INFO_PARAM_ST, GridEnableCreateHeightMax) == 4);
+static_assert(offsetof(paramdef::MAP_GRID_CREATE_HEIGHT_LIMIT_INFO_PARAM_ST, Reserve) == 8);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,48 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MAP_MIMICRY_ESTABLISHMENT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST> {
+    using T = paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 13> fields = {{
+        { "mimicryEstablishment0", field_type::f32, offsetof(T, mimicryEstablishment0), 4, 1, nullptr },
+        { "mimicryEstablishment1", field_type::f32, offsetof(T, mimicryEstablishment1), 4, 1, nullptr },
+        { "mimicryEstablishment2", field_type::f32, offsetof(T, mimicryEstablishment2), 4, 1, nullptr },
+        { "mimicryBeginSfxId0", field_type::s32, offsetof(T, mimicryBeginSfxId0), 4, 1, nullptr },
+        { "mimicrySfxId0", field_type::s32, offsetof(T, mimicrySfxId0), 4, 1, nullptr },
+        { "mimicryEndSfxId0", field_type::s32, offsetof(T, mimicryEndSfxId0), 4, 1, nullptr },
+        { "mimicryBeginSfxId1", field_type::s32, offsetof(T, mimicryBeginSfxId1), 4, 1, nullptr },
+        { "mimicrySfxId1", field_type::s32, offsetof(T, mimicrySfxId1), 4, 1, nullptr },
+        { "mimicryEndSfxId1", field_type::s32, offsetof(T, mimicryEndSfxId1), 4, 1, nullptr },
+        { "mimicryBeginSfxId2", field_type::s32, offsetof(T, mimicryBeginSfxId2), 4, 1, nullptr },
+        { "mimicrySfxId2", field_type::s32, offsetof(T, mimicrySfxId2), 4, 1, nullptr },
+        { "mimicryEndSfxId2", field_type::s32, offsetof(T, mimicryEndSfxId2), 4, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 16, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicryEstablishment0) == 0);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicryEstablishment1) == 4);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicryEstablishment2) == 8);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicryBeginSfxId0) == 12);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicrySfxId0) == 16);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicryEndSfxId0) == 20);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicryBeginSfxId1) == 24);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicrySfxId1) == 28);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicryEndSfxId1) == 32);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicryBeginSfxId2) == 36);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicrySfxId2) == 40);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, mimicryEndSfxId2) == 44);
+static_assert(offsetof(paramdef::MAP_MIMICRY_ESTABLISHMENT_PARAM_ST, pad1) == 48);
+
+}; // namespace params
+}; // namespace from
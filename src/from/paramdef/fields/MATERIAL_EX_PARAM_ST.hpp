@@ -0,0 +1,38 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MATERIAL_EX_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MATERIAL_EX_PARAM_ST> {
+    using T = paramdef::MATERIAL_EX_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 8> fields = {{
+        { "paramName", field_type::wide_character, offsetof(T, paramName), 2, 32, nullptr },
+        { "materialId", field_type::s32, offsetof(T, materialId), 4, 1, nullptr },
+        { "materialParamValue0", field_type::f32, offsetof(T, materialParamValue0), 4, 1, nullptr },
+        { "materialParamValue1", field_type::f32, offsetof(T, materialParamValue1), 4, 1, nullptr },
+        { "materialParamValue2", field_type::f32, offsetof(T, materialParamValue2), 4, 1, nullptr },
+        { "materialParamValue3", field_type::f32, offsetof(T, materialParamValue3), 4, 1, nullptr },
+        { "materialParamValue4", field_type::f32, offsetof(T, materialParamValue4), 4, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MATERIAL_EX_PARAM_ST, paramName) == 0);
+static_assert(offsetof(paramdef::MATERIAL_EX_PARAM_ST, materialId) == 64);
+static_assert(offsetof(paramdef::MATERIAL_EX_PARAM_ST, materialParamValue0) == 68);
+static_assert(offsetof(paramdef::MATERIAL_EX_PARAM_ST, materialParamValue1) == 72);
+static_assert(offsetof(paramdef::MATERIAL_EX_PARAM_ST, materialParamValue2) == 76);
+static_assert(offsetof(paramdef::MATERIAL_EX_PARAM_ST, materialParamValue3) == 80);
+static_assert(offsetof(paramdef::MATERIAL_EX_PARAM_ST, materialParamValue4) == 84);
+static_assert(offsetof(paramdef::MATERIAL_EX_PARAM_ST, pad) == 88);
+
+}; // namespace params
+}; // namespace from
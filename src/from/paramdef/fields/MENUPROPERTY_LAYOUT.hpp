@@ -0,0 +1,32 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MENUPROPERTY_LAYOUT.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MENUPROPERTY_LAYOUT> {
+    using T = paramdef::MENUPROPERTY_LAYOUT;
+
+    static constexpr std::array<field_descriptor, 5> fields = {{
+        { "LayoutPath", field_type::character, offsetof(T, LayoutPath), 1, 16, nullptr },
+        { "PropertyID", field_type::s32, offsetof(T, PropertyID), 4, 1, nullptr },
+        { "CaptionTextID", field_type::s32, offsetof(T, CaptionTextID), 4, 1, nullptr },
+        { "HelpTextID", field_type::s32, offsetof(T, HelpTextID), 4, 1, nullptr },
+        { "reserved", field_type::u8, offsetof(T, reserved), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MENUPROPERTY_LAYOUT, LayoutPath) == 0);
+static_assert(offsetof(paramdef::MENUPROPERTY_LAYOUT, PropertyID) == 16);
+static_assert(offsetof(paramdef::MENUPROPERTY_LAYOUT, CaptionTextID) == 20);
+static_assert(offsetof(paramdef::MENUPROPERTY_LAYOUT, HelpTextID) == 24);
+static_assert(offsetof(paramdef::MENUPROPERTY_LAYOUT, reserved) == 28);
+
+}; // namespace params
+}; // namespace from
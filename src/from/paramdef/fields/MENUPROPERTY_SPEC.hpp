@@ -0,0 +1,36 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MENUPROPERTY_SPEC.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MENUPROPERTY_SPEC> {
+    using T = paramdef::MENUPROPERTY_SPEC;
+
+    static constexpr std::array<field_descriptor, 7> fields = {{
+        { "CaptionTextID", field_type::s32, offsetof(T, CaptionTextID), 4, 1, nullptr },
+        { "IconID", field_type::s32, offsetof(T, IconID), 4, 1, nullptr },
+        { "RequiredPropertyID", field_type::u32, offsetof(T, RequiredPropertyID), 4, 1, nullptr },
+        { "CompareType", field_type::s8, offsetof(T, CompareType), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 1, nullptr },
+        { "FormatType", field_type::u16, offsetof(T, FormatType), 2, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 16, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MENUPROPERTY_SPEC, CaptionTextID) == 0);
+static_assert(offsetof(paramdef::MENUPROPERTY_SPEC, IconID) == 4);
+static_assert(offsetof(paramdef::MENUPROPERTY_SPEC, RequiredPropertyID) == 8);
+static_assert(offsetof(paramdef::MENUPROPERTY_SPEC, CompareType) == 12);
+static_assert(offsetof(paramdef::MENUPROPERTY_SPEC, pad2) == 13);
+static_assert(offsetof(paramdef::MENUPROPERTY_SPEC, FormatType) == 14);
+static_assert(offsetof(paramdef::MENUPROPERTY_SPEC, pad) == 16);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,142 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MENU_COMMON_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MENU_COMMON_PARAM_ST> {
+    using T = paramdef::MENU_COMMON_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 60> fields = {{
+        { "soloPlayDeath_ToFadeOutTime", field_type::f32, offsetof(T, soloPlayDeath_ToFadeOutTime), 4, 1, nullptr },
+        { "partyGhostDeath_ToFadeOutTime", field_type::f32, offsetof(T, partyGhostDeath_ToFadeOutTime), 4, 1, nullptr },
+        { "playerMaxHpLimit", field_type::s32, offsetof(T, playerMaxHpLimit), 4, 1, nullptr },
+        { "playerMaxMpLimit", field_type::s32, offsetof(T, playerMaxMpLimit), 4, 1, nullptr },
+        { "playerMaxSpLimit", field_type::s32, offsetof(T, playerMaxSpLimit), 4, 1, nullptr },
+        { "actionPanelChangeThreshold_Vel", field_type::f32, offsetof(T, actionPanelChangeThreshold_Vel), 4, 1, nullptr },
+        { "actionPanelChangeThreshold_PassTime", field_type::f32, offsetof(T, actionPanelChangeThreshold_PassTime), 4, 1, nullptr },
+        { "kgIconVspace", field_type::s32, offsetof(T, kgIconVspace), 4, 1, nullptr },
+        { "worldMapCursorSelectRadius", field_type::f32, offsetof(T, worldMapCursorSelectRadius), 4, 1, nullptr },
+        { "reserved8", field_type::u8, offsetof(T, reserved8), 1, 4, nullptr },
+        { "decalPosOffsetX", field_type::s32, offsetof(T, decalPosOffsetX), 4, 1, nullptr },
+        { "decalPosOffsetY", field_type::s32, offsetof(T, decalPosOffsetY), 4, 1, nullptr },
+        { "targetStateSearchDurationTime", field_type::f32, offsetof(T, targetStateSearchDurationTime), 4, 1, nullptr },
+        { "targetStateBattleDurationTime", field_type::f32, offsetof(T, targetStateBattleDurationTime), 4, 1, nullptr },
+        { "worldMapCursorSpeed", field_type::f32, offsetof(T, worldMapCursorSpeed), 4, 1, nullptr },
+        { "worldMapCursorFirstDistance", field_type::f32, offsetof(T, worldMapCursorFirstDistance), 4, 1, nullptr },
+        { "worldMapCursorFirstDelay", field_type::f32, offsetof(T, worldMapCursorFirstDelay), 4, 1, nullptr },
+        { "worldMapCursorWaitTime", field_type::f32, offsetof(T, worldMapCursorWaitTime), 4, 1, nullptr },
+        { "worldMapCursorSnapRadius", field_type::f32, offsetof(T, worldMapCursorSnapRadius), 4, 1, nullptr },
+        { "worldMapCursorSnapTime", field_type::f32, offsetof(T, worldMapCursorSnapTime), 4, 1, nullptr },
+        { "itemGetLogAliveTime", field_type::f32, offsetof(T, itemGetLogAliveTime), 4, 1, nullptr },
+        { "playerMaxSaLimit", field_type::s32, offsetof(T, playerMaxSaLimit), 4, 1, nullptr },
+        { "worldMap_IsChangeableLayerEventFlagId", field_type::u32, offsetof(T, worldMap_IsChangeableLayerEventFlagId), 4, 1, nullptr },
+        { "worldMap_TravelMargin", field_type::f32, offsetof(T, worldMap_TravelMargin), 4, 1, nullptr },
+        { "systemAnnounceScrollBufferTime", field_type::f32, offsetof(T, systemAnnounceScrollBufferTime), 4, 1, nullptr },
+        { "systemAnnounceScrollSpeed", field_type::s32, offsetof(T, systemAnnounceScrollSpeed), 4, 1, nullptr },
+        { "systemAnnounceNoScrollWaitTime", field_type::f32, offsetof(T, systemAnnounceNoScrollWaitTime), 4, 1, nullptr },
+        { "systemAnnounceScrollCount", field_type::u8, offsetof(T, systemAnnounceScrollCount), 1, 1, nullptr },
+        { "reserved17", field_type::u8, offsetof(T, reserved17), 1, 3, nullptr },
+        { "compassMemoDispDistance", field_type::f32, offsetof(T, compassMemoDispDistance), 4, 1, nullptr },
+        { "compassBonfireDispDistance", field_type::f32, offsetof(T, compassBonfireDispDistance), 4, 1, nullptr },
+        { "markerGoalThreshold", field_type::f32, offsetof(T, markerGoalThreshold), 4, 1, nullptr },
+        { "svSliderStep", field_type::f32, offsetof(T, svSliderStep), 4, 1, nullptr },
+        { "preOpeningMovie_WaitSec", field_type::f32, offsetof(T, preOpeningMovie_WaitSec), 4, 1, nullptr },
+        { "kgIconScale", field_type::f32, offsetof(T, kgIconScale), 4, 1, nullptr },
+        { "kgIconScale_forTable", field_type::f32, offsetof(T, kgIconScale_forTable), 4, 1, nullptr },
+        { "kgIconVspace_forTable", field_type::s32, offsetof(T, kgIconVspace_forTable), 4, 1, nullptr },
+        { "kgIconScale_forConfig", field_type::f32, offsetof(T, kgIconScale_forConfig), 4, 1, nullptr },
+        { "kgIconVspace_forConfig", field_type::s32, offsetof(T, kgIconVspace_forConfig), 4, 1, nullptr },
+        { "worldMap_SearchRadius", field_type::f32, offsetof(T, worldMap_SearchRadius), 4, 1, nullptr },
+        { "tutorialDisplayTime", field_type::f32, offsetof(T, tutorialDisplayTime), 4, 1, nullptr },
+        { "compassFriendHostInnerDistance", field_type::f32, offsetof(T, compassFriendHostInnerDistance), 4, 1, nullptr },
+        { "compassEnemyHostInnerDistance", field_type::f32, offsetof(T, compassEnemyHostInnerDistance), 4, 1, nullptr },
+        { "compassFriendGuestInnerDistance", field_type::f32, offsetof(T, compassFriendGuestInnerDistance), 4, 1, nullptr },
+        { "cutsceneKeyGuideAliveTime", field_type::f32, offsetof(T, cutsceneKeyGuideAliveTime), 4, 1, nullptr },
+        { "autoHideHpThresholdRatio", field_type::f32, offsetof(T, autoHideHpThresholdRatio), 4, 1, nullptr },
+        { "autoHideHpThresholdValue", field_type::s32, offsetof(T, autoHideHpThresholdValue), 4, 1, nullptr },
+        { "autoHideMpThresholdRatio", field_type::f32, offsetof(T, autoHideMpThresholdRatio), 4, 1, nullptr },
+        { "autoHideMpThresholdValue", field_type::s32, offsetof(T, autoHideMpThresholdValue), 4, 1, nullptr },
+        { "autoHideSpThresholdRatio", field_type::f32, offsetof(T, autoHideSpThresholdRatio), 4, 1, nullptr },
+        { "autoHideSpThresholdValue", field_type::s32, offsetof(T, autoHideSpThresholdValue), 4, 1, nullptr },
+        { "worldMapZoomAnimationTime", field_type::f32, offsetof(T, worldMapZoomAnimationTime), 4, 1, nullptr },
+        { "worldMapIconScaleMin", field_type::f32, offsetof(T, worldMapIconScaleMin), 4, 1, nullptr },
+        { "worldMap_TravelMargin_Point", field_type::f32, offsetof(T, worldMap_TravelMargin_Point), 4, 1, nullptr },
+        { "enemyTagSafeLeft", field_type::u16, offsetof(T, enemyTagSafeLeft), 2, 1, nullptr },
+        { "enemyTagSafeRight", field_type::u16, offsetof(T, enemyTagSafeRight), 2, 1, nullptr },
+        { "enemyTagSafeTop", field_type::u16, offsetof(T, enemyTagSafeTop), 2, 1, nullptr },
+        { "enemyTagSafeBottom", field_type::u16, offsetof(T, enemyTagSafeBottom), 2, 1, nullptr },
+        { "pcHorseHpRecoverDispThreshold", field_type::u32, offsetof(T, pcHorseHpRecoverDispThreshold), 4, 1, nullptr },
+        { "reserved33", field_type::u8, offsetof(T, reserved33), 1, 32, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, soloPlayDeath_ToFadeOutTime) == 0);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, partyGhostDeath_ToFadeOutTime) == 4);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, playerMaxHpLimit) == 8);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, playerMaxMpLimit) == 12);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, playerMaxSpLimit) == 16);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, actionPanelChangeThreshold_Vel) == 20);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, actionPanelChangeThreshold_PassTime) == 24);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, kgIconVspace) == 28);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMapCursorSelectRadius) == 32);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, reserved8) == 36);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, decalPosOffsetX) == 40);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, decalPosOffsetY) == 44);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, targetStateSearchDurationTime) == 48);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, targetStateBattleDurationTime) == 52);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMapCursorSpeed) == 56);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMapCursorFirstDistance) == 60);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMapCursorFirstDelay) == 64);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMapCursorWaitTime) == 68);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMapCursorSnapRadius) == 72);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMapCursorSnapTime) == 76);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, itemGetLogAliveTime) == 80);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, playerMaxSaLimit) == 84);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMap_IsChangeableLayerEventFlagId) == 88);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMap_TravelMargin) == 92);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, systemAnnounceScrollBufferTime) == 96);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, systemAnnounceScrollSpeed) == 100);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, systemAnnounceNoScrollWaitTime) == 104);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, systemAnnounceScrollCount) == 108);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, reserved17) == 109);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, compassMemoDispDistance) == 112);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, compassBonfireDispDistance) == 116);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, markerGoalThreshold) == 120);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, svSliderStep) == 124);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, preOpeningMovie_WaitSec) == 128);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, kgIconScale) == 132);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, kgIconScale_forTable) == 136);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, kgIconVspace_forTable) == 140);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, kgIconScale_forConfig) == 144);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, kgIconVspace_forConfig) == 148);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMap_SearchRadius) == 152);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, tutorialDisplayTime) == 156);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, compassFriendHostInnerDistance) == 160);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, compassEnemyHostInnerDistance) == 164);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, compassFriendGuestInnerDistance) == 168);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, cutsceneKeyGuideAliveTime) == 172);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, autoHideHpThresholdRatio) == 176);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, autoHideHpThresholdValue) == 180);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, autoHideMpThresholdRatio) == 184);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, autoHideMpThresholdValue) == 188);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, autoHideSpThresholdRatio) == 192);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, autoHideSpThresholdValue) == 196);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMapZoomAnimationTime) == 200);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMapIconScaleMin) == 204);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, worldMap_TravelMargin_Point) == 208);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, enemyTagSafeLeft) == 212);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, enemyTagSafeRight) == 214);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, enemyTagSafeTop) == 216);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, enemyTagSafeBottom) == 218);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, pcHorseHpRecoverDispThreshold) == 220);
+static_assert(offsetof(paramdef::MENU_COMMON_PARAM_ST, reserved33) == 224);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,54 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MENU_OFFSCR_REND_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MENU_OFFSCR_REND_PARAM_ST> {
+    using T = paramdef::MENU_OFFSCR_REND_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 16> fields = {{
+        { "camAtPosX", field_type::f32, offsetof(T, camAtPosX), 4, 1, nullptr },
+        { "camAtPosY", field_type::f32, offsetof(T, camAtPosY), 4, 1, nullptr },
+        { "camAtPosZ", field_type::f32, offsetof(T, camAtPosZ), 4, 1, nullptr },
+        { "camDist", field_type::f32, offsetof(T, camDist), 4, 1, nullptr },
+        { "camRotX", field_type::f32, offsetof(T, camRotX), 4, 1, nullptr },
+        { "camRotY", field_type::f32, offsetof(T, camRotY), 4, 1, nullptr },
+        { "camFov", field_type::f32, offsetof(T, camFov), 4, 1, nullptr },
+        { "camDistMin", field_type::f32, offsetof(T, camDistMin), 4, 1, nullptr },
+        { "camDistMax", field_type::f32, offsetof(T, camDistMax), 4, 1, nullptr },
+        { "camRotXMin", field_type::f32, offsetof(T, camRotXMin), 4, 1, nullptr },
+        { "camRotXMax", field_type::f32, offsetof(T, camRotXMax), 4, 1, nullptr },
+        { "GparamID", field_type::u32, offsetof(T, GparamID), 4, 1, nullptr },
+        { "envTexId", field_type::u32, offsetof(T, envTexId), 4, 1, nullptr },
+        { "Grapm_ID_forPS4", field_type::u32, offsetof(T, Grapm_ID_forPS4), 4, 1, nullptr },
+        { "Grapm_ID_forXB1", field_type::u32, offsetof(T, Grapm_ID_forXB1), 4, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camAtPosX) == 0);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camAtPosY) == 4);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camAtPosZ) == 8);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camDist) == 12);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camRotX) == 16);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camRotY) == 20);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camFov) == 24);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camDistMin) == 28);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camDistMax) == 32);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camRotXMin) == 36);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, camRotXMax) == 40);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, GparamID) == 44);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, envTexId) == 48);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, Grapm_ID_forPS4) == 52);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, Grapm_ID_forXB1) == 56);
+static_assert(offsetof(paramdef::MENU_OFFSCR_REND_PARAM_ST, pad) == 60);
+
+}; // namespace params
+}; // namespace from
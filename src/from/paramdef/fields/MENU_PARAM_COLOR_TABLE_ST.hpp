@@ -0,0 +1,42 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MENU_PARAM_COLOR_TABLE_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MENU_PARAM_COLOR_TABLE_ST> {
+    using T = paramdef::MENU_PARAM_COLOR_TABLE_ST;
+
+    static constexpr std::array<field_descriptor, 10> fields = {{
+        { "lerpMode", field_type::u8, offsetof(T, lerpMode), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 3, nullptr },
+        { "h", field_type::u16, offsetof(T, h), 2, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 2, nullptr },
+        { "s1", field_type::f32, offsetof(T, s1), 4, 1, nullptr },
+        { "v1", field_type::f32, offsetof(T, v1), 4, 1, nullptr },
+        { "s2", field_type::f32, offsetof(T, s2), 4, 1, nullptr },
+        { "v2", field_type::f32, offsetof(T, v2), 4, 1, nullptr },
+        { "s3", field_type::f32, offsetof(T, s3), 4, 1, nullptr },
+        { "v3", field_type::f32, offsetof(T, v3), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MENU_PARAM_COLOR_TABLE_ST, lerpMode) == 0);
+static_assert(offsetof(paramdef::MENU_PARAM_COLOR_TABLE_ST, pad1) == 1);
+static_assert(offsetof(paramdef::MENU_PARAM_COLOR_TABLE_ST, h) == 4);
+static_assert(offsetof(paramdef::MENU_PARAM_COLOR_TABLE_ST, pad2) == 6);
+static_assert(offsetof(paramdef::MENU_PARAM_COLOR_TABLE_ST, s1) == 8);
+static_assert(offsetof(paramdef::MENU_PARAM_COLOR_TABLE_ST, v1) == 12);
+static_assert(offsetof(paramdef::MENU_PARAM_COLOR_TABLE_ST, s2) == 16);
+static_assert(offsetof(paramdef::MENU_PARAM_COLOR_TABLE_ST, v2) == 20);
+static_assert(offsetof(paramdef::MENU_PARAM_COLOR_TABLE_ST, s3) == 24);
+static_assert(offsetof(paramdef::MENU_PARAM_COLOR_TABLE_ST, v3) == 28);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,30 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MENU_VALUE_TABLE_SPEC.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MENU_VALUE_TABLE_SPEC> {
+    using T = paramdef::MENU_VALUE_TABLE_SPEC;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "value", field_type::s32, offsetof(T, value), 4, 1, nullptr },
+        { "textId", field_type::s32, offsetof(T, textId), 4, 1, nullptr },
+        { "compareType", field_type::s8, offsetof(T, compareType), 1, 1, nullptr },
+        { "padding", field_type::u8, offsetof(T, padding), 1, 3, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MENU_VALUE_TABLE_SPEC, value) == 0);
+static_assert(offsetof(paramdef::MENU_VALUE_TABLE_SPEC, textId) == 4);
+static_assert(offsetof(paramdef::MENU_VALUE_TABLE_SPEC, compareType) == 8);
+static_assert(offsetof(paramdef::MENU_VALUE_TABLE_SPEC, padding) == 9);
+
+}; // namespace params
+}; // namespace from
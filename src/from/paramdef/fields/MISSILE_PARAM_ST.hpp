@@ -0,0 +1,58 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MISSILE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MISSILE_PARAM_ST> {
+    using T = paramdef::MISSILE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 18> fields = {{
+        { "FFXID", field_type::s32, offsetof(T, FFXID), 4, 1, nullptr },
+        { "LifeTime", field_type::u16, offsetof(T, LifeTime), 2, 1, nullptr },
+        { "HitSphereRadius", field_type::u16, offsetof(T, HitSphereRadius), 2, 1, nullptr },
+        { "HitDamage", field_type::u16, offsetof(T, HitDamage), 2, 1, nullptr },
+        { "reserve0", field_type::u8, offsetof(T, reserve0), 1, 6, nullptr },
+        { "InitVelocity", field_type::f32, offsetof(T, InitVelocity), 4, 1, nullptr },
+        { "distance", field_type::f32, offsetof(T, distance), 4, 1, nullptr },
+        { "gravityInRange", field_type::f32, offsetof(T, gravityInRange), 4, 1, nullptr },
+        { "gravityOutRange", field_type::f32, offsetof(T, gravityOutRange), 4, 1, nullptr },
+        { "mp", field_type::s32, offsetof(T, mp), 4, 1, nullptr },
+        { "accelInRange", field_type::f32, offsetof(T, accelInRange), 4, 1, nullptr },
+        { "accelOutRange", field_type::f32, offsetof(T, accelOutRange), 4, 1, nullptr },
+        { "reserve1", field_type::u8, offsetof(T, reserve1), 1, 20, nullptr },
+        { "HitMissileID", field_type::u16, offsetof(T, HitMissileID), 2, 1, nullptr },
+        { "DiedNaturaly", field_type::boolean, offsetof(T, DiedNaturaly), 1, 1, nullptr },
+        { "ExplosionDie", field_type::boolean, offsetof(T, ExplosionDie), 1, 1, nullptr },
+        { "behaviorId", field_type::s32, offsetof(T, behaviorId), 4, 1, nullptr },
+        { "reserve_last", field_type::u8, offsetof(T, reserve_last), 1, 56, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, FFXID) == 0);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, LifeTime) == 4);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, HitSphereRadius) == 6);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, HitDamage) == 8);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, reserve0) == 10);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, InitVelocity) == 16);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, distance) == 20);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, gravityInRange) == 24);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, gravityOutRange) == 28);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, mp) == 32);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, accelInRange) == 36);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, accelOutRange) == 40);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, reserve1) == 44);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, HitMissileID) == 64);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, DiedNaturaly) == 66);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, ExplosionDie) == 67);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, behaviorId) == 68);
+static_assert(offsetof(paramdef::MISSILE_PARAM_ST, reserve_last) == 72);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,70 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MODEL_SFX_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MODEL_SFX_PARAM_ST> {
+    using T = paramdef::MODEL_SFX_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 24> fields = {{
+        { "sfxId_0", field_type::s32, offsetof(T, sfxId_0), 4, 1, nullptr },
+        { "dmypolyId_0", field_type::s32, offsetof(T, dmypolyId_0), 4, 1, nullptr },
+        { "reserve_0", field_type::u8, offsetof(T, reserve_0), 1, 8, nullptr },
+        { "sfxId_1", field_type::s32, offsetof(T, sfxId_1), 4, 1, nullptr },
+        { "dmypolyId_1", field_type::s32, offsetof(T, dmypolyId_1), 4, 1, nullptr },
+        { "reserve_1", field_type::u8, offsetof(T, reserve_1), 1, 8, nullptr },
+        { "sfxId_2", field_type::s32, offsetof(T, sfxId_2), 4, 1, nullptr },
+        { "dmypolyId_2", field_type::s32, offsetof(T, dmypolyId_2), 4, 1, nullptr },
+        { "reserve_2", field_type::u8, offsetof(T, reserve_2), 1, 8, nullptr },
+        { "sfxId_3", field_type::s32, offsetof(T, sfxId_3), 4, 1, nullptr },
+        { "dmypolyId_3", field_type::s32, offsetof(T, dmypolyId_3), 4, 1, nullptr },
+        { "reserve_3", field_type::u8, offsetof(T, reserve_3), 1, 8, nullptr },
+        { "sfxId_4", field_type::s32, offsetof(T, sfxId_4), 4, 1, nullptr },
+        { "dmypolyId_4", field_type::s32, offsetof(T, dmypolyId_4), 4, 1, nullptr },
+        { "reserve_4", field_type::u8, offsetof(T, reserve_4), 1, 8, nullptr },
+        { "sfxId_5", field_type::s32, offsetof(T, sfxId_5), 4, 1, nullptr },
+        { "dmypolyId_5", field_type::s32, offsetof(T, dmypolyId_5), 4, 1, nullptr },
+        { "reserve_5", field_type::u8, offsetof(T, reserve_5), 1, 8, nullptr },
+        { "sfxId_6", field_type::s32, offsetof(T, sfxId_6), 4, 1, nullptr },
+        { "dmypolyId_6", field_type::s32, offsetof(T, dmypolyId_6), 4, 1, nullptr },
+        { "reserve_6", field_type::u8, offsetof(T, reserve_6), 1, 8, nullptr },
+        { "sfxId_7", field_type::s32, offsetof(T, sfxId_7), 4, 1, nullptr },
+        { "dmypolyId_7", field_type::s32, offsetof(T, dmypolyId_7), 4, 1, nullptr },
+        { "reserve_7", field_type::u8, offsetof(T, reserve_7), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, sfxId_0) == 0);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, dmypolyId_0) == 4);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, reserve_0) == 8);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, sfxId_1) == 16);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, dmypolyId_1) == 20);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, reserve_1) == 24);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, sfxId_2) == 32);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, dmypolyId_2) == 36);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, reserve_2) == 40);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, sfxId_3) == 48);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, dmypolyId_3) == 52);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, reserve_3) == 56);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, sfxId_4) == 64);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, dmypolyId_4) == 68);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, reserve_4) == 72);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, sfxId_5) == 80);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, dmypolyId_5) == 84);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, reserve_5) == 88);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, sfxId_6) == 96);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, dmypolyId_6) == 100);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, reserve_6) == 104);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, sfxId_7) == 112);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, dmypolyId_7) == 116);
+static_assert(offsetof(paramdef::MODEL_SFX_PARAM_ST, reserve_7) == 120);
+
+}; // namespace params
+}; // namespace from
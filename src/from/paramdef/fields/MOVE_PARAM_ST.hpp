@@ -0,0 +1,100 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MOVE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MOVE_PARAM_ST> {
+    using T = paramdef::MOVE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 39> fields = {{
+        { "stayId", field_type::s32, offsetof(T, stayId), 4, 1, nullptr },
+        { "walkF", field_type::s32, offsetof(T, walkF), 4, 1, nullptr },
+        { "walkB", field_type::s32, offsetof(T, walkB), 4, 1, nullptr },
+        { "walkL", field_type::s32, offsetof(T, walkL), 4, 1, nullptr },
+        { "walkR", field_type::s32, offsetof(T, walkR), 4, 1, nullptr },
+        { "dashF", field_type::s32, offsetof(T, dashF), 4, 1, nullptr },
+        { "dashB", field_type::s32, offsetof(T, dashB), 4, 1, nullptr },
+        { "dashL", field_type::s32, offsetof(T, dashL), 4, 1, nullptr },
+        { "dashR", field_type::s32, offsetof(T, dashR), 4, 1, nullptr },
+        { "superDash", field_type::s32, offsetof(T, superDash), 4, 1, nullptr },
+        { "escapeF", field_type::s32, offsetof(T, escapeF), 4, 1, nullptr },
+        { "escapeB", field_type::s32, offsetof(T, escapeB), 4, 1, nullptr },
+        { "escapeL", field_type::s32, offsetof(T, escapeL), 4, 1, nullptr },
+        { "escapeR", field_type::s32, offsetof(T, escapeR), 4, 1, nullptr },
+        { "turnL", field_type::s32, offsetof(T, turnL), 4, 1, nullptr },
+        { "trunR", field_type::s32, offsetof(T, trunR), 4, 1, nullptr },
+        { "largeTurnL", field_type::s32, offsetof(T, largeTurnL), 4, 1, nullptr },
+        { "largeTurnR", field_type::s32, offsetof(T, largeTurnR), 4, 1, nullptr },
+        { "stepMove", field_type::s32, offsetof(T, stepMove), 4, 1, nullptr },
+        { "flyStay", field_type::s32, offsetof(T, flyStay), 4, 1, nullptr },
+        { "flyWalkF", field_type::s32, offsetof(T, flyWalkF), 4, 1, nullptr },
+        { "flyWalkFL", field_type::s32, offsetof(T, flyWalkFL), 4, 1, nullptr },
+        { "flyWalkFR", field_type::s32, offsetof(T, flyWalkFR), 4, 1, nullptr },
+        { "flyWalkFL2", field_type::s32, offsetof(T, flyWalkFL2), 4, 1, nullptr },
+        { "flyWalkFR2", field_type::s32, offsetof(T, flyWalkFR2), 4, 1, nullptr },
+        { "flyDashF", field_type::s32, offsetof(T, flyDashF), 4, 1, nullptr },
+        { "flyDashFL", field_type::s32, offsetof(T, flyDashFL), 4, 1, nullptr },
+        { "flyDashFR", field_type::s32, offsetof(T, flyDashFR), 4, 1, nullptr },
+        { "flyDashFL2", field_type::s32, offsetof(T, flyDashFL2), 4, 1, nullptr },
+        { "flyDashFR2", field_type::s32, offsetof(T, flyDashFR2), 4, 1, nullptr },
+        { "dashEscapeF", field_type::s32, offsetof(T, dashEscapeF), 4, 1, nullptr },
+        { "dashEscapeB", field_type::s32, offsetof(T, dashEscapeB), 4, 1, nullptr },
+        { "dashEscapeL", field_type::s32, offsetof(T, dashEscapeL), 4, 1, nullptr },
+        { "dashEscapeR", field_type::s32, offsetof(T, dashEscapeR), 4, 1, nullptr },
+        { "analogMoveParamId", field_type::s32, offsetof(T, analogMoveParamId), 4, 1, nullptr },
+        { "turnNoAnimAngle", field_type::u8, offsetof(T, turnNoAnimAngle), 1, 1, nullptr },
+        { "turn45Angle", field_type::u8, offsetof(T, turn45Angle), 1, 1, nullptr },
+        { "turn90Angle", field_type::u8, offsetof(T, turn90Angle), 1, 1, nullptr },
+        { "turnWaitNoAnimAngle", field_type::u8, offsetof(T, turnWaitNoAnimAngle), 1, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, stayId) == 0);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, walkF) == 4);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, walkB) == 8);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, walkL) == 12);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, walkR) == 16);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, dashF) == 20);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, dashB) == 24);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, dashL) == 28);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, dashR) == 32);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, superDash) == 36);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, escapeF) == 40);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, escapeB) == 44);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, escapeL) == 48);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, escapeR) == 52);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, turnL) == 56);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, trunR) == 60);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, largeTurnL) == 64);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, largeTurnR) == 68);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, stepMove) == 72);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyStay) == 76);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyWalkF) == 80);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyWalkFL) == 84);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyWalkFR) == 88);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyWalkFL2) == 92);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyWalkFR2) == 96);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyDashF) == 100);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyDashFL) == 104);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyDashFR) == 108);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyDashFL2) == 112);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, flyDashFR2) == 116);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, dashEscapeF) == 120);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, dashEscapeB) == 124);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, dashEscapeL) == 128);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, dashEscapeR) == 132);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, analogMoveParamId) == 136);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, turnNoAnimAngle) == 140);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, turn45Angle) == 141);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, turn90Angle) == 142);
+static_assert(offsetof(paramdef::MOVE_PARAM_ST, turnWaitNoAnimAngle) == 143);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,56 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MULTI_ESTUS_FLASK_BONUS_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST> {
+    using T = paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 17> fields = {{
+        { "host", field_type::u8, offsetof(T, host), 1, 1, nullptr },
+        { "WhiteGhost_None", field_type::u8, offsetof(T, WhiteGhost_None), 1, 1, nullptr },
+        { "WhiteGhost_Umbasa", field_type::u8, offsetof(T, WhiteGhost_Umbasa), 1, 1, nullptr },
+        { "WhiteGhost_Berserker", field_type::u8, offsetof(T, WhiteGhost_Berserker), 1, 1, nullptr },
+        { "BlackGhost_None_Sign", field_type::u8, offsetof(T, BlackGhost_None_Sign), 1, 1, nullptr },
+        { "BlackGhost_Umbasa_Sign", field_type::u8, offsetof(T, BlackGhost_Umbasa_Sign), 1, 1, nullptr },
+        { "BlackGhost_Berserker_Sign", field_type::u8, offsetof(T, BlackGhost_Berserker_Sign), 1, 1, nullptr },
+        { "BlackGhost_None_Invade", field_type::u8, offsetof(T, BlackGhost_None_Invade), 1, 1, nullptr },
+        { "BlackGhost_Umbasa_Invade", field_type::u8, offsetof(T, BlackGhost_Umbasa_Invade), 1, 1, nullptr },
+        { "BlackGhost_Berserker_Invade", field_type::u8, offsetof(T, BlackGhost_Berserker_Invade), 1, 1, nullptr },
+        { "RedHunter1", field_type::u8, offsetof(T, RedHunter1), 1, 1, nullptr },
+        { "RedHunter2", field_type::u8, offsetof(T, RedHunter2), 1, 1, nullptr },
+        { "GuardianOfForest", field_type::u8, offsetof(T, GuardianOfForest), 1, 1, nullptr },
+        { "GuardianOfAnor", field_type::u8, offsetof(T, GuardianOfAnor), 1, 1, nullptr },
+        { "BattleRoyal", field_type::u8, offsetof(T, BattleRoyal), 1, 1, nullptr },
+        { "YellowMonk", field_type::u8, offsetof(T, YellowMonk), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 48, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, host) == 0);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, WhiteGhost_None) == 1);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, WhiteGhost_Umbasa) == 2);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, WhiteGhost_Berserker) == 3);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, BlackGhost_None_Sign) == 4);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, BlackGhost_Umbasa_Sign) == 5);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, BlackGhost_Berserker_Sign) == 6);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, BlackGhost_None_Invade) == 7);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, BlackGhost_Umbasa_Invade) == 8);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, BlackGhost_Berserker_Invade) == 9);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, RedHunter1) == 10);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, RedHunter2) == 11);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, GuardianOfForest) == 12);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, GuardianOfAnor) == 13);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, BattleRoyal) == 14);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, YellowMonk) == 15);
+static_assert(offsetof(paramdef::MULTI_ESTUS_FLASK_BONUS_PARAM_ST, pad1) == 16);
+
+}; // namespace params
+}; // namespace from
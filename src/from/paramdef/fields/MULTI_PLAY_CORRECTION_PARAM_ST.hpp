@@ -0,0 +1,36 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MULTI_PLAY_CORRECTION_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MULTI_PLAY_CORRECTION_PARAM_ST> {
+    using T = paramdef::MULTI_PLAY_CORRECTION_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 8> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "client1SpEffectId", field_type::s32, offsetof(T, client1SpEffectId), 4, 1, nullptr },
+        { "client2SpEffectId", field_type::s32, offsetof(T, client2SpEffectId), 4, 1, nullptr },
+        { "client3SpEffectId", field_type::s32, offsetof(T, client3SpEffectId), 4, 1, nullptr },
+        { "bOverrideSpEffect", field_type::boolean, offsetof(T, bOverrideSpEffect), 1, 1, nullptr },
+        { "pad3", field_type::u8, offsetof(T, pad3), 1, 15, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MULTI_PLAY_CORRECTION_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::MULTI_PLAY_CORRECTION_PARAM_ST, client1SpEffectId) == 4);
+static_assert(offsetof(paramdef::MULTI_PLAY_CORRECTION_PARAM_ST, client2SpEffectId) == 8);
+static_assert(offsetof(paramdef::MULTI_PLAY_CORRECTION_PARAM_ST, client3SpEffectId) == 12);
+static_assert(offsetof(paramdef::MULTI_PLAY_CORRECTION_PARAM_ST, bOverrideSpEffect) == 16);
+static_assert(offsetof(paramdef::MULTI_PLAY_CORRECTION_PARAM_ST, pad3) == 17);
+
+}; // namespace params
+}; // namespace from
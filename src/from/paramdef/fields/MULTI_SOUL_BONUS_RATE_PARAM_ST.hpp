@@ -0,0 +1,56 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../MULTI_SOUL_BONUS_RATE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST> {
+    using T = paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 17> fields = {{
+        { "host", field_type::f32, offsetof(T, host), 4, 1, nullptr },
+        { "WhiteGhost_None", field_type::f32, offsetof(T, WhiteGhost_None), 4, 1, nullptr },
+        { "WhiteGhost_Umbasa", field_type::f32, offsetof(T, WhiteGhost_Umbasa), 4, 1, nullptr },
+        { "WhiteGhost_Berserker", field_type::f32, offsetof(T, WhiteGhost_Berserker), 4, 1, nullptr },
+        { "BlackGhost_None_Sign", field_type::f32, offsetof(T, BlackGhost_None_Sign), 4, 1, nullptr },
+        { "BlackGhost_Umbasa_Sign", field_type::f32, offsetof(T, BlackGhost_Umbasa_Sign), 4, 1, nullptr },
+        { "BlackGhost_Berserker_Sign", field_type::f32, offsetof(T, BlackGhost_Berserker_Sign), 4, 1, nullptr },
+        { "BlackGhost_None_Invade", field_type::f32, offsetof(T, BlackGhost_None_Invade), 4, 1, nullptr },
+        { "BlackGhost_Umbasa_Invade", field_type::f32, offsetof(T, BlackGhost_Umbasa_Invade), 4, 1, nullptr },
+        { "BlackGhost_Berserker_Invade", field_type::f32, offsetof(T, BlackGhost_Berserker_Invade), 4, 1, nullptr },
+        { "RedHunter1", field_type::f32, offsetof(T, RedHunter1), 4, 1, nullptr },
+        { "RedHunter2", field_type::f32, offsetof(T, RedHunter2), 4, 1, nullptr },
+        { "GuardianOfForest", field_type::f32, offsetof(T, GuardianOfForest), 4, 1, nullptr },
+        { "GuardianOfAnor", field_type::f32, offsetof(T, GuardianOfAnor), 4, 1, nullptr },
+        { "BattleRoyal", field_type::f32, offsetof(T, BattleRoyal), 4, 1, nullptr },
+        { "YellowMonk", field_type::f32, offsetof(T, YellowMonk), 4, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 64, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, host) == 0);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, WhiteGhost_None) == 4);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, WhiteGhost_Umbasa) == 8);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, WhiteGhost_Berserker) == 12);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, BlackGhost_None_Sign) == 16);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, BlackGhost_Umbasa_Sign) == 20);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, BlackGhost_Berserker_Sign) == 24);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, BlackGhost_None_Invade) == 28);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, BlackGhost_Umbasa_Invade) == 32);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, BlackGhost_Berserker_Invade) == 36);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, RedHunter1) == 40);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, RedHunter2) == 44);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, GuardianOfForest) == 48);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, GuardianOfAnor) == 52);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, BattleRoyal) == 56);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, YellowMonk) == 60);
+static_assert(offsetof(paramdef::MULTI_SOUL_BONUS_RATE_PARAM_ST, pad1) == 64);
+
+}; // namespace params
+}; // namespace from
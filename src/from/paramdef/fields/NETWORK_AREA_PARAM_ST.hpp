@@ -0,0 +1,42 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../NETWORK_AREA_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::NETWORK_AREA_PARAM_ST> {
+    using T = paramdef::NETWORK_AREA_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 13> fields = {{
+        { "cellSizeX", field_type::f32, offsetof(T, cellSizeX), 4, 1, nullptr },
+        { "cellSizeY", field_type::f32, offsetof(T, cellSizeY), 4, 1, nullptr },
+        { "cellSizeZ", field_type::f32, offsetof(T, cellSizeZ), 4, 1, nullptr },
+        { "cellOffsetX", field_type::f32, offsetof(T, cellOffsetX), 4, 1, nullptr },
+        { "cellOffsetY", field_type::f32, offsetof(T, cellOffsetY), 4, 1, nullptr },
+        { "cellOffsetZ", field_type::f32, offsetof(T, cellOffsetZ), 4, 1, nullptr },
+        { "enableBloodstain", field_type::boolean, 24, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableBloodstain; } },
+        { "enableBloodMessage", field_type::boolean, 24, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableBloodMessage; } },
+        { "enableGhost", field_type::boolean, 24, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableGhost; } },
+        { "enableMultiPlay", field_type::boolean, 24, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableMultiPlay; } },
+        { "enableRingSearch", field_type::boolean, 24, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableRingSearch; } },
+        { "enableBreakInSearch", field_type::boolean, 24, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableBreakInSearch; } },
+        { "dummy", field_type::u8, offsetof(T, dummy), 1, 3, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::NETWORK_AREA_PARAM_ST, cellSizeX) == 0);
+static_assert(offsetof(paramdef::NETWORK_AREA_PARAM_ST, cellSizeY) == 4);
+static_assert(offsetof(paramdef::NETWORK_AREA_PARAM_ST, cellSizeZ) == 8);
+static_assert(offsetof(paramdef::NETWORK_AREA_PARAM_ST, cellOffsetX) == 12);
+static_assert(offsetof(paramdef::NETWORK_AREA_PARAM_ST, cellOffsetY) == 16);
+static_assert(offsetof(paramdef::NETWORK_AREA_PARAM_ST, cellOffsetZ) == 20);
+static_assert(offsetof(paramdef::NETWORK_AREA_PARAM_ST, dummy) == 25);
+
+}; // namespace params
+}; // namespace from
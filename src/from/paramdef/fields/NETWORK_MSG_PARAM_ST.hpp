@@ -0,0 +1,110 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../NETWORK_MSG_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::NETWORK_MSG_PARAM_ST> {
+    using T = paramdef::NETWORK_MSG_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 44> fields = {{
+        { "priority", field_type::u16, offsetof(T, priority), 2, 1, nullptr },
+        { "forcePlay", field_type::boolean, offsetof(T, forcePlay), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 1, nullptr },
+        { "normalWhite", field_type::s32, offsetof(T, normalWhite), 4, 1, nullptr },
+        { "umbasaWhite", field_type::s32, offsetof(T, umbasaWhite), 4, 1, nullptr },
+        { "berserkerWhite", field_type::s32, offsetof(T, berserkerWhite), 4, 1, nullptr },
+        { "sinnerHeroWhite", field_type::s32, offsetof(T, sinnerHeroWhite), 4, 1, nullptr },
+        { "normalBlack", field_type::s32, offsetof(T, normalBlack), 4, 1, nullptr },
+        { "umbasaBlack", field_type::s32, offsetof(T, umbasaBlack), 4, 1, nullptr },
+        { "berserkerBlack", field_type::s32, offsetof(T, berserkerBlack), 4, 1, nullptr },
+        { "forceJoinBlack", field_type::s32, offsetof(T, forceJoinBlack), 4, 1, nullptr },
+        { "forceJoinUmbasaBlack", field_type::s32, offsetof(T, forceJoinUmbasaBlack), 4, 1, nullptr },
+        { "forceJoinBerserkerBlack", field_type::s32, offsetof(T, forceJoinBerserkerBlack), 4, 1, nullptr },
+        { "sinnerHunterVisitor", field_type::s32, offsetof(T, sinnerHunterVisitor), 4, 1, nullptr },
+        { "redHunterVisitor", field_type::s32, offsetof(T, redHunterVisitor), 4, 1, nullptr },
+        { "guardianOfBossVisitor", field_type::s32, offsetof(T, guardianOfBossVisitor), 4, 1, nullptr },
+        { "guardianOfForestMapVisitor", field_type::s32, offsetof(T, guardianOfForestMapVisitor), 4, 1, nullptr },
+        { "guardianOfAnolisVisitor", field_type::s32, offsetof(T, guardianOfAnolisVisitor), 4, 1, nullptr },
+        { "rosaliaBlack", field_type::s32, offsetof(T, rosaliaBlack), 4, 1, nullptr },
+        { "forceJoinRosaliaBlack", field_type::s32, offsetof(T, forceJoinRosaliaBlack), 4, 1, nullptr },
+        { "redHunterVisitor2", field_type::s32, offsetof(T, redHunterVisitor2), 4, 1, nullptr },
+        { "npc1", field_type::s32, offsetof(T, npc1), 4, 1, nullptr },
+        { "npc2", field_type::s32, offsetof(T, npc2), 4, 1, nullptr },
+        { "npc3", field_type::s32, offsetof(T, npc3), 4, 1, nullptr },
+        { "npc4", field_type::s32, offsetof(T, npc4), 4, 1, nullptr },
+        { "battleRoyal", field_type::s32, offsetof(T, battleRoyal), 4, 1, nullptr },
+        { "npc5", field_type::s32, offsetof(T, npc5), 4, 1, nullptr },
+        { "npc6", field_type::s32, offsetof(T, npc6), 4, 1, nullptr },
+        { "npc7", field_type::s32, offsetof(T, npc7), 4, 1, nullptr },
+        { "npc8", field_type::s32, offsetof(T, npc8), 4, 1, nullptr },
+        { "npc9", field_type::s32, offsetof(T, npc9), 4, 1, nullptr },
+        { "npc10", field_type::s32, offsetof(T, npc10), 4, 1, nullptr },
+        { "npc11", field_type::s32, offsetof(T, npc11), 4, 1, nullptr },
+        { "npc12", field_type::s32, offsetof(T, npc12), 4, 1, nullptr },
+        { "npc13", field_type::s32, offsetof(T, npc13), 4, 1, nullptr },
+        { "npc14", field_type::s32, offsetof(T, npc14), 4, 1, nullptr },
+        { "npc15", field_type::s32, offsetof(T, npc15), 4, 1, nullptr },
+        { "npc16", field_type::s32, offsetof(T, npc16), 4, 1, nullptr },
+        { "forceJoinBlack_B", field_type::s32, offsetof(T, forceJoinBlack_B), 4, 1, nullptr },
+        { "normalWhite_Npc", field_type::s32, offsetof(T, normalWhite_Npc), 4, 1, nullptr },
+        { "forceJoinBlack_Npc", field_type::s32, offsetof(T, forceJoinBlack_Npc), 4, 1, nullptr },
+        { "forceJoinBlack_B_Npc", field_type::s32, offsetof(T, forceJoinBlack_B_Npc), 4, 1, nullptr },
+        { "forceJoinBlack_C_Npc", field_type::s32, offsetof(T, forceJoinBlack_C_Npc), 4, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 28, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, priority) == 0);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, forcePlay) == 2);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, pad1) == 3);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, normalWhite) == 4);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, umbasaWhite) == 8);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, berserkerWhite) == 12);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, sinnerHeroWhite) == 16);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, normalBlack) == 20);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, umbasaBlack) == 24);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, berserkerBlack) == 28);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, forceJoinBlack) == 32);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, forceJoinUmbasaBlack) == 36);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, forceJoinBerserkerBlack) == 40);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, sinnerHunterVisitor) == 44);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, redHunterVisitor) == 48);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, guardianOfBossVisitor) == 52);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, guardianOfForestMapVisitor) == 56);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, guardianOfAnolisVisitor) == 60);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, rosaliaBlack) == 64);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, forceJoinRosaliaBlack) == 68);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, redHunterVisitor2) == 72);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc1) == 76);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc2) == 80);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc3) == 84);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc4) == 88);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, battleRoyal) == 92);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc5) == 96);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc6) == 100);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc7) == 104);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc8) == 108);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc9) == 112);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc10) == 116);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc11) == 120);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc12) == 124);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc13) == 128);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc14) == 132);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc15) == 136);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, npc16) == 140);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, forceJoinBlack_B) == 144);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, normalWhite_Npc) == 148);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, forceJoinBlack_Npc) == 152);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, forceJoinBlack_B_Npc) == 156);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, forceJoinBlack_C_Npc) == 160);
+static_assert(offsetof(paramdef::NETWORK_MSG_PARAM_ST, pad2) == 164);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,332 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../NETWORK_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::NETWORK_PARAM_ST> {
+    using T = paramdef::NETWORK_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 155> fields = {{
+        { "signVerticalOffset", field_type::f32, offsetof(T, signVerticalOffset), 4, 1, nullptr },
+        { "maxSignPosCorrectionRange", field_type::f32, offsetof(T, maxSignPosCorrectionRange), 4, 1, nullptr },
+        { "summonTimeoutTime", field_type::f32, offsetof(T, summonTimeoutTime), 4, 1, nullptr },
+        { "pad_0", field_type::u8, offsetof(T, pad_0), 1, 4, nullptr },
+        { "signPuddleActiveMessageIntervalSec", field_type::f32, offsetof(T, signPuddleActiveMessageIntervalSec), 4, 1, nullptr },
+        { "keyGuideHeight_0", field_type::f32, offsetof(T, keyGuideHeight_0), 4, 1, nullptr },
+        { "reloadSignIntervalTime1", field_type::f32, offsetof(T, reloadSignIntervalTime1), 4, 1, nullptr },
+        { "reloadSignIntervalTime2", field_type::f32, offsetof(T, reloadSignIntervalTime2), 4, 1, nullptr },
+        { "reloadSignTotalCount_0", field_type::u32, offsetof(T, reloadSignTotalCount_0), 4, 1, nullptr },
+        { "reloadSignCellCount_0", field_type::u32, offsetof(T, reloadSignCellCount_0), 4, 1, nullptr },
+        { "updateSignIntervalTime", field_type::f32, offsetof(T, updateSignIntervalTime), 4, 1, nullptr },
+        { "basicExclusiveRange_0", field_type::f32, offsetof(T, basicExclusiveRange_0), 4, 1, nullptr },
+        { "basicExclusiveHeight_0", field_type::f32, offsetof(T, basicExclusiveHeight_0), 4, 1, nullptr },
+        { "previewChrWaitingTime", field_type::f32, offsetof(T, previewChrWaitingTime), 4, 1, nullptr },
+        { "signVisibleRange_0", field_type::f32, offsetof(T, signVisibleRange_0), 4, 1, nullptr },
+        { "cellGroupHorizontalRange_0", field_type::u32, offsetof(T, cellGroupHorizontalRange_0), 4, 1, nullptr },
+        { "cellGroupTopRange_0", field_type::u32, offsetof(T, cellGroupTopRange_0), 4, 1, nullptr },
+        { "cellGroupBottomRange_0", field_type::u32, offsetof(T, cellGroupBottomRange_0), 4, 1, nullptr },
+        { "minWhitePhantomLimitTimeScale", field_type::f32, offsetof(T, minWhitePhantomLimitTimeScale), 4, 1, nullptr },
+        { "minSmallPhantomLimitTimeScale", field_type::f32, offsetof(T, minSmallPhantomLimitTimeScale), 4, 1, nullptr },
+        { "whiteKeywordLimitTimeScale", field_type::f32, offsetof(T, whiteKeywordLimitTimeScale), 4, 1, nullptr },
+        { "smallKeywordLimitTimeScale", field_type::f32, offsetof(T, smallKeywordLimitTimeScale), 4, 1, nullptr },
+        { "blackKeywordLimitTimeScale", field_type::f32, offsetof(T, blackKeywordLimitTimeScale), 4, 1, nullptr },
+        { "dragonKeywordLimitTimeScale", field_type::f32, offsetof(T, dragonKeywordLimitTimeScale), 4, 1, nullptr },
+        { "singGetMax", field_type::u32, offsetof(T, singGetMax), 4, 1, nullptr },
+        { "signDownloadSpan", field_type::f32, offsetof(T, signDownloadSpan), 4, 1, nullptr },
+        { "signUpdateSpan", field_type::f32, offsetof(T, signUpdateSpan), 4, 1, nullptr },
+        { "signPad", field_type::u8, offsetof(T, signPad), 1, 4, nullptr },
+        { "maxBreakInTargetListCount", field_type::u32, offsetof(T, maxBreakInTargetListCount), 4, 1, nullptr },
+        { "breakInRequestIntervalTimeSec", field_type::f32, offsetof(T, breakInRequestIntervalTimeSec), 4, 1, nullptr },
+        { "breakInRequestTimeOutSec", field_type::f32, offsetof(T, breakInRequestTimeOutSec), 4, 1, nullptr },
+        { "pad_1", field_type::u8, offsetof(T, pad_1), 1, 4, nullptr },
+        { "keyGuideRange", field_type::f32, offsetof(T, keyGuideRange), 4, 1, nullptr },
+        { "keyGuideHeight_1", field_type::f32, offsetof(T, keyGuideHeight_1), 4, 1, nullptr },
+        { "reloadSignTotalCount_1", field_type::u32, offsetof(T, reloadSignTotalCount_1), 4, 1, nullptr },
+        { "reloadNewSignCellCount", field_type::u32, offsetof(T, reloadNewSignCellCount), 4, 1, nullptr },
+        { "reloadRandomSignCellCount", field_type::u32, offsetof(T, reloadRandomSignCellCount), 4, 1, nullptr },
+        { "maxSignTotalCount_0", field_type::u32, offsetof(T, maxSignTotalCount_0), 4, 1, nullptr },
+        { "maxSignCellCount_0", field_type::u32, offsetof(T, maxSignCellCount_0), 4, 1, nullptr },
+        { "basicExclusiveRange_1", field_type::f32, offsetof(T, basicExclusiveRange_1), 4, 1, nullptr },
+        { "basicExclusiveHeight_1", field_type::f32, offsetof(T, basicExclusiveHeight_1), 4, 1, nullptr },
+        { "signVisibleRange_1", field_type::f32, offsetof(T, signVisibleRange_1), 4, 1, nullptr },
+        { "maxWriteSignCount", field_type::u32, offsetof(T, maxWriteSignCount), 4, 1, nullptr },
+        { "maxReadSignCount", field_type::u32, offsetof(T, maxReadSignCount), 4, 1, nullptr },
+        { "reloadSignIntervalTime_0", field_type::f32, offsetof(T, reloadSignIntervalTime_0), 4, 1, nullptr },
+        { "cellGroupHorizontalRange_1", field_type::u32, offsetof(T, cellGroupHorizontalRange_1), 4, 1, nullptr },
+        { "cellGroupTopRange_1", field_type::u32, offsetof(T, cellGroupTopRange_1), 4, 1, nullptr },
+        { "cellGroupBottomRange_1", field_type::u32, offsetof(T, cellGroupBottomRange_1), 4, 1, nullptr },
+        { "lifeTime_0", field_type::u32, offsetof(T, lifeTime_0), 4, 1, nullptr },
+        { "downloadSpan_0", field_type::f32, offsetof(T, downloadSpan_0), 4, 1, nullptr },
+        { "downloadEvaluationSpan", field_type::f32, offsetof(T, downloadEvaluationSpan), 4, 1, nullptr },
+        { "pad_2", field_type::u8, offsetof(T, pad_2), 1, 4, nullptr },
+        { "deadingGhostStartPosThreshold", field_type::f32, offsetof(T, deadingGhostStartPosThreshold), 4, 1, nullptr },
+        { "keyGuideHeight_2", field_type::f32, offsetof(T, keyGuideHeight_2), 4, 1, nullptr },
+        { "keyGuideRangePlayer", field_type::f32, offsetof(T, keyGuideRangePlayer), 4, 1, nullptr },
+        { "keyGuideHeightPlayer", field_type::f32, offsetof(T, keyGuideHeightPlayer), 4, 1, nullptr },
+        { "reloadSignTotalCount_2", field_type::u32, offsetof(T, reloadSignTotalCount_2), 4, 1, nullptr },
+        { "reloadSignCellCount_1", field_type::u32, offsetof(T, reloadSignCellCount_1), 4, 1, nullptr },
+        { "maxSignTotalCount_1", field_type::u32, offsetof(T, maxSignTotalCount_1), 4, 1, nullptr },
+        { "maxSignCellCount_1", field_type::u32, offsetof(T, maxSignCellCount_1), 4, 1, nullptr },
+        { "reloadSignIntervalTime_1", field_type::f32, offsetof(T, reloadSignIntervalTime_1), 4, 1, nullptr },
+        { "signVisibleRange_2", field_type::f32, offsetof(T, signVisibleRange_2), 4, 1, nullptr },
+        { "basicExclusiveRange_2", field_type::f32, offsetof(T, basicExclusiveRange_2), 4, 1, nullptr },
+        { "basicExclusiveHeight_2", field_type::f32, offsetof(T, basicExclusiveHeight_2), 4, 1, nullptr },
+        { "cellGroupHorizontalRange_2", field_type::u32, offsetof(T, cellGroupHorizontalRange_2), 4, 1, nullptr },
+        { "cellGroupTopRange_2", field_type::u32, offsetof(T, cellGroupTopRange_2), 4, 1, nullptr },
+        { "cellGroupBottomRange_2", field_type::u32, offsetof(T, cellGroupBottomRange_2), 4, 1, nullptr },
+        { "lifeTime_1", field_type::u32, offsetof(T, lifeTime_1), 4, 1, nullptr },
+        { "recordDeadingGhostTotalTime", field_type::f32, offsetof(T, recordDeadingGhostTotalTime), 4, 1, nullptr },
+        { "recordDeadingGhostMinTime", field_type::f32, offsetof(T, recordDeadingGhostMinTime), 4, 1, nullptr },
+        { "downloadSpan_1", field_type::f32, offsetof(T, downloadSpan_1), 4, 1, nullptr },
+        { "statueCreatableDistance", field_type::f32, offsetof(T, statueCreatableDistance), 4, 1, nullptr },
+        { "reloadGhostTotalCount", field_type::u32, offsetof(T, reloadGhostTotalCount), 4, 1, nullptr },
+        { "reloadGhostCellCount", field_type::u32, offsetof(T, reloadGhostCellCount), 4, 1, nullptr },
+        { "maxGhostTotalCount", field_type::u32, offsetof(T, maxGhostTotalCount), 4, 1, nullptr },
+        { "distanceOfBeginRecordVersus", field_type::f32, offsetof(T, distanceOfBeginRecordVersus), 4, 1, nullptr },
+        { "distanceOfEndRecordVersus", field_type::f32, offsetof(T, distanceOfEndRecordVersus), 4, 1, nullptr },
+        { "updateWanderGhostIntervalTime", field_type::f32, offsetof(T, updateWanderGhostIntervalTime), 4, 1, nullptr },
+        { "updateVersusGhostIntervalTime", field_type::f32, offsetof(T, updateVersusGhostIntervalTime), 4, 1, nullptr },
+        { "recordWanderingGhostTime", field_type::f32, offsetof(T, recordWanderingGhostTime), 4, 1, nullptr },
+        { "recordWanderingGhostMinTime", field_type::f32, offsetof(T, recordWanderingGhostMinTime), 4, 1, nullptr },
+        { "updateBonfireGhostIntervalTime", field_type::f32, offsetof(T, updateBonfireGhostIntervalTime), 4, 1, nullptr },
+        { "replayGhostRangeOnView", field_type::f32, offsetof(T, replayGhostRangeOnView), 4, 1, nullptr },
+        { "replayGhostRangeOutView", field_type::f32, offsetof(T, replayGhostRangeOutView), 4, 1, nullptr },
+        { "replayBonfireGhostTime", field_type::f32, offsetof(T, replayBonfireGhostTime), 4, 1, nullptr },
+        { "minBonfireGhostValidRange", field_type::f32, offsetof(T, minBonfireGhostValidRange), 4, 1, nullptr },
+        { "maxBonfireGhostValidRange", field_type::f32, offsetof(T, maxBonfireGhostValidRange), 4, 1, nullptr },
+        { "minReplayIntervalTime", field_type::f32, offsetof(T, minReplayIntervalTime), 4, 1, nullptr },
+        { "maxReplayIntervalTime", field_type::f32, offsetof(T, maxReplayIntervalTime), 4, 1, nullptr },
+        { "reloadGhostIntervalTime", field_type::f32, offsetof(T, reloadGhostIntervalTime), 4, 1, nullptr },
+        { "cellGroupHorizontalRange_3", field_type::u32, offsetof(T, cellGroupHorizontalRange_3), 4, 1, nullptr },
+        { "cellGroupTopRange_3", field_type::u32, offsetof(T, cellGroupTopRange_3), 4, 1, nullptr },
+        { "replayBonfirePhantomParamIdForCodename", field_type::s32, offsetof(T, replayBonfirePhantomParamIdForCodename), 4, 1, nullptr },
+        { "replayBonfireModeRange", field_type::f32, offsetof(T, replayBonfireModeRange), 4, 1, nullptr },
+        { "replayBonfirePhantomParamId", field_type::s32, offsetof(T, replayBonfirePhantomParamId), 4, 1, nullptr },
+        { "ghostpad", field_type::u8, offsetof(T, ghostpad), 1, 4, nullptr },
+        { "reloadVisitListCoolTime", field_type::f32, offsetof(T, reloadVisitListCoolTime), 4, 1, nullptr },
+        { "maxCoopBlueSummonCount", field_type::u32, offsetof(T, maxCoopBlueSummonCount), 4, 1, nullptr },
+        { "maxBellGuardSummonCount", field_type::u32, offsetof(T, maxBellGuardSummonCount), 4, 1, nullptr },
+        { "maxVisitListCount", field_type::u32, offsetof(T, maxVisitListCount), 4, 1, nullptr },
+        { "reloadSearch_CoopBlue_Min", field_type::f32, offsetof(T, reloadSearch_CoopBlue_Min), 4, 1, nullptr },
+        { "reloadSearch_CoopBlue_Max", field_type::f32, offsetof(T, reloadSearch_CoopBlue_Max), 4, 1, nullptr },
+        { "reloadSearch_BellGuard_Min", field_type::f32, offsetof(T, reloadSearch_BellGuard_Min), 4, 1, nullptr },
+        { "reloadSearch_BellGuard_Max", field_type::f32, offsetof(T, reloadSearch_BellGuard_Max), 4, 1, nullptr },
+        { "reloadSearch_RatKing_Min", field_type::f32, offsetof(T, reloadSearch_RatKing_Min), 4, 1, nullptr },
+        { "reloadSearch_RatKing_Max", field_type::f32, offsetof(T, reloadSearch_RatKing_Max), 4, 1, nullptr },
+        { "visitpad00", field_type::u8, offsetof(T, visitpad00), 1, 8, nullptr },
+        { "srttMaxLimit", field_type::f32, offsetof(T, srttMaxLimit), 4, 1, nullptr },
+        { "srttMeanLimit", field_type::f32, offsetof(T, srttMeanLimit), 4, 1, nullptr },
+        { "srttMeanDeviationLimit", field_type::f32, offsetof(T, srttMeanDeviationLimit), 4, 1, nullptr },
+        { "darkPhantomLimitBoostTime", field_type::f32, offsetof(T, darkPhantomLimitBoostTime), 4, 1, nullptr },
+        { "darkPhantomLimitBoostScale", field_type::f32, offsetof(T, darkPhantomLimitBoostScale), 4, 1, nullptr },
+        { "multiplayDisableLifeTime", field_type::f32, offsetof(T, multiplayDisableLifeTime), 4, 1, nullptr },
+        { "abyssMultiplayLimit", field_type::u8, offsetof(T, abyssMultiplayLimit), 1, 1, nullptr },
+        { "phantomWarpMinimumTime", field_type::u8, offsetof(T, phantomWarpMinimumTime), 1, 1, nullptr },
+        { "phantomReturnDelayTime", field_type::u8, offsetof(T, phantomReturnDelayTime), 1, 1, nullptr },
+        { "terminateTimeoutTime", field_type::u8, offsetof(T, terminateTimeoutTime), 1, 1, nullptr },
+        { "penaltyPointLanDisconnect", field_type::u16, offsetof(T, penaltyPointLanDisconnect), 2, 1, nullptr },
+        { "penaltyPointSignout", field_type::u16, offsetof(T, penaltyPointSignout), 2, 1, nullptr },
+        { "penaltyPointReboot", field_type::u16, offsetof(T, penaltyPointReboot), 2, 1, nullptr },
+        { "penaltyPointBeginPenalize", field_type::u16, offsetof(T, penaltyPointBeginPenalize), 2, 1, nullptr },
+        { "penaltyForgiveItemLimitTime", field_type::f32, offsetof(T, penaltyForgiveItemLimitTime), 4, 1, nullptr },
+        { "allAreaSearchRate_CoopBlue", field_type::u8, offsetof(T, allAreaSearchRate_CoopBlue), 1, 1, nullptr },
+        { "allAreaSearchRate_VsBlue", field_type::u8, offsetof(T, allAreaSearchRate_VsBlue), 1, 1, nullptr },
+        { "allAreaSearchRate_BellGuard", field_type::u8, offsetof(T, allAreaSearchRate_BellGuard), 1, 1, nullptr },
+        { "bloodMessageEvalHealRate", field_type::u8, offsetof(T, bloodMessageEvalHealRate), 1, 1, nullptr },
+        { "smallGoldSuccessHostRewardId", field_type::u32, offsetof(T, smallGoldSuccessHostRewardId), 4, 1, nullptr },
+        { "doorInvalidPlayAreaExtents", field_type::f32, offsetof(T, doorInvalidPlayAreaExtents), 4, 1, nullptr },
+        { "signDisplayMax", field_type::u8, offsetof(T, signDisplayMax), 1, 1, nullptr },
+        { "bloodStainDisplayMax", field_type::u8, offsetof(T, bloodStainDisplayMax), 1, 1, nullptr },
+        { "bloodMessageDisplayMax", field_type::u8, offsetof(T, bloodMessageDisplayMax), 1, 1, nullptr },
+        { "pad00", field_type::u8, offsetof(T, pad00), 1, 9, nullptr },
+        { "pad10", field_type::u8, offsetof(T, pad10), 1, 32, nullptr },
+        { "summonMessageInterval", field_type::f32, offsetof(T, summonMessageInterval), 4, 1, nullptr },
+        { "hostRegisterUpdateTime", field_type::f32, offsetof(T, hostRegisterUpdateTime), 4, 1, nullptr },
+        { "hostTimeOutTime", field_type::f32, offsetof(T, hostTimeOutTime), 4, 1, nullptr },
+        { "guestUpdateTime", field_type::f32, offsetof(T, guestUpdateTime), 4, 1, nullptr },
+        { "guestPlayerNoTimeOutTime", field_type::f32, offsetof(T, guestPlayerNoTimeOutTime), 4, 1, nullptr },
+        { "hostPlayerNoTimeOutTime", field_type::f32, offsetof(T, hostPlayerNoTimeOutTime), 4, 1, nullptr },
+        { "requestSearchQuickMatchLimit", field_type::u32, offsetof(T, requestSearchQuickMatchLimit), 4, 1, nullptr },
+        { "AvatarMatchSearchMax", field_type::u32, offsetof(T, AvatarMatchSearchMax), 4, 1, nullptr },
+        { "BattleRoyalMatchSearchMin", field_type::u32, offsetof(T, BattleRoyalMatchSearchMin), 4, 1, nullptr },
+        { "BattleRoyalMatchSearchMax", field_type::u32, offsetof(T, BattleRoyalMatchSearchMax), 4, 1, nullptr },
+        { "pad11", field_type::u8, offsetof(T, pad11), 1, 8, nullptr },
+        { "VisitorListMax", field_type::u32, offsetof(T, VisitorListMax), 4, 1, nullptr },
+        { "VisitorTimeOutTime", field_type::f32, offsetof(T, VisitorTimeOutTime), 4, 1, nullptr },
+        { "DownloadSpan", field_type::f32, offsetof(T, DownloadSpan), 4, 1, nullptr },
+        { "VisitorGuestRequestMessageIntervalSec", field_type::f32, offsetof(T, VisitorGuestRequestMessageIntervalSec), 4, 1, nullptr },
+        { "wanderGhostIntervalLifeTime", field_type::f32, offsetof(T, wanderGhostIntervalLifeTime), 4, 1, nullptr },
+        { "pad13", field_type::u8, offsetof(T, pad13), 1, 12, nullptr },
+        { "YellowMonkTimeOutTime", field_type::f32, offsetof(T, YellowMonkTimeOutTime), 4, 1, nullptr },
+        { "YellowMonkDownloadSpan", field_type::f32, offsetof(T, YellowMonkDownloadSpan), 4, 1, nullptr },
+        { "YellowMonkOverallFlowTimeOutTime", field_type::f32, offsetof(T, YellowMonkOverallFlowTimeOutTime), 4, 1, nullptr },
+        { "pad14_0", field_type::u8, offsetof(T, pad14_0), 1, 4, nullptr },
+        { "pad14_1", field_type::u8, offsetof(T, pad14_1), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, signVerticalOffset) == 0);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxSignPosCorrectionRange) == 4);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, summonTimeoutTime) == 8);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, pad_0) == 12);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, signPuddleActiveMessageIntervalSec) == 16);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, keyGuideHeight_0) == 20);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSignIntervalTime1) == 24);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSignIntervalTime2) == 28);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSignTotalCount_0) == 32);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSignCellCount_0) == 36);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, updateSignIntervalTime) == 40);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, basicExclusiveRange_0) == 44);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, basicExclusiveHeight_0) == 48);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, previewChrWaitingTime) == 52);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, signVisibleRange_0) == 56);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupHorizontalRange_0) == 60);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupTopRange_0) == 64);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupBottomRange_0) == 68);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, minWhitePhantomLimitTimeScale) == 72);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, minSmallPhantomLimitTimeScale) == 76);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, whiteKeywordLimitTimeScale) == 80);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, smallKeywordLimitTimeScale) == 84);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, blackKeywordLimitTimeScale) == 88);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, dragonKeywordLimitTimeScale) == 92);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, singGetMax) == 96);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, signDownloadSpan) == 100);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, signUpdateSpan) == 104);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, signPad) == 108);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxBreakInTargetListCount) == 112);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, breakInRequestIntervalTimeSec) == 116);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, breakInRequestTimeOutSec) == 120);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, pad_1) == 124);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, keyGuideRange) == 128);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, keyGuideHeight_1) == 132);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSignTotalCount_1) == 136);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadNewSignCellCount) == 140);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadRandomSignCellCount) == 144);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxSignTotalCount_0) == 148);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxSignCellCount_0) == 152);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, basicExclusiveRange_1) == 156);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, basicExclusiveHeight_1) == 160);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, signVisibleRange_1) == 164);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxWriteSignCount) == 168);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxReadSignCount) == 172);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSignIntervalTime_0) == 176);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupHorizontalRange_1) == 180);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupTopRange_1) == 184);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupBottomRange_1) == 188);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, lifeTime_0) == 192);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, downloadSpan_0) == 196);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, downloadEvaluationSpan) == 200);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, pad_2) == 204);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, deadingGhostStartPosThreshold) == 208);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, keyGuideHeight_2) == 212);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, keyGuideRangePlayer) == 216);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, keyGuideHeightPlayer) == 220);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSignTotalCount_2) == 224);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSignCellCount_1) == 228);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxSignTotalCount_1) == 232);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxSignCellCount_1) == 236);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSignIntervalTime_1) == 240);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, signVisibleRange_2) == 244);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, basicExclusiveRange_2) == 248);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, basicExclusiveHeight_2) == 252);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupHorizontalRange_2) == 256);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupTopRange_2) == 260);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupBottomRange_2) == 264);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, lifeTime_1) == 268);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, recordDeadingGhostTotalTime) == 272);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, recordDeadingGhostMinTime) == 276);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, downloadSpan_1) == 280);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, statueCreatableDistance) == 284);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadGhostTotalCount) == 288);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadGhostCellCount) == 292);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxGhostTotalCount) == 296);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, distanceOfBeginRecordVersus) == 300);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, distanceOfEndRecordVersus) == 304);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, updateWanderGhostIntervalTime) == 308);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, updateVersusGhostIntervalTime) == 312);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, recordWanderingGhostTime) == 316);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, recordWanderingGhostMinTime) == 320);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, updateBonfireGhostIntervalTime) == 324);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, replayGhostRangeOnView) == 328);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, replayGhostRangeOutView) == 332);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, replayBonfireGhostTime) == 336);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, minBonfireGhostValidRange) == 340);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxBonfireGhostValidRange) == 344);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, minReplayIntervalTime) == 348);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxReplayIntervalTime) == 352);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadGhostIntervalTime) == 356);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupHorizontalRange_3) == 360);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, cellGroupTopRange_3) == 364);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, replayBonfirePhantomParamIdForCodename) == 368);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, replayBonfireModeRange) == 372);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, replayBonfirePhantomParamId) == 376);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, ghostpad) == 380);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadVisitListCoolTime) == 384);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxCoopBlueSummonCount) == 388);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxBellGuardSummonCount) == 392);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, maxVisitListCount) == 396);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSearch_CoopBlue_Min) == 400);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSearch_CoopBlue_Max) == 404);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSearch_BellGuard_Min) == 408);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSearch_BellGuard_Max) == 412);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSearch_RatKing_Min) == 416);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, reloadSearch_RatKing_Max) == 420);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, visitpad00) == 424);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, srttMaxLimit) == 432);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, srttMeanLimit) == 436);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, srttMeanDeviationLimit) == 440);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, darkPhantomLimitBoostTime) == 444);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, darkPhantomLimitBoostScale) == 448);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, multiplayDisableLifeTime) == 452);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, abyssMultiplayLimit) == 456);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, phantomWarpMinimumTime) == 457);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, phantomReturnDelayTime) == 458);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, terminateTimeoutTime) == 459);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, penaltyPointLanDisconnect) == 460);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, penaltyPointSignout) == 462);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, penaltyPointReboot) == 464);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, penaltyPointBeginPenalize) == 466);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, penaltyForgiveItemLimitTime) == 468);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, allAreaSearchRate_CoopBlue) == 472);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, allAreaSearchRate_VsBlue) == 473);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, allAreaSearchRate_BellGuard) == 474);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, bloodMessageEvalHealRate) == 475);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, smallGoldSuccessHostRewardId) == 476);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, doorInvalidPlayAreaExtents) == 480);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, signDisplayMax) == 484);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, bloodStainDisplayMax) == 485);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, bloodMessageDisplayMax) == 486);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, pad00) == 487);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, pad10) == 496);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, summonMessageInterval) == 528);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, hostRegisterUpdateTime) == 532);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, hostTimeOutTime) == 536);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, guestUpdateTime) == 540);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, guestPlayerNoTimeOutTime) == 544);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, hostPlayerNoTimeOutTime) == 548);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, requestSearchQuickMatchLimit) == 552);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, AvatarMatchSearchMax) == 556);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, BattleRoyalMatchSearchMin) == 560);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, BattleRoyalMatchSearchMax) == 564);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, pad11) == 568);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, VisitorListMax) == 576);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, VisitorTimeOutTime) == 580);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, DownloadSpan) == 584);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, VisitorGuestRequestMessageIntervalSec) == 588);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, wanderGhostIntervalLifeTime) == 592);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, pad13) == 596);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, YellowMonkTimeOutTime) == 608);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, YellowMonkDownloadSpan) == 612);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, YellowMonkOverallFlowTimeOutTime) == 616);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, pad14_0) == 620);
+static_assert(offsetof(paramdef::NETWORK_PARAM_ST, pad14_1) == 624);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,44 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../NPC_AI_ACTION_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::NPC_AI_ACTION_PARAM_ST> {
+    using T = paramdef::NPC_AI_ACTION_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 11> fields = {{
+        { "moveDir", field_type::u8, offsetof(T, moveDir), 1, 1, nullptr },
+        { "key1", field_type::u8, offsetof(T, key1), 1, 1, nullptr },
+        { "key2", field_type::u8, offsetof(T, key2), 1, 1, nullptr },
+        { "key3", field_type::u8, offsetof(T, key3), 1, 1, nullptr },
+        { "bMoveDirHold", field_type::boolean, offsetof(T, bMoveDirHold), 1, 1, nullptr },
+        { "bKeyHold1", field_type::boolean, offsetof(T, bKeyHold1), 1, 1, nullptr },
+        { "bKeyHold2", field_type::boolean, offsetof(T, bKeyHold2), 1, 1, nullptr },
+        { "bKeyHold3", field_type::boolean, offsetof(T, bKeyHold3), 1, 1, nullptr },
+        { "gestureId", field_type::s32, offsetof(T, gestureId), 4, 1, nullptr },
+        { "bLifeEndSuccess", field_type::boolean, offsetof(T, bLifeEndSuccess), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 3, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, moveDir) == 0);
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, key1) == 1);
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, key2) == 2);
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, key3) == 3);
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, bMoveDirHold) == 4);
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, bKeyHold1) == 5);
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, bKeyHold2) == 6);
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, bKeyHold3) == 7);
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, gestureId) == 8);
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, bLifeEndSuccess) == 12);
+static_assert(offsetof(paramdef::NPC_AI_ACTION_PARAM_ST, pad1) == 13);
+
+}; // namespace params
+}; // namespace from
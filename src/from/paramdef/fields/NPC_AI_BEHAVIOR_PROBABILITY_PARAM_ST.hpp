@@ -0,0 +1,422 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST> {
+    using T = paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 200> fields = {{
+        { "param000", field_type::s16, offsetof(T, param000), 2, 1, nullptr },
+        { "param001", field_type::s16, offsetof(T, param001), 2, 1, nullptr },
+        { "param002", field_type::s16, offsetof(T, param002), 2, 1, nullptr },
+        { "param003", field_type::s16, offsetof(T, param003), 2, 1, nullptr },
+        { "param004", field_type::s16, offsetof(T, param004), 2, 1, nullptr },
+        { "param005", field_type::s16, offsetof(T, param005), 2, 1, nullptr },
+        { "param006", field_type::s16, offsetof(T, param006), 2, 1, nullptr },
+        { "param007", field_type::s16, offsetof(T, param007), 2, 1, nullptr },
+        { "param008", field_type::s16, offsetof(T, param008), 2, 1, nullptr },
+        { "param009", field_type::s16, offsetof(T, param009), 2, 1, nullptr },
+        { "param010", field_type::s16, offsetof(T, param010), 2, 1, nullptr },
+        { "param011", field_type::s16, offsetof(T, param011), 2, 1, nullptr },
+        { "param012", field_type::s16, offsetof(T, param012), 2, 1, nullptr },
+        { "param013", field_type::s16, offsetof(T, param013), 2, 1, nullptr },
+        { "param014", field_type::s16, offsetof(T, param014), 2, 1, nullptr },
+        { "param015", field_type::s16, offsetof(T, param015), 2, 1, nullptr },
+        { "param016", field_type::s16, offsetof(T, param016), 2, 1, nullptr },
+        { "param017", field_type::s16, offsetof(T, param017), 2, 1, nullptr },
+        { "param018", field_type::s16, offsetof(T, param018), 2, 1, nullptr },
+        { "param019", field_type::s16, offsetof(T, param019), 2, 1, nullptr },
+        { "param020", field_type::s16, offsetof(T, param020), 2, 1, nullptr },
+        { "param021", field_type::s16, offsetof(T, param021), 2, 1, nullptr },
+        { "param022", field_type::s16, offsetof(T, param022), 2, 1, nullptr },
+        { "param023", field_type::s16, offsetof(T, param023), 2, 1, nullptr },
+        { "param024", field_type::s16, offsetof(T, param024), 2, 1, nullptr },
+        { "param025", field_type::s16, offsetof(T, param025), 2, 1, nullptr },
+        { "param026", field_type::s16, offsetof(T, param026), 2, 1, nullptr },
+        { "param027", field_type::s16, offsetof(T, param027), 2, 1, nullptr },
+        { "param028", field_type::s16, offsetof(T, param028), 2, 1, nullptr },
+        { "param029", field_type::s16, offsetof(T, param029), 2, 1, nullptr },
+        { "param030", field_type::s16, offsetof(T, param030), 2, 1, nullptr },
+        { "param031", field_type::s16, offsetof(T, param031), 2, 1, nullptr },
+        { "param032", field_type::s16, offsetof(T, param032), 2, 1, nullptr },
+        { "param033", field_type::s16, offsetof(T, param033), 2, 1, nullptr },
+        { "param034", field_type::s16, offsetof(T, param034), 2, 1, nullptr },
+        { "param035", field_type::s16, offsetof(T, param035), 2, 1, nullptr },
+        { "param036", field_type::s16, offsetof(T, param036), 2, 1, nullptr },
+        { "param037", field_type::s16, offsetof(T, param037), 2, 1, nullptr },
+        { "param038", field_type::s16, offsetof(T, param038), 2, 1, nullptr },
+        { "param039", field_type::s16, offsetof(T, param039), 2, 1, nullptr },
+        { "param040", field_type::s16, offsetof(T, param040), 2, 1, nullptr },
+        { "param041", field_type::s16, offsetof(T, param041), 2, 1, nullptr },
+        { "param042", field_type::s16, offsetof(T, param042), 2, 1, nullptr },
+        { "param043", field_type::s16, offsetof(T, param043), 2, 1, nullptr },
+        { "param044", field_type::s16, offsetof(T, param044), 2, 1, nullptr },
+        { "param045", field_type::s16, offsetof(T, param045), 2, 1, nullptr },
+        { "param046", field_type::s16, offsetof(T, param046), 2, 1, nullptr },
+        { "param047", field_type::s16, offsetof(T, param047), 2, 1, nullptr },
+        { "param048", field_type::s16, offsetof(T, param048), 2, 1, nullptr },
+        { "param049", field_type::s16, offsetof(T, param049), 2, 1, nullptr },
+        { "param050", field_type::s16, offsetof(T, param050), 2, 1, nullptr },
+        { "param051", field_type::s16, offsetof(T, param051), 2, 1, nullptr },
+        { "param052", field_type::s16, offsetof(T, param052), 2, 1, nullptr },
+        { "param053", field_type::s16, offsetof(T, param053), 2, 1, nullptr },
+        { "param054", field_type::s16, offsetof(T, param054), 2, 1, nullptr },
+        { "param055", field_type::s16, offsetof(T, param055), 2, 1, nullptr },
+        { "param056", field_type::s16, offsetof(T, param056), 2, 1, nullptr },
+        { "param057", field_type::s16, offsetof(T, param057), 2, 1, nullptr },
+        { "param058", field_type::s16, offsetof(T, param058), 2, 1, nullptr },
+        { "param059", field_type::s16, offsetof(T, param059), 2, 1, nullptr },
+        { "param060", field_type::s16, offsetof(T, param060), 2, 1, nullptr },
+        { "param061", field_type::s16, offsetof(T, param061), 2, 1, nullptr },
+        { "param062", field_type::s16, offsetof(T, param062), 2, 1, nullptr },
+        { "param063", field_type::s16, offsetof(T, param063), 2, 1, nullptr },
+        { "param064", field_type::s16, offsetof(T, param064), 2, 1, nullptr },
+        { "param065", field_type::s16, offsetof(T, param065), 2, 1, nullptr },
+        { "param066", field_type::s16, offsetof(T, param066), 2, 1, nullptr },
+        { "param067", field_type::s16, offsetof(T, param067), 2, 1, nullptr },
+        { "param068", field_type::s16, offsetof(T, param068), 2, 1, nullptr },
+        { "param069", field_type::s16, offsetof(T, param069), 2, 1, nullptr },
+        { "param070", field_type::s16, offsetof(T, param070), 2, 1, nullptr },
+        { "param071", field_type::s16, offsetof(T, param071), 2, 1, nullptr },
+        { "param072", field_type::s16, offsetof(T, param072), 2, 1, nullptr },
+        { "param073", field_type::s16, offsetof(T, param073), 2, 1, nullptr },
+        { "param074", field_type::s16, offsetof(T, param074), 2, 1, nullptr },
+        { "param075", field_type::s16, offsetof(T, param075), 2, 1, nullptr },
+        { "param076", field_type::s16, offsetof(T, param076), 2, 1, nullptr },
+        { "param077", field_type::s16, offsetof(T, param077), 2, 1, nullptr },
+        { "param078", field_type::s16, offsetof(T, param078), 2, 1, nullptr },
+        { "param079", field_type::s16, offsetof(T, param079), 2, 1, nullptr },
+        { "param080", field_type::s16, offsetof(T, param080), 2, 1, nullptr },
+        { "param081", field_type::s16, offsetof(T, param081), 2, 1, nullptr },
+        { "param082", field_type::s16, offsetof(T, param082), 2, 1, nullptr },
+        { "param083", field_type::s16, offsetof(T, param083), 2, 1, nullptr },
+        { "param084", field_type::s16, offsetof(T, param084), 2, 1, nullptr },
+        { "param085", field_type::s16, offsetof(T, param085), 2, 1, nullptr },
+        { "param086", field_type::s16, offsetof(T, param086), 2, 1, nullptr },
+        { "param087", field_type::s16, offsetof(T, param087), 2, 1, nullptr },
+        { "param088", field_type::s16, offsetof(T, param088), 2, 1, nullptr },
+        { "param089", field_type::s16, offsetof(T, param089), 2, 1, nullptr },
+        { "param090", field_type::s16, offsetof(T, param090), 2, 1, nullptr },
+        { "param091", field_type::s16, offsetof(T, param091), 2, 1, nullptr },
+        { "param092", field_type::s16, offsetof(T, param092), 2, 1, nullptr },
+        { "param093", field_type::s16, offsetof(T, param093), 2, 1, nullptr },
+        { "param094", field_type::s16, offsetof(T, param094), 2, 1, nullptr },
+        { "param095", field_type::s16, offsetof(T, param095), 2, 1, nullptr },
+        { "param096", field_type::s16, offsetof(T, param096), 2, 1, nullptr },
+        { "param097", field_type::s16, offsetof(T, param097), 2, 1, nullptr },
+        { "param098", field_type::s16, offsetof(T, param098), 2, 1, nullptr },
+        { "param099", field_type::s16, offsetof(T, param099), 2, 1, nullptr },
+        { "param100", field_type::s16, offsetof(T, param100), 2, 1, nullptr },
+        { "param101", field_type::s16, offsetof(T, param101), 2, 1, nullptr },
+        { "param102", field_type::s16, offsetof(T, param102), 2, 1, nullptr },
+        { "param103", field_type::s16, offsetof(T, param103), 2, 1, nullptr },
+        { "param104", field_type::s16, offsetof(T, param104), 2, 1, nullptr },
+        { "param105", field_type::s16, offsetof(T, param105), 2, 1, nullptr },
+        { "param106", field_type::s16, offsetof(T, param106), 2, 1, nullptr },
+        { "param107", field_type::s16, offsetof(T, param107), 2, 1, nullptr },
+        { "param108", field_type::s16, offsetof(T, param108), 2, 1, nullptr },
+        { "param109", field_type::s16, offsetof(T, param109), 2, 1, nullptr },
+        { "param110", field_type::s16, offsetof(T, param110), 2, 1, nullptr },
+        { "param111", field_type::s16, offsetof(T, param111), 2, 1, nullptr },
+        { "param112", field_type::s16, offsetof(T, param112), 2, 1, nullptr },
+        { "param113", field_type::s16, offsetof(T, param113), 2, 1, nullptr },
+        { "param114", field_type::s16, offsetof(T, param114), 2, 1, nullptr },
+        { "param115", field_type::s16, offsetof(T, param115), 2, 1, nullptr },
+        { "param116", field_type::s16, offsetof(T, param116), 2, 1, nullptr },
+        { "param117", field_type::s16, offsetof(T, param117), 2, 1, nullptr },
+        { "param118", field_type::s16, offsetof(T, param118), 2, 1, nullptr },
+        { "param119", field_type::s16, offsetof(T, param119), 2, 1, nullptr },
+        { "param120", field_type::s16, offsetof(T, param120), 2, 1, nullptr },
+        { "param121", field_type::s16, offsetof(T, param121), 2, 1, nullptr },
+        { "param122", field_type::s16, offsetof(T, param122), 2, 1, nullptr },
+        { "param123", field_type::s16, offsetof(T, param123), 2, 1, nullptr },
+        { "param124", field_type::s16, offsetof(T, param124), 2, 1, nullptr },
+        { "param125", field_type::s16, offsetof(T, param125), 2, 1, nullptr },
+        { "param126", field_type::s16, offsetof(T, param126), 2, 1, nullptr },
+        { "param127", field_type::s16, offsetof(T, param127), 2, 1, nullptr },
+        { "param128", field_type::s16, offsetof(T, param128), 2, 1, nullptr },
+        { "param129", field_type::s16, offsetof(T, param129), 2, 1, nullptr },
+        { "param130", field_type::s16, offsetof(T, param130), 2, 1, nullptr },
+        { "param131", field_type::s16, offsetof(T, param131), 2, 1, nullptr },
+        { "param132", field_type::s16, offsetof(T, param132), 2, 1, nullptr },
+        { "param133", field_type::s16, offsetof(T, param133), 2, 1, nullptr },
+        { "param134", field_type::s16, offsetof(T, param134), 2, 1, nullptr },
+        { "param135", field_type::s16, offsetof(T, param135), 2, 1, nullptr },
+        { "param136", field_type::s16, offsetof(T, param136), 2, 1, nullptr },
+        { "param137", field_type::s16, offsetof(T, param137), 2, 1, nullptr },
+        { "param138", field_type::s16, offsetof(T, param138), 2, 1, nullptr },
+        { "param139", field_type::s16, offsetof(T, param139), 2, 1, nullptr },
+        { "param140", field_type::s16, offsetof(T, param140), 2, 1, nullptr },
+        { "param141", field_type::s16, offsetof(T, param141), 2, 1, nullptr },
+        { "param142", field_type::s16, offsetof(T, param142), 2, 1, nullptr },
+        { "param143", field_type::s16, offsetof(T, param143), 2, 1, nullptr },
+        { "param144", field_type::s16, offsetof(T, param144), 2, 1, nullptr },
+        { "param145", field_type::s16, offsetof(T, param145), 2, 1, nullptr },
+        { "param146", field_type::s16, offsetof(T, param146), 2, 1, nullptr },
+        { "param147", field_type::s16, offsetof(T, param147), 2, 1, nullptr },
+        { "param148", field_type::s16, offsetof(T, param148), 2, 1, nullptr },
+        { "param149", field_type::s16, offsetof(T, param149), 2, 1, nullptr },
+        { "param150", field_type::s16, offsetof(T, param150), 2, 1, nullptr },
+        { "param151", field_type::s16, offsetof(T, param151), 2, 1, nullptr },
+        { "param152", field_type::s16, offsetof(T, param152), 2, 1, nullptr },
+        { "param153", field_type::s16, offsetof(T, param153), 2, 1, nullptr },
+        { "param154", field_type::s16, offsetof(T, param154), 2, 1, nullptr },
+        { "param155", field_type::s16, offsetof(T, param155), 2, 1, nullptr },
+        { "param156", field_type::s16, offsetof(T, param156), 2, 1, nullptr },
+        { "param157", field_type::s16, offsetof(T, param157), 2, 1, nullptr },
+        { "param158", field_type::s16, offsetof(T, param158), 2, 1, nullptr },
+        { "param159", field_type::s16, offsetof(T, param159), 2, 1, nullptr },
+        { "param160", field_type::s16, offsetof(T, param160), 2, 1, nullptr },
+        { "param161", field_type::s16, offsetof(T, param161), 2, 1, nullptr },
+        { "param162", field_type::s16, offsetof(T, param162), 2, 1, nullptr },
+        { "param163", field_type::s16, offsetof(T, param163), 2, 1, nullptr },
+        { "param164", field_type::s16, offsetof(T, param164), 2, 1, nullptr },
+        { "param165", field_type::s16, offsetof(T, param165), 2, 1, nullptr },
+        { "param166", field_type::s16, offsetof(T, param166), 2, 1, nullptr },
+        { "param167", field_type::s16, offsetof(T, param167), 2, 1, nullptr },
+        { "param168", field_type::s16, offsetof(T, param168), 2, 1, nullptr },
+        { "param169", field_type::s16, offsetof(T, param169), 2, 1, nullptr },
+        { "param170", field_type::s16, offsetof(T, param170), 2, 1, nullptr },
+        { "param171", field_type::s16, offsetof(T, param171), 2, 1, nullptr },
+        { "param172", field_type::s16, offsetof(T, param172), 2, 1, nullptr },
+        { "param173", field_type::s16, offsetof(T, param173), 2, 1, nullptr },
+        { "param174", field_type::s16, offsetof(T, param174), 2, 1, nullptr },
+        { "param175", field_type::s16, offsetof(T, param175), 2, 1, nullptr },
+        { "param176", field_type::s16, offsetof(T, param176), 2, 1, nullptr },
+        { "param177", field_type::s16, offsetof(T, param177), 2, 1, nullptr },
+        { "param178", field_type::s16, offsetof(T, param178), 2, 1, nullptr },
+        { "param179", field_type::s16, offsetof(T, param179), 2, 1, nullptr },
+        { "param180", field_type::s16, offsetof(T, param180), 2, 1, nullptr },
+        { "param181", field_type::s16, offsetof(T, param181), 2, 1, nullptr },
+        { "param182", field_type::s16, offsetof(T, param182), 2, 1, nullptr },
+        { "param183", field_type::s16, offsetof(T, param183), 2, 1, nullptr },
+        { "param184", field_type::s16, offsetof(T, param184), 2, 1, nullptr },
+        { "param185", field_type::s16, offsetof(T, param185), 2, 1, nullptr },
+        { "param186", field_type::s16, offsetof(T, param186), 2, 1, nullptr },
+        { "param187", field_type::s16, offsetof(T, param187), 2, 1, nullptr },
+        { "param188", field_type::s16, offsetof(T, param188), 2, 1, nullptr },
+        { "param189", field_type::s16, offsetof(T, param189), 2, 1, nullptr },
+        { "param190", field_type::s16, offsetof(T, param190), 2, 1, nullptr },
+        { "param191", field_type::s16, offsetof(T, param191), 2, 1, nullptr },
+        { "param192", field_type::s16, offsetof(T, param192), 2, 1, nullptr },
+        { "param193", field_type::s16, offsetof(T, param193), 2, 1, nullptr },
+        { "param194", field_type::s16, offsetof(T, param194), 2, 1, nullptr },
+        { "param195", field_type::s16, offsetof(T, param195), 2, 1, nullptr },
+        { "param196", field_type::s16, offsetof(T, param196), 2, 1, nullptr },
+        { "param197", field_type::s16, offsetof(T, param197), 2, 1, nullptr },
+        { "param198", field_type::s16, offsetof(T, param198), 2, 1, nullptr },
+        { "param199", field_type::s16, offsetof(T, param199), 2, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param000) == 0);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param001) == 2);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param002) == 4);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param003) == 6);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param004) == 8);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param005) == 10);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param006) == 12);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param007) == 14);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param008) == 16);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param009) == 18);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param010) == 20);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param011) == 22);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param012) == 24);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param013) == 26);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param014) == 28);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param015) == 30);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param016) == 32);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param017) == 34);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param018) == 36);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param019) == 38);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param020) == 40);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param021) == 42);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param022) == 44);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param023) == 46);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param024) == 48);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param025) == 50);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param026) == 52);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param027) == 54);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param028) == 56);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param029) == 58);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param030) == 60);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param031) == 62);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param032) == 64);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param033) == 66);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param034) == 68);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param035) == 70);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param036) == 72);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param037) == 74);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param038) == 76);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param039) == 78);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param040) == 80);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param041) == 82);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param042) == 84);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param043) == 86);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param044) == 88);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param045) == 90);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param046) == 92);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param047) == 94);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param048) == 96);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param049) == 98);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param050) == 100);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param051) == 102);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param052) == 104);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param053) == 106);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param054) == 108);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param055) == 110);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param056) == 112);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param057) == 114);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param058) == 116);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param059) == 118);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param060) == 120);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param061) == 122);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param062) == 124);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param063) == 126);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param064) == 128);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param065) == 130);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param066) == 132);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param067) == 134);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param068) == 136);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param069) == 138);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param070) == 140);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param071) == 142);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param072) == 144);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param073) == 146);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param074) == 148);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param075) == 150);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param076) == 152);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param077) == 154);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param078) == 156);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param079) == 158);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param080) == 160);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param081) == 162);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param082) == 164);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param083) == 166);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param084) == 168);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param085) == 170);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param086) == 172);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param087) == 174);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param088) == 176);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param089) == 178);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param090) == 180);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param091) == 182);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param092) == 184);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param093) == 186);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param094) == 188);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param095) == 190);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param096) == 192);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param097) == 194);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param098) == 196);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param099) == 198);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param100) == 200);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param101) == 202);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param102) == 204);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param103) == 206);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param104) == 208);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param105) == 210);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param106) == 212);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param107) == 214);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param108) == 216);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param109) == 218);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param110) == 220);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param111) == 222);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param112) == 224);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param113) == 226);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param114) == 228);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param115) == 230);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param116) == 232);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param117) == 234);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param118) == 236);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param119) == 238);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param120) == 240);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param121) == 242);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param122) == 244);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param123) == 246);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param124) == 248);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param125) == 250);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param126) == 252);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param127) == 254);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param128) == 256);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param129) == 258);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param130) == 260);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param131) == 262);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param132) == 264);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param133) == 266);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param134) == 268);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param135) == 270);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param136) == 272);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param137) == 274);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param138) == 276);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param139) == 278);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param140) == 280);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param141) == 282);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param142) == 284);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param143) == 286);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param144) == 288);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param145) == 290);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param146) == 292);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param147) == 294);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param148) == 296);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param149) == 298);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param150) == 300);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param151) == 302);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param152) == 304);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param153) == 306);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param154) == 308);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param155) == 310);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param156) == 312);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param157) == 314);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param158) == 316);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param159) == 318);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param160) == 320);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param161) == 322);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param162) == 324);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param163) == 326);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param164) == 328);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param165) == 330);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param166) == 332);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param167) == 334);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param168) == 336);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param169) == 338);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param170) == 340);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param171) == 342);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param172) == 344);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param173) == 346);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param174) == 348);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param175) == 350);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param176) == 352);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param177) == 354);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param178) == 356);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param179) == 358);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param180) == 360);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param181) == 362);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param182) == 364);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param183) == 366);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param184) == 368);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param185) == 370);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param186) == 372);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param187) == 374);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param188) == 376);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param189) == 378);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param190) == 380);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param191) == 382);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param192) == 384);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param193) == 386);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param194) == 388);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param195) == 390);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param196) == 392);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param197) == 394);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param198) == 396);
+static_assert(offsetof(paramdef::NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST, param199) == 398);
+
+}; // namespace params
+}; // namespace from
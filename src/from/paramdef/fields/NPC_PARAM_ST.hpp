@@ -0,0 +1,584 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../NPC_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::NPC_PARAM_ST> {
+    using T = paramdef::NPC_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 318> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "behaviorVariationId", field_type::s32, offsetof(T, behaviorVariationId), 4, 1, nullptr },
+        { "resistCorrectId_poison", field_type::s32, offsetof(T, resistCorrectId_poison), 4, 1, nullptr },
+        { "nameId", field_type::s32, offsetof(T, nameId), 4, 1, nullptr },
+        { "turnVellocity", field_type::f32, offsetof(T, turnVellocity), 4, 1, nullptr },
+        { "hitHeight", field_type::f32, offsetof(T, hitHeight), 4, 1, nullptr },
+        { "hitRadius", field_type::f32, offsetof(T, hitRadius), 4, 1, nullptr },
+        { "weight", field_type::u32, offsetof(T, weight), 4, 1, nullptr },
+        { "hitYOffset", field_type::f32, offsetof(T, hitYOffset), 4, 1, nullptr },
+        { "hp", field_type::u32, offsetof(T, hp), 4, 1, nullptr },
+        { "mp", field_type::u32, offsetof(T, mp), 4, 1, nullptr },
+        { "getSoul", field_type::u32, offsetof(T, getSoul), 4, 1, nullptr },
+        { "itemLotId_enemy", field_type::s32, offsetof(T, itemLotId_enemy), 4, 1, nullptr },
+        { "itemLotId_map", field_type::s32, offsetof(T, itemLotId_map), 4, 1, nullptr },
+        { "maxAnkleRollAngle", field_type::f32, offsetof(T, maxAnkleRollAngle), 4, 1, nullptr },
+        { "chrHitGroupAndNavimesh", field_type::u8, offsetof(T, chrHitGroupAndNavimesh), 1, 1, nullptr },
+        { "faceIconId", field_type::u8, offsetof(T, faceIconId), 1, 1, nullptr },
+        { "deactivateDist", field_type::s16, offsetof(T, deactivateDist), 2, 1, nullptr },
+        { "chrActivateConditionParamId", field_type::u32, offsetof(T, chrActivateConditionParamId), 4, 1, nullptr },
+        { "footIkErrorHeightLimit", field_type::f32, offsetof(T, footIkErrorHeightLimit), 4, 1, nullptr },
+        { "humanityLotId", field_type::s32, offsetof(T, humanityLotId), 4, 1, nullptr },
+        { "spEffectID0", field_type::s32, offsetof(T, spEffectID0), 4, 1, nullptr },
+        { "spEffectID1", field_type::s32, offsetof(T, spEffectID1), 4, 1, nullptr },
+        { "spEffectID2", field_type::s32, offsetof(T, spEffectID2), 4, 1, nullptr },
+        { "spEffectID3", field_type::s32, offsetof(T, spEffectID3), 4, 1, nullptr },
+        { "spEffectID4", field_type::s32, offsetof(T, spEffectID4), 4, 1, nullptr },
+        { "spEffectID5", field_type::s32, offsetof(T, spEffectID5), 4, 1, nullptr },
+        { "spEffectID6", field_type::s32, offsetof(T, spEffectID6), 4, 1, nullptr },
+        { "spEffectID7", field_type::s32, offsetof(T, spEffectID7), 4, 1, nullptr },
+        { "GameClearSpEffectID", field_type::s32, offsetof(T, GameClearSpEffectID), 4, 1, nullptr },
+        { "physGuardCutRate", field_type::f32, offsetof(T, physGuardCutRate), 4, 1, nullptr },
+        { "magGuardCutRate", field_type::f32, offsetof(T, magGuardCutRate), 4, 1, nullptr },
+        { "fireGuardCutRate", field_type::f32, offsetof(T, fireGuardCutRate), 4, 1, nullptr },
+        { "thunGuardCutRate", field_type::f32, offsetof(T, thunGuardCutRate), 4, 1, nullptr },
+        { "animIdOffset", field_type::s32, offsetof(T, animIdOffset), 4, 1, nullptr },
+        { "lockGazePoint0", field_type::s16, offsetof(T, lockGazePoint0), 2, 1, nullptr },
+        { "lockGazePoint1", field_type::s16, offsetof(T, lockGazePoint1), 2, 1, nullptr },
+        { "lockGazePoint2", field_type::s16, offsetof(T, lockGazePoint2), 2, 1, nullptr },
+        { "lockGazePoint3", field_type::s16, offsetof(T, lockGazePoint3), 2, 1, nullptr },
+        { "lockGazePoint4", field_type::s16, offsetof(T, lockGazePoint4), 2, 1, nullptr },
+        { "lockGazePoint5", field_type::s16, offsetof(T, lockGazePoint5), 2, 1, nullptr },
+        { "networkWarpDist", field_type::f32, offsetof(T, networkWarpDist), 4, 1, nullptr },
+        { "dbgBehaviorR1", field_type::s32, offsetof(T, dbgBehaviorR1), 4, 1, nullptr },
+        { "dbgBehaviorL1", field_type::s32, offsetof(T, dbgBehaviorL1), 4, 1, nullptr },
+        { "dbgBehaviorR2", field_type::s32, offsetof(T, dbgBehaviorR2), 4, 1, nullptr },
+        { "dbgBehaviorL2", field_type::s32, offsetof(T, dbgBehaviorL2), 4, 1, nullptr },
+        { "dbgBehaviorRL", field_type::s32, offsetof(T, dbgBehaviorRL), 4, 1, nullptr },
+        { "dbgBehaviorRR", field_type::s32, offsetof(T, dbgBehaviorRR), 4, 1, nullptr },
+        { "dbgBehaviorRD", field_type::s32, offsetof(T, dbgBehaviorRD), 4, 1, nullptr },
+        { "dbgBehaviorRU", field_type::s32, offsetof(T, dbgBehaviorRU), 4, 1, nullptr },
+        { "dbgBehaviorLL", field_type::s32, offsetof(T, dbgBehaviorLL), 4, 1, nullptr },
+        { "dbgBehaviorLR", field_type::s32, offsetof(T, dbgBehaviorLR), 4, 1, nullptr },
+        { "dbgBehaviorLD", field_type::s32, offsetof(T, dbgBehaviorLD), 4, 1, nullptr },
+        { "dbgBehaviorLU", field_type::s32, offsetof(T, dbgBehaviorLU), 4, 1, nullptr },
+        { "animIdOffset2", field_type::s32, offsetof(T, animIdOffset2), 4, 1, nullptr },
+        { "partsDamageRate1", field_type::f32, offsetof(T, partsDamageRate1), 4, 1, nullptr },
+        { "partsDamageRate2", field_type::f32, offsetof(T, partsDamageRate2), 4, 1, nullptr },
+        { "partsDamageRate3", field_type::f32, offsetof(T, partsDamageRate3), 4, 1, nullptr },
+        { "partsDamageRate4", field_type::f32, offsetof(T, partsDamageRate4), 4, 1, nullptr },
+        { "partsDamageRate5", field_type::f32, offsetof(T, partsDamageRate5), 4, 1, nullptr },
+        { "partsDamageRate6", field_type::f32, offsetof(T, partsDamageRate6), 4, 1, nullptr },
+        { "partsDamageRate7", field_type::f32, offsetof(T, partsDamageRate7), 4, 1, nullptr },
+        { "partsDamageRate8", field_type::f32, offsetof(T, partsDamageRate8), 4, 1, nullptr },
+        { "weakPartsDamageRate", field_type::f32, offsetof(T, weakPartsDamageRate), 4, 1, nullptr },
+        { "superArmorRecoverCorrection", field_type::f32, offsetof(T, superArmorRecoverCorrection), 4, 1, nullptr },
+        { "superArmorBrakeKnockbackDist", field_type::f32, offsetof(T, superArmorBrakeKnockbackDist), 4, 1, nullptr },
+        { "stamina", field_type::u16, offsetof(T, stamina), 2, 1, nullptr },
+        { "staminaRecoverBaseVel", field_type::u16, offsetof(T, staminaRecoverBaseVel), 2, 1, nullptr },
+        { "def_phys", field_type::u16, offsetof(T, def_phys), 2, 1, nullptr },
+        { "def_slash", field_type::s16, offsetof(T, def_slash), 2, 1, nullptr },
+        { "def_blow", field_type::s16, offsetof(T, def_blow), 2, 1, nullptr },
+        { "def_thrust", field_type::s16, offsetof(T, def_thrust), 2, 1, nullptr },
+        { "def_mag", field_type::u16, offsetof(T, def_mag), 2, 1, nullptr },
+        { "def_fire", field_type::u16, offsetof(T, def_fire), 2, 1, nullptr },
+        { "def_thunder", field_type::u16, offsetof(T, def_thunder), 2, 1, nullptr },
+        { "defFlickPower", field_type::u16, offsetof(T, defFlickPower), 2, 1, nullptr },
+        { "resist_poison", field_type::u16, offsetof(T, resist_poison), 2, 1, nullptr },
+        { "resist_desease", field_type::u16, offsetof(T, resist_desease), 2, 1, nullptr },
+        { "resist_blood", field_type::u16, offsetof(T, resist_blood), 2, 1, nullptr },
+        { "resist_curse", field_type::u16, offsetof(T, resist_curse), 2, 1, nullptr },
+        { "ghostModelId", field_type::s16, offsetof(T, ghostModelId), 2, 1, nullptr },
+        { "normalChangeResouceId", field_type::s16, offsetof(T, normalChangeResouceId), 2, 1, nullptr },
+        { "guardAngle", field_type::s16, offsetof(T, guardAngle), 2, 1, nullptr },
+        { "slashGuardCutRate", field_type::s16, offsetof(T, slashGuardCutRate), 2, 1, nullptr },
+        { "blowGuardCutRate", field_type::s16, offsetof(T, blowGuardCutRate), 2, 1, nullptr },
+        { "thrustGuardCutRate", field_type::s16, offsetof(T, thrustGuardCutRate), 2, 1, nullptr },
+        { "lockGazePoint6", field_type::s16, offsetof(T, lockGazePoint6), 2, 1, nullptr },
+        { "normalChangeTexChrId", field_type::s16, offsetof(T, normalChangeTexChrId), 2, 1, nullptr },
+        { "dropType", field_type::u16, offsetof(T, dropType), 2, 1, nullptr },
+        { "knockbackRate", field_type::u8, offsetof(T, knockbackRate), 1, 1, nullptr },
+        { "knockbackParamId", field_type::u8, offsetof(T, knockbackParamId), 1, 1, nullptr },
+        { "fallDamageDump", field_type::u8, offsetof(T, fallDamageDump), 1, 1, nullptr },
+        { "staminaGuardDef", field_type::u8, offsetof(T, staminaGuardDef), 1, 1, nullptr },
+        { "resist_sleep", field_type::u16, offsetof(T, resist_sleep), 2, 1, nullptr },
+        { "resist_madness", field_type::u16, offsetof(T, resist_madness), 2, 1, nullptr },
+        { "sleepGuardResist", field_type::s8, offsetof(T, sleepGuardResist), 1, 1, nullptr },
+        { "madnessGuardResist", field_type::s8, offsetof(T, madnessGuardResist), 1, 1, nullptr },
+        { "lockGazePoint7", field_type::s16, offsetof(T, lockGazePoint7), 2, 1, nullptr },
+        { "mpRecoverBaseVel", field_type::u8, offsetof(T, mpRecoverBaseVel), 1, 1, nullptr },
+        { "flickDamageCutRate", field_type::u8, offsetof(T, flickDamageCutRate), 1, 1, nullptr },
+        { "defaultLodParamId", field_type::s8, offsetof(T, defaultLodParamId), 1, 1, nullptr },
+        { "drawType", field_type::s8, offsetof(T, drawType), 1, 1, nullptr },
+        { "npcType", field_type::u8, offsetof(T, npcType), 1, 1, nullptr },
+        { "teamType", field_type::u8, offsetof(T, teamType), 1, 1, nullptr },
+        { "moveType", field_type::u8, offsetof(T, moveType), 1, 1, nullptr },
+        { "lockDist", field_type::u8, offsetof(T, lockDist), 1, 1, nullptr },
+        { "materialSe_Weak1", field_type::u16, offsetof(T, materialSe_Weak1), 2, 1, nullptr },
+        { "materialSfx_Weak1", field_type::u16, offsetof(T, materialSfx_Weak1), 2, 1, nullptr },
+        { "partsDamageType", field_type::u8, offsetof(T, partsDamageType), 1, 1, nullptr },
+        { "vowType", field_type::u8, offsetof(T, vowType), 1, 1, nullptr },
+        { "guardLevel", field_type::s8, offsetof(T, guardLevel), 1, 1, nullptr },
+        { "burnSfxType", field_type::u8, offsetof(T, burnSfxType), 1, 1, nullptr },
+        { "poisonGuardResist", field_type::s8, offsetof(T, poisonGuardResist), 1, 1, nullptr },
+        { "diseaseGuardResist", field_type::s8, offsetof(T, diseaseGuardResist), 1, 1, nullptr },
+        { "bloodGuardResist", field_type::s8, offsetof(T, bloodGuardResist), 1, 1, nullptr },
+        { "curseGuardResist", field_type::s8, offsetof(T, curseGuardResist), 1, 1, nullptr },
+        { "parryAttack", field_type::u8, offsetof(T, parryAttack), 1, 1, nullptr },
+        { "parryDefence", field_type::u8, offsetof(T, parryDefence), 1, 1, nullptr },
+        { "sfxSize", field_type::u8, offsetof(T, sfxSize), 1, 1, nullptr },
+        { "pushOutCamRegionRadius", field_type::u8, offsetof(T, pushOutCamRegionRadius), 1, 1, nullptr },
+        { "hitStopType", field_type::u8, offsetof(T, hitStopType), 1, 1, nullptr },
+        { "ladderEndChkOffsetTop", field_type::u8, offsetof(T, ladderEndChkOffsetTop), 1, 1, nullptr },
+        { "ladderEndChkOffsetLow", field_type::u8, offsetof(T, ladderEndChkOffsetLow), 1, 1, nullptr },
+        { "useRagdollCamHit", field_type::boolean, 329, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->useRagdollCamHit; } },
+        { "disableClothRigidHit", field_type::boolean, 329, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableClothRigidHit; } },
+        { "useUndulationAddAnimFB", field_type::boolean, 329, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->useUndulationAddAnimFB; } },
+        { "isWeakA", field_type::boolean, 329, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isWeakA; } },
+        { "isGhost", field_type::boolean, 329, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isGhost; } },
+        { "isNoDamageMotion", field_type::boolean, 329, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isNoDamageMotion; } },
+        { "isUnduration", field_type::boolean, 329, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUnduration; } },
+        { "isChangeWanderGhost", field_type::boolean, 329, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isChangeWanderGhost; } },
+        { "modelDispMask0", field_type::boolean, 330, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask0; } },
+        { "modelDispMask1", field_type::boolean, 330, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask1; } },
+        { "modelDispMask2", field_type::boolean, 330, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask2; } },
+        { "modelDispMask3", field_type::boolean, 330, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask3; } },
+        { "modelDispMask4", field_type::boolean, 330, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask4; } },
+        { "modelDispMask5", field_type::boolean, 330, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask5; } },
+        { "modelDispMask6", field_type::boolean, 330, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask6; } },
+        { "modelDispMask7", field_type::boolean, 330, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask7; } },
+        { "modelDispMask8", field_type::boolean, 331, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask8; } },
+        { "modelDispMask9", field_type::boolean, 331, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask9; } },
+        { "modelDispMask10", field_type::boolean, 331, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask10; } },
+        { "modelDispMask11", field_type::boolean, 331, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask11; } },
+        { "modelDispMask12", field_type::boolean, 331, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask12; } },
+        { "modelDispMask13", field_type::boolean, 331, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask13; } },
+        { "modelDispMask14", field_type::boolean, 331, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask14; } },
+        { "modelDispMask15", field_type::boolean, 331, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask15; } },
+        { "isEnableNeckTurn", field_type::boolean, 332, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableNeckTurn; } },
+        { "disableRespawn", field_type::boolean, 332, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableRespawn; } },
+        { "isMoveAnimWait", field_type::boolean, 332, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isMoveAnimWait; } },
+        { "isCrowd", field_type::boolean, 332, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isCrowd; } },
+        { "isWeakB", field_type::boolean, 332, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isWeakB; } },
+        { "isWeakC", field_type::boolean, 332, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isWeakC; } },
+        { "isWeakD", field_type::boolean, 332, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isWeakD; } },
+        { "doesAlwaysUseSpecialTurn", field_type::boolean, 332, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->doesAlwaysUseSpecialTurn; } },
+        { "isRideAtkTarget", field_type::boolean, 333, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isRideAtkTarget; } },
+        { "isEnableStepDispInterpolate", field_type::boolean, 333, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableStepDispInterpolate; } },
+        { "isStealthTarget", field_type::boolean, 333, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isStealthTarget; } },
+        { "disableInitializeDead", field_type::boolean, 333, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableInitializeDead; } },
+        { "isHitRumble", field_type::boolean, 333, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHitRumble; } },
+        { "isSmoothTurn", field_type::boolean, 333, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSmoothTurn; } },
+        { "isWeakE", field_type::boolean, 333, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isWeakE; } },
+        { "isWeakF", field_type::boolean, 333, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isWeakF; } },
+        { "modelDispMask16", field_type::boolean, 334, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask16; } },
+        { "modelDispMask17", field_type::boolean, 334, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask17; } },
+        { "modelDispMask18", field_type::boolean, 334, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask18; } },
+        { "modelDispMask19", field_type::boolean, 334, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask19; } },
+        { "modelDispMask20", field_type::boolean, 334, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask20; } },
+        { "modelDispMask21", field_type::boolean, 334, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask21; } },
+        { "modelDispMask22", field_type::boolean, 334, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask22; } },
+        { "modelDispMask23", field_type::boolean, 334, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask23; } },
+        { "modelDispMask24", field_type::boolean, 335, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask24; } },
+        { "modelDispMask25", field_type::boolean, 335, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask25; } },
+        { "modelDispMask26", field_type::boolean, 335, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask26; } },
+        { "modelDispMask27", field_type::boolean, 335, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask27; } },
+        { "modelDispMask28", field_type::boolean, 335, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask28; } },
+        { "modelDispMask29", field_type::boolean, 335, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask29; } },
+        { "modelDispMask30", field_type::boolean, 335, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask30; } },
+        { "modelDispMask31", field_type::boolean, 335, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->modelDispMask31; } },
+        { "itemSearchRadius", field_type::f32, offsetof(T, itemSearchRadius), 4, 1, nullptr },
+        { "chrHitHeight", field_type::f32, offsetof(T, chrHitHeight), 4, 1, nullptr },
+        { "chrHitRadius", field_type::f32, offsetof(T, chrHitRadius), 4, 1, nullptr },
+        { "specialTurnType", field_type::u8, offsetof(T, specialTurnType), 1, 1, nullptr },
+        { "isSoulGetByBoss", field_type::boolean, 349, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSoulGetByBoss; } },
+        { "isBulletOwner_byObject", field_type::boolean, 349, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBulletOwner_byObject; } },
+        { "isUseLowHitFootIk", field_type::boolean, 349, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseLowHitFootIk; } },
+        { "isCalculatePvPDamage", field_type::boolean, 349, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isCalculatePvPDamage; } },
+        { "isHostSyncChr", field_type::boolean, 349, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHostSyncChr; } },
+        { "isSkipWeakDamageAnim", field_type::boolean, 349, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSkipWeakDamageAnim; } },
+        { "isKeepHitOnRide", field_type::boolean, 349, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isKeepHitOnRide; } },
+        { "isSpCollide", field_type::boolean, 349, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSpCollide; } },
+        { "def_dark", field_type::u16, offsetof(T, def_dark), 2, 1, nullptr },
+        { "threatLv", field_type::u32, offsetof(T, threatLv), 4, 1, nullptr },
+        { "specialTurnDistanceThreshold", field_type::f32, offsetof(T, specialTurnDistanceThreshold), 4, 1, nullptr },
+        { "autoFootEffectSfxId", field_type::s32, offsetof(T, autoFootEffectSfxId), 4, 1, nullptr },
+        { "materialSe1", field_type::u16, offsetof(T, materialSe1), 2, 1, nullptr },
+        { "materialSfx1", field_type::u16, offsetof(T, materialSfx1), 2, 1, nullptr },
+        { "materialSe_Weak2", field_type::u16, offsetof(T, materialSe_Weak2), 2, 1, nullptr },
+        { "materialSfx_Weak2", field_type::u16, offsetof(T, materialSfx_Weak2), 2, 1, nullptr },
+        { "materialSe2", field_type::u16, offsetof(T, materialSe2), 2, 1, nullptr },
+        { "materialSfx2", field_type::u16, offsetof(T, materialSfx2), 2, 1, nullptr },
+        { "spEffectID8", field_type::s32, offsetof(T, spEffectID8), 4, 1, nullptr },
+        { "spEffectID9", field_type::s32, offsetof(T, spEffectID9), 4, 1, nullptr },
+        { "spEffectID10", field_type::s32, offsetof(T, spEffectID10), 4, 1, nullptr },
+        { "spEffectID11", field_type::s32, offsetof(T, spEffectID11), 4, 1, nullptr },
+        { "spEffectID12", field_type::s32, offsetof(T, spEffectID12), 4, 1, nullptr },
+        { "spEffectID13", field_type::s32, offsetof(T, spEffectID13), 4, 1, nullptr },
+        { "spEffectID14", field_type::s32, offsetof(T, spEffectID14), 4, 1, nullptr },
+        { "spEffectID15", field_type::s32, offsetof(T, spEffectID15), 4, 1, nullptr },
+        { "autoFootEffectDecalBaseId1", field_type::s32, offsetof(T, autoFootEffectDecalBaseId1), 4, 1, nullptr },
+        { "toughness", field_type::u32, offsetof(T, toughness), 4, 1, nullptr },
+        { "toughnessRecoverCorrection", field_type::f32, offsetof(T, toughnessRecoverCorrection), 4, 1, nullptr },
+        { "neutralDamageCutRate", field_type::f32, offsetof(T, neutralDamageCutRate), 4, 1, nullptr },
+        { "slashDamageCutRate", field_type::f32, offsetof(T, slashDamageCutRate), 4, 1, nullptr },
+        { "blowDamageCutRate", field_type::f32, offsetof(T, blowDamageCutRate), 4, 1, nullptr },
+        { "thrustDamageCutRate", field_type::f32, offsetof(T, thrustDamageCutRate), 4, 1, nullptr },
+        { "magicDamageCutRate", field_type::f32, offsetof(T, magicDamageCutRate), 4, 1, nullptr },
+        { "fireDamageCutRate", field_type::f32, offsetof(T, fireDamageCutRate), 4, 1, nullptr },
+        { "thunderDamageCutRate", field_type::f32, offsetof(T, thunderDamageCutRate), 4, 1, nullptr },
+        { "darkDamageCutRate", field_type::f32, offsetof(T, darkDamageCutRate), 4, 1, nullptr },
+        { "darkGuardCutRate", field_type::f32, offsetof(T, darkGuardCutRate), 4, 1, nullptr },
+        { "clothUpdateOffset", field_type::s8, offsetof(T, clothUpdateOffset), 1, 1, nullptr },
+        { "npcPlayerWeightType", field_type::u8, offsetof(T, npcPlayerWeightType), 1, 1, nullptr },
+        { "normalChangeModelId", field_type::s16, offsetof(T, normalChangeModelId), 2, 1, nullptr },
+        { "normalChangeAnimChrId", field_type::s16, offsetof(T, normalChangeAnimChrId), 2, 1, nullptr },
+        { "paintRenderTargetSize", field_type::u16, offsetof(T, paintRenderTargetSize), 2, 1, nullptr },
+        { "resistCorrectId_disease", field_type::s32, offsetof(T, resistCorrectId_disease), 4, 1, nullptr },
+        { "phantomShaderId", field_type::s32, offsetof(T, phantomShaderId), 4, 1, nullptr },
+        { "multiPlayCorrectionParamId", field_type::s32, offsetof(T, multiPlayCorrectionParamId), 4, 1, nullptr },
+        { "maxAnklePitchAngle", field_type::f32, offsetof(T, maxAnklePitchAngle), 4, 1, nullptr },
+        { "resist_freeze", field_type::u16, offsetof(T, resist_freeze), 2, 1, nullptr },
+        { "freezeGuardResist", field_type::s8, offsetof(T, freezeGuardResist), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 1, nullptr },
+        { "lockCameraParamId", field_type::s32, offsetof(T, lockCameraParamId), 4, 1, nullptr },
+        { "spEffectID16", field_type::s32, offsetof(T, spEffectID16), 4, 1, nullptr },
+        { "spEffectID17", field_type::s32, offsetof(T, spEffectID17), 4, 1, nullptr },
+        { "spEffectID18", field_type::s32, offsetof(T, spEffectID18), 4, 1, nullptr },
+        { "spEffectID19", field_type::s32, offsetof(T, spEffectID19), 4, 1, nullptr },
+        { "spEffectID20", field_type::s32, offsetof(T, spEffectID20), 4, 1, nullptr },
+        { "spEffectID21", field_type::s32, offsetof(T, spEffectID21), 4, 1, nullptr },
+        { "spEffectID22", field_type::s32, offsetof(T, spEffectID22), 4, 1, nullptr },
+        { "spEffectID23", field_type::s32, offsetof(T, spEffectID23), 4, 1, nullptr },
+        { "spEffectID24", field_type::s32, offsetof(T, spEffectID24), 4, 1, nullptr },
+        { "spEffectID25", field_type::s32, offsetof(T, spEffectID25), 4, 1, nullptr },
+        { "spEffectID26", field_type::s32, offsetof(T, spEffectID26), 4, 1, nullptr },
+        { "spEffectID27", field_type::s32, offsetof(T, spEffectID27), 4, 1, nullptr },
+        { "spEffectID28", field_type::s32, offsetof(T, spEffectID28), 4, 1, nullptr },
+        { "spEffectID29", field_type::s32, offsetof(T, spEffectID29), 4, 1, nullptr },
+        { "spEffectID30", field_type::s32, offsetof(T, spEffectID30), 4, 1, nullptr },
+        { "spEffectID31", field_type::s32, offsetof(T, spEffectID31), 4, 1, nullptr },
+        { "disableLockOnAng", field_type::f32, offsetof(T, disableLockOnAng), 4, 1, nullptr },
+        { "clothOffLodLevel", field_type::s8, offsetof(T, clothOffLodLevel), 1, 1, nullptr },
+        { "isUseFootIKNormalByUnduration", field_type::boolean, 557, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseFootIKNormalByUnduration; } },
+        { "attachHitInitializeDead", field_type::boolean, 557, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->attachHitInitializeDead; } },
+        { "excludeGroupRewardCheck", field_type::boolean, 557, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->excludeGroupRewardCheck; } },
+        { "enableAILockDmyPoly_212", field_type::boolean, 557, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableAILockDmyPoly_212; } },
+        { "enableAILockDmyPoly_213", field_type::boolean, 557, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableAILockDmyPoly_213; } },
+        { "enableAILockDmyPoly_214", field_type::boolean, 557, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableAILockDmyPoly_214; } },
+        { "disableActivateOpen_xb1", field_type::boolean, 557, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableActivateOpen_xb1; } },
+        { "disableActivateLegacy_xb1", field_type::boolean, 557, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableActivateLegacy_xb1; } },
+        { "estusFlaskRecoveryParamId", field_type::s16, offsetof(T, estusFlaskRecoveryParamId), 2, 1, nullptr },
+        { "roleNameId", field_type::s32, offsetof(T, roleNameId), 4, 1, nullptr },
+        { "estusFlaskLotPoint", field_type::u16, offsetof(T, estusFlaskLotPoint), 2, 1, nullptr },
+        { "hpEstusFlaskLotPoint", field_type::u16, offsetof(T, hpEstusFlaskLotPoint), 2, 1, nullptr },
+        { "mpEstusFlaskLotPoint", field_type::u16, offsetof(T, mpEstusFlaskLotPoint), 2, 1, nullptr },
+        { "estusFlaskRecovery_failedLotPointAdd", field_type::u16, offsetof(T, estusFlaskRecovery_failedLotPointAdd), 2, 1, nullptr },
+        { "hpEstusFlaskRecovery_failedLotPointAdd", field_type::u16, offsetof(T, hpEstusFlaskRecovery_failedLotPointAdd), 2, 1, nullptr },
+        { "mpEstusFlaskRecovery_failedLotPointAdd", field_type::u16, offsetof(T, mpEstusFlaskRecovery_failedLotPointAdd), 2, 1, nullptr },
+        { "WanderGhostPhantomId", field_type::s32, offsetof(T, WanderGhostPhantomId), 4, 1, nullptr },
+        { "hearingHeadSize", field_type::f32, offsetof(T, hearingHeadSize), 4, 1, nullptr },
+        { "SoundBankId", field_type::s16, offsetof(T, SoundBankId), 2, 1, nullptr },
+        { "forwardUndulationLimit", field_type::u8, offsetof(T, forwardUndulationLimit), 1, 1, nullptr },
+        { "sideUndulationLimit", field_type::u8, offsetof(T, sideUndulationLimit), 1, 1, nullptr },
+        { "deactiveMoveSpeed", field_type::f32, offsetof(T, deactiveMoveSpeed), 4, 1, nullptr },
+        { "deactiveMoveDist", field_type::f32, offsetof(T, deactiveMoveDist), 4, 1, nullptr },
+        { "enableSoundObjDist", field_type::f32, offsetof(T, enableSoundObjDist), 4, 1, nullptr },
+        { "undulationCorrectGain", field_type::f32, offsetof(T, undulationCorrectGain), 4, 1, nullptr },
+        { "autoFootEffectDecalBaseId2", field_type::s16, offsetof(T, autoFootEffectDecalBaseId2), 2, 1, nullptr },
+        { "autoFootEffectDecalBaseId3", field_type::s16, offsetof(T, autoFootEffectDecalBaseId3), 2, 1, nullptr },
+        { "RetargetReferenceChrId", field_type::s16, offsetof(T, RetargetReferenceChrId), 2, 1, nullptr },
+        { "SfxResBankId", field_type::s16, offsetof(T, SfxResBankId), 2, 1, nullptr },
+        { "updateActivatePriolity", field_type::f32, offsetof(T, updateActivatePriolity), 4, 1, nullptr },
+        { "chrNavimeshFlag_Alive", field_type::u8, offsetof(T, chrNavimeshFlag_Alive), 1, 1, nullptr },
+        { "chrNavimeshFlag_Dead", field_type::u8, offsetof(T, chrNavimeshFlag_Dead), 1, 1, nullptr },
+        { "pad7", field_type::u8, offsetof(T, pad7), 1, 1, nullptr },
+        { "wheelRotType", field_type::u8, offsetof(T, wheelRotType), 1, 1, nullptr },
+        { "wheelRotRadius", field_type::f32, offsetof(T, wheelRotRadius), 4, 1, nullptr },
+        { "retargetMoveRate", field_type::f32, offsetof(T, retargetMoveRate), 4, 1, nullptr },
+        { "ladderWarpOffset", field_type::f32, offsetof(T, ladderWarpOffset), 4, 1, nullptr },
+        { "loadAssetId", field_type::s32, offsetof(T, loadAssetId), 4, 1, nullptr },
+        { "overlapCameraDmypolyId", field_type::s32, offsetof(T, overlapCameraDmypolyId), 4, 1, nullptr },
+        { "residentMaterialExParamId00", field_type::s32, offsetof(T, residentMaterialExParamId00), 4, 1, nullptr },
+        { "residentMaterialExParamId01", field_type::s32, offsetof(T, residentMaterialExParamId01), 4, 1, nullptr },
+        { "residentMaterialExParamId02", field_type::s32, offsetof(T, residentMaterialExParamId02), 4, 1, nullptr },
+        { "residentMaterialExParamId03", field_type::s32, offsetof(T, residentMaterialExParamId03), 4, 1, nullptr },
+        { "residentMaterialExParamId04", field_type::s32, offsetof(T, residentMaterialExParamId04), 4, 1, nullptr },
+        { "sleepCollectorItemLotId_enemy", field_type::s32, offsetof(T, sleepCollectorItemLotId_enemy), 4, 1, nullptr },
+        { "sleepCollectorItemLotId_map", field_type::s32, offsetof(T, sleepCollectorItemLotId_map), 4, 1, nullptr },
+        { "footIkErrorOnGain", field_type::f32, offsetof(T, footIkErrorOnGain), 4, 1, nullptr },
+        { "footIkErrorOffGain", field_type::f32, offsetof(T, footIkErrorOffGain), 4, 1, nullptr },
+        { "SoundAddBankId", field_type::s16, offsetof(T, SoundAddBankId), 2, 1, nullptr },
+        { "materialVariationValue", field_type::u8, offsetof(T, materialVariationValue), 1, 1, nullptr },
+        { "materialVariationValue_Weak", field_type::u8, offsetof(T, materialVariationValue_Weak), 1, 1, nullptr },
+        { "superArmorDurability", field_type::f32, offsetof(T, superArmorDurability), 4, 1, nullptr },
+        { "saRecoveryRate", field_type::f32, offsetof(T, saRecoveryRate), 4, 1, nullptr },
+        { "saGuardCutRate", field_type::f32, offsetof(T, saGuardCutRate), 4, 1, nullptr },
+        { "resistCorrectId_blood", field_type::s32, offsetof(T, resistCorrectId_blood), 4, 1, nullptr },
+        { "resistCorrectId_curse", field_type::s32, offsetof(T, resistCorrectId_curse), 4, 1, nullptr },
+        { "resistCorrectId_freeze", field_type::s32, offsetof(T, resistCorrectId_freeze), 4, 1, nullptr },
+        { "resistCorrectId_sleep", field_type::s32, offsetof(T, resistCorrectId_sleep), 4, 1, nullptr },
+        { "resistCorrectId_madness", field_type::s32, offsetof(T, resistCorrectId_madness), 4, 1, nullptr },
+        { "chrDeadTutorialFlagId", field_type::u32, offsetof(T, chrDeadTutorialFlagId), 4, 1, nullptr },
+        { "stepDispInterpolateTime", field_type::f32, offsetof(T, stepDispInterpolateTime), 4, 1, nullptr },
+        { "stepDispInterpolateTriggerValue", field_type::f32, offsetof(T, stepDispInterpolateTriggerValue), 4, 1, nullptr },
+        { "lockScoreOffset", field_type::f32, offsetof(T, lockScoreOffset), 4, 1, nullptr },
+        { "pad12", field_type::u8, offsetof(T, pad12), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::NPC_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, behaviorVariationId) == 4);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resistCorrectId_poison) == 8);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, nameId) == 12);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, turnVellocity) == 16);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, hitHeight) == 20);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, hitRadius) == 24);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, weight) == 28);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, hitYOffset) == 32);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, hp) == 36);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, mp) == 40);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, getSoul) == 44);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, itemLotId_enemy) == 48);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, itemLotId_map) == 52);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, maxAnkleRollAngle) == 56);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, chrHitGroupAndNavimesh) == 60);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, faceIconId) == 61);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, deactivateDist) == 62);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, chrActivateConditionParamId) == 64);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, footIkErrorHeightLimit) == 68);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, humanityLotId) == 72);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID0) == 76);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID1) == 80);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID2) == 84);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID3) == 88);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID4) == 92);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID5) == 96);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID6) == 100);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID7) == 104);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, GameClearSpEffectID) == 108);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, physGuardCutRate) == 112);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, magGuardCutRate) == 116);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, fireGuardCutRate) == 120);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, thunGuardCutRate) == 124);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, animIdOffset) == 128);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockGazePoint0) == 132);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockGazePoint1) == 134);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockGazePoint2) == 136);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockGazePoint3) == 138);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockGazePoint4) == 140);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockGazePoint5) == 142);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, networkWarpDist) == 144);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorR1) == 148);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorL1) == 152);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorR2) == 156);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorL2) == 160);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorRL) == 164);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorRR) == 168);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorRD) == 172);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorRU) == 176);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorLL) == 180);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorLR) == 184);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorLD) == 188);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dbgBehaviorLU) == 192);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, animIdOffset2) == 196);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, partsDamageRate1) == 200);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, partsDamageRate2) == 204);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, partsDamageRate3) == 208);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, partsDamageRate4) == 212);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, partsDamageRate5) == 216);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, partsDamageRate6) == 220);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, partsDamageRate7) == 224);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, partsDamageRate8) == 228);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, weakPartsDamageRate) == 232);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, superArmorRecoverCorrection) == 236);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, superArmorBrakeKnockbackDist) == 240);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, stamina) == 244);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, staminaRecoverBaseVel) == 246);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, def_phys) == 248);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, def_slash) == 250);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, def_blow) == 252);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, def_thrust) == 254);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, def_mag) == 256);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, def_fire) == 258);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, def_thunder) == 260);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, defFlickPower) == 262);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resist_poison) == 264);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resist_desease) == 266);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resist_blood) == 268);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resist_curse) == 270);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, ghostModelId) == 272);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, normalChangeResouceId) == 274);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, guardAngle) == 276);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, slashGuardCutRate) == 278);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, blowGuardCutRate) == 280);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, thrustGuardCutRate) == 282);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockGazePoint6) == 284);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, normalChangeTexChrId) == 286);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, dropType) == 288);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, knockbackRate) == 290);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, knockbackParamId) == 291);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, fallDamageDump) == 292);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, staminaGuardDef) == 293);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resist_sleep) == 294);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resist_madness) == 296);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, sleepGuardResist) == 298);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, madnessGuardResist) == 299);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockGazePoint7) == 300);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, mpRecoverBaseVel) == 302);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, flickDamageCutRate) == 303);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, defaultLodParamId) == 304);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, drawType) == 305);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, npcType) == 306);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, teamType) == 307);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, moveType) == 308);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockDist) == 309);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, materialSe_Weak1) == 310);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, materialSfx_Weak1) == 312);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, partsDamageType) == 314);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, vowType) == 315);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, guardLevel) == 316);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, burnSfxType) == 317);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, poisonGuardResist) == 318);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, diseaseGuardResist) == 319);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, bloodGuardResist) == 320);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, curseGuardResist) == 321);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, parryAttack) == 322);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, parryDefence) == 323);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, sfxSize) == 324);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, pushOutCamRegionRadius) == 325);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, hitStopType) == 326);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, ladderEndChkOffsetTop) == 327);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, ladderEndChkOffsetLow) == 328);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, itemSearchRadius) == 336);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, chrHitHeight) == 340);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, chrHitRadius) == 344);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, specialTurnType) == 348);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, def_dark) == 350);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, threatLv) == 352);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, specialTurnDistanceThreshold) == 356);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, autoFootEffectSfxId) == 360);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, materialSe1) == 364);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, materialSfx1) == 366);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, materialSe_Weak2) == 368);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, materialSfx_Weak2) == 370);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, materialSe2) == 372);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, materialSfx2) == 374);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID8) == 376);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID9) == 380);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID10) == 384);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID11) == 388);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID12) == 392);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID13) == 396);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID14) == 400);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID15) == 404);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, autoFootEffectDecalBaseId1) == 408);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, toughness) == 412);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, toughnessRecoverCorrection) == 416);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, neutralDamageCutRate) == 420);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, slashDamageCutRate) == 424);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, blowDamageCutRate) == 428);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, thrustDamageCutRate) == 432);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, magicDamageCutRate) == 436);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, fireDamageCutRate) == 440);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, thunderDamageCutRate) == 444);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, darkDamageCutRate) == 448);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, darkGuardCutRate) == 452);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, clothUpdateOffset) == 456);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, npcPlayerWeightType) == 457);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, normalChangeModelId) == 458);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, normalChangeAnimChrId) == 460);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, paintRenderTargetSize) == 462);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resistCorrectId_disease) == 464);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, phantomShaderId) == 468);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, multiPlayCorrectionParamId) == 472);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, maxAnklePitchAngle) == 476);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resist_freeze) == 480);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, freezeGuardResist) == 482);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, pad1) == 483);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockCameraParamId) == 484);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID16) == 488);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID17) == 492);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID18) == 496);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID19) == 500);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID20) == 504);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID21) == 508);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID22) == 512);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID23) == 516);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID24) == 520);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID25) == 524);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID26) == 528);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID27) == 532);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID28) == 536);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID29) == 540);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID30) == 544);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, spEffectID31) == 548);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, disableLockOnAng) == 552);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, clothOffLodLevel) == 556);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, estusFlaskRecoveryParamId) == 558);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, roleNameId) == 560);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, estusFlaskLotPoint) == 564);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, hpEstusFlaskLotPoint) == 566);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, mpEstusFlaskLotPoint) == 568);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, estusFlaskRecovery_failedLotPointAdd) == 570);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, hpEstusFlaskRecovery_failedLotPointAdd) == 572);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, mpEstusFlaskRecovery_failedLotPointAdd) == 574);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, WanderGhostPhantomId) == 576);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, hearingHeadSize) == 580);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, SoundBankId) == 584);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, forwardUndulationLimit) == 586);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, sideUndulationLimit) == 587);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, deactiveMoveSpeed) == 588);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, deactiveMoveDist) == 592);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, enableSoundObjDist) == 596);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, undulationCorrectGain) == 600);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, autoFootEffectDecalBaseId2) == 604);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, autoFootEffectDecalBaseId3) == 606);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, RetargetReferenceChrId) == 608);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, SfxResBankId) == 610);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, updateActivatePriolity) == 612);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, chrNavimeshFlag_Alive) == 616);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, chrNavimeshFlag_Dead) == 617);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, pad7) == 618);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, wheelRotType) == 619);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, wheelRotRadius) == 620);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, retargetMoveRate) == 624);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, ladderWarpOffset) == 628);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, loadAssetId) == 632);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, overlapCameraDmypolyId) == 636);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, residentMaterialExParamId00) == 640);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, residentMaterialExParamId01) == 644);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, residentMaterialExParamId02) == 648);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, residentMaterialExParamId03) == 652);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, residentMaterialExParamId04) == 656);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, sleepCollectorItemLotId_enemy) == 660);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, sleepCollectorItemLotId_map) == 664);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, footIkErrorOnGain) == 668);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, footIkErrorOffGain) == 672);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, SoundAddBankId) == 676);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, materialVariationValue) == 678);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, materialVariationValue_Weak) == 679);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, superArmorDurability) == 680);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, saRecoveryRate) == 684);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, saGuardCutRate) == 688);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resistCorrectId_blood) == 692);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resistCorrectId_curse) == 696);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resistCorrectId_freeze) == 700);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resistCorrectId_sleep) == 704);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, resistCorrectId_madness) == 708);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, chrDeadTutorialFlagId) == 712);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, stepDispInterpolateTime) == 716);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, stepDispInterpolateTriggerValue) == 720);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, lockScoreOffset) == 724);
+static_assert(offsetof(paramdef::NPC_PARAM_ST, pad12) == 728);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,216 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../NPC_THINK_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::NPC_THINK_PARAM_ST> {
+    using T = paramdef::NPC_THINK_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 104> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "logicId", field_type::s32, offsetof(T, logicId), 4, 1, nullptr },
+        { "battleGoalID", field_type::s32, offsetof(T, battleGoalID), 4, 1, nullptr },
+        { "searchEye_dist", field_type::u16, offsetof(T, searchEye_dist), 2, 1, nullptr },
+        { "searchEye_angY", field_type::u8, offsetof(T, searchEye_angY), 1, 1, nullptr },
+        { "isNoAvoidHugeEnemy", field_type::boolean, 15, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isNoAvoidHugeEnemy; } },
+        { "enableWeaponOnOff", field_type::boolean, 15, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableWeaponOnOff; } },
+        { "targetAILockDmyPoly", field_type::boolean, 15, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->targetAILockDmyPoly; } },
+        { "pad8", field_type::u8, 15, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad8; } },
+        { "spEffectId_RangedAttack", field_type::s32, offsetof(T, spEffectId_RangedAttack), 4, 1, nullptr },
+        { "searchTargetLv1ForgetTime", field_type::f32, offsetof(T, searchTargetLv1ForgetTime), 4, 1, nullptr },
+        { "searchTargetLv2ForgetTime", field_type::f32, offsetof(T, searchTargetLv2ForgetTime), 4, 1, nullptr },
+        { "BackHomeLife_OnHitEneWal", field_type::f32, offsetof(T, BackHomeLife_OnHitEneWal), 4, 1, nullptr },
+        { "SightTargetForgetTime", field_type::f32, offsetof(T, SightTargetForgetTime), 4, 1, nullptr },
+        { "idAttackCannotMove", field_type::s32, offsetof(T, idAttackCannotMove), 4, 1, nullptr },
+        { "ear_dist", field_type::f32, offsetof(T, ear_dist), 4, 1, nullptr },
+        { "callHelp_ActionAnimId", field_type::s32, offsetof(T, callHelp_ActionAnimId), 4, 1, nullptr },
+        { "callHelp_CallActionId", field_type::s32, offsetof(T, callHelp_CallActionId), 4, 1, nullptr },
+        { "eye_dist", field_type::u16, offsetof(T, eye_dist), 2, 1, nullptr },
+        { "isGuard_Act", field_type::boolean, offsetof(T, isGuard_Act), 1, 1, nullptr },
+        { "pad6", field_type::u8, offsetof(T, pad6), 1, 1, nullptr },
+        { "ear_soundcut_dist", field_type::u16, offsetof(T, ear_soundcut_dist), 2, 1, nullptr },
+        { "nose_dist", field_type::u16, offsetof(T, nose_dist), 2, 1, nullptr },
+        { "maxBackhomeDist", field_type::u16, offsetof(T, maxBackhomeDist), 2, 1, nullptr },
+        { "backhomeDist", field_type::u16, offsetof(T, backhomeDist), 2, 1, nullptr },
+        { "backhomeBattleDist", field_type::u16, offsetof(T, backhomeBattleDist), 2, 1, nullptr },
+        { "nonBattleActLife", field_type::u16, offsetof(T, nonBattleActLife), 2, 1, nullptr },
+        { "BackHome_LookTargetTime", field_type::u16, offsetof(T, BackHome_LookTargetTime), 2, 1, nullptr },
+        { "BackHome_LookTargetDist", field_type::u16, offsetof(T, BackHome_LookTargetDist), 2, 1, nullptr },
+        { "SoundTargetForgetTime", field_type::f32, offsetof(T, SoundTargetForgetTime), 4, 1, nullptr },
+        { "BattleStartDist", field_type::u16, offsetof(T, BattleStartDist), 2, 1, nullptr },
+        { "callHelp_MyPeerId", field_type::u16, offsetof(T, callHelp_MyPeerId), 2, 1, nullptr },
+        { "callHelp_CallPeerId", field_type::u16, offsetof(T, callHelp_CallPeerId), 2, 1, nullptr },
+        { "targetSys_DmgEffectRate", field_type::u16, offsetof(T, targetSys_DmgEffectRate), 2, 1, nullptr },
+        { "TeamAttackEffectivity", field_type::u8, offsetof(T, TeamAttackEffectivity), 1, 1, nullptr },
+        { "eye_angX", field_type::u8, offsetof(T, eye_angX), 1, 1, nullptr },
+        { "eye_angY", field_type::u8, offsetof(T, eye_angY), 1, 1, nullptr },
+        { "disableDark", field_type::boolean, offsetof(T, disableDark), 1, 1, nullptr },
+        { "caravanRole", field_type::u8, offsetof(T, caravanRole), 1, 1, nullptr },
+        { "callHelp_CallValidMinDistTarget", field_type::u8, offsetof(T, callHelp_CallValidMinDistTarget), 1, 1, nullptr },
+        { "callHelp_CallValidRange", field_type::u8, offsetof(T, callHelp_CallValidRange), 1, 1, nullptr },
+        { "callHelp_ForgetTimeByArrival", field_type::u8, offsetof(T, callHelp_ForgetTimeByArrival), 1, 1, nullptr },
+        { "callHelp_MinWaitTime", field_type::u8, offsetof(T, callHelp_MinWaitTime), 1, 1, nullptr },
+        { "callHelp_MaxWaitTime", field_type::u8, offsetof(T, callHelp_MaxWaitTime), 1, 1, nullptr },
+        { "goalAction_ToCaution", field_type::u8, offsetof(T, goalAction_ToCaution), 1, 1, nullptr },
+        { "ear_listenLevel", field_type::u8, offsetof(T, ear_listenLevel), 1, 1, nullptr },
+        { "callHelp_ReplyBehaviorType", field_type::u8, offsetof(T, callHelp_ReplyBehaviorType), 1, 1, nullptr },
+        { "disablePathMove", field_type::boolean, offsetof(T, disablePathMove), 1, 1, nullptr },
+        { "skipArrivalVisibleCheck", field_type::boolean, offsetof(T, skipArrivalVisibleCheck), 1, 1, nullptr },
+        { "thinkAttr_doAdmirer", field_type::boolean, offsetof(T, thinkAttr_doAdmirer), 1, 1, nullptr },
+        { "enableNaviFlg_Edge", field_type::boolean, 100, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableNaviFlg_Edge; } },
+        { "enableNaviFlg_LargeSpace", field_type::boolean, 100, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableNaviFlg_LargeSpace; } },
+        { "enableNaviFlg_Ladder", field_type::boolean, 100, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableNaviFlg_Ladder; } },
+        { "enableNaviFlg_Hole", field_type::boolean, 100, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableNaviFlg_Hole; } },
+        { "enableNaviFlg_Door", field_type::boolean, 100, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableNaviFlg_Door; } },
+        { "enableNaviFlg_InSideWall", field_type::boolean, 100, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableNaviFlg_InSideWall; } },
+        { "enableNaviFlg_Lava", field_type::boolean, 100, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableNaviFlg_Lava; } },
+        { "enableNaviFlg_Edge_Ordinary", field_type::boolean, 100, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableNaviFlg_Edge_Ordinary; } },
+        { "enableNaviFlg_reserve1", field_type::u8, offsetof(T, enableNaviFlg_reserve1), 1, 3, nullptr },
+        { "searchThreshold_Lv0toLv1", field_type::s32, offsetof(T, searchThreshold_Lv0toLv1), 4, 1, nullptr },
+        { "searchThreshold_Lv1toLv2", field_type::s32, offsetof(T, searchThreshold_Lv1toLv2), 4, 1, nullptr },
+        { "platoonReplyTime", field_type::f32, offsetof(T, platoonReplyTime), 4, 1, nullptr },
+        { "platoonReplyAddRandomTime", field_type::f32, offsetof(T, platoonReplyAddRandomTime), 4, 1, nullptr },
+        { "searchEye_angX", field_type::u8, offsetof(T, searchEye_angX), 1, 1, nullptr },
+        { "isUpdateBattleSight", field_type::boolean, offsetof(T, isUpdateBattleSight), 1, 1, nullptr },
+        { "battleEye_updateDist", field_type::u16, offsetof(T, battleEye_updateDist), 2, 1, nullptr },
+        { "battleEye_updateAngX", field_type::u8, offsetof(T, battleEye_updateAngX), 1, 1, nullptr },
+        { "battleEye_updateAngY", field_type::u8, offsetof(T, battleEye_updateAngY), 1, 1, nullptr },
+        { "pad4", field_type::u8, offsetof(T, pad4), 1, 16, nullptr },
+        { "eye_BackOffsetDist", field_type::u16, offsetof(T, eye_BackOffsetDist), 2, 1, nullptr },
+        { "eye_BeginDist", field_type::u16, offsetof(T, eye_BeginDist), 2, 1, nullptr },
+        { "actTypeOnFailedPath", field_type::u8, offsetof(T, actTypeOnFailedPath), 1, 1, nullptr },
+        { "goalAction_ToCautionImportant", field_type::u8, offsetof(T, goalAction_ToCautionImportant), 1, 1, nullptr },
+        { "shiftAnimeId_RangedAttack", field_type::s32, offsetof(T, shiftAnimeId_RangedAttack), 4, 1, nullptr },
+        { "actTypeOnNonBtlFailedPath", field_type::u8, offsetof(T, actTypeOnNonBtlFailedPath), 1, 1, nullptr },
+        { "isBuddyAI", field_type::boolean, offsetof(T, isBuddyAI), 1, 1, nullptr },
+        { "goalAction_ToSearchLv1", field_type::u8, offsetof(T, goalAction_ToSearchLv1), 1, 1, nullptr },
+        { "goalAction_ToSearchLv2", field_type::u8, offsetof(T, goalAction_ToSearchLv2), 1, 1, nullptr },
+        { "enableJumpMove", field_type::u8, offsetof(T, enableJumpMove), 1, 1, nullptr },
+        { "disableLocalSteering", field_type::boolean, offsetof(T, disableLocalSteering), 1, 1, nullptr },
+        { "goalAction_ToDisappear", field_type::u8, offsetof(T, goalAction_ToDisappear), 1, 1, nullptr },
+        { "changeStateAction_ToNormal", field_type::u8, offsetof(T, changeStateAction_ToNormal), 1, 1, nullptr },
+        { "MemoryTargetForgetTime", field_type::f32, offsetof(T, MemoryTargetForgetTime), 4, 1, nullptr },
+        { "rangedAttackId", field_type::s32, offsetof(T, rangedAttackId), 4, 1, nullptr },
+        { "useFall_onNormalCaution", field_type::u8, offsetof(T, useFall_onNormalCaution), 1, 1, nullptr },
+        { "useFall_onSearchBattle", field_type::u8, offsetof(T, useFall_onSearchBattle), 1, 1, nullptr },
+        { "enableJumpMove_onBattle", field_type::u8, offsetof(T, enableJumpMove_onBattle), 1, 1, nullptr },
+        { "backToHomeStuckAct", field_type::u8, offsetof(T, backToHomeStuckAct), 1, 1, nullptr },
+        { "pad3", field_type::u8, offsetof(T, pad3), 1, 4, nullptr },
+        { "soundBehaviorId01", field_type::s32, offsetof(T, soundBehaviorId01), 4, 1, nullptr },
+        { "soundBehaviorId02", field_type::s32, offsetof(T, soundBehaviorId02), 4, 1, nullptr },
+        { "soundBehaviorId03", field_type::s32, offsetof(T, soundBehaviorId03), 4, 1, nullptr },
+        { "soundBehaviorId04", field_type::s32, offsetof(T, soundBehaviorId04), 4, 1, nullptr },
+        { "soundBehaviorId05", field_type::s32, offsetof(T, soundBehaviorId05), 4, 1, nullptr },
+        { "soundBehaviorId06", field_type::s32, offsetof(T, soundBehaviorId06), 4, 1, nullptr },
+        { "soundBehaviorId07", field_type::s32, offsetof(T, soundBehaviorId07), 4, 1, nullptr },
+        { "soundBehaviorId08", field_type::s32, offsetof(T, soundBehaviorId08), 4, 1, nullptr },
+        { "weaponOffSpecialEffectId", field_type::s32, offsetof(T, weaponOffSpecialEffectId), 4, 1, nullptr },
+        { "weaponOnSpecialEffectId", field_type::s32, offsetof(T, weaponOnSpecialEffectId), 4, 1, nullptr },
+        { "weaponOffAnimId", field_type::s32, offsetof(T, weaponOffAnimId), 4, 1, nullptr },
+        { "weaponOnAnimId", field_type::s32, offsetof(T, weaponOnAnimId), 4, 1, nullptr },
+        { "surpriseAnimId", field_type::s32, offsetof(T, surpriseAnimId), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, logicId) == 4);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, battleGoalID) == 8);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, searchEye_dist) == 12);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, searchEye_angY) == 14);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, spEffectId_RangedAttack) == 16);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, searchTargetLv1ForgetTime) == 20);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, searchTargetLv2ForgetTime) == 24);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, BackHomeLife_OnHitEneWal) == 28);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, SightTargetForgetTime) == 32);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, idAttackCannotMove) == 36);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, ear_dist) == 40);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, callHelp_ActionAnimId) == 44);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, callHelp_CallActionId) == 48);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, eye_dist) == 52);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, isGuard_Act) == 54);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, pad6) == 55);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, ear_soundcut_dist) == 56);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, nose_dist) == 58);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, maxBackhomeDist) == 60);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, backhomeDist) == 62);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, backhomeBattleDist) == 64);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, nonBattleActLife) == 66);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, BackHome_LookTargetTime) == 68);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, BackHome_LookTargetDist) == 70);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, SoundTargetForgetTime) == 72);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, BattleStartDist) == 76);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, callHelp_MyPeerId) == 78);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, callHelp_CallPeerId) == 80);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, targetSys_DmgEffectRate) == 82);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, TeamAttackEffectivity) == 84);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, eye_angX) == 85);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, eye_angY) == 86);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, disableDark) == 87);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, caravanRole) == 88);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, callHelp_CallValidMinDistTarget) == 89);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, callHelp_CallValidRange) == 90);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, callHelp_ForgetTimeByArrival) == 91);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, callHelp_MinWaitTime) == 92);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, callHelp_MaxWaitTime) == 93);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, goalAction_ToCaution) == 94);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, ear_listenLevel) == 95);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, callHelp_ReplyBehaviorType) == 96);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, disablePathMove) == 97);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, skipArrivalVisibleCheck) == 98);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, thinkAttr_doAdmirer) == 99);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, enableNaviFlg_reserve1) == 101);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, searchThreshold_Lv0toLv1) == 104);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, searchThreshold_Lv1toLv2) == 108);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, platoonReplyTime) == 112);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, platoonReplyAddRandomTime) == 116);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, searchEye_angX) == 120);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, isUpdateBattleSight) == 121);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, battleEye_updateDist) == 122);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, battleEye_updateAngX) == 124);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, battleEye_updateAngY) == 125);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, pad4) == 126);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, eye_BackOffsetDist) == 142);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, eye_BeginDist) == 144);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, actTypeOnFailedPath) == 146);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, goalAction_ToCautionImportant) == 147);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, shiftAnimeId_RangedAttack) == 148);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, actTypeOnNonBtlFailedPath) == 152);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, isBuddyAI) == 153);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, goalAction_ToSearchLv1) == 154);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, goalAction_ToSearchLv2) == 155);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, enableJumpMove) == 156);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, disableLocalSteering) == 157);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, goalAction_ToDisappear) == 158);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, changeStateAction_ToNormal) == 159);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, MemoryTargetForgetTime) == 160);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, rangedAttackId) == 164);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, useFall_onNormalCaution) == 168);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, useFall_onSearchBattle) == 169);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, enableJumpMove_onBattle) == 170);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, backToHomeStuckAct) == 171);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, pad3) == 172);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, soundBehaviorId01) == 176);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, soundBehaviorId02) == 180);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, soundBehaviorId03) == 184);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, soundBehaviorId04) == 188);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, soundBehaviorId05) == 192);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, soundBehaviorId06) == 196);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, soundBehaviorId07) == 200);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, soundBehaviorId08) == 204);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, weaponOffSpecialEffectId) == 208);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, weaponOnSpecialEffectId) == 212);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, weaponOffAnimId) == 216);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, weaponOnAnimId) == 220);
+static_assert(offsetof(paramdef::NPC_THINK_PARAM_ST, surpriseAnimId) == 224);
+
+}; // namespace params
+}; // namespace from
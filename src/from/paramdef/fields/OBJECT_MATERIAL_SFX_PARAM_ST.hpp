@@ -0,0 +1,86 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../OBJECT_MATERIAL_SFX_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::OBJECT_MATERIAL_SFX_PARAM_ST> {
+    using T = paramdef::OBJECT_MATERIAL_SFX_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 32> fields = {{
+        { "sfxId_00", field_type::u32, offsetof(T, sfxId_00), 4, 1, nullptr },
+        { "sfxId_01", field_type::u32, offsetof(T, sfxId_01), 4, 1, nullptr },
+        { "sfxId_02", field_type::u32, offsetof(T, sfxId_02), 4, 1, nullptr },
+        { "sfxId_03", field_type::u32, offsetof(T, sfxId_03), 4, 1, nullptr },
+        { "sfxId_04", field_type::u32, offsetof(T, sfxId_04), 4, 1, nullptr },
+        { "sfxId_05", field_type::u32, offsetof(T, sfxId_05), 4, 1, nullptr },
+        { "sfxId_06", field_type::u32, offsetof(T, sfxId_06), 4, 1, nullptr },
+        { "sfxId_07", field_type::u32, offsetof(T, sfxId_07), 4, 1, nullptr },
+        { "sfxId_08", field_type::u32, offsetof(T, sfxId_08), 4, 1, nullptr },
+        { "sfxId_09", field_type::u32, offsetof(T, sfxId_09), 4, 1, nullptr },
+        { "sfxId_10", field_type::u32, offsetof(T, sfxId_10), 4, 1, nullptr },
+        { "sfxId_11", field_type::u32, offsetof(T, sfxId_11), 4, 1, nullptr },
+        { "sfxId_12", field_type::u32, offsetof(T, sfxId_12), 4, 1, nullptr },
+        { "sfxId_13", field_type::u32, offsetof(T, sfxId_13), 4, 1, nullptr },
+        { "sfxId_14", field_type::u32, offsetof(T, sfxId_14), 4, 1, nullptr },
+        { "sfxId_15", field_type::u32, offsetof(T, sfxId_15), 4, 1, nullptr },
+        { "sfxId_16", field_type::u32, offsetof(T, sfxId_16), 4, 1, nullptr },
+        { "sfxId_17", field_type::u32, offsetof(T, sfxId_17), 4, 1, nullptr },
+        { "sfxId_18", field_type::u32, offsetof(T, sfxId_18), 4, 1, nullptr },
+        { "sfxId_19", field_type::u32, offsetof(T, sfxId_19), 4, 1, nullptr },
+        { "sfxId_20", field_type::u32, offsetof(T, sfxId_20), 4, 1, nullptr },
+        { "sfxId_21", field_type::u32, offsetof(T, sfxId_21), 4, 1, nullptr },
+        { "sfxId_22", field_type::u32, offsetof(T, sfxId_22), 4, 1, nullptr },
+        { "sfxId_23", field_type::u32, offsetof(T, sfxId_23), 4, 1, nullptr },
+        { "sfxId_24", field_type::u32, offsetof(T, sfxId_24), 4, 1, nullptr },
+        { "sfxId_25", field_type::u32, offsetof(T, sfxId_25), 4, 1, nullptr },
+        { "sfxId_26", field_type::u32, offsetof(T, sfxId_26), 4, 1, nullptr },
+        { "sfxId_27", field_type::u32, offsetof(T, sfxId_27), 4, 1, nullptr },
+        { "sfxId_28", field_type::u32, offsetof(T, sfxId_28), 4, 1, nullptr },
+        { "sfxId_29", field_type::u32, offsetof(T, sfxId_29), 4, 1, nullptr },
+        { "sfxId_30", field_type::u32, offsetof(T, sfxId_30), 4, 1, nullptr },
+        { "sfxId_31", field_type::u32, offsetof(T, sfxId_31), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_00) == 0);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_01) == 4);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_02) == 8);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_03) == 12);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_04) == 16);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_05) == 20);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_06) == 24);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_07) == 28);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_08) == 32);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_09) == 36);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_10) == 40);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_11) == 44);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_12) == 48);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_13) == 52);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_14) == 56);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_15) == 60);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_16) == 64);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_17) == 68);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_18) == 72);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_19) == 76);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_20) == 80);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_21) == 84);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_22) == 88);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_23) == 92);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_24) == 96);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_25) == 100);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_26) == 104);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_27) == 108);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_28) == 112);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_29) == 116);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_30) == 120);
+static_assert(offsetof(paramdef::OBJECT_MATERIAL_SFX_PARAM_ST, sfxId_31) == 124);
+
+}; // namespace params
+}; // namespace from
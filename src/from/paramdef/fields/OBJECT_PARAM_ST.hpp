@@ -0,0 +1,161 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../OBJECT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::OBJECT_PARAM_ST> {
+    using T = paramdef::OBJECT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 78> fields = {{
+        { "hp", field_type::s16, offsetof(T, hp), 2, 1, nullptr },
+        { "defense", field_type::u16, offsetof(T, defense), 2, 1, nullptr },
+        { "extRefTexId", field_type::s16, offsetof(T, extRefTexId), 2, 1, nullptr },
+        { "materialId", field_type::s16, offsetof(T, materialId), 2, 1, nullptr },
+        { "animBreakIdMax", field_type::u8, offsetof(T, animBreakIdMax), 1, 1, nullptr },
+        { "isCamHit", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isCamHit; } },
+        { "isBreakByPlayerCollide", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBreakByPlayerCollide; } },
+        { "isAnimBreak", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnimBreak; } },
+        { "isPenetrationBulletHit", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isPenetrationBulletHit; } },
+        { "isChrHit", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isChrHit; } },
+        { "isAttackBacklash", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAttackBacklash; } },
+        { "isDisableBreakForFirstAppear", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableBreakForFirstAppear; } },
+        { "isLadder", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isLadder; } },
+        { "isAnimPauseOnRemoPlay", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAnimPauseOnRemoPlay; } },
+        { "isDamageNoHit", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDamageNoHit; } },
+        { "isMoveObj", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isMoveObj; } },
+        { "isRopeBridge", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isRopeBridge; } },
+        { "isAddRigidImpulse_ByDamage", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAddRigidImpulse_ByDamage; } },
+        { "isBreak_ByChrRide", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBreak_ByChrRide; } },
+        { "isBurn", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBurn; } },
+        { "isBreakByEnemyCollide", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBreakByEnemyCollide; } },
+        { "defaultLodParamId", field_type::s8, offsetof(T, defaultLodParamId), 1, 1, nullptr },
+        { "breakSfxId", field_type::s32, offsetof(T, breakSfxId), 4, 1, nullptr },
+        { "breakSfxCpId", field_type::s32, offsetof(T, breakSfxCpId), 4, 1, nullptr },
+        { "breakBulletBehaviorId", field_type::s32, offsetof(T, breakBulletBehaviorId), 4, 1, nullptr },
+        { "breakBulletCpId", field_type::s32, offsetof(T, breakBulletCpId), 4, 1, nullptr },
+        { "breakFallHeight", field_type::u8, offsetof(T, breakFallHeight), 1, 1, nullptr },
+        { "windEffectType_0", field_type::u8, offsetof(T, windEffectType_0), 1, 1, nullptr },
+        { "windEffectType_1", field_type::u8, offsetof(T, windEffectType_1), 1, 1, nullptr },
+        { "camAvoidType", field_type::u8, offsetof(T, camAvoidType), 1, 1, nullptr },
+        { "windEffectRate_0", field_type::f32, offsetof(T, windEffectRate_0), 4, 1, nullptr },
+        { "windEffectRate_1", field_type::f32, offsetof(T, windEffectRate_1), 4, 1, nullptr },
+        { "breakStopTime", field_type::f32, offsetof(T, breakStopTime), 4, 1, nullptr },
+        { "burnTime", field_type::f32, offsetof(T, burnTime), 4, 1, nullptr },
+        { "burnBraekRate", field_type::f32, offsetof(T, burnBraekRate), 4, 1, nullptr },
+        { "burnSfxId", field_type::s32, offsetof(T, burnSfxId), 4, 1, nullptr },
+        { "burnSfxId_1", field_type::s32, offsetof(T, burnSfxId_1), 4, 1, nullptr },
+        { "burnSfxId_2", field_type::s32, offsetof(T, burnSfxId_2), 4, 1, nullptr },
+        { "burnSfxId_3", field_type::s32, offsetof(T, burnSfxId_3), 4, 1, nullptr },
+        { "burnBulletBehaviorId", field_type::s32, offsetof(T, burnBulletBehaviorId), 4, 1, nullptr },
+        { "burnBulletBehaviorId_1", field_type::s32, offsetof(T, burnBulletBehaviorId_1), 4, 1, nullptr },
+        { "burnBulletBehaviorId_2", field_type::s32, offsetof(T, burnBulletBehaviorId_2), 4, 1, nullptr },
+        { "burnBulletBehaviorId_3", field_type::s32, offsetof(T, burnBulletBehaviorId_3), 4, 1, nullptr },
+        { "burnBulletInterval", field_type::u16, offsetof(T, burnBulletInterval), 2, 1, nullptr },
+        { "navimeshFlag", field_type::u8, offsetof(T, navimeshFlag), 1, 1, nullptr },
+        { "collisionType", field_type::u8, offsetof(T, collisionType), 1, 1, nullptr },
+        { "burnBulletDelayTime", field_type::f32, offsetof(T, burnBulletDelayTime), 4, 1, nullptr },
+        { "burnSfxDelayTimeMin", field_type::f32, offsetof(T, burnSfxDelayTimeMin), 4, 1, nullptr },
+        { "burnSfxDelayTimeMin_1", field_type::f32, offsetof(T, burnSfxDelayTimeMin_1), 4, 1, nullptr },
+        { "burnSfxDelayTimeMin_2", field_type::f32, offsetof(T, burnSfxDelayTimeMin_2), 4, 1, nullptr },
+        { "burnSfxDelayTimeMin_3", field_type::f32, offsetof(T, burnSfxDelayTimeMin_3), 4, 1, nullptr },
+        { "burnSfxDelayTimeMax", field_type::f32, offsetof(T, burnSfxDelayTimeMax), 4, 1, nullptr },
+        { "burnSfxDelayTimeMax_1", field_type::f32, offsetof(T, burnSfxDelayTimeMax_1), 4, 1, nullptr },
+        { "burnSfxDelayTimeMax_2", field_type::f32, offsetof(T, burnSfxDelayTimeMax_2), 4, 1, nullptr },
+        { "burnSfxDelayTimeMax_3", field_type::f32, offsetof(T, burnSfxDelayTimeMax_3), 4, 1, nullptr },
+        { "BreakAiSoundID", field_type::s32, offsetof(T, BreakAiSoundID), 4, 1, nullptr },
+        { "FragmentInvisibleWaitTime", field_type::f32, offsetof(T, FragmentInvisibleWaitTime), 4, 1, nullptr },
+        { "FragmentInvisibleTime", field_type::f32, offsetof(T, FragmentInvisibleTime), 4, 1, nullptr },
+        { "pad_3", field_type::u8, offsetof(T, pad_3), 1, 16, nullptr },
+        { "RigidPenetrationScale_Soft", field_type::f32, offsetof(T, RigidPenetrationScale_Soft), 4, 1, nullptr },
+        { "RigidPenetrationScale_Normal", field_type::f32, offsetof(T, RigidPenetrationScale_Normal), 4, 1, nullptr },
+        { "RigidPenetrationScale_Hard", field_type::f32, offsetof(T, RigidPenetrationScale_Hard), 4, 1, nullptr },
+        { "LandTouchSfxId", field_type::s32, offsetof(T, LandTouchSfxId), 4, 1, nullptr },
+        { "isDamageCover", field_type::boolean, 168, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDamageCover; } },
+        { "pad_4", field_type::u8, offsetof(T, pad_4), 1, 1, nullptr },
+        { "paintDecalTargetTextureSize", field_type::u16, offsetof(T, paintDecalTargetTextureSize), 2, 1, nullptr },
+        { "lifeTime_forDC", field_type::f32, offsetof(T, lifeTime_forDC), 4, 1, nullptr },
+        { "clothUpdateDist", field_type::f32, offsetof(T, clothUpdateDist), 4, 1, nullptr },
+        { "contactSeId", field_type::s32, offsetof(T, contactSeId), 4, 1, nullptr },
+        { "breakLandingSfxId", field_type::s32, offsetof(T, breakLandingSfxId), 4, 1, nullptr },
+        { "waypointDummyPolyId_0", field_type::s32, offsetof(T, waypointDummyPolyId_0), 4, 1, nullptr },
+        { "waypointParamId_0", field_type::s32, offsetof(T, waypointParamId_0), 4, 1, nullptr },
+        { "soundBankId", field_type::s32, offsetof(T, soundBankId), 4, 1, nullptr },
+        { "refDrawParamId", field_type::s32, offsetof(T, refDrawParamId), 4, 1, nullptr },
+        { "autoCreateDynamicOffsetHeight", field_type::f32, offsetof(T, autoCreateDynamicOffsetHeight), 4, 1, nullptr },
+        { "reserved0", field_type::s32, offsetof(T, reserved0), 4, 1, nullptr },
+        { "soundBreakSEId", field_type::s32, offsetof(T, soundBreakSEId), 4, 1, nullptr },
+        { "pad_5", field_type::u8, offsetof(T, pad_5), 1, 40, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, hp) == 0);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, defense) == 2);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, extRefTexId) == 4);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, materialId) == 6);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, animBreakIdMax) == 8);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, defaultLodParamId) == 11);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, breakSfxId) == 12);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, breakSfxCpId) == 16);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, breakBulletBehaviorId) == 20);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, breakBulletCpId) == 24);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, breakFallHeight) == 28);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, windEffectType_0) == 29);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, windEffectType_1) == 30);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, camAvoidType) == 31);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, windEffectRate_0) == 32);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, windEffectRate_1) == 36);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, breakStopTime) == 40);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnTime) == 44);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnBraekRate) == 48);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxId) == 52);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxId_1) == 56);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxId_2) == 60);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxId_3) == 64);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnBulletBehaviorId) == 68);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnBulletBehaviorId_1) == 72);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnBulletBehaviorId_2) == 76);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnBulletBehaviorId_3) == 80);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnBulletInterval) == 84);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, navimeshFlag) == 86);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, collisionType) == 87);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnBulletDelayTime) == 88);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxDelayTimeMin) == 92);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxDelayTimeMin_1) == 96);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxDelayTimeMin_2) == 100);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxDelayTimeMin_3) == 104);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxDelayTimeMax) == 108);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxDelayTimeMax_1) == 112);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxDelayTimeMax_2) == 116);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, burnSfxDelayTimeMax_3) == 120);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, BreakAiSoundID) == 124);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, FragmentInvisibleWaitTime) == 128);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, FragmentInvisibleTime) == 132);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, pad_3) == 136);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, RigidPenetrationScale_Soft) == 152);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, RigidPenetrationScale_Normal) == 156);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, RigidPenetrationScale_Hard) == 160);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, LandTouchSfxId) == 164);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, pad_4) == 169);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, paintDecalTargetTextureSize) == 170);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, lifeTime_forDC) == 172);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, clothUpdateDist) == 176);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, contactSeId) == 180);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, breakLandingSfxId) == 184);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, waypointDummyPolyId_0) == 188);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, waypointParamId_0) == 192);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, soundBankId) == 196);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, refDrawParamId) == 200);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, autoCreateDynamicOffsetHeight) == 204);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, reserved0) == 208);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, soundBreakSEId) == 212);
+static_assert(offsetof(paramdef::OBJECT_PARAM_ST, pad_5) == 216);
+
+}; // namespace params
+}; // namespace from
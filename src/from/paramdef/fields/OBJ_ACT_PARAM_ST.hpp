@@ -0,0 +1,68 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../OBJ_ACT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::OBJ_ACT_PARAM_ST> {
+    using T = paramdef::OBJ_ACT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 23> fields = {{
+        { "actionEnableMsgId", field_type::s32, offsetof(T, actionEnableMsgId), 4, 1, nullptr },
+        { "actionFailedMsgId", field_type::s32, offsetof(T, actionFailedMsgId), 4, 1, nullptr },
+        { "spQualifiedPassEventFlag", field_type::u32, offsetof(T, spQualifiedPassEventFlag), 4, 1, nullptr },
+        { "playerAnimId", field_type::u32, offsetof(T, playerAnimId), 4, 1, nullptr },
+        { "chrAnimId", field_type::u32, offsetof(T, chrAnimId), 4, 1, nullptr },
+        { "validDist", field_type::u16, offsetof(T, validDist), 2, 1, nullptr },
+        { "spQualifiedId", field_type::u16, offsetof(T, spQualifiedId), 2, 1, nullptr },
+        { "spQualifiedId2", field_type::u16, offsetof(T, spQualifiedId2), 2, 1, nullptr },
+        { "objDummyId", field_type::u8, offsetof(T, objDummyId), 1, 1, nullptr },
+        { "isEventKickSync", field_type::boolean, offsetof(T, isEventKickSync), 1, 1, nullptr },
+        { "objAnimId", field_type::u32, offsetof(T, objAnimId), 4, 1, nullptr },
+        { "validPlayerAngle", field_type::u8, offsetof(T, validPlayerAngle), 1, 1, nullptr },
+        { "spQualifiedType", field_type::u8, offsetof(T, spQualifiedType), 1, 1, nullptr },
+        { "spQualifiedType2", field_type::u8, offsetof(T, spQualifiedType2), 1, 1, nullptr },
+        { "validObjAngle", field_type::u8, offsetof(T, validObjAngle), 1, 1, nullptr },
+        { "chrSorbType", field_type::u8, offsetof(T, chrSorbType), 1, 1, nullptr },
+        { "eventKickTiming", field_type::u8, offsetof(T, eventKickTiming), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 2, nullptr },
+        { "actionButtonParamId", field_type::s32, offsetof(T, actionButtonParamId), 4, 1, nullptr },
+        { "enableTreasureDelaySec", field_type::f32, offsetof(T, enableTreasureDelaySec), 4, 1, nullptr },
+        { "preActionSfxDmypolyId", field_type::s32, offsetof(T, preActionSfxDmypolyId), 4, 1, nullptr },
+        { "preActionSfxId", field_type::s32, offsetof(T, preActionSfxId), 4, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 40, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, actionEnableMsgId) == 0);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, actionFailedMsgId) == 4);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, spQualifiedPassEventFlag) == 8);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, playerAnimId) == 12);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, chrAnimId) == 16);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, validDist) == 20);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, spQualifiedId) == 22);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, spQualifiedId2) == 24);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, objDummyId) == 26);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, isEventKickSync) == 27);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, objAnimId) == 28);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, validPlayerAngle) == 32);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, spQualifiedType) == 33);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, spQualifiedType2) == 34);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, validObjAngle) == 35);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, chrSorbType) == 36);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, eventKickTiming) == 37);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, pad1) == 38);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, actionButtonParamId) == 40);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, enableTreasureDelaySec) == 44);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, preActionSfxDmypolyId) == 48);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, preActionSfxId) == 52);
+static_assert(offsetof(paramdef::OBJ_ACT_PARAM_ST, pad2) == 56);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,99 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../PARTS_DRAW_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::PARTS_DRAW_PARAM_ST> {
+    using T = paramdef::PARTS_DRAW_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 39> fields = {{
+        { "lv01_BorderDist", field_type::f32, offsetof(T, lv01_BorderDist), 4, 1, nullptr },
+        { "lv01_PlayDist", field_type::f32, offsetof(T, lv01_PlayDist), 4, 1, nullptr },
+        { "lv12_BorderDist", field_type::f32, offsetof(T, lv12_BorderDist), 4, 1, nullptr },
+        { "lv12_PlayDist", field_type::f32, offsetof(T, lv12_PlayDist), 4, 1, nullptr },
+        { "lv23_BorderDist", field_type::f32, offsetof(T, lv23_BorderDist), 4, 1, nullptr },
+        { "lv23_PlayDist", field_type::f32, offsetof(T, lv23_PlayDist), 4, 1, nullptr },
+        { "lv34_BorderDist", field_type::f32, offsetof(T, lv34_BorderDist), 4, 1, nullptr },
+        { "lv34_PlayDist", field_type::f32, offsetof(T, lv34_PlayDist), 4, 1, nullptr },
+        { "lv45_BorderDist", field_type::f32, offsetof(T, lv45_BorderDist), 4, 1, nullptr },
+        { "lv45_PlayDist", field_type::f32, offsetof(T, lv45_PlayDist), 4, 1, nullptr },
+        { "tex_lv01_BorderDist", field_type::f32, offsetof(T, tex_lv01_BorderDist), 4, 1, nullptr },
+        { "tex_lv01_PlayDist", field_type::f32, offsetof(T, tex_lv01_PlayDist), 4, 1, nullptr },
+        { "enableCrossFade", field_type::u32, 48, 4, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableCrossFade; } },
+        { "drawDist", field_type::f32, offsetof(T, drawDist), 4, 1, nullptr },
+        { "drawFadeRange", field_type::f32, offsetof(T, drawFadeRange), 4, 1, nullptr },
+        { "shadowDrawDist", field_type::f32, offsetof(T, shadowDrawDist), 4, 1, nullptr },
+        { "shadowFadeRange", field_type::f32, offsetof(T, shadowFadeRange), 4, 1, nullptr },
+        { "motionBlur_BorderDist", field_type::f32, offsetof(T, motionBlur_BorderDist), 4, 1, nullptr },
+        { "isPointLightShadowSrc", field_type::boolean, offsetof(T, isPointLightShadowSrc), 1, 1, nullptr },
+        { "isDirLightShadowSrc", field_type::boolean, offsetof(T, isDirLightShadowSrc), 1, 1, nullptr },
+        { "isShadowDst", field_type::boolean, offsetof(T, isShadowDst), 1, 1, nullptr },
+        { "isShadowOnly", field_type::boolean, offsetof(T, isShadowOnly), 1, 1, nullptr },
+        { "drawByReflectCam", field_type::s8, offsetof(T, drawByReflectCam), 1, 1, nullptr },
+        { "drawOnlyReflectCam", field_type::s8, offsetof(T, drawOnlyReflectCam), 1, 1, nullptr },
+        { "IncludeLodMapLv", field_type::s8, offsetof(T, IncludeLodMapLv), 1, 1, nullptr },
+        { "isNoFarClipDraw", field_type::boolean, offsetof(T, isNoFarClipDraw), 1, 1, nullptr },
+        { "lodType", field_type::u8, offsetof(T, lodType), 1, 1, nullptr },
+        { "shadowDrawLodOffset", field_type::s8, offsetof(T, shadowDrawLodOffset), 1, 1, nullptr },
+        { "isTraceCameraXZ", field_type::boolean, offsetof(T, isTraceCameraXZ), 1, 1, nullptr },
+        { "isSkydomeDrawPhase", field_type::boolean, offsetof(T, isSkydomeDrawPhase), 1, 1, nullptr },
+        { "DistantViewModel_BorderDist", field_type::f32, offsetof(T, DistantViewModel_BorderDist), 4, 1, nullptr },
+        { "DistantViewModel_PlayDist", field_type::f32, offsetof(T, DistantViewModel_PlayDist), 4, 1, nullptr },
+        { "LimtedActivate_BorderDist_forGrid", field_type::f32, offsetof(T, LimtedActivate_BorderDist_forGrid), 4, 1, nullptr },
+        { "LimtedActivate_PlayDist_forGrid", field_type::f32, offsetof(T, LimtedActivate_PlayDist_forGrid), 4, 1, nullptr },
+        { "zSortOffsetForNoFarClipDraw", field_type::f32, offsetof(T, zSortOffsetForNoFarClipDraw), 4, 1, nullptr },
+        { "shadowDrawAlphaTestDist", field_type::f32, offsetof(T, shadowDrawAlphaTestDist), 4, 1, nullptr },
+        { "fowardDrawEnvmapBlendType", field_type::u8, offsetof(T, fowardDrawEnvmapBlendType), 1, 1, nullptr },
+        { "LBDrawDistScaleParamID", field_type::u8, offsetof(T, LBDrawDistScaleParamID), 1, 1, nullptr },
+        { "resereve", field_type::u8, offsetof(T, resereve), 1, 34, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lv01_BorderDist) == 0);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lv01_PlayDist) == 4);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lv12_BorderDist) == 8);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lv12_PlayDist) == 12);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lv23_BorderDist) == 16);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lv23_PlayDist) == 20);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lv34_BorderDist) == 24);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lv34_PlayDist) == 28);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lv45_BorderDist) == 32);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lv45_PlayDist) == 36);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, tex_lv01_BorderDist) == 40);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, tex_lv01_PlayDist) == 44);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, drawDist) == 52);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, drawFadeRange) == 56);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, shadowDrawDist) == 60);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, shadowFadeRange) == 64);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, motionBlur_BorderDist) == 68);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, isPointLightShadowSrc) == 72);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, isDirLightShadowSrc) == 73);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, isShadowDst) == 74);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, isShadowOnly) == 75);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, drawByReflectCam) == 76);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, drawOnlyReflectCam) == 77);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, IncludeLodMapLv) == 78);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, isNoFarClipDraw) == 79);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, lodType) == 80);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, shadowDrawLodOffset) == 81);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, isTraceCameraXZ) == 82);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, isSkydomeDrawPhase) == 83);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, DistantViewModel_BorderDist) == 84);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, DistantViewModel_PlayDist) == 88);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, LimtedActivate_BorderDist_forGrid) == 92);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, LimtedActivate_PlayDist_forGrid) == 96);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, zSortOffsetForNoFarClipDraw) == 100);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, shadowDrawAlphaTestDist) == 104);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, fowardDrawEnvmapBlendType) == 108);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, LBDrawDistScaleParamID) == 109);
+static_assert(offsetof(paramdef::PARTS_DRAW_PARAM_ST, resereve) == 110);
+
+}; // namespace params
+}; // namespace from
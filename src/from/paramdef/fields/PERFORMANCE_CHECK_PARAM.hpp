@@ -0,0 +1,36 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../PERFORMANCE_CHECK_PARAM.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::PERFORMANCE_CHECK_PARAM> {
+    using T = paramdef::PERFORMANCE_CHECK_PARAM;
+
+    static constexpr std::array<field_descriptor, 7> fields = {{
+        { "workTag", field_type::u8, offsetof(T, workTag), 1, 1, nullptr },
+        { "categoryTag", field_type::u8, offsetof(T, categoryTag), 1, 1, nullptr },
+        { "compareType", field_type::u8, offsetof(T, compareType), 1, 1, nullptr },
+        { "dummy1", field_type::u8, offsetof(T, dummy1), 1, 1, nullptr },
+        { "compareValue", field_type::f32, offsetof(T, compareValue), 4, 1, nullptr },
+        { "dummy2", field_type::u8, offsetof(T, dummy2), 1, 8, nullptr },
+        { "userTag", field_type::wide_character, offsetof(T, userTag), 2, 16, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::PERFORMANCE_CHECK_PARAM, workTag) == 0);
+static_assert(offsetof(paramdef::PERFORMANCE_CHECK_PARAM, categoryTag) == 1);
+static_assert(offsetof(paramdef::PERFORMANCE_CHECK_PARAM, compareType) == 2);
+static_assert(offsetof(paramdef::PERFORMANCE_CHECK_PARAM, dummy1) == 3);
+static_assert(offsetof(paramdef::PERFORMANCE_CHECK_PARAM, compareValue) == 4);
+static_assert(offsetof(paramdef::PERFORMANCE_CHECK_PARAM, dummy2) == 8);
+static_assert(offsetof(paramdef::PERFORMANCE_CHECK_PARAM, userTag) == 16);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,80 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../PHANTOM_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::PHANTOM_PARAM_ST> {
+    using T = paramdef::PHANTOM_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 29> fields = {{
+        { "edgeColorA", field_type::f32, offsetof(T, edgeColorA), 4, 1, nullptr },
+        { "frontColorA", field_type::f32, offsetof(T, frontColorA), 4, 1, nullptr },
+        { "diffMulColorA", field_type::f32, offsetof(T, diffMulColorA), 4, 1, nullptr },
+        { "specMulColorA", field_type::f32, offsetof(T, specMulColorA), 4, 1, nullptr },
+        { "lightColorA", field_type::f32, offsetof(T, lightColorA), 4, 1, nullptr },
+        { "edgeColorR", field_type::u8, offsetof(T, edgeColorR), 1, 1, nullptr },
+        { "edgeColorG", field_type::u8, offsetof(T, edgeColorG), 1, 1, nullptr },
+        { "edgeColorB", field_type::u8, offsetof(T, edgeColorB), 1, 1, nullptr },
+        { "frontColorR", field_type::u8, offsetof(T, frontColorR), 1, 1, nullptr },
+        { "frontColorG", field_type::u8, offsetof(T, frontColorG), 1, 1, nullptr },
+        { "frontColorB", field_type::u8, offsetof(T, frontColorB), 1, 1, nullptr },
+        { "diffMulColorR", field_type::u8, offsetof(T, diffMulColorR), 1, 1, nullptr },
+        { "diffMulColorG", field_type::u8, offsetof(T, diffMulColorG), 1, 1, nullptr },
+        { "diffMulColorB", field_type::u8, offsetof(T, diffMulColorB), 1, 1, nullptr },
+        { "specMulColorR", field_type::u8, offsetof(T, specMulColorR), 1, 1, nullptr },
+        { "specMulColorG", field_type::u8, offsetof(T, specMulColorG), 1, 1, nullptr },
+        { "specMulColorB", field_type::u8, offsetof(T, specMulColorB), 1, 1, nullptr },
+        { "lightColorR", field_type::u8, offsetof(T, lightColorR), 1, 1, nullptr },
+        { "lightColorG", field_type::u8, offsetof(T, lightColorG), 1, 1, nullptr },
+        { "lightColorB", field_type::u8, offsetof(T, lightColorB), 1, 1, nullptr },
+        { "reserve", field_type::u8, offsetof(T, reserve), 1, 1, nullptr },
+        { "alpha", field_type::f32, offsetof(T, alpha), 4, 1, nullptr },
+        { "blendRate", field_type::f32, offsetof(T, blendRate), 4, 1, nullptr },
+        { "blendType", field_type::u8, offsetof(T, blendType), 1, 1, nullptr },
+        { "isEdgeSubtract", field_type::boolean, offsetof(T, isEdgeSubtract), 1, 1, nullptr },
+        { "isFrontSubtract", field_type::boolean, offsetof(T, isFrontSubtract), 1, 1, nullptr },
+        { "isNo2Pass", field_type::boolean, offsetof(T, isNo2Pass), 1, 1, nullptr },
+        { "edgePower", field_type::f32, offsetof(T, edgePower), 4, 1, nullptr },
+        { "glowScale", field_type::f32, offsetof(T, glowScale), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, edgeColorA) == 0);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, frontColorA) == 4);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, diffMulColorA) == 8);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, specMulColorA) == 12);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, lightColorA) == 16);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, edgeColorR) == 20);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, edgeColorG) == 21);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, edgeColorB) == 22);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, frontColorR) == 23);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, frontColorG) == 24);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, frontColorB) == 25);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, diffMulColorR) == 26);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, diffMulColorG) == 27);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, diffMulColorB) == 28);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, specMulColorR) == 29);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, specMulColorG) == 30);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, specMulColorB) == 31);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, lightColorR) == 32);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, lightColorG) == 33);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, lightColorB) == 34);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, reserve) == 35);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, alpha) == 36);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, blendRate) == 40);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, blendType) == 44);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, isEdgeSubtract) == 45);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, isFrontSubtract) == 46);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, isNo2Pass) == 47);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, edgePower) == 48);
+static_assert(offsetof(paramdef::PHANTOM_PARAM_ST, glowScale) == 52);
+
+}; // namespace params
+}; // namespace from
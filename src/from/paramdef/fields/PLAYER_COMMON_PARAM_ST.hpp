@@ -0,0 +1,152 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../PLAYER_COMMON_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::PLAYER_COMMON_PARAM_ST> {
+    using T = paramdef::PLAYER_COMMON_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 65> fields = {{
+        { "playerFootEffect_bySFX", field_type::s32, offsetof(T, playerFootEffect_bySFX), 4, 1, nullptr },
+        { "snipeModeDrawAlpha_FadeTime", field_type::f32, offsetof(T, snipeModeDrawAlpha_FadeTime), 4, 1, nullptr },
+        { "toughnessRecoverCorrection", field_type::f32, offsetof(T, toughnessRecoverCorrection), 4, 1, nullptr },
+        { "baseMagicSlotSize", field_type::u8, offsetof(T, baseMagicSlotSize), 1, 1, nullptr },
+        { "baseAccSlotNum", field_type::u8, offsetof(T, baseAccSlotNum), 1, 1, nullptr },
+        { "reserved02", field_type::u8, offsetof(T, reserved02), 1, 2, nullptr },
+        { "animeID_DropItemPick", field_type::s32, offsetof(T, animeID_DropItemPick), 4, 1, nullptr },
+        { "resistRecoverPoint_Sleep_Player", field_type::f32, offsetof(T, resistRecoverPoint_Sleep_Player), 4, 1, nullptr },
+        { "flareOverrideHomingAngle", field_type::s32, offsetof(T, flareOverrideHomingAngle), 4, 1, nullptr },
+        { "flareOverrideHomingStopRange", field_type::f32, offsetof(T, flareOverrideHomingStopRange), 4, 1, nullptr },
+        { "animeID_SleepCollectorItemPick", field_type::s32, offsetof(T, animeID_SleepCollectorItemPick), 4, 1, nullptr },
+        { "unlockEventFlagBaseId_forWepAttr", field_type::u32, offsetof(T, unlockEventFlagBaseId_forWepAttr), 4, 1, nullptr },
+        { "systemEnchant_BigRune", field_type::s32, offsetof(T, systemEnchant_BigRune), 4, 1, nullptr },
+        { "lowStatus_AtkPowDown", field_type::f32, offsetof(T, lowStatus_AtkPowDown), 4, 1, nullptr },
+        { "lowStatus_ConsumeStaminaRate", field_type::f32, offsetof(T, lowStatus_ConsumeStaminaRate), 4, 1, nullptr },
+        { "lowStatus_AtkGuardBreak", field_type::s16, offsetof(T, lowStatus_AtkGuardBreak), 2, 1, nullptr },
+        { "guardStatusCorrect_MaxStatusVal", field_type::s16, offsetof(T, guardStatusCorrect_MaxStatusVal), 2, 1, nullptr },
+        { "unlockEventFlagStepNum_forWepAttr", field_type::u16, offsetof(T, unlockEventFlagStepNum_forWepAttr), 2, 1, nullptr },
+        { "retributionMagic_damageCountNum", field_type::u16, offsetof(T, retributionMagic_damageCountNum), 2, 1, nullptr },
+        { "retributionMagic_damageCountRemainTime", field_type::u16, offsetof(T, retributionMagic_damageCountRemainTime), 2, 1, nullptr },
+        { "retributionMagic_burstDmypolyId", field_type::u16, offsetof(T, retributionMagic_burstDmypolyId), 2, 1, nullptr },
+        { "retributionMagic_burstMagicParamId", field_type::s32, offsetof(T, retributionMagic_burstMagicParamId), 4, 1, nullptr },
+        { "chrAimCam_rideOffsetHeight", field_type::f32, offsetof(T, chrAimCam_rideOffsetHeight), 4, 1, nullptr },
+        { "reserved23", field_type::u8, offsetof(T, reserved23), 1, 4, nullptr },
+        { "arrowCaseWepBindDmypolyId", field_type::s32, offsetof(T, arrowCaseWepBindDmypolyId), 4, 1, nullptr },
+        { "boltPouchWepBindDmypolyId", field_type::s32, offsetof(T, boltPouchWepBindDmypolyId), 4, 1, nullptr },
+        { "estusFlaskAllocateRate", field_type::f32, offsetof(T, estusFlaskAllocateRate), 4, 1, nullptr },
+        { "reserved38", field_type::u8, offsetof(T, reserved38), 1, 2, nullptr },
+        { "kickAcceptanceDeg", field_type::u8, offsetof(T, kickAcceptanceDeg), 1, 1, nullptr },
+        { "npcPlayerAnalogWeightRate_Light", field_type::u8, offsetof(T, npcPlayerAnalogWeightRate_Light), 1, 1, nullptr },
+        { "npcPlayerAnalogWeightRate_Normal", field_type::u8, offsetof(T, npcPlayerAnalogWeightRate_Normal), 1, 1, nullptr },
+        { "npcPlayerAnalogWeightRate_Heavy", field_type::u8, offsetof(T, npcPlayerAnalogWeightRate_Heavy), 1, 1, nullptr },
+        { "npcPlayerAnalogWeightRate_WeightOver", field_type::u8, offsetof(T, npcPlayerAnalogWeightRate_WeightOver), 1, 1, nullptr },
+        { "npcPlayerAnalogWeightRate_SuperLight", field_type::u8, offsetof(T, npcPlayerAnalogWeightRate_SuperLight), 1, 1, nullptr },
+        { "reserved45", field_type::u8, offsetof(T, reserved45), 1, 4, nullptr },
+        { "clearCountCorrectBaseSpEffectId", field_type::s32, offsetof(T, clearCountCorrectBaseSpEffectId), 4, 1, nullptr },
+        { "arrowBoltModelIdOffset", field_type::s32, offsetof(T, arrowBoltModelIdOffset), 4, 1, nullptr },
+        { "arrowBoltRemainingNumModelMaskThreshold1", field_type::s8, offsetof(T, arrowBoltRemainingNumModelMaskThreshold1), 1, 1, nullptr },
+        { "arrowBoltRemainingNumModelMaskThreshold2", field_type::s8, offsetof(T, arrowBoltRemainingNumModelMaskThreshold2), 1, 1, nullptr },
+        { "reserved27", field_type::u8, offsetof(T, reserved27), 1, 2, nullptr },
+        { "resistRecoverPoint_Poision_Player", field_type::f32, offsetof(T, resistRecoverPoint_Poision_Player), 4, 1, nullptr },
+        { "resistRecoverPoint_Desease_Player", field_type::f32, offsetof(T, resistRecoverPoint_Desease_Player), 4, 1, nullptr },
+        { "resistRecoverPoint_Blood_Player", field_type::f32, offsetof(T, resistRecoverPoint_Blood_Player), 4, 1, nullptr },
+        { "resistRecoverPoint_Curse_Player", field_type::f32, offsetof(T, resistRecoverPoint_Curse_Player), 4, 1, nullptr },
+        { "resistRecoverPoint_Freeze_Player", field_type::f32, offsetof(T, resistRecoverPoint_Freeze_Player), 4, 1, nullptr },
+        { "resistRecoverPoint_Poision_Enemy", field_type::f32, offsetof(T, resistRecoverPoint_Poision_Enemy), 4, 1, nullptr },
+        { "resistRecoverPoint_Desease_Enemy", field_type::f32, offsetof(T, resistRecoverPoint_Desease_Enemy), 4, 1, nullptr },
+        { "resistRecoverPoint_Blood_Enemy", field_type::f32, offsetof(T, resistRecoverPoint_Blood_Enemy), 4, 1, nullptr },
+        { "resistRecoverPoint_Curse_Enemy", field_type::f32, offsetof(T, resistRecoverPoint_Curse_Enemy), 4, 1, nullptr },
+        { "resistRecoverPoint_Freeze_Enemy", field_type::f32, offsetof(T, resistRecoverPoint_Freeze_Enemy), 4, 1, nullptr },
+        { "requestTimeLeftBothHand", field_type::f32, offsetof(T, requestTimeLeftBothHand), 4, 1, nullptr },
+        { "resistRecoverPoint_Madness_Player", field_type::f32, offsetof(T, resistRecoverPoint_Madness_Player), 4, 1, nullptr },
+        { "animeID_MaterialItemPick", field_type::s32, offsetof(T, animeID_MaterialItemPick), 4, 1, nullptr },
+        { "hpEstusFlaskAllocateRateForYellowMonk", field_type::f32, offsetof(T, hpEstusFlaskAllocateRateForYellowMonk), 4, 1, nullptr },
+        { "hpEstusFlaskAllocateOffsetForYellowMonk", field_type::s32, offsetof(T, hpEstusFlaskAllocateOffsetForYellowMonk), 4, 1, nullptr },
+        { "mpEstusFlaskAllocateRateForYellowMonk", field_type::f32, offsetof(T, mpEstusFlaskAllocateRateForYellowMonk), 4, 1, nullptr },
+        { "mpEstusFlaskAllocateOffsetForYellowMonk", field_type::s32, offsetof(T, mpEstusFlaskAllocateOffsetForYellowMonk), 4, 1, nullptr },
+        { "resistRecoverPoint_Sleep_Enemy", field_type::f32, offsetof(T, resistRecoverPoint_Sleep_Enemy), 4, 1, nullptr },
+        { "resistRecoverPoint_Madness_Enemy", field_type::f32, offsetof(T, resistRecoverPoint_Madness_Enemy), 4, 1, nullptr },
+        { "resistCurseItemId", field_type::s32, offsetof(T, resistCurseItemId), 4, 1, nullptr },
+        { "resistCurseItemMaxNum", field_type::u8, offsetof(T, resistCurseItemMaxNum), 1, 1, nullptr },
+        { "reserved_123", field_type::u8, offsetof(T, reserved_123), 1, 3, nullptr },
+        { "resistCurseItemSpEffectBaseId", field_type::s32, offsetof(T, resistCurseItemSpEffectBaseId), 4, 1, nullptr },
+        { "resistCurseItemLotParamId_map", field_type::s32, offsetof(T, resistCurseItemLotParamId_map), 4, 1, nullptr },
+        { "reserved41", field_type::u8, offsetof(T, reserved41), 1, 52, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, playerFootEffect_bySFX) == 0);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, snipeModeDrawAlpha_FadeTime) == 4);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, toughnessRecoverCorrection) == 8);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, baseMagicSlotSize) == 12);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, baseAccSlotNum) == 13);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, reserved02) == 14);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, animeID_DropItemPick) == 16);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Sleep_Player) == 20);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, flareOverrideHomingAngle) == 24);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, flareOverrideHomingStopRange) == 28);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, animeID_SleepCollectorItemPick) == 32);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, unlockEventFlagBaseId_forWepAttr) == 36);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, systemEnchant_BigRune) == 40);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, lowStatus_AtkPowDown) == 44);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, lowStatus_ConsumeStaminaRate) == 48);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, lowStatus_AtkGuardBreak) == 52);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, guardStatusCorrect_MaxStatusVal) == 54);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, unlockEventFlagStepNum_forWepAttr) == 56);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, retributionMagic_damageCountNum) == 58);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, retributionMagic_damageCountRemainTime) == 60);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, retributionMagic_burstDmypolyId) == 62);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, retributionMagic_burstMagicParamId) == 64);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, chrAimCam_rideOffsetHeight) == 68);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, reserved23) == 72);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, arrowCaseWepBindDmypolyId) == 76);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, boltPouchWepBindDmypolyId) == 80);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, estusFlaskAllocateRate) == 84);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, reserved38) == 88);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, kickAcceptanceDeg) == 90);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, npcPlayerAnalogWeightRate_Light) == 91);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, npcPlayerAnalogWeightRate_Normal) == 92);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, npcPlayerAnalogWeightRate_Heavy) == 93);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, npcPlayerAnalogWeightRate_WeightOver) == 94);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, npcPlayerAnalogWeightRate_SuperLight) == 95);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, reserved45) == 96);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, clearCountCorrectBaseSpEffectId) == 100);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, arrowBoltModelIdOffset) == 104);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, arrowBoltRemainingNumModelMaskThreshold1) == 108);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, arrowBoltRemainingNumModelMaskThreshold2) == 109);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, reserved27) == 110);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Poision_Player) == 112);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Desease_Player) == 116);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Blood_Player) == 120);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Curse_Player) == 124);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Freeze_Player) == 128);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Poision_Enemy) == 132);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Desease_Enemy) == 136);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Blood_Enemy) == 140);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Curse_Enemy) == 144);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Freeze_Enemy) == 148);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, requestTimeLeftBothHand) == 152);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Madness_Player) == 156);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, animeID_MaterialItemPick) == 160);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, hpEstusFlaskAllocateRateForYellowMonk) == 164);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, hpEstusFlaskAllocateOffsetForYellowMonk) == 168);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, mpEstusFlaskAllocateRateForYellowMonk) == 172);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, mpEstusFlaskAllocateOffsetForYellowMonk) == 176);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Sleep_Enemy) == 180);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistRecoverPoint_Madness_Enemy) == 184);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistCurseItemId) == 188);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistCurseItemMaxNum) == 192);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, reserved_123) == 193);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistCurseItemSpEffectBaseId) == 196);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, resistCurseItemLotParamId_map) == 200);
+static_assert(offsetof(paramdef::PLAYER_COMMON_PARAM_ST, reserved41) == 204);
+
+}; // namespace params
+}; // namespace from
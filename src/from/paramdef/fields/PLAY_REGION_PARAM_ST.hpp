@@ -0,0 +1,172 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../PLAY_REGION_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::PLAY_REGION_PARAM_ST> {
+    using T = paramdef::PLAY_REGION_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 85> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "matchAreaId", field_type::s32, offsetof(T, matchAreaId), 4, 1, nullptr },
+        { "multiPlayStartLimitEventFlagId", field_type::u32, offsetof(T, multiPlayStartLimitEventFlagId), 4, 1, nullptr },
+        { "otherDisableDistance", field_type::f32, offsetof(T, otherDisableDistance), 4, 1, nullptr },
+        { "pcPositionSaveLimitEventFlagId", field_type::u32, offsetof(T, pcPositionSaveLimitEventFlagId), 4, 1, nullptr },
+        { "bossAreaId", field_type::u32, offsetof(T, bossAreaId), 4, 1, nullptr },
+        { "cultNpcWhiteGhostEntityId_byFree", field_type::s16, offsetof(T, cultNpcWhiteGhostEntityId_byFree), 2, 1, nullptr },
+        { "bMapGuradianRegion", field_type::boolean, offsetof(T, bMapGuradianRegion), 1, 1, nullptr },
+        { "bYellowCostumeRegion", field_type::boolean, 27, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bYellowCostumeRegion; } },
+        { "multiPlayStartLimitEventFlagId_targetFlagState", field_type::boolean, 27, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->multiPlayStartLimitEventFlagId_targetFlagState; } },
+        { "breakInLimitEventFlagId_1_targetFlagState", field_type::boolean, 27, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->breakInLimitEventFlagId_1_targetFlagState; } },
+        { "whiteSignLimitEventFlagId_1_targetFlagState", field_type::boolean, 27, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->whiteSignLimitEventFlagId_1_targetFlagState; } },
+        { "redSignLimitEventFlagId_1_targetFlagState", field_type::boolean, 27, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->redSignLimitEventFlagId_1_targetFlagState; } },
+        { "breakInLimitEventFlagId_2_targetFlagState", field_type::boolean, 27, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->breakInLimitEventFlagId_2_targetFlagState; } },
+        { "breakInLimitEventFlagId_3_targetFlagState", field_type::boolean, 27, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->breakInLimitEventFlagId_3_targetFlagState; } },
+        { "whiteSignLimitEventFlagId_2_targetFlagState", field_type::boolean, 27, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->whiteSignLimitEventFlagId_2_targetFlagState; } },
+        { "warpItemUsePermitBonfireId_1", field_type::u32, offsetof(T, warpItemUsePermitBonfireId_1), 4, 1, nullptr },
+        { "warpItemUsePermitBonfireId_2", field_type::u32, offsetof(T, warpItemUsePermitBonfireId_2), 4, 1, nullptr },
+        { "warpItemUsePermitBonfireId_3", field_type::u32, offsetof(T, warpItemUsePermitBonfireId_3), 4, 1, nullptr },
+        { "warpItemUsePermitBonfireId_4", field_type::u32, offsetof(T, warpItemUsePermitBonfireId_4), 4, 1, nullptr },
+        { "warpItemUsePermitBonfireId_5", field_type::u32, offsetof(T, warpItemUsePermitBonfireId_5), 4, 1, nullptr },
+        { "warpItemProhibitionEventFlagId_1", field_type::u32, offsetof(T, warpItemProhibitionEventFlagId_1), 4, 1, nullptr },
+        { "warpItemProhibitionEventFlagId_2", field_type::u32, offsetof(T, warpItemProhibitionEventFlagId_2), 4, 1, nullptr },
+        { "warpItemProhibitionEventFlagId_3", field_type::u32, offsetof(T, warpItemProhibitionEventFlagId_3), 4, 1, nullptr },
+        { "warpItemProhibitionEventFlagId_4", field_type::u32, offsetof(T, warpItemProhibitionEventFlagId_4), 4, 1, nullptr },
+        { "warpItemProhibitionEventFlagId_5", field_type::u32, offsetof(T, warpItemProhibitionEventFlagId_5), 4, 1, nullptr },
+        { "enableBloodstain", field_type::boolean, 68, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableBloodstain; } },
+        { "enableBloodMessage", field_type::boolean, 68, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableBloodMessage; } },
+        { "enableGhost", field_type::boolean, 68, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableGhost; } },
+        { "dispMask00", field_type::boolean, 68, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->dispMask00; } },
+        { "dispMask01", field_type::boolean, 68, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->dispMask01; } },
+        { "whiteSignLimitEventFlagId_3_targetFlagState", field_type::boolean, 68, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->whiteSignLimitEventFlagId_3_targetFlagState; } },
+        { "redSignLimitEventFlagId_2_targetFlagState", field_type::boolean, 68, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->redSignLimitEventFlagId_2_targetFlagState; } },
+        { "redSignLimitEventFlagId_3_targetFlagState", field_type::boolean, 68, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->redSignLimitEventFlagId_3_targetFlagState; } },
+        { "isAutoIntrudePoint", field_type::boolean, 69, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAutoIntrudePoint; } },
+        { "pad1", field_type::u8, 69, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad1; } },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 2, nullptr },
+        { "multiPlayHASHostLimitEventFlagId", field_type::u32, offsetof(T, multiPlayHASHostLimitEventFlagId), 4, 1, nullptr },
+        { "otherMaxDistance", field_type::f32, offsetof(T, otherMaxDistance), 4, 1, nullptr },
+        { "signPuddleOpenEventFlagId", field_type::u32, offsetof(T, signPuddleOpenEventFlagId), 4, 1, nullptr },
+        { "areaNo", field_type::u8, offsetof(T, areaNo), 1, 1, nullptr },
+        { "gridXNo", field_type::u8, offsetof(T, gridXNo), 1, 1, nullptr },
+        { "gridZNo", field_type::u8, offsetof(T, gridZNo), 1, 1, nullptr },
+        { "pad4", field_type::u8, offsetof(T, pad4), 1, 1, nullptr },
+        { "posX", field_type::f32, offsetof(T, posX), 4, 1, nullptr },
+        { "posY", field_type::f32, offsetof(T, posY), 4, 1, nullptr },
+        { "posZ", field_type::f32, offsetof(T, posZ), 4, 1, nullptr },
+        { "breakInLimitEventFlagId_1", field_type::u32, offsetof(T, breakInLimitEventFlagId_1), 4, 1, nullptr },
+        { "whiteSignLimitEventFlagId_1", field_type::u32, offsetof(T, whiteSignLimitEventFlagId_1), 4, 1, nullptr },
+        { "matchAreaSignCreateLimitEventFlagId", field_type::u32, offsetof(T, matchAreaSignCreateLimitEventFlagId), 4, 1, nullptr },
+        { "signAimId_1", field_type::u32, offsetof(T, signAimId_1), 4, 1, nullptr },
+        { "signAimId_2", field_type::u32, offsetof(T, signAimId_2), 4, 1, nullptr },
+        { "signAimId_3", field_type::u32, offsetof(T, signAimId_3), 4, 1, nullptr },
+        { "signAimId_4", field_type::u32, offsetof(T, signAimId_4), 4, 1, nullptr },
+        { "signAimId_5", field_type::u32, offsetof(T, signAimId_5), 4, 1, nullptr },
+        { "signAimId_6", field_type::u32, offsetof(T, signAimId_6), 4, 1, nullptr },
+        { "signAimId_7", field_type::u32, offsetof(T, signAimId_7), 4, 1, nullptr },
+        { "signAimId_8", field_type::u32, offsetof(T, signAimId_8), 4, 1, nullptr },
+        { "redSignLimitEventFlagId_1", field_type::u32, offsetof(T, redSignLimitEventFlagId_1), 4, 1, nullptr },
+        { "breakInLimitEventFlagId_2", field_type::u32, offsetof(T, breakInLimitEventFlagId_2), 4, 1, nullptr },
+        { "breakInLimitEventFlagId_3", field_type::u32, offsetof(T, breakInLimitEventFlagId_3), 4, 1, nullptr },
+        { "whiteSignLimitEventFlagId_2", field_type::u32, offsetof(T, whiteSignLimitEventFlagId_2), 4, 1, nullptr },
+        { "whiteSignLimitEventFlagId_3", field_type::u32, offsetof(T, whiteSignLimitEventFlagId_3), 4, 1, nullptr },
+        { "redSignLimitEventFlagId_2", field_type::u32, offsetof(T, redSignLimitEventFlagId_2), 4, 1, nullptr },
+        { "redSignLimitEventFlagId_3", field_type::u32, offsetof(T, redSignLimitEventFlagId_3), 4, 1, nullptr },
+        { "bossId_1", field_type::u32, offsetof(T, bossId_1), 4, 1, nullptr },
+        { "bossId_2", field_type::u32, offsetof(T, bossId_2), 4, 1, nullptr },
+        { "bossId_3", field_type::u32, offsetof(T, bossId_3), 4, 1, nullptr },
+        { "bossId_4", field_type::u32, offsetof(T, bossId_4), 4, 1, nullptr },
+        { "bossId_5", field_type::u32, offsetof(T, bossId_5), 4, 1, nullptr },
+        { "bossId_6", field_type::u32, offsetof(T, bossId_6), 4, 1, nullptr },
+        { "bossId_7", field_type::u32, offsetof(T, bossId_7), 4, 1, nullptr },
+        { "bossId_8", field_type::u32, offsetof(T, bossId_8), 4, 1, nullptr },
+        { "bossId_9", field_type::u32, offsetof(T, bossId_9), 4, 1, nullptr },
+        { "bossId_10", field_type::u32, offsetof(T, bossId_10), 4, 1, nullptr },
+        { "bossId_11", field_type::u32, offsetof(T, bossId_11), 4, 1, nullptr },
+        { "bossId_12", field_type::u32, offsetof(T, bossId_12), 4, 1, nullptr },
+        { "bossId_13", field_type::u32, offsetof(T, bossId_13), 4, 1, nullptr },
+        { "bossId_14", field_type::u32, offsetof(T, bossId_14), 4, 1, nullptr },
+        { "bossId_15", field_type::u32, offsetof(T, bossId_15), 4, 1, nullptr },
+        { "bossId_16", field_type::u32, offsetof(T, bossId_16), 4, 1, nullptr },
+        { "mapMenuUnlockEventId", field_type::u32, offsetof(T, mapMenuUnlockEventId), 4, 1, nullptr },
+        { "pad5", field_type::u8, offsetof(T, pad5), 1, 32, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, matchAreaId) == 4);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, multiPlayStartLimitEventFlagId) == 8);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, otherDisableDistance) == 12);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, pcPositionSaveLimitEventFlagId) == 16);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossAreaId) == 20);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, cultNpcWhiteGhostEntityId_byFree) == 24);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bMapGuradianRegion) == 26);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, warpItemUsePermitBonfireId_1) == 28);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, warpItemUsePermitBonfireId_2) == 32);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, warpItemUsePermitBonfireId_3) == 36);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, warpItemUsePermitBonfireId_4) == 40);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, warpItemUsePermitBonfireId_5) == 44);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, warpItemProhibitionEventFlagId_1) == 48);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, warpItemProhibitionEventFlagId_2) == 52);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, warpItemProhibitionEventFlagId_3) == 56);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, warpItemProhibitionEventFlagId_4) == 60);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, warpItemProhibitionEventFlagId_5) == 64);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, pad2) == 70);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, multiPlayHASHostLimitEventFlagId) == 72);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, otherMaxDistance) == 76);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, signPuddleOpenEventFlagId) == 80);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, areaNo) == 84);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, gridXNo) == 85);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, gridZNo) == 86);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, pad4) == 87);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, posX) == 88);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, posY) == 92);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, posZ) == 96);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, breakInLimitEventFlagId_1) == 100);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, whiteSignLimitEventFlagId_1) == 104);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, matchAreaSignCreateLimitEventFlagId) == 108);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, signAimId_1) == 112);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, signAimId_2) == 116);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, signAimId_3) == 120);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, signAimId_4) == 124);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, signAimId_5) == 128);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, signAimId_6) == 132);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, signAimId_7) == 136);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, signAimId_8) == 140);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, redSignLimitEventFlagId_1) == 144);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, breakInLimitEventFlagId_2) == 148);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, breakInLimitEventFlagId_3) == 152);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, whiteSignLimitEventFlagId_2) == 156);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, whiteSignLimitEventFlagId_3) == 160);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, redSignLimitEventFlagId_2) == 164);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, redSignLimitEventFlagId_3) == 168);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_1) == 172);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_2) == 176);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_3) == 180);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_4) == 184);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_5) == 188);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_6) == 192);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_7) == 196);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_8) == 200);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_9) == 204);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_10) == 208);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_11) == 212);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_12) == 216);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_13) == 220);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_14) == 224);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_15) == 228);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, bossId_16) == 232);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, mapMenuUnlockEventId) == 236);
+static_assert(offsetof(paramdef::PLAY_REGION_PARAM_ST, pad5) == 240);
+
+}; // namespace params
+}; // namespace from
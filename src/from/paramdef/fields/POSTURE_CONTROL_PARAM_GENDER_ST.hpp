@@ -0,0 +1,78 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../POSTURE_CONTROL_PARAM_GENDER_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::POSTURE_CONTROL_PARAM_GENDER_ST> {
+    using T = paramdef::POSTURE_CONTROL_PARAM_GENDER_ST;
+
+    static constexpr std::array<field_descriptor, 28> fields = {{
+        { "a000_rightElbowIO", field_type::s16, offsetof(T, a000_rightElbowIO), 2, 1, nullptr },
+        { "a000_leftElbowIO", field_type::s16, offsetof(T, a000_leftElbowIO), 2, 1, nullptr },
+        { "a000_bothLegsIO", field_type::s16, offsetof(T, a000_bothLegsIO), 2, 1, nullptr },
+        { "a002_rightElbowIO", field_type::s16, offsetof(T, a002_rightElbowIO), 2, 1, nullptr },
+        { "a002_leftElbowIO", field_type::s16, offsetof(T, a002_leftElbowIO), 2, 1, nullptr },
+        { "a002_bothLegsIO", field_type::s16, offsetof(T, a002_bothLegsIO), 2, 1, nullptr },
+        { "a003_rightElbowIO", field_type::s16, offsetof(T, a003_rightElbowIO), 2, 1, nullptr },
+        { "a003_leftElbowIO", field_type::s16, offsetof(T, a003_leftElbowIO), 2, 1, nullptr },
+        { "a003_bothLegsIO", field_type::s16, offsetof(T, a003_bothLegsIO), 2, 1, nullptr },
+        { "a010_rightElbowIO", field_type::s16, offsetof(T, a010_rightElbowIO), 2, 1, nullptr },
+        { "a010_leftElbowIO", field_type::s16, offsetof(T, a010_leftElbowIO), 2, 1, nullptr },
+        { "a010_bothLegsIO", field_type::s16, offsetof(T, a010_bothLegsIO), 2, 1, nullptr },
+        { "a012_rightElbowIO", field_type::s16, offsetof(T, a012_rightElbowIO), 2, 1, nullptr },
+        { "a012_leftElbowIO", field_type::s16, offsetof(T, a012_leftElbowIO), 2, 1, nullptr },
+        { "a012_bothLegsIO", field_type::s16, offsetof(T, a012_bothLegsIO), 2, 1, nullptr },
+        { "a013_rightElbowIO", field_type::s16, offsetof(T, a013_rightElbowIO), 2, 1, nullptr },
+        { "a013_leftElbowIO", field_type::s16, offsetof(T, a013_leftElbowIO), 2, 1, nullptr },
+        { "a013_bothLegsIO", field_type::s16, offsetof(T, a013_bothLegsIO), 2, 1, nullptr },
+        { "a014_rightElbowIO", field_type::s16, offsetof(T, a014_rightElbowIO), 2, 1, nullptr },
+        { "a014_leftElbowIO", field_type::s16, offsetof(T, a014_leftElbowIO), 2, 1, nullptr },
+        { "a014_bothLegsIO", field_type::s16, offsetof(T, a014_bothLegsIO), 2, 1, nullptr },
+        { "a015_rightElbowIO", field_type::s16, offsetof(T, a015_rightElbowIO), 2, 1, nullptr },
+        { "a015_leftElbowIO", field_type::s16, offsetof(T, a015_leftElbowIO), 2, 1, nullptr },
+        { "a015_bothLegsIO", field_type::s16, offsetof(T, a015_bothLegsIO), 2, 1, nullptr },
+        { "a016_rightElbowIO", field_type::s16, offsetof(T, a016_rightElbowIO), 2, 1, nullptr },
+        { "a016_leftElbowIO", field_type::s16, offsetof(T, a016_leftElbowIO), 2, 1, nullptr },
+        { "a016_bothLegsIO", field_type::s16, offsetof(T, a016_bothLegsIO), 2, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 10, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a000_rightElbowIO) == 0);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a000_leftElbowIO) == 2);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a000_bothLegsIO) == 4);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a002_rightElbowIO) == 6);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a002_leftElbowIO) == 8);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a002_bothLegsIO) == 10);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a003_rightElbowIO) == 12);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a003_leftElbowIO) == 14);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a003_bothLegsIO) == 16);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a010_rightElbowIO) == 18);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a010_leftElbowIO) == 20);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a010_bothLegsIO) == 22);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a012_rightElbowIO) == 24);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a012_leftElbowIO) == 26);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a012_bothLegsIO) == 28);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a013_rightElbowIO) == 30);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a013_leftElbowIO) == 32);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a013_bothLegsIO) == 34);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a014_rightElbowIO) == 36);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a014_leftElbowIO) == 38);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a014_bothLegsIO) == 40);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a015_rightElbowIO) == 42);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a015_leftElbowIO) == 44);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a015_bothLegsIO) == 46);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a016_rightElbowIO) == 48);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a016_leftElbowIO) == 50);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, a016_bothLegsIO) == 52);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_GENDER_ST, pad) == 54);
+
+}; // namespace params
+}; // namespace from
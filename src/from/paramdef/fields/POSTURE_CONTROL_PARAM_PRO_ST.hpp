@@ -0,0 +1,96 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../POSTURE_CONTROL_PARAM_PRO_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::POSTURE_CONTROL_PARAM_PRO_ST> {
+    using T = paramdef::POSTURE_CONTROL_PARAM_PRO_ST;
+
+    static constexpr std::array<field_descriptor, 37> fields = {{
+        { "a000_rightArmIO", field_type::s16, offsetof(T, a000_rightArmIO), 2, 1, nullptr },
+        { "a000_rightArmFB", field_type::s16, offsetof(T, a000_rightArmFB), 2, 1, nullptr },
+        { "a000_leftArmIO", field_type::s16, offsetof(T, a000_leftArmIO), 2, 1, nullptr },
+        { "a000_leftArmFB", field_type::s16, offsetof(T, a000_leftArmFB), 2, 1, nullptr },
+        { "a002_rightArmIO", field_type::s16, offsetof(T, a002_rightArmIO), 2, 1, nullptr },
+        { "a002_rightArmFB", field_type::s16, offsetof(T, a002_rightArmFB), 2, 1, nullptr },
+        { "a002_leftArmIO", field_type::s16, offsetof(T, a002_leftArmIO), 2, 1, nullptr },
+        { "a002_leftArmFB", field_type::s16, offsetof(T, a002_leftArmFB), 2, 1, nullptr },
+        { "a003_rightArmIO", field_type::s16, offsetof(T, a003_rightArmIO), 2, 1, nullptr },
+        { "a003_rightArmFB", field_type::s16, offsetof(T, a003_rightArmFB), 2, 1, nullptr },
+        { "a003_leftArmIO", field_type::s16, offsetof(T, a003_leftArmIO), 2, 1, nullptr },
+        { "a003_leftArmFB", field_type::s16, offsetof(T, a003_leftArmFB), 2, 1, nullptr },
+        { "a010_rightArmIO", field_type::s16, offsetof(T, a010_rightArmIO), 2, 1, nullptr },
+        { "a010_rightArmFB", field_type::s16, offsetof(T, a010_rightArmFB), 2, 1, nullptr },
+        { "a010_leftArmIO", field_type::s16, offsetof(T, a010_leftArmIO), 2, 1, nullptr },
+        { "a010_leftArmFB", field_type::s16, offsetof(T, a010_leftArmFB), 2, 1, nullptr },
+        { "a012_rightArmIO", field_type::s16, offsetof(T, a012_rightArmIO), 2, 1, nullptr },
+        { "a012_rightArmFB", field_type::s16, offsetof(T, a012_rightArmFB), 2, 1, nullptr },
+        { "a012_leftArmIO", field_type::s16, offsetof(T, a012_leftArmIO), 2, 1, nullptr },
+        { "a012_leftArmFB", field_type::s16, offsetof(T, a012_leftArmFB), 2, 1, nullptr },
+        { "a013_rightArmIO", field_type::s16, offsetof(T, a013_rightArmIO), 2, 1, nullptr },
+        { "a013_rightArmFB", field_type::s16, offsetof(T, a013_rightArmFB), 2, 1, nullptr },
+        { "a013_leftArmIO", field_type::s16, offsetof(T, a013_leftArmIO), 2, 1, nullptr },
+        { "a013_leftArmFB", field_type::s16, offsetof(T, a013_leftArmFB), 2, 1, nullptr },
+        { "a014_rightArmIO", field_type::s16, offsetof(T, a014_rightArmIO), 2, 1, nullptr },
+        { "a014_rightArmFB", field_type::s16, offsetof(T, a014_rightArmFB), 2, 1, nullptr },
+        { "a014_leftArmIO", field_type::s16, offsetof(T, a014_leftArmIO), 2, 1, nullptr },
+        { "a014_leftArmFB", field_type::s16, offsetof(T, a014_leftArmFB), 2, 1, nullptr },
+        { "a015_rightArmIO", field_type::s16, offsetof(T, a015_rightArmIO), 2, 1, nullptr },
+        { "a015_rightArmFB", field_type::s16, offsetof(T, a015_rightArmFB), 2, 1, nullptr },
+        { "a015_leftArmIO", field_type::s16, offsetof(T, a015_leftArmIO), 2, 1, nullptr },
+        { "a015_leftArmFB", field_type::s16, offsetof(T, a015_leftArmFB), 2, 1, nullptr },
+        { "a016_rightArmIO", field_type::s16, offsetof(T, a016_rightArmIO), 2, 1, nullptr },
+        { "a016_rightArmFB", field_type::s16, offsetof(T, a016_rightArmFB), 2, 1, nullptr },
+        { "a016_leftArmIO", field_type::s16, offsetof(T, a016_leftArmIO), 2, 1, nullptr },
+        { "a016_leftArmFB", field_type::s16, offsetof(T, a016_leftArmFB), 2, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a000_rightArmIO) == 0);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a000_rightArmFB) == 2);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a000_leftArmIO) == 4);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a000_leftArmFB) == 6);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a002_rightArmIO) == 8);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a002_rightArmFB) == 10);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a002_leftArmIO) == 12);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a002_leftArmFB) == 14);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a003_rightArmIO) == 16);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a003_rightArmFB) == 18);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a003_leftArmIO) == 20);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a003_leftArmFB) == 22);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a010_rightArmIO) == 24);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a010_rightArmFB) == 26);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a010_leftArmIO) == 28);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a010_leftArmFB) == 30);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a012_rightArmIO) == 32);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a012_rightArmFB) == 34);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a012_leftArmIO) == 36);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a012_leftArmFB) == 38);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a013_rightArmIO) == 40);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a013_rightArmFB) == 42);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a013_leftArmIO) == 44);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a013_leftArmFB) == 46);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a014_rightArmIO) == 48);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a014_rightArmFB) == 50);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a014_leftArmIO) == 52);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a014_leftArmFB) == 54);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a015_rightArmIO) == 56);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a015_rightArmFB) == 58);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a015_leftArmIO) == 60);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a015_leftArmFB) == 62);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a016_rightArmIO) == 64);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a016_rightArmFB) == 66);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a016_leftArmIO) == 68);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, a016_leftArmFB) == 70);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_PRO_ST, pad) == 72);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,42 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../POSTURE_CONTROL_PARAM_WEP_LEFT_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST> {
+    using T = paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST;
+
+    static constexpr std::array<field_descriptor, 10> fields = {{
+        { "a000_leftArmFB", field_type::s16, offsetof(T, a000_leftArmFB), 2, 1, nullptr },
+        { "a000_leftWristFB", field_type::s16, offsetof(T, a000_leftWristFB), 2, 1, nullptr },
+        { "a000_leftWristIO", field_type::s16, offsetof(T, a000_leftWristIO), 2, 1, nullptr },
+        { "a002_leftArmFB", field_type::s16, offsetof(T, a002_leftArmFB), 2, 1, nullptr },
+        { "a002_leftWristFB", field_type::s16, offsetof(T, a002_leftWristFB), 2, 1, nullptr },
+        { "a002_leftWristIO", field_type::s16, offsetof(T, a002_leftWristIO), 2, 1, nullptr },
+        { "a003_leftArmFB", field_type::s16, offsetof(T, a003_leftArmFB), 2, 1, nullptr },
+        { "a003_leftWristFB", field_type::s16, offsetof(T, a003_leftWristFB), 2, 1, nullptr },
+        { "a003_leftWristIO", field_type::s16, offsetof(T, a003_leftWristIO), 2, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 14, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST, a000_leftArmFB) == 0);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST, a000_leftWristFB) == 2);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST, a000_leftWristIO) == 4);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST, a002_leftArmFB) == 6);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST, a002_leftWristFB) == 8);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST, a002_leftWristIO) == 10);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST, a003_leftArmFB) == 12);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST, a003_leftWristFB) == 14);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST, a003_leftWristIO) == 16);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_LEFT_ST, pad) == 18);
+
+}; // namespace params
+}; // namespace from
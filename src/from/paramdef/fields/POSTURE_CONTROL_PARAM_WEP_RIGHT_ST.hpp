@@ -0,0 +1,132 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../POSTURE_CONTROL_PARAM_WEP_RIGHT_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST> {
+    using T = paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST;
+
+    static constexpr std::array<field_descriptor, 55> fields = {{
+        { "a000_rightArmFB", field_type::s16, offsetof(T, a000_rightArmFB), 2, 1, nullptr },
+        { "a000_rightWristFB", field_type::s16, offsetof(T, a000_rightWristFB), 2, 1, nullptr },
+        { "a000_rightWristIO", field_type::s16, offsetof(T, a000_rightWristIO), 2, 1, nullptr },
+        { "a000_leftArmFB", field_type::s16, offsetof(T, a000_leftArmFB), 2, 1, nullptr },
+        { "a000_leftWristFB", field_type::s16, offsetof(T, a000_leftWristFB), 2, 1, nullptr },
+        { "a000_leftWristIO", field_type::s16, offsetof(T, a000_leftWristIO), 2, 1, nullptr },
+        { "a002_rightArmFB", field_type::s16, offsetof(T, a002_rightArmFB), 2, 1, nullptr },
+        { "a002_rightWristFB", field_type::s16, offsetof(T, a002_rightWristFB), 2, 1, nullptr },
+        { "a002_rightWristIO", field_type::s16, offsetof(T, a002_rightWristIO), 2, 1, nullptr },
+        { "a002_leftArmFB", field_type::s16, offsetof(T, a002_leftArmFB), 2, 1, nullptr },
+        { "a002_leftWristFB", field_type::s16, offsetof(T, a002_leftWristFB), 2, 1, nullptr },
+        { "a002_leftWristIO", field_type::s16, offsetof(T, a002_leftWristIO), 2, 1, nullptr },
+        { "a003_rightArmFB", field_type::s16, offsetof(T, a003_rightArmFB), 2, 1, nullptr },
+        { "a003_rightWristFB", field_type::s16, offsetof(T, a003_rightWristFB), 2, 1, nullptr },
+        { "a003_rightWristIO", field_type::s16, offsetof(T, a003_rightWristIO), 2, 1, nullptr },
+        { "a003_leftArmFB", field_type::s16, offsetof(T, a003_leftArmFB), 2, 1, nullptr },
+        { "a003_leftWristFB", field_type::s16, offsetof(T, a003_leftWristFB), 2, 1, nullptr },
+        { "a003_leftWristIO", field_type::s16, offsetof(T, a003_leftWristIO), 2, 1, nullptr },
+        { "a010_rightArmFB", field_type::s16, offsetof(T, a010_rightArmFB), 2, 1, nullptr },
+        { "a010_rightWristFB", field_type::s16, offsetof(T, a010_rightWristFB), 2, 1, nullptr },
+        { "a010_rightWristIO", field_type::s16, offsetof(T, a010_rightWristIO), 2, 1, nullptr },
+        { "a010_leftArmFB", field_type::s16, offsetof(T, a010_leftArmFB), 2, 1, nullptr },
+        { "a010_leftWristFB", field_type::s16, offsetof(T, a010_leftWristFB), 2, 1, nullptr },
+        { "a010_leftWristIO", field_type::s16, offsetof(T, a010_leftWristIO), 2, 1, nullptr },
+        { "a012_rightArmFB", field_type::s16, offsetof(T, a012_rightArmFB), 2, 1, nullptr },
+        { "a012_rightWristFB", field_type::s16, offsetof(T, a012_rightWristFB), 2, 1, nullptr },
+        { "a012_rightWristIO", field_type::s16, offsetof(T, a012_rightWristIO), 2, 1, nullptr },
+        { "a012_leftArmFB", field_type::s16, offsetof(T, a012_leftArmFB), 2, 1, nullptr },
+        { "a012_leftWristFB", field_type::s16, offsetof(T, a012_leftWristFB), 2, 1, nullptr },
+        { "a012_leftWristIO", field_type::s16, offsetof(T, a012_leftWristIO), 2, 1, nullptr },
+        { "a013_rightArmFB", field_type::s16, offsetof(T, a013_rightArmFB), 2, 1, nullptr },
+        { "a013_rightWristFB", field_type::s16, offsetof(T, a013_rightWristFB), 2, 1, nullptr },
+        { "a013_rightWristIO", field_type::s16, offsetof(T, a013_rightWristIO), 2, 1, nullptr },
+        { "a013_leftArmFB", field_type::s16, offsetof(T, a013_leftArmFB), 2, 1, nullptr },
+        { "a013_leftWristFB", field_type::s16, offsetof(T, a013_leftWristFB), 2, 1, nullptr },
+        { "a013_leftWristIO", field_type::s16, offsetof(T, a013_leftWristIO), 2, 1, nullptr },
+        { "a014_rightArmFB", field_type::s16, offsetof(T, a014_rightArmFB), 2, 1, nullptr },
+        { "a014_rightWristFB", field_type::s16, offsetof(T, a014_rightWristFB), 2, 1, nullptr },
+        { "a014_rightWristIO", field_type::s16, offsetof(T, a014_rightWristIO), 2, 1, nullptr },
+        { "a014_leftArmFB", field_type::s16, offsetof(T, a014_leftArmFB), 2, 1, nullptr },
+        { "a014_leftWristFB", field_type::s16, offsetof(T, a014_leftWristFB), 2, 1, nullptr },
+        { "a014_leftWristIO", field_type::s16, offsetof(T, a014_leftWristIO), 2, 1, nullptr },
+        { "a015_rightArmFB", field_type::s16, offsetof(T, a015_rightArmFB), 2, 1, nullptr },
+        { "a015_rightWristFB", field_type::s16, offsetof(T, a015_rightWristFB), 2, 1, nullptr },
+        { "a015_rightWristIO", field_type::s16, offsetof(T, a015_rightWristIO), 2, 1, nullptr },
+        { "a015_leftArmFB", field_type::s16, offsetof(T, a015_leftArmFB), 2, 1, nullptr },
+        { "a015_leftWristFB", field_type::s16, offsetof(T, a015_leftWristFB), 2, 1, nullptr },
+        { "a015_leftWristIO", field_type::s16, offsetof(T, a015_leftWristIO), 2, 1, nullptr },
+        { "a016_rightArmFB", field_type::s16, offsetof(T, a016_rightArmFB), 2, 1, nullptr },
+        { "a016_rightWristFB", field_type::s16, offsetof(T, a016_rightWristFB), 2, 1, nullptr },
+        { "a016_rightWristIO", field_type::s16, offsetof(T, a016_rightWristIO), 2, 1, nullptr },
+        { "a016_leftArmFB", field_type::s16, offsetof(T, a016_leftArmFB), 2, 1, nullptr },
+        { "a016_leftWristFB", field_type::s16, offsetof(T, a016_leftWristFB), 2, 1, nullptr },
+        { "a016_leftWristIO", field_type::s16, offsetof(T, a016_leftWristIO), 2, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a000_rightArmFB) == 0);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a000_rightWristFB) == 2);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a000_rightWristIO) == 4);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a000_leftArmFB) == 6);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a000_leftWristFB) == 8);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a000_leftWristIO) == 10);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a002_rightArmFB) == 12);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a002_rightWristFB) == 14);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a002_rightWristIO) == 16);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a002_leftArmFB) == 18);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a002_leftWristFB) == 20);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a002_leftWristIO) == 22);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a003_rightArmFB) == 24);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a003_rightWristFB) == 26);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a003_rightWristIO) == 28);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a003_leftArmFB) == 30);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a003_leftWristFB) == 32);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a003_leftWristIO) == 34);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a010_rightArmFB) == 36);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a010_rightWristFB) == 38);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a010_rightWristIO) == 40);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a010_leftArmFB) == 42);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a010_leftWristFB) == 44);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a010_leftWristIO) == 46);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a012_rightArmFB) == 48);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a012_rightWristFB) == 50);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a012_rightWristIO) == 52);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a012_leftArmFB) == 54);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a012_leftWristFB) == 56);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a012_leftWristIO) == 58);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a013_rightArmFB) == 60);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a013_rightWristFB) == 62);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a013_rightWristIO) == 64);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a013_leftArmFB) == 66);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a013_leftWristFB) == 68);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a013_leftWristIO) == 70);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a014_rightArmFB) == 72);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a014_rightWristFB) == 74);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a014_rightWristIO) == 76);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a014_leftArmFB) == 78);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a014_leftWristFB) == 80);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a014_leftWristIO) == 82);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a015_rightArmFB) == 84);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a015_rightWristFB) == 86);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a015_rightWristIO) == 88);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a015_leftArmFB) == 90);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a015_leftWristFB) == 92);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a015_leftWristIO) == 94);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a016_rightArmFB) == 96);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a016_rightWristFB) == 98);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a016_rightWristIO) == 100);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a016_leftArmFB) == 102);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a016_leftWristFB) == 104);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, a016_leftWristIO) == 106);
+static_assert(offsetof(paramdef::POSTURE_CONTROL_PARAM_WEP_RIGHT_ST, pad) == 108);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,120 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../RANDOM_APPEAR_EDIT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::RANDOM_APPEAR_EDIT_PARAM_ST> {
+    using T = paramdef::RANDOM_APPEAR_EDIT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 49> fields = {{
+        { "appearNum", field_type::u32, offsetof(T, appearNum), 4, 1, nullptr },
+        { "paramId1", field_type::s32, offsetof(T, paramId1), 4, 1, nullptr },
+        { "rate1", field_type::u32, offsetof(T, rate1), 4, 1, nullptr },
+        { "paramId2", field_type::s32, offsetof(T, paramId2), 4, 1, nullptr },
+        { "rate2", field_type::u32, offsetof(T, rate2), 4, 1, nullptr },
+        { "paramId3", field_type::s32, offsetof(T, paramId3), 4, 1, nullptr },
+        { "rate3", field_type::u32, offsetof(T, rate3), 4, 1, nullptr },
+        { "paramId4", field_type::s32, offsetof(T, paramId4), 4, 1, nullptr },
+        { "rate4", field_type::u32, offsetof(T, rate4), 4, 1, nullptr },
+        { "paramId5", field_type::s32, offsetof(T, paramId5), 4, 1, nullptr },
+        { "rate5", field_type::u32, offsetof(T, rate5), 4, 1, nullptr },
+        { "paramId6", field_type::s32, offsetof(T, paramId6), 4, 1, nullptr },
+        { "rate6", field_type::u32, offsetof(T, rate6), 4, 1, nullptr },
+        { "paramId7", field_type::s32, offsetof(T, paramId7), 4, 1, nullptr },
+        { "rate7", field_type::u32, offsetof(T, rate7), 4, 1, nullptr },
+        { "paramId8", field_type::s32, offsetof(T, paramId8), 4, 1, nullptr },
+        { "rate8", field_type::u32, offsetof(T, rate8), 4, 1, nullptr },
+        { "paramId9", field_type::s32, offsetof(T, paramId9), 4, 1, nullptr },
+        { "rate9", field_type::u32, offsetof(T, rate9), 4, 1, nullptr },
+        { "paramId10", field_type::s32, offsetof(T, paramId10), 4, 1, nullptr },
+        { "rate10", field_type::u32, offsetof(T, rate10), 4, 1, nullptr },
+        { "paramId11", field_type::s32, offsetof(T, paramId11), 4, 1, nullptr },
+        { "rate11", field_type::u32, offsetof(T, rate11), 4, 1, nullptr },
+        { "paramId12", field_type::s32, offsetof(T, paramId12), 4, 1, nullptr },
+        { "rate12", field_type::u32, offsetof(T, rate12), 4, 1, nullptr },
+        { "paramId13", field_type::s32, offsetof(T, paramId13), 4, 1, nullptr },
+        { "rate13", field_type::u32, offsetof(T, rate13), 4, 1, nullptr },
+        { "paramId14", field_type::s32, offsetof(T, paramId14), 4, 1, nullptr },
+        { "rate14", field_type::u32, offsetof(T, rate14), 4, 1, nullptr },
+        { "paramId15", field_type::s32, offsetof(T, paramId15), 4, 1, nullptr },
+        { "rate15", field_type::u32, offsetof(T, rate15), 4, 1, nullptr },
+        { "paramId16", field_type::s32, offsetof(T, paramId16), 4, 1, nullptr },
+        { "rate16", field_type::u32, offsetof(T, rate16), 4, 1, nullptr },
+        { "paramId17", field_type::s32, offsetof(T, paramId17), 4, 1, nullptr },
+        { "rate17", field_type::u32, offsetof(T, rate17), 4, 1, nullptr },
+        { "paramId18", field_type::s32, offsetof(T, paramId18), 4, 1, nullptr },
+        { "rate18", field_type::u32, offsetof(T, rate18), 4, 1, nullptr },
+        { "paramId19", field_type::s32, offsetof(T, paramId19), 4, 1, nullptr },
+        { "rate19", field_type::u32, offsetof(T, rate19), 4, 1, nullptr },
+        { "paramId20", field_type::s32, offsetof(T, paramId20), 4, 1, nullptr },
+        { "rate20", field_type::u32, offsetof(T, rate20), 4, 1, nullptr },
+        { "paramId21", field_type::s32, offsetof(T, paramId21), 4, 1, nullptr },
+        { "rate21", field_type::u32, offsetof(T, rate21), 4, 1, nullptr },
+        { "paramId22", field_type::s32, offsetof(T, paramId22), 4, 1, nullptr },
+        { "rate22", field_type::u32, offsetof(T, rate22), 4, 1, nullptr },
+        { "paramId23", field_type::s32, offsetof(T, paramId23), 4, 1, nullptr },
+        { "rate23", field_type::u32, offsetof(T, rate23), 4, 1, nullptr },
+        { "paramId24", field_type::s32, offsetof(T, paramId24), 4, 1, nullptr },
+        { "rate24", field_type::u32, offsetof(T, rate24), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, appearNum) == 0);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId1) == 4);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate1) == 8);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId2) == 12);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate2) == 16);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId3) == 20);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate3) == 24);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId4) == 28);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate4) == 32);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId5) == 36);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate5) == 40);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId6) == 44);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate6) == 48);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId7) == 52);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate7) == 56);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId8) == 60);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate8) == 64);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId9) == 68);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate9) == 72);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId10) == 76);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate10) == 80);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId11) == 84);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate11) == 88);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId12) == 92);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate12) == 96);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId13) == 100);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate13) == 104);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId14) == 108);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate14) == 112);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId15) == 116);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate15) == 120);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId16) == 124);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate16) == 128);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId17) == 132);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate17) == 136);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId18) == 140);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate18) == 144);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId19) == 148);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate19) == 152);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId20) == 156);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate20) == 160);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId21) == 164);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate21) == 168);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId22) == 172);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate22) == 176);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId23) == 180);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate23) == 184);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, paramId24) == 188);
+static_assert(offsetof(paramdef::RANDOM_APPEAR_EDIT_PARAM_ST, rate24) == 192);
+
+}; // namespace params
+}; // namespace from
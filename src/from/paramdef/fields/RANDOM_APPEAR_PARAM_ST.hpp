@@ -0,0 +1,123 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../RANDOM_APPEAR_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::RANDOM_APPEAR_PARAM_ST> {
+    using T = paramdef::RANDOM_APPEAR_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 101> fields = {{
+        { "slot0", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot0; } },
+        { "slot1", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot1; } },
+        { "slot2", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot2; } },
+        { "slot3", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot3; } },
+        { "slot4", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot4; } },
+        { "slot5", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot5; } },
+        { "slot6", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot6; } },
+        { "slot7", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot7; } },
+        { "slot8", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot8; } },
+        { "slot9", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot9; } },
+        { "slot10", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot10; } },
+        { "slot11", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot11; } },
+        { "slot12", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot12; } },
+        { "slot13", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot13; } },
+        { "slot14", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot14; } },
+        { "slot15", field_type::boolean, 1, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot15; } },
+        { "slot16", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot16; } },
+        { "slot17", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot17; } },
+        { "slot18", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot18; } },
+        { "slot19", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot19; } },
+        { "slot20", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot20; } },
+        { "slot21", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot21; } },
+        { "slot22", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot22; } },
+        { "slot23", field_type::boolean, 2, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot23; } },
+        { "slot24", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot24; } },
+        { "slot25", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot25; } },
+        { "slot26", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot26; } },
+        { "slot27", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot27; } },
+        { "slot28", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot28; } },
+        { "slot29", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot29; } },
+        { "slot30", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot30; } },
+        { "slot31", field_type::boolean, 3, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot31; } },
+        { "slot32", field_type::boolean, 4, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot32; } },
+        { "slot33", field_type::boolean, 4, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot33; } },
+        { "slot34", field_type::boolean, 4, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot34; } },
+        { "slot35", field_type::boolean, 4, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot35; } },
+        { "slot36", field_type::boolean, 4, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot36; } },
+        { "slot37", field_type::boolean, 4, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot37; } },
+        { "slot38", field_type::boolean, 4, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot38; } },
+        { "slot39", field_type::boolean, 4, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot39; } },
+        { "slot40", field_type::boolean, 5, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot40; } },
+        { "slot41", field_type::boolean, 5, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot41; } },
+        { "slot42", field_type::boolean, 5, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot42; } },
+        { "slot43", field_type::boolean, 5, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot43; } },
+        { "slot44", field_type::boolean, 5, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot44; } },
+        { "slot45", field_type::boolean, 5, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot45; } },
+        { "slot46", field_type::boolean, 5, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot46; } },
+        { "slot47", field_type::boolean, 5, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot47; } },
+        { "slot48", field_type::boolean, 6, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot48; } },
+        { "slot49", field_type::boolean, 6, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot49; } },
+        { "slot50", field_type::boolean, 6, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot50; } },
+        { "slot51", field_type::boolean, 6, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot51; } },
+        { "slot52", field_type::boolean, 6, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot52; } },
+        { "slot53", field_type::boolean, 6, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot53; } },
+        { "slot54", field_type::boolean, 6, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot54; } },
+        { "slot55", field_type::boolean, 6, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot55; } },
+        { "slot56", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot56; } },
+        { "slot57", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot57; } },
+        { "slot58", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot58; } },
+        { "slot59", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot59; } },
+        { "slot60", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot60; } },
+        { "slot61", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot61; } },
+        { "slot62", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot62; } },
+        { "slot63", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot63; } },
+        { "slot64", field_type::boolean, 8, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot64; } },
+        { "slot65", field_type::boolean, 8, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot65; } },
+        { "slot66", field_type::boolean, 8, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot66; } },
+        { "slot67", field_type::boolean, 8, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot67; } },
+        { "slot68", field_type::boolean, 8, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot68; } },
+        { "slot69", field_type::boolean, 8, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot69; } },
+        { "slot70", field_type::boolean, 8, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot70; } },
+        { "slot71", field_type::boolean, 8, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot71; } },
+        { "slot72", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot72; } },
+        { "slot73", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot73; } },
+        { "slot74", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot74; } },
+        { "slot75", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot75; } },
+        { "slot76", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot76; } },
+        { "slot77", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot77; } },
+        { "slot78", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot78; } },
+        { "slot79", field_type::boolean, 9, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot79; } },
+        { "slot80", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot80; } },
+        { "slot81", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot81; } },
+        { "slot82", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot82; } },
+        { "slot83", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot83; } },
+        { "slot84", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot84; } },
+        { "slot85", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot85; } },
+        { "slot86", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot86; } },
+        { "slot87", field_type::boolean, 10, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot87; } },
+        { "slot88", field_type::boolean, 11, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot88; } },
+        { "slot89", field_type::boolean, 11, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot89; } },
+        { "slot90", field_type::boolean, 11, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot90; } },
+        { "slot91", field_type::boolean, 11, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot91; } },
+        { "slot92", field_type::boolean, 11, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot92; } },
+        { "slot93", field_type::boolean, 11, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot93; } },
+        { "slot94", field_type::boolean, 11, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot94; } },
+        { "slot95", field_type::boolean, 11, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot95; } },
+        { "slot96", field_type::boolean, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot96; } },
+        { "slot97", field_type::boolean, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot97; } },
+        { "slot98", field_type::boolean, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot98; } },
+        { "slot99", field_type::boolean, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->slot99; } },
+        { "pad", field_type::u8, 12, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad; } },
+    }};
+};
+
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,60 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../REINFORCE_PARAM_PROTECTOR_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::REINFORCE_PARAM_PROTECTOR_ST> {
+    using T = paramdef::REINFORCE_PARAM_PROTECTOR_ST;
+
+    static constexpr std::array<field_descriptor, 19> fields = {{
+        { "physicsDefRate", field_type::f32, offsetof(T, physicsDefRate), 4, 1, nullptr },
+        { "magicDefRate", field_type::f32, offsetof(T, magicDefRate), 4, 1, nullptr },
+        { "fireDefRate", field_type::f32, offsetof(T, fireDefRate), 4, 1, nullptr },
+        { "thunderDefRate", field_type::f32, offsetof(T, thunderDefRate), 4, 1, nullptr },
+        { "slashDefRate", field_type::f32, offsetof(T, slashDefRate), 4, 1, nullptr },
+        { "blowDefRate", field_type::f32, offsetof(T, blowDefRate), 4, 1, nullptr },
+        { "thrustDefRate", field_type::f32, offsetof(T, thrustDefRate), 4, 1, nullptr },
+        { "resistPoisonRate", field_type::f32, offsetof(T, resistPoisonRate), 4, 1, nullptr },
+        { "resistDiseaseRate", field_type::f32, offsetof(T, resistDiseaseRate), 4, 1, nullptr },
+        { "resistBloodRate", field_type::f32, offsetof(T, resistBloodRate), 4, 1, nullptr },
+        { "resistCurseRate", field_type::f32, offsetof(T, resistCurseRate), 4, 1, nullptr },
+        { "residentSpEffectId1", field_type::u8, offsetof(T, residentSpEffectId1), 1, 1, nullptr },
+        { "residentSpEffectId2", field_type::u8, offsetof(T, residentSpEffectId2), 1, 1, nullptr },
+        { "residentSpEffectId3", field_type::u8, offsetof(T, residentSpEffectId3), 1, 1, nullptr },
+        { "materialSetId", field_type::u8, offsetof(T, materialSetId), 1, 1, nullptr },
+        { "darkDefRate", field_type::f32, offsetof(T, darkDefRate), 4, 1, nullptr },
+        { "resistFreezeRate", field_type::f32, offsetof(T, resistFreezeRate), 4, 1, nullptr },
+        { "resistSleepRate", field_type::f32, offsetof(T, resistSleepRate), 4, 1, nullptr },
+        { "resistMadnessRate", field_type::f32, offsetof(T, resistMadnessRate), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, physicsDefRate) == 0);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, magicDefRate) == 4);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, fireDefRate) == 8);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, thunderDefRate) == 12);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, slashDefRate) == 16);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, blowDefRate) == 20);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, thrustDefRate) == 24);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, resistPoisonRate) == 28);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, resistDiseaseRate) == 32);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, resistBloodRate) == 36);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, resistCurseRate) == 40);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, residentSpEffectId1) == 44);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, residentSpEffectId2) == 45);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, residentSpEffectId3) == 46);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, materialSetId) == 47);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, darkDefRate) == 48);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, resistFreezeRate) == 52);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, resistSleepRate) == 56);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_PROTECTOR_ST, resistMadnessRate) == 60);
+
+}; // namespace params
+}; // namespace from
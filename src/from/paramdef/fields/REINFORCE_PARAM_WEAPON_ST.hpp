@@ -0,0 +1,100 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../REINFORCE_PARAM_WEAPON_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::REINFORCE_PARAM_WEAPON_ST> {
+    using T = paramdef::REINFORCE_PARAM_WEAPON_ST;
+
+    static constexpr std::array<field_descriptor, 39> fields = {{
+        { "physicsAtkRate", field_type::f32, offsetof(T, physicsAtkRate), 4, 1, nullptr },
+        { "magicAtkRate", field_type::f32, offsetof(T, magicAtkRate), 4, 1, nullptr },
+        { "fireAtkRate", field_type::f32, offsetof(T, fireAtkRate), 4, 1, nullptr },
+        { "thunderAtkRate", field_type::f32, offsetof(T, thunderAtkRate), 4, 1, nullptr },
+        { "staminaAtkRate", field_type::f32, offsetof(T, staminaAtkRate), 4, 1, nullptr },
+        { "saWeaponAtkRate", field_type::f32, offsetof(T, saWeaponAtkRate), 4, 1, nullptr },
+        { "saDurabilityRate", field_type::f32, offsetof(T, saDurabilityRate), 4, 1, nullptr },
+        { "correctStrengthRate", field_type::f32, offsetof(T, correctStrengthRate), 4, 1, nullptr },
+        { "correctAgilityRate", field_type::f32, offsetof(T, correctAgilityRate), 4, 1, nullptr },
+        { "correctMagicRate", field_type::f32, offsetof(T, correctMagicRate), 4, 1, nullptr },
+        { "correctFaithRate", field_type::f32, offsetof(T, correctFaithRate), 4, 1, nullptr },
+        { "physicsGuardCutRate", field_type::f32, offsetof(T, physicsGuardCutRate), 4, 1, nullptr },
+        { "magicGuardCutRate", field_type::f32, offsetof(T, magicGuardCutRate), 4, 1, nullptr },
+        { "fireGuardCutRate", field_type::f32, offsetof(T, fireGuardCutRate), 4, 1, nullptr },
+        { "thunderGuardCutRate", field_type::f32, offsetof(T, thunderGuardCutRate), 4, 1, nullptr },
+        { "poisonGuardResistRate", field_type::f32, offsetof(T, poisonGuardResistRate), 4, 1, nullptr },
+        { "diseaseGuardResistRate", field_type::f32, offsetof(T, diseaseGuardResistRate), 4, 1, nullptr },
+        { "bloodGuardResistRate", field_type::f32, offsetof(T, bloodGuardResistRate), 4, 1, nullptr },
+        { "curseGuardResistRate", field_type::f32, offsetof(T, curseGuardResistRate), 4, 1, nullptr },
+        { "staminaGuardDefRate", field_type::f32, offsetof(T, staminaGuardDefRate), 4, 1, nullptr },
+        { "spEffectId1", field_type::u8, offsetof(T, spEffectId1), 1, 1, nullptr },
+        { "spEffectId2", field_type::u8, offsetof(T, spEffectId2), 1, 1, nullptr },
+        { "spEffectId3", field_type::u8, offsetof(T, spEffectId3), 1, 1, nullptr },
+        { "residentSpEffectId1", field_type::u8, offsetof(T, residentSpEffectId1), 1, 1, nullptr },
+        { "residentSpEffectId2", field_type::u8, offsetof(T, residentSpEffectId2), 1, 1, nullptr },
+        { "residentSpEffectId3", field_type::u8, offsetof(T, residentSpEffectId3), 1, 1, nullptr },
+        { "materialSetId", field_type::u8, offsetof(T, materialSetId), 1, 1, nullptr },
+        { "maxReinforceLevel", field_type::u8, offsetof(T, maxReinforceLevel), 1, 1, nullptr },
+        { "darkAtkRate", field_type::f32, offsetof(T, darkAtkRate), 4, 1, nullptr },
+        { "darkGuardCutRate", field_type::f32, offsetof(T, darkGuardCutRate), 4, 1, nullptr },
+        { "correctLuckRate", field_type::f32, offsetof(T, correctLuckRate), 4, 1, nullptr },
+        { "freezeGuardDefRate", field_type::f32, offsetof(T, freezeGuardDefRate), 4, 1, nullptr },
+        { "reinforcePriceRate", field_type::f32, offsetof(T, reinforcePriceRate), 4, 1, nullptr },
+        { "baseChangePriceRate", field_type::f32, offsetof(T, baseChangePriceRate), 4, 1, nullptr },
+        { "enableGemRank", field_type::s8, offsetof(T, enableGemRank), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 3, nullptr },
+        { "sleepGuardDefRate", field_type::f32, offsetof(T, sleepGuardDefRate), 4, 1, nullptr },
+        { "madnessGuardDefRate", field_type::f32, offsetof(T, madnessGuardDefRate), 4, 1, nullptr },
+        { "baseAtkRate", field_type::f32, offsetof(T, baseAtkRate), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, physicsAtkRate) == 0);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, magicAtkRate) == 4);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, fireAtkRate) == 8);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, thunderAtkRate) == 12);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, staminaAtkRate) == 16);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, saWeaponAtkRate) == 20);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, saDurabilityRate) == 24);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, correctStrengthRate) == 28);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, correctAgilityRate) == 32);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, correctMagicRate) == 36);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, correctFaithRate) == 40);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, physicsGuardCutRate) == 44);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, magicGuardCutRate) == 48);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, fireGuardCutRate) == 52);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, thunderGuardCutRate) == 56);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, poisonGuardResistRate) == 60);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, diseaseGuardResistRate) == 64);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, bloodGuardResistRate) == 68);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, curseGuardResistRate) == 72);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, staminaGuardDefRate) == 76);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, spEffectId1) == 80);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, spEffectId2) == 81);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, spEffectId3) == 82);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, residentSpEffectId1) == 83);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, residentSpEffectId2) == 84);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, residentSpEffectId3) == 85);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, materialSetId) == 86);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, maxReinforceLevel) == 87);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, darkAtkRate) == 88);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, darkGuardCutRate) == 92);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, correctLuckRate) == 96);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, freezeGuardDefRate) == 100);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, reinforcePriceRate) == 104);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, baseChangePriceRate) == 108);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, enableGemRank) == 112);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, pad2) == 113);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, sleepGuardDefRate) == 116);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, madnessGuardDefRate) == 120);
+static_assert(offsetof(paramdef::REINFORCE_PARAM_WEAPON_ST, baseAtkRate) == 124);
+
+}; // namespace params
+}; // namespace from
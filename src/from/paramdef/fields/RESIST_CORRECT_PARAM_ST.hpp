@@ -0,0 +1,42 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../RESIST_CORRECT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::RESIST_CORRECT_PARAM_ST> {
+    using T = paramdef::RESIST_CORRECT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 10> fields = {{
+        { "addPoint1", field_type::f32, offsetof(T, addPoint1), 4, 1, nullptr },
+        { "addPoint2", field_type::f32, offsetof(T, addPoint2), 4, 1, nullptr },
+        { "addPoint3", field_type::f32, offsetof(T, addPoint3), 4, 1, nullptr },
+        { "addPoint4", field_type::f32, offsetof(T, addPoint4), 4, 1, nullptr },
+        { "addPoint5", field_type::f32, offsetof(T, addPoint5), 4, 1, nullptr },
+        { "addRate1", field_type::f32, offsetof(T, addRate1), 4, 1, nullptr },
+        { "addRate2", field_type::f32, offsetof(T, addRate2), 4, 1, nullptr },
+        { "addRate3", field_type::f32, offsetof(T, addRate3), 4, 1, nullptr },
+        { "addRate4", field_type::f32, offsetof(T, addRate4), 4, 1, nullptr },
+        { "addRate5", field_type::f32, offsetof(T, addRate5), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::RESIST_CORRECT_PARAM_ST, addPoint1) == 0);
+static_assert(offsetof(paramdef::RESIST_CORRECT_PARAM_ST, addPoint2) == 4);
+static_assert(offsetof(paramdef::RESIST_CORRECT_PARAM_ST, addPoint3) == 8);
+static_assert(offsetof(paramdef::RESIST_CORRECT_PARAM_ST, addPoint4) == 12);
+static_assert(offsetof(paramdef::RESIST_CORRECT_PARAM_ST, addPoint5) == 16);
+static_assert(offsetof(paramdef::RESIST_CORRECT_PARAM_ST, addRate1) == 20);
+static_assert(offsetof(paramdef::RESIST_CORRECT_PARAM_ST, addRate2) == 24);
+static_assert(offsetof(paramdef::RESIST_CORRECT_PARAM_ST, addRate3) == 28);
+static_assert(offsetof(paramdef::RESIST_CORRECT_PARAM_ST, addRate4) == 32);
+static_assert(offsetof(paramdef::RESIST_CORRECT_PARAM_ST, addRate5) == 36);
+
+}; // namespace params
+}; // namespace from
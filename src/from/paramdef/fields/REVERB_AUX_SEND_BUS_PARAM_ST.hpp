@@ -0,0 +1,24 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../REVERB_AUX_SEND_BUS_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::REVERB_AUX_SEND_BUS_PARAM_ST> {
+    using T = paramdef::REVERB_AUX_SEND_BUS_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 1> fields = {{
+        { "ReverbAuxSendBusName", field_type::character, offsetof(T, ReverbAuxSendBusName), 1, 32, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::REVERB_AUX_SEND_BUS_PARAM_ST, ReverbAuxSendBusName) == 0);
+
+}; // namespace params
+}; // namespace from
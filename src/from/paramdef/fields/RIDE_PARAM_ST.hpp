@@ -0,0 +1,50 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../RIDE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::RIDE_PARAM_ST> {
+    using T = paramdef::RIDE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 14> fields = {{
+        { "atkChrId", field_type::u32, offsetof(T, atkChrId), 4, 1, nullptr },
+        { "defChrId", field_type::u32, offsetof(T, defChrId), 4, 1, nullptr },
+        { "rideCamParamId", field_type::s32, offsetof(T, rideCamParamId), 4, 1, nullptr },
+        { "atkChrAnimId", field_type::u32, offsetof(T, atkChrAnimId), 4, 1, nullptr },
+        { "defChrAnimId", field_type::u32, offsetof(T, defChrAnimId), 4, 1, nullptr },
+        { "defAdjustDmyId", field_type::s32, offsetof(T, defAdjustDmyId), 4, 1, nullptr },
+        { "defCheckDmyId", field_type::s32, offsetof(T, defCheckDmyId), 4, 1, nullptr },
+        { "diffAngMyToDef", field_type::f32, offsetof(T, diffAngMyToDef), 4, 1, nullptr },
+        { "dist", field_type::f32, offsetof(T, dist), 4, 1, nullptr },
+        { "upperYRange", field_type::f32, offsetof(T, upperYRange), 4, 1, nullptr },
+        { "lowerYRange", field_type::f32, offsetof(T, lowerYRange), 4, 1, nullptr },
+        { "diffAngMin", field_type::f32, offsetof(T, diffAngMin), 4, 1, nullptr },
+        { "diffAngMax", field_type::f32, offsetof(T, diffAngMax), 4, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 12, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, atkChrId) == 0);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, defChrId) == 4);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, rideCamParamId) == 8);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, atkChrAnimId) == 12);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, defChrAnimId) == 16);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, defAdjustDmyId) == 20);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, defCheckDmyId) == 24);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, diffAngMyToDef) == 28);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, dist) == 32);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, upperYRange) == 36);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, lowerYRange) == 40);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, diffAngMin) == 44);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, diffAngMax) == 48);
+static_assert(offsetof(paramdef::RIDE_PARAM_ST, pad) == 52);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,86 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../ROLE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::ROLE_PARAM_ST> {
+    using T = paramdef::ROLE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 32> fields = {{
+        { "teamType", field_type::u8, offsetof(T, teamType), 1, 1, nullptr },
+        { "pad10", field_type::u8, offsetof(T, pad10), 1, 3, nullptr },
+        { "phantomParamId", field_type::s32, offsetof(T, phantomParamId), 4, 1, nullptr },
+        { "spEffectID0", field_type::s32, offsetof(T, spEffectID0), 4, 1, nullptr },
+        { "spEffectID1", field_type::s32, offsetof(T, spEffectID1), 4, 1, nullptr },
+        { "spEffectID2", field_type::s32, offsetof(T, spEffectID2), 4, 1, nullptr },
+        { "spEffectID3", field_type::s32, offsetof(T, spEffectID3), 4, 1, nullptr },
+        { "spEffectID4", field_type::s32, offsetof(T, spEffectID4), 4, 1, nullptr },
+        { "spEffectID5", field_type::s32, offsetof(T, spEffectID5), 4, 1, nullptr },
+        { "spEffectID6", field_type::s32, offsetof(T, spEffectID6), 4, 1, nullptr },
+        { "spEffectID7", field_type::s32, offsetof(T, spEffectID7), 4, 1, nullptr },
+        { "spEffectID8", field_type::s32, offsetof(T, spEffectID8), 4, 1, nullptr },
+        { "spEffectID9", field_type::s32, offsetof(T, spEffectID9), 4, 1, nullptr },
+        { "sosSignSfxId", field_type::s32, offsetof(T, sosSignSfxId), 4, 1, nullptr },
+        { "mySosSignSfxId", field_type::s32, offsetof(T, mySosSignSfxId), 4, 1, nullptr },
+        { "summonStartAnimId", field_type::s32, offsetof(T, summonStartAnimId), 4, 1, nullptr },
+        { "itemlotParamId", field_type::s32, offsetof(T, itemlotParamId), 4, 1, nullptr },
+        { "voiceChatGroup", field_type::u8, offsetof(T, voiceChatGroup), 1, 1, nullptr },
+        { "roleNameColor", field_type::u8, offsetof(T, roleNameColor), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 2, nullptr },
+        { "roleNameId", field_type::s32, offsetof(T, roleNameId), 4, 1, nullptr },
+        { "threatLv", field_type::u32, offsetof(T, threatLv), 4, 1, nullptr },
+        { "phantomParamId_vowRank1", field_type::s32, offsetof(T, phantomParamId_vowRank1), 4, 1, nullptr },
+        { "phantomParamId_vowRank2", field_type::s32, offsetof(T, phantomParamId_vowRank2), 4, 1, nullptr },
+        { "phantomParamId_vowRank3", field_type::s32, offsetof(T, phantomParamId_vowRank3), 4, 1, nullptr },
+        { "spEffectID_vowRank0", field_type::s32, offsetof(T, spEffectID_vowRank0), 4, 1, nullptr },
+        { "spEffectID_vowRank1", field_type::s32, offsetof(T, spEffectID_vowRank1), 4, 1, nullptr },
+        { "spEffectID_vowRank2", field_type::s32, offsetof(T, spEffectID_vowRank2), 4, 1, nullptr },
+        { "spEffectID_vowRank3", field_type::s32, offsetof(T, spEffectID_vowRank3), 4, 1, nullptr },
+        { "signPhantomId", field_type::s32, offsetof(T, signPhantomId), 4, 1, nullptr },
+        { "nonPlayerSummonStartAnimId", field_type::s32, offsetof(T, nonPlayerSummonStartAnimId), 4, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 16, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, teamType) == 0);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, pad10) == 1);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, phantomParamId) == 4);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID0) == 8);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID1) == 12);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID2) == 16);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID3) == 20);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID4) == 24);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID5) == 28);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID6) == 32);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID7) == 36);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID8) == 40);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID9) == 44);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, sosSignSfxId) == 48);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, mySosSignSfxId) == 52);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, summonStartAnimId) == 56);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, itemlotParamId) == 60);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, voiceChatGroup) == 64);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, roleNameColor) == 65);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, pad1) == 66);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, roleNameId) == 68);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, threatLv) == 72);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, phantomParamId_vowRank1) == 76);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, phantomParamId_vowRank2) == 80);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, phantomParamId_vowRank3) == 84);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID_vowRank0) == 88);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID_vowRank1) == 92);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID_vowRank2) == 96);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, spEffectID_vowRank3) == 100);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, signPhantomId) == 104);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, nonPlayerSummonStartAnimId) == 108);
+static_assert(offsetof(paramdef::ROLE_PARAM_ST, pad2) == 112);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,60 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../ROLLING_OBJ_LOT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::ROLLING_OBJ_LOT_PARAM_ST> {
+    using T = paramdef::ROLLING_OBJ_LOT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 20> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "AssetId_0", field_type::s32, offsetof(T, AssetId_0), 4, 1, nullptr },
+        { "AssetId_1", field_type::s32, offsetof(T, AssetId_1), 4, 1, nullptr },
+        { "AssetId_2", field_type::s32, offsetof(T, AssetId_2), 4, 1, nullptr },
+        { "AssetId_3", field_type::s32, offsetof(T, AssetId_3), 4, 1, nullptr },
+        { "AssetId_4", field_type::s32, offsetof(T, AssetId_4), 4, 1, nullptr },
+        { "AssetId_5", field_type::s32, offsetof(T, AssetId_5), 4, 1, nullptr },
+        { "AssetId_6", field_type::s32, offsetof(T, AssetId_6), 4, 1, nullptr },
+        { "AssetId_7", field_type::s32, offsetof(T, AssetId_7), 4, 1, nullptr },
+        { "CreateWeight_0", field_type::u8, offsetof(T, CreateWeight_0), 1, 1, nullptr },
+        { "CreateWeight_1", field_type::u8, offsetof(T, CreateWeight_1), 1, 1, nullptr },
+        { "CreateWeight_2", field_type::u8, offsetof(T, CreateWeight_2), 1, 1, nullptr },
+        { "CreateWeight_3", field_type::u8, offsetof(T, CreateWeight_3), 1, 1, nullptr },
+        { "CreateWeight_4", field_type::u8, offsetof(T, CreateWeight_4), 1, 1, nullptr },
+        { "CreateWeight_5", field_type::u8, offsetof(T, CreateWeight_5), 1, 1, nullptr },
+        { "CreateWeight_6", field_type::u8, offsetof(T, CreateWeight_6), 1, 1, nullptr },
+        { "CreateWeight_7", field_type::u8, offsetof(T, CreateWeight_7), 1, 1, nullptr },
+        { "Reserve_0", field_type::u8, offsetof(T, Reserve_0), 1, 20, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, AssetId_0) == 4);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, AssetId_1) == 8);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, AssetId_2) == 12);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, AssetId_3) == 16);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, AssetId_4) == 20);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, AssetId_5) == 24);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, AssetId_6) == 28);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, AssetId_7) == 32);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, CreateWeight_0) == 36);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, CreateWeight_1) == 37);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, CreateWeight_2) == 38);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, CreateWeight_3) == 39);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, CreateWeight_4) == 40);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, CreateWeight_5) == 41);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, CreateWeight_6) == 42);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, CreateWeight_7) == 43);
+static_assert(offsetof(paramdef::ROLLING_OBJ_LOT_PARAM_ST, Reserve_0) == 44);
+
+}; // namespace params
+}; // namespace from
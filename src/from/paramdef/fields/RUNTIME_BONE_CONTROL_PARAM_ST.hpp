@@ -0,0 +1,34 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../RUNTIME_BONE_CONTROL_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::RUNTIME_BONE_CONTROL_PARAM_ST> {
+    using T = paramdef::RUNTIME_BONE_CONTROL_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 6> fields = {{
+        { "chrId", field_type::u32, offsetof(T, chrId), 4, 1, nullptr },
+        { "ctrlType", field_type::u8, offsetof(T, ctrlType), 1, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 11, nullptr },
+        { "applyBone", field_type::character, offsetof(T, applyBone), 1, 32, nullptr },
+        { "targetBone1", field_type::character, offsetof(T, targetBone1), 1, 32, nullptr },
+        { "targetBone2", field_type::character, offsetof(T, targetBone2), 1, 32, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::RUNTIME_BONE_CONTROL_PARAM_ST, chrId) == 0);
+static_assert(offsetof(paramdef::RUNTIME_BONE_CONTROL_PARAM_ST, ctrlType) == 4);
+static_assert(offsetof(paramdef::RUNTIME_BONE_CONTROL_PARAM_ST, pad) == 5);
+static_assert(offsetof(paramdef::RUNTIME_BONE_CONTROL_PARAM_ST, applyBone) == 16);
+static_assert(offsetof(paramdef::RUNTIME_BONE_CONTROL_PARAM_ST, targetBone1) == 48);
+static_assert(offsetof(paramdef::RUNTIME_BONE_CONTROL_PARAM_ST, targetBone2) == 80);
+
+}; // namespace params
+}; // namespace from
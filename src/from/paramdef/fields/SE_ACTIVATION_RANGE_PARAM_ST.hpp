@@ -0,0 +1,24 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SE_ACTIVATION_RANGE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SE_ACTIVATION_RANGE_PARAM_ST> {
+    using T = paramdef::SE_ACTIVATION_RANGE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 1> fields = {{
+        { "activateRange", field_type::f32, offsetof(T, activateRange), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SE_ACTIVATION_RANGE_PARAM_ST, activateRange) == 0);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,26 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SE_MATERIAL_CONVERT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SE_MATERIAL_CONVERT_PARAM_ST> {
+    using T = paramdef::SE_MATERIAL_CONVERT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 2> fields = {{
+        { "seMaterialId", field_type::u8, offsetof(T, seMaterialId), 1, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 3, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SE_MATERIAL_CONVERT_PARAM_ST, seMaterialId) == 0);
+static_assert(offsetof(paramdef::SE_MATERIAL_CONVERT_PARAM_ST, pad) == 1);
+
+}; // namespace params
+}; // namespace from
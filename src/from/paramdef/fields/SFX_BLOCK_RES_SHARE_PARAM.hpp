@@ -0,0 +1,24 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SFX_BLOCK_RES_SHARE_PARAM.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SFX_BLOCK_RES_SHARE_PARAM> {
+    using T = paramdef::SFX_BLOCK_RES_SHARE_PARAM;
+
+    static constexpr std::array<field_descriptor, 1> fields = {{
+        { "shareBlockRsMapUidVal", field_type::u32, offsetof(T, shareBlockRsMapUidVal), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SFX_BLOCK_RES_SHARE_PARAM, shareBlockRsMapUidVal) == 0);
+
+}; // namespace params
+}; // namespace from
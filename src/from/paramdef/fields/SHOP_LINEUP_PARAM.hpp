@@ -0,0 +1,58 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SHOP_LINEUP_PARAM.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SHOP_LINEUP_PARAM> {
+    using T = paramdef::SHOP_LINEUP_PARAM;
+
+    static constexpr std::array<field_descriptor, 18> fields = {{
+        { "equipId", field_type::s32, offsetof(T, equipId), 4, 1, nullptr },
+        { "value", field_type::s32, offsetof(T, value), 4, 1, nullptr },
+        { "mtrlId", field_type::s32, offsetof(T, mtrlId), 4, 1, nullptr },
+        { "eventFlag_forStock", field_type::u32, offsetof(T, eventFlag_forStock), 4, 1, nullptr },
+        { "eventFlag_forRelease", field_type::u32, offsetof(T, eventFlag_forRelease), 4, 1, nullptr },
+        { "sellQuantity", field_type::s16, offsetof(T, sellQuantity), 2, 1, nullptr },
+        { "pad3", field_type::u8, offsetof(T, pad3), 1, 1, nullptr },
+        { "equipType", field_type::u8, offsetof(T, equipType), 1, 1, nullptr },
+        { "costType", field_type::u8, offsetof(T, costType), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 1, nullptr },
+        { "setNum", field_type::u16, offsetof(T, setNum), 2, 1, nullptr },
+        { "value_Add", field_type::s32, offsetof(T, value_Add), 4, 1, nullptr },
+        { "value_Magnification", field_type::f32, offsetof(T, value_Magnification), 4, 1, nullptr },
+        { "iconId", field_type::s32, offsetof(T, iconId), 4, 1, nullptr },
+        { "nameMsgId", field_type::s32, offsetof(T, nameMsgId), 4, 1, nullptr },
+        { "menuTitleMsgId", field_type::s32, offsetof(T, menuTitleMsgId), 4, 1, nullptr },
+        { "menuIconId", field_type::s16, offsetof(T, menuIconId), 2, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 2, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, equipId) == 0);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, value) == 4);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, mtrlId) == 8);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, eventFlag_forStock) == 12);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, eventFlag_forRelease) == 16);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, sellQuantity) == 20);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, pad3) == 22);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, equipType) == 23);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, costType) == 24);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, pad1) == 25);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, setNum) == 26);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, value_Add) == 28);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, value_Magnification) == 32);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, iconId) == 36);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, nameMsgId) == 40);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, menuTitleMsgId) == 44);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, menuIconId) == 48);
+static_assert(offsetof(paramdef::SHOP_LINEUP_PARAM, pad2) == 50);
+
+}; // namespace params
+}; // namespace from
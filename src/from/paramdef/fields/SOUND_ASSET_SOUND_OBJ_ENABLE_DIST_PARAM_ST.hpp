@@ -0,0 +1,24 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SOUND_ASSET_SOUND_OBJ_ENABLE_DIST_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SOUND_ASSET_SOUND_OBJ_ENABLE_DIST_PARAM_ST> {
+    using T = paramdef::SOUND_ASSET_SOUND_OBJ_ENABLE_DIST_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 1> fields = {{
+        { "SoundObjEnableDist", field_type::f32, offsetof(T, SoundObjEnableDist), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SOUND_ASSET_SOUND_OBJ_ENABLE_DIST_PARAM_ST, SoundObjEnableDist) == 0);
+
+}; // namespace params
+}; // namespace from
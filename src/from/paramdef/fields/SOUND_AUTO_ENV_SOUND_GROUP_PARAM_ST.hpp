@@ -0,0 +1,30 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SOUND_AUTO_ENV_SOUND_GROUP_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SOUND_AUTO_ENV_SOUND_GROUP_PARAM_ST> {
+    using T = paramdef::SOUND_AUTO_ENV_SOUND_GROUP_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "SoundNo", field_type::s32, offsetof(T, SoundNo), 4, 1, nullptr },
+        { "ExpandRange", field_type::f32, offsetof(T, ExpandRange), 4, 1, nullptr },
+        { "FollowSpeed", field_type::f32, offsetof(T, FollowSpeed), 4, 1, nullptr },
+        { "FollowRate", field_type::f32, offsetof(T, FollowRate), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SOUND_AUTO_ENV_SOUND_GROUP_PARAM_ST, SoundNo) == 0);
+static_assert(offsetof(paramdef::SOUND_AUTO_ENV_SOUND_GROUP_PARAM_ST, ExpandRange) == 4);
+static_assert(offsetof(paramdef::SOUND_AUTO_ENV_SOUND_GROUP_PARAM_ST, FollowSpeed) == 8);
+static_assert(offsetof(paramdef::SOUND_AUTO_ENV_SOUND_GROUP_PARAM_ST, FollowRate) == 12);
+
+}; // namespace params
+}; // namespace from
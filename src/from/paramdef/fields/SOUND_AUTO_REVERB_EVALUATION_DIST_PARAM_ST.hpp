@@ -0,0 +1,38 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST> {
+    using T = paramdef::SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 8> fields = {{
+        { "NoHitDist", field_type::f32, offsetof(T, NoHitDist), 4, 1, nullptr },
+        { "isCollectNoHitPoint", field_type::boolean, offsetof(T, isCollectNoHitPoint), 1, 1, nullptr },
+        { "isCollectOutdoorPoint", field_type::boolean, offsetof(T, isCollectOutdoorPoint), 1, 1, nullptr },
+        { "isCollectFloorPoint", field_type::boolean, offsetof(T, isCollectFloorPoint), 1, 1, nullptr },
+        { "distValCalcType", field_type::u8, offsetof(T, distValCalcType), 1, 1, nullptr },
+        { "enableLifeTime", field_type::f32, offsetof(T, enableLifeTime), 4, 1, nullptr },
+        { "maxDistRecordNum", field_type::u32, offsetof(T, maxDistRecordNum), 4, 1, nullptr },
+        { "ignoreDistNumForMax", field_type::u32, offsetof(T, ignoreDistNumForMax), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST, NoHitDist) == 0);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST, isCollectNoHitPoint) == 4);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST, isCollectOutdoorPoint) == 5);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST, isCollectFloorPoint) == 6);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST, distValCalcType) == 7);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST, enableLifeTime) == 8);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST, maxDistRecordNum) == 12);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST, ignoreDistNumForMax) == 16);
+
+}; // namespace params
+}; // namespace from
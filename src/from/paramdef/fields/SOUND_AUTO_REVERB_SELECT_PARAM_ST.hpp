@@ -0,0 +1,44 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SOUND_AUTO_REVERB_SELECT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST> {
+    using T = paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 11> fields = {{
+        { "reverbType", field_type::u32, offsetof(T, reverbType), 4, 1, nullptr },
+        { "AreaNo", field_type::s32, offsetof(T, AreaNo), 4, 1, nullptr },
+        { "IndoorOutdoor", field_type::s8, offsetof(T, IndoorOutdoor), 1, 1, nullptr },
+        { "useDistNoA", field_type::s8, offsetof(T, useDistNoA), 1, 1, nullptr },
+        { "useDistNoB", field_type::s8, offsetof(T, useDistNoB), 1, 1, nullptr },
+        { "pad0", field_type::u8, offsetof(T, pad0), 1, 1, nullptr },
+        { "DistMinA", field_type::f32, offsetof(T, DistMinA), 4, 1, nullptr },
+        { "DistMaxA", field_type::f32, offsetof(T, DistMaxA), 4, 1, nullptr },
+        { "DistMinB", field_type::f32, offsetof(T, DistMinB), 4, 1, nullptr },
+        { "DistMaxB", field_type::f32, offsetof(T, DistMaxB), 4, 1, nullptr },
+        { "NoHitNumMin", field_type::s32, offsetof(T, NoHitNumMin), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, reverbType) == 0);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, AreaNo) == 4);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, IndoorOutdoor) == 8);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, useDistNoA) == 9);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, useDistNoB) == 10);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, pad0) == 11);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, DistMinA) == 12);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, DistMaxA) == 16);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, DistMinB) == 20);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, DistMaxB) == 24);
+static_assert(offsetof(paramdef::SOUND_AUTO_REVERB_SELECT_PARAM_ST, NoHitNumMin) == 28);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,78 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SOUND_CHR_PHYSICS_SE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST> {
+    using T = paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 29> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "ContactLandSeId", field_type::s32, offsetof(T, ContactLandSeId), 4, 1, nullptr },
+        { "ContactLandAddSeId", field_type::s32, offsetof(T, ContactLandAddSeId), 4, 1, nullptr },
+        { "ContactLandPlayNum", field_type::s32, offsetof(T, ContactLandPlayNum), 4, 1, nullptr },
+        { "IsEnablePlayCountPerRigid", field_type::boolean, offsetof(T, IsEnablePlayCountPerRigid), 1, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 3, nullptr },
+        { "ContactLandMinImpuse", field_type::f32, offsetof(T, ContactLandMinImpuse), 4, 1, nullptr },
+        { "ContactLandMinSpeed", field_type::f32, offsetof(T, ContactLandMinSpeed), 4, 1, nullptr },
+        { "ContactPlayerSeId", field_type::s32, offsetof(T, ContactPlayerSeId), 4, 1, nullptr },
+        { "ContactPlayerMinImpuse", field_type::f32, offsetof(T, ContactPlayerMinImpuse), 4, 1, nullptr },
+        { "ContactPlayerMinSpeed", field_type::f32, offsetof(T, ContactPlayerMinSpeed), 4, 1, nullptr },
+        { "ContactCheckRigidIdx0", field_type::s8, offsetof(T, ContactCheckRigidIdx0), 1, 1, nullptr },
+        { "ContactCheckRigidIdx1", field_type::s8, offsetof(T, ContactCheckRigidIdx1), 1, 1, nullptr },
+        { "ContactCheckRigidIdx2", field_type::s8, offsetof(T, ContactCheckRigidIdx2), 1, 1, nullptr },
+        { "ContactCheckRigidIdx3", field_type::s8, offsetof(T, ContactCheckRigidIdx3), 1, 1, nullptr },
+        { "ContactCheckRigidIdx4", field_type::s8, offsetof(T, ContactCheckRigidIdx4), 1, 1, nullptr },
+        { "ContactCheckRigidIdx5", field_type::s8, offsetof(T, ContactCheckRigidIdx5), 1, 1, nullptr },
+        { "ContactCheckRigidIdx6", field_type::s8, offsetof(T, ContactCheckRigidIdx6), 1, 1, nullptr },
+        { "ContactCheckRigidIdx7", field_type::s8, offsetof(T, ContactCheckRigidIdx7), 1, 1, nullptr },
+        { "ContactCheckRigidIdx8", field_type::s8, offsetof(T, ContactCheckRigidIdx8), 1, 1, nullptr },
+        { "ContactCheckRigidIdx9", field_type::s8, offsetof(T, ContactCheckRigidIdx9), 1, 1, nullptr },
+        { "ContactCheckRigidIdx10", field_type::s8, offsetof(T, ContactCheckRigidIdx10), 1, 1, nullptr },
+        { "ContactCheckRigidIdx11", field_type::s8, offsetof(T, ContactCheckRigidIdx11), 1, 1, nullptr },
+        { "ContactCheckRigidIdx12", field_type::s8, offsetof(T, ContactCheckRigidIdx12), 1, 1, nullptr },
+        { "ContactCheckRigidIdx13", field_type::s8, offsetof(T, ContactCheckRigidIdx13), 1, 1, nullptr },
+        { "ContactCheckRigidIdx14", field_type::s8, offsetof(T, ContactCheckRigidIdx14), 1, 1, nullptr },
+        { "ContactCheckRigidIdx15", field_type::s8, offsetof(T, ContactCheckRigidIdx15), 1, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactLandSeId) == 4);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactLandAddSeId) == 8);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactLandPlayNum) == 12);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, IsEnablePlayCountPerRigid) == 16);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, pad) == 17);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactLandMinImpuse) == 20);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactLandMinSpeed) == 24);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactPlayerSeId) == 28);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactPlayerMinImpuse) == 32);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactPlayerMinSpeed) == 36);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx0) == 40);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx1) == 41);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx2) == 42);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx3) == 43);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx4) == 44);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx5) == 45);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx6) == 46);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx7) == 47);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx8) == 48);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx9) == 49);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx10) == 50);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx11) == 51);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx12) == 52);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx13) == 53);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx14) == 54);
+static_assert(offsetof(paramdef::SOUND_CHR_PHYSICS_SE_PARAM_ST, ContactCheckRigidIdx15) == 55);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,26 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SOUND_COMMON_INGAME_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SOUND_COMMON_INGAME_PARAM_ST> {
+    using T = paramdef::SOUND_COMMON_INGAME_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 2> fields = {{
+        { "ParamKeyStr", field_type::character, offsetof(T, ParamKeyStr), 1, 32, nullptr },
+        { "ParamValueStr", field_type::character, offsetof(T, ParamValueStr), 1, 32, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SOUND_COMMON_INGAME_PARAM_ST, ParamKeyStr) == 0);
+static_assert(offsetof(paramdef::SOUND_COMMON_INGAME_PARAM_ST, ParamValueStr) == 32);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,42 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SOUND_CUTSCENE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SOUND_CUTSCENE_PARAM_ST> {
+    using T = paramdef::SOUND_CUTSCENE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 11> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "ReverbType", field_type::u8, offsetof(T, ReverbType), 1, 1, nullptr },
+        { "pad0", field_type::u8, offsetof(T, pad0), 1, 3, nullptr },
+        { "BgmBehaviorTypeOnStart", field_type::s16, offsetof(T, BgmBehaviorTypeOnStart), 2, 1, nullptr },
+        { "OneShotBgmBehaviorOnStart", field_type::s16, offsetof(T, OneShotBgmBehaviorOnStart), 2, 1, nullptr },
+        { "PostPlaySeId", field_type::s32, offsetof(T, PostPlaySeId), 4, 1, nullptr },
+        { "PostPlaySeIdForSkip", field_type::s32, offsetof(T, PostPlaySeIdForSkip), 4, 1, nullptr },
+        { "EnterMapMuteStopTimeOnDrawCutscene", field_type::f32, offsetof(T, EnterMapMuteStopTimeOnDrawCutscene), 4, 1, nullptr },
+        { "reserved", field_type::u8, offsetof(T, reserved), 1, 12, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SOUND_CUTSCENE_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::SOUND_CUTSCENE_PARAM_ST, ReverbType) == 4);
+static_assert(offsetof(paramdef::SOUND_CUTSCENE_PARAM_ST, pad0) == 5);
+static_assert(offsetof(paramdef::SOUND_CUTSCENE_PARAM_ST, BgmBehaviorTypeOnStart) == 8);
+static_assert(offsetof(paramdef::SOUND_CUTSCENE_PARAM_ST, OneShotBgmBehaviorOnStart) == 10);
+static_assert(offsetof(paramdef::SOUND_CUTSCENE_PARAM_ST, PostPlaySeId) == 12);
+static_assert(offsetof(paramdef::SOUND_CUTSCENE_PARAM_ST, PostPlaySeIdForSkip) == 16);
+static_assert(offsetof(paramdef::SOUND_CUTSCENE_PARAM_ST, EnterMapMuteStopTimeOnDrawCutscene) == 20);
+static_assert(offsetof(paramdef::SOUND_CUTSCENE_PARAM_ST, reserved) == 24);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,42 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SPEEDTREE_MODEL_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SPEEDTREE_MODEL_PARAM_ST> {
+    using T = paramdef::SPEEDTREE_MODEL_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 10> fields = {{
+        { "MinFadeLeaf", field_type::f32, offsetof(T, MinFadeLeaf), 4, 1, nullptr },
+        { "MinFadeFrond", field_type::f32, offsetof(T, MinFadeFrond), 4, 1, nullptr },
+        { "MinFadeBranch", field_type::f32, offsetof(T, MinFadeBranch), 4, 1, nullptr },
+        { "MinTranslucencyLeaf", field_type::f32, offsetof(T, MinTranslucencyLeaf), 4, 1, nullptr },
+        { "MaxTranslucencyLeaf", field_type::f32, offsetof(T, MaxTranslucencyLeaf), 4, 1, nullptr },
+        { "MinTranslucencyFrond", field_type::f32, offsetof(T, MinTranslucencyFrond), 4, 1, nullptr },
+        { "MaxTranslucencyFrond", field_type::f32, offsetof(T, MaxTranslucencyFrond), 4, 1, nullptr },
+        { "MinTranslucencyBranch", field_type::f32, offsetof(T, MinTranslucencyBranch), 4, 1, nullptr },
+        { "MaxTranslucencyBranch", field_type::f32, offsetof(T, MaxTranslucencyBranch), 4, 1, nullptr },
+        { "BillboardBackSpecularWeakenParam", field_type::f32, offsetof(T, BillboardBackSpecularWeakenParam), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SPEEDTREE_MODEL_PARAM_ST, MinFadeLeaf) == 0);
+static_assert(offsetof(paramdef::SPEEDTREE_MODEL_PARAM_ST, MinFadeFrond) == 4);
+static_assert(offsetof(paramdef::SPEEDTREE_MODEL_PARAM_ST, MinFadeBranch) == 8);
+static_assert(offsetof(paramdef::SPEEDTREE_MODEL_PARAM_ST, MinTranslucencyLeaf) == 12);
+static_assert(offsetof(paramdef::SPEEDTREE_MODEL_PARAM_ST, MaxTranslucencyLeaf) == 16);
+static_assert(offsetof(paramdef::SPEEDTREE_MODEL_PARAM_ST, MinTranslucencyFrond) == 20);
+static_assert(offsetof(paramdef::SPEEDTREE_MODEL_PARAM_ST, MaxTranslucencyFrond) == 24);
+static_assert(offsetof(paramdef::SPEEDTREE_MODEL_PARAM_ST, MinTranslucencyBranch) == 28);
+static_assert(offsetof(paramdef::SPEEDTREE_MODEL_PARAM_ST, MaxTranslucencyBranch) == 32);
+static_assert(offsetof(paramdef::SPEEDTREE_MODEL_PARAM_ST, BillboardBackSpecularWeakenParam) == 36);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,661 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SP_EFFECT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SP_EFFECT_PARAM_ST> {
+    using T = paramdef::SP_EFFECT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 362> fields = {{
+        { "iconId", field_type::s32, offsetof(T, iconId), 4, 1, nullptr },
+        { "conditionHp", field_type::f32, offsetof(T, conditionHp), 4, 1, nullptr },
+        { "effectEndurance", field_type::f32, offsetof(T, effectEndurance), 4, 1, nullptr },
+        { "motionInterval", field_type::f32, offsetof(T, motionInterval), 4, 1, nullptr },
+        { "maxHpRate", field_type::f32, offsetof(T, maxHpRate), 4, 1, nullptr },
+        { "maxMpRate", field_type::f32, offsetof(T, maxMpRate), 4, 1, nullptr },
+        { "maxStaminaRate", field_type::f32, offsetof(T, maxStaminaRate), 4, 1, nullptr },
+        { "slashDamageCutRate", field_type::f32, offsetof(T, slashDamageCutRate), 4, 1, nullptr },
+        { "blowDamageCutRate", field_type::f32, offsetof(T, blowDamageCutRate), 4, 1, nullptr },
+        { "thrustDamageCutRate", field_type::f32, offsetof(T, thrustDamageCutRate), 4, 1, nullptr },
+        { "neutralDamageCutRate", field_type::f32, offsetof(T, neutralDamageCutRate), 4, 1, nullptr },
+        { "magicDamageCutRate", field_type::f32, offsetof(T, magicDamageCutRate), 4, 1, nullptr },
+        { "fireDamageCutRate", field_type::f32, offsetof(T, fireDamageCutRate), 4, 1, nullptr },
+        { "thunderDamageCutRate", field_type::f32, offsetof(T, thunderDamageCutRate), 4, 1, nullptr },
+        { "physicsAttackRate", field_type::f32, offsetof(T, physicsAttackRate), 4, 1, nullptr },
+        { "magicAttackRate", field_type::f32, offsetof(T, magicAttackRate), 4, 1, nullptr },
+        { "fireAttackRate", field_type::f32, offsetof(T, fireAttackRate), 4, 1, nullptr },
+        { "thunderAttackRate", field_type::f32, offsetof(T, thunderAttackRate), 4, 1, nullptr },
+        { "physicsAttackPowerRate", field_type::f32, offsetof(T, physicsAttackPowerRate), 4, 1, nullptr },
+        { "magicAttackPowerRate", field_type::f32, offsetof(T, magicAttackPowerRate), 4, 1, nullptr },
+        { "fireAttackPowerRate", field_type::f32, offsetof(T, fireAttackPowerRate), 4, 1, nullptr },
+        { "thunderAttackPowerRate", field_type::f32, offsetof(T, thunderAttackPowerRate), 4, 1, nullptr },
+        { "physicsAttackPower", field_type::s32, offsetof(T, physicsAttackPower), 4, 1, nullptr },
+        { "magicAttackPower", field_type::s32, offsetof(T, magicAttackPower), 4, 1, nullptr },
+        { "fireAttackPower", field_type::s32, offsetof(T, fireAttackPower), 4, 1, nullptr },
+        { "thunderAttackPower", field_type::s32, offsetof(T, thunderAttackPower), 4, 1, nullptr },
+        { "physicsDiffenceRate", field_type::f32, offsetof(T, physicsDiffenceRate), 4, 1, nullptr },
+        { "magicDiffenceRate", field_type::f32, offsetof(T, magicDiffenceRate), 4, 1, nullptr },
+        { "fireDiffenceRate", field_type::f32, offsetof(T, fireDiffenceRate), 4, 1, nullptr },
+        { "thunderDiffenceRate", field_type::f32, offsetof(T, thunderDiffenceRate), 4, 1, nullptr },
+        { "physicsDiffence", field_type::s32, offsetof(T, physicsDiffence), 4, 1, nullptr },
+        { "magicDiffence", field_type::s32, offsetof(T, magicDiffence), 4, 1, nullptr },
+        { "fireDiffence", field_type::s32, offsetof(T, fireDiffence), 4, 1, nullptr },
+        { "thunderDiffence", field_type::s32, offsetof(T, thunderDiffence), 4, 1, nullptr },
+        { "NoGuardDamageRate", field_type::f32, offsetof(T, NoGuardDamageRate), 4, 1, nullptr },
+        { "vitalSpotChangeRate", field_type::f32, offsetof(T, vitalSpotChangeRate), 4, 1, nullptr },
+        { "normalSpotChangeRate", field_type::f32, offsetof(T, normalSpotChangeRate), 4, 1, nullptr },
+        { "lookAtTargetPosOffset", field_type::f32, offsetof(T, lookAtTargetPosOffset), 4, 1, nullptr },
+        { "behaviorId", field_type::s32, offsetof(T, behaviorId), 4, 1, nullptr },
+        { "changeHpRate", field_type::f32, offsetof(T, changeHpRate), 4, 1, nullptr },
+        { "changeHpPoint", field_type::s32, offsetof(T, changeHpPoint), 4, 1, nullptr },
+        { "changeMpRate", field_type::f32, offsetof(T, changeMpRate), 4, 1, nullptr },
+        { "changeMpPoint", field_type::s32, offsetof(T, changeMpPoint), 4, 1, nullptr },
+        { "mpRecoverChangeSpeed", field_type::s32, offsetof(T, mpRecoverChangeSpeed), 4, 1, nullptr },
+        { "changeStaminaRate", field_type::f32, offsetof(T, changeStaminaRate), 4, 1, nullptr },
+        { "changeStaminaPoint", field_type::s32, offsetof(T, changeStaminaPoint), 4, 1, nullptr },
+        { "staminaRecoverChangeSpeed", field_type::s32, offsetof(T, staminaRecoverChangeSpeed), 4, 1, nullptr },
+        { "magicEffectTimeChange", field_type::f32, offsetof(T, magicEffectTimeChange), 4, 1, nullptr },
+        { "insideDurability", field_type::s32, offsetof(T, insideDurability), 4, 1, nullptr },
+        { "maxDurability", field_type::s32, offsetof(T, maxDurability), 4, 1, nullptr },
+        { "staminaAttackRate", field_type::f32, offsetof(T, staminaAttackRate), 4, 1, nullptr },
+        { "poizonAttackPower", field_type::s32, offsetof(T, poizonAttackPower), 4, 1, nullptr },
+        { "diseaseAttackPower", field_type::s32, offsetof(T, diseaseAttackPower), 4, 1, nullptr },
+        { "bloodAttackPower", field_type::s32, offsetof(T, bloodAttackPower), 4, 1, nullptr },
+        { "curseAttackPower", field_type::s32, offsetof(T, curseAttackPower), 4, 1, nullptr },
+        { "fallDamageRate", field_type::f32, offsetof(T, fallDamageRate), 4, 1, nullptr },
+        { "soulRate", field_type::f32, offsetof(T, soulRate), 4, 1, nullptr },
+        { "equipWeightChangeRate", field_type::f32, offsetof(T, equipWeightChangeRate), 4, 1, nullptr },
+        { "allItemWeightChangeRate", field_type::f32, offsetof(T, allItemWeightChangeRate), 4, 1, nullptr },
+        { "soul", field_type::s32, offsetof(T, soul), 4, 1, nullptr },
+        { "animIdOffset", field_type::s32, offsetof(T, animIdOffset), 4, 1, nullptr },
+        { "haveSoulRate", field_type::f32, offsetof(T, haveSoulRate), 4, 1, nullptr },
+        { "targetPriority", field_type::f32, offsetof(T, targetPriority), 4, 1, nullptr },
+        { "sightSearchEnemyRate", field_type::f32, offsetof(T, sightSearchEnemyRate), 4, 1, nullptr },
+        { "hearingSearchEnemyRate", field_type::f32, offsetof(T, hearingSearchEnemyRate), 4, 1, nullptr },
+        { "grabityRate", field_type::f32, offsetof(T, grabityRate), 4, 1, nullptr },
+        { "registPoizonChangeRate", field_type::f32, offsetof(T, registPoizonChangeRate), 4, 1, nullptr },
+        { "registDiseaseChangeRate", field_type::f32, offsetof(T, registDiseaseChangeRate), 4, 1, nullptr },
+        { "registBloodChangeRate", field_type::f32, offsetof(T, registBloodChangeRate), 4, 1, nullptr },
+        { "registCurseChangeRate", field_type::f32, offsetof(T, registCurseChangeRate), 4, 1, nullptr },
+        { "soulStealRate", field_type::f32, offsetof(T, soulStealRate), 4, 1, nullptr },
+        { "lifeReductionRate", field_type::f32, offsetof(T, lifeReductionRate), 4, 1, nullptr },
+        { "hpRecoverRate", field_type::f32, offsetof(T, hpRecoverRate), 4, 1, nullptr },
+        { "replaceSpEffectId", field_type::s32, offsetof(T, replaceSpEffectId), 4, 1, nullptr },
+        { "cycleOccurrenceSpEffectId", field_type::s32, offsetof(T, cycleOccurrenceSpEffectId), 4, 1, nullptr },
+        { "atkOccurrenceSpEffectId", field_type::s32, offsetof(T, atkOccurrenceSpEffectId), 4, 1, nullptr },
+        { "guardDefFlickPowerRate", field_type::f32, offsetof(T, guardDefFlickPowerRate), 4, 1, nullptr },
+        { "guardStaminaCutRate", field_type::f32, offsetof(T, guardStaminaCutRate), 4, 1, nullptr },
+        { "rayCastPassedTime", field_type::s16, offsetof(T, rayCastPassedTime), 2, 1, nullptr },
+        { "magicSubCategoryChange1", field_type::u8, offsetof(T, magicSubCategoryChange1), 1, 1, nullptr },
+        { "magicSubCategoryChange2", field_type::u8, offsetof(T, magicSubCategoryChange2), 1, 1, nullptr },
+        { "bowDistRate", field_type::s16, offsetof(T, bowDistRate), 2, 1, nullptr },
+        { "spCategory", field_type::u16, offsetof(T, spCategory), 2, 1, nullptr },
+        { "categoryPriority", field_type::u8, offsetof(T, categoryPriority), 1, 1, nullptr },
+        { "saveCategory", field_type::s8, offsetof(T, saveCategory), 1, 1, nullptr },
+        { "changeMagicSlot", field_type::u8, offsetof(T, changeMagicSlot), 1, 1, nullptr },
+        { "changeMiracleSlot", field_type::u8, offsetof(T, changeMiracleSlot), 1, 1, nullptr },
+        { "heroPointDamage", field_type::s8, offsetof(T, heroPointDamage), 1, 1, nullptr },
+        { "defFlickPower", field_type::u8, offsetof(T, defFlickPower), 1, 1, nullptr },
+        { "flickDamageCutRate", field_type::u8, offsetof(T, flickDamageCutRate), 1, 1, nullptr },
+        { "bloodDamageRate", field_type::u8, offsetof(T, bloodDamageRate), 1, 1, nullptr },
+        { "dmgLv_None", field_type::s8, offsetof(T, dmgLv_None), 1, 1, nullptr },
+        { "dmgLv_S", field_type::s8, offsetof(T, dmgLv_S), 1, 1, nullptr },
+        { "dmgLv_M", field_type::s8, offsetof(T, dmgLv_M), 1, 1, nullptr },
+        { "dmgLv_L", field_type::s8, offsetof(T, dmgLv_L), 1, 1, nullptr },
+        { "dmgLv_BlowM", field_type::s8, offsetof(T, dmgLv_BlowM), 1, 1, nullptr },
+        { "dmgLv_Push", field_type::s8, offsetof(T, dmgLv_Push), 1, 1, nullptr },
+        { "dmgLv_Strike", field_type::s8, offsetof(T, dmgLv_Strike), 1, 1, nullptr },
+        { "dmgLv_BlowS", field_type::s8, offsetof(T, dmgLv_BlowS), 1, 1, nullptr },
+        { "dmgLv_Min", field_type::s8, offsetof(T, dmgLv_Min), 1, 1, nullptr },
+        { "dmgLv_Uppercut", field_type::s8, offsetof(T, dmgLv_Uppercut), 1, 1, nullptr },
+        { "dmgLv_BlowLL", field_type::s8, offsetof(T, dmgLv_BlowLL), 1, 1, nullptr },
+        { "dmgLv_Breath", field_type::s8, offsetof(T, dmgLv_Breath), 1, 1, nullptr },
+        { "atkAttribute", field_type::u8, offsetof(T, atkAttribute), 1, 1, nullptr },
+        { "spAttribute", field_type::u8, offsetof(T, spAttribute), 1, 1, nullptr },
+        { "stateInfo", field_type::u16, offsetof(T, stateInfo), 2, 1, nullptr },
+        { "wepParamChange", field_type::u8, offsetof(T, wepParamChange), 1, 1, nullptr },
+        { "moveType", field_type::u8, offsetof(T, moveType), 1, 1, nullptr },
+        { "lifeReductionType", field_type::u16, offsetof(T, lifeReductionType), 2, 1, nullptr },
+        { "throwCondition", field_type::u8, offsetof(T, throwCondition), 1, 1, nullptr },
+        { "addBehaviorJudgeId_condition", field_type::s8, offsetof(T, addBehaviorJudgeId_condition), 1, 1, nullptr },
+        { "freezeDamageRate", field_type::u8, offsetof(T, freezeDamageRate), 1, 1, nullptr },
+        { "effectTargetSelf", field_type::boolean, 351, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetSelf; } },
+        { "effectTargetFriend", field_type::boolean, 351, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetFriend; } },
+        { "effectTargetEnemy", field_type::boolean, 351, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetEnemy; } },
+        { "effectTargetPlayer", field_type::boolean, 351, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetPlayer; } },
+        { "effectTargetAI", field_type::boolean, 351, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetAI; } },
+        { "effectTargetLive", field_type::boolean, 351, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetLive; } },
+        { "effectTargetGhost", field_type::boolean, 351, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetGhost; } },
+        { "disableSleep", field_type::boolean, 351, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableSleep; } },
+        { "disableMadness", field_type::boolean, 352, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableMadness; } },
+        { "effectTargetAttacker", field_type::boolean, 352, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetAttacker; } },
+        { "dispIconNonactive", field_type::boolean, 352, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->dispIconNonactive; } },
+        { "regainGaugeDamage", field_type::boolean, 352, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->regainGaugeDamage; } },
+        { "bAdjustMagicAblity", field_type::boolean, 352, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bAdjustMagicAblity; } },
+        { "bAdjustFaithAblity", field_type::boolean, 352, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bAdjustFaithAblity; } },
+        { "bGameClearBonus", field_type::boolean, 352, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bGameClearBonus; } },
+        { "magParamChange", field_type::boolean, 352, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->magParamChange; } },
+        { "miracleParamChange", field_type::boolean, 353, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->miracleParamChange; } },
+        { "clearSoul", field_type::boolean, 353, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->clearSoul; } },
+        { "requestSOS", field_type::boolean, 353, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->requestSOS; } },
+        { "requestBlackSOS", field_type::boolean, 353, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->requestBlackSOS; } },
+        { "requestForceJoinBlackSOS", field_type::boolean, 353, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->requestForceJoinBlackSOS; } },
+        { "requestKickSession", field_type::boolean, 353, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->requestKickSession; } },
+        { "requestLeaveSession", field_type::boolean, 353, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->requestLeaveSession; } },
+        { "requestNpcInveda", field_type::boolean, 353, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->requestNpcInveda; } },
+        { "noDead", field_type::boolean, 354, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->noDead; } },
+        { "bCurrHPIndependeMaxHP", field_type::boolean, 354, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bCurrHPIndependeMaxHP; } },
+        { "corrosionIgnore", field_type::boolean, 354, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->corrosionIgnore; } },
+        { "sightSearchCutIgnore", field_type::boolean, 354, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->sightSearchCutIgnore; } },
+        { "hearingSearchCutIgnore", field_type::boolean, 354, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->hearingSearchCutIgnore; } },
+        { "antiMagicIgnore", field_type::boolean, 354, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->antiMagicIgnore; } },
+        { "fakeTargetIgnore", field_type::boolean, 354, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->fakeTargetIgnore; } },
+        { "fakeTargetIgnoreUndead", field_type::boolean, 354, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->fakeTargetIgnoreUndead; } },
+        { "fakeTargetIgnoreAnimal", field_type::boolean, 355, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->fakeTargetIgnoreAnimal; } },
+        { "grabityIgnore", field_type::boolean, 355, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->grabityIgnore; } },
+        { "disablePoison", field_type::boolean, 355, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disablePoison; } },
+        { "disableDisease", field_type::boolean, 355, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableDisease; } },
+        { "disableBlood", field_type::boolean, 355, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableBlood; } },
+        { "disableCurse", field_type::boolean, 355, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableCurse; } },
+        { "enableCharm", field_type::boolean, 355, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableCharm; } },
+        { "enableLifeTime", field_type::boolean, 355, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->enableLifeTime; } },
+        { "bAdjustStrengthAblity", field_type::boolean, 356, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bAdjustStrengthAblity; } },
+        { "bAdjustAgilityAblity", field_type::boolean, 356, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->bAdjustAgilityAblity; } },
+        { "eraseOnBonfireRecover", field_type::boolean, 356, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->eraseOnBonfireRecover; } },
+        { "throwAttackParamChange", field_type::boolean, 356, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->throwAttackParamChange; } },
+        { "requestLeaveColiseumSession", field_type::boolean, 356, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->requestLeaveColiseumSession; } },
+        { "isExtendSpEffectLife", field_type::boolean, 356, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isExtendSpEffectLife; } },
+        { "hasTarget", field_type::boolean, 356, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->hasTarget; } },
+        { "replanningOnFire", field_type::boolean, 356, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->replanningOnFire; } },
+        { "vowType0", field_type::boolean, 357, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType0; } },
+        { "vowType1", field_type::boolean, 357, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType1; } },
+        { "vowType2", field_type::boolean, 357, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType2; } },
+        { "vowType3", field_type::boolean, 357, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType3; } },
+        { "vowType4", field_type::boolean, 357, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType4; } },
+        { "vowType5", field_type::boolean, 357, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType5; } },
+        { "vowType6", field_type::boolean, 357, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType6; } },
+        { "vowType7", field_type::boolean, 357, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType7; } },
+        { "vowType8", field_type::boolean, 358, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType8; } },
+        { "vowType9", field_type::boolean, 358, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType9; } },
+        { "vowType10", field_type::boolean, 358, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType10; } },
+        { "vowType11", field_type::boolean, 358, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType11; } },
+        { "vowType12", field_type::boolean, 358, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType12; } },
+        { "vowType13", field_type::boolean, 358, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType13; } },
+        { "vowType14", field_type::boolean, 358, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType14; } },
+        { "vowType15", field_type::boolean, 358, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->vowType15; } },
+        { "repAtkDmgLv", field_type::s8, offsetof(T, repAtkDmgLv), 1, 1, nullptr },
+        { "sightSearchRate", field_type::f32, offsetof(T, sightSearchRate), 4, 1, nullptr },
+        { "effectTargetOpposeTarget", field_type::boolean, 364, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetOpposeTarget; } },
+        { "effectTargetFriendlyTarget", field_type::boolean, 364, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetFriendlyTarget; } },
+        { "effectTargetSelfTarget", field_type::boolean, 364, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetSelfTarget; } },
+        { "effectTargetPcHorse", field_type::boolean, 364, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetPcHorse; } },
+        { "effectTargetPcDeceased", field_type::boolean, 364, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectTargetPcDeceased; } },
+        { "isContractSpEffectLife", field_type::boolean, 364, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isContractSpEffectLife; } },
+        { "isWaitModeDelete", field_type::boolean, 364, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isWaitModeDelete; } },
+        { "isIgnoreNoDamage", field_type::boolean, 364, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isIgnoreNoDamage; } },
+        { "changeTeamType", field_type::s8, offsetof(T, changeTeamType), 1, 1, nullptr },
+        { "dmypolyId", field_type::s16, offsetof(T, dmypolyId), 2, 1, nullptr },
+        { "vfxId", field_type::s32, offsetof(T, vfxId), 4, 1, nullptr },
+        { "accumuOverFireId", field_type::s32, offsetof(T, accumuOverFireId), 4, 1, nullptr },
+        { "accumuOverVal", field_type::s32, offsetof(T, accumuOverVal), 4, 1, nullptr },
+        { "accumuUnderFireId", field_type::s32, offsetof(T, accumuUnderFireId), 4, 1, nullptr },
+        { "accumuUnderVal", field_type::s32, offsetof(T, accumuUnderVal), 4, 1, nullptr },
+        { "accumuVal", field_type::s32, offsetof(T, accumuVal), 4, 1, nullptr },
+        { "eye_angX", field_type::u8, offsetof(T, eye_angX), 1, 1, nullptr },
+        { "eye_angY", field_type::u8, offsetof(T, eye_angY), 1, 1, nullptr },
+        { "addDeceasedLv", field_type::s16, offsetof(T, addDeceasedLv), 2, 1, nullptr },
+        { "vfxId1", field_type::s32, offsetof(T, vfxId1), 4, 1, nullptr },
+        { "vfxId2", field_type::s32, offsetof(T, vfxId2), 4, 1, nullptr },
+        { "vfxId3", field_type::s32, offsetof(T, vfxId3), 4, 1, nullptr },
+        { "vfxId4", field_type::s32, offsetof(T, vfxId4), 4, 1, nullptr },
+        { "vfxId5", field_type::s32, offsetof(T, vfxId5), 4, 1, nullptr },
+        { "vfxId6", field_type::s32, offsetof(T, vfxId6), 4, 1, nullptr },
+        { "vfxId7", field_type::s32, offsetof(T, vfxId7), 4, 1, nullptr },
+        { "freezeAttackPower", field_type::s32, offsetof(T, freezeAttackPower), 4, 1, nullptr },
+        { "AppearAiSoundId", field_type::s32, offsetof(T, AppearAiSoundId), 4, 1, nullptr },
+        { "addFootEffectSfxId", field_type::s16, offsetof(T, addFootEffectSfxId), 2, 1, nullptr },
+        { "dexterityCancelSystemOnlyAddDexterity", field_type::s8, offsetof(T, dexterityCancelSystemOnlyAddDexterity), 1, 1, nullptr },
+        { "teamOffenseEffectivity", field_type::s8, offsetof(T, teamOffenseEffectivity), 1, 1, nullptr },
+        { "toughnessDamageCutRate", field_type::f32, offsetof(T, toughnessDamageCutRate), 4, 1, nullptr },
+        { "weakDmgRateA", field_type::f32, offsetof(T, weakDmgRateA), 4, 1, nullptr },
+        { "weakDmgRateB", field_type::f32, offsetof(T, weakDmgRateB), 4, 1, nullptr },
+        { "weakDmgRateC", field_type::f32, offsetof(T, weakDmgRateC), 4, 1, nullptr },
+        { "weakDmgRateD", field_type::f32, offsetof(T, weakDmgRateD), 4, 1, nullptr },
+        { "weakDmgRateE", field_type::f32, offsetof(T, weakDmgRateE), 4, 1, nullptr },
+        { "weakDmgRateF", field_type::f32, offsetof(T, weakDmgRateF), 4, 1, nullptr },
+        { "darkDamageCutRate", field_type::f32, offsetof(T, darkDamageCutRate), 4, 1, nullptr },
+        { "darkDiffenceRate", field_type::f32, offsetof(T, darkDiffenceRate), 4, 1, nullptr },
+        { "darkDiffence", field_type::s32, offsetof(T, darkDiffence), 4, 1, nullptr },
+        { "darkAttackRate", field_type::f32, offsetof(T, darkAttackRate), 4, 1, nullptr },
+        { "darkAttackPowerRate", field_type::f32, offsetof(T, darkAttackPowerRate), 4, 1, nullptr },
+        { "darkAttackPower", field_type::s32, offsetof(T, darkAttackPower), 4, 1, nullptr },
+        { "antiDarkSightRadius", field_type::f32, offsetof(T, antiDarkSightRadius), 4, 1, nullptr },
+        { "antiDarkSightDmypolyId", field_type::s32, offsetof(T, antiDarkSightDmypolyId), 4, 1, nullptr },
+        { "conditionHpRate", field_type::f32, offsetof(T, conditionHpRate), 4, 1, nullptr },
+        { "consumeStaminaRate", field_type::f32, offsetof(T, consumeStaminaRate), 4, 1, nullptr },
+        { "itemDropRate", field_type::f32, offsetof(T, itemDropRate), 4, 1, nullptr },
+        { "changePoisonResistPoint", field_type::s32, offsetof(T, changePoisonResistPoint), 4, 1, nullptr },
+        { "changeDiseaseResistPoint", field_type::s32, offsetof(T, changeDiseaseResistPoint), 4, 1, nullptr },
+        { "changeBloodResistPoint", field_type::s32, offsetof(T, changeBloodResistPoint), 4, 1, nullptr },
+        { "changeCurseResistPoint", field_type::s32, offsetof(T, changeCurseResistPoint), 4, 1, nullptr },
+        { "changeFreezeResistPoint", field_type::s32, offsetof(T, changeFreezeResistPoint), 4, 1, nullptr },
+        { "slashAttackRate", field_type::f32, offsetof(T, slashAttackRate), 4, 1, nullptr },
+        { "blowAttackRate", field_type::f32, offsetof(T, blowAttackRate), 4, 1, nullptr },
+        { "thrustAttackRate", field_type::f32, offsetof(T, thrustAttackRate), 4, 1, nullptr },
+        { "neutralAttackRate", field_type::f32, offsetof(T, neutralAttackRate), 4, 1, nullptr },
+        { "slashAttackPowerRate", field_type::f32, offsetof(T, slashAttackPowerRate), 4, 1, nullptr },
+        { "blowAttackPowerRate", field_type::f32, offsetof(T, blowAttackPowerRate), 4, 1, nullptr },
+        { "thrustAttackPowerRate", field_type::f32, offsetof(T, thrustAttackPowerRate), 4, 1, nullptr },
+        { "neutralAttackPowerRate", field_type::f32, offsetof(T, neutralAttackPowerRate), 4, 1, nullptr },
+        { "slashAttackPower", field_type::s32, offsetof(T, slashAttackPower), 4, 1, nullptr },
+        { "blowAttackPower", field_type::s32, offsetof(T, blowAttackPower), 4, 1, nullptr },
+        { "thrustAttackPower", field_type::s32, offsetof(T, thrustAttackPower), 4, 1, nullptr },
+        { "neutralAttackPower", field_type::s32, offsetof(T, neutralAttackPower), 4, 1, nullptr },
+        { "changeStrengthPoint", field_type::s32, offsetof(T, changeStrengthPoint), 4, 1, nullptr },
+        { "changeAgilityPoint", field_type::s32, offsetof(T, changeAgilityPoint), 4, 1, nullptr },
+        { "changeMagicPoint", field_type::s32, offsetof(T, changeMagicPoint), 4, 1, nullptr },
+        { "changeFaithPoint", field_type::s32, offsetof(T, changeFaithPoint), 4, 1, nullptr },
+        { "changeLuckPoint", field_type::s32, offsetof(T, changeLuckPoint), 4, 1, nullptr },
+        { "recoverArtsPoint_Str", field_type::s8, offsetof(T, recoverArtsPoint_Str), 1, 1, nullptr },
+        { "recoverArtsPoint_Dex", field_type::s8, offsetof(T, recoverArtsPoint_Dex), 1, 1, nullptr },
+        { "recoverArtsPoint_Magic", field_type::s8, offsetof(T, recoverArtsPoint_Magic), 1, 1, nullptr },
+        { "recoverArtsPoint_Miracle", field_type::s8, offsetof(T, recoverArtsPoint_Miracle), 1, 1, nullptr },
+        { "madnessDamageRate", field_type::u8, offsetof(T, madnessDamageRate), 1, 1, nullptr },
+        { "isUseStatusAilmentAtkPowerCorrect", field_type::boolean, 601, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseStatusAilmentAtkPowerCorrect; } },
+        { "isUseAtkParamAtkPowerCorrect", field_type::boolean, 601, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseAtkParamAtkPowerCorrect; } },
+        { "dontDeleteOnDead", field_type::boolean, 601, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->dontDeleteOnDead; } },
+        { "disableFreeze", field_type::boolean, 601, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableFreeze; } },
+        { "isDisableNetSync", field_type::boolean, 601, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isDisableNetSync; } },
+        { "shamanParamChange", field_type::boolean, 601, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->shamanParamChange; } },
+        { "isStopSearchedNotify", field_type::boolean, 601, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isStopSearchedNotify; } },
+        { "isCheckAboveShadowTest", field_type::boolean, 601, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isCheckAboveShadowTest; } },
+        { "addBehaviorJudgeId_add", field_type::u16, offsetof(T, addBehaviorJudgeId_add), 2, 1, nullptr },
+        { "saReceiveDamageRate", field_type::f32, offsetof(T, saReceiveDamageRate), 4, 1, nullptr },
+        { "defPlayerDmgCorrectRate_Physics", field_type::f32, offsetof(T, defPlayerDmgCorrectRate_Physics), 4, 1, nullptr },
+        { "defPlayerDmgCorrectRate_Magic", field_type::f32, offsetof(T, defPlayerDmgCorrectRate_Magic), 4, 1, nullptr },
+        { "defPlayerDmgCorrectRate_Fire", field_type::f32, offsetof(T, defPlayerDmgCorrectRate_Fire), 4, 1, nullptr },
+        { "defPlayerDmgCorrectRate_Thunder", field_type::f32, offsetof(T, defPlayerDmgCorrectRate_Thunder), 4, 1, nullptr },
+        { "defPlayerDmgCorrectRate_Dark", field_type::f32, offsetof(T, defPlayerDmgCorrectRate_Dark), 4, 1, nullptr },
+        { "defEnemyDmgCorrectRate_Physics", field_type::f32, offsetof(T, defEnemyDmgCorrectRate_Physics), 4, 1, nullptr },
+        { "defEnemyDmgCorrectRate_Magic", field_type::f32, offsetof(T, defEnemyDmgCorrectRate_Magic), 4, 1, nullptr },
+        { "defEnemyDmgCorrectRate_Fire", field_type::f32, offsetof(T, defEnemyDmgCorrectRate_Fire), 4, 1, nullptr },
+        { "defEnemyDmgCorrectRate_Thunder", field_type::f32, offsetof(T, defEnemyDmgCorrectRate_Thunder), 4, 1, nullptr },
+        { "defEnemyDmgCorrectRate_Dark", field_type::f32, offsetof(T, defEnemyDmgCorrectRate_Dark), 4, 1, nullptr },
+        { "defObjDmgCorrectRate", field_type::f32, offsetof(T, defObjDmgCorrectRate), 4, 1, nullptr },
+        { "atkPlayerDmgCorrectRate_Physics", field_type::f32, offsetof(T, atkPlayerDmgCorrectRate_Physics), 4, 1, nullptr },
+        { "atkPlayerDmgCorrectRate_Magic", field_type::f32, offsetof(T, atkPlayerDmgCorrectRate_Magic), 4, 1, nullptr },
+        { "atkPlayerDmgCorrectRate_Fire", field_type::f32, offsetof(T, atkPlayerDmgCorrectRate_Fire), 4, 1, nullptr },
+        { "atkPlayerDmgCorrectRate_Thunder", field_type::f32, offsetof(T, atkPlayerDmgCorrectRate_Thunder), 4, 1, nullptr },
+        { "atkPlayerDmgCorrectRate_Dark", field_type::f32, offsetof(T, atkPlayerDmgCorrectRate_Dark), 4, 1, nullptr },
+        { "atkEnemyDmgCorrectRate_Physics", field_type::f32, offsetof(T, atkEnemyDmgCorrectRate_Physics), 4, 1, nullptr },
+        { "atkEnemyDmgCorrectRate_Magic", field_type::f32, offsetof(T, atkEnemyDmgCorrectRate_Magic), 4, 1, nullptr },
+        { "atkEnemyDmgCorrectRate_Fire", field_type::f32, offsetof(T, atkEnemyDmgCorrectRate_Fire), 4, 1, nullptr },
+        { "atkEnemyDmgCorrectRate_Thunder", field_type::f32, offsetof(T, atkEnemyDmgCorrectRate_Thunder), 4, 1, nullptr },
+        { "atkEnemyDmgCorrectRate_Dark", field_type::f32, offsetof(T, atkEnemyDmgCorrectRate_Dark), 4, 1, nullptr },
+        { "registFreezeChangeRate", field_type::f32, offsetof(T, registFreezeChangeRate), 4, 1, nullptr },
+        { "invocationConditionsStateChange1", field_type::u16, offsetof(T, invocationConditionsStateChange1), 2, 1, nullptr },
+        { "invocationConditionsStateChange2", field_type::u16, offsetof(T, invocationConditionsStateChange2), 2, 1, nullptr },
+        { "invocationConditionsStateChange3", field_type::u16, offsetof(T, invocationConditionsStateChange3), 2, 1, nullptr },
+        { "hearingAiSoundLevel", field_type::s16, offsetof(T, hearingAiSoundLevel), 2, 1, nullptr },
+        { "chrProxyHeightRate", field_type::f32, offsetof(T, chrProxyHeightRate), 4, 1, nullptr },
+        { "addAwarePointCorrectValue_forMe", field_type::f32, offsetof(T, addAwarePointCorrectValue_forMe), 4, 1, nullptr },
+        { "addAwarePointCorrectValue_forTarget", field_type::f32, offsetof(T, addAwarePointCorrectValue_forTarget), 4, 1, nullptr },
+        { "sightSearchEnemyAdd", field_type::f32, offsetof(T, sightSearchEnemyAdd), 4, 1, nullptr },
+        { "sightSearchAdd", field_type::f32, offsetof(T, sightSearchAdd), 4, 1, nullptr },
+        { "hearingSearchAdd", field_type::f32, offsetof(T, hearingSearchAdd), 4, 1, nullptr },
+        { "hearingSearchRate", field_type::f32, offsetof(T, hearingSearchRate), 4, 1, nullptr },
+        { "hearingSearchEnemyAdd", field_type::f32, offsetof(T, hearingSearchEnemyAdd), 4, 1, nullptr },
+        { "value_Magnification", field_type::f32, offsetof(T, value_Magnification), 4, 1, nullptr },
+        { "artsConsumptionRate", field_type::f32, offsetof(T, artsConsumptionRate), 4, 1, nullptr },
+        { "magicConsumptionRate", field_type::f32, offsetof(T, magicConsumptionRate), 4, 1, nullptr },
+        { "shamanConsumptionRate", field_type::f32, offsetof(T, shamanConsumptionRate), 4, 1, nullptr },
+        { "miracleConsumptionRate", field_type::f32, offsetof(T, miracleConsumptionRate), 4, 1, nullptr },
+        { "changeHpEstusFlaskRate", field_type::s32, offsetof(T, changeHpEstusFlaskRate), 4, 1, nullptr },
+        { "changeHpEstusFlaskPoint", field_type::s32, offsetof(T, changeHpEstusFlaskPoint), 4, 1, nullptr },
+        { "changeMpEstusFlaskRate", field_type::s32, offsetof(T, changeMpEstusFlaskRate), 4, 1, nullptr },
+        { "changeMpEstusFlaskPoint", field_type::s32, offsetof(T, changeMpEstusFlaskPoint), 4, 1, nullptr },
+        { "changeHpEstusFlaskCorrectRate", field_type::f32, offsetof(T, changeHpEstusFlaskCorrectRate), 4, 1, nullptr },
+        { "changeMpEstusFlaskCorrectRate", field_type::f32, offsetof(T, changeMpEstusFlaskCorrectRate), 4, 1, nullptr },
+        { "applyIdOnGetSoul", field_type::s32, offsetof(T, applyIdOnGetSoul), 4, 1, nullptr },
+        { "extendLifeRate", field_type::f32, offsetof(T, extendLifeRate), 4, 1, nullptr },
+        { "contractLifeRate", field_type::f32, offsetof(T, contractLifeRate), 4, 1, nullptr },
+        { "defObjectAttackPowerRate", field_type::f32, offsetof(T, defObjectAttackPowerRate), 4, 1, nullptr },
+        { "effectEndDeleteDecalGroupId", field_type::s16, offsetof(T, effectEndDeleteDecalGroupId), 2, 1, nullptr },
+        { "addLifeForceStatus", field_type::s8, offsetof(T, addLifeForceStatus), 1, 1, nullptr },
+        { "addWillpowerStatus", field_type::s8, offsetof(T, addWillpowerStatus), 1, 1, nullptr },
+        { "addEndureStatus", field_type::s8, offsetof(T, addEndureStatus), 1, 1, nullptr },
+        { "addVitalityStatus", field_type::s8, offsetof(T, addVitalityStatus), 1, 1, nullptr },
+        { "addStrengthStatus", field_type::s8, offsetof(T, addStrengthStatus), 1, 1, nullptr },
+        { "addDexterityStatus", field_type::s8, offsetof(T, addDexterityStatus), 1, 1, nullptr },
+        { "addMagicStatus", field_type::s8, offsetof(T, addMagicStatus), 1, 1, nullptr },
+        { "addFaithStatus", field_type::s8, offsetof(T, addFaithStatus), 1, 1, nullptr },
+        { "addLuckStatus", field_type::s8, offsetof(T, addLuckStatus), 1, 1, nullptr },
+        { "deleteCriteriaDamage", field_type::u8, offsetof(T, deleteCriteriaDamage), 1, 1, nullptr },
+        { "magicSubCategoryChange3", field_type::u8, offsetof(T, magicSubCategoryChange3), 1, 1, nullptr },
+        { "spAttributeVariationValue", field_type::u8, offsetof(T, spAttributeVariationValue), 1, 1, nullptr },
+        { "atkFlickPower", field_type::u8, offsetof(T, atkFlickPower), 1, 1, nullptr },
+        { "wetConditionDepth", field_type::u8, offsetof(T, wetConditionDepth), 1, 1, nullptr },
+        { "changeSaRecoveryVelocity", field_type::f32, offsetof(T, changeSaRecoveryVelocity), 4, 1, nullptr },
+        { "regainRate", field_type::f32, offsetof(T, regainRate), 4, 1, nullptr },
+        { "saAttackPowerRate", field_type::f32, offsetof(T, saAttackPowerRate), 4, 1, nullptr },
+        { "sleepAttackPower", field_type::s32, offsetof(T, sleepAttackPower), 4, 1, nullptr },
+        { "madnessAttackPower", field_type::s32, offsetof(T, madnessAttackPower), 4, 1, nullptr },
+        { "registSleepChangeRate", field_type::f32, offsetof(T, registSleepChangeRate), 4, 1, nullptr },
+        { "registMadnessChangeRate", field_type::f32, offsetof(T, registMadnessChangeRate), 4, 1, nullptr },
+        { "changeSleepResistPoint", field_type::s32, offsetof(T, changeSleepResistPoint), 4, 1, nullptr },
+        { "changeMadnessResistPoint", field_type::s32, offsetof(T, changeMadnessResistPoint), 4, 1, nullptr },
+        { "sleepDamageRate", field_type::u8, offsetof(T, sleepDamageRate), 1, 1, nullptr },
+        { "applyPartsGroup", field_type::u8, offsetof(T, applyPartsGroup), 1, 1, nullptr },
+        { "clearTarget", field_type::boolean, 850, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->clearTarget; } },
+        { "fakeTargetIgnoreAjin", field_type::boolean, 850, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->fakeTargetIgnoreAjin; } },
+        { "fakeTargetIgnoreMirageArts", field_type::boolean, 850, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->fakeTargetIgnoreMirageArts; } },
+        { "requestForceJoinBlackSOS_B", field_type::boolean, 850, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->requestForceJoinBlackSOS_B; } },
+        { "unk353_4", field_type::boolean, 850, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->unk353_4; } },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 1, nullptr },
+        { "changeSuperArmorPoint", field_type::f32, offsetof(T, changeSuperArmorPoint), 4, 1, nullptr },
+        { "changeSaPoint", field_type::f32, offsetof(T, changeSaPoint), 4, 1, nullptr },
+        { "hugeEnemyPickupHeightOverwrite", field_type::f32, offsetof(T, hugeEnemyPickupHeightOverwrite), 4, 1, nullptr },
+        { "poisonDefDamageRate", field_type::f32, offsetof(T, poisonDefDamageRate), 4, 1, nullptr },
+        { "diseaseDefDamageRate", field_type::f32, offsetof(T, diseaseDefDamageRate), 4, 1, nullptr },
+        { "bloodDefDamageRate", field_type::f32, offsetof(T, bloodDefDamageRate), 4, 1, nullptr },
+        { "curseDefDamageRate", field_type::f32, offsetof(T, curseDefDamageRate), 4, 1, nullptr },
+        { "freezeDefDamageRate", field_type::f32, offsetof(T, freezeDefDamageRate), 4, 1, nullptr },
+        { "sleepDefDamageRate", field_type::f32, offsetof(T, sleepDefDamageRate), 4, 1, nullptr },
+        { "madnessDefDamageRate", field_type::f32, offsetof(T, madnessDefDamageRate), 4, 1, nullptr },
+        { "overwrite_maxBackhomeDist", field_type::u16, offsetof(T, overwrite_maxBackhomeDist), 2, 1, nullptr },
+        { "overwrite_backhomeDist", field_type::u16, offsetof(T, overwrite_backhomeDist), 2, 1, nullptr },
+        { "overwrite_backhomeBattleDist", field_type::u16, offsetof(T, overwrite_backhomeBattleDist), 2, 1, nullptr },
+        { "overwrite_BackHome_LookTargetDist", field_type::u16, offsetof(T, overwrite_BackHome_LookTargetDist), 2, 1, nullptr },
+        { "goodsConsumptionRate", field_type::f32, offsetof(T, goodsConsumptionRate), 4, 1, nullptr },
+        { "guardStaminaMult", field_type::f32, offsetof(T, guardStaminaMult), 4, 1, nullptr },
+        { "unk3", field_type::u8, offsetof(T, unk3), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, iconId) == 0);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, conditionHp) == 4);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, effectEndurance) == 8);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, motionInterval) == 12);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, maxHpRate) == 16);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, maxMpRate) == 20);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, maxStaminaRate) == 24);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, slashDamageCutRate) == 28);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, blowDamageCutRate) == 32);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, thrustDamageCutRate) == 36);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, neutralDamageCutRate) == 40);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicDamageCutRate) == 44);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, fireDamageCutRate) == 48);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, thunderDamageCutRate) == 52);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, physicsAttackRate) == 56);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicAttackRate) == 60);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, fireAttackRate) == 64);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, thunderAttackRate) == 68);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, physicsAttackPowerRate) == 72);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicAttackPowerRate) == 76);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, fireAttackPowerRate) == 80);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, thunderAttackPowerRate) == 84);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, physicsAttackPower) == 88);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicAttackPower) == 92);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, fireAttackPower) == 96);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, thunderAttackPower) == 100);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, physicsDiffenceRate) == 104);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicDiffenceRate) == 108);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, fireDiffenceRate) == 112);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, thunderDiffenceRate) == 116);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, physicsDiffence) == 120);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicDiffence) == 124);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, fireDiffence) == 128);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, thunderDiffence) == 132);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, NoGuardDamageRate) == 136);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, vitalSpotChangeRate) == 140);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, normalSpotChangeRate) == 144);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, lookAtTargetPosOffset) == 148);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, behaviorId) == 152);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeHpRate) == 156);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeHpPoint) == 160);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeMpRate) == 164);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeMpPoint) == 168);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, mpRecoverChangeSpeed) == 172);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeStaminaRate) == 176);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeStaminaPoint) == 180);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, staminaRecoverChangeSpeed) == 184);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicEffectTimeChange) == 188);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, insideDurability) == 192);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, maxDurability) == 196);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, staminaAttackRate) == 200);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, poizonAttackPower) == 204);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, diseaseAttackPower) == 208);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, bloodAttackPower) == 212);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, curseAttackPower) == 216);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, fallDamageRate) == 220);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, soulRate) == 224);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, equipWeightChangeRate) == 228);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, allItemWeightChangeRate) == 232);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, soul) == 236);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, animIdOffset) == 240);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, haveSoulRate) == 244);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, targetPriority) == 248);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, sightSearchEnemyRate) == 252);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, hearingSearchEnemyRate) == 256);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, grabityRate) == 260);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, registPoizonChangeRate) == 264);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, registDiseaseChangeRate) == 268);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, registBloodChangeRate) == 272);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, registCurseChangeRate) == 276);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, soulStealRate) == 280);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, lifeReductionRate) == 284);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, hpRecoverRate) == 288);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, replaceSpEffectId) == 292);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, cycleOccurrenceSpEffectId) == 296);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkOccurrenceSpEffectId) == 300);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, guardDefFlickPowerRate) == 304);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, guardStaminaCutRate) == 308);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, rayCastPassedTime) == 312);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicSubCategoryChange1) == 314);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicSubCategoryChange2) == 315);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, bowDistRate) == 316);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, spCategory) == 318);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, categoryPriority) == 320);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, saveCategory) == 321);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeMagicSlot) == 322);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeMiracleSlot) == 323);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, heroPointDamage) == 324);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defFlickPower) == 325);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, flickDamageCutRate) == 326);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, bloodDamageRate) == 327);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_None) == 328);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_S) == 329);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_M) == 330);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_L) == 331);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_BlowM) == 332);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_Push) == 333);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_Strike) == 334);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_BlowS) == 335);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_Min) == 336);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_Uppercut) == 337);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_BlowLL) == 338);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmgLv_Breath) == 339);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkAttribute) == 340);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, spAttribute) == 341);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, stateInfo) == 342);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, wepParamChange) == 344);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, moveType) == 345);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, lifeReductionType) == 346);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, throwCondition) == 348);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addBehaviorJudgeId_condition) == 349);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, freezeDamageRate) == 350);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, repAtkDmgLv) == 359);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, sightSearchRate) == 360);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeTeamType) == 365);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dmypolyId) == 366);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, vfxId) == 368);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, accumuOverFireId) == 372);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, accumuOverVal) == 376);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, accumuUnderFireId) == 380);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, accumuUnderVal) == 384);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, accumuVal) == 388);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, eye_angX) == 392);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, eye_angY) == 393);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addDeceasedLv) == 394);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, vfxId1) == 396);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, vfxId2) == 400);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, vfxId3) == 404);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, vfxId4) == 408);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, vfxId5) == 412);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, vfxId6) == 416);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, vfxId7) == 420);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, freezeAttackPower) == 424);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, AppearAiSoundId) == 428);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addFootEffectSfxId) == 432);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, dexterityCancelSystemOnlyAddDexterity) == 434);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, teamOffenseEffectivity) == 435);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, toughnessDamageCutRate) == 436);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, weakDmgRateA) == 440);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, weakDmgRateB) == 444);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, weakDmgRateC) == 448);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, weakDmgRateD) == 452);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, weakDmgRateE) == 456);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, weakDmgRateF) == 460);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, darkDamageCutRate) == 464);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, darkDiffenceRate) == 468);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, darkDiffence) == 472);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, darkAttackRate) == 476);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, darkAttackPowerRate) == 480);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, darkAttackPower) == 484);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, antiDarkSightRadius) == 488);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, antiDarkSightDmypolyId) == 492);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, conditionHpRate) == 496);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, consumeStaminaRate) == 500);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, itemDropRate) == 504);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changePoisonResistPoint) == 508);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeDiseaseResistPoint) == 512);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeBloodResistPoint) == 516);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeCurseResistPoint) == 520);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeFreezeResistPoint) == 524);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, slashAttackRate) == 528);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, blowAttackRate) == 532);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, thrustAttackRate) == 536);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, neutralAttackRate) == 540);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, slashAttackPowerRate) == 544);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, blowAttackPowerRate) == 548);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, thrustAttackPowerRate) == 552);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, neutralAttackPowerRate) == 556);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, slashAttackPower) == 560);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, blowAttackPower) == 564);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, thrustAttackPower) == 568);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, neutralAttackPower) == 572);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeStrengthPoint) == 576);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeAgilityPoint) == 580);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeMagicPoint) == 584);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeFaithPoint) == 588);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeLuckPoint) == 592);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, recoverArtsPoint_Str) == 596);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, recoverArtsPoint_Dex) == 597);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, recoverArtsPoint_Magic) == 598);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, recoverArtsPoint_Miracle) == 599);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, madnessDamageRate) == 600);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addBehaviorJudgeId_add) == 602);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, saReceiveDamageRate) == 604);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defPlayerDmgCorrectRate_Physics) == 608);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defPlayerDmgCorrectRate_Magic) == 612);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defPlayerDmgCorrectRate_Fire) == 616);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defPlayerDmgCorrectRate_Thunder) == 620);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defPlayerDmgCorrectRate_Dark) == 624);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defEnemyDmgCorrectRate_Physics) == 628);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defEnemyDmgCorrectRate_Magic) == 632);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defEnemyDmgCorrectRate_Fire) == 636);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defEnemyDmgCorrectRate_Thunder) == 640);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defEnemyDmgCorrectRate_Dark) == 644);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defObjDmgCorrectRate) == 648);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkPlayerDmgCorrectRate_Physics) == 652);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkPlayerDmgCorrectRate_Magic) == 656);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkPlayerDmgCorrectRate_Fire) == 660);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkPlayerDmgCorrectRate_Thunder) == 664);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkPlayerDmgCorrectRate_Dark) == 668);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkEnemyDmgCorrectRate_Physics) == 672);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkEnemyDmgCorrectRate_Magic) == 676);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkEnemyDmgCorrectRate_Fire) == 680);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkEnemyDmgCorrectRate_Thunder) == 684);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkEnemyDmgCorrectRate_Dark) == 688);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, registFreezeChangeRate) == 692);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, invocationConditionsStateChange1) == 696);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, invocationConditionsStateChange2) == 698);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, invocationConditionsStateChange3) == 700);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, hearingAiSoundLevel) == 702);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, chrProxyHeightRate) == 704);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addAwarePointCorrectValue_forMe) == 708);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addAwarePointCorrectValue_forTarget) == 712);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, sightSearchEnemyAdd) == 716);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, sightSearchAdd) == 720);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, hearingSearchAdd) == 724);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, hearingSearchRate) == 728);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, hearingSearchEnemyAdd) == 732);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, value_Magnification) == 736);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, artsConsumptionRate) == 740);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicConsumptionRate) == 744);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, shamanConsumptionRate) == 748);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, miracleConsumptionRate) == 752);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeHpEstusFlaskRate) == 756);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeHpEstusFlaskPoint) == 760);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeMpEstusFlaskRate) == 764);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeMpEstusFlaskPoint) == 768);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeHpEstusFlaskCorrectRate) == 772);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeMpEstusFlaskCorrectRate) == 776);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, applyIdOnGetSoul) == 780);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, extendLifeRate) == 784);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, contractLifeRate) == 788);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, defObjectAttackPowerRate) == 792);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, effectEndDeleteDecalGroupId) == 796);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addLifeForceStatus) == 798);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addWillpowerStatus) == 799);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addEndureStatus) == 800);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addVitalityStatus) == 801);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addStrengthStatus) == 802);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addDexterityStatus) == 803);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addMagicStatus) == 804);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addFaithStatus) == 805);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, addLuckStatus) == 806);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, deleteCriteriaDamage) == 807);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, magicSubCategoryChange3) == 808);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, spAttributeVariationValue) == 809);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, atkFlickPower) == 810);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, wetConditionDepth) == 811);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeSaRecoveryVelocity) == 812);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, regainRate) == 816);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, saAttackPowerRate) == 820);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, sleepAttackPower) == 824);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, madnessAttackPower) == 828);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, registSleepChangeRate) == 832);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, registMadnessChangeRate) == 836);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeSleepResistPoint) == 840);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeMadnessResistPoint) == 844);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, sleepDamageRate) == 848);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, applyPartsGroup) == 849);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, pad2) == 851);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeSuperArmorPoint) == 852);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, changeSaPoint) == 856);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, hugeEnemyPickupHeightOverwrite) == 860);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, poisonDefDamageRate) == 864);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, diseaseDefDamageRate) == 868);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, bloodDefDamageRate) == 872);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, curseDefDamageRate) == 876);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, freezeDefDamageRate) == 880);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, sleepDefDamageRate) == 884);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, madnessDefDamageRate) == 888);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, overwrite_maxBackhomeDist) == 892);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, overwrite_backhomeDist) == 894);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, overwrite_backhomeBattleDist) == 896);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, overwrite_BackHome_LookTargetDist) == 898);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, goodsConsumptionRate) == 900);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, guardStaminaMult) == 904);
+static_assert(offsetof(paramdef::SP_EFFECT_PARAM_ST, unk3) == 908);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,30 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SP_EFFECT_SET_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SP_EFFECT_SET_PARAM_ST> {
+    using T = paramdef::SP_EFFECT_SET_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "spEffectId1", field_type::s32, offsetof(T, spEffectId1), 4, 1, nullptr },
+        { "spEffectId2", field_type::s32, offsetof(T, spEffectId2), 4, 1, nullptr },
+        { "spEffectId3", field_type::s32, offsetof(T, spEffectId3), 4, 1, nullptr },
+        { "spEffectId4", field_type::s32, offsetof(T, spEffectId4), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SP_EFFECT_SET_PARAM_ST, spEffectId1) == 0);
+static_assert(offsetof(paramdef::SP_EFFECT_SET_PARAM_ST, spEffectId2) == 4);
+static_assert(offsetof(paramdef::SP_EFFECT_SET_PARAM_ST, spEffectId3) == 8);
+static_assert(offsetof(paramdef::SP_EFFECT_SET_PARAM_ST, spEffectId4) == 12);
+
+}; // namespace params
+}; // namespace from
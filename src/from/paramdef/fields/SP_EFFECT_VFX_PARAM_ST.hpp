@@ -0,0 +1,136 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SP_EFFECT_VFX_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SP_EFFECT_VFX_PARAM_ST> {
+    using T = paramdef::SP_EFFECT_VFX_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 65> fields = {{
+        { "midstSfxId", field_type::s32, offsetof(T, midstSfxId), 4, 1, nullptr },
+        { "midstSeId", field_type::s32, offsetof(T, midstSeId), 4, 1, nullptr },
+        { "initSfxId", field_type::s32, offsetof(T, initSfxId), 4, 1, nullptr },
+        { "initSeId", field_type::s32, offsetof(T, initSeId), 4, 1, nullptr },
+        { "finishSfxId", field_type::s32, offsetof(T, finishSfxId), 4, 1, nullptr },
+        { "finishSeId", field_type::s32, offsetof(T, finishSeId), 4, 1, nullptr },
+        { "camouflageBeginDist", field_type::f32, offsetof(T, camouflageBeginDist), 4, 1, nullptr },
+        { "camouflageEndDist", field_type::f32, offsetof(T, camouflageEndDist), 4, 1, nullptr },
+        { "transformProtectorId", field_type::s32, offsetof(T, transformProtectorId), 4, 1, nullptr },
+        { "midstDmyId", field_type::s16, offsetof(T, midstDmyId), 2, 1, nullptr },
+        { "initDmyId", field_type::s16, offsetof(T, initDmyId), 2, 1, nullptr },
+        { "finishDmyId", field_type::s16, offsetof(T, finishDmyId), 2, 1, nullptr },
+        { "effectType", field_type::u8, offsetof(T, effectType), 1, 1, nullptr },
+        { "soulParamIdForWepEnchant", field_type::u8, offsetof(T, soulParamIdForWepEnchant), 1, 1, nullptr },
+        { "playCategory", field_type::u8, offsetof(T, playCategory), 1, 1, nullptr },
+        { "playPriority", field_type::u8, offsetof(T, playPriority), 1, 1, nullptr },
+        { "existEffectForLarge", field_type::boolean, 46, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->existEffectForLarge; } },
+        { "existEffectForSoul", field_type::boolean, 46, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->existEffectForSoul; } },
+        { "effectInvisibleAtCamouflage", field_type::boolean, 46, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->effectInvisibleAtCamouflage; } },
+        { "useCamouflage", field_type::boolean, 46, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->useCamouflage; } },
+        { "invisibleAtFriendCamouflage", field_type::boolean, 46, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->invisibleAtFriendCamouflage; } },
+        { "isHideFootEffect_forCamouflage", field_type::boolean, 46, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isHideFootEffect_forCamouflage; } },
+        { "halfCamouflage", field_type::boolean, 46, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->halfCamouflage; } },
+        { "isFullBodyTransformProtectorId", field_type::boolean, 46, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isFullBodyTransformProtectorId; } },
+        { "isInvisibleWeapon", field_type::boolean, 47, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isInvisibleWeapon; } },
+        { "isSilence", field_type::boolean, 47, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSilence; } },
+        { "isMidstFullbody", field_type::boolean, 47, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isMidstFullbody; } },
+        { "isInitFullbody", field_type::boolean, 47, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isInitFullbody; } },
+        { "isFinishFullbody", field_type::boolean, 47, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isFinishFullbody; } },
+        { "isVisibleDeadChr", field_type::boolean, 47, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isVisibleDeadChr; } },
+        { "isUseOffsetEnchantSfxSize", field_type::boolean, 47, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isUseOffsetEnchantSfxSize; } },
+        { "pad_1", field_type::u8, 47, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad_1; } },
+        { "decalId1", field_type::s32, offsetof(T, decalId1), 4, 1, nullptr },
+        { "decalId2", field_type::s32, offsetof(T, decalId2), 4, 1, nullptr },
+        { "footEffectPriority", field_type::u8, offsetof(T, footEffectPriority), 1, 1, nullptr },
+        { "footEffectOffset", field_type::u8, offsetof(T, footEffectOffset), 1, 1, nullptr },
+        { "traceSfxIdOffsetType", field_type::u8, offsetof(T, traceSfxIdOffsetType), 1, 1, nullptr },
+        { "forceDeceasedType", field_type::u8, offsetof(T, forceDeceasedType), 1, 1, nullptr },
+        { "enchantStartDmyId_0", field_type::s32, offsetof(T, enchantStartDmyId_0), 4, 1, nullptr },
+        { "enchantEndDmyId_0", field_type::s32, offsetof(T, enchantEndDmyId_0), 4, 1, nullptr },
+        { "enchantStartDmyId_1", field_type::s32, offsetof(T, enchantStartDmyId_1), 4, 1, nullptr },
+        { "enchantEndDmyId_1", field_type::s32, offsetof(T, enchantEndDmyId_1), 4, 1, nullptr },
+        { "enchantStartDmyId_2", field_type::s32, offsetof(T, enchantStartDmyId_2), 4, 1, nullptr },
+        { "enchantEndDmyId_2", field_type::s32, offsetof(T, enchantEndDmyId_2), 4, 1, nullptr },
+        { "enchantStartDmyId_3", field_type::s32, offsetof(T, enchantStartDmyId_3), 4, 1, nullptr },
+        { "enchantEndDmyId_3", field_type::s32, offsetof(T, enchantEndDmyId_3), 4, 1, nullptr },
+        { "enchantStartDmyId_4", field_type::s32, offsetof(T, enchantStartDmyId_4), 4, 1, nullptr },
+        { "enchantEndDmyId_4", field_type::s32, offsetof(T, enchantEndDmyId_4), 4, 1, nullptr },
+        { "enchantStartDmyId_5", field_type::s32, offsetof(T, enchantStartDmyId_5), 4, 1, nullptr },
+        { "enchantEndDmyId_5", field_type::s32, offsetof(T, enchantEndDmyId_5), 4, 1, nullptr },
+        { "enchantStartDmyId_6", field_type::s32, offsetof(T, enchantStartDmyId_6), 4, 1, nullptr },
+        { "enchantEndDmyId_6", field_type::s32, offsetof(T, enchantEndDmyId_6), 4, 1, nullptr },
+        { "enchantStartDmyId_7", field_type::s32, offsetof(T, enchantStartDmyId_7), 4, 1, nullptr },
+        { "enchantEndDmyId_7", field_type::s32, offsetof(T, enchantEndDmyId_7), 4, 1, nullptr },
+        { "SfxIdOffsetType", field_type::u8, offsetof(T, SfxIdOffsetType), 1, 1, nullptr },
+        { "phantomParamOverwriteType", field_type::u8, offsetof(T, phantomParamOverwriteType), 1, 1, nullptr },
+        { "camouflageMinAlpha", field_type::u8, offsetof(T, camouflageMinAlpha), 1, 1, nullptr },
+        { "wetAspectType", field_type::u8, offsetof(T, wetAspectType), 1, 1, nullptr },
+        { "phantomParamOverwriteId", field_type::s32, offsetof(T, phantomParamOverwriteId), 4, 1, nullptr },
+        { "materialParamId", field_type::s32, offsetof(T, materialParamId), 4, 1, nullptr },
+        { "materialParamInitValue", field_type::f32, offsetof(T, materialParamInitValue), 4, 1, nullptr },
+        { "materialParamTargetValue", field_type::f32, offsetof(T, materialParamTargetValue), 4, 1, nullptr },
+        { "materialParamFadeTime", field_type::f32, offsetof(T, materialParamFadeTime), 4, 1, nullptr },
+        { "footDecalMaterialOffsetOverwriteId", field_type::s16, offsetof(T, footDecalMaterialOffsetOverwriteId), 2, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 14, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, midstSfxId) == 0);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, midstSeId) == 4);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, initSfxId) == 8);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, initSeId) == 12);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, finishSfxId) == 16);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, finishSeId) == 20);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, camouflageBeginDist) == 24);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, camouflageEndDist) == 28);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, transformProtectorId) == 32);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, midstDmyId) == 36);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, initDmyId) == 38);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, finishDmyId) == 40);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, effectType) == 42);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, soulParamIdForWepEnchant) == 43);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, playCategory) == 44);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, playPriority) == 45);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, decalId1) == 48);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, decalId2) == 52);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, footEffectPriority) == 56);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, footEffectOffset) == 57);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, traceSfxIdOffsetType) == 58);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, forceDeceasedType) == 59);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantStartDmyId_0) == 60);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantEndDmyId_0) == 64);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantStartDmyId_1) == 68);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantEndDmyId_1) == 72);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantStartDmyId_2) == 76);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantEndDmyId_2) == 80);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantStartDmyId_3) == 84);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantEndDmyId_3) == 88);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantStartDmyId_4) == 92);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantEndDmyId_4) == 96);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantStartDmyId_5) == 100);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantEndDmyId_5) == 104);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantStartDmyId_6) == 108);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantEndDmyId_6) == 112);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantStartDmyId_7) == 116);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, enchantEndDmyId_7) == 120);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, SfxIdOffsetType) == 124);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, phantomParamOverwriteType) == 125);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, camouflageMinAlpha) == 126);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, wetAspectType) == 127);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, phantomParamOverwriteId) == 128);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, materialParamId) == 132);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, materialParamInitValue) == 136);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, materialParamTargetValue) == 140);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, materialParamFadeTime) == 144);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, footDecalMaterialOffsetOverwriteId) == 148);
+static_assert(offsetof(paramdef::SP_EFFECT_VFX_PARAM_ST, pad) == 150);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,63 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../SWORD_ARTS_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::SWORD_ARTS_PARAM_ST> {
+    using T = paramdef::SWORD_ARTS_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 24> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "swordArtsType", field_type::u8, offsetof(T, swordArtsType), 1, 1, nullptr },
+        { "artsSpeedType", field_type::u8, offsetof(T, artsSpeedType), 1, 1, nullptr },
+        { "refStatus", field_type::s8, offsetof(T, refStatus), 1, 1, nullptr },
+        { "isRefRightArts", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isRefRightArts; } },
+        { "isGrayoutLeftHand", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isGrayoutLeftHand; } },
+        { "isGrayoutRightHand", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isGrayoutRightHand; } },
+        { "isGrayoutBothHand", field_type::boolean, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isGrayoutBothHand; } },
+        { "reserve2", field_type::u8, 7, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->reserve2; } },
+        { "usePoint_L1", field_type::s8, offsetof(T, usePoint_L1), 1, 1, nullptr },
+        { "usePoint_L2", field_type::s8, offsetof(T, usePoint_L2), 1, 1, nullptr },
+        { "usePoint_R1", field_type::s8, offsetof(T, usePoint_R1), 1, 1, nullptr },
+        { "usePoint_R2", field_type::s8, offsetof(T, usePoint_R2), 1, 1, nullptr },
+        { "textId", field_type::s32, offsetof(T, textId), 4, 1, nullptr },
+        { "useMagicPoint_L1", field_type::s16, offsetof(T, useMagicPoint_L1), 2, 1, nullptr },
+        { "useMagicPoint_L2", field_type::s16, offsetof(T, useMagicPoint_L2), 2, 1, nullptr },
+        { "useMagicPoint_R1", field_type::s16, offsetof(T, useMagicPoint_R1), 2, 1, nullptr },
+        { "useMagicPoint_R2", field_type::s16, offsetof(T, useMagicPoint_R2), 2, 1, nullptr },
+        { "shieldIconType", field_type::s8, offsetof(T, shieldIconType), 1, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 1, nullptr },
+        { "iconId", field_type::u16, offsetof(T, iconId), 2, 1, nullptr },
+        { "aiUsageId", field_type::s32, offsetof(T, aiUsageId), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, swordArtsType) == 4);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, artsSpeedType) == 5);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, refStatus) == 6);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, usePoint_L1) == 8);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, usePoint_L2) == 9);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, usePoint_R1) == 10);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, usePoint_R2) == 11);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, textId) == 12);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, useMagicPoint_L1) == 16);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, useMagicPoint_L2) == 18);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, useMagicPoint_R1) == 20);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, useMagicPoint_R2) == 22);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, shieldIconType) == 24);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, pad) == 25);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, iconId) == 26);
+static_assert(offsetof(paramdef::SWORD_ARTS_PARAM_ST, aiUsageId) == 28);
+
+}; // namespace params
+}; // namespace from
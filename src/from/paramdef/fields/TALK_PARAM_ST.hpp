@@ -0,0 +1,62 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../TALK_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::TALK_PARAM_ST> {
+    using T = paramdef::TALK_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 22> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "msgId", field_type::s32, offsetof(T, msgId), 4, 1, nullptr },
+        { "voiceId", field_type::s32, offsetof(T, voiceId), 4, 1, nullptr },
+        { "spEffectId0", field_type::s32, offsetof(T, spEffectId0), 4, 1, nullptr },
+        { "motionId0", field_type::s32, offsetof(T, motionId0), 4, 1, nullptr },
+        { "spEffectId1", field_type::s32, offsetof(T, spEffectId1), 4, 1, nullptr },
+        { "motionId1", field_type::s32, offsetof(T, motionId1), 4, 1, nullptr },
+        { "returnPos", field_type::s32, offsetof(T, returnPos), 4, 1, nullptr },
+        { "reactionId", field_type::s32, offsetof(T, reactionId), 4, 1, nullptr },
+        { "eventId", field_type::s32, offsetof(T, eventId), 4, 1, nullptr },
+        { "msgId_female", field_type::s32, offsetof(T, msgId_female), 4, 1, nullptr },
+        { "voiceId_female", field_type::s32, offsetof(T, voiceId_female), 4, 1, nullptr },
+        { "lipSyncStart", field_type::s16, offsetof(T, lipSyncStart), 2, 1, nullptr },
+        { "lipSyncTime", field_type::s16, offsetof(T, lipSyncTime), 2, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 4, nullptr },
+        { "timeout", field_type::f32, offsetof(T, timeout), 4, 1, nullptr },
+        { "talkAnimationId", field_type::s32, offsetof(T, talkAnimationId), 4, 1, nullptr },
+        { "isForceDisp", field_type::boolean, 64, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isForceDisp; } },
+        { "pad3", field_type::u8, 64, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad3; } },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 31, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::TALK_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, msgId) == 4);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, voiceId) == 8);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, spEffectId0) == 12);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, motionId0) == 16);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, spEffectId1) == 20);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, motionId1) == 24);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, returnPos) == 28);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, reactionId) == 32);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, eventId) == 36);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, msgId_female) == 40);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, voiceId_female) == 44);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, lipSyncStart) == 48);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, lipSyncTime) == 50);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, pad2) == 52);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, timeout) == 56);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, talkAnimationId) == 60);
+static_assert(offsetof(paramdef::TALK_PARAM_ST, pad1) == 65);
+
+}; // namespace params
+}; // namespace from
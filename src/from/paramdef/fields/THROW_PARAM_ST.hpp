@@ -0,0 +1,99 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../THROW_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::THROW_PARAM_ST> {
+    using T = paramdef::THROW_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 42> fields = {{
+        { "AtkChrId", field_type::s32, offsetof(T, AtkChrId), 4, 1, nullptr },
+        { "DefChrId", field_type::s32, offsetof(T, DefChrId), 4, 1, nullptr },
+        { "Dist", field_type::f32, offsetof(T, Dist), 4, 1, nullptr },
+        { "DiffAngMin", field_type::f32, offsetof(T, DiffAngMin), 4, 1, nullptr },
+        { "DiffAngMax", field_type::f32, offsetof(T, DiffAngMax), 4, 1, nullptr },
+        { "upperYRange", field_type::f32, offsetof(T, upperYRange), 4, 1, nullptr },
+        { "lowerYRange", field_type::f32, offsetof(T, lowerYRange), 4, 1, nullptr },
+        { "diffAngMyToDef", field_type::f32, offsetof(T, diffAngMyToDef), 4, 1, nullptr },
+        { "throwTypeId", field_type::s32, offsetof(T, throwTypeId), 4, 1, nullptr },
+        { "atkAnimId", field_type::s32, offsetof(T, atkAnimId), 4, 1, nullptr },
+        { "defAnimId", field_type::s32, offsetof(T, defAnimId), 4, 1, nullptr },
+        { "escHp", field_type::u16, offsetof(T, escHp), 2, 1, nullptr },
+        { "selfEscCycleTime", field_type::u16, offsetof(T, selfEscCycleTime), 2, 1, nullptr },
+        { "sphereCastRadiusRateTop", field_type::u16, offsetof(T, sphereCastRadiusRateTop), 2, 1, nullptr },
+        { "sphereCastRadiusRateLow", field_type::u16, offsetof(T, sphereCastRadiusRateLow), 2, 1, nullptr },
+        { "PadType", field_type::u8, offsetof(T, PadType), 1, 1, nullptr },
+        { "AtkEnableState", field_type::u8, offsetof(T, AtkEnableState), 1, 1, nullptr },
+        { "throwFollowingType", field_type::u8, offsetof(T, throwFollowingType), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 1, nullptr },
+        { "throwType", field_type::u8, offsetof(T, throwType), 1, 1, nullptr },
+        { "selfEscCycleCnt", field_type::u8, offsetof(T, selfEscCycleCnt), 1, 1, nullptr },
+        { "dmyHasChrDirType", field_type::u8, offsetof(T, dmyHasChrDirType), 1, 1, nullptr },
+        { "isTurnAtker", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isTurnAtker; } },
+        { "isSkipWepCate", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSkipWepCate; } },
+        { "isSkipSphereCast", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isSkipSphereCast; } },
+        { "isEnableCorrectPos_forThrowAdjust", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableCorrectPos_forThrowAdjust; } },
+        { "isEnableThrowFollowingFallAssist", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableThrowFollowingFallAssist; } },
+        { "isEnableThrowFollowingFeedback", field_type::boolean, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableThrowFollowingFeedback; } },
+        { "pad0", field_type::u8, 59, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad0; } },
+        { "atkSorbDmyId", field_type::s16, offsetof(T, atkSorbDmyId), 2, 1, nullptr },
+        { "defSorbDmyId", field_type::s16, offsetof(T, defSorbDmyId), 2, 1, nullptr },
+        { "Dist_start", field_type::f32, offsetof(T, Dist_start), 4, 1, nullptr },
+        { "DiffAngMin_start", field_type::f32, offsetof(T, DiffAngMin_start), 4, 1, nullptr },
+        { "DiffAngMax_start", field_type::f32, offsetof(T, DiffAngMax_start), 4, 1, nullptr },
+        { "upperYRange_start", field_type::f32, offsetof(T, upperYRange_start), 4, 1, nullptr },
+        { "lowerYRange_start", field_type::f32, offsetof(T, lowerYRange_start), 4, 1, nullptr },
+        { "diffAngMyToDef_start", field_type::f32, offsetof(T, diffAngMyToDef_start), 4, 1, nullptr },
+        { "judgeRangeBasePosDmyId1", field_type::s32, offsetof(T, judgeRangeBasePosDmyId1), 4, 1, nullptr },
+        { "judgeRangeBasePosDmyId2", field_type::s32, offsetof(T, judgeRangeBasePosDmyId2), 4, 1, nullptr },
+        { "adsrobModelPosInterpolationTime", field_type::f32, offsetof(T, adsrobModelPosInterpolationTime), 4, 1, nullptr },
+        { "throwFollowingEndEasingTime", field_type::f32, offsetof(T, throwFollowingEndEasingTime), 4, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 24, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::THROW_PARAM_ST, AtkChrId) == 0);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, DefChrId) == 4);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, Dist) == 8);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, DiffAngMin) == 12);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, DiffAngMax) == 16);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, upperYRange) == 20);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, lowerYRange) == 24);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, diffAngMyToDef) == 28);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, throwTypeId) == 32);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, atkAnimId) == 36);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, defAnimId) == 40);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, escHp) == 44);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, selfEscCycleTime) == 46);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, sphereCastRadiusRateTop) == 48);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, sphereCastRadiusRateLow) == 50);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, PadType) == 52);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, AtkEnableState) == 53);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, throwFollowingType) == 54);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, pad2) == 55);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, throwType) == 56);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, selfEscCycleCnt) == 57);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, dmyHasChrDirType) == 58);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, atkSorbDmyId) == 60);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, defSorbDmyId) == 62);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, Dist_start) == 64);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, DiffAngMin_start) == 68);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, DiffAngMax_start) == 72);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, upperYRange_start) == 76);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, lowerYRange_start) == 80);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, diffAngMyToDef_start) == 84);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, judgeRangeBasePosDmyId1) == 88);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, judgeRangeBasePosDmyId2) == 92);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, adsrobModelPosInterpolationTime) == 96);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, throwFollowingEndEasingTime) == 100);
+static_assert(offsetof(paramdef::THROW_PARAM_ST, pad1) == 104);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,36 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../TOUGHNESS_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::TOUGHNESS_PARAM_ST> {
+    using T = paramdef::TOUGHNESS_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 7> fields = {{
+        { "correctionRate", field_type::f32, offsetof(T, correctionRate), 4, 1, nullptr },
+        { "minToughness", field_type::u16, offsetof(T, minToughness), 2, 1, nullptr },
+        { "isNonEffectiveCorrectionForMin", field_type::boolean, offsetof(T, isNonEffectiveCorrectionForMin), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 1, nullptr },
+        { "spEffectId", field_type::s32, offsetof(T, spEffectId), 4, 1, nullptr },
+        { "proCorrectionRate", field_type::f32, offsetof(T, proCorrectionRate), 4, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 16, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::TOUGHNESS_PARAM_ST, correctionRate) == 0);
+static_assert(offsetof(paramdef::TOUGHNESS_PARAM_ST, minToughness) == 4);
+static_assert(offsetof(paramdef::TOUGHNESS_PARAM_ST, isNonEffectiveCorrectionForMin) == 6);
+static_assert(offsetof(paramdef::TOUGHNESS_PARAM_ST, pad2) == 7);
+static_assert(offsetof(paramdef::TOUGHNESS_PARAM_ST, spEffectId) == 8);
+static_assert(offsetof(paramdef::TOUGHNESS_PARAM_ST, proCorrectionRate) == 12);
+static_assert(offsetof(paramdef::TOUGHNESS_PARAM_ST, pad1) == 16);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,48 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../TUTORIAL_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::TUTORIAL_PARAM_ST> {
+    using T = paramdef::TUTORIAL_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 14> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "menuType", field_type::u8, offsetof(T, menuType), 1, 1, nullptr },
+        { "triggerType", field_type::u8, offsetof(T, triggerType), 1, 1, nullptr },
+        { "repeatType", field_type::u8, offsetof(T, repeatType), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 1, nullptr },
+        { "imageId", field_type::u16, offsetof(T, imageId), 2, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 2, nullptr },
+        { "unlockEventFlagId", field_type::u32, offsetof(T, unlockEventFlagId), 4, 1, nullptr },
+        { "textId", field_type::s32, offsetof(T, textId), 4, 1, nullptr },
+        { "displayMinTime", field_type::f32, offsetof(T, displayMinTime), 4, 1, nullptr },
+        { "displayTime", field_type::f32, offsetof(T, displayTime), 4, 1, nullptr },
+        { "pad3", field_type::u8, offsetof(T, pad3), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, menuType) == 4);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, triggerType) == 5);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, repeatType) == 6);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, pad1) == 7);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, imageId) == 8);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, pad2) == 10);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, unlockEventFlagId) == 12);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, textId) == 16);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, displayMinTime) == 20);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, displayTime) == 24);
+static_assert(offsetof(paramdef::TUTORIAL_PARAM_ST, pad3) == 28);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,32 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WAYPOINT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WAYPOINT_PARAM_ST> {
+    using T = paramdef::WAYPOINT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 5> fields = {{
+        { "attribute1", field_type::s16, offsetof(T, attribute1), 2, 1, nullptr },
+        { "attribute2", field_type::s16, offsetof(T, attribute2), 2, 1, nullptr },
+        { "attribute3", field_type::s16, offsetof(T, attribute3), 2, 1, nullptr },
+        { "attribute4", field_type::s16, offsetof(T, attribute4), 2, 1, nullptr },
+        { "padding4", field_type::u8, offsetof(T, padding4), 1, 8, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WAYPOINT_PARAM_ST, attribute1) == 0);
+static_assert(offsetof(paramdef::WAYPOINT_PARAM_ST, attribute2) == 2);
+static_assert(offsetof(paramdef::WAYPOINT_PARAM_ST, attribute3) == 4);
+static_assert(offsetof(paramdef::WAYPOINT_PARAM_ST, attribute4) == 6);
+static_assert(offsetof(paramdef::WAYPOINT_PARAM_ST, padding4) == 8);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,70 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WEATHER_ASSET_CREATE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WEATHER_ASSET_CREATE_PARAM_ST> {
+    using T = paramdef::WEATHER_ASSET_CREATE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 24> fields = {{
+        { "AssetId", field_type::u32, offsetof(T, AssetId), 4, 1, nullptr },
+        { "SlotNo", field_type::u32, offsetof(T, SlotNo), 4, 1, nullptr },
+        { "CreateConditionType", field_type::u8, offsetof(T, CreateConditionType), 1, 1, nullptr },
+        { "padding0", field_type::u8, offsetof(T, padding0), 1, 3, nullptr },
+        { "TransitionSrcWeather", field_type::s16, offsetof(T, TransitionSrcWeather), 2, 1, nullptr },
+        { "TransitionDstWeather", field_type::s16, offsetof(T, TransitionDstWeather), 2, 1, nullptr },
+        { "ElapsedTimeCheckweather", field_type::s16, offsetof(T, ElapsedTimeCheckweather), 2, 1, nullptr },
+        { "padding1", field_type::u8, offsetof(T, padding1), 1, 2, nullptr },
+        { "ElapsedTime", field_type::f32, offsetof(T, ElapsedTime), 4, 1, nullptr },
+        { "CreateDelayTime", field_type::f32, offsetof(T, CreateDelayTime), 4, 1, nullptr },
+        { "CreateProbability", field_type::u32, offsetof(T, CreateProbability), 4, 1, nullptr },
+        { "LifeTime", field_type::f32, offsetof(T, LifeTime), 4, 1, nullptr },
+        { "FadeTime", field_type::f32, offsetof(T, FadeTime), 4, 1, nullptr },
+        { "EnableCreateTimeMin", field_type::f32, offsetof(T, EnableCreateTimeMin), 4, 1, nullptr },
+        { "EnableCreateTimeMax", field_type::f32, offsetof(T, EnableCreateTimeMax), 4, 1, nullptr },
+        { "CreatePoint0", field_type::s16, offsetof(T, CreatePoint0), 2, 1, nullptr },
+        { "CreatePoint1", field_type::s16, offsetof(T, CreatePoint1), 2, 1, nullptr },
+        { "CreatePoint2", field_type::s16, offsetof(T, CreatePoint2), 2, 1, nullptr },
+        { "CreatePoint3", field_type::s16, offsetof(T, CreatePoint3), 2, 1, nullptr },
+        { "CreateAssetLimitId0", field_type::s8, offsetof(T, CreateAssetLimitId0), 1, 1, nullptr },
+        { "CreateAssetLimitId1", field_type::s8, offsetof(T, CreateAssetLimitId1), 1, 1, nullptr },
+        { "CreateAssetLimitId2", field_type::s8, offsetof(T, CreateAssetLimitId2), 1, 1, nullptr },
+        { "CreateAssetLimitId3", field_type::s8, offsetof(T, CreateAssetLimitId3), 1, 1, nullptr },
+        { "Reserved2", field_type::u8, offsetof(T, Reserved2), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, AssetId) == 0);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, SlotNo) == 4);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreateConditionType) == 8);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, padding0) == 9);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, TransitionSrcWeather) == 12);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, TransitionDstWeather) == 14);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, ElapsedTimeCheckweather) == 16);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, padding1) == 18);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, ElapsedTime) == 20);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreateDelayTime) == 24);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreateProbability) == 28);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, LifeTime) == 32);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, FadeTime) == 36);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, EnableCreateTimeMin) == 40);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, EnableCreateTimeMax) == 44);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreatePoint0) == 48);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreatePoint1) == 50);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreatePoint2) == 52);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreatePoint3) == 54);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreateAssetLimitId0) == 56);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreateAssetLimitId1) == 57);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreateAssetLimitId2) == 58);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, CreateAssetLimitId3) == 59);
+static_assert(offsetof(paramdef::WEATHER_ASSET_CREATE_PARAM_ST, Reserved2) == 60);
+
+}; // namespace params
+}; // namespace from
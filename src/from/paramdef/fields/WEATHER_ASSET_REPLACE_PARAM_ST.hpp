@@ -0,0 +1,62 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WEATHER_ASSET_REPLACE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WEATHER_ASSET_REPLACE_PARAM_ST> {
+    using T = paramdef::WEATHER_ASSET_REPLACE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 20> fields = {{
+        { "mapId", field_type::u32, offsetof(T, mapId), 4, 1, nullptr },
+        { "TransitionSrcWeather", field_type::s16, offsetof(T, TransitionSrcWeather), 2, 1, nullptr },
+        { "padding0", field_type::u8, offsetof(T, padding0), 1, 2, nullptr },
+        { "isFireAsh", field_type::boolean, offsetof(T, isFireAsh), 1, 1, nullptr },
+        { "padding1", field_type::u8, offsetof(T, padding1), 1, 3, nullptr },
+        { "reserved2", field_type::u32, offsetof(T, reserved2), 4, 1, nullptr },
+        { "AssetId0", field_type::s32, offsetof(T, AssetId0), 4, 1, nullptr },
+        { "AssetId1", field_type::s32, offsetof(T, AssetId1), 4, 1, nullptr },
+        { "AssetId2", field_type::s32, offsetof(T, AssetId2), 4, 1, nullptr },
+        { "AssetId3", field_type::s32, offsetof(T, AssetId3), 4, 1, nullptr },
+        { "AssetId4", field_type::s32, offsetof(T, AssetId4), 4, 1, nullptr },
+        { "AssetId5", field_type::s32, offsetof(T, AssetId5), 4, 1, nullptr },
+        { "AssetId6", field_type::s32, offsetof(T, AssetId6), 4, 1, nullptr },
+        { "AssetId7", field_type::s32, offsetof(T, AssetId7), 4, 1, nullptr },
+        { "reserved0", field_type::u8, offsetof(T, reserved0), 1, 8, nullptr },
+        { "CreateAssetLimitId0", field_type::s8, offsetof(T, CreateAssetLimitId0), 1, 1, nullptr },
+        { "CreateAssetLimitId1", field_type::s8, offsetof(T, CreateAssetLimitId1), 1, 1, nullptr },
+        { "CreateAssetLimitId2", field_type::s8, offsetof(T, CreateAssetLimitId2), 1, 1, nullptr },
+        { "CreateAssetLimitId3", field_type::s8, offsetof(T, CreateAssetLimitId3), 1, 1, nullptr },
+        { "reserved1", field_type::u8, offsetof(T, reserved1), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, mapId) == 0);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, TransitionSrcWeather) == 4);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, padding0) == 6);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, isFireAsh) == 8);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, padding1) == 9);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, reserved2) == 12);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, AssetId0) == 16);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, AssetId1) == 20);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, AssetId2) == 24);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, AssetId3) == 28);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, AssetId4) == 32);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, AssetId5) == 36);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, AssetId6) == 40);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, AssetId7) == 44);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, reserved0) == 48);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, CreateAssetLimitId0) == 56);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, CreateAssetLimitId1) == 57);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, CreateAssetLimitId2) == 58);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, CreateAssetLimitId3) == 59);
+static_assert(offsetof(paramdef::WEATHER_ASSET_REPLACE_PARAM_ST, reserved1) == 60);
+
+}; // namespace params
+}; // namespace from
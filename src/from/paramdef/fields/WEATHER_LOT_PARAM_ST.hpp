@@ -0,0 +1,102 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WEATHER_LOT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WEATHER_LOT_PARAM_ST> {
+    using T = paramdef::WEATHER_LOT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 41> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "weatherType0", field_type::s16, offsetof(T, weatherType0), 2, 1, nullptr },
+        { "weatherType1", field_type::s16, offsetof(T, weatherType1), 2, 1, nullptr },
+        { "weatherType2", field_type::s16, offsetof(T, weatherType2), 2, 1, nullptr },
+        { "weatherType3", field_type::s16, offsetof(T, weatherType3), 2, 1, nullptr },
+        { "weatherType4", field_type::s16, offsetof(T, weatherType4), 2, 1, nullptr },
+        { "weatherType5", field_type::s16, offsetof(T, weatherType5), 2, 1, nullptr },
+        { "weatherType6", field_type::s16, offsetof(T, weatherType6), 2, 1, nullptr },
+        { "weatherType7", field_type::s16, offsetof(T, weatherType7), 2, 1, nullptr },
+        { "weatherType8", field_type::s16, offsetof(T, weatherType8), 2, 1, nullptr },
+        { "weatherType9", field_type::s16, offsetof(T, weatherType9), 2, 1, nullptr },
+        { "weatherType10", field_type::s16, offsetof(T, weatherType10), 2, 1, nullptr },
+        { "weatherType11", field_type::s16, offsetof(T, weatherType11), 2, 1, nullptr },
+        { "weatherType12", field_type::s16, offsetof(T, weatherType12), 2, 1, nullptr },
+        { "weatherType13", field_type::s16, offsetof(T, weatherType13), 2, 1, nullptr },
+        { "weatherType14", field_type::s16, offsetof(T, weatherType14), 2, 1, nullptr },
+        { "weatherType15", field_type::s16, offsetof(T, weatherType15), 2, 1, nullptr },
+        { "lotteryWeight0", field_type::u16, offsetof(T, lotteryWeight0), 2, 1, nullptr },
+        { "lotteryWeight1", field_type::u16, offsetof(T, lotteryWeight1), 2, 1, nullptr },
+        { "lotteryWeight2", field_type::u16, offsetof(T, lotteryWeight2), 2, 1, nullptr },
+        { "lotteryWeight3", field_type::u16, offsetof(T, lotteryWeight3), 2, 1, nullptr },
+        { "lotteryWeight4", field_type::u16, offsetof(T, lotteryWeight4), 2, 1, nullptr },
+        { "lotteryWeight5", field_type::u16, offsetof(T, lotteryWeight5), 2, 1, nullptr },
+        { "lotteryWeight6", field_type::u16, offsetof(T, lotteryWeight6), 2, 1, nullptr },
+        { "lotteryWeight7", field_type::u16, offsetof(T, lotteryWeight7), 2, 1, nullptr },
+        { "lotteryWeight8", field_type::u16, offsetof(T, lotteryWeight8), 2, 1, nullptr },
+        { "lotteryWeight9", field_type::u16, offsetof(T, lotteryWeight9), 2, 1, nullptr },
+        { "lotteryWeight10", field_type::u16, offsetof(T, lotteryWeight10), 2, 1, nullptr },
+        { "lotteryWeight11", field_type::u16, offsetof(T, lotteryWeight11), 2, 1, nullptr },
+        { "lotteryWeight12", field_type::u16, offsetof(T, lotteryWeight12), 2, 1, nullptr },
+        { "lotteryWeight13", field_type::u16, offsetof(T, lotteryWeight13), 2, 1, nullptr },
+        { "lotteryWeight14", field_type::u16, offsetof(T, lotteryWeight14), 2, 1, nullptr },
+        { "lotteryWeight15", field_type::u16, offsetof(T, lotteryWeight15), 2, 1, nullptr },
+        { "timezoneLimit", field_type::u8, offsetof(T, timezoneLimit), 1, 1, nullptr },
+        { "timezoneStartHour", field_type::u8, offsetof(T, timezoneStartHour), 1, 1, nullptr },
+        { "timezoneStartMinute", field_type::u8, offsetof(T, timezoneStartMinute), 1, 1, nullptr },
+        { "timezoneEndHour", field_type::u8, offsetof(T, timezoneEndHour), 1, 1, nullptr },
+        { "timezoneEndMinute", field_type::u8, offsetof(T, timezoneEndMinute), 1, 1, nullptr },
+        { "reserve", field_type::u8, offsetof(T, reserve), 1, 9, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType0) == 4);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType1) == 6);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType2) == 8);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType3) == 10);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType4) == 12);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType5) == 14);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType6) == 16);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType7) == 18);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType8) == 20);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType9) == 22);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType10) == 24);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType11) == 26);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType12) == 28);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType13) == 30);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType14) == 32);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, weatherType15) == 34);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight0) == 36);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight1) == 38);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight2) == 40);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight3) == 42);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight4) == 44);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight5) == 46);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight6) == 48);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight7) == 50);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight8) == 52);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight9) == 54);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight10) == 56);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight11) == 58);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight12) == 60);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight13) == 62);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight14) == 64);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, lotteryWeight15) == 66);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, timezoneLimit) == 68);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, timezoneStartHour) == 69);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, timezoneStartMinute) == 70);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, timezoneEndHour) == 71);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, timezoneEndMinute) == 72);
+static_assert(offsetof(paramdef::WEATHER_LOT_PARAM_ST, reserve) == 73);
+
+}; // namespace params
+}; // namespace from
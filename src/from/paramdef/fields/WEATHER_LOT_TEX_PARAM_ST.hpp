@@ -0,0 +1,38 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WEATHER_LOT_TEX_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WEATHER_LOT_TEX_PARAM_ST> {
+    using T = paramdef::WEATHER_LOT_TEX_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 9> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "srcR", field_type::u8, offsetof(T, srcR), 1, 1, nullptr },
+        { "srcG", field_type::u8, offsetof(T, srcG), 1, 1, nullptr },
+        { "srcB", field_type::u8, offsetof(T, srcB), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 1, nullptr },
+        { "weatherLogId", field_type::s32, offsetof(T, weatherLogId), 4, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 4, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WEATHER_LOT_TEX_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::WEATHER_LOT_TEX_PARAM_ST, srcR) == 4);
+static_assert(offsetof(paramdef::WEATHER_LOT_TEX_PARAM_ST, srcG) == 5);
+static_assert(offsetof(paramdef::WEATHER_LOT_TEX_PARAM_ST, srcB) == 6);
+static_assert(offsetof(paramdef::WEATHER_LOT_TEX_PARAM_ST, pad1) == 7);
+static_assert(offsetof(paramdef::WEATHER_LOT_TEX_PARAM_ST, weatherLogId) == 8);
+static_assert(offsetof(paramdef::WEATHER_LOT_TEX_PARAM_ST, pad2) == 12);
+
+}; // namespace params
+}; // namespace from
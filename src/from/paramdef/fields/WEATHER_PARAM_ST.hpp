@@ -0,0 +1,56 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WEATHER_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WEATHER_PARAM_ST> {
+    using T = paramdef::WEATHER_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 17> fields = {{
+        { "SfxId", field_type::s32, offsetof(T, SfxId), 4, 1, nullptr },
+        { "WindSfxId", field_type::s32, offsetof(T, WindSfxId), 4, 1, nullptr },
+        { "GroundHitSfxId", field_type::s32, offsetof(T, GroundHitSfxId), 4, 1, nullptr },
+        { "SoundId", field_type::s32, offsetof(T, SoundId), 4, 1, nullptr },
+        { "WetTime", field_type::f32, offsetof(T, WetTime), 4, 1, nullptr },
+        { "GparamId", field_type::u32, offsetof(T, GparamId), 4, 1, nullptr },
+        { "NextLotIngameSecondsMin", field_type::u32, offsetof(T, NextLotIngameSecondsMin), 4, 1, nullptr },
+        { "NextLotIngameSecondsMax", field_type::u32, offsetof(T, NextLotIngameSecondsMax), 4, 1, nullptr },
+        { "WetSpEffectId00", field_type::s32, offsetof(T, WetSpEffectId00), 4, 1, nullptr },
+        { "WetSpEffectId01", field_type::s32, offsetof(T, WetSpEffectId01), 4, 1, nullptr },
+        { "WetSpEffectId02", field_type::s32, offsetof(T, WetSpEffectId02), 4, 1, nullptr },
+        { "WetSpEffectId03", field_type::s32, offsetof(T, WetSpEffectId03), 4, 1, nullptr },
+        { "WetSpEffectId04", field_type::s32, offsetof(T, WetSpEffectId04), 4, 1, nullptr },
+        { "SfxIdInoor", field_type::s32, offsetof(T, SfxIdInoor), 4, 1, nullptr },
+        { "SfxIdOutdoor", field_type::s32, offsetof(T, SfxIdOutdoor), 4, 1, nullptr },
+        { "aiSightRate", field_type::f32, offsetof(T, aiSightRate), 4, 1, nullptr },
+        { "DistViewWeatherGparamOverrideWeight", field_type::f32, offsetof(T, DistViewWeatherGparamOverrideWeight), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, SfxId) == 0);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, WindSfxId) == 4);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, GroundHitSfxId) == 8);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, SoundId) == 12);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, WetTime) == 16);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, GparamId) == 20);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, NextLotIngameSecondsMin) == 24);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, NextLotIngameSecondsMax) == 28);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, WetSpEffectId00) == 32);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, WetSpEffectId01) == 36);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, WetSpEffectId02) == 40);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, WetSpEffectId03) == 44);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, WetSpEffectId04) == 48);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, SfxIdInoor) == 52);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, SfxIdOutdoor) == 56);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, aiSightRate) == 60);
+static_assert(offsetof(paramdef::WEATHER_PARAM_ST, DistViewWeatherGparamOverrideWeight) == 64);
+
+}; // namespace params
+}; // namespace from
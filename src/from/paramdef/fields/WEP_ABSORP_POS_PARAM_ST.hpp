@@ -0,0 +1,138 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WEP_ABSORP_POS_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WEP_ABSORP_POS_PARAM_ST> {
+    using T = paramdef::WEP_ABSORP_POS_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 59> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "hangPosType", field_type::u8, offsetof(T, hangPosType), 1, 1, nullptr },
+        { "isSkeletonBind", field_type::boolean, offsetof(T, isSkeletonBind), 1, 1, nullptr },
+        { "pad0", field_type::u8, offsetof(T, pad0), 1, 2, nullptr },
+        { "right_0", field_type::s16, offsetof(T, right_0), 2, 1, nullptr },
+        { "left_0", field_type::s16, offsetof(T, left_0), 2, 1, nullptr },
+        { "both_0", field_type::s16, offsetof(T, both_0), 2, 1, nullptr },
+        { "leftHang_0", field_type::s16, offsetof(T, leftHang_0), 2, 1, nullptr },
+        { "rightHang_0", field_type::s16, offsetof(T, rightHang_0), 2, 1, nullptr },
+        { "right_1", field_type::s16, offsetof(T, right_1), 2, 1, nullptr },
+        { "left_1", field_type::s16, offsetof(T, left_1), 2, 1, nullptr },
+        { "both_1", field_type::s16, offsetof(T, both_1), 2, 1, nullptr },
+        { "leftHang_1", field_type::s16, offsetof(T, leftHang_1), 2, 1, nullptr },
+        { "rightHang_1", field_type::s16, offsetof(T, rightHang_1), 2, 1, nullptr },
+        { "right_2", field_type::s16, offsetof(T, right_2), 2, 1, nullptr },
+        { "left_2", field_type::s16, offsetof(T, left_2), 2, 1, nullptr },
+        { "both_2", field_type::s16, offsetof(T, both_2), 2, 1, nullptr },
+        { "leftHang_2", field_type::s16, offsetof(T, leftHang_2), 2, 1, nullptr },
+        { "rightHang_2", field_type::s16, offsetof(T, rightHang_2), 2, 1, nullptr },
+        { "right_3", field_type::s16, offsetof(T, right_3), 2, 1, nullptr },
+        { "left_3", field_type::s16, offsetof(T, left_3), 2, 1, nullptr },
+        { "both_3", field_type::s16, offsetof(T, both_3), 2, 1, nullptr },
+        { "leftHang_3", field_type::s16, offsetof(T, leftHang_3), 2, 1, nullptr },
+        { "rightHang_3", field_type::s16, offsetof(T, rightHang_3), 2, 1, nullptr },
+        { "wepInvisibleType_0", field_type::u8, offsetof(T, wepInvisibleType_0), 1, 1, nullptr },
+        { "wepInvisibleType_1", field_type::u8, offsetof(T, wepInvisibleType_1), 1, 1, nullptr },
+        { "wepInvisibleType_2", field_type::u8, offsetof(T, wepInvisibleType_2), 1, 1, nullptr },
+        { "wepInvisibleType_3", field_type::u8, offsetof(T, wepInvisibleType_3), 1, 1, nullptr },
+        { "leftBoth_0", field_type::s16, offsetof(T, leftBoth_0), 2, 1, nullptr },
+        { "leftBoth_1", field_type::s16, offsetof(T, leftBoth_1), 2, 1, nullptr },
+        { "leftBoth_2", field_type::s16, offsetof(T, leftBoth_2), 2, 1, nullptr },
+        { "leftBoth_3", field_type::s16, offsetof(T, leftBoth_3), 2, 1, nullptr },
+        { "dispPosType_right_0", field_type::u8, offsetof(T, dispPosType_right_0), 1, 1, nullptr },
+        { "dispPosType_left_0", field_type::u8, offsetof(T, dispPosType_left_0), 1, 1, nullptr },
+        { "dispPosType_rightBoth_0", field_type::u8, offsetof(T, dispPosType_rightBoth_0), 1, 1, nullptr },
+        { "dispPosType_leftBoth_0", field_type::u8, offsetof(T, dispPosType_leftBoth_0), 1, 1, nullptr },
+        { "dispPosType_rightHang_0", field_type::u8, offsetof(T, dispPosType_rightHang_0), 1, 1, nullptr },
+        { "dispPosType_leftHang_0", field_type::u8, offsetof(T, dispPosType_leftHang_0), 1, 1, nullptr },
+        { "dispPosType_right_1", field_type::u8, offsetof(T, dispPosType_right_1), 1, 1, nullptr },
+        { "dispPosType_left_1", field_type::u8, offsetof(T, dispPosType_left_1), 1, 1, nullptr },
+        { "dispPosType_rightBoth_1", field_type::u8, offsetof(T, dispPosType_rightBoth_1), 1, 1, nullptr },
+        { "dispPosType_leftBoth_1", field_type::u8, offsetof(T, dispPosType_leftBoth_1), 1, 1, nullptr },
+        { "dispPosType_rightHang_1", field_type::u8, offsetof(T, dispPosType_rightHang_1), 1, 1, nullptr },
+        { "dispPosType_leftHang_1", field_type::u8, offsetof(T, dispPosType_leftHang_1), 1, 1, nullptr },
+        { "dispPosType_right_2", field_type::u8, offsetof(T, dispPosType_right_2), 1, 1, nullptr },
+        { "dispPosType_left_2", field_type::u8, offsetof(T, dispPosType_left_2), 1, 1, nullptr },
+        { "dispPosType_rightBoth_2", field_type::u8, offsetof(T, dispPosType_rightBoth_2), 1, 1, nullptr },
+        { "dispPosType_leftBoth_2", field_type::u8, offsetof(T, dispPosType_leftBoth_2), 1, 1, nullptr },
+        { "dispPosType_rightHang_2", field_type::u8, offsetof(T, dispPosType_rightHang_2), 1, 1, nullptr },
+        { "dispPosType_leftHang_2", field_type::u8, offsetof(T, dispPosType_leftHang_2), 1, 1, nullptr },
+        { "dispPosType_right_3", field_type::u8, offsetof(T, dispPosType_right_3), 1, 1, nullptr },
+        { "dispPosType_left_3", field_type::u8, offsetof(T, dispPosType_left_3), 1, 1, nullptr },
+        { "dispPosType_rightBoth_3", field_type::u8, offsetof(T, dispPosType_rightBoth_3), 1, 1, nullptr },
+        { "dispPosType_leftBoth_3", field_type::u8, offsetof(T, dispPosType_leftBoth_3), 1, 1, nullptr },
+        { "dispPosType_rightHang_3", field_type::u8, offsetof(T, dispPosType_rightHang_3), 1, 1, nullptr },
+        { "dispPosType_leftHang_3", field_type::u8, offsetof(T, dispPosType_leftHang_3), 1, 1, nullptr },
+        { "reserve", field_type::u8, offsetof(T, reserve), 1, 12, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, hangPosType) == 4);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, isSkeletonBind) == 5);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, pad0) == 6);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, right_0) == 8);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, left_0) == 10);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, both_0) == 12);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, leftHang_0) == 14);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, rightHang_0) == 16);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, right_1) == 18);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, left_1) == 20);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, both_1) == 22);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, leftHang_1) == 24);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, rightHang_1) == 26);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, right_2) == 28);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, left_2) == 30);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, both_2) == 32);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, leftHang_2) == 34);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, rightHang_2) == 36);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, right_3) == 38);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, left_3) == 40);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, both_3) == 42);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, leftHang_3) == 44);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, rightHang_3) == 46);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, wepInvisibleType_0) == 48);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, wepInvisibleType_1) == 49);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, wepInvisibleType_2) == 50);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, wepInvisibleType_3) == 51);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, leftBoth_0) == 52);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, leftBoth_1) == 54);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, leftBoth_2) == 56);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, leftBoth_3) == 58);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_right_0) == 60);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_left_0) == 61);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_rightBoth_0) == 62);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_leftBoth_0) == 63);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_rightHang_0) == 64);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_leftHang_0) == 65);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_right_1) == 66);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_left_1) == 67);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_rightBoth_1) == 68);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_leftBoth_1) == 69);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_rightHang_1) == 70);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_leftHang_1) == 71);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_right_2) == 72);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_left_2) == 73);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_rightBoth_2) == 74);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_leftBoth_2) == 75);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_rightHang_2) == 76);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_leftHang_2) == 77);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_right_3) == 78);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_left_3) == 79);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_rightBoth_3) == 80);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_leftBoth_3) == 81);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_rightHang_3) == 82);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, dispPosType_leftHang_3) == 83);
+static_assert(offsetof(paramdef::WEP_ABSORP_POS_PARAM_ST, reserve) == 84);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,48 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WET_ASPECT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WET_ASPECT_PARAM_ST> {
+    using T = paramdef::WET_ASPECT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 13> fields = {{
+        { "baseColorR", field_type::u8, offsetof(T, baseColorR), 1, 1, nullptr },
+        { "baseColorG", field_type::u8, offsetof(T, baseColorG), 1, 1, nullptr },
+        { "baseColorB", field_type::u8, offsetof(T, baseColorB), 1, 1, nullptr },
+        { "reserve_0", field_type::u8, offsetof(T, reserve_0), 1, 1, nullptr },
+        { "baseColorA", field_type::f32, offsetof(T, baseColorA), 4, 1, nullptr },
+        { "metallic", field_type::u8, offsetof(T, metallic), 1, 1, nullptr },
+        { "reserve_1", field_type::u8, offsetof(T, reserve_1), 1, 1, nullptr },
+        { "reserve_2", field_type::u8, offsetof(T, reserve_2), 1, 1, nullptr },
+        { "reserve_3", field_type::u8, offsetof(T, reserve_3), 1, 1, nullptr },
+        { "metallicRate", field_type::f32, offsetof(T, metallicRate), 4, 1, nullptr },
+        { "shininessRate", field_type::f32, offsetof(T, shininessRate), 4, 1, nullptr },
+        { "shininess", field_type::u8, offsetof(T, shininess), 1, 1, nullptr },
+        { "reserve_4", field_type::u8, offsetof(T, reserve_4), 1, 11, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, baseColorR) == 0);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, baseColorG) == 1);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, baseColorB) == 2);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, reserve_0) == 3);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, baseColorA) == 4);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, metallic) == 8);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, reserve_1) == 9);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, reserve_2) == 10);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, reserve_3) == 11);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, metallicRate) == 12);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, shininessRate) == 16);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, shininess) == 20);
+static_assert(offsetof(paramdef::WET_ASPECT_PARAM_ST, reserve_4) == 21);
+
+}; // namespace params
+}; // namespace from
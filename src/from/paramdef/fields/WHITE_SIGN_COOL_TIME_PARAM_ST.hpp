@@ -0,0 +1,30 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WHITE_SIGN_COOL_TIME_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WHITE_SIGN_COOL_TIME_PARAM_ST> {
+    using T = paramdef::WHITE_SIGN_COOL_TIME_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "limitationTime_Normal", field_type::f32, offsetof(T, limitationTime_Normal), 4, 1, nullptr },
+        { "limitationTime_NormalDriedFinger", field_type::f32, offsetof(T, limitationTime_NormalDriedFinger), 4, 1, nullptr },
+        { "limitationTime_Guardian", field_type::f32, offsetof(T, limitationTime_Guardian), 4, 1, nullptr },
+        { "limitationTime_GuardianDriedFinger", field_type::f32, offsetof(T, limitationTime_GuardianDriedFinger), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WHITE_SIGN_COOL_TIME_PARAM_ST, limitationTime_Normal) == 0);
+static_assert(offsetof(paramdef::WHITE_SIGN_COOL_TIME_PARAM_ST, limitationTime_NormalDriedFinger) == 4);
+static_assert(offsetof(paramdef::WHITE_SIGN_COOL_TIME_PARAM_ST, limitationTime_Guardian) == 8);
+static_assert(offsetof(paramdef::WHITE_SIGN_COOL_TIME_PARAM_ST, limitationTime_GuardianDriedFinger) == 12);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,58 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WORLD_MAP_LEGACY_CONV_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST> {
+    using T = paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 20> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "srcAreaNo", field_type::u8, offsetof(T, srcAreaNo), 1, 1, nullptr },
+        { "srcGridXNo", field_type::u8, offsetof(T, srcGridXNo), 1, 1, nullptr },
+        { "srcGridZNo", field_type::u8, offsetof(T, srcGridZNo), 1, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 1, nullptr },
+        { "srcPosX", field_type::f32, offsetof(T, srcPosX), 4, 1, nullptr },
+        { "srcPosY", field_type::f32, offsetof(T, srcPosY), 4, 1, nullptr },
+        { "srcPosZ", field_type::f32, offsetof(T, srcPosZ), 4, 1, nullptr },
+        { "dstAreaNo", field_type::u8, offsetof(T, dstAreaNo), 1, 1, nullptr },
+        { "dstGridXNo", field_type::u8, offsetof(T, dstGridXNo), 1, 1, nullptr },
+        { "dstGridZNo", field_type::u8, offsetof(T, dstGridZNo), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 1, nullptr },
+        { "dstPosX", field_type::f32, offsetof(T, dstPosX), 4, 1, nullptr },
+        { "dstPosY", field_type::f32, offsetof(T, dstPosY), 4, 1, nullptr },
+        { "dstPosZ", field_type::f32, offsetof(T, dstPosZ), 4, 1, nullptr },
+        { "isBasePoint", field_type::boolean, 36, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isBasePoint; } },
+        { "pad3", field_type::u8, 36, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad3; } },
+        { "pad4", field_type::u8, offsetof(T, pad4), 1, 11, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, srcAreaNo) == 4);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, srcGridXNo) == 5);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, srcGridZNo) == 6);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, pad1) == 7);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, srcPosX) == 8);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, srcPosY) == 12);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, srcPosZ) == 16);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, dstAreaNo) == 20);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, dstGridXNo) == 21);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, dstGridZNo) == 22);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, pad2) == 23);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, dstPosX) == 24);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, dstPosY) == 28);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, dstPosZ) == 32);
+static_assert(offsetof(paramdef::WORLD_MAP_LEGACY_CONV_PARAM_ST, pad4) == 37);
+
+}; // namespace params
+}; // namespace from
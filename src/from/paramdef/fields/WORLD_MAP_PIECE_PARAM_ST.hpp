@@ -0,0 +1,52 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WORLD_MAP_PIECE_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WORLD_MAP_PIECE_PARAM_ST> {
+    using T = paramdef::WORLD_MAP_PIECE_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 16> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "openEventFlagId", field_type::u32, offsetof(T, openEventFlagId), 4, 1, nullptr },
+        { "openTravelAreaLeft", field_type::f32, offsetof(T, openTravelAreaLeft), 4, 1, nullptr },
+        { "openTravelAreaRight", field_type::f32, offsetof(T, openTravelAreaRight), 4, 1, nullptr },
+        { "openTravelAreaTop", field_type::f32, offsetof(T, openTravelAreaTop), 4, 1, nullptr },
+        { "openTravelAreaBottom", field_type::f32, offsetof(T, openTravelAreaBottom), 4, 1, nullptr },
+        { "acquisitionEventFlagId", field_type::u32, offsetof(T, acquisitionEventFlagId), 4, 1, nullptr },
+        { "acquisitionEventScale", field_type::f32, offsetof(T, acquisitionEventScale), 4, 1, nullptr },
+        { "acquisitionEventCenterX", field_type::f32, offsetof(T, acquisitionEventCenterX), 4, 1, nullptr },
+        { "acquisitionEventCenterY", field_type::f32, offsetof(T, acquisitionEventCenterY), 4, 1, nullptr },
+        { "acquisitionEventResScale", field_type::f32, offsetof(T, acquisitionEventResScale), 4, 1, nullptr },
+        { "acquisitionEventResOffsetX", field_type::f32, offsetof(T, acquisitionEventResOffsetX), 4, 1, nullptr },
+        { "acquisitionEventResOffsetY", field_type::f32, offsetof(T, acquisitionEventResOffsetY), 4, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 12, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, openEventFlagId) == 4);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, openTravelAreaLeft) == 8);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, openTravelAreaRight) == 12);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, openTravelAreaTop) == 16);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, openTravelAreaBottom) == 20);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, acquisitionEventFlagId) == 24);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, acquisitionEventScale) == 28);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, acquisitionEventCenterX) == 32);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, acquisitionEventCenterY) == 36);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, acquisitionEventResScale) == 40);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, acquisitionEventResOffsetX) == 44);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, acquisitionEventResOffsetY) == 48);
+static_assert(offsetof(paramdef::WORLD_MAP_PIECE_PARAM_ST, pad) == 52);
+
+}; // namespace params
+}; // namespace from
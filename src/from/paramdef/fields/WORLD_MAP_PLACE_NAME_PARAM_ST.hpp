@@ -0,0 +1,46 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WORLD_MAP_PLACE_NAME_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST> {
+    using T = paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 13> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "worldMapPieceId", field_type::s32, offsetof(T, worldMapPieceId), 4, 1, nullptr },
+        { "textId", field_type::s32, offsetof(T, textId), 4, 1, nullptr },
+        { "pad1", field_type::u8, offsetof(T, pad1), 1, 4, nullptr },
+        { "areaNo", field_type::u8, offsetof(T, areaNo), 1, 1, nullptr },
+        { "gridXNo", field_type::u8, offsetof(T, gridXNo), 1, 1, nullptr },
+        { "gridZNo", field_type::u8, offsetof(T, gridZNo), 1, 1, nullptr },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 1, nullptr },
+        { "posX", field_type::f32, offsetof(T, posX), 4, 1, nullptr },
+        { "posY", field_type::f32, offsetof(T, posY), 4, 1, nullptr },
+        { "posZ", field_type::f32, offsetof(T, posZ), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, worldMapPieceId) == 4);
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, textId) == 8);
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, pad1) == 12);
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, areaNo) == 16);
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, gridXNo) == 17);
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, gridZNo) == 18);
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, pad2) == 19);
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, posX) == 20);
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, posY) == 24);
+static_assert(offsetof(paramdef::WORLD_MAP_PLACE_NAME_PARAM_ST, posZ) == 28);
+
+}; // namespace params
+}; // namespace from
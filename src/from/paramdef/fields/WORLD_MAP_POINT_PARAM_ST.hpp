@@ -0,0 +1,187 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WORLD_MAP_POINT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WORLD_MAP_POINT_PARAM_ST> {
+    using T = paramdef::WORLD_MAP_POINT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 87> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "eventFlagId", field_type::u32, offsetof(T, eventFlagId), 4, 1, nullptr },
+        { "distViewEventFlagId", field_type::u32, offsetof(T, distViewEventFlagId), 4, 1, nullptr },
+        { "iconId", field_type::u16, offsetof(T, iconId), 2, 1, nullptr },
+        { "bgmPlaceType", field_type::s16, offsetof(T, bgmPlaceType), 2, 1, nullptr },
+        { "isAreaIcon", field_type::boolean, 16, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isAreaIcon; } },
+        { "isOverrideDistViewMarkPos", field_type::boolean, 16, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isOverrideDistViewMarkPos; } },
+        { "isEnableNoText", field_type::boolean, 16, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->isEnableNoText; } },
+        { "pad3", field_type::u8, 16, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad3; } },
+        { "areaNo_forDistViewMark", field_type::u8, offsetof(T, areaNo_forDistViewMark), 1, 1, nullptr },
+        { "gridXNo_forDistViewMark", field_type::u8, offsetof(T, gridXNo_forDistViewMark), 1, 1, nullptr },
+        { "gridZNo_forDistViewMark", field_type::u8, offsetof(T, gridZNo_forDistViewMark), 1, 1, nullptr },
+        { "clearedEventFlagId", field_type::u32, offsetof(T, clearedEventFlagId), 4, 1, nullptr },
+        { "dispMask00", field_type::boolean, 24, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->dispMask00; } },
+        { "dispMask01", field_type::boolean, 24, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->dispMask01; } },
+        { "pad2_0", field_type::u8, 24, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->pad2_0; } },
+        { "pad2", field_type::u8, offsetof(T, pad2), 1, 1, nullptr },
+        { "distViewIconId", field_type::u16, offsetof(T, distViewIconId), 2, 1, nullptr },
+        { "angle", field_type::f32, offsetof(T, angle), 4, 1, nullptr },
+        { "areaNo", field_type::u8, offsetof(T, areaNo), 1, 1, nullptr },
+        { "gridXNo", field_type::u8, offsetof(T, gridXNo), 1, 1, nullptr },
+        { "gridZNo", field_type::u8, offsetof(T, gridZNo), 1, 1, nullptr },
+        { "pad", field_type::u8, offsetof(T, pad), 1, 1, nullptr },
+        { "posX", field_type::f32, offsetof(T, posX), 4, 1, nullptr },
+        { "posY", field_type::f32, offsetof(T, posY), 4, 1, nullptr },
+        { "posZ", field_type::f32, offsetof(T, posZ), 4, 1, nullptr },
+        { "textId1", field_type::s32, offsetof(T, textId1), 4, 1, nullptr },
+        { "textEnableFlagId1", field_type::u32, offsetof(T, textEnableFlagId1), 4, 1, nullptr },
+        { "textDisableFlagId1", field_type::u32, offsetof(T, textDisableFlagId1), 4, 1, nullptr },
+        { "textId2", field_type::s32, offsetof(T, textId2), 4, 1, nullptr },
+        { "textEnableFlagId2", field_type::u32, offsetof(T, textEnableFlagId2), 4, 1, nullptr },
+        { "textDisableFlagId2", field_type::u32, offsetof(T, textDisableFlagId2), 4, 1, nullptr },
+        { "textId3", field_type::s32, offsetof(T, textId3), 4, 1, nullptr },
+        { "textEnableFlagId3", field_type::u32, offsetof(T, textEnableFlagId3), 4, 1, nullptr },
+        { "textDisableFlagId3", field_type::u32, offsetof(T, textDisableFlagId3), 4, 1, nullptr },
+        { "textId4", field_type::s32, offsetof(T, textId4), 4, 1, nullptr },
+        { "textEnableFlagId4", field_type::u32, offsetof(T, textEnableFlagId4), 4, 1, nullptr },
+        { "textDisableFlagId4", field_type::u32, offsetof(T, textDisableFlagId4), 4, 1, nullptr },
+        { "textId5", field_type::s32, offsetof(T, textId5), 4, 1, nullptr },
+        { "textEnableFlagId5", field_type::u32, offsetof(T, textEnableFlagId5), 4, 1, nullptr },
+        { "textDisableFlagId5", field_type::u32, offsetof(T, textDisableFlagId5), 4, 1, nullptr },
+        { "textId6", field_type::s32, offsetof(T, textId6), 4, 1, nullptr },
+        { "textEnableFlagId6", field_type::u32, offsetof(T, textEnableFlagId6), 4, 1, nullptr },
+        { "textDisableFlagId6", field_type::u32, offsetof(T, textDisableFlagId6), 4, 1, nullptr },
+        { "textId7", field_type::s32, offsetof(T, textId7), 4, 1, nullptr },
+        { "textEnableFlagId7", field_type::u32, offsetof(T, textEnableFlagId7), 4, 1, nullptr },
+        { "textDisableFlagId7", field_type::u32, offsetof(T, textDisableFlagId7), 4, 1, nullptr },
+        { "textId8", field_type::s32, offsetof(T, textId8), 4, 1, nullptr },
+        { "textEnableFlagId8", field_type::u32, offsetof(T, textEnableFlagId8), 4, 1, nullptr },
+        { "textDisableFlagId8", field_type::u32, offsetof(T, textDisableFlagId8), 4, 1, nullptr },
+        { "textType1", field_type::u8, offsetof(T, textType1), 1, 1, nullptr },
+        { "textType2", field_type::u8, offsetof(T, textType2), 1, 1, nullptr },
+        { "textType3", field_type::u8, offsetof(T, textType3), 1, 1, nullptr },
+        { "textType4", field_type::u8, offsetof(T, textType4), 1, 1, nullptr },
+        { "textType5", field_type::u8, offsetof(T, textType5), 1, 1, nullptr },
+        { "textType6", field_type::u8, offsetof(T, textType6), 1, 1, nullptr },
+        { "textType7", field_type::u8, offsetof(T, textType7), 1, 1, nullptr },
+        { "textType8", field_type::u8, offsetof(T, textType8), 1, 1, nullptr },
+        { "distViewId", field_type::s32, offsetof(T, distViewId), 4, 1, nullptr },
+        { "posX_forDistViewMark", field_type::f32, offsetof(T, posX_forDistViewMark), 4, 1, nullptr },
+        { "posY_forDistViewMark", field_type::f32, offsetof(T, posY_forDistViewMark), 4, 1, nullptr },
+        { "posZ_forDistViewMark", field_type::f32, offsetof(T, posZ_forDistViewMark), 4, 1, nullptr },
+        { "distViewId1", field_type::s32, offsetof(T, distViewId1), 4, 1, nullptr },
+        { "distViewId2", field_type::s32, offsetof(T, distViewId2), 4, 1, nullptr },
+        { "distViewId3", field_type::s32, offsetof(T, distViewId3), 4, 1, nullptr },
+        { "dispMinZoomStep", field_type::u8, offsetof(T, dispMinZoomStep), 1, 1, nullptr },
+        { "selectMinZoomStep", field_type::u8, offsetof(T, selectMinZoomStep), 1, 1, nullptr },
+        { "entryFEType", field_type::u8, offsetof(T, entryFEType), 1, 1, nullptr },
+        { "pad4", field_type::u8, offsetof(T, pad4), 1, 9, nullptr },
+        { "unkC0", field_type::s32, offsetof(T, unkC0), 4, 1, nullptr },
+        { "unkC4", field_type::s32, offsetof(T, unkC4), 4, 1, nullptr },
+        { "unkC8", field_type::s32, offsetof(T, unkC8), 4, 1, nullptr },
+        { "unkCC", field_type::s32, offsetof(T, unkCC), 4, 1, nullptr },
+        { "unkD0", field_type::s32, offsetof(T, unkD0), 4, 1, nullptr },
+        { "unkD4", field_type::s32, offsetof(T, unkD4), 4, 1, nullptr },
+        { "unkD8", field_type::s32, offsetof(T, unkD8), 4, 1, nullptr },
+        { "unkDC", field_type::s32, offsetof(T, unkDC), 4, 1, nullptr },
+        { "unkE0", field_type::s32, offsetof(T, unkE0), 4, 1, nullptr },
+        { "unkE4", field_type::s32, offsetof(T, unkE4), 4, 1, nullptr },
+        { "unkE8", field_type::s32, offsetof(T, unkE8), 4, 1, nullptr },
+        { "unkEC", field_type::s32, offsetof(T, unkEC), 4, 1, nullptr },
+        { "unkF0", field_type::s32, offsetof(T, unkF0), 4, 1, nullptr },
+        { "unkF4", field_type::s32, offsetof(T, unkF4), 4, 1, nullptr },
+        { "unkF8", field_type::s32, offsetof(T, unkF8), 4, 1, nullptr },
+        { "unkFC", field_type::s32, offsetof(T, unkFC), 4, 1, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, eventFlagId) == 4);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, distViewEventFlagId) == 8);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, iconId) == 12);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, bgmPlaceType) == 14);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, areaNo_forDistViewMark) == 17);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, gridXNo_forDistViewMark) == 18);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, gridZNo_forDistViewMark) == 19);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, clearedEventFlagId) == 20);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, pad2) == 25);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, distViewIconId) == 26);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, angle) == 28);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, areaNo) == 32);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, gridXNo) == 33);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, gridZNo) == 34);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, pad) == 35);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, posX) == 36);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, posY) == 40);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, posZ) == 44);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textId1) == 48);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textEnableFlagId1) == 52);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textDisableFlagId1) == 56);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textId2) == 60);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textEnableFlagId2) == 64);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textDisableFlagId2) == 68);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textId3) == 72);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textEnableFlagId3) == 76);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textDisableFlagId3) == 80);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textId4) == 84);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textEnableFlagId4) == 88);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textDisableFlagId4) == 92);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textId5) == 96);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textEnableFlagId5) == 100);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textDisableFlagId5) == 104);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textId6) == 108);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textEnableFlagId6) == 112);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textDisableFlagId6) == 116);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textId7) == 120);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textEnableFlagId7) == 124);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textDisableFlagId7) == 128);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textId8) == 132);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textEnableFlagId8) == 136);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textDisableFlagId8) == 140);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textType1) == 144);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textType2) == 145);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textType3) == 146);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textType4) == 147);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textType5) == 148);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textType6) == 149);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textType7) == 150);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, textType8) == 151);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, distViewId) == 152);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, posX_forDistViewMark) == 156);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, posY_forDistViewMark) == 160);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, posZ_forDistViewMark) == 164);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, distViewId1) == 168);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, distViewId2) == 172);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, distViewId3) == 176);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, dispMinZoomStep) == 180);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, selectMinZoomStep) == 181);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, entryFEType) == 182);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, pad4) == 183);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkC0) == 192);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkC4) == 196);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkC8) == 200);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkCC) == 204);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkD0) == 208);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkD4) == 212);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkD8) == 216);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkDC) == 220);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkE0) == 224);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkE4) == 228);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkE8) == 232);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkEC) == 236);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkF0) == 240);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkF4) == 244);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkF8) == 248);
+static_assert(offsetof(paramdef::WORLD_MAP_POINT_PARAM_ST, unkFC) == 252);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,28 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../param_fields.hpp"
+#include "../WWISE_VALUE_TO_STR_CONVERT_PARAM_ST.hpp"
+
+namespace from {
+namespace params {
+template <> struct paramdef_fields<paramdef::WWISE_VALUE_TO_STR_CONVERT_PARAM_ST> {
+    using T = paramdef::WWISE_VALUE_TO_STR_CONVERT_PARAM_ST;
+
+    static constexpr std::array<field_descriptor, 4> fields = {{
+        { "disableParam_NT", field_type::boolean, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParam_NT; } },
+        { "disableParamReserve1", field_type::u8, 0, 1, 1, [](const void *row) -> uint64_t { return static_cast<const T *>(row)->disableParamReserve1; } },
+        { "disableParamReserve2", field_type::u8, offsetof(T, disableParamReserve2), 1, 3, nullptr },
+        { "ParamStr", field_type::character, offsetof(T, ParamStr), 1, 32, nullptr },
+    }};
+};
+
+static_assert(offsetof(paramdef::WWISE_VALUE_TO_STR_CONVERT_PARAM_ST, disableParamReserve2) == 1);
+static_assert(offsetof(paramdef::WWISE_VALUE_TO_STR_CONVERT_PARAM_ST, ParamStr) == 4);
+
+}; // namespace params
+}; // namespace from
@@ -0,0 +1,189 @@
+/* This file was automatically generated by tools/generate_paramdef_fields.py. */
+#pragma once
+
+#include "ACTIONBUTTON_PARAM_ST.hpp"
+#include "AI_ANIM_TBL_PARAM.hpp"
+#include "AI_ATTACK_PARAM_ST.hpp"
+#include "AI_ODDS_PARAM.hpp"
+#include "AI_SOUND_PARAM_ST.hpp"
+#include "AI_STANDARD_INFO_BANK.hpp"
+#include "ASSET_GEOMETORY_PARAM_ST.hpp"
+#include "ASSET_MATERIAL_SFX_PARAM_ST.hpp"
+#include "ASSET_MODEL_SFX_PARAM_ST.hpp"
+#include "ATK_PARAM_ST.hpp"
+#include "ATTACK_ELEMENT_CORRECT_PARAM_ST.hpp"
+#include "AUTO_CREATE_ENV_SOUND_PARAM_ST.hpp"
+#include "BASECHR_SELECT_MENU_PARAM_ST.hpp"
+#include "BEHAVIOR_PARAM_ST.hpp"
+#include "BONFIRE_WARP_PARAM_ST.hpp"
+#include "BONFIRE_WARP_SUB_CATEGORY_PARAM_ST.hpp"
+#include "BONFIRE_WARP_TAB_PARAM_ST.hpp"
+#include "BUDDY_PARAM_ST.hpp"
+#include "BUDDY_STONE_PARAM_ST.hpp"
+#include "BUDGET_PARAM_ST.hpp"
+#include "BULLET_CREATE_LIMIT_PARAM_ST.hpp"
+#include "BULLET_PARAM_ST.hpp"
+#include "CACL_CORRECT_GRAPH_ST.hpp"
+#include "CAMERA_FADE_PARAM_ST.hpp"
+#include "CEREMONY_PARAM_ST.hpp"
+#include "CHARACTER_INIT_PARAM.hpp"
+#include "CHARMAKEMENUTOP_PARAM_ST.hpp"
+#include "CHARMAKEMENU_LISTITEM_PARAM_ST.hpp"
+#include "CHR_ACTIVATE_CONDITION_PARAM_ST.hpp"
+#include "CHR_MODEL_PARAM_ST.hpp"
+#include "CLEAR_COUNT_CORRECT_PARAM_ST.hpp"
+#include "COMMON_SYSTEM_PARAM_ST.hpp"
+#include "COOL_TIME_PARAM_ST.hpp"
+#include "CS_AA_QUALITY_DETAIL.hpp"
+#include "CS_DECAL_QUALITY_DETAIL.hpp"
+#include "CS_DOF_QUALITY_DETAIL.hpp"
+#include "CS_EFFECT_QUALITY_DETAIL.hpp"
+#include "CS_GRAPHICS_CONFIG_PARAM_ST.hpp"
+#include "CS_KEY_ASSIGN_MENUITEM_PARAM.hpp"
+#include "CS_LIGHTING_QUALITY_DETAIL.hpp"
+#include "CS_MOTION_BLUR_QUALITY_DETAIL.hpp"
+#include "CS_RAYTRACING_QUALITY_DETAIL.hpp"
+#include "CS_REFLECTION_QUALITY_DETAIL.hpp"
+#include "CS_SHADER_QUALITY_DETAIL.hpp"
+#include "CS_SHADOW_QUALITY_DETAIL.hpp"
+#include "CS_SSAO_QUALITY_DETAIL.hpp"
+#include "CS_TEXTURE_FILTER_QUALITY_DETAIL.hpp"
+#include "CS_VOLUMETRIC_EFFECT_QUALITY_DETAIL.hpp"
+#include "CS_WATER_QUALITY_DETAIL.hpp"
+#include "CUTSCENE_GPARAM_TIME_PARAM_ST.hpp"
+#include "CUTSCENE_GPARAM_WEATHER_PARAM_ST.hpp"
+#include "CUTSCENE_MAP_ID_PARAM_ST.hpp"
+#include "CUTSCENE_TEXTURE_LOAD_PARAM_ST.hpp"
+#include "CUTSCENE_TIMEZONE_CONVERT_PARAM_ST.hpp"
+#include "CUTSCENE_WEATHER_OVERRIDE_GPARAM_ID_CONVERT_PARAM_ST.hpp"
+#include "DECAL_PARAM_ST.hpp"
+#include "DEFAULT_KEY_ASSIGN.hpp"
+#include "DIRECTION_CAMERA_PARAM_ST.hpp"
+#include "ENEMY_COMMON_PARAM_ST.hpp"
+#include "ENEMY_STANDARD_INFO_BANK.hpp"
+#include "ENV_OBJ_LOT_PARAM_ST.hpp"
+#include "EQUIP_MTRL_SET_PARAM_ST.hpp"
+#include "EQUIP_PARAM_ACCESSORY_ST.hpp"
+#include "EQUIP_PARAM_CUSTOM_WEAPON_ST.hpp"
+#include "EQUIP_PARAM_GEM_ST.hpp"
+#include "EQUIP_PARAM_GOODS_ST.hpp"
+#include "EQUIP_PARAM_PROTECTOR_ST.hpp"
+#include "EQUIP_PARAM_WEAPON_ST.hpp"
+#include "ESTUS_FLASK_RECOVERY_PARAM_ST.hpp"
+#include "EVENT_FLAG_USAGE_PARAM_ST.hpp"
+#include "FACE_PARAM_ST.hpp"
+#include "FACE_RANGE_PARAM_ST.hpp"
+#include "FE_TEXT_EFFECT_PARAM_ST.hpp"
+#include "FINAL_DAMAGE_RATE_PARAM_ST.hpp"
+#include "FOOT_SFX_PARAM_ST.hpp"
+#include "GAME_AREA_PARAM_ST.hpp"
+#include "GAME_INFO_PARAM.hpp"
+#include "GAME_SYSTEM_COMMON_PARAM_ST.hpp"
+#include "GESTURE_PARAM_ST.hpp"
+#include "GPARAM_GRID_REGION_INFO_PARAM_ST.hpp"
+#include "GPARAM_REF_SETTINGS_PARAM_ST.hpp"
+#include "GRAPHICS_COMMON_PARAM_ST.hpp"
+#include "GRASS_LOD_RANGE_PARAM_ST.hpp"
+#include "GRASS_MAP_SETTINGS_PARAM_ST.hpp"
+#include "GRASS_TYPE_PARAM_ST.hpp"
+#include "HIT_EFFECT_SE_PARAM_ST.hpp"
+#include "HIT_EFFECT_SFX_CONCEPT_PARAM_ST.hpp"
+#include "HIT_EFFECT_SFX_PARAM_ST.hpp"
+#include "HIT_MTRL_PARAM_ST.hpp"
+#include "ITEMLOT_PARAM_ST.hpp"
+#include "KEY_ASSIGN_PARAM_ST.hpp"
+#include "KNOCKBACK_PARAM_ST.hpp"
+#include "KNOWLEDGE_LOADSCREEN_ITEM_PARAM_ST.hpp"
+#include "LEGACY_DISTANT_VIEW_PARTS_REPLACE_PARAM.hpp"
+#include "LOAD_BALANCER_DRAW_DIST_SCALE_PARAM_ST.hpp"
+#include "LOAD_BALANCER_NEW_DRAW_DIST_SCALE_PARAM_ST.hpp"
+#include "LOAD_BALANCER_PARAM_ST.hpp"
+#include "LOCK_CAM_PARAM_ST.hpp"
+#include "MAGIC_PARAM_ST.hpp"
+#include "MAP_DEFAULT_INFO_PARAM_ST.hpp"
+#include "MAP_GD_REGION_DRAW_PARAM.hpp"
+#include "MAP_GD_REGION_ID_PARAM_ST.hpp"
+#include "MAP_GRID_CREATE_HEIGHT_LIMIT_INFO_PARAM_ST.hpp"
+#include "MAP_MIMICRY_ESTABLISHMENT_PARAM_ST.hpp"
+#include "MAP_NAME_TEX_PARAM_ST.hpp"
+#include "MAP_PIECE_TEX_PARAM_ST.hpp"
+#include "MATERIAL_EX_PARAM_ST.hpp"
+#include "MENUPROPERTY_LAYOUT.hpp"
+#include "MENUPROPERTY_SPEC.hpp"
+#include "MENU_COMMON_PARAM_ST.hpp"
+#include "MENU_OFFSCR_REND_PARAM_ST.hpp"
+#include "MENU_PARAM_COLOR_TABLE_ST.hpp"
+#include "MENU_VALUE_TABLE_SPEC.hpp"
+#include "MIMICRY_ESTABLISHMENT_TEX_PARAM_ST.hpp"
+#include "MISSILE_PARAM_ST.hpp"
+#include "MODEL_SFX_PARAM_ST.hpp"
+#include "MOVE_PARAM_ST.hpp"
+#include "MULTI_ESTUS_FLASK_BONUS_PARAM_ST.hpp"
+#include "MULTI_PLAY_CORRECTION_PARAM_ST.hpp"
+#include "MULTI_SOUL_BONUS_RATE_PARAM_ST.hpp"
+#include "NETWORK_AREA_PARAM_ST.hpp"
+#include "NETWORK_MSG_PARAM_ST.hpp"
+#include "NETWORK_PARAM_ST.hpp"
+#include "NPC_AI_ACTION_PARAM_ST.hpp"
+#include "NPC_AI_BEHAVIOR_PROBABILITY_PARAM_ST.hpp"
+#include "NPC_PARAM_ST.hpp"
+#include "NPC_THINK_PARAM_ST.hpp"
+#include "OBJECT_MATERIAL_SFX_PARAM_ST.hpp"
+#include "OBJECT_PARAM_ST.hpp"
+#include "OBJ_ACT_PARAM_ST.hpp"
+#include "PARTS_DRAW_PARAM_ST.hpp"
+#include "PERFORMANCE_CHECK_PARAM.hpp"
+#include "PHANTOM_PARAM_ST.hpp"
+#include "PLAYER_COMMON_PARAM_ST.hpp"
+#include "PLAY_REGION_PARAM_ST.hpp"
+#include "POSTURE_CONTROL_PARAM_GENDER_ST.hpp"
+#include "POSTURE_CONTROL_PARAM_PRO_ST.hpp"
+#include "POSTURE_CONTROL_PARAM_WEP_LEFT_ST.hpp"
+#include "POSTURE_CONTROL_PARAM_WEP_RIGHT_ST.hpp"
+#include "RANDOM_APPEAR_EDIT_PARAM_ST.hpp"
+#include "RANDOM_APPEAR_PARAM_ST.hpp"
+#include "REINFORCE_PARAM_PROTECTOR_ST.hpp"
+#include "REINFORCE_PARAM_WEAPON_ST.hpp"
+#include "RESIST_CORRECT_PARAM_ST.hpp"
+#include "REVERB_AUX_SEND_BUS_PARAM_ST.hpp"
+#include "RIDE_PARAM_ST.hpp"
+#include "ROLE_PARAM_ST.hpp"
+#include "ROLLING_OBJ_LOT_PARAM_ST.hpp"
+#include "RUNTIME_BONE_CONTROL_PARAM_ST.hpp"
+#include "SE_ACTIVATION_RANGE_PARAM_ST.hpp"
+#include "SE_MATERIAL_CONVERT_PARAM_ST.hpp"
+#include "SFX_BLOCK_RES_SHARE_PARAM.hpp"
+#include "SHOP_LINEUP_PARAM.hpp"
+#include "SIGN_PUDDLE_PARAM_ST.hpp"
+#include "SOUND_ASSET_SOUND_OBJ_ENABLE_DIST_PARAM_ST.hpp"
+#include "SOUND_AUTO_ENV_SOUND_GROUP_PARAM_ST.hpp"
+#include "SOUND_AUTO_REVERB_EVALUATION_DIST_PARAM_ST.hpp"
+#include "SOUND_AUTO_REVERB_SELECT_PARAM_ST.hpp"
+#include "SOUND_CHR_PHYSICS_SE_PARAM_ST.hpp"
+#include "SOUND_COMMON_INGAME_PARAM_ST.hpp"
+#include "SOUND_COMMON_SYSTEM_PARAM_ST.hpp"
+#include "SOUND_CUTSCENE_PARAM_ST.hpp"
+#include "SPEEDTREE_MODEL_PARAM_ST.hpp"
+#include "SP_EFFECT_PARAM_ST.hpp"
+#include "SP_EFFECT_SET_PARAM_ST.hpp"
+#include "SP_EFFECT_VFX_PARAM_ST.hpp"
+#include "SWORD_ARTS_PARAM_ST.hpp"
+#include "TALK_PARAM_ST.hpp"
+#include "THROW_DIRECTION_SFX_PARAM_ST.hpp"
+#include "THROW_PARAM_ST.hpp"
+#include "TOUGHNESS_PARAM_ST.hpp"
+#include "TUTORIAL_PARAM_ST.hpp"
+#include "WAYPOINT_PARAM_ST.hpp"
+#include "WEATHER_ASSET_CREATE_PARAM_ST.hpp"
+#include "WEATHER_ASSET_REPLACE_PARAM_ST.hpp"
+#include "WEATHER_LOT_PARAM_ST.hpp"
+#include "WEATHER_LOT_TEX_PARAM_ST.hpp"
+#include "WEATHER_PARAM_ST.hpp"
+#include "WEP_ABSORP_POS_PARAM_ST.hpp"
+#include "WET_ASPECT_PARAM_ST.hpp"
+#include "WHITE_SIGN_COOL_TIME_PARAM_ST.hpp"
+#include "WORLD_MAP_LEGACY_CONV_PARAM_ST.hpp"
+#include "WORLD_MAP_PIECE_PARAM_ST.hpp"
+#include "WORLD_MAP_PLACE_NAME_PARAM_ST.hpp"
+#include "WORLD_MAP_POINT_PARAM_ST.hpp"
+#include "WWISE_VALUE_TO_STR_CONVERT_PARAM_ST.hpp"
@@ -1,8 +1,17 @@
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <chrono>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
 #include <spdlog/spdlog.h>
 #include <thread>
+#include <unordered_map>
 
 #include "../modutils.hpp"
 #include "params.hpp"
@@ -16,6 +25,305 @@ static auto required_params =
           L"EquipParamProtector", L"EquipParamWeapon",     L"ItemLotParam_enemy",
           L"ItemLotParam_map",    L"ReinforceParamWeapon", L"ShopLineupParam"};
 
+namespace
+{
+
+struct param_name_hash
+{
+    using is_transparent = void;
+
+    size_t operator()(wstring_view name) const
+    {
+        return hash<wstring_view>{}(name);
+    }
+};
+
+/**
+ * Index of param names to their ParamList slot, built from a single ParamList instance
+ */
+struct param_name_index
+{
+    from::params::ParamList *param_list = nullptr;
+    bool is_complete = false;
+    unordered_map<wstring, from::params::ParamListEntry *, param_name_hash, equal_to<>> entries;
+
+    void build(from::params::ParamList *new_param_list)
+    {
+        param_list = new_param_list;
+        is_complete = true;
+        entries.clear();
+        entries.reserve(size(param_list->entries));
+
+        for (auto &entry : param_list->entries)
+        {
+            if (entry.param_res_cap == nullptr)
+            {
+                is_complete = false;
+                continue;
+            }
+
+            entries.try_emplace(dlw_c_str(&entry.param_res_cap->param_name), &entry);
+        }
+    }
+};
+
+mutex param_name_index_mutex;
+param_name_index name_index;
+
+/**
+ * Lookup index for one table, with the row count and first, middle and last row IDs it was built
+ * from, so a table that's rewritten at the same address isn't served a stale index
+ */
+struct table_index_entry
+{
+    uint16_t num_rows;
+    array<uint64_t, 3> sampled_ids;
+    shared_ptr<const from::params::ParamTableIndex> index;
+};
+
+array<uint64_t, 3> sample_row_ids(const from::params::ParamTable *param_table)
+{
+    auto num_rows = param_table->num_rows;
+    if (num_rows == 0)
+    {
+        return {};
+    }
+
+    return {param_table->rows[0].row_id, param_table->rows[num_rows / 2].row_id,
+            param_table->rows[num_rows - 1].row_id};
+}
+
+shared_mutex table_index_mutex;
+unordered_map<from::params::ParamTable *, table_index_entry> table_indexes;
+vector<wstring> unsorted_param_names;
+
+}
+
+from::params::ParamListEntry *from::params::find_param_entry(wstring_view name)
+{
+    auto param_list = param_list_address != nullptr ? *param_list_address : nullptr;
+    if (param_list == nullptr)
+    {
+        return nullptr;
+    }
+
+    lock_guard lock(param_name_index_mutex);
+
+    if (name_index.param_list != param_list)
+    {
+        name_index.build(param_list);
+    }
+
+    auto result = name_index.entries.find(name);
+    if (result == name_index.entries.end() && !name_index.is_complete)
+    {
+        // Params may still be loading into empty slots of the same list, so rescan before
+        // reporting a miss
+        name_index.build(param_list);
+        result = name_index.entries.find(name);
+    }
+
+    return result != name_index.entries.end() ? result->second : nullptr;
+}
+
+namespace
+{
+
+/**
+ * 64-bit hash over four independent lanes, using the xxHash64 round and avalanche. Each lane only
+ * depends on its own previous value, so the multiplies of consecutive words overlap instead of
+ * forming one long dependency chain.
+ */
+class lane_hash
+{
+  public:
+    void add_block(const uint64_t (&words)[4])
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            lanes[i] = rotl(lanes[i] + words[i] * prime2, 31) * prime1;
+        }
+        length += sizeof(words);
+    }
+
+    void add_bytes(span<const std::byte> bytes)
+    {
+        uint64_t words[4];
+        for (; bytes.size() >= sizeof(words); bytes = bytes.subspan(sizeof(words)))
+        {
+            memcpy(words, bytes.data(), sizeof(words));
+            add_block(words);
+        }
+
+        if (!bytes.empty())
+        {
+            uint64_t tail[4] = {};
+            memcpy(tail, bytes.data(), bytes.size());
+            add_block(tail);
+            length -= sizeof(tail) - bytes.size();
+        }
+    }
+
+    uint64_t finish() const
+    {
+        uint64_t hash = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) +
+                        rotl(lanes[3], 18) + length;
+        hash ^= hash >> 33;
+        hash *= prime2;
+        hash ^= hash >> 29;
+        hash *= prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+  private:
+    static constexpr uint64_t prime1 = 0x9e3779b185ebca87ull;
+    static constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4full;
+    static constexpr uint64_t prime3 = 0x165667b19e3779f9ull;
+
+    uint64_t lanes[4] = {prime1 + prime2, prime2, 0, 0 - prime1};
+    uint64_t length = 0;
+};
+
+/**
+ * Hashes the row IDs of a table in row order
+ */
+uint64_t hash_row_ids(span<const from::params::ParamRowInfo> rows)
+{
+    lane_hash ids_hash;
+    uint64_t ids[4] = {};
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        ids[i % 4] = rows[i].row_id;
+        if (i % 4 == 3 || i == rows.size() - 1)
+        {
+            ids_hash.add_block(ids);
+            ranges::fill(ids, 0);
+        }
+    }
+    return ids_hash.finish();
+}
+
+}
+
+void from::params::invalidate_param_caches()
+{
+    {
+        lock_guard lock(param_name_index_mutex);
+        name_index = {};
+    }
+
+    internal::param_cache_generation.fetch_add(1, memory_order_acq_rel);
+}
+
+shared_ptr<const from::params::ParamTableIndex> from::params::get_table_index(
+    ParamTable *param_table, wstring_view param_name)
+{
+    auto sampled_ids = sample_row_ids(param_table);
+
+    {
+        shared_lock lock(table_index_mutex);
+        auto entry = table_indexes.find(param_table);
+        if (entry != table_indexes.end() && entry->second.num_rows == param_table->num_rows &&
+            entry->second.sampled_ids == sampled_ids)
+        {
+            return entry->second.index;
+        }
+    }
+
+    auto rows = span(param_table->rows, param_table->num_rows);
+
+    auto index = make_shared<ParamTableIndex>();
+    index->is_sorted = ranges::is_sorted(rows, {}, &ParamRowInfo::row_id);
+
+    if (!index->is_sorted)
+    {
+        auto &sorted_rows = index->sorted_rows;
+        sorted_rows.reserve(rows.size());
+        for (auto &row : rows)
+        {
+            sorted_rows.push_back(&row);
+        }
+        ranges::stable_sort(sorted_rows, {}, &ParamRowInfo::row_id);
+
+        spdlog::info("Param {} has out-of-order rows, using a sorted index",
+                     modutils::utf8{param_name});
+    }
+
+    if (rows.size() >= ParamTableIndex::min_filtered_rows)
+    {
+        // Size the filter at 8-16 bits per row, which keeps false positives at a few percent with
+        // two bits set per ID
+        auto filter_bits = bit_ceil(rows.size() * 8);
+        auto &id_filter = index->id_filter;
+        id_filter.assign(filter_bits / 64, 0);
+        index->id_filter_shift = 64 - countr_zero(filter_bits);
+
+        for (auto &row : rows)
+        {
+            auto [bit1, bit2] = ParamTableIndex::id_filter_bits(row.row_id, index->id_filter_shift);
+            id_filter[bit1 / 64] |= 1ull << (bit1 % 64);
+            id_filter[bit2 / 64] |= 1ull << (bit2 % 64);
+        }
+    }
+
+    unique_lock lock(table_index_mutex);
+
+    table_indexes[param_table] = {
+        .num_rows = param_table->num_rows,
+        .sampled_ids = sampled_ids,
+        .index = index,
+    };
+
+    if (!index->is_sorted &&
+        ranges::find(unsorted_param_names, param_name) == unsorted_param_names.end())
+    {
+        unsorted_param_names.emplace_back(param_name);
+    }
+
+    return index;
+}
+
+void from::params::release_table_index(ParamTable *param_table)
+{
+    unique_lock lock(table_index_mutex);
+    table_indexes.erase(param_table);
+}
+
+vector<wstring> from::params::get_unsorted_param_names()
+{
+    shared_lock lock(table_index_mutex);
+    return unsorted_param_names;
+}
+
+from::params::ParamFingerprint from::params::fingerprint(const ParamTable *param_table,
+                                                         size_t row_size)
+{
+    auto rows = span(param_table->rows, param_table->num_rows);
+    if (rows.empty())
+    {
+        return {};
+    }
+
+    size_t first_offset = rows.front().param_offset;
+    size_t last_offset = first_offset;
+    for (auto &row : rows)
+    {
+        first_offset = min<size_t>(first_offset, row.param_offset);
+        last_offset = max<size_t>(last_offset, row.param_offset);
+    }
+
+    lane_hash data_hash;
+    data_hash.add_bytes(span(reinterpret_cast<const std::byte *>(param_table) + first_offset,
+                             last_offset + row_size - first_offset));
+
+    return {
+        .num_rows = static_cast<uint32_t>(rows.size()),
+        .ids_hash = hash_row_ids(rows),
+        .data_hash = data_hash.finish(),
+    };
+}
+
 void from::params::initialize()
 {
     param_list_address = modutils::scan<ParamList *>({
@@ -25,30 +333,43 @@ void from::params::initialize()
 
     spdlog::info("Waiting for params...");
 
+    // Poll quickly at first, backing off so a slow load doesn't keep the mod thread busy
+    static constexpr auto min_poll_interval = chrono::milliseconds(10);
+    static constexpr auto max_poll_interval = chrono::milliseconds(500);
+
+    auto start_time = chrono::steady_clock::now();
+    auto poll_interval = min_poll_interval;
+    size_t reported_missing_count = 0;
+
     while (true)
     {
-        auto param_list = *param_list_address;
-        if (param_list != nullptr)
+        string missing_params;
+        size_t missing_count = 0;
+        for (auto name : required_params)
         {
-            int required_param_count = 0;
-
-            for (auto &entry : param_list->entries)
+            if (find_param_entry(name) == nullptr)
             {
-                if (entry.param_res_cap != nullptr &&
-                    ranges::find(required_params,
-                                 wstring{dlw_c_str(&entry.param_res_cap->param_name)}) !=
-                        required_params.end())
-                {
-                    required_param_count++;
-                }
-
-                if (required_param_count == required_params.size())
-                {
-                    return;
-                }
+                format_to(back_inserter(missing_params), "{}{}", missing_count++ ? ", " : "",
+                          modutils::utf8{name});
             }
         }
 
-        this_thread::sleep_for(chrono::seconds(1));
+        if (missing_count == 0)
+        {
+            break;
+        }
+
+        if (missing_count != reported_missing_count && *param_list_address != nullptr)
+        {
+            spdlog::info("Waiting for {} params: {}", missing_count, missing_params);
+            reported_missing_count = missing_count;
+        }
+
+        this_thread::sleep_for(poll_interval);
+        poll_interval = min(poll_interval * 2, max_poll_interval);
     }
+
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() -
+                                                                start_time);
+    spdlog::info("Params ready after {} ms", elapsed.count());
 }
@@ -1,22 +1,26 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <compare>
 #include <cstdint>
 #include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
 #include <spdlog/spdlog.h>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../modutils.hpp"
+#include "param_traits.hpp"
 
 namespace from
 {
 namespace params
 {
-namespace internal
-{
-inline std::string wstring_to_string(const std::wstring &wstr)
-{
-    std::wstring_convert<std::codecvt<wchar_t, char, std::mbstate_t>, wchar_t> convert;
-    return convert.to_bytes(wstr);
-}
-}
-
 void initialize();
 
 struct ParamRowInfo
@@ -84,28 +88,223 @@ struct ParamList
 
 extern ParamList **param_list_address;
 
+/**
+ * Returns the ParamList slot for the param with the given name, or nullptr if it isn't loaded.
+ *
+ * Names are resolved through a hash index over the ParamList, which is built the first time it's
+ * needed and rebuilt only when the ParamList itself is replaced.
+ */
+ParamListEntry *find_param_entry(std::wstring_view name);
+
+/**
+ * Forgets every ParamList slot resolved so far, e.g. after param_list_address is pointed at a
+ * different list whose memory may reuse the address of an old one
+ */
+void invalidate_param_caches();
+
+inline ParamResCap *find_param_res_cap(std::wstring_view name)
+{
+    auto entry = find_param_entry(name);
+    return entry != nullptr ? entry->param_res_cap : nullptr;
+}
+
+/**
+ * Row lookup data for a single param table, computed once per table
+ */
+struct ParamTableIndex
+{
+    bool is_sorted;
+
+    // Rows ordered by ID, only built for tables with out-of-order rows (e.g. some mod-merged
+    // regulations)
+    std::vector<ParamRowInfo *> sorted_rows;
+
+    // Bloom filter over row IDs, so most misses are answered without searching the rows. Left
+    // empty for small tables, where the search is already cheap.
+    std::vector<uint64_t> id_filter;
+    int id_filter_shift = 0;
+
+    static constexpr size_t min_filtered_rows = 256;
+
+    static inline std::pair<uint64_t, uint64_t> id_filter_bits(uint64_t id, int shift)
+    {
+        return {(id * 0x9e3779b97f4a7c15ull) >> shift,
+                ((id ^ (id >> 31)) * 0xbf58476d1ce4e5b9ull) >> shift};
+    }
+
+    bool may_contain(uint64_t id) const
+    {
+        if (id_filter.empty())
+        {
+            return true;
+        }
+
+        auto [bit1, bit2] = id_filter_bits(id, id_filter_shift);
+        return (id_filter[bit1 / 64] >> (bit1 % 64) & 1) &&
+               (id_filter[bit2 / 64] >> (bit2 % 64) & 1);
+    }
+};
+
+/**
+ * Returns the lookup index for the given table, building it the first time the table is seen or
+ * if its row count or sampled row IDs have changed since
+ */
+std::shared_ptr<const ParamTableIndex> get_table_index(ParamTable *param_table,
+                                                       std::wstring_view param_name);
+
+/**
+ * Discards the lookup index for a table that's about to be freed or has been replaced. Anything
+ * still reading the table keeps its own reference to the index.
+ */
+void release_table_index(ParamTable *param_table);
+
+/**
+ * Returns the names of the params that needed a sorted index because their rows are out of order
+ */
+std::vector<std::wstring> get_unsorted_param_names();
+
+/**
+ * Summary of a param table's contents, for keying caches of data derived from it and noticing when
+ * it's been replaced or edited (e.g. by a regulation reload or another mod)
+ */
+struct ParamFingerprint
+{
+    uint32_t num_rows;
+    uint64_t ids_hash;
+    uint64_t data_hash;
+
+    bool operator==(const ParamFingerprint &) const = default;
+};
+
+/**
+ * Hashes the row IDs of a table in row order, and the row data region from the first row to the end
+ * of the last one
+ */
+ParamFingerprint fingerprint(const ParamTable *param_table, size_t row_size);
+
 template <typename T> class ParamTableSequence
 {
   private:
     ParamTable *param_table;
-    const std::wstring param_name;
+    std::wstring_view param_name;
+    std::shared_ptr<const ParamTableIndex> index;
 
     static inline T *get_row_data(ParamTable *table, ParamRowInfo *row)
     {
         return reinterpret_cast<T *>(reinterpret_cast<std::byte *>(table) + row->param_offset);
     }
 
+    /**
+     * Binary search for the param row with the given ID, using the table's sorted index if its
+     * rows are out of order
+     */
+    ParamRowInfo *find_row(uint64_t id)
+    {
+        if (index == nullptr)
+        {
+            index = get_table_index(param_table, param_name);
+        }
+
+        if (!index->may_contain(id))
+        {
+            return nullptr;
+        }
+
+        if (index->is_sorted)
+        {
+            auto rows_end = param_table->rows + param_table->num_rows;
+            auto row = std::lower_bound(
+                param_table->rows, rows_end, id,
+                [](const ParamRowInfo &row, uint64_t id) { return row.row_id < id; });
+            return row != rows_end && row->row_id == id ? row : nullptr;
+        }
+        else
+        {
+            auto row = std::lower_bound(
+                index->sorted_rows.begin(), index->sorted_rows.end(), id,
+                [](const ParamRowInfo *row, uint64_t id) { return row->row_id < id; });
+            return row != index->sorted_rows.end() && (*row)->row_id == id ? *row : nullptr;
+        }
+    }
+
+    template <typename Rows, typename GetRow>
+    void merge_rows(Rows rows, std::span<const uint64_t> ids, std::span<T *> results,
+                    GetRow get_row)
+    {
+        auto row_id = [&](size_t i) { return get_row(rows[i])->row_id; };
+
+        size_t pos = 0;
+        for (size_t i = 0; i < ids.size(); i++)
+        {
+            auto id = ids[i];
+            results[i] = nullptr;
+
+            if (!index->may_contain(id))
+            {
+                continue;
+            }
+
+            // Gallop forward to bracket the ID, then binary search within the bracket
+            size_t step = 1;
+            while (pos + step < rows.size() && row_id(pos + step) < id)
+            {
+                step *= 2;
+            }
+
+            auto first = rows.begin() + (pos + step / 2 < rows.size() ? pos + step / 2 : pos);
+            auto last = rows.begin() + std::min(pos + step + 1, rows.size());
+            auto row = std::lower_bound(first, last, id, [&](auto &row, uint64_t id) {
+                return get_row(row)->row_id < id;
+            });
+
+            pos = row - rows.begin();
+            if (row != last && get_row(*row)->row_id == id)
+            {
+                results[i] = get_row_data(param_table, get_row(*row));
+            }
+        }
+    }
+
   public:
+    /**
+     * Random-access iterator over the table's rows, yielding (row ID, row data) pairs. This walks
+     * the contiguous ParamRowInfo array, so it works with std::ranges algorithms and can be split
+     * into chunks.
+     */
     class Iterator
     {
-        ParamTable *table;
-        ParamRowInfo *row;
+        ParamTable *table = nullptr;
+        ParamRowInfo *row = nullptr;
 
       public:
+        using difference_type = ptrdiff_t;
+        using value_type = std::pair<uint64_t, T &>;
+        using reference = std::pair<uint64_t, T &>;
+        using pointer = void;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+
+        Iterator() = default;
+
         Iterator(ParamTable *table, ParamRowInfo *row) : table(table), row(row)
         {
         }
 
+        reference operator*() const
+        {
+            return reference(row->row_id, *get_row_data(table, row));
+        }
+
+        reference operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        ParamRowInfo *row_info() const
+        {
+            return row;
+        }
+
         Iterator &operator++()
         {
             row++;
@@ -119,113 +318,301 @@ template <typename T> class ParamTableSequence
             return retval;
         }
 
-        bool operator==(Iterator other) const
+        Iterator &operator--()
+        {
+            row--;
+            return *this;
+        }
+
+        Iterator operator--(int)
         {
-            return table == other.table && row == other.row;
+            Iterator retval = *this;
+            --(*this);
+            return retval;
         }
 
-        bool operator!=(Iterator other) const
+        Iterator &operator+=(difference_type n)
         {
-            return !(*this == other);
+            row += n;
+            return *this;
         }
 
-        std::pair<uint64_t, T &> operator*()
+        Iterator &operator-=(difference_type n)
         {
-            return std::pair<uint64_t, T &>(row->row_id, *get_row_data(table, row));
+            row -= n;
+            return *this;
         }
 
-        using difference_type = int64_t;
-        using value_type = std::pair<uint64_t, T &>;
-        using pointer = const std::pair<uint64_t, T &> *;
-        using reference = const std::pair<uint64_t, T &> &;
-        using iterator_category = std::output_iterator_tag;
+        friend Iterator operator+(Iterator it, difference_type n)
+        {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it)
+        {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(Iterator a, Iterator b)
+        {
+            return a.row - b.row;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return row == other.row;
+        }
+
+        auto operator<=>(const Iterator &other) const
+        {
+            return row <=> other.row;
+        }
     };
 
-    ParamTableSequence(ParamTable *param_table, const std::wstring param_name)
+    ParamTableSequence(ParamTable *param_table, std::wstring_view param_name)
         : param_table(param_table), param_name(param_name)
     {
     }
 
-    T &operator[](uint64_t id)
+    /**
+     * Returns the row with the given ID, or nullptr if there isn't one
+     */
+    T *try_get(uint64_t id)
+    {
+        auto row = find_row(id);
+        return row != nullptr ? get_row_data(param_table, row) : nullptr;
+    }
+
+    /**
+     * Looks up many rows at once. The IDs must be sorted in ascending order, and each result is
+     * set to the matching row or nullptr if there isn't one.
+     *
+     * The rows are resolved in a single forward pass, galloping ahead when the IDs are sparse,
+     * which is much cheaper than one binary search per ID for large batches.
+     */
+    void get_many(std::span<const uint64_t> ids, std::span<T *> results)
     {
-        // Binary search for the param row, assuming all rows are sorted
-        ptrdiff_t begin_index = 0;
-        ptrdiff_t end_index = param_table->num_rows - 1;
-        while (begin_index <= end_index)
+        if (results.size() < ids.size())
         {
-            auto index = (end_index + begin_index) / 2;
-            auto row = &param_table->rows[index];
-            if (row->row_id < id)
-                begin_index = index + 1;
-            else if (row->row_id > id)
-                end_index = index - 1;
-            else
-                return *get_row_data(param_table, row);
+            spdlog::error("Param {} batch lookup of {} rows given {} results",
+                          modutils::utf8{param_name}, ids.size(), results.size());
+            throw std::runtime_error("Too few results for batch lookup");
         }
 
-        // Check for out-of-order param rows if we didn't find it with a binary search
-        for (auto i = 0; i < param_table->num_rows; i++)
+        if (index == nullptr)
         {
-            auto index1 = begin_index - i;
-            auto index2 = begin_index + i;
-            if (index1 >= 0 && index1 < param_table->num_rows)
-            {
-                auto row = &param_table->rows[index1];
-                if (row->row_id == id)
-                    return *get_row_data(param_table, row);
-            }
-            if (index2 >= 0 && index2 < param_table->num_rows)
-            {
-                auto row = &param_table->rows[index2];
-                if (row->row_id == id)
-                    return *get_row_data(param_table, row);
-            }
+            index = get_table_index(param_table, param_name);
         }
 
-        spdlog::error("Param row {}[{}] not found", internal::wstring_to_string(param_name), id);
-        throw std::runtime_error("Row not found");
+        if (index->is_sorted)
+        {
+            merge_rows(row_infos(), ids, results, [](ParamRowInfo &row) { return &row; });
+        }
+        else
+        {
+            merge_rows(std::span(index->sorted_rows), ids, results,
+                       [](ParamRowInfo *row) { return row; });
+        }
     }
 
-    Iterator begin()
+    T &operator[](uint64_t id)
+    {
+        auto row = find_row(id);
+        if (row == nullptr)
+        {
+            spdlog::error("Param row {}[{}] not found", modutils::utf8{param_name}, id);
+            throw std::runtime_error("Row not found");
+        }
+
+        return *get_row_data(param_table, row);
+    }
+
+    Iterator begin() const
     {
         return Iterator(param_table, &param_table->rows[0]);
     }
 
-    Iterator end()
+    Iterator end() const
     {
         return Iterator(param_table, &param_table->rows[param_table->num_rows]);
     }
 
-    size_t size()
+    size_t size() const
     {
         return param_table->num_rows;
     }
+
+    /**
+     * Returns the name the param was looked up by
+     */
+    std::wstring_view name() const
+    {
+        return param_name;
+    }
+
+    ParamFingerprint fingerprint() const
+    {
+        return params::fingerprint(param_table, sizeof(T));
+    }
+
+    /**
+     * Returns the table the rows are read from, which is replaced when the param is reloaded
+     */
+    const ParamTable *table() const
+    {
+        return param_table;
+    }
+
+    /**
+     * Returns the raw row info array, in the table's stored order
+     */
+    std::span<ParamRowInfo> row_infos() const
+    {
+        return {param_table->rows, param_table->num_rows};
+    }
 };
 
+/**
+ * Calls fn(id, row, result) for every row of the param on a small pool of worker threads. The rows
+ * are split into contiguous chunks that each fill their own Result, and the results are returned
+ * in row order, so merging them front to back gives the same output as a serial pass.
+ */
+template <typename Result, typename T, typename Fn>
+std::vector<Result> parallel_for_each(const ParamTableSequence<T> &param, Fn fn,
+                                      size_t min_chunk_rows = 1024)
+{
+    auto chunk_rows = std::max(min_chunk_rows, param.size() / (modutils::worker_count() * 2) + 1);
+    auto chunk_count = (param.size() + chunk_rows - 1) / chunk_rows;
+
+    std::vector<Result> results(chunk_count);
+    modutils::run_parallel(chunk_count, [&](size_t chunk) {
+        auto begin = param.begin() + chunk * chunk_rows;
+        auto end = param.begin() + std::min((chunk + 1) * chunk_rows, param.size());
+        for (auto [id, row] : std::ranges::subrange(begin, end))
+        {
+            fn(id, row, results[chunk]);
+        }
+    });
+
+    return results;
+}
+
+static_assert(std::random_access_iterator<ParamTableSequence<std::byte>::Iterator>);
+static_assert(std::ranges::random_access_range<ParamTableSequence<std::byte>>);
+static_assert(std::ranges::sized_range<ParamTableSequence<std::byte>>);
+
 /**
  * Returns a type-safe STL-style container with the given param
  */
-template <typename T> ParamTableSequence<T> get_param(std::wstring name)
+template <typename T> ParamTableSequence<T> get_param(std::wstring_view name)
+{
+    auto param_res_cap = find_param_res_cap(name);
+    if (param_res_cap != nullptr)
+    {
+        return ParamTableSequence<T>(param_res_cap->param_header->param_table,
+                                     dlw_c_str(&param_res_cap->param_name));
+    }
+
+    spdlog::error("Param {} not found", modutils::utf8{name});
+    throw std::runtime_error("Param not found");
+}
+
+namespace internal
+{
+/**
+ * ParamList slot resolved for a paramdef struct and name index, along with the list and table it
+ * was resolved from. Records are immutable once published, so a reader always sees a list, slot
+ * and table that belong together.
+ */
+struct param_slot_record
+{
+    ParamList *param_list;
+    int index;
+    ParamTable *param_table;
+    unsigned int generation;
+};
+
+/**
+ * Incremented by invalidate_param_caches(), which makes every slot record older than it stale
+ */
+inline std::atomic<unsigned int> param_cache_generation = 0;
+
+/**
+ * Latest slot record for a paramdef struct and name index. Replaced records are never freed, since
+ * another thread may still be reading one, but they're only replaced when the params are reloaded.
+ */
+template <bound_param T, size_t Index> struct param_slot
 {
-    auto param_list = *param_list_address;
-    if (param_list != nullptr)
+    static inline std::atomic<const param_slot_record *> record = nullptr;
+};
+}
+
+/**
+ * Returns a type-safe STL-style container with the param bound to the given paramdef struct in
+ * param_traits. The ParamList slot is only looked up by name once, after which it's reused for as
+ * long as the ParamList and the table in that slot stay the same.
+ */
+template <bound_param T, size_t Index = 0> ParamTableSequence<T> get_param()
+{
+    static_assert(Index < param_traits<T>::names.size(), "No param with this index for this type");
+    using slot = internal::param_slot<T, Index>;
+    static constexpr auto name = param_traits<T>::names[Index];
+
+    auto generation = internal::param_cache_generation.load(std::memory_order_acquire);
+    auto param_list = param_list_address != nullptr ? *param_list_address : nullptr;
+    auto record = slot::record.load(std::memory_order_acquire);
+    if (record != nullptr && record->param_list == param_list && record->generation == generation)
     {
-        for (int i = 0; i < sizeof(param_list->entries) / sizeof(param_list->entries[0]); i++)
+        auto param_res_cap = param_list->entries[record->index].param_res_cap;
+        if (param_res_cap != nullptr &&
+            param_res_cap->param_header->param_table == record->param_table)
         {
-            auto param_res_cap = param_list->entries[i].param_res_cap;
-            if (param_res_cap != nullptr)
-            {
-                std::wstring_view param_name = dlw_c_str(&param_res_cap->param_name);
-                if (param_name == name)
-                {
-                    return ParamTableSequence<T>(param_res_cap->param_header->param_table, name);
-                }
-            }
+            return ParamTableSequence<T>(record->param_table, name);
         }
     }
 
-    spdlog::error("Param {} not found", internal::wstring_to_string(name));
-    throw std::runtime_error("Param not found");
+    auto entry = find_param_entry(name);
+    if (entry == nullptr)
+    {
+        spdlog::error("Param {} not found", modutils::utf8{name});
+        throw std::runtime_error("Param not found");
+    }
+
+    auto param_table = entry->param_res_cap->param_header->param_table;
+
+    // Only cache the slot if the ParamList wasn't replaced during the lookup
+    if (param_list != nullptr && entry >= std::begin(param_list->entries) &&
+        entry < std::end(param_list->entries))
+    {
+        auto index = static_cast<int>(entry - param_list->entries);
+        slot::record.store(
+            new internal::param_slot_record{param_list, index, param_table, generation},
+            std::memory_order_release);
+
+        // The param was reloaded into a new table, so the old table's index won't be used again
+        if (record != nullptr && record->generation == generation &&
+            record->param_table != param_table)
+        {
+            release_table_index(record->param_table);
+        }
+    }
+
+    return ParamTableSequence<T>(param_table, name);
+}
+
+/**
+ * Returns every param bound to the given paramdef struct, in the order listed in param_traits
+ */
+template <bound_param T> auto get_params()
+{
+    return []<size_t... Indices>(std::index_sequence<Indices...>) {
+        return std::array{get_param<T, Indices>()...};
+    }(std::make_index_sequence<param_traits<T>::names.size()>());
 }
 }
 }
\ No newline at end of file
@@ -1,6 +1,4 @@
-#include <codecvt>
 #include <filesystem>
-#include <locale>
 #include <span>
 #include <stdexcept>
 #include <string>
@@ -33,11 +31,9 @@ void modutils::initialize()
         throw runtime_error("Failed to get handle for eldenring.exe process");
     }
 
-    wstring_convert<codecvt_utf8_utf16<wchar_t>, wchar_t> convert;
-
     wchar_t exe_filename[MAX_PATH] = {0};
     GetModuleFileNameW(module_handle, exe_filename, MAX_PATH);
-    spdlog::info("Found handle for eldenring.exe process: {}", convert.to_bytes(exe_filename));
+    spdlog::info("Found handle for eldenring.exe process: {}", modutils::utf8{exe_filename});
 
     auto exe_directory = filesystem::path(exe_filename).parent_path();
     for (auto i = 0; i < size(sus_filenames); i++)
@@ -124,6 +120,31 @@ void modutils::hook(void *function, void *detour, void **trampoline)
     }
 }
 
+bool modutils::is_readable(const void *address, size_t size)
+{
+    auto begin = reinterpret_cast<uintptr_t>(address);
+    auto end = begin + size;
+    if (address == nullptr || end < begin)
+    {
+        return false;
+    }
+
+    while (begin < end)
+    {
+        MEMORY_BASIC_INFORMATION memory_info;
+        if (VirtualQuery(reinterpret_cast<void *>(begin), &memory_info, sizeof(memory_info)) == 0 ||
+            memory_info.State != MEM_COMMIT ||
+            (memory_info.Protect & (PAGE_NOACCESS | PAGE_GUARD | PAGE_EXECUTE)) != 0)
+        {
+            return false;
+        }
+
+        begin = reinterpret_cast<uintptr_t>(memory_info.BaseAddress) + memory_info.RegionSize;
+    }
+
+    return true;
+}
+
 void modutils::enable_hooks()
 {
     auto mh_status = MH_ApplyQueued();
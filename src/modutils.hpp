@@ -1,7 +1,21 @@
 #pragma once
 #define WIN32_LEAN_AND_MEAN
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace modutils
@@ -23,6 +37,12 @@ void *scan(const ScanArgs &args);
 
 void hook(void *function, void *detour, void **trampoline);
 
+/**
+ * Returns true if every byte of the given range is committed memory that can be read, for checking
+ * pointers into the game's data structures before following them
+ */
+bool is_readable(const void *address, size_t size);
+
 template <typename ReturnType> inline ReturnType *scan(const ScanArgs &args)
 {
     return reinterpret_cast<ReturnType *>(scan(args));
@@ -41,4 +61,185 @@ inline FunctionType *hook(const ScanArgs &args, FunctionType &detour, FunctionTy
     return function;
 }
 
-};
\ No newline at end of file
+/**
+ * Memory mapping of a whole file. Pages are mapped copy-on-write, so the contents can be used in
+ * place (and even modified) without copying the file or writing back to it.
+ */
+class mapped_file
+{
+  public:
+    explicit mapped_file(const std::filesystem::path &path);
+    ~mapped_file();
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    std::span<std::byte> data() const
+    {
+        return {address, size};
+    }
+
+  private:
+    std::byte *address = nullptr;
+    size_t size = 0;
+};
+
+/**
+ * Number of threads used by run_parallel(), including the calling thread. This is kept small,
+ * since the mod shares the machine with the game.
+ */
+inline size_t worker_count()
+{
+    return std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1, 4);
+}
+
+namespace internal
+{
+void run_parallel(size_t task_count, void (*run_task)(void *, size_t), void *task);
+}
+
+/**
+ * Runs task(0) through task(task_count - 1) on a pool of worker_count() - 1 threads plus the
+ * calling thread, and waits for all of them to finish. The pool threads are started by the first
+ * call and reused afterwards. Calls can be nested, since a caller runs its own tasks when every
+ * pool thread is busy. If any task throws, the first exception is rethrown on the calling thread.
+ */
+template <typename Task> void run_parallel(size_t task_count, Task &&task)
+{
+    using task_type = std::remove_reference_t<Task>;
+    internal::run_parallel(
+        task_count, [](void *task, size_t i) { (*static_cast<task_type *>(task))(i); },
+        const_cast<void *>(static_cast<const void *>(std::addressof(task))));
+}
+
+/**
+ * Map stored as a vector of (key, value) pairs sorted by key, for lookup tables that are built once
+ * and then only read. Lookups are binary searches over contiguous memory, and the whole map is one
+ * allocation instead of one per node.
+ */
+template <typename Key, typename Value> class flat_map
+{
+  public:
+    using value_type = std::pair<Key, Value>;
+
+    flat_map() = default;
+
+    /**
+     * Builds the map from (key, value) pairs in any order. If a key appears more than once, the
+     * last value wins, as with repeated assignments to a std::map.
+     */
+    explicit flat_map(std::vector<value_type> entries) : entries(std::move(entries))
+    {
+        std::ranges::stable_sort(this->entries, {}, &value_type::first);
+
+        // Keep the last entry of each run of equal keys
+        auto last = std::unique(this->entries.rbegin(), this->entries.rend(),
+                                [](auto &a, auto &b) { return a.first == b.first; });
+        this->entries.erase(this->entries.begin(), last.base());
+    }
+
+    const Value *find(const Key &key) const
+    {
+        auto entry = std::ranges::lower_bound(entries, key, {}, &value_type::first);
+        return entry != entries.end() && entry->first == key ? &entry->second : nullptr;
+    }
+
+    Value value_or(const Key &key, Value default_value) const
+    {
+        auto value = find(key);
+        return value ? *value : default_value;
+    }
+
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+    auto begin() const
+    {
+        return entries.begin();
+    }
+
+    auto end() const
+    {
+        return entries.end();
+    }
+
+  private:
+    std::vector<value_type> entries;
+};
+
+/**
+ * Largest number of UTF-8 bytes a wide string of the given length can transcode to. Surrogate
+ * pairs take 4 bytes for 2 code units, so 3 bytes per code unit is the worst case for UTF-16 (and
+ * 4 where wchar_t is UTF-32, i.e. outside of Windows).
+ */
+constexpr size_t max_utf8_size(size_t utf16_length)
+{
+    return utf16_length * (sizeof(wchar_t) == sizeof(char16_t) ? 3 : 4);
+}
+
+/**
+ * Transcodes UTF-16 to UTF-8 into a caller-provided buffer, which must hold at least
+ * max_utf8_size(utf16.size()) bytes, and returns the number of bytes written. Unpaired surrogates
+ * are replaced with U+FFFD. Runs of ASCII characters are copied 8 code units at a time.
+ */
+size_t utf16_to_utf8(std::u16string_view utf16, std::span<char> utf8);
+
+/**
+ * Same as above, for the game's wide strings
+ */
+size_t utf16_to_utf8(std::wstring_view utf16, std::span<char> utf8);
+
+/**
+ * Transcodes a wide string into a new UTF-8 string, for when the result needs to be kept
+ */
+inline std::string to_utf8(std::wstring_view wstr)
+{
+    std::string result(max_utf8_size(wstr.size()), '\0');
+    result.resize(utf16_to_utf8(wstr, result));
+    return result;
+}
+
+/**
+ * Formats a wide string as UTF-8 without allocating, e.g.
+ * spdlog::info("Param {} not found", modutils::utf8{name})
+ */
+struct utf8
+{
+    std::wstring_view wstr;
+};
+
+};
+
+template <> struct std::formatter<modutils::utf8, char>
+{
+    constexpr auto parse(std::format_parse_context &ctx)
+    {
+        return ctx.begin();
+    }
+
+    auto format(const modutils::utf8 &value, std::format_context &ctx) const
+    {
+        constexpr size_t chunk_length = 256;
+        char buffer[modutils::max_utf8_size(chunk_length)];
+
+        auto out = ctx.out();
+        for (auto wstr = value.wstr; !wstr.empty();)
+        {
+            auto length = std::min(chunk_length, wstr.size());
+
+            // Don't split a surrogate pair between chunks
+            if (length < wstr.size() && wstr[length - 1] >= 0xd800 && wstr[length - 1] < 0xdc00)
+            {
+                length--;
+            }
+
+            auto size = modutils::utf16_to_utf8(wstr.substr(0, length), buffer);
+            out = std::copy(buffer, buffer + size, out);
+            wstr.remove_prefix(length);
+        }
+
+        return out;
+    }
+};
@@ -0,0 +1,82 @@
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "modutils.hpp"
+
+using namespace std;
+
+modutils::mapped_file::mapped_file(const filesystem::path &path)
+{
+#ifdef _WIN32
+    auto file_handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                   OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE)
+    {
+        throw runtime_error("Failed to open " + path.string());
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart == 0)
+    {
+        CloseHandle(file_handle);
+        throw runtime_error("Failed to get the size of " + path.string());
+    }
+
+    auto mapping_handle = CreateFileMappingW(file_handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file_handle);
+    if (mapping_handle == nullptr)
+    {
+        throw runtime_error("Failed to map " + path.string());
+    }
+
+    // The view keeps the mapping alive after its handle is closed
+    auto view = MapViewOfFile(mapping_handle, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping_handle);
+    if (view == nullptr)
+    {
+        throw runtime_error("Failed to map " + path.string());
+    }
+
+    address = static_cast<std::byte *>(view);
+    size = static_cast<size_t>(file_size.QuadPart);
+#else
+    auto fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw runtime_error("Failed to open " + path.string());
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+    {
+        close(fd);
+        throw runtime_error("Failed to get the size of " + path.string());
+    }
+
+    auto view = mmap(nullptr, file_stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED)
+    {
+        throw runtime_error("Failed to map " + path.string());
+    }
+
+    address = static_cast<std::byte *>(view);
+    size = static_cast<size_t>(file_stat.st_size);
+#endif
+}
+
+modutils::mapped_file::~mapped_file()
+{
+#ifdef _WIN32
+    UnmapViewOfFile(address);
+#else
+    munmap(address, size);
+#endif
+}
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "modutils.hpp"
+
+using namespace std;
+
+namespace
+{
+
+struct parallel_job
+{
+    size_t task_count;
+    void (*run_task)(void *, size_t);
+    void *task;
+
+    atomic<size_t> next_task = 0;
+
+    /**
+     * Number of pool threads that picked up this job and haven't finished with it yet. Guarded by
+     * the pool mutex.
+     */
+    size_t active_workers = 0;
+
+    /**
+     * First exception thrown by a task. Guarded by the pool mutex.
+     */
+    exception_ptr exception;
+};
+
+/**
+ * Worker threads shared by every run_parallel() call. The threads are started on first use and
+ * live for the rest of the process, so a call only has to wake them up instead of creating and
+ * joining threads every time.
+ */
+class thread_pool
+{
+  public:
+    explicit thread_pool(size_t thread_count)
+    {
+        // The threads are detached and the pool is never destroyed, so nothing waits on them
+        // while the DLL is unloading
+        for (size_t i = 0; i < thread_count; i++)
+        {
+            thread([this]() { run_worker(); }).detach();
+        }
+    }
+
+    void run(parallel_job &job)
+    {
+        {
+            lock_guard lock(pool_mutex);
+            jobs.push_back(&job);
+        }
+        work_available.notify_all();
+
+        // The calling thread works on its own job too, so a nested call still makes progress
+        // when every pool thread is busy
+        run_tasks(job);
+
+        unique_lock lock(pool_mutex);
+        remove_job(job);
+        job_finished.wait(lock, [&]() { return job.active_workers == 0; });
+    }
+
+  private:
+    mutex pool_mutex;
+    condition_variable work_available;
+    condition_variable job_finished;
+    deque<parallel_job *> jobs;
+
+    void run_worker()
+    {
+        unique_lock lock(pool_mutex);
+        while (true)
+        {
+            work_available.wait(lock, [&]() { return !jobs.empty(); });
+
+            auto &job = *jobs.front();
+            job.active_workers++;
+
+            lock.unlock();
+            run_tasks(job);
+            lock.lock();
+
+            remove_job(job);
+            if (--job.active_workers == 0)
+            {
+                job_finished.notify_all();
+            }
+        }
+    }
+
+    void run_tasks(parallel_job &job)
+    {
+        for (size_t i = job.next_task++; i < job.task_count; i = job.next_task++)
+        {
+            try
+            {
+                job.run_task(job.task, i);
+            }
+            catch (...)
+            {
+                lock_guard lock(pool_mutex);
+                if (!job.exception)
+                {
+                    job.exception = current_exception();
+                }
+            }
+        }
+    }
+
+    /**
+     * Removes a job whose tasks have all been claimed, so no other thread picks it up
+     */
+    void remove_job(parallel_job &job)
+    {
+        auto it = find(jobs.begin(), jobs.end(), &job);
+        if (it != jobs.end())
+        {
+            jobs.erase(it);
+        }
+    }
+};
+
+}
+
+void modutils::internal::run_parallel(size_t task_count, void (*run_task)(void *, size_t),
+                                      void *task)
+{
+    if (task_count <= 1 || worker_count() == 1)
+    {
+        for (size_t i = 0; i < task_count; i++)
+        {
+            run_task(task, i);
+        }
+        return;
+    }
+
+    static auto pool = new thread_pool(worker_count() - 1);
+
+    parallel_job job{task_count, run_task, task};
+    pool->run(job);
+
+    if (job.exception)
+    {
+        rethrow_exception(job.exception);
+    }
+}
@@ -0,0 +1,124 @@
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UTF8_USE_SSE2
+#endif
+
+#include "modutils.hpp"
+
+using namespace std;
+
+static char *encode_code_point(char32_t code_point, char *utf8)
+{
+    if (code_point < 0x80)
+    {
+        *utf8++ = static_cast<char>(code_point);
+    }
+    else if (code_point < 0x800)
+    {
+        *utf8++ = static_cast<char>(0xc0 | (code_point >> 6));
+        *utf8++ = static_cast<char>(0x80 | (code_point & 0x3f));
+    }
+    else if (code_point < 0x10000)
+    {
+        *utf8++ = static_cast<char>(0xe0 | (code_point >> 12));
+        *utf8++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+        *utf8++ = static_cast<char>(0x80 | (code_point & 0x3f));
+    }
+    else
+    {
+        *utf8++ = static_cast<char>(0xf0 | (code_point >> 18));
+        *utf8++ = static_cast<char>(0x80 | ((code_point >> 12) & 0x3f));
+        *utf8++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+        *utf8++ = static_cast<char>(0x80 | (code_point & 0x3f));
+    }
+    return utf8;
+}
+
+/**
+ * Copies code units while all of them are ASCII, and returns the number copied
+ */
+static size_t copy_ascii(const char16_t *utf16, size_t length, char *utf8)
+{
+    size_t i = 0;
+
+#ifdef UTF8_USE_SSE2
+    auto non_ascii_mask = _mm_set1_epi16(static_cast<short>(0xff80));
+    for (; i + 8 <= length; i += 8)
+    {
+        auto units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf16 + i));
+        auto non_ascii = _mm_and_si128(units, non_ascii_mask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii, _mm_setzero_si128())) != 0xffff)
+        {
+            break;
+        }
+
+        // Every unit is below 0x80, so packing with unsigned saturation just narrows them
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(utf8 + i), _mm_packus_epi16(units, units));
+    }
+#endif
+
+    for (; i < length && utf16[i] < 0x80; i++)
+    {
+        utf8[i] = static_cast<char>(utf16[i]);
+    }
+
+    return i;
+}
+
+size_t modutils::utf16_to_utf8(u16string_view utf16, span<char> utf8)
+{
+    auto out = utf8.data();
+
+    for (size_t i = 0; i < utf16.size();)
+    {
+        auto ascii_length = copy_ascii(utf16.data() + i, utf16.size() - i, out);
+        i += ascii_length;
+        out += ascii_length;
+        if (i == utf16.size())
+        {
+            break;
+        }
+
+        char32_t code_point = utf16[i++];
+        if (code_point >= 0xd800 && code_point < 0xe000)
+        {
+            if (code_point < 0xdc00 && i < utf16.size() && utf16[i] >= 0xdc00 &&
+                utf16[i] < 0xe000)
+            {
+                code_point = 0x10000 + ((code_point - 0xd800) << 10) + (utf16[i++] - 0xdc00);
+            }
+            else
+            {
+                code_point = 0xfffd;
+            }
+        }
+
+        out = encode_code_point(code_point, out);
+    }
+
+    return out - utf8.data();
+}
+
+size_t modutils::utf16_to_utf8(wstring_view utf16, span<char> utf8)
+{
+    if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+    {
+        return utf16_to_utf8(
+            u16string_view(reinterpret_cast<const char16_t *>(utf16.data()), utf16.size()), utf8);
+    }
+    else
+    {
+        // Wide strings are UTF-32 outside of Windows
+        auto out = utf8.data();
+        for (auto code_point : utf16)
+        {
+            bool is_valid = code_point < 0x110000 && (code_point < 0xd800 || code_point >= 0xe000);
+            out = encode_code_point(is_valid ? code_point : 0xfffd, out);
+        }
+        return out - utf8.data();
+    }
+}
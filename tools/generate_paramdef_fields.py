@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""
+Generates compile-time field descriptors for the paramdef structs in src/from/paramdef/.
+
+For every paramdef header, this writes src/from/paramdef/fields/<STRUCT>.hpp specializing
+from::params::paramdef_fields (see src/from/param_fields.hpp), and src/from/paramdef/fields/all.hpp
+including all of them. Regular fields use offsetof, and bitfields are read through the struct
+member, so the compiler stays the source of truth for the layout.
+
+The struct is also laid out here following MSVC's rules. Its size is checked against the size
+asserted by the paramdef header (where there is one), and each header static_asserts that the
+compiler's offsetof matches the offset computed here for every regular field, so a field that the
+layout below gets wrong fails the build.
+
+Usage: python3 tools/generate_paramdef_fields.py
+"""
+
+import re
+import sys
+from pathlib import Path
+
+root = Path(__file__).resolve().parent.parent
+paramdef_dir = root / "src" / "from" / "paramdef"
+fields_dir = paramdef_dir / "fields"
+
+# C++ type: (field_type, size)
+types = {
+    "bool": ("boolean", 1),
+    "char": ("character", 1),
+    "signed char": ("s8", 1),
+    "unsigned char": ("u8", 1),
+    "short": ("s16", 2),
+    "unsigned short": ("u16", 2),
+    "int": ("s32", 4),
+    "unsigned int": ("u32", 4),
+    "float": ("f32", 4),
+    "wchar_t": ("wide_character", 2),
+}
+
+struct_pattern = re.compile(r"^struct (\w+) \{$(.*?)^\};$", re.MULTILINE | re.DOTALL)
+size_pattern = re.compile(r"static_assert\(\s*sizeof\(from::paramdef::(\w+)\)\s*==\s*(\d+)")
+member_pattern = re.compile(
+    r"^(?P<type>(?:unsigned |signed )?\w+)\s+(?P<name>\w+)"
+    r"(?:\[(?P<count>\d+)\])?(?:\s*:\s*(?P<bits>\d+))?(?:\s*\{.*\})?$",
+    re.DOTALL,
+)
+
+
+def parse_members(body):
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.DOTALL)
+    body = re.sub(r"//[^\n]*", "", body)
+    for declaration in body.split(";"):
+        declaration = declaration.strip()
+        if not declaration:
+            continue
+        match = member_pattern.match(declaration)
+        if match is None or match["type"] not in types:
+            sys.exit(f"Unrecognized member declaration: {declaration!r}")
+        yield (
+            match["type"],
+            match["name"],
+            int(match["count"] or 1),
+            int(match["bits"]) if match["bits"] else None,
+        )
+
+
+def layout(members):
+    """Returns (fields, struct size) using MSVC's layout rules"""
+    fields = []
+    offset = 0
+    alignment = 1
+
+    # Open bitfield storage unit, as (offset, size, bits used)
+    unit = None
+
+    for type_name, name, count, bits in members:
+        field_type, size = types[type_name]
+        alignment = max(alignment, size)
+
+        if bits is None:
+            unit = None
+            offset = (offset + size - 1) // size * size
+            fields.append((name, field_type, offset, size, count, 0))
+            offset += size * count
+            continue
+
+        # MSVC only packs adjacent bitfields into one unit if their types are the same size
+        if unit is None or unit[1] != size or unit[2] + bits > size * 8:
+            offset = (offset + size - 1) // size * size
+            unit = (offset, size, 0)
+            offset += size
+
+        fields.append((name, field_type, unit[0], size, 1, bits))
+        unit = (unit[0], unit[1], unit[2] + bits)
+
+    return fields, (offset + alignment - 1) // alignment * alignment
+
+
+def generate(header):
+    source = header.read_text()
+    struct_match = struct_pattern.search(source)
+    if struct_match is None:
+        return None
+
+    struct_name = struct_match[1]
+    fields, size = layout(parse_members(struct_match[2]))
+
+    # A few headers don't assert their size, so their layout can't be checked here
+    expected_size = size_pattern.search(source)
+    if expected_size is not None and int(expected_size[2]) != size:
+        sys.exit(f"{struct_name}: computed size {size} doesn't match the paramdef size")
+
+    lines = [
+        "/* This file was automatically generated by tools/generate_paramdef_fields.py. */",
+        "#pragma once",
+        "",
+        "#include <array>",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "",
+        '#include "../../param_fields.hpp"',
+        f'#include "../{header.name}"',
+        "",
+        "namespace from {",
+        "namespace params {",
+        f"template <> struct paramdef_fields<paramdef::{struct_name}> {{",
+        f"    using T = paramdef::{struct_name};",
+        "",
+        f"    static constexpr std::array<field_descriptor, {len(fields)}> fields = {{{{",
+    ]
+    for name, field_type, offset, field_size, count, bit_width in fields:
+        if bit_width == 0:
+            lines.append(
+                f'        {{ "{name}", field_type::{field_type}, offsetof(T, {name}), '
+                f"{field_size}, {count}, nullptr }},"
+            )
+        else:
+            member = f"static_cast<const T *>(row)->{name}"
+            read = f"[](const void *row) -> uint64_t {{ return {member}; }}"
+            lines.append(
+                f'        {{ "{name}", field_type::{field_type}, {offset}, {field_size}, {count}, '
+                f"{read} }},"
+            )
+    lines += [
+        "    }};",
+        "};",
+        "",
+    ]
+    for name, field_type, offset, field_size, count, bit_width in fields:
+        if bit_width == 0:
+            member = f"paramdef::{struct_name}, {name}"
+            lines.append(f"static_assert(offsetof({member}) == {offset});")
+    lines += [
+        "",
+        "}; // namespace params",
+        "}; // namespace from",
+        "",
+    ]
+    return struct_name, "\n".join(lines)
+
+
+def main():
+    fields_dir.mkdir(exist_ok=True)
+    struct_names = []
+    for header in sorted(paramdef_dir.glob("*.hpp")):
+        result = generate(header)
+        if result is None:
+            continue
+        struct_name, text = result
+        (fields_dir / f"{struct_name}.hpp").write_text(text, newline="\n")
+        struct_names.append(struct_name)
+
+    lines = [
+        "/* This file was automatically generated by tools/generate_paramdef_fields.py. */",
+        "#pragma once",
+        "",
+    ]
+    lines += [f'#include "{struct_name}.hpp"' for struct_name in struct_names]
+    lines.append("")
+    (fields_dir / "all.hpp").write_text("\n".join(lines), newline="\n")
+
+    print(f"Generated field descriptors for {len(struct_names)} paramdefs")
+
+
+if __name__ == "__main__":
+    main()